@@ -380,6 +380,13 @@ set( CMAKE_EXTRA_INCLUDE_FILES "sys/types.h" )
 check_type_size( pthread_t SIZEOF_PTHREAD_T )
 unset( CMAKE_EXTRA_INCLUDE_FILES )
 
+# pthread_setaffinity_np is used to bind threads to host processors
+# (the affinity statement).  It is optional.
+
+set( CMAKE_REQUIRED_LIBRARIES ${CMAKE_THREAD_LIBS_INIT} )
+herc_Check_Function_Exists( pthread_setaffinity_np OK )
+set( CMAKE_REQUIRED_LIBRARIES "" )
+
 
 # At least one of the following integer type headers must exist.
 # Hercules file hstdint.h tests first for stdint.h, then inttypes.h,
@@ -831,6 +838,11 @@ herc_Check_Symbol_Exists( MTEWARN    sys/mtio.h   OK)
 herc_Check_Include_Files(   sys/un.h        OK )
 
 
+# Headers for batched hardcopy log writes (logger.c)
+
+herc_Check_Include_Files(   sys/uio.h       OK )
+
+
 # See if Open Object Rexx is installed.  Open Object Rexx will be
 # included in the Hercules build if avaiable and not excluded by user
 # option.  Hercules does not require Open Object Rexx to build correctly.
@@ -326,9 +326,11 @@ herc_Define_Executable( hetget    "${hetget_sources}"    herct )
 herc_Define_Executable( hetinit   "${hetinit_sources}"   herct )
 herc_Define_Executable( hetmap    "${hetmap_sources}"    herct )
 herc_Define_Executable( hetupd    "${hetupd_sources}"    herct )
+herc_Define_Executable( pttfmt    "${pttfmt_sources}"    hercd )
 herc_Define_Executable( tapecopy  "${tapecopy_sources}"  herct )
 herc_Define_Executable( tapemap   "${tapemap_sources}"   herct )
 herc_Define_Executable( tapesplt  "${tapesplt_sources}"  herct )
+herc_Define_Executable( tracedump "${tracedump_sources}" hercd )
 herc_Define_Executable( vmfplc2   "${vmfplc2_sources}"   herct )
 
 
@@ -38,6 +38,8 @@ set( dasdpdsu_sources   dasdpdsu.c dasdblks.h )
 set( dasdseq_sources    dasdseq.c )
 
 set( dmap2hrc_sources   dmap2hrc.c )
+set( pttfmt_sources     pttfmt.c )
+set( tracedump_sources  tracedump.c itrace.h )
 
 # Tape utilities
 set( hetget_sources     hetget.c )
@@ -101,6 +103,7 @@ set( altcmpsc_sources   cmpsc.c )
 set( dyncrypt_sources
         crypto/aes.h
         crypto/des.h
+        crypto/hwaccel.h
         crypto/sha1.h
         crypto/sha256.h
         crypto/aes.c
@@ -442,6 +445,7 @@ set(herc_sources
                 impl.c
                 io.c
                 ipl.c
+                itrace.c
                 loadmem.c
                 loadparm.c
                 losc.c
@@ -450,6 +454,7 @@ set(herc_sources
                 panel.c
                 pfpo.c
                 plo.c
+                prof.c
                 qdio.c
                 scedasd.c
                 scescsi.c
@@ -461,11 +466,13 @@ set(herc_sources
                 strsignal.c
                 timer.c
                 trace.c
+                transact.c
                 vector.c
                 vm.c
                 vmd250.c
                 vstore.c
                 xstore.c
+                zvector.c
       )
 
 
@@ -551,6 +558,7 @@ set( headers_sources
                 httpmisc.h
                 htypes.h
                 inline.h
+                itrace.h
                 linklist.h
                 logger.h
                 ltdl.h
@@ -561,6 +569,7 @@ set( headers_sources
                 opcode.h
                 parser.h
                 printfmt.h
+                prof.h
                 pttrace.h
                 qdio.h
                 qeth.h
@@ -724,6 +733,8 @@ if( WIN32 )
 
 # Other Utilities and the main executable
     set( dmap2hrc_sources  ${dmap2hrc_sources}  hercmisc.rc )
+    set( pttfmt_sources    ${pttfmt_sources}    hercmisc.rc )
+    set( tracedump_sources ${tracedump_sources} hercmisc.rc )
     set( conspawn_sources  ${conspawn_sources}  hercmisc.rc )
 
 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/altcmpsc.dir/cmpsc.c.o"
+  "CMakeFiles/altcmpsc.dir/cmpsc.c.o.d"
+  "altcmpsc.pdb"
+  "altcmpsc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/altcmpsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cckdcdsk.dir/cckdcdsk.c.o"
+  "CMakeFiles/cckdcdsk.dir/cckdcdsk.c.o.d"
+  "cckdcdsk"
+  "cckdcdsk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cckdcdsk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
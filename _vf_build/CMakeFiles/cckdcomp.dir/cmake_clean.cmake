@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cckdcomp.dir/cckdcomp.c.o"
+  "CMakeFiles/cckdcomp.dir/cckdcomp.c.o.d"
+  "cckdcomp"
+  "cckdcomp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cckdcomp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
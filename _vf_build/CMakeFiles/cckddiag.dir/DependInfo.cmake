@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cckddiag.c" "CMakeFiles/cckddiag.dir/cckddiag.c.o" "gcc" "CMakeFiles/cckddiag.dir/cckddiag.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercd.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cckddiag.dir/cckddiag.c.o"
+  "CMakeFiles/cckddiag.dir/cckddiag.c.o.d"
+  "cckddiag"
+  "cckddiag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cckddiag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
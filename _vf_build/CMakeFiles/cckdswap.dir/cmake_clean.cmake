@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cckdswap.dir/cckdswap.c.o"
+  "CMakeFiles/cckdswap.dir/cckdswap.c.o.d"
+  "cckdswap"
+  "cckdswap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cckdswap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
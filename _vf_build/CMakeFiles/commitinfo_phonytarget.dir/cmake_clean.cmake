@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/commitinfo_phonytarget"
+  "commitinfo.h"
+  "commitinfo.phony"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/commitinfo_phonytarget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
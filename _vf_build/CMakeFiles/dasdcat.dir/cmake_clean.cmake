@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdcat.dir/dasdcat.c.o"
+  "CMakeFiles/dasdcat.dir/dasdcat.c.o.d"
+  "dasdcat"
+  "dasdcat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdcat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
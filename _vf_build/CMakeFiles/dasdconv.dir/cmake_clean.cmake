@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdconv.dir/dasdconv.c.o"
+  "CMakeFiles/dasdconv.dir/dasdconv.c.o.d"
+  "dasdconv"
+  "dasdconv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
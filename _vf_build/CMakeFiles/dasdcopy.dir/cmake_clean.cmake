@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdcopy.dir/dasdcopy.c.o"
+  "CMakeFiles/dasdcopy.dir/dasdcopy.c.o.d"
+  "dasdcopy"
+  "dasdcopy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdcopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
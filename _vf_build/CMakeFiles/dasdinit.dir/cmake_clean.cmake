@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdinit.dir/dasdinit.c.o"
+  "CMakeFiles/dasdinit.dir/dasdinit.c.o.d"
+  "dasdinit"
+  "dasdinit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdinit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdisup.dir/dasdisup.c.o"
+  "CMakeFiles/dasdisup.dir/dasdisup.c.o.d"
+  "dasdisup"
+  "dasdisup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdisup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
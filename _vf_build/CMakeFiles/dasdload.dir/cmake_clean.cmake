@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdload.dir/dasdload.c.o"
+  "CMakeFiles/dasdload.dir/dasdload.c.o.d"
+  "dasdload"
+  "dasdload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdls.dir/dasdls.c.o"
+  "CMakeFiles/dasdls.dir/dasdls.c.o.d"
+  "dasdls"
+  "dasdls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
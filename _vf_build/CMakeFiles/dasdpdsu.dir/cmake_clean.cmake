@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdpdsu.dir/dasdpdsu.c.o"
+  "CMakeFiles/dasdpdsu.dir/dasdpdsu.c.o.d"
+  "dasdpdsu"
+  "dasdpdsu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdpdsu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
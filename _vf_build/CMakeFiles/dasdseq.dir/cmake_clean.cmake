@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dasdseq.dir/dasdseq.c.o"
+  "CMakeFiles/dasdseq.dir/dasdseq.c.o.d"
+  "dasdseq"
+  "dasdseq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dasdseq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dmap2hrc.dir/dmap2hrc.c.o"
+  "CMakeFiles/dmap2hrc.dir/dmap2hrc.c.o.d"
+  "dmap2hrc"
+  "dmap2hrc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dmap2hrc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/crypto/aes.c" "CMakeFiles/dyncrypt.dir/crypto/aes.c.o" "gcc" "CMakeFiles/dyncrypt.dir/crypto/aes.c.o.d"
+  "/root/repo/crypto/des.c" "CMakeFiles/dyncrypt.dir/crypto/des.c.o" "gcc" "CMakeFiles/dyncrypt.dir/crypto/des.c.o.d"
+  "/root/repo/crypto/dyncrypt.c" "CMakeFiles/dyncrypt.dir/crypto/dyncrypt.c.o" "gcc" "CMakeFiles/dyncrypt.dir/crypto/dyncrypt.c.o.d"
+  "/root/repo/crypto/sha1.c" "CMakeFiles/dyncrypt.dir/crypto/sha1.c.o" "gcc" "CMakeFiles/dyncrypt.dir/crypto/sha1.c.o.d"
+  "/root/repo/crypto/sha256.c" "CMakeFiles/dyncrypt.dir/crypto/sha256.c.o" "gcc" "CMakeFiles/dyncrypt.dir/crypto/sha256.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
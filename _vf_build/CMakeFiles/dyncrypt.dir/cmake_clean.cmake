@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dyncrypt.dir/crypto/aes.c.o"
+  "CMakeFiles/dyncrypt.dir/crypto/aes.c.o.d"
+  "CMakeFiles/dyncrypt.dir/crypto/des.c.o"
+  "CMakeFiles/dyncrypt.dir/crypto/des.c.o.d"
+  "CMakeFiles/dyncrypt.dir/crypto/dyncrypt.c.o"
+  "CMakeFiles/dyncrypt.dir/crypto/dyncrypt.c.o.d"
+  "CMakeFiles/dyncrypt.dir/crypto/sha1.c.o"
+  "CMakeFiles/dyncrypt.dir/crypto/sha1.c.o.d"
+  "CMakeFiles/dyncrypt.dir/crypto/sha256.c.o"
+  "CMakeFiles/dyncrypt.dir/crypto/sha256.c.o.d"
+  "dyncrypt.pdb"
+  "dyncrypt.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dyncrypt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dyngui.dir/dyngui.c.o"
+  "CMakeFiles/dyngui.dir/dyngui.c.o.d"
+  "dyngui.pdb"
+  "dyngui.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dyngui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
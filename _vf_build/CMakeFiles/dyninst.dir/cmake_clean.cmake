@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dyninst.dir/dyninst.c.o"
+  "CMakeFiles/dyninst.dir/dyninst.c.o.d"
+  "dyninst.pdb"
+  "dyninst.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dyninst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt1052c.dir/con1052c.c.o"
+  "CMakeFiles/hdt1052c.dir/con1052c.c.o.d"
+  "hdt1052c.pdb"
+  "hdt1052c.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt1052c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
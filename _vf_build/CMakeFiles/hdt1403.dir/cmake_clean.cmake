@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt1403.dir/printer.c.o"
+  "CMakeFiles/hdt1403.dir/printer.c.o.d"
+  "CMakeFiles/hdt1403.dir/sockdev.c.o"
+  "CMakeFiles/hdt1403.dir/sockdev.c.o.d"
+  "hdt1403.pdb"
+  "hdt1403.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt1403.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt2703.dir/commadpt.c.o"
+  "CMakeFiles/hdt2703.dir/commadpt.c.o.d"
+  "hdt2703.pdb"
+  "hdt2703.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt2703.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
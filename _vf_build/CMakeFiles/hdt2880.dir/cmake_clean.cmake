@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt2880.dir/hchan.c.o"
+  "CMakeFiles/hdt2880.dir/hchan.c.o.d"
+  "hdt2880.pdb"
+  "hdt2880.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt2880.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
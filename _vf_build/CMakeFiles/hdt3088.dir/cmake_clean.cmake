@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3088.dir/ctc_ctci.c.o"
+  "CMakeFiles/hdt3088.dir/ctc_ctci.c.o.d"
+  "CMakeFiles/hdt3088.dir/ctc_lcs.c.o"
+  "CMakeFiles/hdt3088.dir/ctc_lcs.c.o.d"
+  "CMakeFiles/hdt3088.dir/ctcadpt.c.o"
+  "CMakeFiles/hdt3088.dir/ctcadpt.c.o.d"
+  "CMakeFiles/hdt3088.dir/tuntap.c.o"
+  "CMakeFiles/hdt3088.dir/tuntap.c.o.d"
+  "hdt3088.pdb"
+  "hdt3088.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3088.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
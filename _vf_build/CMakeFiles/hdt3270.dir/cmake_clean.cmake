@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3270.dir/console.c.o"
+  "CMakeFiles/hdt3270.dir/console.c.o.d"
+  "CMakeFiles/hdt3270.dir/telnet.c.o"
+  "CMakeFiles/hdt3270.dir/telnet.c.o.d"
+  "hdt3270.pdb"
+  "hdt3270.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3270.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
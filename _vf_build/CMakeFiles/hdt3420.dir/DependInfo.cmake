@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/awstape.c" "CMakeFiles/hdt3420.dir/awstape.c.o" "gcc" "CMakeFiles/hdt3420.dir/awstape.c.o.d"
+  "/root/repo/faketape.c" "CMakeFiles/hdt3420.dir/faketape.c.o" "gcc" "CMakeFiles/hdt3420.dir/faketape.c.o.d"
+  "/root/repo/hettape.c" "CMakeFiles/hdt3420.dir/hettape.c.o" "gcc" "CMakeFiles/hdt3420.dir/hettape.c.o.d"
+  "/root/repo/omatape.c" "CMakeFiles/hdt3420.dir/omatape.c.o" "gcc" "CMakeFiles/hdt3420.dir/omatape.c.o.d"
+  "/root/repo/scsitape.c" "CMakeFiles/hdt3420.dir/scsitape.c.o" "gcc" "CMakeFiles/hdt3420.dir/scsitape.c.o.d"
+  "/root/repo/scsiutil.c" "CMakeFiles/hdt3420.dir/scsiutil.c.o" "gcc" "CMakeFiles/hdt3420.dir/scsiutil.c.o.d"
+  "/root/repo/tapeccws.c" "CMakeFiles/hdt3420.dir/tapeccws.c.o" "gcc" "CMakeFiles/hdt3420.dir/tapeccws.c.o.d"
+  "/root/repo/tapedev.c" "CMakeFiles/hdt3420.dir/tapedev.c.o" "gcc" "CMakeFiles/hdt3420.dir/tapedev.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/herct.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
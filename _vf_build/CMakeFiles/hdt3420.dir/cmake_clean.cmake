@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3420.dir/awstape.c.o"
+  "CMakeFiles/hdt3420.dir/awstape.c.o.d"
+  "CMakeFiles/hdt3420.dir/faketape.c.o"
+  "CMakeFiles/hdt3420.dir/faketape.c.o.d"
+  "CMakeFiles/hdt3420.dir/hettape.c.o"
+  "CMakeFiles/hdt3420.dir/hettape.c.o.d"
+  "CMakeFiles/hdt3420.dir/omatape.c.o"
+  "CMakeFiles/hdt3420.dir/omatape.c.o.d"
+  "CMakeFiles/hdt3420.dir/scsitape.c.o"
+  "CMakeFiles/hdt3420.dir/scsitape.c.o.d"
+  "CMakeFiles/hdt3420.dir/scsiutil.c.o"
+  "CMakeFiles/hdt3420.dir/scsiutil.c.o.d"
+  "CMakeFiles/hdt3420.dir/tapeccws.c.o"
+  "CMakeFiles/hdt3420.dir/tapeccws.c.o.d"
+  "CMakeFiles/hdt3420.dir/tapedev.c.o"
+  "CMakeFiles/hdt3420.dir/tapedev.c.o.d"
+  "hdt3420.pdb"
+  "hdt3420.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3420.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
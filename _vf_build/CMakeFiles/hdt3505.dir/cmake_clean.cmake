@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3505.dir/cardrdr.c.o"
+  "CMakeFiles/hdt3505.dir/cardrdr.c.o.d"
+  "CMakeFiles/hdt3505.dir/sockdev.c.o"
+  "CMakeFiles/hdt3505.dir/sockdev.c.o.d"
+  "hdt3505.pdb"
+  "hdt3505.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3505.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3525.dir/cardpch.c.o"
+  "CMakeFiles/hdt3525.dir/cardpch.c.o.d"
+  "hdt3525.pdb"
+  "hdt3525.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3525.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
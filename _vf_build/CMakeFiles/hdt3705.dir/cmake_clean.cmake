@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdt3705.dir/comm3705.c.o"
+  "CMakeFiles/hdt3705.dir/comm3705.c.o.d"
+  "hdt3705.pdb"
+  "hdt3705.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdt3705.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
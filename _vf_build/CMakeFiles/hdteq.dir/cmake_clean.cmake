@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdteq.dir/hdteq.c.o"
+  "CMakeFiles/hdteq.dir/hdteq.c.o.d"
+  "hdteq.pdb"
+  "hdteq.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdteq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ctc_ptp.c" "CMakeFiles/hdtptp.dir/ctc_ptp.c.o" "gcc" "CMakeFiles/hdtptp.dir/ctc_ptp.c.o.d"
+  "/root/repo/mpc.c" "CMakeFiles/hdtptp.dir/mpc.c.o" "gcc" "CMakeFiles/hdtptp.dir/mpc.c.o.d"
+  "/root/repo/resolve.c" "CMakeFiles/hdtptp.dir/resolve.c.o" "gcc" "CMakeFiles/hdtptp.dir/resolve.c.o.d"
+  "/root/repo/tuntap.c" "CMakeFiles/hdtptp.dir/tuntap.c.o" "gcc" "CMakeFiles/hdtptp.dir/tuntap.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
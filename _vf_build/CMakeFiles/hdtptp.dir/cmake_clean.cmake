@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdtptp.dir/ctc_ptp.c.o"
+  "CMakeFiles/hdtptp.dir/ctc_ptp.c.o.d"
+  "CMakeFiles/hdtptp.dir/mpc.c.o"
+  "CMakeFiles/hdtptp.dir/mpc.c.o.d"
+  "CMakeFiles/hdtptp.dir/resolve.c.o"
+  "CMakeFiles/hdtptp.dir/resolve.c.o.d"
+  "CMakeFiles/hdtptp.dir/tuntap.c.o"
+  "CMakeFiles/hdtptp.dir/tuntap.c.o.d"
+  "hdtptp.pdb"
+  "hdtptp.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdtptp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdtqeth.dir/mpc.c.o"
+  "CMakeFiles/hdtqeth.dir/mpc.c.o.d"
+  "CMakeFiles/hdtqeth.dir/qeth.c.o"
+  "CMakeFiles/hdtqeth.dir/qeth.c.o.d"
+  "CMakeFiles/hdtqeth.dir/resolve.c.o"
+  "CMakeFiles/hdtqeth.dir/resolve.c.o.d"
+  "CMakeFiles/hdtqeth.dir/tuntap.c.o"
+  "CMakeFiles/hdtqeth.dir/tuntap.c.o.d"
+  "hdtqeth.pdb"
+  "hdtqeth.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdtqeth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
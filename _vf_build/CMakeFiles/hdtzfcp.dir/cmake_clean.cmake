@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdtzfcp.dir/zfcp.c.o"
+  "CMakeFiles/hdtzfcp.dir/zfcp.c.o.d"
+  "hdtzfcp.pdb"
+  "hdtzfcp.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdtzfcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
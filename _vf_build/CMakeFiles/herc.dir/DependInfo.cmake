@@ -0,0 +1,100 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/archlvl.c" "CMakeFiles/herc.dir/archlvl.c.o" "gcc" "CMakeFiles/herc.dir/archlvl.c.o.d"
+  "/root/repo/assist.c" "CMakeFiles/herc.dir/assist.c.o" "gcc" "CMakeFiles/herc.dir/assist.c.o.d"
+  "/root/repo/bldcfg.c" "CMakeFiles/herc.dir/bldcfg.c.o" "gcc" "CMakeFiles/herc.dir/bldcfg.c.o.d"
+  "/root/repo/cgibin.c" "CMakeFiles/herc.dir/cgibin.c.o" "gcc" "CMakeFiles/herc.dir/cgibin.c.o.d"
+  "/root/repo/channel.c" "CMakeFiles/herc.dir/channel.c.o" "gcc" "CMakeFiles/herc.dir/channel.c.o.d"
+  "/root/repo/chsc.c" "CMakeFiles/herc.dir/chsc.c.o" "gcc" "CMakeFiles/herc.dir/chsc.c.o.d"
+  "/root/repo/clock.c" "CMakeFiles/herc.dir/clock.c.o" "gcc" "CMakeFiles/herc.dir/clock.c.o.d"
+  "/root/repo/cmdtab.c" "CMakeFiles/herc.dir/cmdtab.c.o" "gcc" "CMakeFiles/herc.dir/cmdtab.c.o.d"
+  "/root/repo/cmpsc_2012.c" "CMakeFiles/herc.dir/cmpsc_2012.c.o" "gcc" "CMakeFiles/herc.dir/cmpsc_2012.c.o.d"
+  "/root/repo/cmpscdbg.c" "CMakeFiles/herc.dir/cmpscdbg.c.o" "gcc" "CMakeFiles/herc.dir/cmpscdbg.c.o.d"
+  "/root/repo/cmpscdct.c" "CMakeFiles/herc.dir/cmpscdct.c.o" "gcc" "CMakeFiles/herc.dir/cmpscdct.c.o.d"
+  "/root/repo/cmpscget.c" "CMakeFiles/herc.dir/cmpscget.c.o" "gcc" "CMakeFiles/herc.dir/cmpscget.c.o.d"
+  "/root/repo/cmpscmem.c" "CMakeFiles/herc.dir/cmpscmem.c.o" "gcc" "CMakeFiles/herc.dir/cmpscmem.c.o.d"
+  "/root/repo/cmpscput.c" "CMakeFiles/herc.dir/cmpscput.c.o" "gcc" "CMakeFiles/herc.dir/cmpscput.c.o.d"
+  "/root/repo/config.c" "CMakeFiles/herc.dir/config.c.o" "gcc" "CMakeFiles/herc.dir/config.c.o.d"
+  "/root/repo/control.c" "CMakeFiles/herc.dir/control.c.o" "gcc" "CMakeFiles/herc.dir/control.c.o.d"
+  "/root/repo/cpu.c" "CMakeFiles/herc.dir/cpu.c.o" "gcc" "CMakeFiles/herc.dir/cpu.c.o.d"
+  "/root/repo/crypto.c" "CMakeFiles/herc.dir/crypto.c.o" "gcc" "CMakeFiles/herc.dir/crypto.c.o.d"
+  "/root/repo/dat.c" "CMakeFiles/herc.dir/dat.c.o" "gcc" "CMakeFiles/herc.dir/dat.c.o.d"
+  "/root/repo/decimal.c" "CMakeFiles/herc.dir/decimal.c.o" "gcc" "CMakeFiles/herc.dir/decimal.c.o.d"
+  "/root/repo/dfp.c" "CMakeFiles/herc.dir/dfp.c.o" "gcc" "CMakeFiles/herc.dir/dfp.c.o.d"
+  "/root/repo/diagmssf.c" "CMakeFiles/herc.dir/diagmssf.c.o" "gcc" "CMakeFiles/herc.dir/diagmssf.c.o.d"
+  "/root/repo/diagnose.c" "CMakeFiles/herc.dir/diagnose.c.o" "gcc" "CMakeFiles/herc.dir/diagnose.c.o.d"
+  "/root/repo/dyn76.c" "CMakeFiles/herc.dir/dyn76.c.o" "gcc" "CMakeFiles/herc.dir/dyn76.c.o.d"
+  "/root/repo/ecpsvm.c" "CMakeFiles/herc.dir/ecpsvm.c.o" "gcc" "CMakeFiles/herc.dir/ecpsvm.c.o.d"
+  "/root/repo/esame.c" "CMakeFiles/herc.dir/esame.c.o" "gcc" "CMakeFiles/herc.dir/esame.c.o.d"
+  "/root/repo/external.c" "CMakeFiles/herc.dir/external.c.o" "gcc" "CMakeFiles/herc.dir/external.c.o.d"
+  "/root/repo/fillfnam.c" "CMakeFiles/herc.dir/fillfnam.c.o" "gcc" "CMakeFiles/herc.dir/fillfnam.c.o.d"
+  "/root/repo/float.c" "CMakeFiles/herc.dir/float.c.o" "gcc" "CMakeFiles/herc.dir/float.c.o.d"
+  "/root/repo/general1.c" "CMakeFiles/herc.dir/general1.c.o" "gcc" "CMakeFiles/herc.dir/general1.c.o.d"
+  "/root/repo/general2.c" "CMakeFiles/herc.dir/general2.c.o" "gcc" "CMakeFiles/herc.dir/general2.c.o.d"
+  "/root/repo/general3.c" "CMakeFiles/herc.dir/general3.c.o" "gcc" "CMakeFiles/herc.dir/general3.c.o.d"
+  "/root/repo/hRexx.c" "CMakeFiles/herc.dir/hRexx.c.o" "gcc" "CMakeFiles/herc.dir/hRexx.c.o.d"
+  "/root/repo/hRexx_o.c" "CMakeFiles/herc.dir/hRexx_o.c.o" "gcc" "CMakeFiles/herc.dir/hRexx_o.c.o.d"
+  "/root/repo/hRexx_r.c" "CMakeFiles/herc.dir/hRexx_r.c.o" "gcc" "CMakeFiles/herc.dir/hRexx_r.c.o.d"
+  "/root/repo/hao.c" "CMakeFiles/herc.dir/hao.c.o" "gcc" "CMakeFiles/herc.dir/hao.c.o.d"
+  "/root/repo/hconsole.c" "CMakeFiles/herc.dir/hconsole.c.o" "gcc" "CMakeFiles/herc.dir/hconsole.c.o.d"
+  "/root/repo/hdiagf18.c" "CMakeFiles/herc.dir/hdiagf18.c.o" "gcc" "CMakeFiles/herc.dir/hdiagf18.c.o.d"
+  "/root/repo/history.c" "CMakeFiles/herc.dir/history.c.o" "gcc" "CMakeFiles/herc.dir/history.c.o.d"
+  "/root/repo/hsccmd.c" "CMakeFiles/herc.dir/hsccmd.c.o" "gcc" "CMakeFiles/herc.dir/hsccmd.c.o.d"
+  "/root/repo/hscemode.c" "CMakeFiles/herc.dir/hscemode.c.o" "gcc" "CMakeFiles/herc.dir/hscemode.c.o.d"
+  "/root/repo/hscloc.c" "CMakeFiles/herc.dir/hscloc.c.o" "gcc" "CMakeFiles/herc.dir/hscloc.c.o.d"
+  "/root/repo/hscmisc.c" "CMakeFiles/herc.dir/hscmisc.c.o" "gcc" "CMakeFiles/herc.dir/hscmisc.c.o.d"
+  "/root/repo/hscpufun.c" "CMakeFiles/herc.dir/hscpufun.c.o" "gcc" "CMakeFiles/herc.dir/hscpufun.c.o.d"
+  "/root/repo/httpserv.c" "CMakeFiles/herc.dir/httpserv.c.o" "gcc" "CMakeFiles/herc.dir/httpserv.c.o.d"
+  "/root/repo/ieee.c" "CMakeFiles/herc.dir/ieee.c.o" "gcc" "CMakeFiles/herc.dir/ieee.c.o.d"
+  "/root/repo/impl.c" "CMakeFiles/herc.dir/impl.c.o" "gcc" "CMakeFiles/herc.dir/impl.c.o.d"
+  "/root/repo/io.c" "CMakeFiles/herc.dir/io.c.o" "gcc" "CMakeFiles/herc.dir/io.c.o.d"
+  "/root/repo/ipl.c" "CMakeFiles/herc.dir/ipl.c.o" "gcc" "CMakeFiles/herc.dir/ipl.c.o.d"
+  "/root/repo/itrace.c" "CMakeFiles/herc.dir/itrace.c.o" "gcc" "CMakeFiles/herc.dir/itrace.c.o.d"
+  "/root/repo/loadmem.c" "CMakeFiles/herc.dir/loadmem.c.o" "gcc" "CMakeFiles/herc.dir/loadmem.c.o.d"
+  "/root/repo/loadparm.c" "CMakeFiles/herc.dir/loadparm.c.o" "gcc" "CMakeFiles/herc.dir/loadparm.c.o.d"
+  "/root/repo/losc.c" "CMakeFiles/herc.dir/losc.c.o" "gcc" "CMakeFiles/herc.dir/losc.c.o.d"
+  "/root/repo/machchk.c" "CMakeFiles/herc.dir/machchk.c.o" "gcc" "CMakeFiles/herc.dir/machchk.c.o.d"
+  "/root/repo/opcode.c" "CMakeFiles/herc.dir/opcode.c.o" "gcc" "CMakeFiles/herc.dir/opcode.c.o.d"
+  "/root/repo/panel.c" "CMakeFiles/herc.dir/panel.c.o" "gcc" "CMakeFiles/herc.dir/panel.c.o.d"
+  "/root/repo/pfpo.c" "CMakeFiles/herc.dir/pfpo.c.o" "gcc" "CMakeFiles/herc.dir/pfpo.c.o.d"
+  "/root/repo/plo.c" "CMakeFiles/herc.dir/plo.c.o" "gcc" "CMakeFiles/herc.dir/plo.c.o.d"
+  "/root/repo/prof.c" "CMakeFiles/herc.dir/prof.c.o" "gcc" "CMakeFiles/herc.dir/prof.c.o.d"
+  "/root/repo/qdio.c" "CMakeFiles/herc.dir/qdio.c.o" "gcc" "CMakeFiles/herc.dir/qdio.c.o.d"
+  "/root/repo/scedasd.c" "CMakeFiles/herc.dir/scedasd.c.o" "gcc" "CMakeFiles/herc.dir/scedasd.c.o.d"
+  "/root/repo/scescsi.c" "CMakeFiles/herc.dir/scescsi.c.o" "gcc" "CMakeFiles/herc.dir/scescsi.c.o.d"
+  "/root/repo/script.c" "CMakeFiles/herc.dir/script.c.o" "gcc" "CMakeFiles/herc.dir/script.c.o.d"
+  "/root/repo/service.c" "CMakeFiles/herc.dir/service.c.o" "gcc" "CMakeFiles/herc.dir/service.c.o.d"
+  "/root/repo/sie.c" "CMakeFiles/herc.dir/sie.c.o" "gcc" "CMakeFiles/herc.dir/sie.c.o.d"
+  "/root/repo/sr.c" "CMakeFiles/herc.dir/sr.c.o" "gcc" "CMakeFiles/herc.dir/sr.c.o.d"
+  "/root/repo/stack.c" "CMakeFiles/herc.dir/stack.c.o" "gcc" "CMakeFiles/herc.dir/stack.c.o.d"
+  "/root/repo/strsignal.c" "CMakeFiles/herc.dir/strsignal.c.o" "gcc" "CMakeFiles/herc.dir/strsignal.c.o.d"
+  "/root/repo/timer.c" "CMakeFiles/herc.dir/timer.c.o" "gcc" "CMakeFiles/herc.dir/timer.c.o.d"
+  "/root/repo/trace.c" "CMakeFiles/herc.dir/trace.c.o" "gcc" "CMakeFiles/herc.dir/trace.c.o.d"
+  "/root/repo/transact.c" "CMakeFiles/herc.dir/transact.c.o" "gcc" "CMakeFiles/herc.dir/transact.c.o.d"
+  "/root/repo/vector.c" "CMakeFiles/herc.dir/vector.c.o" "gcc" "CMakeFiles/herc.dir/vector.c.o.d"
+  "/root/repo/vm.c" "CMakeFiles/herc.dir/vm.c.o" "gcc" "CMakeFiles/herc.dir/vm.c.o.d"
+  "/root/repo/vmd250.c" "CMakeFiles/herc.dir/vmd250.c.o" "gcc" "CMakeFiles/herc.dir/vmd250.c.o.d"
+  "/root/repo/vstore.c" "CMakeFiles/herc.dir/vstore.c.o" "gcc" "CMakeFiles/herc.dir/vstore.c.o.d"
+  "/root/repo/xstore.c" "CMakeFiles/herc.dir/xstore.c.o" "gcc" "CMakeFiles/herc.dir/xstore.c.o.d"
+  "/root/repo/zvector.c" "CMakeFiles/herc.dir/zvector.c.o" "gcc" "CMakeFiles/herc.dir/zvector.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercd.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/herct.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/decNumber/CMakeFiles/decNumber.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,163 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/herc.dir/archlvl.c.o"
+  "CMakeFiles/herc.dir/archlvl.c.o.d"
+  "CMakeFiles/herc.dir/assist.c.o"
+  "CMakeFiles/herc.dir/assist.c.o.d"
+  "CMakeFiles/herc.dir/bldcfg.c.o"
+  "CMakeFiles/herc.dir/bldcfg.c.o.d"
+  "CMakeFiles/herc.dir/cgibin.c.o"
+  "CMakeFiles/herc.dir/cgibin.c.o.d"
+  "CMakeFiles/herc.dir/channel.c.o"
+  "CMakeFiles/herc.dir/channel.c.o.d"
+  "CMakeFiles/herc.dir/chsc.c.o"
+  "CMakeFiles/herc.dir/chsc.c.o.d"
+  "CMakeFiles/herc.dir/clock.c.o"
+  "CMakeFiles/herc.dir/clock.c.o.d"
+  "CMakeFiles/herc.dir/cmdtab.c.o"
+  "CMakeFiles/herc.dir/cmdtab.c.o.d"
+  "CMakeFiles/herc.dir/cmpsc_2012.c.o"
+  "CMakeFiles/herc.dir/cmpsc_2012.c.o.d"
+  "CMakeFiles/herc.dir/cmpscdbg.c.o"
+  "CMakeFiles/herc.dir/cmpscdbg.c.o.d"
+  "CMakeFiles/herc.dir/cmpscdct.c.o"
+  "CMakeFiles/herc.dir/cmpscdct.c.o.d"
+  "CMakeFiles/herc.dir/cmpscget.c.o"
+  "CMakeFiles/herc.dir/cmpscget.c.o.d"
+  "CMakeFiles/herc.dir/cmpscmem.c.o"
+  "CMakeFiles/herc.dir/cmpscmem.c.o.d"
+  "CMakeFiles/herc.dir/cmpscput.c.o"
+  "CMakeFiles/herc.dir/cmpscput.c.o.d"
+  "CMakeFiles/herc.dir/config.c.o"
+  "CMakeFiles/herc.dir/config.c.o.d"
+  "CMakeFiles/herc.dir/control.c.o"
+  "CMakeFiles/herc.dir/control.c.o.d"
+  "CMakeFiles/herc.dir/cpu.c.o"
+  "CMakeFiles/herc.dir/cpu.c.o.d"
+  "CMakeFiles/herc.dir/crypto.c.o"
+  "CMakeFiles/herc.dir/crypto.c.o.d"
+  "CMakeFiles/herc.dir/dat.c.o"
+  "CMakeFiles/herc.dir/dat.c.o.d"
+  "CMakeFiles/herc.dir/decimal.c.o"
+  "CMakeFiles/herc.dir/decimal.c.o.d"
+  "CMakeFiles/herc.dir/dfp.c.o"
+  "CMakeFiles/herc.dir/dfp.c.o.d"
+  "CMakeFiles/herc.dir/diagmssf.c.o"
+  "CMakeFiles/herc.dir/diagmssf.c.o.d"
+  "CMakeFiles/herc.dir/diagnose.c.o"
+  "CMakeFiles/herc.dir/diagnose.c.o.d"
+  "CMakeFiles/herc.dir/dyn76.c.o"
+  "CMakeFiles/herc.dir/dyn76.c.o.d"
+  "CMakeFiles/herc.dir/ecpsvm.c.o"
+  "CMakeFiles/herc.dir/ecpsvm.c.o.d"
+  "CMakeFiles/herc.dir/esame.c.o"
+  "CMakeFiles/herc.dir/esame.c.o.d"
+  "CMakeFiles/herc.dir/external.c.o"
+  "CMakeFiles/herc.dir/external.c.o.d"
+  "CMakeFiles/herc.dir/fillfnam.c.o"
+  "CMakeFiles/herc.dir/fillfnam.c.o.d"
+  "CMakeFiles/herc.dir/float.c.o"
+  "CMakeFiles/herc.dir/float.c.o.d"
+  "CMakeFiles/herc.dir/general1.c.o"
+  "CMakeFiles/herc.dir/general1.c.o.d"
+  "CMakeFiles/herc.dir/general2.c.o"
+  "CMakeFiles/herc.dir/general2.c.o.d"
+  "CMakeFiles/herc.dir/general3.c.o"
+  "CMakeFiles/herc.dir/general3.c.o.d"
+  "CMakeFiles/herc.dir/hRexx.c.o"
+  "CMakeFiles/herc.dir/hRexx.c.o.d"
+  "CMakeFiles/herc.dir/hRexx_o.c.o"
+  "CMakeFiles/herc.dir/hRexx_o.c.o.d"
+  "CMakeFiles/herc.dir/hRexx_r.c.o"
+  "CMakeFiles/herc.dir/hRexx_r.c.o.d"
+  "CMakeFiles/herc.dir/hao.c.o"
+  "CMakeFiles/herc.dir/hao.c.o.d"
+  "CMakeFiles/herc.dir/hconsole.c.o"
+  "CMakeFiles/herc.dir/hconsole.c.o.d"
+  "CMakeFiles/herc.dir/hdiagf18.c.o"
+  "CMakeFiles/herc.dir/hdiagf18.c.o.d"
+  "CMakeFiles/herc.dir/history.c.o"
+  "CMakeFiles/herc.dir/history.c.o.d"
+  "CMakeFiles/herc.dir/hsccmd.c.o"
+  "CMakeFiles/herc.dir/hsccmd.c.o.d"
+  "CMakeFiles/herc.dir/hscemode.c.o"
+  "CMakeFiles/herc.dir/hscemode.c.o.d"
+  "CMakeFiles/herc.dir/hscloc.c.o"
+  "CMakeFiles/herc.dir/hscloc.c.o.d"
+  "CMakeFiles/herc.dir/hscmisc.c.o"
+  "CMakeFiles/herc.dir/hscmisc.c.o.d"
+  "CMakeFiles/herc.dir/hscpufun.c.o"
+  "CMakeFiles/herc.dir/hscpufun.c.o.d"
+  "CMakeFiles/herc.dir/httpserv.c.o"
+  "CMakeFiles/herc.dir/httpserv.c.o.d"
+  "CMakeFiles/herc.dir/ieee.c.o"
+  "CMakeFiles/herc.dir/ieee.c.o.d"
+  "CMakeFiles/herc.dir/impl.c.o"
+  "CMakeFiles/herc.dir/impl.c.o.d"
+  "CMakeFiles/herc.dir/io.c.o"
+  "CMakeFiles/herc.dir/io.c.o.d"
+  "CMakeFiles/herc.dir/ipl.c.o"
+  "CMakeFiles/herc.dir/ipl.c.o.d"
+  "CMakeFiles/herc.dir/itrace.c.o"
+  "CMakeFiles/herc.dir/itrace.c.o.d"
+  "CMakeFiles/herc.dir/loadmem.c.o"
+  "CMakeFiles/herc.dir/loadmem.c.o.d"
+  "CMakeFiles/herc.dir/loadparm.c.o"
+  "CMakeFiles/herc.dir/loadparm.c.o.d"
+  "CMakeFiles/herc.dir/losc.c.o"
+  "CMakeFiles/herc.dir/losc.c.o.d"
+  "CMakeFiles/herc.dir/machchk.c.o"
+  "CMakeFiles/herc.dir/machchk.c.o.d"
+  "CMakeFiles/herc.dir/opcode.c.o"
+  "CMakeFiles/herc.dir/opcode.c.o.d"
+  "CMakeFiles/herc.dir/panel.c.o"
+  "CMakeFiles/herc.dir/panel.c.o.d"
+  "CMakeFiles/herc.dir/pfpo.c.o"
+  "CMakeFiles/herc.dir/pfpo.c.o.d"
+  "CMakeFiles/herc.dir/plo.c.o"
+  "CMakeFiles/herc.dir/plo.c.o.d"
+  "CMakeFiles/herc.dir/prof.c.o"
+  "CMakeFiles/herc.dir/prof.c.o.d"
+  "CMakeFiles/herc.dir/qdio.c.o"
+  "CMakeFiles/herc.dir/qdio.c.o.d"
+  "CMakeFiles/herc.dir/scedasd.c.o"
+  "CMakeFiles/herc.dir/scedasd.c.o.d"
+  "CMakeFiles/herc.dir/scescsi.c.o"
+  "CMakeFiles/herc.dir/scescsi.c.o.d"
+  "CMakeFiles/herc.dir/script.c.o"
+  "CMakeFiles/herc.dir/script.c.o.d"
+  "CMakeFiles/herc.dir/service.c.o"
+  "CMakeFiles/herc.dir/service.c.o.d"
+  "CMakeFiles/herc.dir/sie.c.o"
+  "CMakeFiles/herc.dir/sie.c.o.d"
+  "CMakeFiles/herc.dir/sr.c.o"
+  "CMakeFiles/herc.dir/sr.c.o.d"
+  "CMakeFiles/herc.dir/stack.c.o"
+  "CMakeFiles/herc.dir/stack.c.o.d"
+  "CMakeFiles/herc.dir/strsignal.c.o"
+  "CMakeFiles/herc.dir/strsignal.c.o.d"
+  "CMakeFiles/herc.dir/timer.c.o"
+  "CMakeFiles/herc.dir/timer.c.o.d"
+  "CMakeFiles/herc.dir/trace.c.o"
+  "CMakeFiles/herc.dir/trace.c.o.d"
+  "CMakeFiles/herc.dir/transact.c.o"
+  "CMakeFiles/herc.dir/transact.c.o.d"
+  "CMakeFiles/herc.dir/vector.c.o"
+  "CMakeFiles/herc.dir/vector.c.o.d"
+  "CMakeFiles/herc.dir/vm.c.o"
+  "CMakeFiles/herc.dir/vm.c.o.d"
+  "CMakeFiles/herc.dir/vmd250.c.o"
+  "CMakeFiles/herc.dir/vmd250.c.o.d"
+  "CMakeFiles/herc.dir/vstore.c.o"
+  "CMakeFiles/herc.dir/vstore.c.o.d"
+  "CMakeFiles/herc.dir/xstore.c.o"
+  "CMakeFiles/herc.dir/xstore.c.o.d"
+  "CMakeFiles/herc.dir/zvector.c.o"
+  "CMakeFiles/herc.dir/zvector.c.o.d"
+  "libherc.pdb"
+  "libherc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/herc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
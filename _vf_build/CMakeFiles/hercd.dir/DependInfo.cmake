@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cache.c" "CMakeFiles/hercd.dir/cache.c.o" "gcc" "CMakeFiles/hercd.dir/cache.c.o.d"
+  "/root/repo/cckddasd.c" "CMakeFiles/hercd.dir/cckddasd.c.o" "gcc" "CMakeFiles/hercd.dir/cckddasd.c.o.d"
+  "/root/repo/cckdutil.c" "CMakeFiles/hercd.dir/cckdutil.c.o" "gcc" "CMakeFiles/hercd.dir/cckdutil.c.o.d"
+  "/root/repo/ckddasd.c" "CMakeFiles/hercd.dir/ckddasd.c.o" "gcc" "CMakeFiles/hercd.dir/ckddasd.c.o.d"
+  "/root/repo/dasdtab.c" "CMakeFiles/hercd.dir/dasdtab.c.o" "gcc" "CMakeFiles/hercd.dir/dasdtab.c.o.d"
+  "/root/repo/dasdutil.c" "CMakeFiles/hercd.dir/dasdutil.c.o" "gcc" "CMakeFiles/hercd.dir/dasdutil.c.o.d"
+  "/root/repo/fbadasd.c" "CMakeFiles/hercd.dir/fbadasd.c.o" "gcc" "CMakeFiles/hercd.dir/fbadasd.c.o.d"
+  "/root/repo/shared.c" "CMakeFiles/hercd.dir/shared.c.o" "gcc" "CMakeFiles/hercd.dir/shared.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
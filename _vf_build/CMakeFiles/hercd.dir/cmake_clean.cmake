@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hercd.dir/cache.c.o"
+  "CMakeFiles/hercd.dir/cache.c.o.d"
+  "CMakeFiles/hercd.dir/cckddasd.c.o"
+  "CMakeFiles/hercd.dir/cckddasd.c.o.d"
+  "CMakeFiles/hercd.dir/cckdutil.c.o"
+  "CMakeFiles/hercd.dir/cckdutil.c.o.d"
+  "CMakeFiles/hercd.dir/ckddasd.c.o"
+  "CMakeFiles/hercd.dir/ckddasd.c.o.d"
+  "CMakeFiles/hercd.dir/dasdtab.c.o"
+  "CMakeFiles/hercd.dir/dasdtab.c.o.d"
+  "CMakeFiles/hercd.dir/dasdutil.c.o"
+  "CMakeFiles/hercd.dir/dasdutil.c.o.d"
+  "CMakeFiles/hercd.dir/fbadasd.c.o"
+  "CMakeFiles/hercd.dir/fbadasd.c.o.d"
+  "CMakeFiles/hercd.dir/shared.c.o"
+  "CMakeFiles/hercd.dir/shared.c.o.d"
+  "libhercd.pdb"
+  "libhercd.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hercd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hercifc.dir/hercifc.c.o"
+  "CMakeFiles/hercifc.dir/hercifc.c.o.d"
+  "hercifc"
+  "hercifc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hercifc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
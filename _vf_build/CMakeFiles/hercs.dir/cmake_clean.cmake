@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hercs.dir/hsys.c.o"
+  "CMakeFiles/hercs.dir/hsys.c.o.d"
+  "libhercs.pdb"
+  "libhercs.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hercs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ftlib.c" "CMakeFiles/herct.dir/ftlib.c.o" "gcc" "CMakeFiles/herct.dir/ftlib.c.o.d"
+  "/root/repo/hetlib.c" "CMakeFiles/herct.dir/hetlib.c.o" "gcc" "CMakeFiles/herct.dir/hetlib.c.o.d"
+  "/root/repo/sllib.c" "CMakeFiles/herct.dir/sllib.c.o" "gcc" "CMakeFiles/herct.dir/sllib.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercu.dir/DependInfo.cmake"
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/herct.dir/ftlib.c.o"
+  "CMakeFiles/herct.dir/ftlib.c.o.d"
+  "CMakeFiles/herct.dir/hetlib.c.o"
+  "CMakeFiles/herct.dir/hetlib.c.o.d"
+  "CMakeFiles/herct.dir/sllib.c.o"
+  "CMakeFiles/herct.dir/sllib.c.o.d"
+  "libherct.pdb"
+  "libherct.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/herct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/herctest.dir/herctest.c.o"
+  "CMakeFiles/herctest.dir/herctest.c.o.d"
+  "herctest"
+  "herctest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/herctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
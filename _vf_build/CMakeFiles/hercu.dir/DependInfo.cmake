@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/codepage.c" "CMakeFiles/hercu.dir/codepage.c.o" "gcc" "CMakeFiles/hercu.dir/codepage.c.o.d"
+  "/root/repo/hdl.c" "CMakeFiles/hercu.dir/hdl.c.o" "gcc" "CMakeFiles/hercu.dir/hdl.c.o.d"
+  "/root/repo/hexdumpe.c" "CMakeFiles/hercu.dir/hexdumpe.c.o" "gcc" "CMakeFiles/hercu.dir/hexdumpe.c.o.d"
+  "/root/repo/hostinfo.c" "CMakeFiles/hercu.dir/hostinfo.c.o" "gcc" "CMakeFiles/hercu.dir/hostinfo.c.o.d"
+  "/root/repo/hscutl.c" "CMakeFiles/hercu.dir/hscutl.c.o" "gcc" "CMakeFiles/hercu.dir/hscutl.c.o.d"
+  "/root/repo/hscutl2.c" "CMakeFiles/hercu.dir/hscutl2.c.o" "gcc" "CMakeFiles/hercu.dir/hscutl2.c.o.d"
+  "/root/repo/hsocket.c" "CMakeFiles/hercu.dir/hsocket.c.o" "gcc" "CMakeFiles/hercu.dir/hsocket.c.o.d"
+  "/root/repo/hthreads.c" "CMakeFiles/hercu.dir/hthreads.c.o" "gcc" "CMakeFiles/hercu.dir/hthreads.c.o.d"
+  "/root/repo/logger.c" "CMakeFiles/hercu.dir/logger.c.o" "gcc" "CMakeFiles/hercu.dir/logger.c.o.d"
+  "/root/repo/logmsg.c" "CMakeFiles/hercu.dir/logmsg.c.o" "gcc" "CMakeFiles/hercu.dir/logmsg.c.o.d"
+  "/root/repo/memrchr.c" "CMakeFiles/hercu.dir/memrchr.c.o" "gcc" "CMakeFiles/hercu.dir/memrchr.c.o.d"
+  "/root/repo/parser.c" "CMakeFiles/hercu.dir/parser.c.o" "gcc" "CMakeFiles/hercu.dir/parser.c.o.d"
+  "/root/repo/pttrace.c" "CMakeFiles/hercu.dir/pttrace.c.o" "gcc" "CMakeFiles/hercu.dir/pttrace.c.o.d"
+  "/root/repo/version.c" "CMakeFiles/hercu.dir/version.c.o" "gcc" "CMakeFiles/hercu.dir/version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_vf_build/CMakeFiles/hercs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
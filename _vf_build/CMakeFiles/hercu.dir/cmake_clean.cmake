@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hercu.dir/codepage.c.o"
+  "CMakeFiles/hercu.dir/codepage.c.o.d"
+  "CMakeFiles/hercu.dir/hdl.c.o"
+  "CMakeFiles/hercu.dir/hdl.c.o.d"
+  "CMakeFiles/hercu.dir/hexdumpe.c.o"
+  "CMakeFiles/hercu.dir/hexdumpe.c.o.d"
+  "CMakeFiles/hercu.dir/hostinfo.c.o"
+  "CMakeFiles/hercu.dir/hostinfo.c.o.d"
+  "CMakeFiles/hercu.dir/hscutl.c.o"
+  "CMakeFiles/hercu.dir/hscutl.c.o.d"
+  "CMakeFiles/hercu.dir/hscutl2.c.o"
+  "CMakeFiles/hercu.dir/hscutl2.c.o.d"
+  "CMakeFiles/hercu.dir/hsocket.c.o"
+  "CMakeFiles/hercu.dir/hsocket.c.o.d"
+  "CMakeFiles/hercu.dir/hthreads.c.o"
+  "CMakeFiles/hercu.dir/hthreads.c.o.d"
+  "CMakeFiles/hercu.dir/logger.c.o"
+  "CMakeFiles/hercu.dir/logger.c.o.d"
+  "CMakeFiles/hercu.dir/logmsg.c.o"
+  "CMakeFiles/hercu.dir/logmsg.c.o.d"
+  "CMakeFiles/hercu.dir/memrchr.c.o"
+  "CMakeFiles/hercu.dir/memrchr.c.o.d"
+  "CMakeFiles/hercu.dir/parser.c.o"
+  "CMakeFiles/hercu.dir/parser.c.o.d"
+  "CMakeFiles/hercu.dir/pttrace.c.o"
+  "CMakeFiles/hercu.dir/pttrace.c.o.d"
+  "CMakeFiles/hercu.dir/version.c.o"
+  "CMakeFiles/hercu.dir/version.c.o.d"
+  "libhercu.pdb"
+  "libhercu.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hercu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
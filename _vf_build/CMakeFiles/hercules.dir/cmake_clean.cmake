@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hercules.dir/bootstrap.c.o"
+  "CMakeFiles/hercules.dir/bootstrap.c.o.d"
+  "CMakeFiles/hercules.dir/hdlmain.c.o"
+  "CMakeFiles/hercules.dir/hdlmain.c.o.d"
+  "hercules"
+  "hercules.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hercules.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hetget.dir/hetget.c.o"
+  "CMakeFiles/hetget.dir/hetget.c.o.d"
+  "hetget"
+  "hetget.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hetget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
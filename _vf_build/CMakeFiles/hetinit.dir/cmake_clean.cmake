@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hetinit.dir/hetinit.c.o"
+  "CMakeFiles/hetinit.dir/hetinit.c.o.d"
+  "hetinit"
+  "hetinit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hetinit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hetmap.dir/hetmap.c.o"
+  "CMakeFiles/hetmap.dir/hetmap.c.o.d"
+  "hetmap"
+  "hetmap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hetmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
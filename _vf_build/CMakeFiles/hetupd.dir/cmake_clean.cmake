@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hetupd.dir/hetupd.c.o"
+  "CMakeFiles/hetupd.dir/hetupd.c.o.d"
+  "hetupd"
+  "hetupd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hetupd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/html"
+  "CMakeFiles/html-complete"
+  "html-prefix/src/html-stamp/html-build"
+  "html-prefix/src/html-stamp/html-configure"
+  "html-prefix/src/html-stamp/html-download"
+  "html-prefix/src/html-stamp/html-install"
+  "html-prefix/src/html-stamp/html-mkdir"
+  "html-prefix/src/html-stamp/html-patch"
+  "html-prefix/src/html-stamp/html-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/html.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pttfmt.dir/pttfmt.c.o"
+  "CMakeFiles/pttfmt.dir/pttfmt.c.o.d"
+  "pttfmt"
+  "pttfmt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pttfmt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/s37x.dir/s37x.c.o"
+  "CMakeFiles/s37x.dir/s37x.c.o.d"
+  "CMakeFiles/s37x.dir/s37xmod.c.o"
+  "CMakeFiles/s37x.dir/s37xmod.c.o.d"
+  "s37x.pdb"
+  "s37x.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/s37x.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
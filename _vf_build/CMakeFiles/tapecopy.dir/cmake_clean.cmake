@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tapecopy.dir/scsiutil.c.o"
+  "CMakeFiles/tapecopy.dir/scsiutil.c.o.d"
+  "CMakeFiles/tapecopy.dir/tapecopy.c.o"
+  "CMakeFiles/tapecopy.dir/tapecopy.c.o.d"
+  "tapecopy"
+  "tapecopy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tapecopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
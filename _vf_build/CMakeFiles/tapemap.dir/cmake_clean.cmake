@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tapemap.dir/tapemap.c.o"
+  "CMakeFiles/tapemap.dir/tapemap.c.o.d"
+  "tapemap"
+  "tapemap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tapemap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
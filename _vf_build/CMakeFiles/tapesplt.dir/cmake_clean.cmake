@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tapesplt.dir/tapesplt.c.o"
+  "CMakeFiles/tapesplt.dir/tapesplt.c.o.d"
+  "tapesplt"
+  "tapesplt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tapesplt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tracedump.dir/tracedump.c.o"
+  "CMakeFiles/tracedump.dir/tracedump.c.o.d"
+  "tracedump"
+  "tracedump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tracedump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vmfplc2.dir/vmfplc2.c.o"
+  "CMakeFiles/vmfplc2.dir/vmfplc2.c.o.d"
+  "vmfplc2"
+  "vmfplc2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/vmfplc2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
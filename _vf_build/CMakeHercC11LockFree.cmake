@@ -0,0 +1,10 @@
+set( C11_ATOMIC_BOOL_LOCK_FREE 2 )
+set( C11_ATOMIC_CHAR_LOCK_FREE 2 )
+set( C11_ATOMIC_CHAR16_T_LOCK_FREE 2 )
+set( C11_ATOMIC_CHAR32_T_LOCK_FREE 2 )
+set( C11_ATOMIC_WCHAR_T_LOCK_FREE 2 )
+set( C11_ATOMIC_SHORT_LOCK_FREE 2 )
+set( C11_ATOMIC_INT_LOCK_FREE 2 )
+set( C11_ATOMIC_LONG_LOCK_FREE 2 )
+set( C11_ATOMIC_LLONG_LOCK_FREE 2 )
+set( C11_ATOMIC_POINTER_LOCK_FREE 2 )
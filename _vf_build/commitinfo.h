@@ -0,0 +1,7 @@
+/* Created by Herc01_GitVer.cmake based on the last commit on 2026-10-18 15:53:46 +0000 by agent    */
+#define COMMIT_COUNT      51
+#define COMMIT_MESSAGE    "[user-048] fix: add automatic operator prefilter tests"
+#define COMMIT_BRANCH     "master"
+#define COMMIT_HASH       "d520c27"
+#define COMMIT_UNTRACKED  "  2 untracked files."
+#define COMMIT_MODIFIED   "  13 added/modified/deleted files."
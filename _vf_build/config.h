@@ -0,0 +1,689 @@
+/*
+   CMakeConfig.h.in, used to generate config.h to build Hercules
+
+   Copyright 2017 by Stephen Orso.
+
+   Distributed under the Boost Software License, Version 1.0.
+   See accompanying file BOOST_LICENSE_1_0.txt or copy at
+   http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+
+/*  ********************* Summary of CMake Build  *********************
+
+------------------------------------------------------------------------
+CMake run timestamp   Date: 2026-10-18 Time: 15:54:29 UTC
+Install prefix        /usr/local
+Source directory      /root/repo
+Build directory       /root/repo/_vf_build
+Executable directory  bin
+Shared library dir    lib
+Loadable module dir   ../lib
+..from build dir      .
+Data Directory (http) /usr/local/share/Hercules
+Build command line:   /usr/bin/gmake
+C Compiler version:   GNU 12.2.0
+C compiler options:    -DHAVE_CONFIG_H -g3 -ggdb3
+Link libraries:       m;dl
+------------------------------------------------------------------------
+
+*/
+
+/*
+   *********************************************************************
+                    Basic Project and Option Definitions
+   *********************************************************************
+*/
+
+/*
+   MODRELDIRBLD is the default location to be searched for loadable
+   modules if search fails when using the target system's default search
+   process (RPATH for UNIX-like, fixed search order for Windows) when
+   Hercules run from the build tree.  MODRELDIRINS is the default when
+   Hercules is run from an install tree.
+*/
+
+#define MODRELDIRBLD        "."
+#define MODRELDIRINS        "../lib"
+
+/*
+   HTTP_ROOT_INS is the default root directory relative to the Hercules
+   executable of HTML content served by the Hercules embedded web server
+   when Hercules is run from the install directory.  HTTP_ROOT_INS is
+   used when Hercules is run from the build directory.  If neither
+   directory exists, the executable directory is used as the default.
+*/
+
+#define  PKGDATADIR         "/usr/local/share/Hercules"
+
+
+/* DO NOT DEFINE MODULESDIR!  hdl.c can find loadable modules using   */
+/* the host system's library/module search process.                   */
+
+/* #undef MODULESDIR                                                  */
+
+
+/*
+   Project information...
+
+   Hercules version.c presumes that HOST_ARCH is unquoted for Windows
+   builds and quoted otherwise.  This should really be a fixup in
+   version.c, but we shall wait for the retirement of the current
+   Windows build.
+*/
+
+#define  HOST_ARCH           "x86_64"
+#define  VERS_MAJ            4
+#define  VERS_INT            0
+#define  VERS_MIN            0
+#define  VERS_BLD            0
+#define  VERSION             "4.0.0"
+
+/* #undef WINDOWS_BUILD */
+
+
+/*
+   User options specified on the command line or via cmake-gui or ccmake.
+*/
+
+#define  CCKD_BZIP2          1
+/* #undef CUSTOM_BUILD_STRING */
+/* #undef DISABLE_IAF2 */
+#define  ENABLE_IPV6         1
+/* #undef ENABLE_REGINA_REXX */
+/* #undef ENABLE_OBJECT_REXX */
+#define  EXTERNALGUI         1
+#define  HET_BZIP2           1
+/* #undef MAX_CPU_ENGINES */
+/* #undef NEED_GETOPT_WRAPPER */
+/* #undef OPTION_CAPABILITIES */
+/* #undef OPTION_FTHREADS */
+#define  OPTION_HAO          1
+#define  OPTION_SYNCIO       1
+/* #undef OPTION_NOSYNCIO */
+
+/*
+   Debug is special because of a name collision between the user option
+   macro and the Hercules preprocessor macro.
+*/
+
+/* #undef DEBUG_BUILD */
+#ifdef DEBUG_BUILD
+#   define DEBUG 1
+#endif
+
+/*
+   HQA_DIR is special because it never finds its way into config.h.
+   Rather, it triggers a test for HAVE_HQA_H, which is used by the build.
+*/
+
+#define  HAVE_HQA_H          1
+
+
+
+
+/*
+   Macros for large file support (LFS).  These are only required for
+   32-bit systems that require enabling macros for LFS.  64-bit systems
+   include LFS without needing enabling macros.
+   _FILE_OFF_SET_BITS is used on 32-bit open source systems with
+   enableable large file support (GNU/Linux and Solaris), while
+   _LARGE_FILES is used on 32-bit AIX systems.
+
+   It is less clear that the Mac OS 10.5 64-bit inode is a requirement
+   just for 32-bit systems, as that defines a file system matter, not
+   the bit-width of a file offset.
+
+   Hercules uses DISABLE_LARGEFILE to avoid use of any available
+   transitional LFS if LARGEFILE=NO included, and HAVE_FSEEKO to use
+   fseeko()/ftello() instead of the non-"o" counterparts.
+
+   Hercules does not use the othre three macros.  Rather, these macros
+   control the expansion of target system headers when LFS is enabled.
+*/
+
+/* #undef _FILE_OFFSET_BITS */
+/* #undef _LARGE_FILES */
+/* #undef _DARWIN_USE_64_BIT_INODE */
+#define  HAVE_FSEEKO         1
+/* #undef DISABLE_LARGEFILE */
+
+
+/*
+   Options that may be specified on the command line only.  These are
+   not listed in CMake-gui or in ccmake.
+*/
+
+/* #undef NO_ASM_BYTESWAP */
+/* #undef NO_IEEE_SUPPORT */
+
+
+/*
+   Indicate whether hercifc should be built.  In addition to the
+   generator implications of building hercifc, there is preprocessor
+   code in hercifc that suppressses code if the following is not
+   defined.  Belt and braces I suppose.  And there is one Linux header
+   needed to build hercifc...on BSD-based systems the required header
+   net/if.h is sufficent.
+*/
+
+#define  BUILD_HERCIFC       1
+#define  HAVE_LINUX_IF_TUN_H 1
+
+
+/*
+   Sundry target hardware characteristics.
+*/
+
+/* #undef WORDS_BIGENDIAN */
+#define  SIZEOF_INT          4
+#define  SIZEOF_LONG         8
+#define  SIZEOF_SIZE_T       8
+#define  SIZEOF_INT_P        8
+#define  SIZEOF_OFF_T        8
+
+
+/*
+   Not a hardware characteristic, but it is the only other sizeof needed
+   to build Hercules.  And this is as good a place as any.
+*/
+
+#define  SIZEOF_PTHREAD_T      8
+
+
+/*
+   Do not turn on libtool.  Configure.ac always used libtool.  This
+   CMake-generated build never uses libtool, and it always builds shared
+   libraries and dynamically loaded modules.  Set the target-specific
+   suffix to be used for shared libraries.
+*/
+
+#define  HDL_BUILD_SHARED 1
+#define  LTDL_SHLIB_EXT ".so"
+#define  OPTION_DYNAMIC_LOAD 1
+
+
+
+/*
+   *********************************************************************
+                    #defines for Required Headers
+   *********************************************************************
+*/
+
+/*
+   The following header macros are not used by Hercules.  Hercules needs
+   the headers but does not guard the includes (nor should it).  The
+   build scripts check for these headers.  If any are missing, error
+   messages are issued and the build is terminated.
+*/
+
+// #define    HAVE_CTYPE_H        1
+// #define    HAVE_ERRNO_H        1
+// #define    HAVE_FCNTL_H        1
+// #define    HAVE_LIMITS_H       1
+// #define    HAVE_MATH_H         1
+// #define    HAVE_SETJMP_H       1
+// #define    HAVE_SCHED_H        1
+// #define    HAVE_STDARG_H       1
+// #define    HAVE_STDIO_H        1
+// #define    HAVE_STDLIB_H       1
+// #define    HAVE_STRING_H       1
+// #define    HAVE_SYS_STAT_H     1
+// #define    HAVE_SYS_TIME_H     1
+// #define    HAVE_SYS_TYPES_H    1
+// #define    HAVE_SYS_MMAN_H     1
+
+
+/*
+   HAVE_TIME_H is required for inclusion of sys/time.h by hstdinc.h.
+   There is no alternative to sys/time.h, and there is no need for
+   conditional inclusion.  The build will be terminated if it is
+   not present.  The same applies to sys/sysctl.h.
+*/
+
+#define  HAVE_DIRENT_H       1
+#define  HAVE_PWD_H          1
+#define  HAVE_SIGNAL_H       1
+/* #undef HAVE_SYS_SYSCTL_H */
+#define  HAVE_SYS_RESOURCE_H 1
+#define  HAVE_SYS_UTSNAME_H  1
+#define  HAVE_SYS_WAIT_H     1
+#define  HAVE_TIME_H         1
+
+
+/*
+   Enable inclusion of sys/sockio.h on Solaris systems.  BSD systems
+   include sys/sockio.h in ioctl.h.  sys/sockio.h has a guard, so
+   we need not be selective about Solaris with this macro.
+*/
+
+/* #undef HAVE_SYS_SOCKIO_H */
+
+
+/*
+   One of the following integer type headers must be defined.  hstdint.h
+   uses these variables to include the best one that is present.
+*/
+
+#define  HAVE_STDINT_H       1
+#define  HAVE_INTTYPES_H     1
+#define  HAVE_UNISTD_H       1
+
+
+/*
+   The following is needed for correct expansion of the SoftFloat-3a
+   headers in ieee.c (and nowhere else...yet).
+*/
+
+#define  HAVE_STDBOOL_H       1
+
+
+/*
+   Base functions required for the build.
+*/
+
+#define  HAVE_MEMRCHR        1
+#define  HAVE_GETOPT_LONG    1
+/* #undef HAVE_STRLCPY */
+/* #undef HAVE_STRLCAT */
+#define  HAVE_STRERROR_R     1
+#define  HAVE_STRSIGNAL      1
+/* #undef HAVE_SYS_SIGLIST */
+#define  HAVE_SLEEP          1
+#define  HAVE_USLEEP         1
+#define  HAVE_NANOSLEEP      1
+#define  HAVE_SCHED_YIELD    1
+#define  HAVE_PTHREAD_SETAFFINITY_NP 1
+#define  HAVE_STRTOK_R       1
+#define  HAVE_GETTIMEOFDAY   1
+#define  HAVE_GETPGRP        1
+#define  HAVE_GETLOGIN       1
+#define  HAVE_GETLOGIN_R     1
+#define  HAVE_REALPATH       1
+#define  HAVE_FSYNC          1
+#define  HAVE_FTRUNCATE      1
+#define  HAVE_INET_ATON      1
+#define  HAVE_FORK           1
+#define  HAVE_SOCKETPAIR     1
+#define  HAVE_SYSCONF        1
+
+
+/*
+   One or more of the following memory management functions are required
+   to build.  Most are deprecated; posix_memalign is not deprecated and
+   apparently the most desireable.
+*/
+
+#define  HAVE_MLOCK          1
+#define  HAVE_MLOCKALL       1
+#define  HAVE_PVALLOC        1
+#define  HAVE_VALLOC         1
+#define  HAVE_POSIX_MEMALIGN 1
+
+
+/*
+   *********************************************************************
+               Macros used to configure Hercules networking
+   *********************************************************************
+*/
+
+/*
+   The following headers are in the configure.ac option section (line
+   115), but they are not optional on non-Windows systems.  Try building
+   Hercules without them.  :-)
+*/
+
+#define  HAVE_SYS_SOCKET_H           1
+#define  HAVE_NETINET_IN_H           1
+#define  HAVE_NET_IF_H               1
+#define  HAVE_NETDB_H                1
+#define  HAVE_NET_ROUTE_H            1
+/* #undef HAVE_NET_TCP_H */
+#define  HAVE_NETINET_TCP_H          1
+/* #undef HAVE_STRUCT_SOCKADDR_IN_SIN_LEN */
+#define  HAVE_STRUCT_IN_ADDR_S_ADDR  1
+#define  HAVE_ARPA_INET_H            1
+
+
+/*
+   Optional types for networking.  If they do not exist, Hercules will
+   define appropriate substitutes during the build.
+*/
+
+#define  HAVE_IN_ADDR_T      TRUE
+#define  HAVE_SOCKLEN_T      TRUE
+
+
+/*
+   Sundry networking macros.  Note that on FreeBSD, the "SIOC.*" macros
+   are defined in sys/sockio.h, which is not included in Hercules.  In
+   Debian, they are defined in sys/ioctl.h, but rather than being a
+   function call, they are constants.  The macros are used in hostopts.h,
+   and the Debian (Linux?) definition seems to be expected.  So from
+   Hercules' perspective, they exist in Linux and not in FreeBSD.
+*/
+
+#define  HAVE_DECL_IFNAMSIZ          1
+#define  HAVE_DECL_SIOCSIFNETMASK    1
+#define  HAVE_DECL_SIOCSIFBRDADDR    1
+#define  HAVE_DECL_SIOCSIFHWADDR     1
+#define  HAVE_DECL_SIOCGIFHWADDR     1
+#define  HAVE_DECL_SIOCADDRT         1
+#define  HAVE_DECL_SIOCDELRT         1
+#define  HAVE_DECL_SIOCDIFADDR       1
+
+
+/*
+   TCP/IP keepalive macros.  The first three specify the general level
+   keepalive support available in the target system.  The remainder
+   identify the target-specific macros needed for that support.  Either
+   _KEEPALIVE macro indicates basic support.  Any one of the remaining
+   three TCP_KEEP* (IDLE, INTVL, CNT) enable partial keepalive support,
+   and if all three are present, full keepalive support is possible.
+*/
+
+#define  HAVE_FULL_KEEPALIVE         1
+#define  HAVE_PARTIAL_KEEPALIVE      1
+#define  HAVE_BASIC_KEEPALIVE        1
+
+#define  HAVE_DECL_SO_KEEPALIVE      1
+/* #undef HAVE_DECL_TCP_KEEPALIVE */
+#define  HAVE_DECL_TCP_KEEPIDLE      1
+#define  HAVE_DECL_TCP_KEEPINTVL     1
+#define  HAVE_DECL_TCP_KEEPCNT       1
+
+
+/*
+   *********************************************************************
+              Determine how atomic operations are supported.
+   *********************************************************************
+*/
+
+/*
+   The following communicate the state of atomic instrinsics made available
+   by the C compiler and the underlying target userland/os/hardware.  Choices
+   in order of desirability are:
+   - C11 intrinsics
+   - __atomic_* intrinsics
+   - __sync_* intrinsics
+   The header hatomic.h sorts out the choices for the build.  Only the
+   byte-typed intrinsics are used, for the NI, OI, and XOI instructions and
+   their long-displacement (e.g., NIY) equivalents.
+*/
+
+#define  HAVE_STDATOMIC_H                1
+/* #undef HAVE_SYNC_BUILTINS */
+/* #undef HAVE_ATOMIC_INTRINSICS */
+
+#define  C11_ATOMICS_AVAILABLE           1
+#define  C11_ATOMIC_BOOL_LOCK_FREE       2
+#define  C11_ATOMIC_CHAR_LOCK_FREE       2
+#define  C11_ATOMIC_CHAR16_T_LOCK_FREE   2
+#define  C11_ATOMIC_CHAR32_T_LOCK_FREE   2
+#define  C11_ATOMIC_WCHAR_T_LOCK_FREE    2
+#define  C11_ATOMIC_SHORT_LOCK_FREE      2
+#define  C11_ATOMIC_INT_LOCK_FREE        2
+#define  C11_ATOMIC_LONG_LOCK_FREE       2
+#define  C11_ATOMIC_LLONG_LOCK_FREE      2
+#define  C11_ATOMIC_POINTER_LOCK_FREE    2
+
+
+/*
+   *********************************************************************
+             For hercifc: identify target setuid capabilities.
+   *********************************************************************
+*/
+
+/*
+    Configure if and how get/set UID can be done.  If not possible,
+    NO_SETUID is defined.  Otherwise, some of the five functions
+    below can be used to enable get/set UID.
+*/
+
+#define  HAVE_SETRESUID          1
+#define  HAVE_GETRESUID          1
+/* #undef HAVE_SETREUID */
+/* #undef HAVE_GETEUID */
+/* #undef HAVE_GETUID */
+/* #undef NO_SETUID */
+
+
+/*
+   See if sys/capability.h and the corresponding library cap exist.
+   If sys/capability.h and the corresponding library cap exist, then
+   Hercules can be built with support for fine-grained capabilities.
+   Header prctl.h enables some additional control.  Both Capabilities
+   and prctl are Linux-only implementations of POSIX 1003.1e.
+
+   Hercules code only checks for the headers; the functions and library
+   are assumed to exist.
+
+*/
+
+/* #undef HAVE_CAP_SET_PROC */
+/* #undef HAVE_SYS_CAPABILITY_H */
+/* #undef HAVE_SYS_PRTCL_H */
+
+
+/*
+   *********************************************************************
+        Macros for other optional features, headers, and functions
+   *********************************************************************
+*/
+
+/*
+   Optional useful types.  HAVE___UINT128_T controls whether Hercules
+   can be built with more than 64 CPUs.  If the others do not exist,
+   Hercules will define appropriate substitutes during the build.
+*/
+
+#define  HAVE___UINT128_T    16
+#define  HAVE_U_INT8_T       TRUE
+#define  HAVE_U_CHAR         TRUE
+#define  HAVE_U_SHORT        TRUE
+#define  HAVE_U_INT          TRUE
+#define  HAVE_U_LONG         TRUE
+
+
+/*
+    Optional headern for Hercules internal functionality.  If any are
+    missing, Hercules will use an internal equivalent as a substitute
+    or avoid the capability, but the build will continue.
+*/
+
+#define  HAVE_BYTESWAP_H     1
+#define  HAVE_ASSERT_H       1
+
+
+/*
+   Headers and libraries for REXX, compression, and regular expression
+   support.  Hercules will build correctly without them.  CMake
+   will abort the build for any optional item that was explicitly
+   requested by the builder.
+*/
+
+#define  HAVE_BZLIB_H            1
+#define  HAVE_LIBZ               1
+#define  HAVE_ZLIB_H             1
+#define  HAVE_REGEX_H            1
+/* #undef HAVE_REXXSAA_H */
+/* #undef HAVE_REGINA_REXXSAA_H */
+
+
+/*
+   Headers and functions for Unix shell tab key processing and one-char
+   command shortcuts on the internal Hercules CUI panel.
+*/
+
+#define  HAVE_ALPHASORT      1
+#define  HAVE_SCANDIR        1
+#define  HAVE_TERMIOS_H      1
+/* #undef CONST_IN_SCANDIR_PROTOTYPE */
+
+
+/*
+   Headers and macros for real tape devices.  sys/mtio.h and MTEWARN are
+   for SCSI tape devices only, while the rest are for all tapes.
+   Header sys/param.h is a prerequisite for sys/mount.h on some systems.
+*/
+
+#define  HAVE_SYS_PARAM_H    1
+#define  HAVE_SYS_MOUNT_H    1
+#define  HAVE_SYS_MTIO_H     1
+/* #undef HAVE_DECL_MTEWARN */
+
+
+/*
+   Headers for shared device server routines.
+*/
+
+#define  HAVE_SYS_UN_H       1
+
+
+/*
+   Headers for batched hardcopy log writes.
+*/
+
+#define  HAVE_SYS_UIO_H      1
+
+
+
+/*
+   Miscelaneous macros that reveal userland capabilities
+*/
+
+/* #undef HAVE_DECL_LOGIN_NAME_MAX */
+#define  HAVE_DECL__SC_NPROCESSORS_CONF  1
+#define  HAVE_DECL__SC_NPROCESSORS_ONLN  1
+
+
+/*
+   Sundry other Userland capabilities and requirements
+*/
+
+/* #undef NEED_GETOPT_OPTRESET */
+
+
+/*
+   Sundry other c compiler capabilities.  These macros are not required,
+   but they do control how Hercules builds.
+*/
+
+#define  C99_FLEXIBLE_ARRAYS             1
+#define  HAVE_ATTR_PRINTF                1
+#define  HAVE_ATTR_REGPARM               1
+#define  HAVE_GCC_DIAG_PRAGMA            1
+#define  HAVE_GCC_DIAG_PUSHPOP           1
+#define  HAVE_GCC_UNUSED_FUNC_WARNING    1
+#define  HAVE_GCC_SET_UNUSED_WARNING     1
+/* #undef HAVE_VERY_STRICT_ALIASING */
+
+/*
+   *********************************************************************
+        Macros for an Apple/macOS build
+   *********************************************************************
+*/
+
+/* #undef HAVE_MACH */
+/* #undef HAVE_MACH_O_DYLD_H */
+
+/* #undef HAVE__NSGETEXECUTABLEPATH */
+
+/*
+   *********************************************************************
+        Windows-specific macros
+   *********************************************************************
+*/
+
+/*
+   If this is a Windows build, undefine macros that are #define'd in
+   hercwind.h and other header files.
+
+    Notes:
+    1.  Note that for Windows, if PKGDATADIR is unset, httpserv.c uses a
+        default of the html subdirectory of the directory from which the
+        hercules.exe executable was retrieved.  On UNIX-like systems,
+        "/usr/local/share/hercules/" is the default.
+    2.  _MSVC_ is used throughout Hercules code to test for both "building
+        for Windows" _and_ "using the Visual Studio c compiler."  While it
+        is true that if one is using Visual Studio c, one is building for
+        Windows, the converse is not true: both clang and Intel c compilers
+        exist for non-Cygwin Windows builds.
+    3.  Supported versions of Windows always support C99_FLEXIBLE_ARRAYS,
+        TCP/IP Partial Keepalive, and large files.  The C99 and KEEPALIVE
+        macros are defined in hercwind.h.
+    4.  FTHREADS is the only threading model currently supported by the
+        Hercules Windows build, and it is defined in hercwind.h
+    5.  OPTION_NO_EXTERNALGUI must be defined to exclude External GUI
+        support.  It is not enough to leave EXTERNALGUI undefined.  See
+        lines 149-155 in hercwind.h.  This requirement reflects the fact
+        that the previous nmake build did not have a generator for config.h;
+        undefined was the normal state for most build control macros.
+    6.  If building for distribution, Hercules CMake option WINVER _must_
+        be set to WINXP364 to target Windows XP SP3 64-bit.
+*/
+
+#ifdef WINDOWS_BUILD
+
+ /* For now, presume Microsoft Visual C                                 */
+#   define _MSVC_ 1
+
+/* #undef HAVE_PCRE */
+
+ /* Suppress some deprecation warnings that aren't really deprecation   */
+ /* warnings                                                            */
+#   define _CRT_SECURE_NO_DEPRECATE
+#   define _CRT_NONSTDC_NO_DEPRECATE
+
+ /* Increase the sockets set size limit/default to be the same value as */
+ /* used on most non-Windows platforms (1024)                           */
+#   define FD_SETSIZE 1024
+
+ /* MSVC does not have C99 flexible arrays, nor should large file       */
+ /* support be disabled.  All supported Windows versions support it     */
+#   undef C99_FLEXIBLE_ARRAYS
+#   undef DISABLE_LARGEFILE
+
+ /* Windows supports only partial TCP Keepalive                         */
+#   undef HAVE_PARTIAL_KEEPALIVE
+#   undef HAVE_BASIC_KEEPALIVE
+
+ /* Fthreads is an option only for non-Windows builds.  Inclusion       */
+ /* of OPTION_FTHREADS messes up the Windows build.                     */
+#   undef OPTION_FTHREADS
+
+ /* Only the executable directory should be searched for Hercules       */
+ /* shared libraries (.DLL).  The HTTP server                           */
+#   undef MODULESDIR
+#   undef PKGDATADIR
+
+#   ifndef EXTERNALGUI
+#       define OPTION_NO_EXTERNALGUI
+#   endif
+
+ /* If PCRE has been built (the likely case), then the name of the      */
+ /* pcreposix.h header needs to be defined in PCRE_INCNAME.  Back in    */
+ /* the old days, there was some variability in the header name.  There */
+ /* is no longer, but source compatibility compels this definition.     */
+#   if defined(HAVE_PCRE)
+#       define PCRE_INCNAME "pcreposix.h"
+#   endif
+
+/* #undef WINVER */
+/* #undef _WIN32_WINNT */
+/* #undef NTDDI_VERSION */
+
+#endif    /* Windows build  */
+
+
+/*
+   *********************************************************************
+                    End of config.h generated by CMake
+   *********************************************************************
+*/
+
+
+
+
+
+
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/decNumber/decContext.c" "decNumber/CMakeFiles/decNumber.dir/decContext.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decContext.c.o.d"
+  "/root/repo/decNumber/decDouble.c" "decNumber/CMakeFiles/decNumber.dir/decDouble.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decDouble.c.o.d"
+  "/root/repo/decNumber/decNumber.c" "decNumber/CMakeFiles/decNumber.dir/decNumber.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decNumber.c.o.d"
+  "/root/repo/decNumber/decPacked.c" "decNumber/CMakeFiles/decNumber.dir/decPacked.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decPacked.c.o.d"
+  "/root/repo/decNumber/decQuad.c" "decNumber/CMakeFiles/decNumber.dir/decQuad.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decQuad.c.o.d"
+  "/root/repo/decNumber/decimal128.c" "decNumber/CMakeFiles/decNumber.dir/decimal128.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decimal128.c.o.d"
+  "/root/repo/decNumber/decimal32.c" "decNumber/CMakeFiles/decNumber.dir/decimal32.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decimal32.c.o.d"
+  "/root/repo/decNumber/decimal64.c" "decNumber/CMakeFiles/decNumber.dir/decimal64.c.o" "gcc" "decNumber/CMakeFiles/decNumber.dir/decimal64.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
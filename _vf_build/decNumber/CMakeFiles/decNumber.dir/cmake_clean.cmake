@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/decNumber.dir/decContext.c.o"
+  "CMakeFiles/decNumber.dir/decContext.c.o.d"
+  "CMakeFiles/decNumber.dir/decDouble.c.o"
+  "CMakeFiles/decNumber.dir/decDouble.c.o.d"
+  "CMakeFiles/decNumber.dir/decNumber.c.o"
+  "CMakeFiles/decNumber.dir/decNumber.c.o.d"
+  "CMakeFiles/decNumber.dir/decPacked.c.o"
+  "CMakeFiles/decNumber.dir/decPacked.c.o.d"
+  "CMakeFiles/decNumber.dir/decQuad.c.o"
+  "CMakeFiles/decNumber.dir/decQuad.c.o.d"
+  "CMakeFiles/decNumber.dir/decimal128.c.o"
+  "CMakeFiles/decNumber.dir/decimal128.c.o.d"
+  "CMakeFiles/decNumber.dir/decimal32.c.o"
+  "CMakeFiles/decNumber.dir/decimal32.c.o.d"
+  "CMakeFiles/decNumber.dir/decimal64.c.o"
+  "CMakeFiles/decNumber.dir/decimal64.c.o.d"
+  "libdecNumber.pdb"
+  "libdecNumber.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/decNumber.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_vf_build/html"
+  "/root/repo/_vf_build/html-prefix/src/html-build"
+  "/root/repo/_vf_build/html-prefix"
+  "/root/repo/_vf_build/html-prefix/tmp"
+  "/root/repo/_vf_build/html-prefix/src/html-stamp"
+  "/root/repo/_vf_build/html-prefix/src"
+  "/root/repo/_vf_build/html-prefix/src/html-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_vf_build/html-prefix/src/html-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_vf_build/html-prefix/src/html-stamp${cfgdir}") # cfgdir has leading slash
+endif()
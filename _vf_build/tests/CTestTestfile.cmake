@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_vf_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(001-panel "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "pnl-001-modpath.tstsp" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "001-panel")
+set_tests_properties(001-panel PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(002-cpu-ctl "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "clocksrc" "-f" "invpsw" "-f" "leapfrog" "-f" "runtest0" "-f" "runtest4" "-f" "sigp" "-f" "stfl" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "002-cpu-ctl")
+set_tests_properties(002-cpu-ctl PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(004-storage "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "mainsize" "-f" "cmd-abs" "-f" "cmd-rv" "-f" "logicimm" "-f" "pr" "-f" "ssk370" "-f" "sske" "-f" "sske370" "-f" "sske390" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "004-storage")
+set_tests_properties(004-storage PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(011-tapeio "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "awsbsf" "-f" "hetbsf" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "011-tapeio")
+set_tests_properties(011-tapeio PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(050-hex-fp "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "hfp-*" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "050-hex-fp")
+set_tests_properties(050-hex-fp PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(051-binary-fp "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "bfp-*" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "051-binary-fp")
+set_tests_properties(051-binary-fp PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(052-decimal-fp "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "csxtr" "-f" "dfp-001-arith" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "052-decimal-fp")
+set_tests_properties(052-decimal-fp PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(060-crypto "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "cipher" "-f" "cpacf-kat" "-f" "digest" "-f" "kimd-hw" "-f" "klmd-hw" "-f" "km-hw" "-f" "kmac-hw" "-f" "kmc-hw" "-f" "kmctr-hw" "-f" "kmf-hw" "-f" "kmo-hw" "-f" "zeos" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "060-crypto")
+set_tests_properties(060-crypto PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(070-basic-math "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "bim-*" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "070-basic-math")
+set_tests_properties(070-basic-math PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(099-other "/root/repo/_vf_build/herctest" "-d" "/root/repo/_vf_build/tests" "-h" "/root/repo/_vf_build" "-t" "10" "-f" "agf" "-f" "hao" "-f" "ilc" "-f" "mhi" "-f" "mvcle" "-f" "mvsassist" "-f" "pfpo" "-f" "pgmfast" "-f" "privop" "-f" "problem" "-f" "semipriv" "-f" "timeout" "-f" "txf" "-f" "wild" "-f" "zvector" "-v" "ptrsize=8" "-p" "/root/repo/_vf_build" "-w" "099-other")
+set_tests_properties(099-other PROPERTIES  WORKING_DIRECTORY "/root/repo/_vf_build/Testing/Temporary" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;149;add_test;/root/repo/tests/CMakeLists.txt;0;")
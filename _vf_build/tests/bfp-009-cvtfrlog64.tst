@@ -0,0 +1,212 @@
+*Testcase bfp-009-cvtfrlog64.tst: CELGBR, CDLGBR, CXLGBR
+
+#Testcase bfp-009-cvtfrlog64.tst: IEEE Convert From Logical (64-bit)
+#..Includes CONVERT FROM LOGICAL 64 (3).  Also tests traps and 
+#..exceptions and results from different rounding modes.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 3 program check messages that have no
+# value in the validation process.  (The messages, not the program checks.)
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-009-cvtfrlog64.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Inputs converted to BFP Short - Results
+*Compare
+r 1000.10
+*Want "CELGBR result pairs 1-2" 3F800000 3F800000 40000000 40000000
+r 1010.10
+*Want "CELGBR result pairs 3-4" 40800000 40800000 5F7FFFFF 5F7FFFFF
+r 1020.10
+*Want "CELGBR result pairs 5-6" 5F800000 5F800000 5F800000 5F800000
+
+# Inputs converted to BFP short FPCR Contents
+r 1100.10
+*Want "CELGBR FPC pairs 1-2" 00000000 F8000000 00000000 F8000000
+r 1110.10
+*Want "CELGBR FPC pairs 3-4" 00000000 F8000000 00000000 F8000000
+r 1120.10
+*Want "CELGBR FPC pairs 5-6" 00080000 F8000C00 00080000 F8000C00
+
+
+# Inputs converted to BFP short rounding mode test results
+*Compare
+r 1200.10
+*Want "CELGBR + result FPC modes 1-3, 7" 5F7FFFFF 5F800000 5F7FFFFF 5F7FFFFF
+r 1210.10
+*Want "CELGBR + result M3 modes 1, 3-5"  5F800000 5F7FFFFF 5F800000 5F7FFFFF
+r 1220.08
+*Want "CELGBR + result M3 modes 6, 7"    5F800000 5F7FFFFF
+
+r 1230.10
+*Want "CELGBR - result FPC modes 1-3, 7" 5F7FFFFF 5F800000 5F7FFFFF 5F7FFFFF
+r 1240.10
+*Want "CELGBR - result M3 modes 1, 3-5"  5F800000 5F7FFFFF 5F800000 5F7FFFFF
+r 1250.08
+*Want "CELGBR - result M3 modes 6, 7"    5F800000 5F7FFFFF
+
+r 1260.10
+*Want "CELGBR - result FPC modes 1-3, 7" 5F7FFFFF 5F800000 5F7FFFFF 5F7FFFFF
+r 1270.10
+*Want "CELGBR - result M3 modes 1, 3-5"  5F7FFFFF 5F7FFFFF 5F7FFFFF 5F7FFFFF
+r 1280.08
+*Want "CELGBR - result M3 modes 6, 7"    5F800000 5F7FFFFF
+
+
+# Inputs converted to BFP short rounding mode test FPCR Contents
+*Compare
+r 1500.10
+*Want "CELGBR + FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 1510.10
+*Want "CELGBR + M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 1520.08
+*Want "CELGBR + M3 modes 6, 7 FPCR"     00080000 00080000
+
+r 1530.10
+*Want "CELGBR - FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 1540.10
+*Want "CELGBR - M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 1550.08
+*Want "CELGBR - M3 modes 6, 7 FPCR"     00080000 00080000
+
+r 1560.10
+*Want "CELGBR - FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 1570.10
+*Want "CELGBR - M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 1580.08
+*Want "CELGBR - M3 modes 6, 7 FPCR"     00080000 00080000
+
+
+# Inputs converted to BFP Long - Results
+*Compare
+r 2000.10
+*Want "CDLGBR result pair 1" 3FF00000 00000000 3FF00000 00000000
+r 2010.10
+*Want "CDLGBR result pair 2" 40000000 00000000 40000000 00000000 
+r 2020.10
+*Want "CDLGBR result pair 3" 40100000 00000000 40100000 00000000
+r 2030.10
+*Want "CDLGBR result pair 4" 43EFFFFF E0000000 43EFFFFF E0000000
+r 2040.10
+*Want "CDLGBR result pair 5" 43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 2050.10
+*Want "CDLGBR result pair 6" 43F00000 00000000 43F00000 00000000
+
+# Inputs converted to BFP Long - FPCR Contents
+*Compare
+r 2100.10
+*Want "CDLGBR FPC pairs 1-2" 00000000 F8000000 00000000 F8000000
+r 2110.10
+*Want "CDLGBR FPC pairs 3-4" 00000000 F8000000 00000000 F8000000
+r 2120.10
+*Want "CDLGBR FPC pairs 5-6" 00000000 F8000000 00080000 F8000C00
+
+
+# Inputs converted to BFP long rounding mode test results
+*Compare
+r 2200.10
+*Want "CDLGBR + FPC modes 1, 2" 43EFFFFF FFFFFFFF 43F00000 00000000
+r 2210.10
+*Want "CDLGBR + FPC modes 3, 7" 43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 2220.10
+*Want "CDLGBR + M3 modes 1, 3"  43F00000 00000000 43EFFFFF FFFFFFFF
+r 2230.10
+*Want "CDLGBR + M3 modes 4, 5"  43F00000 00000000 43EFFFFF FFFFFFFF
+r 2240.10
+*Want "CDLGBR + M3 modes 6, 7"  43F00000 00000000 43EFFFFF FFFFFFFF
+
+r 2250.10
+*Want "CDLGBR - FPC modes 1, 2" 43EFFFFF FFFFFFFF 43F00000 00000000
+r 2260.10
+*Want "CDLGBR - FPC modes 3, 7" 43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 2270.10
+*Want "CDLGBR - M3 modes 1, 3"  43F00000 00000000 43EFFFFF FFFFFFFF
+r 2280.10
+*Want "CDLGBR - M3 modes 4, 5"  43F00000 00000000 43EFFFFF FFFFFFFF
+r 2290.10
+*Want "CDLGBR - M3 modes 6, 7"  43F00000 00000000 43EFFFFF FFFFFFFF 
+
+r 22A0.10
+*Want "CDLGBR - FPC modes 1, 2" 43EFFFFF FFFFFFFF 43F00000 00000000
+r 22B0.10
+*Want "CDLGBR - FPC modes 3, 7" 43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 22C0.10
+*Want "CDLGBR - M3 modes 1, 3"  43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 22D0.10
+*Want "CDLGBR - M3 modes 4, 5"  43EFFFFF FFFFFFFF 43EFFFFF FFFFFFFF
+r 22E0.10
+*Want "CDLGBR - M3 modes 6, 7"  43F00000 00000000 43EFFFFF FFFFFFFF 
+
+
+# Inputs converted to BFP long rounding mode test FPCR contents
+*Compare
+r 2700.10
+*Want "CDLGBR + FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 2710.10
+*Want "CDLGBR + M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 2720.08
+*Want "CDLGBR + M3 modes 6, 7 FPCR"     00080000 00080000
+
+r 2730.10
+*Want "CDLGBR - FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 2740.10
+*Want "CDLGBR - M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 2750.08
+*Want "CDLGBR - M3 modes 6, 7 FPCR"     00080000 00080000
+
+r 2760.10
+*Want "CDLGBR - FPC modes 1-3, 7 FPCR"  00000001 00000002 00000003 00000007
+r 2770.10
+*Want "CDLGBR - M3 modes 1, 3-5 FPCR"   00080000 00080000 00080000 00080000
+r 2780.08
+*Want "CDLGBR - M3 modes 6, 7 FPCR"     00080000 00080000
+
+
+# Inputs converted to BFP Extended - Results
+*Compare
+r 3000.10
+*Want "CXLGBR result 1a" 3FFF0000 00000000 00000000 00000000
+r 3010.10
+*Want "CXLGBR result 1b" 3FFF0000 00000000 00000000 00000000
+r 3020.10
+*Want "CXLGBR result 2a" 40000000 00000000 00000000 00000000
+r 3030.10
+*Want "CXLGBR result 2b" 40000000 00000000 00000000 00000000
+r 3040.10
+*Want "CXLGBR result 3a" 40010000 00000000 00000000 00000000
+r 3050.10
+*Want "CXLGBR result 3b" 40010000 00000000 00000000 00000000
+r 3060.10
+*Want "CXLGBR result 4a" 403EFFFF FE000000 00000000 00000000
+r 3070.10
+*Want "CXLGBR result 4b" 403EFFFF FE000000 00000000 00000000
+r 3080.10
+*Want "CXLGBR result 5a" 403EFFFF FFFFFFFF F0000000 00000000
+r 3090.10
+*Want "CXLGBR result 5b" 403EFFFF FFFFFFFF F0000000 00000000
+r 30A0.10
+*Want "CXLGBR result 6a" 403EFFFF FFFFFFFF FFFE0000 00000000
+r 30B0.10
+*Want "CXLGBR result 6b" 403EFFFF FFFFFFFF FFFE0000 00000000
+
+# Inputs converted to BFP Extended- FPCR Contents
+*Compare
+r 3200.10
+*Want "CXLGBR FPC pairs 1-2" 00000000 F8000000 00000000 F8000000
+r 3210.10
+*Want "CXLGBR FPC pairs 3-4" 00000000 F8000000 00000000 F8000000
+r 3220.10
+*Want "CXLGBR FPC pairs 5-6" 00000000 F8000000 00000000 F8000000
+
+*Done
+
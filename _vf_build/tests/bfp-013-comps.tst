@@ -0,0 +1,819 @@
+*Testcase bfp-013-comps.tst:      CEBR, CEB, CDBR, CDB, CXBR, KEBR, KEB, KDBR, KDB, KXBR
+
+#Testcase bfp-013-comps.tst: IEEE Compare and Compare And Signal
+#..Includes COMPARE (5), COMPARE AND SIGNAL (5)
+#..Test case values exhaustively test comparisons and traps
+
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 215 program check messages that have no
+# value in the validation process.  (The messages, not the program checks.)
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-013-comps.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Compare short BFP results - FPCR contents and CC
+*Compare
+r 1000.10  
+*Want "CEBR/CEB -infinity / -infinity" 00000000 F8000000 00000000 F8000000
+r 1010.10  
+*Want "CEBR/CEB -infinity / -1"        00000001 F8000001 00000001 F8000001
+r 1020.10  
+*Want "CEBR/CEB -infinity / -0"        00000001 F8000001 00000001 F8000001
+r 1030.10  
+*Want "CEBR/CEB -infinity / +0"        00000001 F8000001 00000001 F8000001
+r 1040.10  
+*Want "CEBR/CEB -infinity / +1"        00000001 F8000001 00000001 F8000001
+r 1050.10  
+*Want "CEBR/CEB -infinity / +infinity" 00000001 F8000001 00000001 F8000001
+r 1060.10  
+*Want "CEBR/CEB -infinity / -QNaN"     00000003 F8000003 00000003 F8000003
+r 1070.10  
+*Want "CEBR/CEB -infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 1080.10  
+*Want "CEBR/CEB -1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1090.10  
+*Want "CEBR/CEB -1 / -1"               00000000 F8000000 00000000 F8000000
+r 10A0.10  
+*Want "CEBR/CEB -1 / -0"               00000001 F8000001 00000001 F8000001
+r 10B0.10  
+*Want "CEBR/CEB -1 / +0"               00000001 F8000001 00000001 F8000001
+r 10C0.10  
+*Want "CEBR/CEB -1 / +1"               00000001 F8000001 00000001 F8000001
+r 10D0.10  
+*Want "CEBR/CEB -1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 10E0.10  
+*Want "CEBR/CEB -1 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 10F0.10  
+*Want "CEBR/CEB -1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1100.10  
+*Want "CEBR/CEB -0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1110.10  
+*Want "CEBR/CEB -0 / -1"               00000002 F8000002 00000002 F8000002
+r 1120.10  
+*Want "CEBR/CEB -0 / -0"               00000000 F8000000 00000000 F8000000
+r 1130.10  
+*Want "CEBR/CEB -0 / +0"               00000000 F8000000 00000000 F8000000
+r 1140.10  
+*Want "CEBR/CEB -0 / +1"               00000001 F8000001 00000001 F8000001
+r 1150.10  
+*Want "CEBR/CEB -0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 1160.10  
+*Want "CEBR/CEB -0 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 1170.10  
+*Want "CEBR/CEB -0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1180.10  
+*Want "CEBR/CEB +0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1190.10  
+*Want "CEBR/CEB +0 / -1"               00000002 F8000002 00000002 F8000002
+r 11A0.10  
+*Want "CEBR/CEB +0 / -0"               00000000 F8000000 00000000 F8000000
+r 11B0.10  
+*Want "CEBR/CEB +0 / +0"               00000000 F8000000 00000000 F8000000
+r 11C0.10  
+*Want "CEBR/CEB +0 / +1"               00000001 F8000001 00000001 F8000001
+r 11D0.10  
+*Want "CEBR/CEB +0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 11E0.10  
+*Want "CEBR/CEB +0 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 11F0.10  
+*Want "CEBR/CEB +0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1200.10  
+*Want "CEBR/CEB +1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1210.10  
+*Want "CEBR/CEB +1 / -1"               00000002 F8000002 00000002 F8000002
+r 1220.10  
+*Want "CEBR/CEB +1 / -0"               00000002 F8000002 00000002 F8000002
+r 1230.10  
+*Want "CEBR/CEB +1 / +0"               00000002 F8000002 00000002 F8000002
+r 1240.10  
+*Want "CEBR/CEB +1 / +1"               00000000 F8000000 00000000 F8000000
+r 1250.10  
+*Want "CEBR/CEB +1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 1260.10  
+*Want "CEBR/CEB +1 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 1270.10  
+*Want "CEBR/CEB +1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1280.10  
+*Want "CEBR/CEB +infinity / -infinity" 00000002 F8000002 00000002 F8000002
+r 1290.10  
+*Want "CEBR/CEB +infinity / -1"        00000002 F8000002 00000002 F8000002
+r 12A0.10  
+*Want "CEBR/CEB +infinity / -0"        00000002 F8000002 00000002 F8000002
+r 12B0.10  
+*Want "CEBR/CEB +infinity / +0"        00000002 F8000002 00000002 F8000002
+r 12C0.10  
+*Want "CEBR/CEB +infinity / +1"        00000002 F8000002 00000002 F8000002
+r 12D0.10  
+*Want "CEBR/CEB +infinity / +infinity" 00000000 F8000000 00000000 F8000000
+r 12E0.10  
+*Want "CEBR/CEB +infinity / -QNaN"     00000003 F8000003 00000003 F8000003
+r 12F0.10  
+*Want "CEBR/CEB +infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 1300.10  
+*Want "CEBR/CEB -QNaN / -infinity"     00000003 F8000003 00000003 F8000003
+r 1310.10  
+*Want "CEBR/CEB -QNaN / -1"            00000003 F8000003 00000003 F8000003
+r 1320.10  
+*Want "CEBR/CEB -QNaN / -0"            00000003 F8000003 00000003 F8000003
+r 1330.10  
+*Want "CEBR/CEB -QNaN / +0"            00000003 F8000003 00000003 F8000003
+r 1340.10  
+*Want "CEBR/CEB -QNaN / +1"            00000003 F8000003 00000003 F8000003
+r 1350.10  
+*Want "CEBR/CEB -QNaN / +infinity"     00000003 F8000003 00000003 F8000003
+r 1360.10  
+*Want "CEBR/CEB -QNaN / -QNaN"         00000003 F8000003 00000003 F8000003
+r 1370.10  
+*Want "CEBR/CEB -QNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+r 1380.10  
+*Want "CEBR/CEB +SNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 1390.10  
+*Want "CEBR/CEB +SNaN / -1"            00800003 F8008000 00800003 F8008000
+r 13A0.10  
+*Want "CEBR/CEB +SNaN / -0"            00800003 F8008000 00800003 F8008000
+r 13B0.10  
+*Want "CEBR/CEB +SNaN / +0"            00800003 F8008000 00800003 F8008000
+r 13C0.10  
+*Want "CEBR/CEB +SNaN / +1"            00800003 F8008000 00800003 F8008000
+r 13D0.10  
+*Want "CEBR/CEB +SNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 13E0.10  
+*Want "CEBR/CEB +SNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 13F0.10  
+*Want "CEBR/CEB +SNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+
+
+
+# Compare and Signal results - FPCR contents and CC
+r 1400.10  
+*Want "KEBR/KEB -infinity / -infinity" 00000000 F8000000 00000000 F8000000
+r 1410.10  
+*Want "KEBR/KEB -infinity / -1"        00000001 F8000001 00000001 F8000001
+r 1420.10  
+*Want "KEBR/KEB -infinity / -0"        00000001 F8000001 00000001 F8000001
+r 1430.10  
+*Want "KEBR/KEB -infinity / +0"        00000001 F8000001 00000001 F8000001
+r 1440.10  
+*Want "KEBR/KEB -infinity / +1"        00000001 F8000001 00000001 F8000001
+r 1450.10  
+*Want "KEBR/KEB -infinity / +infinity" 00000001 F8000001 00000001 F8000001
+r 1460.10  
+*Want "KEBR/KEB -infinity / -QNaN"     00800003 F8008000 00800003 F8008000
+r 1470.10  
+*Want "KEBR/KEB -infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 1480.10  
+*Want "KEBR/KEB -1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1490.10  
+*Want "KEBR/KEB -1 / -1"               00000000 F8000000 00000000 F8000000
+r 14A0.10  
+*Want "KEBR/KEB -1 / -0"               00000001 F8000001 00000001 F8000001
+r 14B0.10  
+*Want "KEBR/KEB -1 / +0"               00000001 F8000001 00000001 F8000001
+r 14C0.10  
+*Want "KEBR/KEB -1 / +1"               00000001 F8000001 00000001 F8000001
+r 14D0.10  
+*Want "KEBR/KEB -1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 14E0.10  
+*Want "KEBR/KEB -1 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 14F0.10  
+*Want "KEBR/KEB -1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1500.10  
+*Want "KEBR/KEB -0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1510.10  
+*Want "KEBR/KEB -0 / -1"               00000002 F8000002 00000002 F8000002
+r 1520.10  
+*Want "KEBR/KEB -0 / -0"               00000000 F8000000 00000000 F8000000
+r 1530.10  
+*Want "KEBR/KEB -0 / +0"               00000000 F8000000 00000000 F8000000
+r 1540.10  
+*Want "KEBR/KEB -0 / +1"               00000001 F8000001 00000001 F8000001
+r 1550.10  
+*Want "KEBR/KEB -0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 1560.10  
+*Want "KEBR/KEB -0 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 1570.10  
+*Want "KEBR/KEB -0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1580.10  
+*Want "KEBR/KEB +0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1590.10  
+*Want "KEBR/KEB +0 / -1"               00000002 F8000002 00000002 F8000002
+r 15A0.10  
+*Want "KEBR/KEB +0 / -0"               00000000 F8000000 00000000 F8000000
+r 15B0.10  
+*Want "KEBR/KEB +0 / +0"               00000000 F8000000 00000000 F8000000
+r 15C0.10  
+*Want "KEBR/KEB +0 / +1"               00000001 F8000001 00000001 F8000001
+r 15D0.10  
+*Want "KEBR/KEB +0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 15E0.10  
+*Want "KEBR/KEB +0 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 15F0.10  
+*Want "KEBR/KEB +0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1600.10  
+*Want "KEBR/KEB +1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 1610.10  
+*Want "KEBR/KEB +1 / -1"               00000002 F8000002 00000002 F8000002
+r 1620.10  
+*Want "KEBR/KEB +1 / -0"               00000002 F8000002 00000002 F8000002
+r 1630.10  
+*Want "KEBR/KEB +1 / +0"               00000002 F8000002 00000002 F8000002
+r 1640.10  
+*Want "KEBR/KEB +1 / +1"               00000000 F8000000 00000000 F8000000
+r 1650.10  
+*Want "KEBR/KEB +1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 1660.10  
+*Want "KEBR/KEB +1 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 1670.10  
+*Want "KEBR/KEB +1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 1680.10  
+*Want "KEBR/KEB +infinity / -infinity" 00000002 F8000002 00000002 F8000002
+r 1690.10  
+*Want "KEBR/KEB +infinity / -1"        00000002 F8000002 00000002 F8000002
+r 16A0.10  
+*Want "KEBR/KEB +infinity / -0"        00000002 F8000002 00000002 F8000002
+r 16B0.10  
+*Want "KEBR/KEB +infinity / +0"        00000002 F8000002 00000002 F8000002
+r 16C0.10  
+*Want "KEBR/KEB +infinity / +1"        00000002 F8000002 00000002 F8000002
+r 16D0.10  
+*Want "KEBR/KEB +infinity / +infinity" 00000000 F8000000 00000000 F8000000
+r 16E0.10  
+*Want "KEBR/KEB +infinity / -QNaN"     00800003 F8008000 00800003 F8008000
+r 16F0.10  
+*Want "KEBR/KEB +infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 1700.10  
+*Want "KEBR/KEB -QNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 1710.10  
+*Want "KEBR/KEB -QNaN / -1"            00800003 F8008000 00800003 F8008000
+r 1720.10  
+*Want "KEBR/KEB -QNaN / -0"            00800003 F8008000 00800003 F8008000
+r 1730.10  
+*Want "KEBR/KEB -QNaN / +0"            00800003 F8008000 00800003 F8008000
+r 1740.10  
+*Want "KEBR/KEB -QNaN / +1"            00800003 F8008000 00800003 F8008000
+r 1750.10  
+*Want "KEBR/KEB -QNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 1760.10  
+*Want "KEBR/KEB -QNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 1770.10  
+*Want "KEBR/KEB -QNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+r 1780.10  
+*Want "KEBR/KEB +SNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 1790.10  
+*Want "KEBR/KEB +SNaN / -1"            00800003 F8008000 00800003 F8008000
+r 17A0.10  
+*Want "KEBR/KEB +SNaN / -0"            00800003 F8008000 00800003 F8008000
+r 17B0.10  
+*Want "KEBR/KEB +SNaN / +0"            00800003 F8008000 00800003 F8008000
+r 17C0.10  
+*Want "KEBR/KEB +SNaN / +1"            00800003 F8008000 00800003 F8008000
+r 17D0.10  
+*Want "KEBR/KEB +SNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 17E0.10  
+*Want "KEBR/KEB +SNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 17F0.10  
+*Want "KEBR/KEB +SNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+
+
+# Compare long BFP results - FPCR contents and CC
+*Compare
+r 2000.10  
+*Want "CDBR/CDB -infinity / -infinity" 00000000 F8000000 00000000 F8000000
+r 2010.10  
+*Want "CDBR/CDB -infinity / -1"        00000001 F8000001 00000001 F8000001
+r 2020.10  
+*Want "CDBR/CDB -infinity / -0"        00000001 F8000001 00000001 F8000001
+r 2030.10  
+*Want "CDBR/CDB -infinity / +0"        00000001 F8000001 00000001 F8000001
+r 2040.10  
+*Want "CDBR/CDB -infinity / +1"        00000001 F8000001 00000001 F8000001
+r 2050.10  
+*Want "CDBR/CDB -infinity / +infinity" 00000001 F8000001 00000001 F8000001
+r 2060.10  
+*Want "CDBR/CDB -infinity / -QNaN"     00000003 F8000003 00000003 F8000003
+r 2070.10  
+*Want "CDBR/CDB -infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 2080.10  
+*Want "CDBR/CDB -1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2090.10  
+*Want "CDBR/CDB -1 / -1"               00000000 F8000000 00000000 F8000000
+r 20A0.10  
+*Want "CDBR/CDB -1 / -0"               00000001 F8000001 00000001 F8000001
+r 20B0.10  
+*Want "CDBR/CDB -1 / +0"               00000001 F8000001 00000001 F8000001
+r 20C0.10  
+*Want "CDBR/CDB -1 / +1"               00000001 F8000001 00000001 F8000001
+r 20D0.10  
+*Want "CDBR/CDB -1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 20E0.10  
+*Want "CDBR/CDB -1 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 20F0.10  
+*Want "CDBR/CDB -1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2100.10  
+*Want "CDBR/CDB -0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2110.10  
+*Want "CDBR/CDB -0 / -1"               00000002 F8000002 00000002 F8000002
+r 2120.10  
+*Want "CDBR/CDB -0 / -0"               00000000 F8000000 00000000 F8000000
+r 2130.10  
+*Want "CDBR/CDB -0 / +0"               00000000 F8000000 00000000 F8000000
+r 2140.10  
+*Want "CDBR/CDB -0 / +1"               00000001 F8000001 00000001 F8000001
+r 2150.10  
+*Want "CDBR/CDB -0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 2160.10  
+*Want "CDBR/CDB -0 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 2170.10  
+*Want "CDBR/CDB -0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2180.10  
+*Want "CDBR/CDB +0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2190.10  
+*Want "CDBR/CDB +0 / -1"               00000002 F8000002 00000002 F8000002
+r 21A0.10  
+*Want "CDBR/CDB +0 / -0"               00000000 F8000000 00000000 F8000000
+r 21B0.10  
+*Want "CDBR/CDB +0 / +0"               00000000 F8000000 00000000 F8000000
+r 21C0.10  
+*Want "CDBR/CDB +0 / +1"               00000001 F8000001 00000001 F8000001
+r 21D0.10  
+*Want "CDBR/CDB +0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 21E0.10  
+*Want "CDBR/CDB +0 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 21F0.10  
+*Want "CDBR/CDB +0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2200.10  
+*Want "CDBR/CDB +1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2210.10  
+*Want "CDBR/CDB +1 / -1"               00000002 F8000002 00000002 F8000002
+r 2220.10  
+*Want "CDBR/CDB +1 / -0"               00000002 F8000002 00000002 F8000002
+r 2230.10  
+*Want "CDBR/CDB +1 / +0"               00000002 F8000002 00000002 F8000002
+r 2240.10  
+*Want "CDBR/CDB +1 / +1"               00000000 F8000000 00000000 F8000000
+r 2250.10  
+*Want "CDBR/CDB +1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 2260.10  
+*Want "CDBR/CDB +1 / -QNaN"            00000003 F8000003 00000003 F8000003
+r 2270.10  
+*Want "CDBR/CDB +1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2280.10  
+*Want "CDBR/CDB +infinity / -infinity" 00000002 F8000002 00000002 F8000002
+r 2290.10  
+*Want "CDBR/CDB +infinity / -1"        00000002 F8000002 00000002 F8000002
+r 22A0.10  
+*Want "CDBR/CDB +infinity / -0"        00000002 F8000002 00000002 F8000002
+r 22B0.10  
+*Want "CDBR/CDB +infinity / +0"        00000002 F8000002 00000002 F8000002
+r 22C0.10  
+*Want "CDBR/CDB +infinity / +1"        00000002 F8000002 00000002 F8000002
+r 22D0.10  
+*Want "CDBR/CDB +infinity / +infinity" 00000000 F8000000 00000000 F8000000
+r 22E0.10  
+*Want "CDBR/CDB +infinity / -QNaN"     00000003 F8000003 00000003 F8000003
+r 22F0.10  
+*Want "CDBR/CDB +infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 2300.10  
+*Want "CDBR/CDB -QNaN / -infinity"     00000003 F8000003 00000003 F8000003
+r 2310.10  
+*Want "CDBR/CDB -QNaN / -1"            00000003 F8000003 00000003 F8000003
+r 2320.10  
+*Want "CDBR/CDB -QNaN / -0"            00000003 F8000003 00000003 F8000003
+r 2330.10  
+*Want "CDBR/CDB -QNaN / +0"            00000003 F8000003 00000003 F8000003
+r 2340.10  
+*Want "CDBR/CDB -QNaN / +1"            00000003 F8000003 00000003 F8000003
+r 2350.10  
+*Want "CDBR/CDB -QNaN / +infinity"     00000003 F8000003 00000003 F8000003
+r 2360.10  
+*Want "CDBR/CDB -QNaN / -QNaN"         00000003 F8000003 00000003 F8000003
+r 2370.10  
+*Want "CDBR/CDB -QNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+r 2380.10  
+*Want "CDBR/CDB +SNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 2390.10  
+*Want "CDBR/CDB +SNaN / -1"            00800003 F8008000 00800003 F8008000
+r 23A0.10  
+*Want "CDBR/CDB +SNaN / -0"            00800003 F8008000 00800003 F8008000
+r 23B0.10  
+*Want "CDBR/CDB +SNaN / +0"            00800003 F8008000 00800003 F8008000
+r 23C0.10  
+*Want "CDBR/CDB +SNaN / +1"            00800003 F8008000 00800003 F8008000
+r 23D0.10  
+*Want "CDBR/CDB +SNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 23E0.10  
+*Want "CDBR/CDB +SNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 23F0.10  
+*Want "CDBR/CDB +SNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+
+
+# Compare and Signal results- FPCR contents and CC
+r 2400.10  
+*Want "KDBR/KDB -infinity / -infinity" 00000000 F8000000 00000000 F8000000
+r 2410.10  
+*Want "KDBR/KDB -infinity / -1"        00000001 F8000001 00000001 F8000001
+r 2420.10  
+*Want "KDBR/KDB -infinity / -0"        00000001 F8000001 00000001 F8000001
+r 2430.10  
+*Want "KDBR/KDB -infinity / +0"        00000001 F8000001 00000001 F8000001
+r 2440.10  
+*Want "KDBR/KDB -infinity / +1"        00000001 F8000001 00000001 F8000001
+r 2450.10  
+*Want "KDBR/KDB -infinity / +infinity" 00000001 F8000001 00000001 F8000001
+r 2460.10  
+*Want "KDBR/KDB -infinity / -QNaN"     00800003 F8008000 00800003 F8008000
+r 2470.10  
+*Want "KDBR/KDB -infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 2480.10  
+*Want "KDBR/KDB -1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2490.10  
+*Want "KDBR/KDB -1 / -1"               00000000 F8000000 00000000 F8000000
+r 24A0.10  
+*Want "KDBR/KDB -1 / -0"               00000001 F8000001 00000001 F8000001
+r 24B0.10  
+*Want "KDBR/KDB -1 / +0"               00000001 F8000001 00000001 F8000001
+r 24C0.10  
+*Want "KDBR/KDB -1 / +1"               00000001 F8000001 00000001 F8000001
+r 24D0.10  
+*Want "KDBR/KDB -1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 24E0.10  
+*Want "KDBR/KDB -1 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 24F0.10  
+*Want "KDBR/KDB -1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2500.10  
+*Want "KDBR/KDB -0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2510.10  
+*Want "KDBR/KDB -0 / -1"               00000002 F8000002 00000002 F8000002
+r 2520.10  
+*Want "KDBR/KDB -0 / -0"               00000000 F8000000 00000000 F8000000
+r 2530.10  
+*Want "KDBR/KDB -0 / +0"               00000000 F8000000 00000000 F8000000
+r 2540.10  
+*Want "KDBR/KDB -0 / +1"               00000001 F8000001 00000001 F8000001
+r 2550.10  
+*Want "KDBR/KDB -0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 2560.10  
+*Want "KDBR/KDB -0 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 2570.10  
+*Want "KDBR/KDB -0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2580.10  
+*Want "KDBR/KDB +0 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2590.10  
+*Want "KDBR/KDB +0 / -1"               00000002 F8000002 00000002 F8000002
+r 25A0.10  
+*Want "KDBR/KDB +0 / -0"               00000000 F8000000 00000000 F8000000
+r 25B0.10  
+*Want "KDBR/KDB +0 / +0"               00000000 F8000000 00000000 F8000000
+r 25C0.10  
+*Want "KDBR/KDB +0 / +1"               00000001 F8000001 00000001 F8000001
+r 25D0.10  
+*Want "KDBR/KDB +0 / +infinity"        00000001 F8000001 00000001 F8000001
+r 25E0.10  
+*Want "KDBR/KDB +0 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 25F0.10  
+*Want "KDBR/KDB +0 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2600.10  
+*Want "KDBR/KDB +1 / -infinity"        00000002 F8000002 00000002 F8000002
+r 2610.10  
+*Want "KDBR/KDB +1 / -1"               00000002 F8000002 00000002 F8000002
+r 2620.10  
+*Want "KDBR/KDB +1 / -0"               00000002 F8000002 00000002 F8000002
+r 2630.10  
+*Want "KDBR/KDB +1 / +0"               00000002 F8000002 00000002 F8000002
+r 2640.10  
+*Want "KDBR/KDB +1 / +1"               00000000 F8000000 00000000 F8000000
+r 2650.10  
+*Want "KDBR/KDB +1 / +infinity"        00000001 F8000001 00000001 F8000001
+r 2660.10  
+*Want "KDBR/KDB +1 / -QNaN"            00800003 F8008000 00800003 F8008000
+r 2670.10  
+*Want "KDBR/KDB +1 / +SNaN"            00800003 F8008000 00800003 F8008000
+r 2680.10  
+*Want "KDBR/KDB +infinity / -infinity" 00000002 F8000002 00000002 F8000002
+r 2690.10  
+*Want "KDBR/KDB +infinity / -1"        00000002 F8000002 00000002 F8000002
+r 26A0.10  
+*Want "KDBR/KDB +infinity / -0"        00000002 F8000002 00000002 F8000002
+r 26B0.10  
+*Want "KDBR/KDB +infinity / +0"        00000002 F8000002 00000002 F8000002
+r 26C0.10  
+*Want "KDBR/KDB +infinity / +1"        00000002 F8000002 00000002 F8000002
+r 26D0.10  
+*Want "KDBR/KDB +infinity / +infinity" 00000000 F8000000 00000000 F8000000
+r 26E0.10  
+*Want "KDBR/KDB +infinity / -QNaN"     00800003 F8008000 00800003 F8008000
+r 26F0.10  
+*Want "KDBR/KDB +infinity / +SNaN"     00800003 F8008000 00800003 F8008000
+r 2700.10  
+*Want "KDBR/KDB -QNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 2710.10  
+*Want "KDBR/KDB -QNaN / -1"            00800003 F8008000 00800003 F8008000
+r 2720.10  
+*Want "KDBR/KDB -QNaN / -0"            00800003 F8008000 00800003 F8008000
+r 2730.10  
+*Want "KDBR/KDB -QNaN / +0"            00800003 F8008000 00800003 F8008000
+r 2740.10  
+*Want "KDBR/KDB -QNaN / +1"            00800003 F8008000 00800003 F8008000
+r 2750.10  
+*Want "KDBR/KDB -QNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 2760.10  
+*Want "KDBR/KDB -QNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 2770.10  
+*Want "KDBR/KDB -QNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+r 2780.10  
+*Want "KDBR/KDB +SNaN / -infinity"     00800003 F8008000 00800003 F8008000
+r 2790.10  
+*Want "KDBR/KDB +SNaN / -1"            00800003 F8008000 00800003 F8008000
+r 27A0.10  
+*Want "KDBR/KDB +SNaN / -0"            00800003 F8008000 00800003 F8008000
+r 27B0.10  
+*Want "KDBR/KDB +SNaN / +0"            00800003 F8008000 00800003 F8008000
+r 27C0.10  
+*Want "KDBR/KDB +SNaN / +1"            00800003 F8008000 00800003 F8008000
+r 27D0.10  
+*Want "KDBR/KDB +SNaN / +infinity"     00800003 F8008000 00800003 F8008000
+r 27E0.10  
+*Want "KDBR/KDB +SNaN / -QNaN"         00800003 F8008000 00800003 F8008000
+r 27F0.10  
+*Want "KDBR/KDB +SNaN / +SNaN"         00800003 F8008000 00800003 F8008000
+
+
+# Compare extended BFP results - FPCR contents and CC
+*Compare
+r 3000.08  
+*Want "CXBR -infinity / -infinity" 00000000 F8000000
+r 3010.08  
+*Want "CXBR -infinity / -1"        00000001 F8000001
+r 3020.08  
+*Want "CXBR -infinity / -0"        00000001 F8000001
+r 3030.08  
+*Want "CXBR -infinity / +0"        00000001 F8000001
+r 3040.08  
+*Want "CXBR -infinity / +1"        00000001 F8000001
+r 3050.08  
+*Want "CXBR -infinity / +infinity" 00000001 F8000001
+r 3060.08  
+*Want "CXBR -infinity / -QNaN"     00000003 F8000003
+r 3070.08  
+*Want "CXBR -infinity / +SNaN"     00800003 F8008000
+r 3080.08  
+*Want "CXBR -1 / -infinity"        00000002 F8000002
+r 3090.08  
+*Want "CXBR -1 / -1"               00000000 F8000000
+r 30A0.08  
+*Want "CXBR -1 / -0"               00000001 F8000001
+r 30B0.08  
+*Want "CXBR -1 / +0"               00000001 F8000001
+r 30C0.08  
+*Want "CXBR -1 / +1"               00000001 F8000001
+r 30D0.08  
+*Want "CXBR -1 / +infinity"        00000001 F8000001
+r 30E0.08  
+*Want "CXBR -1 / -QNaN"            00000003 F8000003
+r 30F0.08  
+*Want "CXBR -1 / +SNaN"            00800003 F8008000
+r 3100.08  
+*Want "CXBR -0 / -infinity"        00000002 F8000002
+r 3110.08  
+*Want "CXBR -0 / -1"               00000002 F8000002
+r 3120.08  
+*Want "CXBR -0 / -0"               00000000 F8000000
+r 3130.08  
+*Want "CXBR -0 / +0"               00000000 F8000000
+r 3140.08  
+*Want "CXBR -0 / +1"               00000001 F8000001
+r 3150.08  
+*Want "CXBR -0 / +infinity"        00000001 F8000001
+r 3160.08  
+*Want "CXBR -0 / -QNaN"            00000003 F8000003
+r 3170.08  
+*Want "CXBR -0 / +SNaN"            00800003 F8008000
+r 3180.08  
+*Want "CXBR +0 / -infinity"        00000002 F8000002
+r 3190.08  
+*Want "CXBR +0 / -1"               00000002 F8000002
+r 31A0.08  
+*Want "CXBR +0 / -0"               00000000 F8000000
+r 31B0.08  
+*Want "CXBR +0 / +0"               00000000 F8000000
+r 31C0.08  
+*Want "CXBR +0 / +1"               00000001 F8000001
+r 31D0.08  
+*Want "CXBR +0 / +infinity"        00000001 F8000001
+r 31E0.08  
+*Want "CXBR +0 / -QNaN"            00000003 F8000003
+r 31F0.08  
+*Want "CXBR +0 / +SNaN"            00800003 F8008000
+r 3200.08  
+*Want "CXBR +1 / -infinity"        00000002 F8000002
+r 3210.08  
+*Want "CXBR +1 / -1"               00000002 F8000002
+r 3220.08  
+*Want "CXBR +1 / -0"               00000002 F8000002
+r 3230.08  
+*Want "CXBR +1 / +0"               00000002 F8000002
+r 3240.08  
+*Want "CXBR +1 / +1"               00000000 F8000000
+r 3250.08  
+*Want "CXBR +1 / +infinity"        00000001 F8000001
+r 3260.08  
+*Want "CXBR +1 / -QNaN"            00000003 F8000003
+r 3270.08  
+*Want "CXBR +1 / +SNaN"            00800003 F8008000
+r 3280.08  
+*Want "CXBR +infinity / -infinity" 00000002 F8000002
+r 3290.08  
+*Want "CXBR +infinity / -1"        00000002 F8000002
+r 32A0.08  
+*Want "CXBR +infinity / -0"        00000002 F8000002
+r 32B0.08  
+*Want "CXBR +infinity / +0"        00000002 F8000002
+r 32C0.08  
+*Want "CXBR +infinity / +1"        00000002 F8000002
+r 32D0.08  
+*Want "CXBR +infinity / +infinity" 00000000 F8000000
+r 32E0.08  
+*Want "CXBR +infinity / -QNaN"     00000003 F8000003
+r 32F0.08  
+*Want "CXBR +infinity / +SNaN"     00800003 F8008000
+r 3300.08  
+*Want "CXBR -QNaN / -infinity"     00000003 F8000003
+r 3310.08  
+*Want "CXBR -QNaN / -1"            00000003 F8000003
+r 3320.08  
+*Want "CXBR -QNaN / -0"            00000003 F8000003
+r 3330.08  
+*Want "CXBR -QNaN / +0"            00000003 F8000003
+r 3340.08  
+*Want "CXBR -QNaN / +1"            00000003 F8000003
+r 3350.08  
+*Want "CXBR -QNaN / +infinity"     00000003 F8000003
+r 3360.08  
+*Want "CXBR -QNaN / -QNaN"         00000003 F8000003
+r 3370.08  
+*Want "CXBR -QNaN / +SNaN"         00800003 F8008000
+r 3380.08  
+*Want "CXBR +SNaN / -infinity"     00800003 F8008000
+r 3390.08  
+*Want "CXBR +SNaN / -1"            00800003 F8008000
+r 33A0.08  
+*Want "CXBR +SNaN / -0"            00800003 F8008000
+r 33B0.08  
+*Want "CXBR +SNaN / +0"            00800003 F8008000
+r 33C0.08  
+*Want "CXBR +SNaN / +1"            00800003 F8008000
+r 33D0.08  
+*Want "CXBR +SNaN / +infinity"     00800003 F8008000
+r 33E0.08  
+*Want "CXBR +SNaN / -QNaN"         00800003 F8008000
+r 33F0.08  
+*Want "CXBR +SNaN / +SNaN"         00800003 F8008000
+
+
+# Compare And Signal extended BFP results - FPCR contents and CC
+*Compare
+r 3400.08  
+*Want "KXBR -infinity / -infinity" 00000000 F8000000
+r 3410.08  
+*Want "KXBR -infinity / -1"        00000001 F8000001
+r 3420.08  
+*Want "KXBR -infinity / -0"        00000001 F8000001
+r 3430.08  
+*Want "KXBR -infinity / +0"        00000001 F8000001
+r 3440.08  
+*Want "KXBR -infinity / +1"        00000001 F8000001
+r 3450.08  
+*Want "KXBR -infinity / +infinity" 00000001 F8000001
+r 3460.08  
+*Want "KXBR -infinity / -QNaN"     00800003 F8008000
+r 3470.08  
+*Want "KXBR -infinity / +SNaN"     00800003 F8008000
+r 3480.08  
+*Want "KXBR -1 / -infinity"        00000002 F8000002
+r 3490.08  
+*Want "KXBR -1 / -1"               00000000 F8000000
+r 34A0.08  
+*Want "KXBR -1 / -0"               00000001 F8000001
+r 34B0.08  
+*Want "KXBR -1 / +0"               00000001 F8000001
+r 34C0.08  
+*Want "KXBR -1 / +1"               00000001 F8000001
+r 34D0.08  
+*Want "KXBR -1 / +infinity"        00000001 F8000001
+r 34E0.08  
+*Want "KXBR -1 / -QNaN"            00800003 F8008000
+r 34F0.08  
+*Want "KXBR -1 / +SNaN"            00800003 F8008000
+r 3500.08  
+*Want "KXBR -0 / -infinity"        00000002 F8000002
+r 3510.08  
+*Want "KXBR -0 / -1"               00000002 F8000002
+r 3520.08  
+*Want "KXBR -0 / -0"               00000000 F8000000
+r 3530.08  
+*Want "KXBR -0 / +0"               00000000 F8000000
+r 3540.08  
+*Want "KXBR -0 / +1"               00000001 F8000001
+r 3550.08  
+*Want "KXBR -0 / +infinity"        00000001 F8000001
+r 3560.08  
+*Want "KXBR -0 / -QNaN"            00800003 F8008000
+r 3570.08  
+*Want "KXBR -0 / +SNaN"            00800003 F8008000
+r 3580.08  
+*Want "KXBR +0 / -infinity"        00000002 F8000002
+r 3590.08  
+*Want "KXBR +0 / -1"               00000002 F8000002
+r 35A0.08  
+*Want "KXBR +0 / -0"               00000000 F8000000
+r 35B0.08  
+*Want "KXBR +0 / +0"               00000000 F8000000
+r 35C0.08  
+*Want "KXBR +0 / +1"               00000001 F8000001
+r 35D0.08  
+*Want "KXBR +0 / +infinity"        00000001 F8000001
+r 35E0.08  
+*Want "KXBR +0 / -QNaN"            00800003 F8008000
+r 35F0.08  
+*Want "KXBR +0 / +SNaN"            00800003 F8008000
+r 3600.08  
+*Want "KXBR +1 / -infinity"        00000002 F8000002
+r 3610.08  
+*Want "KXBR +1 / -1"               00000002 F8000002
+r 3620.08  
+*Want "KXBR +1 / -0"               00000002 F8000002
+r 3630.08  
+*Want "KXBR +1 / +0"               00000002 F8000002
+r 3640.08  
+*Want "KXBR +1 / +1"               00000000 F8000000
+r 3650.08  
+*Want "KXBR +1 / +infinity"        00000001 F8000001
+r 3660.08  
+*Want "KXBR +1 / -QNaN"            00800003 F8008000
+r 3670.08  
+*Want "KXBR +1 / +SNaN"            00800003 F8008000
+r 3680.08  
+*Want "KXBR +infinity / -infinity" 00000002 F8000002
+r 3690.08  
+*Want "KXBR +infinity / -1"        00000002 F8000002
+r 36A0.08  
+*Want "KXBR +infinity / -0"        00000002 F8000002
+r 36B0.08  
+*Want "KXBR +infinity / +0"        00000002 F8000002
+r 36C0.08  
+*Want "KXBR +infinity / +1"        00000002 F8000002
+r 36D0.08  
+*Want "KXBR +infinity / +infinity" 00000000 F8000000
+r 36E0.08  
+*Want "KXBR +infinity / -QNaN"     00800003 F8008000
+r 36F0.08  
+*Want "KXBR +infinity / +SNaN"     00800003 F8008000
+r 3700.08  
+*Want "KXBR -QNaN / -infinity"     00800003 F8008000
+r 3710.08  
+*Want "KXBR -QNaN / -1"            00800003 F8008000
+r 3720.08  
+*Want "KXBR -QNaN / -0"            00800003 F8008000
+r 3730.08  
+*Want "KXBR -QNaN / +0"            00800003 F8008000
+r 3740.08  
+*Want "KXBR -QNaN / +1"            00800003 F8008000
+r 3750.08  
+*Want "KXBR -QNaN / +infinity"     00800003 F8008000
+r 3760.08  
+*Want "KXBR -QNaN / -QNaN"         00800003 F8008000
+r 3770.08  
+*Want "KXBR -QNaN / +SNaN"         00800003 F8008000
+r 3780.08  
+*Want "KXBR +SNaN / -infinity"     00800003 F8008000
+r 3790.08  
+*Want "KXBR +SNaN / -1"            00800003 F8008000
+r 37A0.08  
+*Want "KXBR +SNaN / -0"            00800003 F8008000
+r 37B0.08  
+*Want "KXBR +SNaN / +0"            00800003 F8008000
+r 37C0.08  
+*Want "KXBR +SNaN / +1"            00800003 F8008000
+r 37D0.08  
+*Want "KXBR +SNaN / +infinity"     00800003 F8008000
+r 37E0.08  
+*Want "KXBR +SNaN / -QNaN"         00800003 F8008000
+r 37F0.08  
+*Want "KXBR +SNaN / +SNaN"         00800003 F8008000
+
+
+
+
+*Done
+
@@ -0,0 +1,1387 @@
+*Testcase bfp-014-divide.tst:     DEBR, DEB, DDBR, DDB, DXBR
+
+#Testcase bfp-014-divide.tst: IEEE Divide tests  DIVIDE (5)
+#..Test cases evaluate NaN propagation, NaN generation, operations
+#..using non-finite values, trappable and non-trappable IEEE
+#..exceptions, result scaling, and exhaustive rounding testing.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 165 program check messages that have no
+# value in the validation process.
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-014-divide.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Short BFP Non-finite test results
+*Compare
+r 1000.10  
+*Want "DEBR/DEB NF -inf/-inf"   7FC00000 FF800000 7FC00000 FF800000
+r 1010.10  
+*Want "DEBR/DEB NF -inf/-2"     7F800000 7F800000 7F800000 7F800000
+r 1020.10  
+*Want "DEBR/DEB NF -inf/-0"     7F800000 7F800000 7F800000 7F800000
+r 1030.10  
+*Want "DEBR/DEB NF -inf/+0"     FF800000 FF800000 FF800000 FF800000
+r 1040.10  
+*Want "DEBR/DEB NF -inf/+2"     FF800000 FF800000 FF800000 FF800000
+r 1050.10  
+*Want "DEBR/DEB NF -inf/+inf"   7FC00000 FF800000 7FC00000 FF800000
+r 1060.10  
+*Want "DEBR/DEB NF -inf/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1070.10  
+*Want "DEBR/DEB NF -inf/+SNaN"  7FCA0000 FF800000 7FCA0000 FF800000
+r 1080.10  
+*Want "DEBR/DEB NF -2/-inf"     00000000 00000000 00000000 00000000
+r 1090.10  
+*Want "DEBR/DEB NF -2/-2"       3F800000 3F800000 3F800000 3F800000
+r 10A0.10  
+*Want "DEBR/DEB NF -2/-0"       7F800000 C0000000 7F800000 C0000000
+r 10B0.10  
+*Want "DEBR/DEB NF -2/+0"       FF800000 C0000000 FF800000 C0000000
+r 10C0.10  
+*Want "DEBR/DEB NF -2/+2"       BF800000 BF800000 BF800000 BF800000
+r 10D0.10  
+*Want "DEBR/DEB NF -2/+inf"     80000000 80000000 80000000 80000000
+r 10E0.10  
+*Want "DEBR/DEB NF -2/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 10F0.10  
+*Want "DEBR/DEB NF -2/+SNaN"    7FCA0000 C0000000 7FCA0000 C0000000
+r 1100.10  
+*Want "DEBR/DEB NF -0/-inf"     00000000 00000000 00000000 00000000
+r 1110.10  
+*Want "DEBR/DEB NF -0/-2"       00000000 00000000 00000000 00000000
+r 1120.10  
+*Want "DEBR/DEB NF -0/-0"       7FC00000 80000000 7FC00000 80000000
+r 1130.10  
+*Want "DEBR/DEB NF -0/+0"       7FC00000 80000000 7FC00000 80000000
+r 1140.10  
+*Want "DEBR/DEB NF -0/+2"       80000000 80000000 80000000 80000000
+r 1150.10  
+*Want "DEBR/DEB NF -0/+inf"     80000000 80000000 80000000 80000000
+r 1160.10  
+*Want "DEBR/DEB NF -0/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1170.10  
+*Want "DEBR/DEB NF -0/+SNaN"    7FCA0000 80000000 7FCA0000 80000000
+r 1180.10  
+*Want "DEBR/DEB NF +0/-inf"     80000000 80000000 80000000 80000000
+r 1190.10  
+*Want "DEBR/DEB NF +0/-2"       80000000 80000000 80000000 80000000
+r 11A0.10  
+*Want "DEBR/DEB NF +0/-0"       7FC00000 00000000 7FC00000 00000000
+r 11B0.10  
+*Want "DEBR/DEB NF +0/+0"       7FC00000 00000000 7FC00000 00000000
+r 11C0.10  
+*Want "DEBR/DEB NF +0/+2"       00000000 00000000 00000000 00000000
+r 11D0.10  
+*Want "DEBR/DEB NF +0/+inf"     00000000 00000000 00000000 00000000
+r 11E0.10  
+*Want "DEBR/DEB NF +0/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 11F0.10  
+*Want "DEBR/DEB NF +0/+SNaN"    7FCA0000 00000000 7FCA0000 00000000
+r 1200.10  
+*Want "DEBR/DEB NF +2/-inf"     80000000 80000000 80000000 80000000
+r 1210.10  
+*Want "DEBR/DEB NF +2/-2"       BF800000 BF800000 BF800000 BF800000
+r 1220.10  
+*Want "DEBR/DEB NF +2/-0"       FF800000 40000000 FF800000 40000000
+r 1230.10  
+*Want "DEBR/DEB NF +2/+0"       7F800000 40000000 7F800000 40000000
+r 1240.10  
+*Want "DEBR/DEB NF +2/+2"       3F800000 3F800000 3F800000 3F800000
+r 1250.10  
+*Want "DEBR/DEB NF +2/+inf"     00000000 00000000 00000000 00000000
+r 1260.10  
+*Want "DEBR/DEB NF +2/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1270.10  
+*Want "DEBR/DEB NF +2/+SNaN"    7FCA0000 40000000 7FCA0000 40000000
+r 1280.10  
+*Want "DEBR/DEB NF +inf/-inf"   7FC00000 7F800000 7FC00000 7F800000
+r 1290.10  
+*Want "DEBR/DEB NF +inf/-2"     FF800000 FF800000 FF800000 FF800000
+r 12A0.10  
+*Want "DEBR/DEB NF +inf/-0"     FF800000 FF800000 FF800000 FF800000
+r 12B0.10  
+*Want "DEBR/DEB NF +inf/+0"     7F800000 7F800000 7F800000 7F800000
+r 12C0.10  
+*Want "DEBR/DEB NF +inf/+2"     7F800000 7F800000 7F800000 7F800000
+r 12D0.10  
+*Want "DEBR/DEB NF +inf/+inf"   7FC00000 7F800000 7FC00000 7F800000
+r 12E0.10  
+*Want "DEBR/DEB NF +inf/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 12F0.10  
+*Want "DEBR/DEB NF +inf/+SNaN"  7FCA0000 7F800000 7FCA0000 7F800000
+r 1300.10  
+*Want "DEBR/DEB NF -QNaN/-inf"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1310.10  
+*Want "DEBR/DEB NF -QNaN/-2"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1320.10  
+*Want "DEBR/DEB NF -QNaN/-0"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1330.10  
+*Want "DEBR/DEB NF -QNaN/+0"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1340.10  
+*Want "DEBR/DEB NF -QNaN/+2"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1350.10  
+*Want "DEBR/DEB NF -QNaN/+inf"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1360.10  
+*Want "DEBR/DEB NF -QNaN/-QNaN" FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1370.10  
+*Want "DEBR/DEB NF -QNaN/+SNaN" 7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 1380.10  
+*Want "DEBR/DEB NF +SNaN/-inf"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1390.10  
+*Want "DEBR/DEB NF +SNaN/-2"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13A0.10  
+*Want "DEBR/DEB NF +SNaN/-0"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13B0.10  
+*Want "DEBR/DEB NF +SNaN/+0"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13C0.10  
+*Want "DEBR/DEB NF +SNaN/+2"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13D0.10  
+*Want "DEBR/DEB NF +SNaN/+inf"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13E0.10  
+*Want "DEBR/DEB NF +SNaN/-QNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13F0.10  
+*Want "DEBR/DEB NF +SNaN/+SNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+
+
+# Short BFP Non-finite test results FPCR contents
+*Compare
+r 1400.10  
+*Want "DEBR/DEB NF -inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 1410.10  
+*Want "DEBR/DEB NF -inf/-2 FPCR"     00000000 F8000000 00000000 F8000000
+r 1420.10  
+*Want "DEBR/DEB NF -inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 1430.10  
+*Want "DEBR/DEB NF -inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 1440.10  
+*Want "DEBR/DEB NF -inf/+2 FPCR"     00000000 F8000000 00000000 F8000000
+r 1450.10  
+*Want "DEBR/DEB NF -inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 1460.10  
+*Want "DEBR/DEB NF -inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 1470.10  
+*Want "DEBR/DEB NF -inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 1480.10  
+*Want "DEBR/DEB NF -2/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1490.10  
+*Want "DEBR/DEB NF -2/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 14A0.10  
+*Want "DEBR/DEB NF -2/-0 FPCR"       00400000 F8004000 00400000 F8004000
+r 14B0.10  
+*Want "DEBR/DEB NF -2/+0 FPCR"       00400000 F8004000 00400000 F8004000
+r 14C0.10  
+*Want "DEBR/DEB NF -2/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 14D0.10  
+*Want "DEBR/DEB NF -2/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 14E0.10  
+*Want "DEBR/DEB NF -2/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 14F0.10  
+*Want "DEBR/DEB NF -2/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 1500.10  
+*Want "DEBR/DEB NF -0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1510.10  
+*Want "DEBR/DEB NF -0/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 1520.10  
+*Want "DEBR/DEB NF -0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 1530.10  
+*Want "DEBR/DEB NF -0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 1540.10  
+*Want "DEBR/DEB NF -0/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 1550.10  
+*Want "DEBR/DEB NF -0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1560.10  
+*Want "DEBR/DEB NF -0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 1570.10  
+*Want "DEBR/DEB NF -0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 1580.10  
+*Want "DEBR/DEB NF +0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1590.10  
+*Want "DEBR/DEB NF +0/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 15A0.10  
+*Want "DEBR/DEB NF +0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 15B0.10  
+*Want "DEBR/DEB NF +0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 15C0.10  
+*Want "DEBR/DEB NF +0/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 15D0.10  
+*Want "DEBR/DEB NF +0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 15E0.10  
+*Want "DEBR/DEB NF +0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 15F0.10  
+*Want "DEBR/DEB NF +0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 1600.10  
+*Want "DEBR/DEB NF +2/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1610.10  
+*Want "DEBR/DEB NF +2/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 1620.10  
+*Want "DEBR/DEB NF +2/-0 FPCR"       00400000 F8004000 00400000 F8004000
+r 1630.10  
+*Want "DEBR/DEB NF +2/+0 FPCR"       00400000 F8004000 00400000 F8004000
+r 1640.10  
+*Want "DEBR/DEB NF +2/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 1650.10  
+*Want "DEBR/DEB NF +2/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 1660.10  
+*Want "DEBR/DEB NF +2/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 1670.10  
+*Want "DEBR/DEB NF +2/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 1680.10  
+*Want "DEBR/DEB NF +inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 1690.10  
+*Want "DEBR/DEB NF +inf/-2 FPCR"     00000000 F8000000 00000000 F8000000
+r 16A0.10  
+*Want "DEBR/DEB NF +inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 16B0.10  
+*Want "DEBR/DEB NF +inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 16C0.10  
+*Want "DEBR/DEB NF +inf/+2 FPCR"     00000000 F8000000 00000000 F8000000
+r 16D0.10  
+*Want "DEBR/DEB NF +inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 16E0.10  
+*Want "DEBR/DEB NF +inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 16F0.10  
+*Want "DEBR/DEB NF +inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 1700.10  
+*Want "DEBR/DEB NF -QNaN/-inf FPCR"  00000000 F8000000 00000000 F8000000
+r 1710.10  
+*Want "DEBR/DEB NF -QNaN/-2 FPCR"    00000000 F8000000 00000000 F8000000
+r 1720.10  
+*Want "DEBR/DEB NF -QNaN/-0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1730.10  
+*Want "DEBR/DEB NF -QNaN/+0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1740.10  
+*Want "DEBR/DEB NF -QNaN/+2 FPCR"    00000000 F8000000 00000000 F8000000
+r 1750.10  
+*Want "DEBR/DEB NF -QNaN/+inf FPCR"  00000000 F8000000 00000000 F8000000
+r 1760.10  
+*Want "DEBR/DEB NF -QNaN/-QNaN FPCR" 00000000 F8000000 00000000 F8000000
+r 1770.10  
+*Want "DEBR/DEB NF -QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 1780.10  
+*Want "DEBR/DEB NF +SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r 1790.10  
+*Want "DEBR/DEB NF +SNaN/-2 FPCR"    00800000 F8008000 00800000 F8008000
+r 17A0.10  
+*Want "DEBR/DEB NF +SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r 17B0.10  
+*Want "DEBR/DEB NF +SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r 17C0.10  
+*Want "DEBR/DEB NF +SNaN/+2 FPCR"    00800000 F8008000 00800000 F8008000
+r 17D0.10  
+*Want "DEBR/DEB NF +SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r 17E0.10  
+*Want "DEBR/DEB NF +SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 17F0.10  
+*Want "DEBR/DEB NF +SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+
+
+# Short BFP finite test results
+*Compare
+r 1800.10
+*Want "DEBR/DEB max/min"   7F800000 69FFFFFF 7F800000 69FFFFFF
+r 1810.10
+*Want "DEBR/DEB min/2.0"   00400000 60000000 00400000 60000000
+r 1820.10
+*Want "DEBR/DEB 1.0/10.0"  3DCCCCCD 3DCCCCCD 3DCCCCCD 3DCCCCCD
+r 1830.10
+*Want "DEBR/DEB 7.0/10.0"  3E666666 3E666666 3E666666 3E666666
+r 1840.10
+*Want "DEBR/DEB 1.0/-10.0" BDCCCCCD BDCCCCCD BDCCCCCD BDCCCCCD
+r 1850.10
+*Want "DEBR/DEB 7.0/-10.0" BE666666 BE666666 BE666666 BE666666
+
+
+# Short BFP finite test results - FPCR contents
+*Compare
+r 1900.10
+*Want "DEBR/DEB max/min FPCR"   00280000 F8002000 00280000 F8002000
+r 1910.10
+*Want "DEBR/DEB min/2.0 FPCR"   00000000 F8001000 00000000 F8001000
+r 1920.10
+*Want "DEBR/DEB 1.0/10.0 FPCR"  00080000 F8000C00 00080000 F8000C00
+r 1930.10
+*Want "DEBR/DEB 7.0/10.0 FPCR"  00080000 F8000800 00080000 F8000800
+r 1940.10
+*Want "DEBR/DEB 1.0/-10.0 FPCR" 00080000 F8000C00 00080000 F8000C00
+r 1950.10
+*Want "DEBR/DEB 7.0/-10.0 FPCR" 00080000 F8000800 00080000 F8000800
+
+
+# Short BFP rounding mode test results 
+*Compare
+r 1A00.10  
+*Want "DEBR/DEB RM RNTE,RZ 1/10"  3DCCCCCD 3DCCCCCD 3DCCCCCC 3DCCCCCC
+r 1A10.10  
+*Want "DEBR/DEB RM RP,RM 1/10"    3DCCCCCD 3DCCCCCD 3DCCCCCC 3DCCCCCC
+r 1A20.08  
+*Want "DEBR/DEB RM RFS 1/10"      3DCCCCCD 3DCCCCCD
+r 1A30.10  
+*Want "DEBR/DEB RM RNTE,RZ 7/10"  3E666666 3E666666 3E666666 3E666666
+r 1A40.10  
+*Want "DEBR/DEB RM RP,RM 7/10"    3E666667 3E666667 3E666666 3E666666
+r 1A50.08  
+*Want "DEBR/DEB RM RFS 7/10"      3E666667 3E666667
+r 1A60.10  
+*Want "DEBR/DEB RM RNTE,RZ 1/-10" BDCCCCCD BDCCCCCD BDCCCCCC BDCCCCCC
+r 1A70.10  
+*Want "DEBR/DEB RM RP,RM 1/-10"   BDCCCCCC BDCCCCCC BDCCCCCD BDCCCCCD
+r 1A80.08  
+*Want "DEBR/DEB RM RFS 1/-10"     BDCCCCCD BDCCCCCD
+r 1A90.10  
+*Want "DEBR/DEB RM RNTE,RZ 7/-10" BE666666 BE666666 BE666666 BE666666
+r 1AA0.10
+*Want "DEBR/DEB RM RP,RM 7/-10"   BE666666 BE666666 BE666667 BE666667
+r 1AB0.08  
+*Want "DEBR/DEB RM RFS 7/-10"     BE666667 BE666667
+
+
+# Short BFP rounding mode test results - FPCR contents
+*Compare
+r 1D00.10  
+*Want "DEBR/DEB RM RNTE,RZ 1/10 FPCR"  00080000 00080000 00080001 00080001
+r 1D10.10  
+*Want "DEBR/DEB RM RP,RM 1/10 FPCR"    00080002 00080002 00080003 00080003
+r 1D20.08  
+*Want "DEBR/DEB RM RFS 1/10 FPCR"      00080007 00080007
+r 1D30.10  
+*Want "DEBR/DEB RM RNTE,RZ 7/10 FPCR"  00080000 00080000 00080001 00080001
+r 1D40.10  
+*Want "DEBR/DEB RM RP,RM 7/10 FPCR"    00080002 00080002 00080003 00080003
+r 1D50.08  
+*Want "DEBR/DEB RM RFS 7/10 FPCR"      00080007 00080007
+r 1D60.10  
+*Want "DEBR/DEB RM RNTE,RZ 1/-10 FPCR" 00080000 00080000 00080001 00080001
+r 1D70.10  
+*Want "DEBR/DEB RM RP,RM 1/-10 FPCR"   00080002 00080002 00080003 00080003
+r 1D80.08  
+*Want "DEBR/DEB RM RFS 1/-10 FPCR"     00080007 00080007
+r 1D90.10  
+*Want "DEBR/DEB RM RNTE,RZ 7/-10 FPCR" 00080000 00080000 00080001 00080001
+r 1DA0.10  
+*Want "DEBR/DEB RM RP,RM 7/-10 FPCR"   00080002 00080002 00080003 00080003
+r 1DB0.08  
+*Want "DEBR/DEB RM RFS 7/-10 FPCR"     00080007 00080007
+
+
+
+# Long BFP Non-finite test results
+*Compare
+r 3000.10  
+*Want "DDBR NF -inf/-inf"   7FF80000 00000000 FFF00000 00000000
+r 3010.10  
+*Want "DDB  NF -inf/-inf"   7FF80000 00000000 FFF00000 00000000
+r 3020.10  
+*Want "DDBR NF -inf/-2"     7FF00000 00000000 7FF00000 00000000
+r 3030.10  
+*Want "DDB  NF -inf/-2"     7FF00000 00000000 7FF00000 00000000
+r 3040.10  
+*Want "DDBR NF -inf/-0"     7FF00000 00000000 7FF00000 00000000
+r 3050.10  
+*Want "DDB  NF -inf/-0"     7FF00000 00000000 7FF00000 00000000
+r 3060.10  
+*Want "DDBR NF -inf/+0"     FFF00000 00000000 FFF00000 00000000
+r 3070.10  
+*Want "DDB  NF -inf/+0"     FFF00000 00000000 FFF00000 00000000
+r 3080.10  
+*Want "DDBR NF -inf/+2"     FFF00000 00000000 FFF00000 00000000
+r 3090.10  
+*Want "DDB  NF -inf/+2"     FFF00000 00000000 FFF00000 00000000
+r 30A0.10  
+*Want "DDBR NF -inf/+inf"   7FF80000 00000000 FFF00000 00000000
+r 30B0.10  
+*Want "DDB  NF -inf/+inf"   7FF80000 00000000 FFF00000 00000000
+r 30C0.10  
+*Want "DDBR NF -inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 30D0.10  
+*Want "DDB  NF -inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 30E0.10  
+*Want "DDBR NF -inf/+SNaN"  7FF8A000 00000000 FFF00000 00000000
+r 30F0.10  
+*Want "DDB  NF -inf/+SNaN"  7FF8A000 00000000 FFF00000 00000000
+r 3100.10  
+*Want "DDBR NF -2/-inf"     00000000 00000000 00000000 00000000
+r 3110.10  
+*Want "DDB  NF -2/-inf"     00000000 00000000 00000000 00000000
+r 3120.10  
+*Want "DDBR NF -2/-2"       3FF00000 00000000 3FF00000 00000000
+r 3130.10  
+*Want "DDB  NF -2/-2"       3FF00000 00000000 3FF00000 00000000
+r 3140.10  
+*Want "DDBR NF -2/-0"       7FF00000 00000000 C0000000 00000000
+r 3150.10  
+*Want "DDB  NF -2/-0"       7FF00000 00000000 C0000000 00000000
+r 3160.10  
+*Want "DDBR NF -2/+0"       FFF00000 00000000 C0000000 00000000
+r 3170.10  
+*Want "DDB  NF -2/+0"       FFF00000 00000000 C0000000 00000000
+r 3180.10  
+*Want "DDBR NF -2/+2"       BFF00000 00000000 BFF00000 00000000
+r 3190.10  
+*Want "DDB  NF -2/+2"       BFF00000 00000000 BFF00000 00000000
+r 31A0.10  
+*Want "DDBR NF -2/+inf"     80000000 00000000 80000000 00000000
+r 31B0.10  
+*Want "DDB  NF -2/+inf"     80000000 00000000 80000000 00000000
+r 31C0.10  
+*Want "DDBR NF -2/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 31D0.10  
+*Want "DDB  NF -2/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 31E0.10  
+*Want "DDBR NF -2/+SNaN"    7FF8A000 00000000 C0000000 00000000
+r 31F0.10  
+*Want "DDB  NF -2/+SNaN"    7FF8A000 00000000 C0000000 00000000
+r 3200.10  
+*Want "DDBR NF -0/-inf"     00000000 00000000 00000000 00000000
+r 3210.10  
+*Want "DDB  NF -0/-inf"     00000000 00000000 00000000 00000000
+r 3220.10  
+*Want "DDBR NF -0/-2"       00000000 00000000 00000000 00000000
+r 3230.10  
+*Want "DDB  NF -0/-2"       00000000 00000000 00000000 00000000
+r 3240.10  
+*Want "DDBR NF -0/-0"       7FF80000 00000000 80000000 00000000
+r 3250.10  
+*Want "DDB  NF -0/-0"       7FF80000 00000000 80000000 00000000
+r 3260.10  
+*Want "DDBR NF -0/+0"       7FF80000 00000000 80000000 00000000
+r 3270.10  
+*Want "DDB  NF -0/+0"       7FF80000 00000000 80000000 00000000
+r 3280.10  
+*Want "DDBR NF -0/+2"       80000000 00000000 80000000 00000000
+r 3290.10  
+*Want "DDB  NF -0/+2"       80000000 00000000 80000000 00000000
+r 32A0.10  
+*Want "DDBR NF -0/+inf"     80000000 00000000 80000000 00000000
+r 32B0.10  
+*Want "DDB  NF -0/+inf"     80000000 00000000 80000000 00000000
+r 32C0.10  
+*Want "DDBR NF -0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 32D0.10  
+*Want "DDB  NF -0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 32E0.10  
+*Want "DDBR NF -0/+SNaN"    7FF8A000 00000000 80000000 00000000
+r 32F0.10  
+*Want "DDB  NF -0/+SNaN"    7FF8A000 00000000 80000000 00000000
+r 3300.10  
+*Want "DDBR NF +0/-inf"     80000000 00000000 80000000 00000000
+r 3310.10  
+*Want "DDB  NF +0/-inf"     80000000 00000000 80000000 00000000
+r 3320.10  
+*Want "DDBR NF +0/-2"       80000000 00000000 80000000 00000000
+r 3330.10  
+*Want "DDB  NF +0/-2"       80000000 00000000 80000000 00000000
+r 3340.10  
+*Want "DDBR NF +0/-0"       7FF80000 00000000 00000000 00000000
+r 3350.10  
+*Want "DDB  NF +0/-0"       7FF80000 00000000 00000000 00000000
+r 3360.10  
+*Want "DDBR NF +0/+0"       7FF80000 00000000 00000000 00000000
+r 3370.10  
+*Want "DDB  NF +0/+0"       7FF80000 00000000 00000000 00000000
+r 3380.10  
+*Want "DDBR NF +0/+2"       00000000 00000000 00000000 00000000
+r 3390.10  
+*Want "DDB  NF +0/+2"       00000000 00000000 00000000 00000000
+r 33A0.10  
+*Want "DDBR NF +0/+inf"     00000000 00000000 00000000 00000000
+r 33B0.10  
+*Want "DDB  NF +0/+inf"     00000000 00000000 00000000 00000000
+r 33C0.10  
+*Want "DDBR NF +0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 33D0.10  
+*Want "DDB  NF +0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 33E0.10  
+*Want "DDBR NF +0/+SNaN"    7FF8A000 00000000 00000000 00000000
+r 33F0.10  
+*Want "DDB  NF +0/+SNaN"    7FF8A000 00000000 00000000 00000000
+r 3400.10  
+*Want "DDBR NF +2/-inf"     80000000 00000000 80000000 00000000
+r 3410.10  
+*Want "DDB  NF +2/-inf"     80000000 00000000 80000000 00000000
+r 3420.10  
+*Want "DDBR NF +2/-2"       BFF00000 00000000 BFF00000 00000000
+r 3430.10  
+*Want "DDB  NF +2/-2"       BFF00000 00000000 BFF00000 00000000
+r 3440.10  
+*Want "DDBR NF +2/-0"       FFF00000 00000000 40000000 00000000
+r 3450.10  
+*Want "DDB  NF +2/-0"       FFF00000 00000000 40000000 00000000
+r 3460.10  
+*Want "DDBR NF +2/+0"       7FF00000 00000000 40000000 00000000
+r 3470.10  
+*Want "DDB  NF +2/+0"       7FF00000 00000000 40000000 00000000
+r 3480.10  
+*Want "DDBR NF +2/+2"       3FF00000 00000000 3FF00000 00000000
+r 3490.10  
+*Want "DDB  NF +2/+2"       3FF00000 00000000 3FF00000 00000000
+r 34A0.10  
+*Want "DDBR NF +2/+inf"     00000000 00000000 00000000 00000000
+r 34B0.10  
+*Want "DDB  NF +2/+inf"     00000000 00000000 00000000 00000000
+r 34C0.10  
+*Want "DDBR NF +2/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 34D0.10  
+*Want "DDB  NF +2/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 34E0.10  
+*Want "DDBR NF +2/+SNaN"    7FF8A000 00000000 40000000 00000000
+r 34F0.10  
+*Want "DDB  NF +2/+SNaN"    7FF8A000 00000000 40000000 00000000
+r 3500.10  
+*Want "DDBR NF +inf/-inf"   7FF80000 00000000 7FF00000 00000000
+r 3510.10  
+*Want "DDB  NF +inf/-inf"   7FF80000 00000000 7FF00000 00000000
+r 3520.10  
+*Want "DDBR NF +inf/-2"     FFF00000 00000000 FFF00000 00000000
+r 3530.10  
+*Want "DDB  NF +inf/-2"     FFF00000 00000000 FFF00000 00000000
+r 3540.10  
+*Want "DDBR NF +inf/-0"     FFF00000 00000000 FFF00000 00000000
+r 3550.10  
+*Want "DDB  NF +inf/-0"     FFF00000 00000000 FFF00000 00000000
+r 3560.10  
+*Want "DDBR NF +inf/+0"     7FF00000 00000000 7FF00000 00000000
+r 3570.10  
+*Want "DDB  NF +inf/+0"     7FF00000 00000000 7FF00000 00000000
+r 3580.10  
+*Want "DDBR NF +inf/+2"     7FF00000 00000000 7FF00000 00000000
+r 3590.10  
+*Want "DDB  NF +inf/+2"     7FF00000 00000000 7FF00000 00000000
+r 35A0.10  
+*Want "DDBR NF +inf/+inf"   7FF80000 00000000 7FF00000 00000000
+r 35B0.10  
+*Want "DDB  NF +inf/+inf"   7FF80000 00000000 7FF00000 00000000
+r 35C0.10  
+*Want "DDBR NF +inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 35D0.10  
+*Want "DDB  NF +inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 35E0.10  
+*Want "DDBR NF +inf/+SNaN"  7FF8A000 00000000 7FF00000 00000000
+r 35F0.10  
+*Want "DDB  NF +inf/+SNaN"  7FF8A000 00000000 7FF00000 00000000
+r 3600.10  
+*Want "DDBR NF -QNaN/-inf"  FFF8B000 00000000 FFF8B000 00000000
+r 3610.10  
+*Want "DDB  NF -QNaN/-inf"  FFF8B000 00000000 FFF8B000 00000000
+r 3620.10  
+*Want "DDBR NF -QNaN/-2"    FFF8B000 00000000 FFF8B000 00000000
+r 3630.10  
+*Want "DDB  NF -QNaN/-2"    FFF8B000 00000000 FFF8B000 00000000
+r 3640.10  
+*Want "DDBR NF -QNaN/-0"    FFF8B000 00000000 FFF8B000 00000000
+r 3650.10  
+*Want "DDB  NF -QNaN/-0"    FFF8B000 00000000 FFF8B000 00000000
+r 3660.10  
+*Want "DDBR NF -QNaN/+0"    FFF8B000 00000000 FFF8B000 00000000
+r 3670.10  
+*Want "DDB  NF -QNaN/+0"    FFF8B000 00000000 FFF8B000 00000000
+r 3680.10  
+*Want "DDBR NF -QNaN/+2"    FFF8B000 00000000 FFF8B000 00000000
+r 3690.10  
+*Want "DDB  NF -QNaN/+2"    FFF8B000 00000000 FFF8B000 00000000
+r 36A0.10  
+*Want "DDBR NF -QNaN/+inf"  FFF8B000 00000000 FFF8B000 00000000
+r 36B0.10  
+*Want "DDB  NF -QNaN/+inf"  FFF8B000 00000000 FFF8B000 00000000
+r 36C0.10  
+*Want "DDBR NF -QNaN/-QNaN" FFF8B000 00000000 FFF8B000 00000000
+r 36D0.10  
+*Want "DDB  NF -QNaN/-QNaN" FFF8B000 00000000 FFF8B000 00000000
+r 36E0.10  
+*Want "DDBR NF -QNaN/+SNaN" 7FF8A000 00000000 FFF8B000 00000000
+r 36F0.10  
+*Want "DDB  NF -QNaN/+SNaN" 7FF8A000 00000000 FFF8B000 00000000
+r 3700.10  
+*Want "DDBR NF +SNaN/-inf"  7FF8A000 00000000 7FF0A000 00000000
+r 3710.10  
+*Want "DDB  NF +SNaN/-inf"  7FF8A000 00000000 7FF0A000 00000000
+r 3720.10  
+*Want "DDBR NF +SNaN/-2"    7FF8A000 00000000 7FF0A000 00000000
+r 3730.10  
+*Want "DDB  NF +SNaN/-2"    7FF8A000 00000000 7FF0A000 00000000
+r 3740.10  
+*Want "DDBR NF +SNaN/-0"    7FF8A000 00000000 7FF0A000 00000000
+r 3750.10  
+*Want "DDB  NF +SNaN/-0"    7FF8A000 00000000 7FF0A000 00000000
+r 3760.10  
+*Want "DDBR NF +SNaN/+0"    7FF8A000 00000000 7FF0A000 00000000
+r 3770.10  
+*Want "DDB  NF +SNaN/+0"    7FF8A000 00000000 7FF0A000 00000000
+r 3780.10  
+*Want "DDBR NF +SNaN/+2"    7FF8A000 00000000 7FF0A000 00000000
+r 3790.10  
+*Want "DDB  NF +SNaN/+2"    7FF8A000 00000000 7FF0A000 00000000
+r 37A0.10  
+*Want "DDBR NF +SNaN/+inf"  7FF8A000 00000000 7FF0A000 00000000
+r 37B0.10  
+*Want "DDB  NF +SNaN/+inf"  7FF8A000 00000000 7FF0A000 00000000
+r 37C0.10  
+*Want "DDBR NF +SNaN/-QNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 37D0.10  
+*Want "DDB  NF +SNaN/-QNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 37E0.10  
+*Want "DDBR NF +SNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 37F0.10  
+*Want "DDB  NF +SNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+
+
+# Long BFP Non-finite test results FPCR contents
+*Compare
+r 3800.10  
+*Want "DDBR/DDB NF -inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3810.10  
+*Want "DDBR/DDB NF -inf/-2 FPCR"     00000000 F8000000 00000000 F8000000
+r 3820.10  
+*Want "DDBR/DDB NF -inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3830.10  
+*Want "DDBR/DDB NF -inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3840.10  
+*Want "DDBR/DDB NF -inf/+2 FPCR"     00000000 F8000000 00000000 F8000000
+r 3850.10  
+*Want "DDBR/DDB NF -inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3860.10  
+*Want "DDBR/DDB NF -inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 3870.10  
+*Want "DDBR/DDB NF -inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3880.10  
+*Want "DDBR/DDB NF -2/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3890.10  
+*Want "DDBR/DDB NF -2/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 38A0.10  
+*Want "DDBR/DDB NF -2/-0 FPCR"       00400000 F8004000 00400000 F8004000
+r 38B0.10  
+*Want "DDBR/DDB NF -2/+0 FPCR"       00400000 F8004000 00400000 F8004000
+r 38C0.10  
+*Want "DDBR/DDB NF -2/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 38D0.10  
+*Want "DDBR/DDB NF -2/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 38E0.10  
+*Want "DDBR/DDB NF -2/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 38F0.10  
+*Want "DDBR/DDB NF -2/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3900.10  
+*Want "DDBR/DDB NF -0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3910.10  
+*Want "DDBR/DDB NF -0/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 3920.10  
+*Want "DDBR/DDB NF -0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3930.10  
+*Want "DDBR/DDB NF -0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3940.10  
+*Want "DDBR/DDB NF -0/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 3950.10  
+*Want "DDBR/DDB NF -0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3960.10  
+*Want "DDBR/DDB NF -0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 3970.10  
+*Want "DDBR/DDB NF -0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3980.10  
+*Want "DDBR/DDB NF +0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3990.10  
+*Want "DDBR/DDB NF +0/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 39A0.10  
+*Want "DDBR/DDB NF +0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 39B0.10  
+*Want "DDBR/DDB NF +0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 39C0.10  
+*Want "DDBR/DDB NF +0/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 39D0.10  
+*Want "DDBR/DDB NF +0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 39E0.10  
+*Want "DDBR/DDB NF +0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 39F0.10  
+*Want "DDBR/DDB NF +0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3A00.10  
+*Want "DDBR/DDB NF +2/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3A10.10  
+*Want "DDBR/DDB NF +2/-2 FPCR"       00000000 F8000000 00000000 F8000000
+r 3A20.10  
+*Want "DDBR/DDB NF +2/-0 FPCR"       00400000 F8004000 00400000 F8004000
+r 3A30.10  
+*Want "DDBR/DDB NF +2/+0 FPCR"       00400000 F8004000 00400000 F8004000
+r 3A40.10  
+*Want "DDBR/DDB NF +2/+2 FPCR"       00000000 F8000000 00000000 F8000000
+r 3A50.10  
+*Want "DDBR/DDB NF +2/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3A60.10  
+*Want "DDBR/DDB NF +2/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 3A70.10  
+*Want "DDBR/DDB NF +2/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3A80.10  
+*Want "DDBR/DDB NF +inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3A90.10  
+*Want "DDBR/DDB NF +inf/-2 FPCR"     00000000 F8000000 00000000 F8000000
+r 3AA0.10  
+*Want "DDBR/DDB NF +inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3AB0.10  
+*Want "DDBR/DDB NF +inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3AC0.10  
+*Want "DDBR/DDB NF +inf/+2 FPCR"     00000000 F8000000 00000000 F8000000
+r 3AD0.10  
+*Want "DDBR/DDB NF +inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3AE0.10  
+*Want "DDBR/DDB NF +inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 3AF0.10  
+*Want "DDBR/DDB NF +inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3B00.10  
+*Want "DDBR/DDB NF -QNaN/-inf FPCR"  00000000 F8000000 00000000 F8000000
+r 3B10.10  
+*Want "DDBR/DDB NF -QNaN/-2 FPCR"    00000000 F8000000 00000000 F8000000
+r 3B20.10  
+*Want "DDBR/DDB NF -QNaN/-0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3B30.10  
+*Want "DDBR/DDB NF -QNaN/+0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3B40.10  
+*Want "DDBR/DDB NF -QNaN/+2 FPCR"    00000000 F8000000 00000000 F8000000
+r 3B50.10  
+*Want "DDBR/DDB NF -QNaN/+inf FPCR"  00000000 F8000000 00000000 F8000000
+r 3B60.10  
+*Want "DDBR/DDB NF -QNaN/-QNaN FPCR" 00000000 F8000000 00000000 F8000000
+r 3B70.10  
+*Want "DDBR/DDB NF -QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 3B80.10  
+*Want "DDBR/DDB NF +SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r 3B90.10  
+*Want "DDBR/DDB NF +SNaN/-2 FPCR"    00800000 F8008000 00800000 F8008000
+r 3BA0.10  
+*Want "DDBR/DDB NF +SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r 3BB0.10  
+*Want "DDBR/DDB NF +SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r 3BC0.10  
+*Want "DDBR/DDB NF +SNaN/+2 FPCR"    00800000 F8008000 00800000 F8008000
+r 3BD0.10  
+*Want "DDBR/DDB NF +SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r 3BE0.10  
+*Want "DDBR/DDB NF +SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 3BF0.10  
+*Want "DDBR/DDB NF +SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+
+
+r 3C00.10
+*Want "DDBR max/min"   7FF00000 00000000 630FFFFF FFFFFFFF
+r 3C10.10
+*Want "DDB max/min"    7FF00000 00000000 630FFFFF FFFFFFFF
+r 3C20.10
+*Want "DDBR min/2.0"   00080000 00000000 60000000 00000000
+r 3C30.10
+*Want "DDB min/2.0"    00080000 00000000 60000000 00000000
+r 3C40.10
+*Want "DDBR 1.0/10.0"  3FB99999 9999999A 3FB99999 9999999A
+r 3C50.10
+*Want "DDB 1.0/10.0"   3FB99999 9999999A 3FB99999 9999999A
+r 3C60.10
+*Want "DDBR 7.0/10.0"  3FE66666 66666666 3FE66666 66666666
+r 3C70.10
+*Want "DDB 7.0/10.0"   3FE66666 66666666 3FE66666 66666666
+r 3C80.10
+*Want "DDBR 1.0/-10.0" BFB99999 9999999A BFB99999 9999999A
+r 3C90.10
+*Want "DDB 1.0/-10.0"  BFB99999 9999999A BFB99999 9999999A
+r 3CA0.10
+*Want "DDBR 7.0/-10.0" BFE66666 66666666 BFE66666 66666666
+r 3CB0.10
+*Want "DDB 7.0/-10.0"  BFE66666 66666666 BFE66666 66666666
+
+
+# Long BFP finite test results - FPCR contents
+*Compare
+r 3E00.10
+*Want "DDBR/DDB max/min FPCR"   00280000 F8002000 00280000 F8002000
+r 3E10.10
+*Want "DDBR/DDB min/2.0 FPCR"   00000000 F8001000 00000000 F8001000
+r 3E20.10
+*Want "DDBR/DDB 1.0/10.0 FPCR"  00080000 F8000C00 00080000 F8000C00
+r 3E30.10
+*Want "DDBR/DDB 7.0/10.0 FPCR"  00080000 F8000800 00080000 F8000800
+r 3E40.10
+*Want "DDBR/DDB 1.0/-10.0 FPCR" 00080000 F8000C00 00080000 F8000C00
+r 3E50.10
+*Want "DDBR/DDB 7.0/-10.0 FPCR" 00080000 F8000800 00080000 F8000800
+
+
+# Long BFP rounding mode test results
+*Compare
+r 4000.10  
+*Want "DDBR/DDB RM RNTE 1/10"  3FB99999 9999999A 3FB99999 9999999A
+r 4010.10  
+*Want "DDBR/DDB RM RZ 1/10"    3FB99999 99999999 3FB99999 99999999
+r 4020.10  
+*Want "DDBR/DDB RM RP 1/10"    3FB99999 9999999A 3FB99999 9999999A
+r 4030.10  
+*Want "DDBR/DDB RM RM 1/10"    3FB99999 99999999 3FB99999 99999999
+r 4040.10  
+*Want "DDBR/DDB RM RFS 1/10"   3FB99999 99999999 3FB99999 99999999
+r 4050.10  
+*Want "DDBR/DDB RM RNTE 7/10"  3FE66666 66666666 3FE66666 66666666
+r 4060.10  
+*Want "DDBR/DDB RM RZ 7/10"    3FE66666 66666666 3FE66666 66666666
+r 4070.10  
+*Want "DDBR/DDB RM RP 7/10"    3FE66666 66666667 3FE66666 66666667
+r 4080.10  
+*Want "DDBR/DDB RM RM 7/10"    3FE66666 66666666 3FE66666 66666666
+r 4090.10  
+*Want "DDBR/DDB RM RFS 7/10"   3FE66666 66666667 3FE66666 66666667
+r 40A0.10  
+*Want "DDBR/DDB RM RNTE 1/-10" BFB99999 9999999A BFB99999 9999999A
+r 40B0.10  
+*Want "DDBR/DDB RM RZ 1/-10"   BFB99999 99999999 BFB99999 99999999
+r 40C0.10  
+*Want "DDBR/DDB RM RP 1/-10"   BFB99999 99999999 BFB99999 99999999
+r 40D0.10  
+*Want "DDBR/DDB RM RM 1/-10"   BFB99999 9999999A BFB99999 9999999A
+r 40E0.10  
+*Want "DDBR/DDB RM RFS 1/-10"  BFB99999 99999999 BFB99999 99999999
+r 40F0.10  
+*Want "DDBR/DDB RM RNTE 7/-10" BFE66666 66666666 BFE66666 66666666
+r 4100.10  
+*Want "DDBR/DDB RM RZ 7/-10"   BFE66666 66666666 BFE66666 66666666
+r 4110.10  
+*Want "DDBR/DDB RM RP 7/-10"   BFE66666 66666666 BFE66666 66666666
+r 4120.10  
+*Want "DDBR/DDB RM RM 7/-10"   BFE66666 66666667 BFE66666 66666667
+r 4130.10  
+*Want "DDBR/DDB RM RFS 7/-10"  BFE66666 66666667 BFE66666 66666667
+
+
+
+# Long BFP rounding mode test results - FPCR contents
+*Compare
+r 4500.10  
+*Want "DDBR/DDB RM RNTE,RZ 1/10 FPCR"  00080000 00080000 00080001 00080001
+r 4510.10  
+*Want "DDBR/DDB RM RP,RM 1/10 FPCR"    00080002 00080002 00080003 00080003
+r 4520.08  
+*Want "DDBR/DDB RM RFS 1/10 FPCR"      00080007 00080007
+r 4530.10  
+*Want "DDBR/DDB RM RNTE,RZ 7/10 FPCR"  00080000 00080000 00080001 00080001
+r 4540.10  
+*Want "DDBR/DDB RM RP,RM 7/10 FPCR"    00080002 00080002 00080003 00080003
+r 4550.08  
+*Want "DDBR/DDB RM RFS 7/10 FPCR"      00080007 00080007
+r 4560.10  
+*Want "DDBR/DDB RM RNTE,RZ 1/-10 FPCR" 00080000 00080000 00080001 00080001
+r 4570.10  
+*Want "DDBR/DDB RM RP,RM 1/-10 FPCR"   00080002 00080002 00080003 00080003
+r 4580.08  
+*Want "DDBR/DDB RM RFS 1/-10 FPCR"     00080007 00080007
+r 4590.10  
+*Want "DDBR/DDB RM RNTE,RZ 7/-10 FPCR" 00080000 00080000 00080001 00080001
+r 45A0.10  
+*Want "DDBR/DDB RM RP,RM 7/-10 FPCR"   00080002 00080002 00080003 00080003
+r 45B0.08  
+*Want "DDBR/DDB RM RFS 7/-10 FPCR"     00080007 00080007
+
+# Extended BFP Non-finite test results
+*Compare
+r 5000.10  
+*Want "DXBR NT NF -inf/-inf"   7FFF8000 00000000 00000000 00000000
+r 5010.10  
+*Want "DXBR Tr NF -inf/-inf"   FFFF0000 00000000 00000000 00000000
+r 5020.10  
+*Want "DXBR NT NF -inf/-2"     7FFF0000 00000000 00000000 00000000
+r 5030.10  
+*Want "DXBR Tr NF -inf/-2"     7FFF0000 00000000 00000000 00000000
+r 5040.10  
+*Want "DXBR NT NF -inf/-0"     7FFF0000 00000000 00000000 00000000
+r 5050.10  
+*Want "DXBR Tr NF -inf/-0"     7FFF0000 00000000 00000000 00000000
+r 5060.10  
+*Want "DXBR NT NF -inf/+0"     FFFF0000 00000000 00000000 00000000
+r 5070.10  
+*Want "DXBR Tr NF -inf/+0"     FFFF0000 00000000 00000000 00000000
+r 5080.10  
+*Want "DXBR NT NF -inf/+2"     FFFF0000 00000000 00000000 00000000
+r 5090.10  
+*Want "DXBR Tr NF -inf/+2"     FFFF0000 00000000 00000000 00000000
+r 50A0.10  
+*Want "DXBR NT NF -inf/+inf"   7FFF8000 00000000 00000000 00000000
+r 50B0.10  
+*Want "DXBR Tr NF -inf/+inf"   FFFF0000 00000000 00000000 00000000
+r 50C0.10  
+*Want "DXBR NT NF -inf/-QNaN"  FFFF8B00 00000000 00000000 00000000
+r 50D0.10  
+*Want "DXBR Tr NF -inf/-QNaN"  FFFF8B00 00000000 00000000 00000000
+r 50E0.10  
+*Want "DXBR NT NF -inf/+SNaN"  7FFF8A00 00000000 00000000 00000000
+r 50F0.10  
+*Want "DXBR Tr NF -inf/+SNaN"  FFFF0000 00000000 00000000 00000000
+r 5100.10  
+*Want "DXBR NT NF -2/-inf"     00000000 00000000 00000000 00000000
+r 5110.10  
+*Want "DXBR Tr NF -2/-inf"     00000000 00000000 00000000 00000000
+r 5120.10  
+*Want "DXBR NT NF -2/-2"       3FFF0000 00000000 00000000 00000000
+r 5130.10  
+*Want "DXBR Tr NF -2/-2"       3FFF0000 00000000 00000000 00000000
+r 5140.10  
+*Want "DXBR NT NF -2/-0"       7FFF0000 00000000 00000000 00000000
+r 5150.10  
+*Want "DXBR Tr NF -2/-0"       C0000000 00000000 00000000 00000000
+r 5160.10  
+*Want "DXBR NT NF -2/+0"       FFFF0000 00000000 00000000 00000000
+r 5170.10  
+*Want "DXBR Tr NF -2/+0"       C0000000 00000000 00000000 00000000
+r 5180.10  
+*Want "DXBR NT NF -2/+2"       BFFF0000 00000000 00000000 00000000
+r 5190.10  
+*Want "DXBR Tr NF -2/+2"       BFFF0000 00000000 00000000 00000000
+r 51A0.10  
+*Want "DXBR NT NF -2/+inf"     80000000 00000000 00000000 00000000
+r 51B0.10  
+*Want "DXBR Tr NF -2/+inf"     80000000 00000000 00000000 00000000
+r 51C0.10  
+*Want "DXBR NT NF -2/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 51D0.10  
+*Want "DXBR Tr NF -2/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 51E0.10  
+*Want "DXBR NT NF -2/+SNaN"    7FFF8A00 00000000 00000000 00000000
+r 51F0.10  
+*Want "DXBR Tr NF -2/+SNaN"    C0000000 00000000 00000000 00000000
+r 5200.10  
+*Want "DXBR NT NF -0/-inf"     00000000 00000000 00000000 00000000
+r 5210.10  
+*Want "DXBR Tr NF -0/-inf"     00000000 00000000 00000000 00000000
+r 5220.10  
+*Want "DXBR NT NF -0/-2"       00000000 00000000 00000000 00000000
+r 5230.10  
+*Want "DXBR Tr NF -0/-2"       00000000 00000000 00000000 00000000
+r 5240.10  
+*Want "DXBR NT NF -0/-0"       7FFF8000 00000000 00000000 00000000
+r 5250.10  
+*Want "DXBR Tr NF -0/-0"       80000000 00000000 00000000 00000000
+r 5260.10  
+*Want "DXBR NT NF -0/+0"       7FFF8000 00000000 00000000 00000000
+r 5270.10  
+*Want "DXBR Tr NF -0/+0"       80000000 00000000 00000000 00000000
+r 5280.10  
+*Want "DXBR NT NF -0/+2"       80000000 00000000 00000000 00000000
+r 5290.10  
+*Want "DXBR Tr NF -0/+2"       80000000 00000000 00000000 00000000
+r 52A0.10  
+*Want "DXBR NT NF -0/+inf"     80000000 00000000 00000000 00000000
+r 52B0.10  
+*Want "DXBR Tr NF -0/+inf"     80000000 00000000 00000000 00000000
+r 52C0.10  
+*Want "DXBR NT NF -0/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 52D0.10  
+*Want "DXBR Tr NF -0/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 52E0.10  
+*Want "DXBR NT NF -0/+SNaN"    7FFF8A00 00000000 00000000 00000000
+r 52F0.10  
+*Want "DXBR Tr NF -0/+SNaN"    80000000 00000000 00000000 00000000
+r 5300.10  
+*Want "DXBR NT NF +0/-inf"     80000000 00000000 00000000 00000000
+r 5310.10  
+*Want "DXBR Tr NF +0/-inf"     80000000 00000000 00000000 00000000
+r 5320.10  
+*Want "DXBR NT NF +0/-2"       80000000 00000000 00000000 00000000
+r 5330.10  
+*Want "DXBR Tr NF +0/-2"       80000000 00000000 00000000 00000000
+r 5340.10  
+*Want "DXBR NT NF +0/-0"       7FFF8000 00000000 00000000 00000000
+r 5350.10  
+*Want "DXBR Tr NF +0/-0"       00000000 00000000 00000000 00000000
+r 5360.10  
+*Want "DXBR NT NF +0/+0"       7FFF8000 00000000 00000000 00000000
+r 5370.10  
+*Want "DXBR Tr NF +0/+0"       00000000 00000000 00000000 00000000
+r 5380.10  
+*Want "DXBR NT NF +0/+2"       00000000 00000000 00000000 00000000
+r 5390.10  
+*Want "DXBR Tr NF +0/+2"       00000000 00000000 00000000 00000000
+r 53A0.10  
+*Want "DXBR NT NF +0/+inf"     00000000 00000000 00000000 00000000
+r 53B0.10  
+*Want "DXBR Tr NF +0/+inf"     00000000 00000000 00000000 00000000
+r 53C0.10  
+*Want "DXBR NT NF +0/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 53D0.10  
+*Want "DXBR Tr NF +0/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 53E0.10  
+*Want "DXBR NT NF +0/+SNaN"    7FFF8A00 00000000 00000000 00000000
+r 53F0.10  
+*Want "DXBR Tr NF +0/+SNaN"    00000000 00000000 00000000 00000000
+r 5400.10  
+*Want "DXBR NT NF +2/-inf"     80000000 00000000 00000000 00000000
+r 5410.10  
+*Want "DXBR Tr NF +2/-inf"     80000000 00000000 00000000 00000000
+r 5420.10  
+*Want "DXBR NT NF +2/-2"       BFFF0000 00000000 00000000 00000000
+r 5430.10  
+*Want "DXBR Tr NF +2/-2"       BFFF0000 00000000 00000000 00000000
+r 5440.10  
+*Want "DXBR NT NF +2/-0"       FFFF0000 00000000 00000000 00000000
+r 5450.10  
+*Want "DXBR Tr NF +2/-0"       40000000 00000000 00000000 00000000
+r 5460.10  
+*Want "DXBR NT NF +2/+0"       7FFF0000 00000000 00000000 00000000
+r 5470.10  
+*Want "DXBR Tr NF +2/+0"       40000000 00000000 00000000 00000000
+r 5480.10  
+*Want "DXBR NT NF +2/+2"       3FFF0000 00000000 00000000 00000000
+r 5490.10  
+*Want "DXBR Tr NF +2/+2"       3FFF0000 00000000 00000000 00000000
+r 54A0.10  
+*Want "DXBR NT NF +2/+inf"     00000000 00000000 00000000 00000000
+r 54B0.10  
+*Want "DXBR Tr NF +2/+inf"     00000000 00000000 00000000 00000000
+r 54C0.10  
+*Want "DXBR NT NF +2/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 54D0.10  
+*Want "DXBR Tr NF +2/-QNaN"    FFFF8B00 00000000 00000000 00000000
+r 54E0.10  
+*Want "DXBR NT NF +2/+SNaN"    7FFF8A00 00000000 00000000 00000000
+r 54F0.10  
+*Want "DXBR Tr NF +2/+SNaN"    40000000 00000000 00000000 00000000
+r 5500.10  
+*Want "DXBR NT NF +inf/-inf"   7FFF8000 00000000 00000000 00000000
+r 5510.10  
+*Want "DXBR Tr NF +inf/-inf"   7FFF0000 00000000 00000000 00000000
+r 5520.10  
+*Want "DXBR NT NF +inf/-2"     FFFF0000 00000000 00000000 00000000
+r 5530.10  
+*Want "DXBR Tr NF +inf/-2"     FFFF0000 00000000 00000000 00000000
+r 5540.10  
+*Want "DXBR NT NF +inf/-0"     FFFF0000 00000000 00000000 00000000
+r 5550.10  
+*Want "DXBR Tr NF +inf/-0"     FFFF0000 00000000 00000000 00000000
+r 5560.10  
+*Want "DXBR NT NF +inf/+0"     7FFF0000 00000000 00000000 00000000
+r 5570.10  
+*Want "DXBR Tr NF +inf/+0"     7FFF0000 00000000 00000000 00000000
+r 5580.10  
+*Want "DXBR NT NF +inf/+2"     7FFF0000 00000000 00000000 00000000
+r 5590.10  
+*Want "DXBR Tr NF +inf/+2"     7FFF0000 00000000 00000000 00000000
+r 55A0.10  
+*Want "DXBR NT NF +inf/+inf"   7FFF8000 00000000 00000000 00000000
+r 55B0.10  
+*Want "DXBR Tr NF +inf/+inf"   7FFF0000 00000000 00000000 00000000
+r 55C0.10  
+*Want "DXBR NT NF +inf/-QNaN"  FFFF8B00 00000000 00000000 00000000
+r 55D0.10  
+*Want "DXBR Tr NF +inf/-QNaN"  FFFF8B00 00000000 00000000 00000000
+r 55E0.10  
+*Want "DXBR NT NF +inf/+SNaN"  7FFF8A00 00000000 00000000 00000000
+r 55F0.10  
+*Want "DXBR Tr NF +inf/+SNaN"  7FFF0000 00000000 00000000 00000000
+r 5600.10  
+*Want "DXBR NT NF -QNaN/-inf"  FFFF8B00 00000000 00000000 00000000
+r 5610.10  
+*Want "DXBR Tr NF -QNaN/-inf"  FFFF8B00 00000000 00000000 00000000
+r 5620.10  
+*Want "DXBR NT NF -QNaN/-2"    FFFF8B00 00000000 00000000 00000000
+r 5630.10  
+*Want "DXBR Tr NF -QNaN/-2"    FFFF8B00 00000000 00000000 00000000
+r 5640.10  
+*Want "DXBR NT NF -QNaN/-0"    FFFF8B00 00000000 00000000 00000000
+r 5650.10  
+*Want "DXBR Tr NF -QNaN/-0"    FFFF8B00 00000000 00000000 00000000
+r 5660.10  
+*Want "DXBR NT NF -QNaN/+0"    FFFF8B00 00000000 00000000 00000000
+r 5670.10  
+*Want "DXBR Tr NF -QNaN/+0"    FFFF8B00 00000000 00000000 00000000
+r 5680.10  
+*Want "DXBR NT NF -QNaN/+2"    FFFF8B00 00000000 00000000 00000000
+r 5690.10  
+*Want "DXBR Tr NF -QNaN/+2"    FFFF8B00 00000000 00000000 00000000
+r 56A0.10  
+*Want "DXBR NT NF -QNaN/+inf"  FFFF8B00 00000000 00000000 00000000
+r 56B0.10  
+*Want "DXBR Tr NF -QNaN/+inf"  FFFF8B00 00000000 00000000 00000000
+r 56C0.10  
+*Want "DXBR NT NF -QNaN/-QNaN" FFFF8B00 00000000 00000000 00000000
+r 56D0.10  
+*Want "DXBR Tr NF -QNaN/-QNaN" FFFF8B00 00000000 00000000 00000000
+r 56E0.10  
+*Want "DXBR NT NF -QNaN/+SNaN" 7FFF8A00 00000000 00000000 00000000
+r 56F0.10  
+*Want "DXBR Tr NF -QNaN/+SNaN" FFFF8B00 00000000 00000000 00000000
+r 5700.10  
+*Want "DXBR NT NF +SNaN/-inf"  7FFF8A00 00000000 00000000 00000000
+r 5710.10  
+*Want "DXBR Tr NF +SNaN/-inf"  7FFF0A00 00000000 00000000 00000000
+r 5720.10  
+*Want "DXBR NT NF +SNaN/-2"    7FFF8A00 00000000 00000000 00000000
+r 5730.10  
+*Want "DXBR Tr NF +SNaN/-2"    7FFF0A00 00000000 00000000 00000000
+r 5740.10  
+*Want "DXBR NT NF +SNaN/-0"    7FFF8A00 00000000 00000000 00000000
+r 5750.10  
+*Want "DXBR Tr NF +SNaN/-0"    7FFF0A00 00000000 00000000 00000000
+r 5760.10  
+*Want "DXBR NT NF +SNaN/+0"    7FFF8A00 00000000 00000000 00000000
+r 5770.10  
+*Want "DXBR Tr NF +SNaN/+0"    7FFF0A00 00000000 00000000 00000000
+r 5780.10  
+*Want "DXBR NT NF +SNaN/+2"    7FFF8A00 00000000 00000000 00000000
+r 5790.10  
+*Want "DXBR Tr NF +SNaN/+2"    7FFF0A00 00000000 00000000 00000000
+r 57A0.10  
+*Want "DXBR NT NF +SNaN/+inf"  7FFF8A00 00000000 00000000 00000000
+r 57B0.10  
+*Want "DXBR Tr NF +SNaN/+inf"  7FFF0A00 00000000 00000000 00000000
+r 57C0.10  
+*Want "DXBR NT NF +SNaN/-QNaN" 7FFF8A00 00000000 00000000 00000000
+r 57D0.10  
+*Want "DXBR Tr NF +SNaN/-QNaN" 7FFF0A00 00000000 00000000 00000000
+r 57E0.10  
+*Want "DXBR NT NF +SNaN/+SNaN" 7FFF8A00 00000000 00000000 00000000
+r 57F0.10  
+*Want "DXBR Tr NF +SNaN/+SNaN" 7FFF0A00 00000000 00000000 00000000
+
+
+
+# Extended BFP Non-finite test results FPCR contents
+*Compare
+r 5800.08  
+*Want "DXBR NF -inf/-inf FPCR"   00800000 F8008000
+r 5810.08  
+*Want "DXBR NF -inf/-2 FPCR"     00000000 F8000000
+r 5820.08  
+*Want "DXBR NF -inf/-0 FPCR"     00000000 F8000000
+r 5830.08  
+*Want "DXBR NF -inf/+0 FPCR"     00000000 F8000000
+r 5840.08  
+*Want "DXBR NF -inf/+2 FPCR"     00000000 F8000000
+r 5850.08  
+*Want "DXBR NF -inf/+inf FPCR"   00800000 F8008000
+r 5860.08  
+*Want "DXBR NF -inf/-QNaN FPCR"  00000000 F8000000
+r 5870.08  
+*Want "DXBR NF -inf/+SNaN FPCR"  00800000 F8008000
+r 5880.08  
+*Want "DXBR NF -2/-inf FPCR"     00000000 F8000000
+r 5890.08  
+*Want "DXBR NF -2/-2 FPCR"       00000000 F8000000
+r 58A0.08  
+*Want "DXBR NF -2/-0 FPCR"       00400000 F8004000
+r 58B0.08  
+*Want "DXBR NF -2/+0 FPCR"       00400000 F8004000
+r 58C0.08  
+*Want "DXBR NF -2/+2 FPCR"       00000000 F8000000
+r 58D0.08  
+*Want "DXBR NF -2/+inf FPCR"     00000000 F8000000
+r 58E0.08  
+*Want "DXBR NF -2/-QNaN FPCR"    00000000 F8000000
+r 58F0.08  
+*Want "DXBR NF -2/+SNaN FPCR"    00800000 F8008000
+r 5900.08  
+*Want "DXBR NF -0/-inf FPCR"     00000000 F8000000
+r 5910.08  
+*Want "DXBR NF -0/-2 FPCR"       00000000 F8000000
+r 5920.08  
+*Want "DXBR NF -0/-0 FPCR"       00800000 F8008000
+r 5930.08  
+*Want "DXBR NF -0/+0 FPCR"       00800000 F8008000
+r 5940.08  
+*Want "DXBR NF -0/+2 FPCR"       00000000 F8000000
+r 5950.08  
+*Want "DXBR NF -0/+inf FPCR"     00000000 F8000000
+r 5960.08  
+*Want "DXBR NF -0/-QNaN FPCR"    00000000 F8000000
+r 5970.08  
+*Want "DXBR NF -0/+SNaN FPCR"    00800000 F8008000
+r 5980.08  
+*Want "DXBR NF +0/-inf FPCR"     00000000 F8000000
+r 5990.08  
+*Want "DXBR NF +0/-2 FPCR"       00000000 F8000000
+r 59A0.08  
+*Want "DXBR NF +0/-0 FPCR"       00800000 F8008000
+r 59B0.08  
+*Want "DXBR NF +0/+0 FPCR"       00800000 F8008000
+r 59C0.08  
+*Want "DXBR NF +0/+2 FPCR"       00000000 F8000000
+r 59D0.08  
+*Want "DXBR NF +0/+inf FPCR"     00000000 F8000000
+r 59E0.08  
+*Want "DXBR NF +0/-QNaN FPCR"    00000000 F8000000
+r 59F0.08  
+*Want "DXBR NF +0/+SNaN FPCR"    00800000 F8008000
+r 5A00.08  
+*Want "DXBR NF +2/-inf FPCR"     00000000 F8000000
+r 5A10.08  
+*Want "DXBR NF +2/-2 FPCR"       00000000 F8000000
+r 5A20.08  
+*Want "DXBR NF +2/-0 FPCR"       00400000 F8004000
+r 5A30.08  
+*Want "DXBR NF +2/+0 FPCR"       00400000 F8004000
+r 5A40.08  
+*Want "DXBR NF +2/+2 FPCR"       00000000 F8000000
+r 5A50.08  
+*Want "DXBR NF +2/+inf FPCR"     00000000 F8000000
+r 5A60.08  
+*Want "DXBR NF +2/-QNaN FPCR"    00000000 F8000000
+r 5A70.08  
+*Want "DXBR NF +2/+SNaN FPCR"    00800000 F8008000
+r 5A80.08  
+*Want "DXBR NF +inf/-inf FPCR"   00800000 F8008000
+r 5A90.08  
+*Want "DXBR NF +inf/-2 FPCR"     00000000 F8000000
+r 5AA0.08  
+*Want "DXBR NF +inf/-0 FPCR"     00000000 F8000000
+r 5AB0.08  
+*Want "DXBR NF +inf/+0 FPCR"     00000000 F8000000
+r 5AC0.08  
+*Want "DXBR NF +inf/+2 FPCR"     00000000 F8000000
+r 5AD0.08  
+*Want "DXBR NF +inf/+inf FPCR"   00800000 F8008000
+r 5AE0.08  
+*Want "DXBR NF +inf/-QNaN FPCR"  00000000 F8000000
+r 5AF0.08
+*Want "DXBR NF +inf/+SNaN FPCR"  00800000 F8008000
+r 5B00.08  
+*Want "DXBR NF -QNaN/-inf FPCR"  00000000 F8000000
+r 5B10.08  
+*Want "DXBR NF -QNaN/-2 FPCR"    00000000 F8000000
+r 5B20.08  
+*Want "DXBR NF -QNaN/-0 FPCR"    00000000 F8000000
+r 5B30.08  
+*Want "DXBR NF -QNaN/+0 FPCR"    00000000 F8000000
+r 5B40.08  
+*Want "DXBR NF -QNaN/+2 FPCR"    00000000 F8000000
+r 5B50.08  
+*Want "DXBR NF -QNaN/+inf FPCR"  00000000 F8000000
+r 5B60.08  
+*Want "DXBR NF -QNaN/-QNaN FPCR" 00000000 F8000000
+r 5B70.08  
+*Want "DXBR NF -QNaN/+SNaN FPCR" 00800000 F8008000
+r 5B80.08  
+*Want "DXBR NF +SNaN/-inf FPCR"  00800000 F8008000
+r 5B90.08  
+*Want "DXBR NF +SNaN/-2 FPCR"    00800000 F8008000
+r 5BA0.08  
+*Want "DXBR NF +SNaN/-0 FPCR"    00800000 F8008000
+r 5BB0.08  
+*Want "DXBR NF +SNaN/+0 FPCR"    00800000 F8008000
+r 5BC0.08  
+*Want "DXBR NF +SNaN/+2 FPCR"    00800000 F8008000
+r 5BD0.08  
+*Want "DXBR NF +SNaN/+inf FPCR"  00800000 F8008000
+r 5BE0.08  
+*Want "DXBR NF +SNaN/-QNaN FPCR" 00800000 F8008000
+r 5BF0.08  
+*Want "DXBR NF +SNaN/+SNaN FPCR" 00800000 F8008000
+
+
+# Extended BFP finite test results
+*Compare
+r 5C00.10
+*Want "DXBR NT max/min"   7FFF0000 00000000 00000000 00000000
+r 5C10.10
+*Want "DXBR Tr max/min"   606CFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 5C20.10
+*Want "DXBR NT min/2.0"   00008000 00000000 00000000 00000000
+r 5C30.10
+*Want "DXBR Tr min/2.0"   60000000 00000000 00000000 00000000
+r 5C40.10
+*Want "DXBR NT 1.0/10.0"  3FFB9999 99999999 99999999 9999999A
+r 5C50.10
+*Want "DXBR Tr 1.0/10.0"  3FFB9999 99999999 99999999 9999999A
+r 5C60.10
+*Want "DXBR NT 7.0/10.0"  3FFE6666 66666666 66666666 66666666
+r 5C70.10
+*Want "DXBR Tr 7.0/10.0"  3FFE6666 66666666 66666666 66666666
+r 5C80.10
+*Want "DXBR NT 1.0/-10.0" BFFB9999 99999999 99999999 9999999A
+r 5C90.10
+*Want "DXBR Tr 1.0/-10.0" BFFB9999 99999999 99999999 9999999A
+r 5CA0.10
+*Want "DXBR NT 7.0/-10.0" BFFE6666 66666666 66666666 66666666
+r 5CB0.10
+*Want "DXBR Tr 7.0/-10.0" BFFE6666 66666666 66666666 66666666
+
+
+# Extended BFP finite test results - FPCR contents
+*Compare
+r 5E00.08
+*Want "DXBR max/min FPCR"   00280000 F8002000
+r 5E10.08
+*Want "DXBR min/2.0 FPCR"   00000000 F8001000
+r 5E20.08
+*Want "DXBR 1.0/10.0 FPCR"  00080000 F8000C00
+r 5E30.08
+*Want "DXBR 7.0/10.0 FPCR"  00080000 F8000800
+r 5E40.08
+*Want "DXBR 1.0/-10.0 FPCR" 00080000 F8000C00
+r 5E50.08
+*Want "DXBR 7.0/-10.0 FPCR" 00080000 F8000800
+
+
+# Extended BFP rounding mode test results
+*Compare
+r 6000.10  
+*Want "DXBR RM RNTE 1/10"  3FFB9999 99999999 99999999 9999999A
+r 6010.10  
+*Want "DXBR RM RZ 1/10"    3FFB9999 99999999 99999999 99999999
+r 6020.10  
+*Want "DXBR RM RP 1/10"    3FFB9999 99999999 99999999 9999999A
+r 6030.10  
+*Want "DXBR RM RM 1/10"    3FFB9999 99999999 99999999 99999999
+r 6040.10  
+*Want "DXBR RM RFS 1/10"   3FFB9999 99999999 99999999 99999999
+r 6050.10  
+*Want "DXBR RM RNTE 7/10"  3FFE6666 66666666 66666666 66666666
+r 6060.10  
+*Want "DXBR RM RZ 7/10"    3FFE6666 66666666 66666666 66666666
+r 6070.10  
+*Want "DXBR RM RP 7/10"    3FFE6666 66666666 66666666 66666667
+r 6080.10  
+*Want "DXBR RM RM 7/10"    3FFE6666 66666666 66666666 66666666
+r 6090.10  
+*Want "DXBR RM RFS 7/10"   3FFE6666 66666666 66666666 66666667
+r 60A0.10  
+*Want "DXBR RM RNTE 1/-10" BFFB9999 99999999 99999999 9999999A
+r 60B0.10  
+*Want "DXBR RM RZ 1/-10"   BFFB9999 99999999 99999999 99999999
+r 60C0.10  
+*Want "DXBR RM RP 1/-10"   BFFB9999 99999999 99999999 99999999
+r 60D0.10  
+*Want "DXBR RM RM 1/-10"   BFFB9999 99999999 99999999 9999999A
+r 60E0.10  
+*Want "DXBR RM RFS 1/-10"  BFFB9999 99999999 99999999 99999999
+r 60F0.10  
+*Want "DXBR RM RNTE 7/-10" BFFE6666 66666666 66666666 66666666
+r 6100.10  
+*Want "DXBR RM RZ 7/-10"   BFFE6666 66666666 66666666 66666666
+r 6110.10  
+*Want "DXBR RM RP 7/-10"   BFFE6666 66666666 66666666 66666666
+r 6120.10  
+*Want "DXBR RM RM 7/-10"   BFFE6666 66666666 66666666 66666667
+r 6130.10  
+*Want "DXBR RM RFS 7/-10"  BFFE6666 66666666 66666666 66666667
+
+
+
+# Extended BFP rounding mode test results - FPCR contents
+*Compare
+r 6A00.10
+*Want "DXBR RM RTNE,RZ,RP,RM 1/10 FPCR"  00080000 00080001 00080002 00080003
+r 6A10.04
+*Want "DXBR RM RFS 1/10 FPCR"            00080007
+r 6A20.10
+*Want "DXBR RM RTNE,RZ,RP,RM 7/10 FPCR"  00080000 00080001 00080002 00080003
+r 6A30.04
+*Want "DXBR RM RFS 7/10 FPCR"            00080007
+r 6A40.10
+*Want "DXBR RM RTNE,RZ,RP,RM 1/-10 FPCR" 00080000 00080001 00080002 00080003
+r 6A50.04
+*Want "DXBR RM RFS 1/-10 FPCR"           00080007
+r 6A60.10
+*Want "DXBR RM RTNE,RZ,RP,RM 7/-10 FPCR" 00080000 00080001 00080002 00080003
+r 6A70.04
+*Want "DXBR RM RFS 7/-10 FPCR"           00080007
+
+
+*Done
+
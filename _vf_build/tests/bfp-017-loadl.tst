@@ -0,0 +1,412 @@
+*Testcase bfp-017-loadl.tst:      LDEBR, LDEB, LXEBR, LXEB, LXDBR, LXDB
+
+#Testcase bfp-017-loadl.tst: IEEE Load Lengthened
+#..Includes LOAD LENGTHENED (6).  Tests traps, exceptions, results,
+#..from and NaN propagation.  
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 6 program check messages that have no
+# value in the validation process.  (The messages, not the program checks.)
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-017-loadl.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Short to long BFP non-finite results 
+*Compare
+r 1000.10
+*Want "LDEBR NF -inf " FFF00000 00000000 FFF00000 00000000
+r 1010.10
+*Want "LDER NF -inf "  FFF00000 00000000 FFF00000 00000000
+r 1020.10
+*Want "LDEBR NF -1.0 " BFF00000 00000000 BFF00000 00000000
+r 1030.10
+*Want "LDER NF -1.0 "  BFF00000 00000000 BFF00000 00000000
+r 1040.10
+*Want "LDEBR NF -0.0 " 80000000 00000000 80000000 00000000
+r 1050.10
+*Want "LDER NF -0.0 "  80000000 00000000 80000000 00000000
+r 1060.10
+*Want "LDEBR NF +0.0 " 00000000 00000000 00000000 00000000
+r 1070.10
+*Want "LDER NF +0.0 "  00000000 00000000 00000000 00000000
+r 1080.10
+*Want "LDEBR NF +1.0 " 3FF00000 00000000 3FF00000 00000000
+r 1090.10
+*Want "LDER NF +1.0 "  3FF00000 00000000 3FF00000 00000000
+r 10A0.10
+*Want "LDEBR NF -inf " 7FF00000 00000000 7FF00000 00000000
+r 10B0.10
+*Want "LDER NF -inf "  7FF00000 00000000 7FF00000 00000000
+r 10C0.10
+*Want "LDEBR NF QNaN " 7FF82000 00000000 7FF82000 00000000
+r 10D0.10
+*Want "LDER NF QNaN "  7FF82000 00000000 7FF82000 00000000
+r 10E0.10
+*Want "LDEBR NF SNaN " 7FF84000 00000000 00000000 00000000
+r 10F0.10
+*Want "LDER NF SNaN "  7FF84000 00000000 00000000 00000000
+
+
+# Short to long BFP non-finite results - FPCR
+*Compare
+r 1100.10
+*Want "LDEBR NF -inf  FPCR" 00000000 F8000000 00000000 F8000000
+r 1110.10
+*Want "LDER NF -1.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 1120.10
+*Want "LDEBR NF -0.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 1130.10
+*Want "LDER NF +0.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 1140.10
+*Want "LDEBR NF +1.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 1150.10
+*Want "LDER NF -inf  FPCR"  00000000 F8000000 00000000 F8000000
+r 1160.10
+*Want "LDEBR NF QNaN  FPCR" 00000000 F8000000 00000000 F8000000
+r 1170.10
+*Want "LDER NF SNaN  FPCR"  00800000 F8008000 00800000 F8008000
+
+
+# Short to long BFP finite results 
+*Compare
+r 1200.10
+*Want "LDEBR/LDEB F  -Nmax"     C7EFFFFF E0000000 C7EFFFFF E0000000
+r 1210.10
+*Want "LDEBR/LDEB F  -Dmax"     B803FFFF C0000000 B803FFFF C0000000
+r 1220.10
+*Want "LDEBR/LDEB F  -Dmin"     B6A00000 00000000 B6A00000 00000000
+r 1230.10
+*Want "LDEBR/LDEB F  -0.1(RM)"  BFB99999 A0000000 BFB99999 A0000000
+r 1240.10
+*Want "LDEBR/LDEB F  -0.1(RZ)"  BFB99999 80000000 BFB99999 80000000
+r 1250.10
+*Want "LDEBR/LDEB F  +0.1(RZ)"  3FB99999 80000000 3FB99999 80000000
+r 1260.10
+*Want "LDEBR/LDEB F  +0.1(RP)"  3FB99999 A0000000 3FB99999 A0000000
+r 1270.10
+*Want "LDEBR/LDEB F  +Dmin"     36A00000 00000000 36A00000 00000000
+r 1280.10
+*Want "LDEBR/LDEB F  +Dmax"     3803FFFF C0000000 3803FFFF C0000000
+r 1290.10
+*Want "LDEBR/LDEB F  +Nmax"     47EFFFFF E0000000 47EFFFFF E0000000
+
+
+# Short to long BFP finite results - FPCR
+*Compare
+r 1300.10
+*Want "LDEBR/LDEB F -Nmax/-Dmax FPCR"       00000000 00000000 00000000 00000000
+r 1310.10
+*Want "LDEBR/LDEB F -Dmin/-0.1(RM) FPCR"    00000000 00000000 00000000 00000000
+r 1320.10
+*Want "LDEBR/LDEB F -0.1(RZ)/+0.1(RZ) FPCR" 00000000 00000000 00000000 00000000
+r 1330.10
+*Want "LDEBR/LDEB F +0.1(RP/+Dmin FPCR"     00000000 00000000 00000000 00000000
+r 1340.10
+*Want "LDEBR/LDEB F +Dmax/+Nmax FPCR"       00000000 00000000 00000000 00000000
+
+
+# Long to extended BFP non-finite results 
+*Compare
+r 2000.10
+*Want "LXDBR NF -inf NT" FFFF0000 00000000 00000000 00000000
+r 2010.10
+*Want "LXDBR NF -inf TR" FFFF0000 00000000 00000000 00000000
+r 2020.10
+*Want "LDER NF -inf NT"  FFFF0000 00000000 00000000 00000000
+r 2030.10
+*Want "LDER NF -inf TR"  FFFF0000 00000000 00000000 00000000
+r 2040.10
+*Want "LXDBR NF -1.0 NT" BFFF0000 00000000 00000000 00000000
+r 2050.10
+*Want "LXDBR NF -1.0 TR" BFFF0000 00000000 00000000 00000000
+r 2060.10
+*Want "LDER NF -1.0 NT"  BFFF0000 00000000 00000000 00000000
+r 2070.10
+*Want "LDER NF -1.0 TR"  BFFF0000 00000000 00000000 00000000
+r 2080.10
+*Want "LXDBR NF -0.0 NT" 80000000 00000000 00000000 00000000
+r 2090.10
+*Want "LXDBR NF -0.0 TR" 80000000 00000000 00000000 00000000
+r 20A0.10
+*Want "LXDR NF -0.0 NT"  80000000 00000000 00000000 00000000
+r 20B0.10
+*Want "LXDR NF -0.0 TR"  80000000 00000000 00000000 00000000
+r 20C0.10
+*Want "LXDBR NF +0.0 NT" 00000000 00000000 00000000 00000000
+r 20D0.10
+*Want "LXDBR NF +0.0 TR" 00000000 00000000 00000000 00000000
+r 20E0.10
+*Want "LXDR NF +0.0 NT"  00000000 00000000 00000000 00000000
+r 20F0.10
+*Want "LXDR NF +0.0 TR"  00000000 00000000 00000000 00000000
+r 2100.10
+*Want "LXDBR NF +1.0 NT" 3FFF0000 00000000 00000000 00000000
+r 2110.10
+*Want "LXDBR NF +1.0 TR" 3FFF0000 00000000 00000000 00000000
+r 2120.10
+*Want "LXDR NF +1.0 NT"  3FFF0000 00000000 00000000 00000000
+r 2130.10
+*Want "LXDR NF +1.0 TR"  3FFF0000 00000000 00000000 00000000
+r 2140.10
+*Want "LXDBR NF -inf NT" 7FFF0000 00000000 00000000 00000000
+r 2150.10
+*Want "LXDBR NF -inf TR" 7FFF0000 00000000 00000000 00000000
+r 2160.10
+*Want "LXDR NF -inf NT"  7FFF0000 00000000 00000000 00000000
+r 2170.10
+*Want "LXDR NF -inf TR"  7FFF0000 00000000 00000000 00000000
+r 2180.10
+*Want "LXDBR NF QNaN NT" 7FFF8100 00000000 00000000 00000000
+r 2190.10
+*Want "LXDBR NF QNaN TR" 7FFF8100 00000000 00000000 00000000
+r 21A0.10
+*Want "LXDR NF QNaN NT"  7FFF8100 00000000 00000000 00000000
+r 21B0.10
+*Want "LXDR NF QNaN TR"  7FFF8100 00000000 00000000 00000000
+r 21C0.10
+*Want "LXDBR NF SNaN NT" 7FFF8200 00000000 00000000 00000000
+r 21D0.10
+*Want "LXDBR NF SNaN TR" 00000000 00000000 00000000 00000000
+r 21E0.10
+*Want "LXDR NF SNaN NT"  7FFF8200 00000000 00000000 00000000
+r 21F0.10
+*Want "LXDR NF SNaN TR"  00000000 00000000 00000000 00000000
+
+
+# Long to extended BFP non-finite results - FPCR Contents
+*Compare
+r 2200.10
+*Want "LXDBR NF -inf  FPCR" 00000000 F8000000 00000000 F8000000
+r 2210.10
+*Want "LXDR NF -1.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 2220.10
+*Want "LXDBR NF -0.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 2230.10
+*Want "LXDR NF +0.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 2240.10
+*Want "LXDBR NF +1.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 2250.10
+*Want "LXDR NF -inf  FPCR"  00000000 F8000000 00000000 F8000000
+r 2260.10
+*Want "LXDBR NF QNaN  FPCR" 00000000 F8000000 00000000 F8000000
+r 2270.10
+*Want "LXDR NF SNaN  FPCR"  00800000 F8008000 00800000 F8008000
+
+
+# Long to extended BFP finite results 
+*Compare
+r 2300.10
+*Want "LXDBR F  -Nmax"     7FFFFFFF FFFFFFFF F0000000 00000000
+r 2310.10
+*Want "LXDB F  -Nmax"      7FFFFFFF FFFFFFFF F0000000 00000000
+r 2320.10
+*Want "LXDBR F  -Dmax"     BC00FFFF FFFFFFFF E0000000 00000000
+r 2330.10
+*Want "LXDB F  -Dmax"      BC00FFFF FFFFFFFF E0000000 00000000
+r 2340.10
+*Want "LXDBR F  -Dmin"     BBCD0000 00000000 00000000 00000000
+r 2350.10
+*Want "LXDB F  -Dmin"      BBCD0000 00000000 00000000 00000000
+r 2360.10
+*Want "LXDBR F  -0.1(RM)"  BFFB9999 99999999 A0000000 00000000
+r 2370.10
+*Want "LXDB F  -0.1(RM)"   BFFB9999 99999999 A0000000 00000000
+r 2380.10
+*Want "LXDBR F  -0.1(RZ)"  BFFB9999 99999999 90000000 00000000
+r 2390.10
+*Want "LXDB F  -0.1(RZ)"   BFFB9999 99999999 90000000 00000000
+r 23A0.10
+*Want "LXDBR F  +0.1(RZ)"  3FFB9999 99999999 90000000 00000000
+r 23B0.10
+*Want "LXDB F  +0.1(RZ)"   3FFB9999 99999999 90000000 00000000
+r 23C0.10
+*Want "LXDBR F  +0.1(RP)"  3FFB9999 99999999 A0000000 00000000
+r 23D0.10
+*Want "LXDB F  +0.1(RP)"   3FFB9999 99999999 A0000000 00000000
+r 23E0.10
+*Want "LXDBR F  +Dmin"     3BCD0000 00000000 00000000 00000000
+r 23F0.10
+*Want "LXDB F  +Dmin"      3BCD0000 00000000 00000000 00000000
+r 2400.10
+*Want "LXDBR F  +Dmax"     3C00FFFF FFFFFFFF E0000000 00000000
+r 2410.10
+*Want "LXDB F  +Dmax"      3C00FFFF FFFFFFFF E0000000 00000000
+r 2420.10
+*Want "LXDBR F  +Nmax"     7FFFFFFF FFFFFFFF F0000000 00000000
+r 2430.10
+*Want "LXDB F  +Nmax"      7FFFFFFF FFFFFFFF F0000000 00000000
+
+
+# Long to extended BFP results - FPCR
+*Compare
+r 2500.10
+*Want "LXDBR/LXDB F -Nmax/-Dmax FPCR"       00000000 00000000 00000000 00000000
+r 2510.10
+*Want "LXDBR/LXDB F -Dmin/-0.1(RM) FPCR"    00000000 00000000 00000000 00000000
+r 2520.10
+*Want "LXDBR/LXDB F -0.1(RZ)/+0.1(RZ) FPCR" 00000000 00000000 00000000 00000000
+r 2530.10
+*Want "LXDBR/LXDB F +0.1(RP/+Dmin FPCR"     00000000 00000000 00000000 00000000
+r 2540.10
+*Want "LXDBR/LXDB F +Dmax/+Nmax FPCR"       00000000 00000000 00000000 00000000
+
+
+# Short to extended BFP non-finite results 
+*Compare
+r 3000.10
+*Want "LXEBR NF -inf NT" FFFF0000 00000000 00000000 00000000
+r 3010.10
+*Want "LXEBR NF -inf TR" FFFF0000 00000000 00000000 00000000
+r 3020.10
+*Want "LDER NF -inf NT"  FFFF0000 00000000 00000000 00000000
+r 3030.10
+*Want "LDER NF -inf TR"  FFFF0000 00000000 00000000 00000000
+r 3040.10
+*Want "LXEBR NF -1.0 NT" BFFF0000 00000000 00000000 00000000
+r 3050.10
+*Want "LXEBR NF -1.0 TR" BFFF0000 00000000 00000000 00000000
+r 3060.10
+*Want "LDER NF -1.0 NT"  BFFF0000 00000000 00000000 00000000
+r 3070.10
+*Want "LDER NF -1.0 TR"  BFFF0000 00000000 00000000 00000000
+r 3080.10
+*Want "LXEBR NF -0.0 NT" 80000000 00000000 00000000 00000000
+r 3090.10
+*Want "LXEBR NF -0.0 TR" 80000000 00000000 00000000 00000000
+r 30A0.10
+*Want "LXER NF -0.0 NT"  80000000 00000000 00000000 00000000
+r 30B0.10
+*Want "LXER NF -0.0 TR"  80000000 00000000 00000000 00000000
+r 30C0.10
+*Want "LXEBR NF +0.0 NT" 00000000 00000000 00000000 00000000
+r 30D0.10
+*Want "LXEBR NF +0.0 TR" 00000000 00000000 00000000 00000000
+r 30E0.10
+*Want "LXER NF +0.0 NT"  00000000 00000000 00000000 00000000
+r 30F0.10
+*Want "LXER NF +0.0 TR"  00000000 00000000 00000000 00000000
+r 3100.10
+*Want "LXEBR NF +1.0 NT" 3FFF0000 00000000 00000000 00000000
+r 3110.10
+*Want "LXEBR NF +1.0 TR" 3FFF0000 00000000 00000000 00000000
+r 3120.10
+*Want "LXER NF +1.0 NT"  3FFF0000 00000000 00000000 00000000
+r 3130.10
+*Want "LXER NF +1.0 TR"  3FFF0000 00000000 00000000 00000000
+r 3140.10
+*Want "LXEBR NF -inf NT" 7FFF0000 00000000 00000000 00000000
+r 3150.10
+*Want "LXEBR NF -inf TR" 7FFF0000 00000000 00000000 00000000
+r 3160.10
+*Want "LXER NF -inf NT"  7FFF0000 00000000 00000000 00000000
+r 3170.10
+*Want "LXER NF -inf TR"  7FFF0000 00000000 00000000 00000000
+r 3180.10
+*Want "LXEBR NF QNaN NT" 7FFF8200 00000000 00000000 00000000
+r 3190.10
+*Want "LXEBR NF QNaN TR" 7FFF8200 00000000 00000000 00000000
+r 31A0.10
+*Want "LXER NF QNaN NT"  7FFF8200 00000000 00000000 00000000
+r 31B0.10
+*Want "LXER NF QNaN TR"  7FFF8200 00000000 00000000 00000000
+r 31C0.10
+*Want "LXEBR NF SNaN NT" 7FFF8400 00000000 00000000 00000000
+r 31D0.10
+*Want "LXEBR NF SNaN TR" 00000000 00000000 00000000 00000000
+r 31E0.10
+*Want "LXER NF SNaN NT"  7FFF8400 00000000 00000000 00000000
+r 31F0.10
+*Want "LXER NF SNaN TR"  00000000 00000000 00000000 00000000
+
+
+# Short to extended BFP non-finite results - FPCR
+*Compare
+r 3200.10
+*Want "LXEBR NF -inf  FPCR" 00000000 F8000000 00000000 F8000000
+r 3210.10
+*Want "LXER NF -1.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 3220.10
+*Want "LXEBR NF -0.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 3230.10
+*Want "LXER NF +0.0  FPCR"  00000000 F8000000 00000000 F8000000
+r 3240.10
+*Want "LXEBR NF +1.0  FPCR" 00000000 F8000000 00000000 F8000000
+r 3250.10
+*Want "LXER NF -inf  FPCR"  00000000 F8000000 00000000 F8000000
+r 3260.10
+*Want "LXEBR NF QNaN  FPCR" 00000000 F8000000 00000000 F8000000
+r 3270.10
+*Want "LXER NF SNaN  FPCR"  00800000 F8008000 00800000 F8008000
+
+
+# Short to extended BFP finite results
+*Compare
+r 3300.10
+*Want "LXEBR F  -Nmax"     C07EFFFF FE000000 00000000 00000000
+r 3310.10
+*Want "LXEB F  -Nmax"      C07EFFFF FE000000 00000000 00000000
+r 3320.10
+*Want "LXEBR F  -Dmax"     BF803FFF FC000000 00000000 00000000
+r 3330.10
+*Want "LXEB F  -Dmax"      BF803FFF FC000000 00000000 00000000
+r 3340.10
+*Want "LXEBR F  -Dmin"     BF6A0000 00000000 00000000 00000000
+r 3350.10
+*Want "LXEB F  -Dmin"      BF6A0000 00000000 00000000 00000000
+r 3360.10
+*Want "LXEBR F  -0.1(RM)"  BFFB9999 9A000000 00000000 00000000
+r 3370.10
+*Want "LXEB F  -0.1(RM)"   BFFB9999 9A000000 00000000 00000000
+r 3380.10
+*Want "LXEBR F  -0.1(RZ)"  BFFB9999 98000000 00000000 00000000
+r 3390.10
+*Want "LXEB F  -0.1(RZ)"   BFFB9999 98000000 00000000 00000000
+r 33A0.10
+*Want "LXEBR F  +0.1(RZ)"  3FFB9999 98000000 00000000 00000000
+r 33B0.10
+*Want "LXEB F  +0.1(RZ)"   3FFB9999 98000000 00000000 00000000
+r 33C0.10
+*Want "LXEBR F  +0.1(RP)"  3FFB9999 9A000000 00000000 00000000
+r 33D0.10
+*Want "LXEB F  +0.1(RP)"   3FFB9999 9A000000 00000000 00000000
+r 33E0.10
+*Want "LXEBR F  +Dmin"     3F6A0000 00000000 00000000 00000000
+r 33F0.10
+*Want "LXEB F  +Dmin"      3F6A0000 00000000 00000000 00000000
+r 3400.10
+*Want "LXEBR F  +Dmax"     3F803FFF FC000000 00000000 00000000
+r 3410.10
+*Want "LXEB F  +Dmax"      3F803FFF FC000000 00000000 00000000
+r 3420.10
+*Want "LXEBR F  +Nmax"     407EFFFF FE000000 00000000 00000000
+r 3430.10
+*Want "LXEB F  +Nmax"      407EFFFF FE000000 00000000 00000000
+
+
+# Short to extended BFP finite results - FPCR
+*Compare
+r 3500.10
+*Want "LXEBR/LXEB F -Nmax/-Dmax FPCR"       00000000 00000000 00000000 00000000
+r 3510.10
+*Want "LXEBR/LXEB F -Dmin/-0.1(RM) FPCR"    00000000 00000000 00000000 00000000
+r 3520.10
+*Want "LXEBR/LXEB F -0.1(RZ)/+0.1(RZ) FPCR" 00000000 00000000 00000000 00000000
+r 3530.10
+*Want "LXEBR/LXEB F +0.1(RP/+Dmin FPCR"     00000000 00000000 00000000 00000000
+r 3540.10
+*Want "LXEBR/LXEB F +Dmax/+Nmax FPCR"       00000000 00000000 00000000 00000000
+
+
+
+*Done
+
@@ -0,0 +1,2133 @@
+*Testcase bfp-018-subtract.tst:   SEBR, SEB, SDBR, SDB, SXBR
+
+#Testcase bfp-016-add.tst: Subtraction tests SUBTRACT (5)
+#..Test cases evaluate NaN propagation, NaN generation, operations
+#..using non-finite values, trappable and non-trappable IEEE
+#..exceptions, result scaling, and exhaustive rounding testing.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 230 program check messages that have no
+# value in the validation process.  (The messages, not the program checks.)
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-018-subtract.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Short BFP non-finite test results
+*Compare
+r 1000.10
+*Want "SEBR/SEB NF -inf/-inf"           7FC00000 FF800000 7FC00000 FF800000
+r 1010.10
+*Want "SEBR/SEB NF -inf/-2.0"           FF800000 FF800000 FF800000 FF800000
+r 1020.10
+*Want "SEBR/SEB NF -inf/-Dnice"         FF800000 FF800000 FF800000 FF800000
+r 1030.10
+*Want "SEBR/SEB NF -inf/-0"             FF800000 FF800000 FF800000 FF800000
+r 1040.10
+*Want "SEBR/SEB NF -inf/+0"             FF800000 FF800000 FF800000 FF800000
+r 1050.10
+*Want "SEBR/SEB NF -inf/+Dnice"         FF800000 FF800000 FF800000 FF800000
+r 1060.10
+*Want "SEBR/SEB NF -inf/+2.0"           FF800000 FF800000 FF800000 FF800000
+r 1070.10
+*Want "SEBR/SEB NF -inf/+inf"           FF800000 FF800000 FF800000 FF800000
+r 1080.10
+*Want "SEBR/SEB NF -inf/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1090.10
+*Want "SEBR/SEB NF -inf/+SNaN"          7FCA0000 FF800000 7FCA0000 FF800000
+r 10A0.10
+*Want "SEBR/SEB NF -2.0/-inf"           7F800000 7F800000 7F800000 7F800000
+r 10B0.10
+*Want "SEBR/SEB NF -2.0/-2.0"           00000000 00000000 00000000 00000000
+r 10C0.10
+*Want "SEBR/SEB NF -2.0/-Dnice"         C0000000 C0000000 C0000000 C0000000
+r 10D0.10
+*Want "SEBR/SEB NF -2.0/-0"             C0000000 C0000000 C0000000 C0000000
+r 10E0.10
+*Want "SEBR/SEB NF -2.0/+0"             C0000000 C0000000 C0000000 C0000000
+r 10F0.10
+*Want "SEBR/SEB NF -2.0/+Dnice"         C0000000 C0000000 C0000000 C0000000
+r 1100.10
+*Want "SEBR/SEB NF -2.0/+2.0"           C0800000 C0800000 C0800000 C0800000
+r 1110.10
+*Want "SEBR/SEB NF -2.0/+inf"           FF800000 FF800000 FF800000 FF800000
+r 1120.10
+*Want "SEBR/SEB NF -2.0/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1130.10
+*Want "SEBR/SEB NF -2.0/+SNaN"          7FCA0000 C0000000 7FCA0000 C0000000
+r 1140.10
+*Want "SEBR/SEB NF -Dnice/-inf"         7F800000 7F800000 7F800000 7F800000
+r 1150.10
+*Want "SEBR/SEB NF -Dnice/-2.0"         40000000 40000000 40000000 40000000
+r 1160.10
+*Want "SEBR/SEB NF -Dnice/-Dnice"       00000000 00000000 00000000 00000000
+r 1170.10
+*Want "SEBR/SEB NF -Dnice/-0"           80010000 DD000000 80010000 DD000000
+r 1180.10
+*Want "SEBR/SEB NF -Dnice/+0"           80010000 DD000000 80010000 DD000000
+r 1190.10
+*Want "SEBR/SEB NF -Dnice/+Dnice"       80020000 DD800000 80020000 DD800000
+r 11A0.10
+*Want "SEBR/SEB NF -Dnice/+2.0"         C0000000 C0000000 C0000000 C0000000
+r 11B0.10
+*Want "SEBR/SEB NF -Dnice/+inf"         FF800000 FF800000 FF800000 FF800000
+r 11C0.10
+*Want "SEBR/SEB NF -Dnice/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 11D0.10
+*Want "SEBR/SEB NF -Dnice/+SNaN"        7FCA0000 80010000 7FCA0000 80010000
+r 11E0.10
+*Want "SEBR/SEB NF -0/-inf"             7F800000 7F800000 7F800000 7F800000
+r 11F0.10
+*Want "SEBR/SEB NF -0/-2.0"             40000000 40000000 40000000 40000000
+r 1200.10
+*Want "SEBR/SEB NF -0/-Dnice"           00010000 5D000000 00010000 5D000000
+r 1210.10
+*Want "SEBR/SEB NF -0/-0"               00000000 00000000 00000000 00000000
+r 1220.10
+*Want "SEBR/SEB NF -0/+0"               80000000 80000000 80000000 80000000
+r 1230.10
+*Want "SEBR/SEB NF -0/+Dnice"           80010000 DD000000 80010000 DD000000
+r 1240.10
+*Want "SEBR/SEB NF -0/+2.0"             C0000000 C0000000 C0000000 C0000000
+r 1250.10
+*Want "SEBR/SEB NF -0/+inf"             FF800000 FF800000 FF800000 FF800000
+r 1260.10
+*Want "SEBR/SEB NF -0/-QNaN"            FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1270.10
+*Want "SEBR/SEB NF -0/+SNaN"            7FCA0000 80000000 7FCA0000 80000000
+r 1280.10
+*Want "SEBR/SEB NF +0/-inf"             7F800000 7F800000 7F800000 7F800000
+r 1290.10
+*Want "SEBR/SEB NF +0/-2.0"             40000000 40000000 40000000 40000000
+r 12A0.10
+*Want "SEBR/SEB NF +0/-Dnice"           00010000 5D000000 00010000 5D000000
+r 12B0.10
+*Want "SEBR/SEB NF +0/-0"               00000000 00000000 00000000 00000000
+r 12C0.10
+*Want "SEBR/SEB NF +0/+0"               00000000 00000000 00000000 00000000
+r 12D0.10
+*Want "SEBR/SEB NF +0/+Dnice"           80010000 DD000000 80010000 DD000000
+r 12E0.10
+*Want "SEBR/SEB NF +0/+2.0"             C0000000 C0000000 C0000000 C0000000
+r 12F0.10
+*Want "SEBR/SEB NF +0/+inf"             FF800000 FF800000 FF800000 FF800000
+r 1300.10
+*Want "SEBR/SEB NF +0/-QNaN"            FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1310.10
+*Want "SEBR/SEB NF +0/+SNaN"            7FCA0000 00000000 7FCA0000 00000000
+r 1320.10
+*Want "SEBR/SEB NF +Dnice/-inf"         7F800000 7F800000 7F800000 7F800000
+r 1330.10
+*Want "SEBR/SEB NF +Dnice/-2.0"         40000000 40000000 40000000 40000000
+r 1340.10
+*Want "SEBR/SEB NF +Dnice/-Dnice"       00020000 5D800000 00020000 5D800000
+r 1350.10
+*Want "SEBR/SEB NF +Dnice/-0"           00010000 5D000000 00010000 5D000000
+r 1360.10
+*Want "SEBR/SEB NF +Dnice/+0"           00010000 5D000000 00010000 5D000000
+r 1370.10
+*Want "SEBR/SEB NF +Dnice/+Dnice"       00000000 00000000 00000000 00000000
+r 1380.10
+*Want "SEBR/SEB NF +Dnice/+2.0"         C0000000 C0000000 C0000000 C0000000
+r 1390.10
+*Want "SEBR/SEB NF +Dnice/+inf"         FF800000 FF800000 FF800000 FF800000
+r 13A0.10
+*Want "SEBR/SEB NF +Dnice/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 13B0.10
+*Want "SEBR/SEB NF +Dnice/+SNaN"        7FCA0000 00010000 7FCA0000 00010000
+r 13C0.10
+*Want "SEBR/SEB NF +2.0/-inf"           7F800000 7F800000 7F800000 7F800000
+r 13D0.10
+*Want "SEBR/SEB NF +2.0/-2.0"           40800000 40800000 40800000 40800000
+r 13E0.10
+*Want "SEBR/SEB NF +2.0/-Dnice"         40000000 40000000 40000000 40000000
+r 13F0.10
+*Want "SEBR/SEB NF +2.0/-0"             40000000 40000000 40000000 40000000
+r 1400.10
+*Want "SEBR/SEB NF +2.0/+0"             40000000 40000000 40000000 40000000
+r 1410.10
+*Want "SEBR/SEB NF +2.0/+Dnice"         40000000 40000000 40000000 40000000
+r 1420.10
+*Want "SEBR/SEB NF +2.0/+2.0"           00000000 00000000 00000000 00000000
+r 1430.10
+*Want "SEBR/SEB NF +2.0/+inf"           FF800000 FF800000 FF800000 FF800000
+r 1440.10
+*Want "SEBR/SEB NF +2.0/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1450.10
+*Want "SEBR/SEB NF +2.0/+SNaN"          7FCA0000 40000000 7FCA0000 40000000
+r 1460.10
+*Want "SEBR/SEB NF +inf/-inf"           7F800000 7F800000 7F800000 7F800000
+r 1470.10
+*Want "SEBR/SEB NF +inf/-2.0"           7F800000 7F800000 7F800000 7F800000
+r 1480.10
+*Want "SEBR/SEB NF +inf/-Dnice"         7F800000 7F800000 7F800000 7F800000
+r 1490.10
+*Want "SEBR/SEB NF +inf/-0"             7F800000 7F800000 7F800000 7F800000
+r 14A0.10
+*Want "SEBR/SEB NF +inf/+0"             7F800000 7F800000 7F800000 7F800000
+r 14B0.10
+*Want "SEBR/SEB NF +inf/+Dnice"         7F800000 7F800000 7F800000 7F800000
+r 14C0.10
+*Want "SEBR/SEB NF +inf/+2.0"           7F800000 7F800000 7F800000 7F800000
+r 14D0.10
+*Want "SEBR/SEB NF +inf/+inf"           7FC00000 7F800000 7FC00000 7F800000
+r 14E0.10
+*Want "SEBR/SEB NF +inf/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 14F0.10
+*Want "SEBR/SEB NF +inf/+SNaN"          7FCA0000 7F800000 7FCA0000 7F800000
+r 1500.10
+*Want "SEBR/SEB NF -QNaN/-inf"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1510.10
+*Want "SEBR/SEB NF -QNaN/-2.0"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1520.10
+*Want "SEBR/SEB NF -QNaN/-Dnice"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1530.10
+*Want "SEBR/SEB NF -QNaN/-0"            FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1540.10
+*Want "SEBR/SEB NF -QNaN/+0"            FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1550.10
+*Want "SEBR/SEB NF -QNaN/+Dnice"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1560.10
+*Want "SEBR/SEB NF -QNaN/+2.0"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1570.10
+*Want "SEBR/SEB NF -QNaN/+inf"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1580.10
+*Want "SEBR/SEB NF -QNaN/-QNaN"         FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1590.10
+*Want "SEBR/SEB NF -QNaN/+SNaN"         7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 15A0.10
+*Want "SEBR/SEB NF +SNaN/-inf"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 15B0.10
+*Want "SEBR/SEB NF +SNaN/-2.0"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 15C0.10
+*Want "SEBR/SEB NF +SNaN/-Dnice"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 15D0.10
+*Want "SEBR/SEB NF +SNaN/-0"            7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 15E0.10
+*Want "SEBR/SEB NF +SNaN/+0"            7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 15F0.10
+*Want "SEBR/SEB NF +SNaN/+Dnice"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1600.10
+*Want "SEBR/SEB NF +SNaN/+2.0"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1610.10
+*Want "SEBR/SEB NF +SNaN/+inf"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1620.10
+*Want "SEBR/SEB NF +SNaN/-QNaN"         7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1630.10
+*Want "SEBR/SEB NF +SNaN/+SNaN"         7FCA0000 7F8A0000 7FCA0000 7F8A0000
+
+
+# Short BFP non-finite test results - FPCR
+*Compare
+r 1700.10
+*Want "SEBR/SEB NF -inf/-inf FPCR"      00800003 F8008003 00800003 F8008003
+r 1710.10
+*Want "SEBR/SEB NF -inf/-2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 1720.10
+*Want "SEBR/SEB NF -inf/-Dnice FPCR"    00000001 F8000001 00000001 F8000001
+r 1730.10
+*Want "SEBR/SEB NF -inf/-0 FPCR"        00000001 F8000001 00000001 F8000001
+r 1740.10
+*Want "SEBR/SEB NF -inf/+0 FPCR"        00000001 F8000001 00000001 F8000001
+r 1750.10
+*Want "SEBR/SEB NF -inf/+Dnice FPCR"    00000001 F8000001 00000001 F8000001
+r 1760.10
+*Want "SEBR/SEB NF -inf/+2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 1770.10
+*Want "SEBR/SEB NF -inf/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 1780.10
+*Want "SEBR/SEB NF -inf/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 1790.10
+*Want "SEBR/SEB NF -inf/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 17A0.10
+*Want "SEBR/SEB NF -2.0/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 17B0.10
+*Want "SEBR/SEB NF -2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 17C0.10
+*Want "SEBR/SEB NF -2.0/-Dnice FPCR"    00080001 F8000C01 00080001 F8000C01
+r 17D0.10
+*Want "SEBR/SEB NF -2.0/-0 FPCR"        00000001 F8000001 00000001 F8000001
+r 17E0.10
+*Want "SEBR/SEB NF -2.0/+0 FPCR"        00000001 F8000001 00000001 F8000001
+r 17F0.10
+*Want "SEBR/SEB NF -2.0/+Dnice FPCR"    00080001 F8000801 00080001 F8000801
+r 1800.10
+*Want "SEBR/SEB NF -2.0/+2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 1810.10
+*Want "SEBR/SEB NF -2.0/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 1820.10
+*Want "SEBR/SEB NF -2.0/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 1830.10
+*Want "SEBR/SEB NF -2.0/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 1840.10
+*Want "SEBR/SEB NF -Dnice/-inf FPCR"    00000002 F8000002 00000002 F8000002
+r 1850.10
+*Want "SEBR/SEB NF -Dnice/-2.0 FPCR"    00080002 F8000C02 00080002 F8000C02
+r 1860.10
+*Want "SEBR/SEB NF -Dnice/-Dnice FPCR"  00000000 F8000000 00000000 F8000000
+r 1870.10
+*Want "SEBR/SEB NF -Dnice/-0 FPCR"      00000001 F8001001 00000001 F8001001
+r 1880.10
+*Want "SEBR/SEB NF -Dnice/+0 FPCR"      00000001 F8001001 00000001 F8001001
+r 1890.10
+*Want "SEBR/SEB NF -Dnice/+Dnice FPCR"  00000001 F8001001 00000001 F8001001
+r 18A0.10
+*Want "SEBR/SEB NF -Dnice/+2.0 FPCR"    00080001 F8000801 00080001 F8000801
+r 18B0.10
+*Want "SEBR/SEB NF -Dnice/+inf FPCR"    00000001 F8000001 00000001 F8000001
+r 18C0.10
+*Want "SEBR/SEB NF -Dnice/-QNaN FPCR"   00000003 F8000003 00000003 F8000003
+r 18D0.10
+*Want "SEBR/SEB NF -Dnice/+SNaN FPCR"   00800003 F8008003 00800003 F8008003
+r 18E0.10
+*Want "SEBR/SEB NF -0/-inf FPCR"        00000002 F8000002 00000002 F8000002
+r 18F0.10
+*Want "SEBR/SEB NF -0/-2.0 FPCR"        00000002 F8000002 00000002 F8000002
+r 1900.10
+*Want "SEBR/SEB NF -0/-Dnice FPCR"      00000002 F8001002 00000002 F8001002
+r 1910.10
+*Want "SEBR/SEB NF -0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1920.10
+*Want "SEBR/SEB NF -0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1930.10
+*Want "SEBR/SEB NF -0/+Dnice FPCR"      00000001 F8001001 00000001 F8001001
+r 1940.10
+*Want "SEBR/SEB NF -0/+2.0 FPCR"        00000001 F8000001 00000001 F8000001
+r 1950.10
+*Want "SEBR/SEB NF -0/+inf FPCR"        00000001 F8000001 00000001 F8000001
+r 1960.10
+*Want "SEBR/SEB NF -0/-QNaN FPCR"       00000003 F8000003 00000003 F8000003
+r 1970.10
+*Want "SEBR/SEB NF -0/+SNaN FPCR"       00800003 F8008003 00800003 F8008003
+r 1980.10
+*Want "SEBR/SEB NF +0/-inf FPCR"        00000002 F8000002 00000002 F8000002
+r 1990.10
+*Want "SEBR/SEB NF +0/-2.0 FPCR"        00000002 F8000002 00000002 F8000002
+r 19A0.10
+*Want "SEBR/SEB NF +0/-Dnice FPCR"      00000002 F8001002 00000002 F8001002
+r 19B0.10
+*Want "SEBR/SEB NF +0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 19C0.10
+*Want "SEBR/SEB NF +0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 19D0.10
+*Want "SEBR/SEB NF +0/+Dnice FPCR"      00000001 F8001001 00000001 F8001001
+r 19E0.10
+*Want "SEBR/SEB NF +0/+2.0 FPCR"        00000001 F8000001 00000001 F8000001
+r 19F0.10
+*Want "SEBR/SEB NF +0/+inf FPCR"        00000001 F8000001 00000001 F8000001
+r 1A00.10
+*Want "SEBR/SEB NF +0/-QNaN FPCR"       00000003 F8000003 00000003 F8000003
+r 1A10.10
+*Want "SEBR/SEB NF +0/+SNaN FPCR"       00800003 F8008003 00800003 F8008003
+r 1A20.10
+*Want "SEBR/SEB NF +Dnice/-inf FPCR"    00000002 F8000002 00000002 F8000002
+r 1A30.10
+*Want "SEBR/SEB NF +Dnice/-2.0 FPCR"    00080002 F8000802 00080002 F8000802
+r 1A40.10
+*Want "SEBR/SEB NF +Dnice/-Dnice FPCR"  00000002 F8001002 00000002 F8001002
+r 1A50.10
+*Want "SEBR/SEB NF +Dnice/-0 FPCR"      00000002 F8001002 00000002 F8001002
+r 1A60.10
+*Want "SEBR/SEB NF +Dnice/+0 FPCR"      00000002 F8001002 00000002 F8001002
+r 1A70.10
+*Want "SEBR/SEB NF +Dnice/+Dnice FPCR"  00000000 F8000000 00000000 F8000000
+r 1A80.10
+*Want "SEBR/SEB NF +Dnice/+2.0 FPCR"    00080001 F8000C01 00080001 F8000C01
+r 1A90.10
+*Want "SEBR/SEB NF +Dnice/+inf FPCR"    00000001 F8000001 00000001 F8000001
+r 1AA0.10
+*Want "SEBR/SEB NF +Dnice/-QNaN FPCR"   00000003 F8000003 00000003 F8000003
+r 1AB0.10
+*Want "SEBR/SEB NF +Dnice/+SNaN FPCR"   00800003 F8008003 00800003 F8008003
+r 1AC0.10
+*Want "SEBR/SEB NF +2.0/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 1AD0.10
+*Want "SEBR/SEB NF +2.0/-2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 1AE0.10
+*Want "SEBR/SEB NF +2.0/-Dnice FPCR"    00080002 F8000802 00080002 F8000802
+r 1AF0.10
+*Want "SEBR/SEB NF +2.0/-0 FPCR"        00000002 F8000002 00000002 F8000002
+r 1B00.10
+*Want "SEBR/SEB NF +2.0/+0 FPCR"        00000002 F8000002 00000002 F8000002
+r 1B10.10
+*Want "SEBR/SEB NF +2.0/+Dnice FPCR"    00080002 F8000C02 00080002 F8000C02
+r 1B20.10
+*Want "SEBR/SEB NF +2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 1B30.10
+*Want "SEBR/SEB NF +2.0/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 1B40.10
+*Want "SEBR/SEB NF +2.0/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 1B50.10
+*Want "SEBR/SEB NF +2.0/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 1B60.10
+*Want "SEBR/SEB NF +inf/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 1B70.10
+*Want "SEBR/SEB NF +inf/-2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 1B80.10
+*Want "SEBR/SEB NF +inf/-Dnice FPCR"    00000002 F8000002 00000002 F8000002
+r 1B90.10
+*Want "SEBR/SEB NF +inf/-0 FPCR"        00000002 F8000002 00000002 F8000002
+r 1BA0.10
+*Want "SEBR/SEB NF +inf/+0 FPCR"        00000002 F8000002 00000002 F8000002
+r 1BB0.10
+*Want "SEBR/SEB NF +inf/+Dnice FPCR"    00000002 F8000002 00000002 F8000002
+r 1BC0.10
+*Want "SEBR/SEB NF +inf/+2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 1BD0.10
+*Want "SEBR/SEB NF +inf/+inf FPCR"      00800003 F8008003 00800003 F8008003
+r 1BE0.10
+*Want "SEBR/SEB NF +inf/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 1BF0.10
+*Want "SEBR/SEB NF +inf/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 1C00.10
+*Want "SEBR/SEB NF -QNaN/-inf FPCR"     00000003 F8000003 00000003 F8000003
+r 1C10.10
+*Want "SEBR/SEB NF -QNaN/-2.0 FPCR"     00000003 F8000003 00000003 F8000003
+r 1C20.10
+*Want "SEBR/SEB NF -QNaN/-Dnice FPCR"   00000003 F8000003 00000003 F8000003
+r 1C30.10
+*Want "SEBR/SEB NF -QNaN/-0 FPCR"       00000003 F8000003 00000003 F8000003
+r 1C40.10
+*Want "SEBR/SEB NF -QNaN/+0 FPCR"       00000003 F8000003 00000003 F8000003
+r 1C50.10
+*Want "SEBR/SEB NF -QNaN/+Dnice FPCR"   00000003 F8000003 00000003 F8000003
+r 1C60.10
+*Want "SEBR/SEB NF -QNaN/+2.0 FPCR"     00000003 F8000003 00000003 F8000003
+r 1C70.10
+*Want "SEBR/SEB NF -QNaN/+inf FPCR"     00000003 F8000003 00000003 F8000003
+r 1C80.10
+*Want "SEBR/SEB NF -QNaN/-QNaN FPCR"    00000003 F8000003 00000003 F8000003
+r 1C90.10
+*Want "SEBR/SEB NF -QNaN/+SNaN FPCR"    00800003 F8008003 00800003 F8008003
+r 1CA0.10
+*Want "SEBR/SEB NF +SNaN/-inf FPCR"     00800003 F8008003 00800003 F8008003
+r 1CB0.10
+*Want "SEBR/SEB NF +SNaN/-2.0 FPCR"     00800003 F8008003 00800003 F8008003
+r 1CC0.10
+*Want "SEBR/SEB NF +SNaN/-Dnice FPCR"   00800003 F8008003 00800003 F8008003
+r 1CD0.10
+*Want "SEBR/SEB NF +SNaN/-0 FPCR"       00800003 F8008003 00800003 F8008003
+r 1CE0.10
+*Want "SEBR/SEB NF +SNaN/+0 FPCR"       00800003 F8008003 00800003 F8008003
+r 1CF0.10
+*Want "SEBR/SEB NF +SNaN/+Dnice FPCR"   00800003 F8008003 00800003 F8008003
+r 1D00.10
+*Want "SEBR/SEB NF +SNaN/+2.0 FPCR"     00800003 F8008003 00800003 F8008003
+r 1D10.10
+*Want "SEBR/SEB NF +SNaN/+inf FPCR"     00800003 F8008003 00800003 F8008003
+r 1D20.10
+*Want "SEBR/SEB NF +SNaN/-QNaN FPCR"    00800003 F8008003 00800003 F8008003
+r 1D30.10
+*Want "SEBR/SEB NF +SNaN/+SNaN FPCR"    00800003 F8008003 00800003 F8008003
+
+
+# Short BFP finite test results
+*Compare
+r 1E00.10
+*Want "SEBR/SEB F Ovfl"                 7F800000 1FFFFFFF 7F800000 1FFFFFFF
+r 1E10.10
+*Want "SEBR/SEB F Ufl 1"                007FFFFF 607FFFFE 007FFFFF 607FFFFE
+r 1E20.10
+*Want "SEBR/SEB F Ufl 2"                0003F0F1 5DFC3C40 0003F0F1 5DFC3C40
+r 1E30.10
+*Want "SEBR/SEB F Nmin"                 00800000 00800000 00800000 00800000
+r 1E40.10
+*Want "SEBR/SEB F Incr"                 3F800000 3F800000 3F800000 3F800000
+r 1E50.10
+*Want "SEBR/SEB F Trun"                 3F7FFFFF 3F7FFFFF 3F7FFFFF 3F7FFFFF
+
+
+# Short BFP finite test results - FPCR
+*Compare
+r 1F00.10
+*Want "SEBR/SEB F Ovfl FPCR"            00280002 F8002002 00280002 F8002002
+r 1F10.10
+*Want "SEBR/SEB F Ufl 1 FPCR"           00000002 F8001002 00000002 F8001002
+r 1F20.10
+*Want "SEBR/SEB F Ufl 2 FPCR"           00000002 F8001002 00000002 F8001002
+r 1F30.10
+*Want "SEBR/SEB F Nmin FPCR"            00000002 F8000002 00000002 F8000002
+r 1F40.10
+*Want "SEBR/SEB F Incr FPCR"            00080002 F8000C02 00080002 F8000C02
+r 1F50.10
+*Want "SEBR/SEB F Trun FPCR"            00080002 F8000802 00080002 F8000802
+
+
+# Short BFP rounding mode test results
+*Compare
+r 2000.10
+*Want "SEBR/SEB RM +NZ RNTE, RZ"        3F7FFFFF 3F7FFFFF 3F7FFFFF 3F7FFFFF
+r 2010.10
+*Want "SEBR/SEB RM +NZ RP, RM"          3F800000 3F800000 3F7FFFFF 3F7FFFFF
+r 2020.8
+*Want "SEBR/SEB RM +NZ RFS"             3F7FFFFF 3F7FFFFF  
+r 2030.10
+*Want "SEBR/SEB RM -NZ RNTE, RZ"        BF7FFFFF BF7FFFFF BF7FFFFF BF7FFFFF
+r 2040.10
+*Want "SEBR/SEB RM -NZ RP, RM"          BF7FFFFF BF7FFFFF BF800000 BF800000
+r 2050.8
+*Want "SEBR/SEB RM -NZ RFS"             BF7FFFFF BF7FFFFF  
+r 2060.10
+*Want "SEBR/SEB RM +NA RNTE, RZ"        3F800000 3F800000 3F7FFFFF 3F7FFFFF
+r 2070.10
+*Want "SEBR/SEB RM +NA RP, RM"          3F800000 3F800000 3F7FFFFF 3F7FFFFF
+r 2080.8
+*Want "SEBR/SEB RM +NA RFS"             3F7FFFFF 3F7FFFFF  
+r 2090.10
+*Want "SEBR/SEB RM -NA RNTE, RZ"        BF800000 BF800000 BF7FFFFF BF7FFFFF
+r 20A0.10
+*Want "SEBR/SEB RM -NA RP, RM"          BF7FFFFF BF7FFFFF BF800000 BF800000
+r 20B0.8
+*Want "SEBR/SEB RM -NA RFS"             BF7FFFFF BF7FFFFF  
+r 20C0.10
+*Want "SEBR/SEB RM +TZ RNTE, RZ"        3F7FFFFE 3F7FFFFE 3F7FFFFE 3F7FFFFE
+r 20D0.10
+*Want "SEBR/SEB RM +TZ RP, RM"          3F7FFFFF 3F7FFFFF 3F7FFFFE 3F7FFFFE
+r 20E0.8
+*Want "SEBR/SEB RM +TZ RFS"             3F7FFFFF 3F7FFFFF
+r 20F0.10
+*Want "SEBR/SEB RM -TZ RNTE, RZ"        BF7FFFFE BF7FFFFE BF7FFFFE BF7FFFFE
+r 2100.10
+*Want "SEBR/SEB RM -TZ RP, RM"          BF7FFFFE BF7FFFFE BF7FFFFF BF7FFFFF
+r 2110.8
+*Want "SEBR/SEB RM -TZ RFS"             BF7FFFFF BF7FFFFF
+r 2120.10
+*Want "SEBR/SEB RM +TA RNTE, RZ"        3F800000 3F800000 3F7FFFFF 3F7FFFFF
+r 2130.10
+*Want "SEBR/SEB RM +TA RP, RM"          3F800000 3F800000 3F7FFFFF 3F7FFFFF
+r 2140.8
+*Want "SEBR/SEB RM +TA RFS"             3F7FFFFF 3F7FFFFF  
+r 2150.10
+*Want "SEBR/SEB RM -TA RNTE, RZ"        BF800000 BF800000 BF7FFFFF BF7FFFFF
+r 2160.10
+*Want "SEBR/SEB RM -TA RP, RM"          BF7FFFFF BF7FFFFF BF800000 BF800000
+r 2170.8
+*Want "SEBR/SEB RM -TA RFS"             BF7FFFFF BF7FFFFF  
+
+
+# Short BFP rounding mode test results - FPCR
+*Compare
+r 2300.10
+*Want "SEBR/SEB RM +NZ RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 2310.10
+*Want "SEBR/SEB RM +NZ RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 2320.08
+*Want "SEBR/SEB RM +NZ RFS FPCR"        00080002 00080002  
+r 2330.10
+*Want "SEBR/SEB RM -NZ RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 2340.10
+*Want "SEBR/SEB RM -NZ RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 2350.08
+*Want "SEBR/SEB RM -NZ RFS FPCR"        00080001 00080001  
+r 2360.10
+*Want "SEBR/SEB RM +NA RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 2370.10
+*Want "SEBR/SEB RM +NA RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 2380.08
+*Want "SEBR/SEB RM +NA RFS FPCR"        00080002 00080002  
+r 2390.10
+*Want "SEBR/SEB RM -NA RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 23A0.10
+*Want "SEBR/SEB RM -NA RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 23B0.08
+*Want "SEBR/SEB RM -NA RFS FPCR"        00080001 00080001  
+r 23C0.10
+*Want "SEBR/SEB RM +TZ RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 23D0.10
+*Want "SEBR/SEB RM +TZ RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 23E0.08
+*Want "SEBR/SEB RM +TZ RFS FPCR"        00080002 00080002
+r 23F0.10
+*Want "SEBR/SEB RM -TZ RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 2400.10
+*Want "SEBR/SEB RM -TZ RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 2410.08
+*Want "SEBR/SEB RM -TZ RFS FPCR"        00080001 00080001
+r 2420.10
+*Want "SEBR/SEB RM +TA RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 2430.10
+*Want "SEBR/SEB RM +TA RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 2440.08
+*Want "SEBR/SEB RM +TA RFS FPCR"        00080002 00080002
+r 2450.10
+*Want "SEBR/SEB RM -TA RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 2460.10
+*Want "SEBR/SEB RM -TA RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 2470.08
+*Want "SEBR/SEB RM -TA RFS FPCR"        00080001 00080001
+
+
+# Long BFP non-finite test results
+*Compare
+r 4000.10
+*Want "SDBR NF -inf/-inf"               7FF80000 00000000 FFF00000 00000000
+r 4010.10
+*Want "SDB NF -inf/-inf"                7FF80000 00000000 FFF00000 00000000
+r 4020.10
+*Want "SDBR NF -inf/-2.0"               FFF00000 00000000 FFF00000 00000000
+r 4030.10
+*Want "SDB NF -inf/-2.0"                FFF00000 00000000 FFF00000 00000000
+r 4040.10
+*Want "SDBR NF -inf/-Dnice"             FFF00000 00000000 FFF00000 00000000
+r 4050.10
+*Want "SDB NF -inf/-Dnice"              FFF00000 00000000 FFF00000 00000000
+r 4060.10
+*Want "SDBR NF -inf/-0"                 FFF00000 00000000 FFF00000 00000000
+r 4070.10
+*Want "SDB NF -inf/-0"                  FFF00000 00000000 FFF00000 00000000
+r 4080.10
+*Want "SDBR NF -inf/+0"                 FFF00000 00000000 FFF00000 00000000
+r 4090.10
+*Want "SDB NF -inf/+0"                  FFF00000 00000000 FFF00000 00000000
+r 40A0.10
+*Want "SDBR NF -inf/+Dnice"             FFF00000 00000000 FFF00000 00000000
+r 40B0.10
+*Want "SDB NF -inf/+Dnice"              FFF00000 00000000 FFF00000 00000000
+r 40C0.10
+*Want "SDBR NF -inf/+2.0"               FFF00000 00000000 FFF00000 00000000
+r 40D0.10
+*Want "SDB NF -inf/+2.0"                FFF00000 00000000 FFF00000 00000000
+r 40E0.10
+*Want "SDBR NF -inf/+inf"               FFF00000 00000000 FFF00000 00000000
+r 40F0.10
+*Want "SDB NF -inf/+inf"                FFF00000 00000000 FFF00000 00000000
+r 4100.10
+*Want "SDBR NF -inf/-QNaN"              FFF8B000 00000000 FFF8B000 00000000
+r 4110.10
+*Want "SDB NF -inf/-QNaN"               FFF8B000 00000000 FFF8B000 00000000
+r 4120.10
+*Want "SDBR NF -inf/+SNaN"              7FF8A000 00000000 FFF00000 00000000
+r 4130.10
+*Want "SDB NF -inf/+SNaN"               7FF8A000 00000000 FFF00000 00000000
+r 4140.10
+*Want "SDBR NF -2.0/-inf"               7FF00000 00000000 7FF00000 00000000
+r 4150.10
+*Want "SDB NF -2.0/-inf"                7FF00000 00000000 7FF00000 00000000
+r 4160.10
+*Want "SDBR NF -2.0/-2.0"               00000000 00000000 00000000 00000000
+r 4170.10
+*Want "SDB NF -2.0/-2.0"                00000000 00000000 00000000 00000000
+r 4180.10
+*Want "SDBR NF -2.0/-Dnice"             C0000000 00000000 C0000000 00000000
+r 4190.10
+*Want "SDB NF -2.0/-Dnice"              C0000000 00000000 C0000000 00000000
+r 41A0.10
+*Want "SDBR NF -2.0/-0"                 C0000000 00000000 C0000000 00000000
+r 41B0.10
+*Want "SDB NF -2.0/-0"                  C0000000 00000000 C0000000 00000000
+r 41C0.10
+*Want "SDBR NF -2.0/+0"                 C0000000 00000000 C0000000 00000000
+r 41D0.10
+*Want "SDB NF -2.0/+0"                  C0000000 00000000 C0000000 00000000
+r 41E0.10
+*Want "SDBR NF -2.0/+Dnice"             C0000000 00000000 C0000000 00000000
+r 41F0.10
+*Want "SDB NF -2.0/+Dnice"              C0000000 00000000 C0000000 00000000
+r 4200.10
+*Want "SDBR NF -2.0/+2.0"               C0100000 00000000 C0100000 00000000
+r 4210.10
+*Want "SDB NF -2.0/+2.0"                C0100000 00000000 C0100000 00000000
+r 4220.10
+*Want "SDBR NF -2.0/+inf"               FFF00000 00000000 FFF00000 00000000
+r 4230.10
+*Want "SDB NF -2.0/+inf"                FFF00000 00000000 FFF00000 00000000
+r 4240.10
+*Want "SDBR NF -2.0/-QNaN"              FFF8B000 00000000 FFF8B000 00000000
+r 4250.10
+*Want "SDB NF -2.0/-QNaN"               FFF8B000 00000000 FFF8B000 00000000
+r 4260.10
+*Want "SDBR NF -2.0/+SNaN"              7FF8A000 00000000 C0000000 00000000
+r 4270.10
+*Want "SDB NF -2.0/+SNaN"               7FF8A000 00000000 C0000000 00000000
+r 4280.10
+*Want "SDBR NF -Dnice/-inf"             7FF00000 00000000 7FF00000 00000000
+r 4290.10
+*Want "SDB NF -Dnice/-inf"              7FF00000 00000000 7FF00000 00000000
+r 42A0.10
+*Want "SDBR NF -Dnice/-2.0"             40000000 00000000 40000000 00000000
+r 42B0.10
+*Want "SDB NF -Dnice/-2.0"              40000000 00000000 40000000 00000000
+r 42C0.10
+*Want "SDBR NF -Dnice/-Dnice"           00000000 00000000 00000000 00000000
+r 42D0.10
+*Want "SDB NF -Dnice/-Dnice"            00000000 00000000 00000000 00000000
+r 42E0.10
+*Want "SDBR NF -Dnice/-0"               80010000 00000000 DFD00000 00000000
+r 42F0.10
+*Want "SDB NF -Dnice/-0"                80010000 00000000 DFD00000 00000000
+r 4300.10
+*Want "SDBR NF -Dnice/+0"               80010000 00000000 DFD00000 00000000
+r 4310.10
+*Want "SDB NF -Dnice/+0"                80010000 00000000 DFD00000 00000000
+r 4320.10
+*Want "SDBR NF -Dnice/+Dnice"           80020000 00000000 DFE00000 00000000
+r 4330.10
+*Want "SDB NF -Dnice/+Dnice"            80020000 00000000 DFE00000 00000000
+r 4340.10
+*Want "SDBR NF -Dnice/+2.0"             C0000000 00000000 C0000000 00000000
+r 4350.10
+*Want "SDB NF -Dnice/+2.0"              C0000000 00000000 C0000000 00000000
+r 4360.10
+*Want "SDBR NF -Dnice/+inf"             FFF00000 00000000 FFF00000 00000000
+r 4370.10
+*Want "SDB NF -Dnice/+inf"              FFF00000 00000000 FFF00000 00000000
+r 4380.10
+*Want "SDBR NF -Dnice/-QNaN"            FFF8B000 00000000 FFF8B000 00000000
+r 4390.10
+*Want "SDB NF -Dnice/-QNaN"             FFF8B000 00000000 FFF8B000 00000000
+r 43A0.10
+*Want "SDBR NF -Dnice/+SNaN"            7FF8A000 00000000 80010000 00000000
+r 43B0.10
+*Want "SDB NF -Dnice/+SNaN"             7FF8A000 00000000 80010000 00000000
+r 43C0.10
+*Want "SDBR NF -0/-inf"                 7FF00000 00000000 7FF00000 00000000
+r 43D0.10
+*Want "SDB NF -0/-inf"                  7FF00000 00000000 7FF00000 00000000
+r 43E0.10
+*Want "SDBR NF -0/-2.0"                 40000000 00000000 40000000 00000000
+r 43F0.10
+*Want "SDB NF -0/-2.0"                  40000000 00000000 40000000 00000000
+r 4400.10
+*Want "SDBR NF -0/-Dnice"               00010000 00000000 5FD00000 00000000
+r 4410.10
+*Want "SDB NF -0/-Dnice"                00010000 00000000 5FD00000 00000000
+r 4420.10
+*Want "SDBR NF -0/-0"                   00000000 00000000 00000000 00000000
+r 4430.10
+*Want "SDB NF -0/-0"                    00000000 00000000 00000000 00000000
+r 4440.10
+*Want "SDBR NF -0/+0"                   80000000 00000000 80000000 00000000
+r 4450.10
+*Want "SDB NF -0/+0"                    80000000 00000000 80000000 00000000
+r 4460.10
+*Want "SDBR NF -0/+Dnice"               80010000 00000000 DFD00000 00000000
+r 4470.10
+*Want "SDB NF -0/+Dnice"                80010000 00000000 DFD00000 00000000
+r 4480.10
+*Want "SDBR NF -0/+2.0"                 C0000000 00000000 C0000000 00000000
+r 4490.10
+*Want "SDB NF -0/+2.0"                  C0000000 00000000 C0000000 00000000
+r 44A0.10
+*Want "SDBR NF -0/+inf"                 FFF00000 00000000 FFF00000 00000000
+r 44B0.10
+*Want "SDB NF -0/+inf"                  FFF00000 00000000 FFF00000 00000000
+r 44C0.10
+*Want "SDBR NF -0/-QNaN"                FFF8B000 00000000 FFF8B000 00000000
+r 44D0.10
+*Want "SDB NF -0/-QNaN"                 FFF8B000 00000000 FFF8B000 00000000
+r 44E0.10
+*Want "SDBR NF -0/+SNaN"                7FF8A000 00000000 80000000 00000000
+r 44F0.10
+*Want "SDB NF -0/+SNaN"                 7FF8A000 00000000 80000000 00000000
+r 4500.10
+*Want "SDBR NF +0/-inf"                 7FF00000 00000000 7FF00000 00000000
+r 4510.10
+*Want "SDB NF +0/-inf"                  7FF00000 00000000 7FF00000 00000000
+r 4520.10
+*Want "SDBR NF +0/-2.0"                 40000000 00000000 40000000 00000000
+r 4530.10
+*Want "SDB NF +0/-2.0"                  40000000 00000000 40000000 00000000
+r 4540.10
+*Want "SDBR NF +0/-Dnice"               00010000 00000000 5FD00000 00000000
+r 4550.10
+*Want "SDB NF +0/-Dnice"                00010000 00000000 5FD00000 00000000
+r 4560.10
+*Want "SDBR NF +0/-0"                   00000000 00000000 00000000 00000000
+r 4570.10
+*Want "SDB NF +0/-0"                    00000000 00000000 00000000 00000000
+r 4580.10
+*Want "SDBR NF +0/+0"                   00000000 00000000 00000000 00000000
+r 4590.10
+*Want "SDB NF +0/+0"                    00000000 00000000 00000000 00000000
+r 45A0.10
+*Want "SDBR NF +0/+Dnice"               80010000 00000000 DFD00000 00000000
+r 45B0.10
+*Want "SDB NF +0/+Dnice"                80010000 00000000 DFD00000 00000000
+r 45C0.10
+*Want "SDBR NF +0/+2.0"                 C0000000 00000000 C0000000 00000000
+r 45D0.10
+*Want "SDB NF +0/+2.0"                  C0000000 00000000 C0000000 00000000
+r 45E0.10
+*Want "SDBR NF +0/+inf"                 FFF00000 00000000 FFF00000 00000000
+r 45F0.10
+*Want "SDB NF +0/+inf"                  FFF00000 00000000 FFF00000 00000000
+r 4600.10
+*Want "SDBR NF +0/-QNaN"                FFF8B000 00000000 FFF8B000 00000000
+r 4610.10
+*Want "SDB NF +0/-QNaN"                 FFF8B000 00000000 FFF8B000 00000000
+r 4620.10
+*Want "SDBR NF +0/+SNaN"                7FF8A000 00000000 00000000 00000000
+r 4630.10
+*Want "SDB NF +0/+SNaN"                 7FF8A000 00000000 00000000 00000000
+r 4640.10
+*Want "SDBR NF +Dnice/-inf"             7FF00000 00000000 7FF00000 00000000
+r 4650.10
+*Want "SDB NF +Dnice/-inf"              7FF00000 00000000 7FF00000 00000000
+r 4660.10
+*Want "SDBR NF +Dnice/-2.0"             40000000 00000000 40000000 00000000
+r 4670.10
+*Want "SDB NF +Dnice/-2.0"              40000000 00000000 40000000 00000000
+r 4680.10
+*Want "SDBR NF +Dnice/-Dnice"           00020000 00000000 5FE00000 00000000
+r 4690.10
+*Want "SDB NF +Dnice/-Dnice"            00020000 00000000 5FE00000 00000000
+r 46A0.10
+*Want "SDBR NF +Dnice/-0"               00010000 00000000 5FD00000 00000000
+r 46B0.10
+*Want "SDB NF +Dnice/-0"                00010000 00000000 5FD00000 00000000
+r 46C0.10
+*Want "SDBR NF +Dnice/+0"               00010000 00000000 5FD00000 00000000
+r 46D0.10
+*Want "SDB NF +Dnice/+0"                00010000 00000000 5FD00000 00000000
+r 46E0.10
+*Want "SDBR NF +Dnice/+Dnice"           00000000 00000000 00000000 00000000
+r 46F0.10
+*Want "SDB NF +Dnice/+Dnice"            00000000 00000000 00000000 00000000
+r 4700.10
+*Want "SDBR NF +Dnice/+2.0"             C0000000 00000000 C0000000 00000000
+r 4710.10
+*Want "SDB NF +Dnice/+2.0"              C0000000 00000000 C0000000 00000000
+r 4720.10
+*Want "SDBR NF +Dnice/+inf"             FFF00000 00000000 FFF00000 00000000
+r 4730.10
+*Want "SDB NF +Dnice/+inf"              FFF00000 00000000 FFF00000 00000000
+r 4740.10
+*Want "SDBR NF +Dnice/-QNaN"            FFF8B000 00000000 FFF8B000 00000000
+r 4750.10
+*Want "SDB NF +Dnice/-QNaN"             FFF8B000 00000000 FFF8B000 00000000
+r 4760.10
+*Want "SDBR NF +Dnice/+SNaN"            7FF8A000 00000000 00010000 00000000
+r 4770.10
+*Want "SDB NF +Dnice/+SNaN"             7FF8A000 00000000 00010000 00000000
+r 4780.10
+*Want "SDBR NF +2.0/-inf"               7FF00000 00000000 7FF00000 00000000
+r 4790.10
+*Want "SDB NF +2.0/-inf"                7FF00000 00000000 7FF00000 00000000
+r 47A0.10
+*Want "SDBR NF +2.0/-2.0"               40100000 00000000 40100000 00000000
+r 47B0.10
+*Want "SDB NF +2.0/-2.0"                40100000 00000000 40100000 00000000
+r 47C0.10
+*Want "SDBR NF +2.0/-Dnice"             40000000 00000000 40000000 00000000
+r 47D0.10
+*Want "SDB NF +2.0/-Dnice"              40000000 00000000 40000000 00000000
+r 47E0.10
+*Want "SDBR NF +2.0/-0"                 40000000 00000000 40000000 00000000
+r 47F0.10
+*Want "SDB NF +2.0/-0"                  40000000 00000000 40000000 00000000
+r 4800.10
+*Want "SDBR NF +2.0/+0"                 40000000 00000000 40000000 00000000
+r 4810.10
+*Want "SDB NF +2.0/+0"                  40000000 00000000 40000000 00000000
+r 4820.10
+*Want "SDBR NF +2.0/+Dnice"             40000000 00000000 40000000 00000000
+r 4830.10
+*Want "SDB NF +2.0/+Dnice"              40000000 00000000 40000000 00000000
+r 4840.10
+*Want "SDBR NF +2.0/+2.0"               00000000 00000000 00000000 00000000
+r 4850.10
+*Want "SDB NF +2.0/+2.0"                00000000 00000000 00000000 00000000
+r 4860.10
+*Want "SDBR NF +2.0/+inf"               FFF00000 00000000 FFF00000 00000000
+r 4870.10
+*Want "SDB NF +2.0/+inf"                FFF00000 00000000 FFF00000 00000000
+r 4880.10
+*Want "SDBR NF +2.0/-QNaN"              FFF8B000 00000000 FFF8B000 00000000
+r 4890.10
+*Want "SDB NF +2.0/-QNaN"               FFF8B000 00000000 FFF8B000 00000000
+r 48A0.10
+*Want "SDBR NF +2.0/+SNaN"              7FF8A000 00000000 40000000 00000000
+r 48B0.10
+*Want "SDB NF +2.0/+SNaN"               7FF8A000 00000000 40000000 00000000
+r 48C0.10
+*Want "SDBR NF +inf/-inf"               7FF00000 00000000 7FF00000 00000000
+r 48D0.10
+*Want "SDB NF +inf/-inf"                7FF00000 00000000 7FF00000 00000000
+r 48E0.10
+*Want "SDBR NF +inf/-2.0"               7FF00000 00000000 7FF00000 00000000
+r 48F0.10
+*Want "SDB NF +inf/-2.0"                7FF00000 00000000 7FF00000 00000000
+r 4900.10
+*Want "SDBR NF +inf/-Dnice"             7FF00000 00000000 7FF00000 00000000
+r 4910.10
+*Want "SDB NF +inf/-Dnice"              7FF00000 00000000 7FF00000 00000000
+r 4920.10
+*Want "SDBR NF +inf/-0"                 7FF00000 00000000 7FF00000 00000000
+r 4930.10
+*Want "SDB NF +inf/-0"                  7FF00000 00000000 7FF00000 00000000
+r 4940.10
+*Want "SDBR NF +inf/+0"                 7FF00000 00000000 7FF00000 00000000
+r 4950.10
+*Want "SDB NF +inf/+0"                  7FF00000 00000000 7FF00000 00000000
+r 4960.10
+*Want "SDBR NF +inf/+Dnice"             7FF00000 00000000 7FF00000 00000000
+r 4970.10
+*Want "SDB NF +inf/+Dnice"              7FF00000 00000000 7FF00000 00000000
+r 4980.10
+*Want "SDBR NF +inf/+2.0"               7FF00000 00000000 7FF00000 00000000
+r 4990.10
+*Want "SDB NF +inf/+2.0"                7FF00000 00000000 7FF00000 00000000
+r 49A0.10
+*Want "SDBR NF +inf/+inf"               7FF80000 00000000 7FF00000 00000000
+r 49B0.10
+*Want "SDB NF +inf/+inf"                7FF80000 00000000 7FF00000 00000000
+r 49C0.10
+*Want "SDBR NF +inf/-QNaN"              FFF8B000 00000000 FFF8B000 00000000
+r 49D0.10
+*Want "SDB NF +inf/-QNaN"               FFF8B000 00000000 FFF8B000 00000000
+r 49E0.10
+*Want "SDBR NF +inf/+SNaN"              7FF8A000 00000000 7FF00000 00000000
+r 49F0.10
+*Want "SDB NF +inf/+SNaN"               7FF8A000 00000000 7FF00000 00000000
+r 4A00.10
+*Want "SDBR NF -QNaN/-inf"              FFF8B000 00000000 FFF8B000 00000000
+r 4A10.10
+*Want "SDB NF -QNaN/-inf"               FFF8B000 00000000 FFF8B000 00000000
+r 4A20.10
+*Want "SDBR NF -QNaN/-2.0"              FFF8B000 00000000 FFF8B000 00000000
+r 4A30.10
+*Want "SDB NF -QNaN/-2.0"               FFF8B000 00000000 FFF8B000 00000000
+r 4A40.10
+*Want "SDBR NF -QNaN/-Dnice"            FFF8B000 00000000 FFF8B000 00000000
+r 4A50.10
+*Want "SDB NF -QNaN/-Dnice"             FFF8B000 00000000 FFF8B000 00000000
+r 4A60.10
+*Want "SDBR NF -QNaN/-0"                FFF8B000 00000000 FFF8B000 00000000
+r 4A70.10
+*Want "SDB NF -QNaN/-0"                 FFF8B000 00000000 FFF8B000 00000000
+r 4A80.10
+*Want "SDBR NF -QNaN/+0"                FFF8B000 00000000 FFF8B000 00000000
+r 4A90.10
+*Want "SDB NF -QNaN/+0"                 FFF8B000 00000000 FFF8B000 00000000
+r 4AA0.10
+*Want "SDBR NF -QNaN/+Dnice"            FFF8B000 00000000 FFF8B000 00000000
+r 4AB0.10
+*Want "SDB NF -QNaN/+Dnice"             FFF8B000 00000000 FFF8B000 00000000
+r 4AC0.10
+*Want "SDBR NF -QNaN/+2.0"              FFF8B000 00000000 FFF8B000 00000000
+r 4AD0.10
+*Want "SDB NF -QNaN/+2.0"               FFF8B000 00000000 FFF8B000 00000000
+r 4AE0.10
+*Want "SDBR NF -QNaN/+inf"              FFF8B000 00000000 FFF8B000 00000000
+r 4AF0.10
+*Want "SDB NF -QNaN/+inf"               FFF8B000 00000000 FFF8B000 00000000
+r 4B00.10
+*Want "SDBR NF -QNaN/-QNaN"             FFF8B000 00000000 FFF8B000 00000000
+r 4B10.10
+*Want "SDB NF -QNaN/-QNaN"              FFF8B000 00000000 FFF8B000 00000000
+r 4B20.10
+*Want "SDBR NF -QNaN/+SNaN"             7FF8A000 00000000 FFF8B000 00000000
+r 4B30.10
+*Want "SDB NF -QNaN/+SNaN"              7FF8A000 00000000 FFF8B000 00000000
+r 4B40.10
+*Want "SDBR NF +SNaN/-inf"              7FF8A000 00000000 7FF0A000 00000000
+r 4B50.10
+*Want "SDB NF +SNaN/-inf"               7FF8A000 00000000 7FF0A000 00000000
+r 4B60.10
+*Want "SDBR NF +SNaN/-2.0"              7FF8A000 00000000 7FF0A000 00000000
+r 4B70.10
+*Want "SDB NF +SNaN/-2.0"               7FF8A000 00000000 7FF0A000 00000000
+r 4B80.10
+*Want "SDBR NF +SNaN/-Dnice"            7FF8A000 00000000 7FF0A000 00000000
+r 4B90.10
+*Want "SDB NF +SNaN/-Dnice"             7FF8A000 00000000 7FF0A000 00000000
+r 4BA0.10
+*Want "SDBR NF +SNaN/-0"                7FF8A000 00000000 7FF0A000 00000000
+r 4BB0.10
+*Want "SDB NF +SNaN/-0"                 7FF8A000 00000000 7FF0A000 00000000
+r 4BC0.10
+*Want "SDBR NF +SNaN/+0"                7FF8A000 00000000 7FF0A000 00000000
+r 4BD0.10
+*Want "SDB NF +SNaN/+0"                 7FF8A000 00000000 7FF0A000 00000000
+r 4BE0.10
+*Want "SDBR NF +SNaN/+Dnice"            7FF8A000 00000000 7FF0A000 00000000
+r 4BF0.10
+*Want "SDB NF +SNaN/+Dnice"             7FF8A000 00000000 7FF0A000 00000000
+r 4C00.10
+*Want "SDBR NF +SNaN/+2.0"              7FF8A000 00000000 7FF0A000 00000000
+r 4C10.10
+*Want "SDB NF +SNaN/+2.0"               7FF8A000 00000000 7FF0A000 00000000
+r 4C20.10
+*Want "SDBR NF +SNaN/+inf"              7FF8A000 00000000 7FF0A000 00000000
+r 4C30.10
+*Want "SDB NF +SNaN/+inf"               7FF8A000 00000000 7FF0A000 00000000
+r 4C40.10
+*Want "SDBR NF +SNaN/-QNaN"             7FF8A000 00000000 7FF0A000 00000000
+r 4C50.10
+*Want "SDB NF +SNaN/-QNaN"              7FF8A000 00000000 7FF0A000 00000000
+r 4C60.10
+*Want "SDBR NF +SNaN/+SNaN"             7FF8A000 00000000 7FF0A000 00000000
+r 4C70.10
+*Want "SDB NF +SNaN/+SNaN"              7FF8A000 00000000 7FF0A000 00000000
+
+
+# Long BFP non-finite test results - FPCR
+*Compare
+r 4D00.10
+*Want "SDBR/SDB NF -inf/-inf FPCR"      00800003 F8008003 00800003 F8008003
+r 4D10.10
+*Want "SDBR/SDB NF -inf/-2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 4D20.10
+*Want "SDBR/SDB NF -inf/-Dnice FPCR"    00000001 F8000001 00000001 F8000001
+r 4D30.10
+*Want "SDBR/SDB NF -inf/-0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4D40.10
+*Want "SDBR/SDB NF -inf/+0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4D50.10
+*Want "SDBR/SDB NF -inf/+Dnice FPCR"    00000001 F8000001 00000001 F8000001
+r 4D60.10
+*Want "SDBR/SDB NF -inf/+2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 4D70.10
+*Want "SDBR/SDB NF -inf/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 4D80.10
+*Want "SDBR/SDB NF -inf/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 4D90.10
+*Want "SDBR/SDB NF -inf/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 4DA0.10
+*Want "SDBR/SDB NF -2.0/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 4DB0.10
+*Want "SDBR/SDB NF -2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4DC0.10
+*Want "SDBR/SDB NF -2.0/-Dnice FPCR"    00080001 F8000C01 00080001 F8000C01
+r 4DD0.10
+*Want "SDBR/SDB NF -2.0/-0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4DE0.10
+*Want "SDBR/SDB NF -2.0/+0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4DF0.10
+*Want "SDBR/SDB NF -2.0/+Dnice FPCR"    00080001 F8000801 00080001 F8000801
+r 4E00.10
+*Want "SDBR/SDB NF -2.0/+2.0 FPCR"      00000001 F8000001 00000001 F8000001
+r 4E10.10
+*Want "SDBR/SDB NF -2.0/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 4E20.10
+*Want "SDBR/SDB NF -2.0/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 4E30.10
+*Want "SDBR/SDB NF -2.0/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 4E40.10
+*Want "SDBR/SDB NF -Dnice/-inf FPCR"    00000002 F8000002 00000002 F8000002
+r 4E50.10
+*Want "SDBR/SDB NF -Dnice/-2.0 FPCR"    00080002 F8000C02 00080002 F8000C02
+r 4E60.10
+*Want "SDBR/SDB NF -Dnice/-Dnice FPCR"  00000000 F8000000 00000000 F8000000
+r 4E70.10
+*Want "SDBR/SDB NF -Dnice/-0 FPCR"      00000001 F8001001 00000001 F8001001
+r 4E80.10
+*Want "SDBR/SDB NF -Dnice/+0 FPCR"      00000001 F8001001 00000001 F8001001
+r 4E90.10
+*Want "SDBR/SDB NF -Dnice/+Dnice FPCR"  00000001 F8001001 00000001 F8001001
+r 4EA0.10
+*Want "SDBR/SDB NF -Dnice/+2.0 FPCR"    00080001 F8000801 00080001 F8000801
+r 4EB0.10
+*Want "SDBR/SDB NF -Dnice/+inf FPCR"    00000001 F8000001 00000001 F8000001
+r 4EC0.10
+*Want "SDBR/SDB NF -Dnice/-QNaN FPCR"   00000003 F8000003 00000003 F8000003
+r 4ED0.10
+*Want "SDBR/SDB NF -Dnice/+SNaN FPCR"   00800003 F8008003 00800003 F8008003
+r 4EE0.10
+*Want "SDBR/SDB NF -0/-inf FPCR"        00000002 F8000002 00000002 F8000002
+r 4EF0.10
+*Want "SDBR/SDB NF -0/-2.0 FPCR"        00000002 F8000002 00000002 F8000002
+r 4F00.10
+*Want "SDBR/SDB NF -0/-Dnice FPCR"      00000002 F8001002 00000002 F8001002
+r 4F10.10
+*Want "SDBR/SDB NF -0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 4F20.10
+*Want "SDBR/SDB NF -0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 4F30.10
+*Want "SDBR/SDB NF -0/+Dnice FPCR"      00000001 F8001001 00000001 F8001001
+r 4F40.10
+*Want "SDBR/SDB NF -0/+2.0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4F50.10
+*Want "SDBR/SDB NF -0/+inf FPCR"        00000001 F8000001 00000001 F8000001
+r 4F60.10
+*Want "SDBR/SDB NF -0/-QNaN FPCR"       00000003 F8000003 00000003 F8000003
+r 4F70.10
+*Want "SDBR/SDB NF -0/+SNaN FPCR"       00800003 F8008003 00800003 F8008003
+r 4F80.10
+*Want "SDBR/SDB NF +0/-inf FPCR"        00000002 F8000002 00000002 F8000002
+r 4F90.10
+*Want "SDBR/SDB NF +0/-2.0 FPCR"        00000002 F8000002 00000002 F8000002
+r 4FA0.10
+*Want "SDBR/SDB NF +0/-Dnice FPCR"      00000002 F8001002 00000002 F8001002
+r 4FB0.10
+*Want "SDBR/SDB NF +0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 4FC0.10
+*Want "SDBR/SDB NF +0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 4FD0.10
+*Want "SDBR/SDB NF +0/+Dnice FPCR"      00000001 F8001001 00000001 F8001001
+r 4FE0.10
+*Want "SDBR/SDB NF +0/+2.0 FPCR"        00000001 F8000001 00000001 F8000001
+r 4FF0.10
+*Want "SDBR/SDB NF +0/+inf FPCR"        00000001 F8000001 00000001 F8000001
+r 5000.10
+*Want "SDBR/SDB NF +0/-QNaN FPCR"       00000003 F8000003 00000003 F8000003
+r 5010.10
+*Want "SDBR/SDB NF +0/+SNaN FPCR"       00800003 F8008003 00800003 F8008003
+r 5020.10
+*Want "SDBR/SDB NF +Dnice/-inf FPCR"    00000002 F8000002 00000002 F8000002
+r 5030.10
+*Want "SDBR/SDB NF +Dnice/-2.0 FPCR"    00080002 F8000802 00080002 F8000802
+r 5040.10
+*Want "SDBR/SDB NF +Dnice/-Dnice FPCR"  00000002 F8001002 00000002 F8001002
+r 5050.10
+*Want "SDBR/SDB NF +Dnice/-0 FPCR"      00000002 F8001002 00000002 F8001002
+r 5060.10
+*Want "SDBR/SDB NF +Dnice/+0 FPCR"      00000002 F8001002 00000002 F8001002
+r 5070.10
+*Want "SDBR/SDB NF +Dnice/+Dnice FPCR"  00000000 F8000000 00000000 F8000000
+r 5080.10
+*Want "SDBR/SDB NF +Dnice/+2.0 FPCR"    00080001 F8000C01 00080001 F8000C01
+r 5090.10
+*Want "SDBR/SDB NF +Dnice/+inf FPCR"    00000001 F8000001 00000001 F8000001
+r 50A0.10
+*Want "SDBR/SDB NF +Dnice/-QNaN FPCR"   00000003 F8000003 00000003 F8000003
+r 50B0.10
+*Want "SDBR/SDB NF +Dnice/+SNaN FPCR"   00800003 F8008003 00800003 F8008003
+r 50C0.10
+*Want "SDBR/SDB NF +2.0/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 50D0.10
+*Want "SDBR/SDB NF +2.0/-2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 50E0.10
+*Want "SDBR/SDB NF +2.0/-Dnice FPCR"    00080002 F8000802 00080002 F8000802
+r 50F0.10
+*Want "SDBR/SDB NF +2.0/-0 FPCR"        00000002 F8000002 00000002 F8000002
+r 5100.10
+*Want "SDBR/SDB NF +2.0/+0 FPCR"        00000002 F8000002 00000002 F8000002
+r 5110.10
+*Want "SDBR/SDB NF +2.0/+Dnice FPCR"    00080002 F8000C02 00080002 F8000C02
+r 5120.10
+*Want "SDBR/SDB NF +2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 5130.10
+*Want "SDBR/SDB NF +2.0/+inf FPCR"      00000001 F8000001 00000001 F8000001
+r 5140.10
+*Want "SDBR/SDB NF +2.0/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 5150.10
+*Want "SDBR/SDB NF +2.0/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 5160.10
+*Want "SDBR/SDB NF +inf/-inf FPCR"      00000002 F8000002 00000002 F8000002
+r 5170.10
+*Want "SDBR/SDB NF +inf/-2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 5180.10
+*Want "SDBR/SDB NF +inf/-Dnice FPCR"    00000002 F8000002 00000002 F8000002
+r 5190.10
+*Want "SDBR/SDB NF +inf/-0 FPCR"        00000002 F8000002 00000002 F8000002
+r 51A0.10
+*Want "SDBR/SDB NF +inf/+0 FPCR"        00000002 F8000002 00000002 F8000002
+r 51B0.10
+*Want "SDBR/SDB NF +inf/+Dnice FPCR"    00000002 F8000002 00000002 F8000002
+r 51C0.10
+*Want "SDBR/SDB NF +inf/+2.0 FPCR"      00000002 F8000002 00000002 F8000002
+r 51D0.10
+*Want "SDBR/SDB NF +inf/+inf FPCR"      00800003 F8008003 00800003 F8008003
+r 51E0.10
+*Want "SDBR/SDB NF +inf/-QNaN FPCR"     00000003 F8000003 00000003 F8000003
+r 51F0.10
+*Want "SDBR/SDB NF +inf/+SNaN FPCR"     00800003 F8008003 00800003 F8008003
+r 5200.10
+*Want "SDBR/SDB NF -QNaN/-inf FPCR"     00000003 F8000003 00000003 F8000003
+r 5210.10
+*Want "SDBR/SDB NF -QNaN/-2.0 FPCR"     00000003 F8000003 00000003 F8000003
+r 5220.10
+*Want "SDBR/SDB NF -QNaN/-Dnice FPCR"   00000003 F8000003 00000003 F8000003
+r 5230.10
+*Want "SDBR/SDB NF -QNaN/-0 FPCR"       00000003 F8000003 00000003 F8000003
+r 5240.10
+*Want "SDBR/SDB NF -QNaN/+0 FPCR"       00000003 F8000003 00000003 F8000003
+r 5250.10
+*Want "SDBR/SDB NF -QNaN/+Dnice FPCR"   00000003 F8000003 00000003 F8000003
+r 5260.10
+*Want "SDBR/SDB NF -QNaN/+2.0 FPCR"     00000003 F8000003 00000003 F8000003
+r 5270.10
+*Want "SDBR/SDB NF -QNaN/+inf FPCR"     00000003 F8000003 00000003 F8000003
+r 5280.10
+*Want "SDBR/SDB NF -QNaN/-QNaN FPCR"    00000003 F8000003 00000003 F8000003
+r 5290.10
+*Want "SDBR/SDB NF -QNaN/+SNaN FPCR"    00800003 F8008003 00800003 F8008003
+r 52A0.10
+*Want "SDBR/SDB NF +SNaN/-inf FPCR"     00800003 F8008003 00800003 F8008003
+r 52B0.10
+*Want "SDBR/SDB NF +SNaN/-2.0 FPCR"     00800003 F8008003 00800003 F8008003
+r 52C0.10
+*Want "SDBR/SDB NF +SNaN/-Dnice FPCR"   00800003 F8008003 00800003 F8008003
+r 52D0.10
+*Want "SDBR/SDB NF +SNaN/-0 FPCR"       00800003 F8008003 00800003 F8008003
+r 52E0.10
+*Want "SDBR/SDB NF +SNaN/+0 FPCR"       00800003 F8008003 00800003 F8008003
+r 52F0.10
+*Want "SDBR/SDB NF +SNaN/+Dnice FPCR"   00800003 F8008003 00800003 F8008003
+r 5300.10
+*Want "SDBR/SDB NF +SNaN/+2.0 FPCR"     00800003 F8008003 00800003 F8008003
+r 5310.10
+*Want "SDBR/SDB NF +SNaN/+inf FPCR"     00800003 F8008003 00800003 F8008003
+r 5320.10
+*Want "SDBR/SDB NF +SNaN/-QNaN FPCR"    00800003 F8008003 00800003 F8008003
+r 5330.10
+*Want "SDBR/SDB NF +SNaN/+SNaN FPCR"    00800003 F8008003 00800003 F8008003
+
+
+# Long BFP finite test results
+*Compare
+r 5400.10
+*Want "SDBR F Ovfl"                     7FFFFFFF FFFFFFFF 7FFFFFFF FFFFFFFF
+r 5410.10
+*Want "SDB F Ovfl"                      7FFFFFFF FFFFFFFF 7FFFFFFF FFFFFFFF
+r 5420.10
+*Want "SDBR F Ufl 1"                    000FFFFF FFFFFFFF 600FFFFF FFFFFFFE
+r 5430.10
+*Want "SDB F Ufl 1"                     000FFFFF FFFFFFFF 600FFFFF FFFFFFFE
+r 5440.10
+*Want "SDBR F Ufl 2"                    00070F10 00000000 5FFC3C40 00000000
+r 5450.10
+*Want "SDB F Ufl 2"                     00070F10 00000000 5FFC3C40 00000000
+r 5460.10
+*Want "SDBR F Nmin"                     00100000 00000000 00100000 00000000
+r 5470.10
+*Want "SDB F Nmin"                      00100000 00000000 00100000 00000000
+r 5480.10
+*Want "SDBR F Incr"                     3FF00000 00000000 3FF00000 00000000
+r 5490.10
+*Want "SDB F Incr"                      3FF00000 00000000 3FF00000 00000000
+r 54A0.10
+*Want "SDBR F Trun"                     3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 54B0.10
+*Want "SDB F Trun"                      3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+
+
+# Long BFP finite test results - FPCR
+*Compare
+r 5600.10
+*Want "SDBR/SDB F Ovfl FPCR"            00000003 F8000003 00000003 F8000003
+r 5610.10
+*Want "SDBR/SDB F Ufl 1 FPCR"           00000002 F8001002 00000002 F8001002
+r 5620.10
+*Want "SDBR/SDB F Ufl 2 FPCR"           00000002 F8001002 00000002 F8001002
+r 5630.10
+*Want "SDBR/SDB F Nmin FPCR"            00000002 F8000002 00000002 F8000002
+r 5640.10
+*Want "SDBR/SDB F Incr FPCR"            00080002 F8000C02 00080002 F8000C02
+r 5650.10
+*Want "SDBR/SDB F Trun FPCR"            00080002 F8000802 00080002 F8000802
+
+
+# Long BFP rounding mode test results
+*Compare
+r 5700.10
+*Want "SDBR/SDB RM +NZ  RNTE"           3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5710.10
+*Want "SDBR/SDB RM +NZ  RZ"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5720.10
+*Want "SDBR/SDB RM +NZ  RP"             3FF00000 00000000 3FF00000 00000000
+r 5730.10
+*Want "SDBR/SDB RM +NZ  RM"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5740.10
+*Want "SDBR/SDB RM +NZ  RFS"            3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5750.10
+*Want "SDBR/SDB RM -NZ  RNTE"           BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5760.10
+*Want "SDBR/SDB RM -NZ  RZ"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5770.10
+*Want "SDBR/SDB RM -NZ  RP"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5780.10
+*Want "SDBR/SDB RM -NZ  RM"             BFF00000 00000000 BFF00000 00000000
+r 5790.10
+*Want "SDBR/SDB RM -NZ  RFS"            BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 57A0.10
+*Want "SDBR/SDB RM +NA  RNTE"           3FF00000 00000000 3FF00000 00000000
+r 57B0.10
+*Want "SDBR/SDB RM +NA  RZ"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 57C0.10
+*Want "SDBR/SDB RM +NA  RP"             3FF00000 00000000 3FF00000 00000000
+r 57D0.10
+*Want "SDBR/SDB RM +NA  RM"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 57E0.10
+*Want "SDBR/SDB RM +NA  RFS"            3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 57F0.10
+*Want "SDBR/SDB RM -NA  RNTE"           BFF00000 00000000 BFF00000 00000000
+r 5800.10
+*Want "SDBR/SDB RM -NA  RZ"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5810.10
+*Want "SDBR/SDB RM -NA  RP"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5820.10
+*Want "SDBR/SDB RM -NA  RM"             BFF00000 00000000 BFF00000 00000000
+r 5830.10
+*Want "SDBR/SDB RM -NA  RFS"            BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5840.10
+*Want "SDBR/SDB RM +TZ  RNTE"           3FEFFFFF FFFFFFFE 3FEFFFFF FFFFFFFE
+r 5850.10
+*Want "SDBR/SDB RM +TZ  RZ"             3FEFFFFF FFFFFFFE 3FEFFFFF FFFFFFFE
+r 5860.10
+*Want "SDBR/SDB RM +TZ  RP"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5870.10
+*Want "SDBR/SDB RM +TZ  RM"             3FEFFFFF FFFFFFFE 3FEFFFFF FFFFFFFE
+r 5880.10
+*Want "SDBR/SDB RM +TZ  RFS"            3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5890.10
+*Want "SDBR/SDB RM -TZ  RNTE"           BFEFFFFF FFFFFFFE BFEFFFFF FFFFFFFE
+r 58A0.10
+*Want "SDBR/SDB RM -TZ  RZ"             BFEFFFFF FFFFFFFE BFEFFFFF FFFFFFFE
+r 58B0.10
+*Want "SDBR/SDB RM -TZ  RP"             BFEFFFFF FFFFFFFE BFEFFFFF FFFFFFFE
+r 58C0.10
+*Want "SDBR/SDB RM -TZ  RM"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 58D0.10
+*Want "SDBR/SDB RM -TZ  RFS"            BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 58E0.10
+*Want "SDBR/SDB RM +TA  RNTE"           3FF00000 00000000 3FF00000 00000000
+r 58F0.10
+*Want "SDBR/SDB RM +TA  RZ"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5900.10
+*Want "SDBR/SDB RM +TA  RP"             3FF00000 00000000 3FF00000 00000000
+r 5910.10
+*Want "SDBR/SDB RM +TA  RM"             3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5920.10
+*Want "SDBR/SDB RM +TA  RFS"            3FEFFFFF FFFFFFFF 3FEFFFFF FFFFFFFF
+r 5930.10
+*Want "SDBR/SDB RM -TA  RNTE"           BFF00000 00000000 BFF00000 00000000
+r 5940.10
+*Want "SDBR/SDB RM -TA  RZ"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5950.10
+*Want "SDBR/SDB RM -TA  RP"             BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+r 5960.10
+*Want "SDBR/SDB RM -TA  RM"             BFF00000 00000000 BFF00000 00000000
+r 5970.10
+*Want "SDBR/SDB RM -TA  RFS"            BFEFFFFF FFFFFFFF BFEFFFFF FFFFFFFF
+
+
+# Long BFP rounding mode test results - FPCR
+*Compare
+r 5C00.10
+*Want "SDBR/SDB RM +NZ RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 5C10.10
+*Want "SDBR/SDB RM +NZ RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 5C20.8
+*Want "SDBR/SDB RM +NZ RFS FPCR"        00080002 00080002
+r 5C30.10
+*Want "SDBR/SDB RM +NZ RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 5C40.10
+*Want "SDBR/SDB RM +NZ RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 5C50.8
+*Want "SDBR/SDB RM -NZ RFS FPCR"        00080001 00080001  
+r 5C60.10
+*Want "SDBR/SDB RM -NZ RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 5C70.10
+*Want "SDBR/SDB RM -NZ RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 5C80.8
+*Want "SDBR/SDB RM -NZ RFS FPCR"        00080002 00080002  
+r 5C90.10
+*Want "SDBR/SDB RM -NZ RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 5CA0.10
+*Want "SDBR/SDB RM -NA RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 5CB0.8
+*Want "SDBR/SDB RM -NA RFS FPCR"        00080001 00080001
+r 5CC0.10
+*Want "SDBR/SDB RM +TZ RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 5CD0.10
+*Want "SDBR/SDB RM +TZ RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 5CE0.8
+*Want "SDBR/SDB RM +TZ RFS FPCR"        00080002 00080002
+r 5CF0.10
+*Want "SDBR/SDB RM -TZ RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 5D00.10
+*Want "SDBR/SDB RM -TZ RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 5D10.8
+*Want "SDBR/SDB RM -TZ RFS FPCR"        00080001 00080001
+r 5D20.10
+*Want "SDBR/SDB RM +TA RNTE, RZ FPCR"   00080002 00080002 00080002 00080002
+r 5D30.10
+*Want "SDBR/SDB RM +TA RP, RM FPCR"     00080002 00080002 00080002 00080002
+r 5D40.8
+*Want "SDBR/SDB RM +TA RFS FPCR"        00080002 00080002
+r 5D50.10
+*Want "SDBR/SDB RM -TA RNTE, RZ FPCR"   00080001 00080001 00080001 00080001
+r 5D60.10
+*Want "SDBR/SDB RM -TA RP, RM FPCR"     00080001 00080001 00080001 00080001
+r 5D70.8
+*Want "SDBR/SDB RM -TA RFS FPCR"        00080001 00080001
+
+
+# Extended BFP non-finite test results
+*Compare
+r 8000.10
+*Want "SXBR NF -inf/-inf NT"            7FFF8000 00000000 00000000 00000000
+r 8010.10
+*Want "SXBR NF -inf/-inf Tr"            FFFF0000 00000000 00000000 00000000
+r 8020.10
+*Want "SXBR NF -inf/-2.0 NT"            FFFF0000 00000000 00000000 00000000
+r 8030.10
+*Want "SXBR NF -inf/-2.0 Tr"            FFFF0000 00000000 00000000 00000000
+r 8040.10
+*Want "SXBR NF -inf/-Dnice NT"          FFFF0000 00000000 00000000 00000000
+r 8050.10
+*Want "SXBR NF -inf/-Dnice Tr"          FFFF0000 00000000 00000000 00000000
+r 8060.10
+*Want "SXBR NF -inf/-0 NT"              FFFF0000 00000000 00000000 00000000
+r 8070.10
+*Want "SXBR NF -inf/-0 Tr"              FFFF0000 00000000 00000000 00000000
+r 8080.10
+*Want "SXBR NF -inf/+0 NT"              FFFF0000 00000000 00000000 00000000
+r 8090.10
+*Want "SXBR NF -inf/+0 Tr"              FFFF0000 00000000 00000000 00000000
+r 80A0.10
+*Want "SXBR NF -inf/+Dnice NT"          FFFF0000 00000000 00000000 00000000
+r 80B0.10
+*Want "SXBR NF -inf/+Dnice Tr"          FFFF0000 00000000 00000000 00000000
+r 80C0.10
+*Want "SXBR NF -inf/+2.0 NT"            FFFF0000 00000000 00000000 00000000
+r 80D0.10
+*Want "SXBR NF -inf/+2.0 Tr"            FFFF0000 00000000 00000000 00000000
+r 80E0.10
+*Want "SXBR NF -inf/+inf NT"            FFFF0000 00000000 00000000 00000000
+r 80F0.10
+*Want "SXBR NF -inf/+inf Tr"            FFFF0000 00000000 00000000 00000000
+r 8100.10
+*Want "SXBR NF -inf/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 8110.10
+*Want "SXBR NF -inf/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 8120.10
+*Want "SXBR NF -inf/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 8130.10
+*Want "SXBR NF -inf/+SNaN Tr"           FFFF0000 00000000 00000000 00000000
+r 8140.10
+*Want "SXBR NF -2.0/-inf NT"            7FFF0000 00000000 00000000 00000000
+r 8150.10
+*Want "SXBR NF -2.0/-inf Tr"            7FFF0000 00000000 00000000 00000000
+r 8160.10
+*Want "SXBR NF -2.0/-2.0 NT"            00000000 00000000 00000000 00000000
+r 8170.10
+*Want "SXBR NF -2.0/-2.0 Tr"            00000000 00000000 00000000 00000000
+r 8180.10
+*Want "SXBR NF -2.0/-Dnice NT"          C0000000 00000000 00000000 00000000
+r 8190.10
+*Want "SXBR NF -2.0/-Dnice Tr"          C0000000 00000000 00000000 00000000
+r 81A0.10
+*Want "SXBR NF -2.0/-0 NT"              C0000000 00000000 00000000 00000000
+r 81B0.10
+*Want "SXBR NF -2.0/-0 Tr"              C0000000 00000000 00000000 00000000
+r 81C0.10
+*Want "SXBR NF -2.0/+0 NT"              C0000000 00000000 00000000 00000000
+r 81D0.10
+*Want "SXBR NF -2.0/+0 Tr"              C0000000 00000000 00000000 00000000
+r 81E0.10
+*Want "SXBR NF -2.0/+Dnice NT"          C0000000 00000000 00000000 00000000
+r 81F0.10
+*Want "SXBR NF -2.0/+Dnice Tr"          C0000000 00000000 00000000 00000000
+r 8200.10
+*Want "SXBR NF -2.0/+2.0 NT"            C0010000 00000000 00000000 00000000
+r 8210.10
+*Want "SXBR NF -2.0/+2.0 Tr"            C0010000 00000000 00000000 00000000
+r 8220.10
+*Want "SXBR NF -2.0/+inf NT"            FFFF0000 00000000 00000000 00000000
+r 8230.10
+*Want "SXBR NF -2.0/+inf Tr"            FFFF0000 00000000 00000000 00000000
+r 8240.10
+*Want "SXBR NF -2.0/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 8250.10
+*Want "SXBR NF -2.0/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 8260.10
+*Want "SXBR NF -2.0/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 8270.10
+*Want "SXBR NF -2.0/+SNaN Tr"           C0000000 00000000 00000000 00000000
+r 8280.10
+*Want "SXBR NF -Dnice/-inf NT"          7FFF0000 00000000 00000000 00000000
+r 8290.10
+*Want "SXBR NF -Dnice/-inf Tr"          7FFF0000 00000000 00000000 00000000
+r 82A0.10
+*Want "SXBR NF -Dnice/-2.0 NT"          40000000 00000000 00000000 00000000
+r 82B0.10
+*Want "SXBR NF -Dnice/-2.0 Tr"          40000000 00000000 00000000 00000000
+r 82C0.10
+*Want "SXBR NF -Dnice/-Dnice NT"        00000000 00000000 00000000 00000000
+r 82D0.10
+*Want "SXBR NF -Dnice/-Dnice Tr"        00000000 00000000 00000000 00000000
+r 82E0.10
+*Want "SXBR NF -Dnice/-0 NT"            80001000 00000000 00000000 00000000
+r 82F0.10
+*Want "SXBR NF -Dnice/-0 Tr"            DFFD0000 00000000 00000000 00000000
+r 8300.10
+*Want "SXBR NF -Dnice/+0 NT"            80001000 00000000 00000000 00000000
+r 8310.10
+*Want "SXBR NF -Dnice/+0 Tr"            DFFD0000 00000000 00000000 00000000
+r 8320.10
+*Want "SXBR NF -Dnice/+Dnice NT"        80002000 00000000 00000000 00000000
+r 8330.10
+*Want "SXBR NF -Dnice/+Dnice Tr"        DFFE0000 00000000 00000000 00000000
+r 8340.10
+*Want "SXBR NF -Dnice/+2.0 NT"          C0000000 00000000 00000000 00000000
+r 8350.10
+*Want "SXBR NF -Dnice/+2.0 Tr"          C0000000 00000000 00000000 00000000
+r 8360.10
+*Want "SXBR NF -Dnice/+inf NT"          FFFF0000 00000000 00000000 00000000
+r 8370.10
+*Want "SXBR NF -Dnice/+inf Tr"          FFFF0000 00000000 00000000 00000000
+r 8380.10
+*Want "SXBR NF -Dnice/-QNaN NT"         FFFF8B00 00000000 00000000 00000000
+r 8390.10
+*Want "SXBR NF -Dnice/-QNaN Tr"         FFFF8B00 00000000 00000000 00000000
+r 83A0.10
+*Want "SXBR NF -Dnice/+SNaN NT"         7FFF8A00 00000000 00000000 00000000
+r 83B0.10
+*Want "SXBR NF -Dnice/+SNaN Tr"         80001000 00000000 00000000 00000000
+r 83C0.10
+*Want "SXBR NF -0/-inf NT"              7FFF0000 00000000 00000000 00000000
+r 83D0.10
+*Want "SXBR NF -0/-inf Tr"              7FFF0000 00000000 00000000 00000000
+r 83E0.10
+*Want "SXBR NF -0/-2.0 NT"              40000000 00000000 00000000 00000000
+r 83F0.10
+*Want "SXBR NF -0/-2.0 Tr"              40000000 00000000 00000000 00000000
+r 8400.10
+*Want "SXBR NF -0/-Dnice NT"            00001000 00000000 00000000 00000000
+r 8410.10
+*Want "SXBR NF -0/-Dnice Tr"            5FFD0000 00000000 00000000 00000000
+r 8420.10
+*Want "SXBR NF -0/-0 NT"                00000000 00000000 00000000 00000000
+r 8430.10
+*Want "SXBR NF -0/-0 Tr"                00000000 00000000 00000000 00000000
+r 8440.10
+*Want "SXBR NF -0/+0 NT"                80000000 00000000 00000000 00000000
+r 8450.10
+*Want "SXBR NF -0/+0 Tr"                80000000 00000000 00000000 00000000
+r 8460.10
+*Want "SXBR NF -0/+Dnice NT"            80001000 00000000 00000000 00000000
+r 8470.10
+*Want "SXBR NF -0/+Dnice Tr"            DFFD0000 00000000 00000000 00000000
+r 8480.10
+*Want "SXBR NF -0/+2.0 NT"              C0000000 00000000 00000000 00000000
+r 8490.10
+*Want "SXBR NF -0/+2.0 Tr"              C0000000 00000000 00000000 00000000
+r 84A0.10
+*Want "SXBR NF -0/+inf NT"              FFFF0000 00000000 00000000 00000000
+r 84B0.10
+*Want "SXBR NF -0/+inf Tr"              FFFF0000 00000000 00000000 00000000
+r 84C0.10
+*Want "SXBR NF -0/-QNaN NT"             FFFF8B00 00000000 00000000 00000000
+r 84D0.10
+*Want "SXBR NF -0/-QNaN Tr"             FFFF8B00 00000000 00000000 00000000
+r 84E0.10
+*Want "SXBR NF -0/+SNaN NT"             7FFF8A00 00000000 00000000 00000000
+r 84F0.10
+*Want "SXBR NF -0/+SNaN Tr"             80000000 00000000 00000000 00000000
+r 8500.10
+*Want "SXBR NF +0/-inf NT"              7FFF0000 00000000 00000000 00000000
+r 8510.10
+*Want "SXBR NF +0/-inf Tr"              7FFF0000 00000000 00000000 00000000
+r 8520.10
+*Want "SXBR NF +0/-2.0 NT"              40000000 00000000 00000000 00000000
+r 8530.10
+*Want "SXBR NF +0/-2.0 Tr"              40000000 00000000 00000000 00000000
+r 8540.10
+*Want "SXBR NF +0/-Dnice NT"            00001000 00000000 00000000 00000000
+r 8550.10
+*Want "SXBR NF +0/-Dnice Tr"            5FFD0000 00000000 00000000 00000000
+r 8560.10
+*Want "SXBR NF +0/-0 NT"                00000000 00000000 00000000 00000000
+r 8570.10
+*Want "SXBR NF +0/-0 Tr"                00000000 00000000 00000000 00000000
+r 8580.10
+*Want "SXBR NF +0/+0 NT"                00000000 00000000 00000000 00000000
+r 8590.10
+*Want "SXBR NF +0/+0 Tr"                00000000 00000000 00000000 00000000
+r 85A0.10
+*Want "SXBR NF +0/+Dnice NT"            80001000 00000000 00000000 00000000
+r 85B0.10
+*Want "SXBR NF +0/+Dnice Tr"            DFFD0000 00000000 00000000 00000000
+r 85C0.10
+*Want "SXBR NF +0/+2.0 NT"              C0000000 00000000 00000000 00000000
+r 85D0.10
+*Want "SXBR NF +0/+2.0 Tr"              C0000000 00000000 00000000 00000000
+r 85E0.10
+*Want "SXBR NF +0/+inf NT"              FFFF0000 00000000 00000000 00000000
+r 85F0.10
+*Want "SXBR NF +0/+inf Tr"              FFFF0000 00000000 00000000 00000000
+r 8600.10
+*Want "SXBR NF +0/-QNaN NT"             FFFF8B00 00000000 00000000 00000000
+r 8610.10
+*Want "SXBR NF +0/-QNaN Tr"             FFFF8B00 00000000 00000000 00000000
+r 8620.10
+*Want "SXBR NF +0/+SNaN NT"             7FFF8A00 00000000 00000000 00000000
+r 8630.10
+*Want "SXBR NF +0/+SNaN Tr"             00000000 00000000 00000000 00000000
+r 8640.10
+*Want "SXBR NF +Dnice/-inf NT"          7FFF0000 00000000 00000000 00000000
+r 8650.10
+*Want "SXBR NF +Dnice/-inf Tr"          7FFF0000 00000000 00000000 00000000
+r 8660.10
+*Want "SXBR NF +Dnice/-2.0 NT"          40000000 00000000 00000000 00000000
+r 8670.10
+*Want "SXBR NF +Dnice/-2.0 Tr"          40000000 00000000 00000000 00000000
+r 8680.10
+*Want "SXBR NF +Dnice/-Dnice NT"        00002000 00000000 00000000 00000000
+r 8690.10
+*Want "SXBR NF +Dnice/-Dnice Tr"        5FFE0000 00000000 00000000 00000000
+r 86A0.10
+*Want "SXBR NF +Dnice/-0 NT"            00001000 00000000 00000000 00000000
+r 86B0.10
+*Want "SXBR NF +Dnice/-0 Tr"            5FFD0000 00000000 00000000 00000000
+r 86C0.10
+*Want "SXBR NF +Dnice/+0 NT"            00001000 00000000 00000000 00000000
+r 86D0.10
+*Want "SXBR NF +Dnice/+0 Tr"            5FFD0000 00000000 00000000 00000000
+r 86E0.10
+*Want "SXBR NF +Dnice/+Dnice NT"        00000000 00000000 00000000 00000000
+r 86F0.10
+*Want "SXBR NF +Dnice/+Dnice Tr"        00000000 00000000 00000000 00000000
+r 8700.10
+*Want "SXBR NF +Dnice/+2.0 NT"          C0000000 00000000 00000000 00000000
+r 8710.10
+*Want "SXBR NF +Dnice/+2.0 Tr"          C0000000 00000000 00000000 00000000
+r 8720.10
+*Want "SXBR NF +Dnice/+inf NT"          FFFF0000 00000000 00000000 00000000
+r 8730.10
+*Want "SXBR NF +Dnice/+inf Tr"          FFFF0000 00000000 00000000 00000000
+r 8740.10
+*Want "SXBR NF +Dnice/-QNaN NT"         FFFF8B00 00000000 00000000 00000000
+r 8750.10
+*Want "SXBR NF +Dnice/-QNaN Tr"         FFFF8B00 00000000 00000000 00000000
+r 8760.10
+*Want "SXBR NF +Dnice/+SNaN NT"         7FFF8A00 00000000 00000000 00000000
+r 8770.10
+*Want "SXBR NF +Dnice/+SNaN Tr"         00001000 00000000 00000000 00000000
+r 8780.10
+*Want "SXBR NF +2.0/-inf NT"            7FFF0000 00000000 00000000 00000000
+r 8790.10
+*Want "SXBR NF +2.0/-inf Tr"            7FFF0000 00000000 00000000 00000000
+r 87A0.10
+*Want "SXBR NF +2.0/-2.0 NT"            40010000 00000000 00000000 00000000
+r 87B0.10
+*Want "SXBR NF +2.0/-2.0 Tr"            40010000 00000000 00000000 00000000
+r 87C0.10
+*Want "SXBR NF +2.0/-Dnice NT"          40000000 00000000 00000000 00000000
+r 87D0.10
+*Want "SXBR NF +2.0/-Dnice Tr"          40000000 00000000 00000000 00000000
+r 87E0.10
+*Want "SXBR NF +2.0/-0 NT"              40000000 00000000 00000000 00000000
+r 87F0.10
+*Want "SXBR NF +2.0/-0 Tr"              40000000 00000000 00000000 00000000
+r 8800.10
+*Want "SXBR NF +2.0/+0 NT"              40000000 00000000 00000000 00000000
+r 8810.10
+*Want "SXBR NF +2.0/+0 Tr"              40000000 00000000 00000000 00000000
+r 8820.10
+*Want "SXBR NF +2.0/+Dnice NT"          40000000 00000000 00000000 00000000
+r 8830.10
+*Want "SXBR NF +2.0/+Dnice Tr"          40000000 00000000 00000000 00000000
+r 8840.10
+*Want "SXBR NF +2.0/+2.0 NT"            00000000 00000000 00000000 00000000
+r 8850.10
+*Want "SXBR NF +2.0/+2.0 Tr"            00000000 00000000 00000000 00000000
+r 8860.10
+*Want "SXBR NF +2.0/+inf NT"            FFFF0000 00000000 00000000 00000000
+r 8870.10
+*Want "SXBR NF +2.0/+inf Tr"            FFFF0000 00000000 00000000 00000000
+r 8880.10
+*Want "SXBR NF +2.0/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 8890.10
+*Want "SXBR NF +2.0/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 88A0.10
+*Want "SXBR NF +2.0/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 88B0.10
+*Want "SXBR NF +2.0/+SNaN Tr"           40000000 00000000 00000000 00000000
+r 88C0.10
+*Want "SXBR NF +inf/-inf NT"            7FFF0000 00000000 00000000 00000000
+r 88D0.10
+*Want "SXBR NF +inf/-inf Tr"            7FFF0000 00000000 00000000 00000000
+r 88E0.10
+*Want "SXBR NF +inf/-2.0 NT"            7FFF0000 00000000 00000000 00000000
+r 88F0.10
+*Want "SXBR NF +inf/-2.0 Tr"            7FFF0000 00000000 00000000 00000000
+r 8900.10
+*Want "SXBR NF +inf/-Dnice NT"          7FFF0000 00000000 00000000 00000000
+r 8910.10
+*Want "SXBR NF +inf/-Dnice Tr"          7FFF0000 00000000 00000000 00000000
+r 8920.10
+*Want "SXBR NF +inf/-0 NT"              7FFF0000 00000000 00000000 00000000
+r 8930.10
+*Want "SXBR NF +inf/-0 Tr"              7FFF0000 00000000 00000000 00000000
+r 8940.10
+*Want "SXBR NF +inf/+0 NT"              7FFF0000 00000000 00000000 00000000
+r 8950.10
+*Want "SXBR NF +inf/+0 Tr"              7FFF0000 00000000 00000000 00000000
+r 8960.10
+*Want "SXBR NF +inf/+Dnice NT"          7FFF0000 00000000 00000000 00000000
+r 8970.10
+*Want "SXBR NF +inf/+Dnice Tr"          7FFF0000 00000000 00000000 00000000
+r 8980.10
+*Want "SXBR NF +inf/+2.0 NT"            7FFF0000 00000000 00000000 00000000
+r 8990.10
+*Want "SXBR NF +inf/+2.0 Tr"            7FFF0000 00000000 00000000 00000000
+r 89A0.10
+*Want "SXBR NF +inf/+inf NT"            7FFF8000 00000000 00000000 00000000
+r 89B0.10
+*Want "SXBR NF +inf/+inf Tr"            7FFF0000 00000000 00000000 00000000
+r 89C0.10
+*Want "SXBR NF +inf/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 89D0.10
+*Want "SXBR NF +inf/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 89E0.10
+*Want "SXBR NF +inf/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 89F0.10
+*Want "SXBR NF +inf/+SNaN Tr"           7FFF0000 00000000 00000000 00000000
+r 8A00.10
+*Want "SXBR NF -QNaN/-inf NT"           FFFF8B00 00000000 00000000 00000000
+r 8A10.10
+*Want "SXBR NF -QNaN/-inf Tr"           FFFF8B00 00000000 00000000 00000000
+r 8A20.10
+*Want "SXBR NF -QNaN/-2.0 NT"           FFFF8B00 00000000 00000000 00000000
+r 8A30.10
+*Want "SXBR NF -QNaN/-2.0 Tr"           FFFF8B00 00000000 00000000 00000000
+r 8A40.10
+*Want "SXBR NF -QNaN/-Dnice NT"         FFFF8B00 00000000 00000000 00000000
+r 8A50.10
+*Want "SXBR NF -QNaN/-Dnice Tr"         FFFF8B00 00000000 00000000 00000000
+r 8A60.10
+*Want "SXBR NF -QNaN/-0 NT"             FFFF8B00 00000000 00000000 00000000
+r 8A70.10
+*Want "SXBR NF -QNaN/-0 Tr"             FFFF8B00 00000000 00000000 00000000
+r 8A80.10
+*Want "SXBR NF -QNaN/+0 NT"             FFFF8B00 00000000 00000000 00000000
+r 8A90.10
+*Want "SXBR NF -QNaN/+0 Tr"             FFFF8B00 00000000 00000000 00000000
+r 8AA0.10
+*Want "SXBR NF -QNaN/+Dnice NT"         FFFF8B00 00000000 00000000 00000000
+r 8AB0.10
+*Want "SXBR NF -QNaN/+Dnice Tr"         FFFF8B00 00000000 00000000 00000000
+r 8AC0.10
+*Want "SXBR NF -QNaN/+2.0 NT"           FFFF8B00 00000000 00000000 00000000
+r 8AD0.10
+*Want "SXBR NF -QNaN/+2.0 Tr"           FFFF8B00 00000000 00000000 00000000
+r 8AE0.10
+*Want "SXBR NF -QNaN/+inf NT"           FFFF8B00 00000000 00000000 00000000
+r 8AF0.10
+*Want "SXBR NF -QNaN/+inf Tr"           FFFF8B00 00000000 00000000 00000000
+r 8B00.10
+*Want "SXBR NF -QNaN/-QNaN NT"          FFFF8B00 00000000 00000000 00000000
+r 8B10.10
+*Want "SXBR NF -QNaN/-QNaN Tr"          FFFF8B00 00000000 00000000 00000000
+r 8B20.10
+*Want "SXBR NF -QNaN/+SNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 8B30.10
+*Want "SXBR NF -QNaN/+SNaN Tr"          FFFF8B00 00000000 00000000 00000000
+r 8B40.10
+*Want "SXBR NF +SNaN/-inf NT"           7FFF8A00 00000000 00000000 00000000
+r 8B50.10
+*Want "SXBR NF +SNaN/-inf Tr"           7FFF0A00 00000000 00000000 00000000
+r 8B60.10
+*Want "SXBR NF +SNaN/-2.0 NT"           7FFF8A00 00000000 00000000 00000000
+r 8B70.10
+*Want "SXBR NF +SNaN/-2.0 Tr"           7FFF0A00 00000000 00000000 00000000
+r 8B80.10
+*Want "SXBR NF +SNaN/-Dnice NT"         7FFF8A00 00000000 00000000 00000000
+r 8B90.10
+*Want "SXBR NF +SNaN/-Dnice Tr"         7FFF0A00 00000000 00000000 00000000
+r 8BA0.10
+*Want "SXBR NF +SNaN/-0 NT"             7FFF8A00 00000000 00000000 00000000
+r 8BB0.10
+*Want "SXBR NF +SNaN/-0 Tr"             7FFF0A00 00000000 00000000 00000000
+r 8BC0.10
+*Want "SXBR NF +SNaN/+0 NT"             7FFF8A00 00000000 00000000 00000000
+r 8BD0.10
+*Want "SXBR NF +SNaN/+0 Tr"             7FFF0A00 00000000 00000000 00000000
+r 8BE0.10
+*Want "SXBR NF +SNaN/+Dnice NT"         7FFF8A00 00000000 00000000 00000000
+r 8BF0.10
+*Want "SXBR NF +SNaN/+Dnice Tr"         7FFF0A00 00000000 00000000 00000000
+r 8C00.10
+*Want "SXBR NF +SNaN/+2.0 NT"           7FFF8A00 00000000 00000000 00000000
+r 8C10.10
+*Want "SXBR NF +SNaN/+2.0 Tr"           7FFF0A00 00000000 00000000 00000000
+r 8C20.10
+*Want "SXBR NF +SNaN/+inf NT"           7FFF8A00 00000000 00000000 00000000
+r 8C30.10
+*Want "SXBR NF +SNaN/+inf Tr"           7FFF0A00 00000000 00000000 00000000
+r 8C40.10
+*Want "SXBR NF +SNaN/-QNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 8C50.10
+*Want "SXBR NF +SNaN/-QNaN Tr"          7FFF0A00 00000000 00000000 00000000
+r 8C60.10
+*Want "SXBR NF +SNaN/+SNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 8C70.10
+*Want "SXBR NF +SNaN/+SNaN Tr"          7FFF0A00 00000000 00000000 00000000
+
+
+# Extended BFP non-finite test results - FPCR
+*Compare
+r 8D00.8
+*Want "SXBR NF -inf/-inf FPCR"          00800003 F8008003  
+r 8D10.8
+*Want "SXBR NF -inf/-2.0 FPCR"          00000001 F8000001  
+r 8D20.8
+*Want "SXBR NF -inf/-Dnice FPCR"        00000001 F8000001  
+r 8D30.8
+*Want "SXBR NF -inf/-0 FPCR"            00000001 F8000001  
+r 8D40.8
+*Want "SXBR NF -inf/+0 FPCR"            00000001 F8000001  
+r 8D50.8
+*Want "SXBR NF -inf/+Dnice FPCR"        00000001 F8000001  
+r 8D60.8
+*Want "SXBR NF -inf/+2.0 FPCR"          00000001 F8000001  
+r 8D70.8
+*Want "SXBR NF -inf/+inf FPCR"          00000001 F8000001  
+r 8D80.8
+*Want "SXBR NF -inf/-QNaN FPCR"         00000003 F8000003  
+r 8D90.8
+*Want "SXBR NF -inf/+SNaN FPCR"         00800003 F8008003  
+r 8DA0.8
+*Want "SXBR NF -2.0/-inf FPCR"          00000002 F8000002  
+r 8DB0.8
+*Want "SXBR NF -2.0/-2.0 FPCR"          00000000 F8000000  
+r 8DC0.8
+*Want "SXBR NF -2.0/-Dnice FPCR"        00080001 F8000C01  
+r 8DD0.8
+*Want "SXBR NF -2.0/-0 FPCR"            00000001 F8000001  
+r 8DE0.8
+*Want "SXBR NF -2.0/+0 FPCR"            00000001 F8000001  
+r 8DF0.8
+*Want "SXBR NF -2.0/+Dnice FPCR"        00080001 F8000801  
+r 8E00.8
+*Want "SXBR NF -2.0/+2.0 FPCR"          00000001 F8000001  
+r 8E10.8
+*Want "SXBR NF -2.0/+inf FPCR"          00000001 F8000001  
+r 8E20.8
+*Want "SXBR NF -2.0/-QNaN FPCR"         00000003 F8000003  
+r 8E30.8
+*Want "SXBR NF -2.0/+SNaN FPCR"         00800003 F8008003  
+r 8E40.8
+*Want "SXBR NF -Dnice/-inf FPCR"        00000002 F8000002  
+r 8E50.8
+*Want "SXBR NF -Dnice/-2.0 FPCR"        00080002 F8000C02  
+r 8E60.8
+*Want "SXBR NF -Dnice/-Dnice FPCR"      00000000 F8000000  
+r 8E70.8
+*Want "SXBR NF -Dnice/-0 FPCR"          00000001 F8001001  
+r 8E80.8
+*Want "SXBR NF -Dnice/+0 FPCR"          00000001 F8001001  
+r 8E90.8
+*Want "SXBR NF -Dnice/+Dnice FPCR"      00000001 F8001001  
+r 8EA0.8
+*Want "SXBR NF -Dnice/+2.0 FPCR"        00080001 F8000801  
+r 8EB0.8
+*Want "SXBR NF -Dnice/+inf FPCR"        00000001 F8000001  
+r 8EC0.8
+*Want "SXBR NF -Dnice/-QNaN FPCR"       00000003 F8000003  
+r 8ED0.8
+*Want "SXBR NF -Dnice/+SNaN FPCR"       00800003 F8008003  
+r 8EE0.8
+*Want "SXBR NF -0/-inf FPCR"            00000002 F8000002  
+r 8EF0.8
+*Want "SXBR NF -0/-2.0 FPCR"            00000002 F8000002  
+r 8F00.8
+*Want "SXBR NF -0/-Dnice FPCR"          00000002 F8001002  
+r 8F10.8
+*Want "SXBR NF -0/-0 FPCR"              00000000 F8000000  
+r 8F20.8
+*Want "SXBR NF -0/+0 FPCR"              00000000 F8000000  
+r 8F30.8
+*Want "SXBR NF -0/+Dnice FPCR"          00000001 F8001001  
+r 8F40.8
+*Want "SXBR NF -0/+2.0 FPCR"            00000001 F8000001  
+r 8F50.8
+*Want "SXBR NF -0/+inf FPCR"            00000001 F8000001  
+r 8F60.8
+*Want "SXBR NF -0/-QNaN FPCR"           00000003 F8000003  
+r 8F70.8
+*Want "SXBR NF -0/+SNaN FPCR"           00800003 F8008003  
+r 8F80.8
+*Want "SXBR NF +0/-inf FPCR"            00000002 F8000002  
+r 8F90.8
+*Want "SXBR NF +0/-2.0 FPCR"            00000002 F8000002  
+r 8FA0.8
+*Want "SXBR NF +0/-Dnice FPCR"          00000002 F8001002  
+r 8FB0.8
+*Want "SXBR NF +0/-0 FPCR"              00000000 F8000000  
+r 8FC0.8
+*Want "SXBR NF +0/+0 FPCR"              00000000 F8000000  
+r 8FD0.8
+*Want "SXBR NF +0/+Dnice FPCR"          00000001 F8001001  
+r 8FE0.8
+*Want "SXBR NF +0/+2.0 FPCR"            00000001 F8000001  
+r 8FF0.8
+*Want "SXBR NF +0/+inf FPCR"            00000001 F8000001  
+r 9000.8
+*Want "SXBR NF +0/-QNaN FPCR"           00000003 F8000003  
+r 9010.8
+*Want "SXBR NF +0/+SNaN FPCR"           00800003 F8008003  
+r 9020.8
+*Want "SXBR NF +Dnice/-inf FPCR"        00000002 F8000002  
+r 9030.8
+*Want "SXBR NF +Dnice/-2.0 FPCR"        00080002 F8000802  
+r 9040.8
+*Want "SXBR NF +Dnice/-Dnice FPCR"      00000002 F8001002  
+r 9050.8
+*Want "SXBR NF +Dnice/-0 FPCR"          00000002 F8001002  
+r 9060.8
+*Want "SXBR NF +Dnice/+0 FPCR"          00000002 F8001002  
+r 9070.8
+*Want "SXBR NF +Dnice/+Dnice FPCR"      00000000 F8000000  
+r 9080.8
+*Want "SXBR NF +Dnice/+2.0 FPCR"        00080001 F8000C01  
+r 9090.8
+*Want "SXBR NF +Dnice/+inf FPCR"        00000001 F8000001  
+r 90A0.8
+*Want "SXBR NF +Dnice/-QNaN FPCR"       00000003 F8000003  
+r 90B0.8
+*Want "SXBR NF +Dnice/+SNaN FPCR"       00800003 F8008003  
+r 90C0.8
+*Want "SXBR NF +2.0/-inf FPCR"          00000002 F8000002  
+r 90D0.8
+*Want "SXBR NF +2.0/-2.0 FPCR"          00000002 F8000002  
+r 90E0.8
+*Want "SXBR NF +2.0/-Dnice FPCR"        00080002 F8000802  
+r 90F0.8
+*Want "SXBR NF +2.0/-0 FPCR"            00000002 F8000002  
+r 9100.8
+*Want "SXBR NF +2.0/+0 FPCR"            00000002 F8000002  
+r 9110.8
+*Want "SXBR NF +2.0/+Dnice FPCR"        00080002 F8000C02  
+r 9120.8
+*Want "SXBR NF +2.0/+2.0 FPCR"          00000000 F8000000  
+r 9130.8
+*Want "SXBR NF +2.0/+inf FPCR"          00000001 F8000001  
+r 9140.8
+*Want "SXBR NF +2.0/-QNaN FPCR"         00000003 F8000003  
+r 9150.8
+*Want "SXBR NF +2.0/+SNaN FPCR"         00800003 F8008003  
+r 9160.8
+*Want "SXBR NF +inf/-inf FPCR"          00000002 F8000002  
+r 9170.8
+*Want "SXBR NF +inf/-2.0 FPCR"          00000002 F8000002  
+r 9180.8
+*Want "SXBR NF +inf/-Dnice FPCR"        00000002 F8000002  
+r 9190.8
+*Want "SXBR NF +inf/-0 FPCR"            00000002 F8000002  
+r 91A0.8
+*Want "SXBR NF +inf/+0 FPCR"            00000002 F8000002  
+r 91B0.8
+*Want "SXBR NF +inf/+Dnice FPCR"        00000002 F8000002  
+r 91C0.8
+*Want "SXBR NF +inf/+2.0 FPCR"          00000002 F8000002  
+r 91D0.8
+*Want "SXBR NF +inf/+inf FPCR"          00800003 F8008003  
+r 91E0.8
+*Want "SXBR NF +inf/-QNaN FPCR"         00000003 F8000003  
+r 91F0.8
+*Want "SXBR NF +inf/+SNaN FPCR"         00800003 F8008003  
+r 9200.8
+*Want "SXBR NF -QNaN/-inf FPCR"         00000003 F8000003  
+r 9210.8
+*Want "SXBR NF -QNaN/-2.0 FPCR"         00000003 F8000003  
+r 9220.8
+*Want "SXBR NF -QNaN/-Dnice FPCR"       00000003 F8000003  
+r 9230.8
+*Want "SXBR NF -QNaN/-0 FPCR"           00000003 F8000003  
+r 9240.8
+*Want "SXBR NF -QNaN/+0 FPCR"           00000003 F8000003  
+r 9250.8
+*Want "SXBR NF -QNaN/+Dnice FPCR"       00000003 F8000003  
+r 9260.8
+*Want "SXBR NF -QNaN/+2.0 FPCR"         00000003 F8000003  
+r 9270.8
+*Want "SXBR NF -QNaN/+inf FPCR"         00000003 F8000003  
+r 9280.8
+*Want "SXBR NF -QNaN/-QNaN FPCR"        00000003 F8000003  
+r 9290.8
+*Want "SXBR NF -QNaN/+SNaN FPCR"        00800003 F8008003  
+r 92A0.8
+*Want "SXBR NF +SNaN/-inf FPCR"         00800003 F8008003  
+r 92B0.8
+*Want "SXBR NF +SNaN/-2.0 FPCR"         00800003 F8008003  
+r 92C0.8
+*Want "SXBR NF +SNaN/-Dnice FPCR"       00800003 F8008003  
+r 92D0.8
+*Want "SXBR NF +SNaN/-0 FPCR"           00800003 F8008003  
+r 92E0.8
+*Want "SXBR NF +SNaN/+0 FPCR"           00800003 F8008003  
+r 92F0.8
+*Want "SXBR NF +SNaN/+Dnice FPCR"       00800003 F8008003  
+r 9300.8
+*Want "SXBR NF +SNaN/+2.0 FPCR"         00800003 F8008003  
+r 9310.8
+*Want "SXBR NF +SNaN/+inf FPCR"         00800003 F8008003  
+r 9320.8
+*Want "SXBR NF +SNaN/-QNaN FPCR"        00800003 F8008003  
+r 9330.8
+*Want "SXBR NF +SNaN/+SNaN FPCR"        00800003 F8008003  
+
+
+# Extended BFP finite test results
+*Compare
+r 9400.10
+*Want "SXBR F Ovfl NT"                  7FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9410.10
+*Want "SXBR F Ovfl Tr"                  7FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9420.10
+*Want "SXBR F Ufl 1 NT"                 0000FFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9430.10
+*Want "SXBR F Ufl 1 Tr"                 6000FFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 9440.10
+*Want "SXBR F Ufl 2 NT"                 000070F1 00000000 00000000 00000000
+r 9450.10
+*Want "SXBR F Ufl 2 Tr"                 5FFFC3C4 00000000 00000000 00000000
+r 9460.10
+*Want "SXBR F Nmin NT"                  00010000 00000000 00000000 00000000
+r 9470.10
+*Want "SXBR F Nmin Tr"                  00010000 00000000 00000000 00000000
+r 9480.10
+*Want "SXBR F Incr NT"                  3FFF0000 00000000 00000000 00000000
+r 9490.10
+*Want "SXBR F Incr Tr"                  3FFF0000 00000000 00000000 00000000
+r 94A0.10
+*Want "SXBR F Trun NT"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 94B0.10
+*Want "SXBR F Trun Tr"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+
+
+# Extended BFP non-finite test results - FPCR
+*Compare
+r 9600.8
+*Want "SXBR F Ovfl FPCR"                00000003 F8000003  
+r 9610.8
+*Want "SXBR F Ufl 1 FPCR"               00000002 F8001002  
+r 9620.8
+*Want "SXBR F Ufl 2 FPCR"               00000002 F8001002  
+r 9630.8
+*Want "SXBR F Nmin FPCR"                00000002 F8000002  
+r 9640.8
+*Want "SXBR F Incr FPCR"                00080002 F8000C02  
+r 9650.8
+*Want "SXBR F Trun FPCR"                00080002 F8000802  
+
+
+# Extended BFP rounding mode test results
+*Compare
+r 9700.10
+*Want "SXBR RM +NZ RNTE"                3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9710.10
+*Want "SXBR RM +NZ RZ"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9720.10
+*Want "SXBR RM +NZ RP"                  3FFF0000 00000000 00000000 00000000
+r 9730.10
+*Want "SXBR RM +NZ RM"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9740.10
+*Want "SXBR RM +NZ RFS"                 3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9750.10
+*Want "SXBR RM -NZ RNTE"                BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9760.10
+*Want "SXBR RM -NZ RZ"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9770.10
+*Want "SXBR RM -NZ RP"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9780.10
+*Want "SXBR RM -NZ RM"                  BFFF0000 00000000 00000000 00000000
+r 9790.10
+*Want "SXBR RM -NZ RFS"                 BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 97A0.10
+*Want "SXBR RM +NA RNTE"                3FFF0000 00000000 00000000 00000000
+r 97B0.10
+*Want "SXBR RM +NA RZ"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 97C0.10
+*Want "SXBR RM +NA RP"                  3FFF0000 00000000 00000000 00000000
+r 97D0.10
+*Want "SXBR RM +NA RM"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 97E0.10
+*Want "SXBR RM +NA RFS"                 3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 97F0.10
+*Want "SXBR RM -NA RNTE"                BFFF0000 00000000 00000000 00000000
+r 9800.10
+*Want "SXBR RM -NA RZ"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9810.10
+*Want "SXBR RM -NA RP"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9820.10
+*Want "SXBR RM -NA RM"                  BFFF0000 00000000 00000000 00000000
+r 9830.10
+*Want "SXBR RM -NA RFS"                 BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9840.10
+*Want "SXBR RM +TZ RNTE"                3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 9850.10
+*Want "SXBR RM +TZ RZ"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 9860.10
+*Want "SXBR RM +TZ RP"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9870.10
+*Want "SXBR RM +TZ RM"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 9880.10
+*Want "SXBR RM +TZ RFS"                 3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9890.10
+*Want "SXBR RM -TZ RNTE"                BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 98A0.10
+*Want "SXBR RM -TZ RZ"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 98B0.10
+*Want "SXBR RM -TZ RP"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 98C0.10
+*Want "SXBR RM -TZ RM"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 98D0.10
+*Want "SXBR RM -TZ RFS"                 BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 98E0.10
+*Want "SXBR RM +TA RNTE"                3FFF0000 00000000 00000000 00000000
+r 98F0.10
+*Want "SXBR RM +TA RZ"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9900.10
+*Want "SXBR RM +TA RP"                  3FFF0000 00000000 00000000 00000000
+r 9910.10
+*Want "SXBR RM +TA RM"                  3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9920.10
+*Want "SXBR RM +TA RFS"                 3FFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9930.10
+*Want "SXBR RM -TA RNTE"                BFFF0000 00000000 00000000 00000000
+r 9940.10
+*Want "SXBR RM -TA RZ"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9950.10
+*Want "SXBR RM -TA RP"                  BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 9960.10
+*Want "SXBR RM -TA RM"                  BFFF0000 00000000 00000000 00000000
+r 9970.10
+*Want "SXBR RM -TA RFS"                 BFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFF
+
+
+# Extended BFP rounding mode test results - FPCR
+*Compare
+r 9C00.10
+*Want "SXBR RM +NZ RNTE, RZ,RP,RM FPCR" 00080002 00080002 00080002 00080002
+r 9C10.4
+*Want "SXBR RM +NZ RFS FPCR"            00080002   
+r 9C20.10
+*Want "SXBR RM -NZ RNTE, RZ,RP,RM FPCR" 00080001 00080001 00080001 00080001
+r 9C30.4
+*Want "SXBR RM -NZ RFS FPCR"            00080001   
+r 9C40.10
+*Want "SXBR RM +NA RNTE, RZ,RP,RM FPCR" 00080002 00080002 00080002 00080002
+r 9C50.4
+*Want "SXBR RM +NA RFS FPCR"            00080002   
+r 9C60.10
+*Want "SXBR RM -NA RNTE, RZ,RP,RM FPCR" 00080001 00080001 00080001 00080001
+r 9C70.4
+*Want "SXBR RM -NA RFS FPCR"            00080001   
+r 9C80.10
+*Want "SXBR RM +TZ RNTE, RZ,RP,RM FPCR" 00080002 00080002 00080002 00080002
+r 9C90.4
+*Want "SXBR RM +TZ RFS FPCR"            00080002
+r 9CA0.10
+*Want "SXBR RM -TZ RNTE, RZ,RP,RM FPCR" 00080001 00080001 00080001 00080001
+r 9CB0.4
+*Want "SXBR RM -TZ RFS FPCR"            00080001
+r 9CC0.10
+*Want "SXBR RM +TA RNTE, RZ,RP,RM FPCR" 00080002 00080002 00080002 00080002
+r 9CD0.4
+*Want "SXBR RM +TA RFS FPCR"            00080002
+r 9CE0.10
+*Want "SXBR RM -TA RNTE, RZ,RP,RM FPCR" 00080001 00080001 00080001 00080001
+r 9CF0.4
+*Want "SXBR RM -TA RFS FPCR"            00080001
+
+
+
+
+
+*Done
+
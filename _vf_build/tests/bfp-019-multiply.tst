@@ -0,0 +1,1555 @@
+*Testcase bfp-019-multiply.tst:   MEEBR, MEEB, MDBR, MDB, MXBR
+
+#..Test cases evaluate NaN propagation, NaN generation, operations
+#..using non-finite values, trappable and non-trappable IEEE
+#..exceptions, result scaling, and exhaustive rounding testing.
+#..Excludes multiply to increased precision and fused multiply.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 141 program check messages that have no
+# value in the validation process.
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-019-multiply.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Short BFP non-finite test results
+*Compare
+r 1000.10
+*Want "MEEBR/MEEB NF -inf/-inf"         7F800000 7F800000 7F800000 7F800000
+r 1010.10
+*Want "MEEBR/MEEB NF -inf/-2.0"         7F800000 7F800000 7F800000 7F800000
+r 1020.10
+*Want "MEEBR/MEEB NF -inf/-0"           7FC00000 FF800000 7FC00000 FF800000
+r 1030.10
+*Want "MEEBR/MEEB NF -inf/+0"           7FC00000 FF800000 7FC00000 FF800000
+r 1040.10
+*Want "MEEBR/MEEB NF -inf/+2.0"         FF800000 FF800000 FF800000 FF800000
+r 1050.10
+*Want "MEEBR/MEEB NF -inf/+inf"         FF800000 FF800000 FF800000 FF800000
+r 1060.10
+*Want "MEEBR/MEEB NF -inf/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1070.10
+*Want "MEEBR/MEEB NF -inf/+SNaN"        7FCA0000 FF800000 7FCA0000 FF800000
+r 1080.10
+*Want "MEEBR/MEEB NF -2.0/-inf"         7F800000 7F800000 7F800000 7F800000
+r 1090.10
+*Want "MEEBR/MEEB NF -2.0/-2.0"         40800000 40800000 40800000 40800000
+r 10A0.10
+*Want "MEEBR/MEEB NF -2.0/-0"           00000000 00000000 00000000 00000000
+r 10B0.10
+*Want "MEEBR/MEEB NF -2.0/+0"           80000000 80000000 80000000 80000000
+r 10C0.10
+*Want "MEEBR/MEEB NF -2.0/+2.0"         C0800000 C0800000 C0800000 C0800000
+r 10D0.10
+*Want "MEEBR/MEEB NF -2.0/+inf"         FF800000 FF800000 FF800000 FF800000
+r 10E0.10
+*Want "MEEBR/MEEB NF -2.0/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 10F0.10
+*Want "MEEBR/MEEB NF -2.0/+SNaN"        7FCA0000 C0000000 7FCA0000 C0000000
+r 1100.10
+*Want "MEEBR/MEEB NF -0/-inf"           7FC00000 80000000 7FC00000 80000000
+r 1110.10
+*Want "MEEBR/MEEB NF -0/-2.0"           00000000 00000000 00000000 00000000
+r 1120.10
+*Want "MEEBR/MEEB NF -0/-0"             00000000 00000000 00000000 00000000
+r 1130.10
+*Want "MEEBR/MEEB NF -0/+0"             80000000 80000000 80000000 80000000
+r 1140.10
+*Want "MEEBR/MEEB NF -0/+2.0"           80000000 80000000 80000000 80000000
+r 1150.10
+*Want "MEEBR/MEEB NF -0/+inf"           7FC00000 80000000 7FC00000 80000000
+r 1160.10
+*Want "MEEBR/MEEB NF -0/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1170.10
+*Want "MEEBR/MEEB NF -0/+SNaN"          7FCA0000 80000000 7FCA0000 80000000
+r 1180.10
+*Want "MEEBR/MEEB NF +0/-inf"           7FC00000 00000000 7FC00000 00000000
+r 1190.10
+*Want "MEEBR/MEEB NF +0/-2.0"           80000000 80000000 80000000 80000000
+r 11A0.10
+*Want "MEEBR/MEEB NF +0/-0"             80000000 80000000 80000000 80000000
+r 11B0.10
+*Want "MEEBR/MEEB NF +0/+0"             00000000 00000000 00000000 00000000
+r 11C0.10
+*Want "MEEBR/MEEB NF +0/+2.0"           00000000 00000000 00000000 00000000
+r 11D0.10
+*Want "MEEBR/MEEB NF +0/+inf"           7FC00000 00000000 7FC00000 00000000
+r 11E0.10
+*Want "MEEBR/MEEB NF +0/-QNaN"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 11F0.10
+*Want "MEEBR/MEEB NF +0/+SNaN"          7FCA0000 00000000 7FCA0000 00000000
+r 1200.10
+*Want "MEEBR/MEEB NF +2.0/-inf"         FF800000 FF800000 FF800000 FF800000
+r 1210.10
+*Want "MEEBR/MEEB NF +2.0/-2.0"         C0800000 C0800000 C0800000 C0800000
+r 1220.10
+*Want "MEEBR/MEEB NF +2.0/-0"           80000000 80000000 80000000 80000000
+r 1230.10
+*Want "MEEBR/MEEB NF +2.0/+0"           00000000 00000000 00000000 00000000
+r 1240.10
+*Want "MEEBR/MEEB NF +2.0/+2.0"         40800000 40800000 40800000 40800000
+r 1250.10
+*Want "MEEBR/MEEB NF +2.0/+inf"         7F800000 7F800000 7F800000 7F800000
+r 1260.10
+*Want "MEEBR/MEEB NF +2.0/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1270.10
+*Want "MEEBR/MEEB NF +2.0/+SNaN"        7FCA0000 40000000 7FCA0000 40000000
+r 1280.10
+*Want "MEEBR/MEEB NF +inf/-inf"         FF800000 FF800000 FF800000 FF800000
+r 1290.10
+*Want "MEEBR/MEEB NF +inf/-2.0"         FF800000 FF800000 FF800000 FF800000
+r 12A0.10
+*Want "MEEBR/MEEB NF +inf/-0"           7FC00000 7F800000 7FC00000 7F800000
+r 12B0.10
+*Want "MEEBR/MEEB NF +inf/+0"           7FC00000 7F800000 7FC00000 7F800000
+r 12C0.10
+*Want "MEEBR/MEEB NF +inf/+2.0"         7F800000 7F800000 7F800000 7F800000
+r 12D0.10
+*Want "MEEBR/MEEB NF +inf/+inf"         7F800000 7F800000 7F800000 7F800000
+r 12E0.10
+*Want "MEEBR/MEEB NF +inf/-QNaN"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 12F0.10
+*Want "MEEBR/MEEB NF +inf/+SNaN"        7FCA0000 7F800000 7FCA0000 7F800000
+r 1300.10
+*Want "MEEBR/MEEB NF -QNaN/-inf"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1310.10
+*Want "MEEBR/MEEB NF -QNaN/-2.0"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1320.10
+*Want "MEEBR/MEEB NF -QNaN/-0"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1330.10
+*Want "MEEBR/MEEB NF -QNaN/+0"          FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1340.10
+*Want "MEEBR/MEEB NF -QNaN/+2.0"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1350.10
+*Want "MEEBR/MEEB NF -QNaN/+inf"        FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1360.10
+*Want "MEEBR/MEEB NF -QNaN/-QNaN"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1370.10
+*Want "MEEBR/MEEB NF -QNaN/+SNaN"       7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 1380.10
+*Want "MEEBR/MEEB NF +SNaN/-inf"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1390.10
+*Want "MEEBR/MEEB NF +SNaN/-2.0"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13A0.10
+*Want "MEEBR/MEEB NF +SNaN/-0"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13B0.10
+*Want "MEEBR/MEEB NF +SNaN/+0"          7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13C0.10
+*Want "MEEBR/MEEB NF +SNaN/+2.0"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13D0.10
+*Want "MEEBR/MEEB NF +SNaN/+inf"        7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13E0.10
+*Want "MEEBR/MEEB NF +SNaN/-QNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 13F0.10
+*Want "MEEBR/MEEB NF +SNaN/+SNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+
+
+# Short BFP non-finite test results - FPCR contents
+*Compare
+r 1400.10
+*Want "MEEBR/MEEB NF -inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1410.10
+*Want "MEEBR/MEEB NF -inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1420.10
+*Want "MEEBR/MEEB NF -inf/-0 FPCR"      00800000 F8008000 00800000 F8008000
+r 1430.10
+*Want "MEEBR/MEEB NF -inf/+0 FPCR"      00800000 F8008000 00800000 F8008000
+r 1440.10
+*Want "MEEBR/MEEB NF -inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1450.10
+*Want "MEEBR/MEEB NF -inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1460.10
+*Want "MEEBR/MEEB NF -inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 1470.10
+*Want "MEEBR/MEEB NF -inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 1480.10
+*Want "MEEBR/MEEB NF -2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1490.10
+*Want "MEEBR/MEEB NF -2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 14A0.10
+*Want "MEEBR/MEEB NF -2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 14B0.10
+*Want "MEEBR/MEEB NF -2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 14C0.10
+*Want "MEEBR/MEEB NF -2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 14D0.10
+*Want "MEEBR/MEEB NF -2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 14E0.10
+*Want "MEEBR/MEEB NF -2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 14F0.10
+*Want "MEEBR/MEEB NF -2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 1500.10
+*Want "MEEBR/MEEB NF -0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 1510.10
+*Want "MEEBR/MEEB NF -0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 1520.10
+*Want "MEEBR/MEEB NF -0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 1530.10
+*Want "MEEBR/MEEB NF -0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 1540.10
+*Want "MEEBR/MEEB NF -0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 1550.10
+*Want "MEEBR/MEEB NF -0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 1560.10
+*Want "MEEBR/MEEB NF -0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 1570.10
+*Want "MEEBR/MEEB NF -0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 1580.10
+*Want "MEEBR/MEEB NF +0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 1590.10
+*Want "MEEBR/MEEB NF +0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 15A0.10
+*Want "MEEBR/MEEB NF +0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 15B0.10
+*Want "MEEBR/MEEB NF +0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 15C0.10
+*Want "MEEBR/MEEB NF +0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 15D0.10
+*Want "MEEBR/MEEB NF +0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 15E0.10
+*Want "MEEBR/MEEB NF +0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 15F0.10
+*Want "MEEBR/MEEB NF +0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 1600.10
+*Want "MEEBR/MEEB NF +2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1610.10
+*Want "MEEBR/MEEB NF +2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1620.10
+*Want "MEEBR/MEEB NF +2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 1630.10
+*Want "MEEBR/MEEB NF +2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 1640.10
+*Want "MEEBR/MEEB NF +2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 1650.10
+*Want "MEEBR/MEEB NF +2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1660.10
+*Want "MEEBR/MEEB NF +2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 1670.10
+*Want "MEEBR/MEEB NF +2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 1680.10
+*Want "MEEBR/MEEB NF +inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 1690.10
+*Want "MEEBR/MEEB NF +inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 16A0.10
+*Want "MEEBR/MEEB NF +inf/-0 FPCR"      00800000 F8008000 00800000 F8008000
+r 16B0.10
+*Want "MEEBR/MEEB NF +inf/+0 FPCR"      00800000 F8008000 00800000 F8008000
+r 16C0.10
+*Want "MEEBR/MEEB NF +inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 16D0.10
+*Want "MEEBR/MEEB NF +inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 16E0.10
+*Want "MEEBR/MEEB NF +inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 16F0.10
+*Want "MEEBR/MEEB NF +inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 1700.10
+*Want "MEEBR/MEEB NF -QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 1710.10
+*Want "MEEBR/MEEB NF -QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 1720.10
+*Want "MEEBR/MEEB NF -QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 1730.10
+*Want "MEEBR/MEEB NF -QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 1740.10
+*Want "MEEBR/MEEB NF -QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 1750.10
+*Want "MEEBR/MEEB NF -QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 1760.10
+*Want "MEEBR/MEEB NF -QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 1770.10
+*Want "MEEBR/MEEB NF -QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 1780.10
+*Want "MEEBR/MEEB NF +SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 1790.10
+*Want "MEEBR/MEEB NF +SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 17A0.10
+*Want "MEEBR/MEEB NF +SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 17B0.10
+*Want "MEEBR/MEEB NF +SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 17C0.10
+*Want "MEEBR/MEEB NF +SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 17D0.10
+*Want "MEEBR/MEEB NF +SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 17E0.10
+*Want "MEEBR/MEEB NF +SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 17F0.10
+*Want "MEEBR/MEEB NF +SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+
+
+# Short BFP finite test results
+*Compare
+r 1800.10
+*Want "MEEBR/MEEB F Ovfl"               FF800000 DF7FFFFE FF800000 DF7FFFFE
+r 1810.10
+*Want "MEEBR/MEEB F Ufl 1"              00000000 21FFFFFF 00000000 21FFFFFF
+r 1820.10
+*Want "MEEBR/MEEB F Ufl 2"              00000000 1970F000 00000000 1970F000
+r 1830.10
+*Want "MEEBR/MEEB F Nmin"               00FFFFFE 00FFFFFE 00FFFFFE 00FFFFFE
+r 1840.10
+*Want "MEEBR/MEEB F Incr"               3F88000D 3F88000D 3F88000D 3F88000D
+r 1850.10
+*Want "MEEBR/MEEB F Trun"               3F880007 3F880007 3F880007 3F880007
+
+
+# Short BFP finite test results - FPCR contents
+*Compare
+r 1900.10
+*Want "MEEBR/MEEB F Ovfl FPCR"          00280000 F8002800 00280000 F8002800
+r 1910.10
+*Want "MEEBR/MEEB F Ufl 1 FPCR"         00180000 F8001000 00180000 F8001000
+r 1920.10
+*Want "MEEBR/MEEB F Ufl 2 FPCR"         00180000 F8001000 00180000 F8001000
+r 1930.10
+*Want "MEEBR/MEEB F Nmin FPCR"          00000000 F8000000 00000000 F8000000
+r 1940.10
+*Want "MEEBR/MEEB F Incr FPCR"          00080000 F8000C00 00080000 F8000C00
+r 1950.10
+*Want "MEEBR/MEEB F Trun FPCR"          00080000 F8000800 00080000 F8000800
+
+
+# Short BFP rounding mode test results
+*Compare
+r 1A00.10
+*Want "MEEBR/MEEB RM +NZ RNTE, RZ"      3F880007 3F880007 3F880007 3F880007
+r 1A10.10
+*Want "MEEBR/MEEB RM +NZ RP, RM"        3F880008 3F880008 3F880007 3F880007
+r 1A20.8
+*Want "MEEBR/MEEB RM +NZ RFS"           3F880007 3F880007  
+r 1A30.10
+*Want "MEEBR/MEEB RM -NZ RNTE, RZ"      BF880007 BF880007 BF880007 BF880007
+r 1A40.10
+*Want "MEEBR/MEEB RM -NZ RP, RM"        BF880007 BF880007 BF880008 BF880008
+r 1A50.8
+*Want "MEEBR/MEEB RM -NZ RFS"           BF880007 BF880007  
+r 1A60.10
+*Want "MEEBR/MEEB RM +NA RNTE, RZ"      3F88000D 3F88000D 3F88000C 3F88000C
+r 1A70.10
+*Want "MEEBR/MEEB RM +NA RP, RM"        3F88000D 3F88000D 3F88000C 3F88000C
+r 1A80.8
+*Want "MEEBR/MEEB RM +NA RFS"           3F88000D 3F88000D  
+r 1A90.10
+*Want "MEEBR/MEEB RM -NA RNTE, RZ"      BF88000D BF88000D BF88000C BF88000C
+r 1AA0.10
+*Want "MEEBR/MEEB RM -NA RP, RM"        BF88000C BF88000C BF88000D BF88000D
+r 1AB0.8
+*Want "MEEBR/MEEB RM -NA RFS"           BF88000D BF88000D  
+r 1AC0.10
+*Want "MEEBR/MEEB RM +TZ RNTE, RZ"      3F880008 3F880008 3F880008 3F880008
+r 1AD0.10
+*Want "MEEBR/MEEB RM +TZ RP, RM"        3F880009 3F880009 3F880008 3F880008
+r 1AE0.8
+*Want "MEEBR/MEEB RM +TZ RFS"           3F880009 3F880009  
+r 1AF0.10
+*Want "MEEBR/MEEB RM -TZ RNTE, RZ"      BF880008 BF880008 BF880008 BF880008
+r 1B00.10
+*Want "MEEBR/MEEB RM -TZ RP, RM"        BF880008 BF880008 BF880009 BF880009
+r 1B10.8
+*Want "MEEBR/MEEB RM -TZ RFS"           BF880009 BF880009  
+r 1B20.10
+*Want "MEEBR/MEEB RM +TA RNTE, RZ"      3F88001A 3F88001A 3F880019 3F880019
+r 1B30.10
+*Want "MEEBR/MEEB RM +TA RP, RM"        3F88001A 3F88001A 3F880019 3F880019
+r 1B40.8
+*Want "MEEBR/MEEB RM +TA RFS"           3F880019 3F880019  
+r 1B50.10
+*Want "MEEBR/MEEB RM -TA RNTE, RZ"      BF88001A BF88001A BF880019 BF880019
+r 1B60.10
+*Want "MEEBR/MEEB RM -TA RP, RM"        BF880019 BF880019 BF88001A BF88001A
+r 1B70.8
+*Want "MEEBR/MEEB RM -TA RFS"           BF880019 BF880019  
+
+
+# Short BFP rounding mode test results - FPCR contents
+*Compare
+r 1D00.10
+*Want "MEEBR/MEEB RM +NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1D10.10
+*Want "MEEBR/MEEB RM +NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1D20.8
+*Want "MEEBR/MEEB RM +NZ RFS FPCR"      00080007 00080007
+r 1D30.10
+*Want "MEEBR/MEEB RM -NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1D40.10
+*Want "MEEBR/MEEB RM -NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1D50.8
+*Want "MEEBR/MEEB RM -NZ RFS FPCR"      00080007 00080007  
+r 1D60.10
+*Want "MEEBR/MEEB RM +NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1D70.10
+*Want "MEEBR/MEEB RM +NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1D80.8
+*Want "MEEBR/MEEB RM +NA RFS FPCR"      00080007 00080007  
+r 1D90.10
+*Want "MEEBR/MEEB RM -NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1DA0.10
+*Want "MEEBR/MEEB RM -NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1DB0.8
+*Want "MEEBR/MEEB RM -NA RFS FPCR"      00080007 00080007  
+r 1DC0.10
+*Want "MEEBR/MEEB RM +TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1DD0.10
+*Want "MEEBR/MEEB RM +TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1DE0.8
+*Want "MEEBR/MEEB RM +TZ RFS FPCR"      00080007 00080007  
+r 1DF0.10
+*Want "MEEBR/MEEB RM -TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1E00.10
+*Want "MEEBR/MEEB RM -TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1E10.8
+*Want "MEEBR/MEEB RM -TZ RFS FPCR"      00080007 00080007  
+r 1E20.10
+*Want "MEEBR/MEEB RM +TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1E30.10
+*Want "MEEBR/MEEB RM +TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1E40.8
+*Want "MEEBR/MEEB RM +TA RFS FPCR"      00080007 00080007  
+r 1E50.10
+*Want "MEEBR/MEEB RM -TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 1E60.10
+*Want "MEEBR/MEEB RM -TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 1E70.8
+*Want "MEEBR/MEEB RM -TA RFS FPCR"      00080007 00080007  
+
+
+# Long BFP non-finite test results
+*Compare
+r 3000.10
+*Want "MDBR/MDB NF -inf/-inf NT"        7FF00000 00000000 7FF00000 00000000
+r 3010.10
+*Want "MDBR/MDB NF -inf/-inf Tr"        7FF00000 00000000 7FF00000 00000000
+r 3020.10
+*Want "MDBR/MDB NF -inf/-2.0 NT"        7FF00000 00000000 7FF00000 00000000
+r 3030.10
+*Want "MDBR/MDB NF -inf/-2.0 Tr"        7FF00000 00000000 7FF00000 00000000
+r 3040.10
+*Want "MDBR/MDB NF -inf/-0 NT"          7FF80000 00000000 FFF00000 00000000
+r 3050.10
+*Want "MDBR/MDB NF -inf/-0 Tr"          7FF80000 00000000 FFF00000 00000000
+r 3060.10
+*Want "MDBR/MDB NF -inf/+0 NT"          7FF80000 00000000 FFF00000 00000000
+r 3070.10
+*Want "MDBR/MDB NF -inf/+0 Tr"          7FF80000 00000000 FFF00000 00000000
+r 3080.10
+*Want "MDBR/MDB NF -inf/+2.0 NT"        FFF00000 00000000 FFF00000 00000000
+r 3090.10
+*Want "MDBR/MDB NF -inf/+2.0 Tr"        FFF00000 00000000 FFF00000 00000000
+r 30A0.10
+*Want "MDBR/MDB NF -inf/+inf NT"        FFF00000 00000000 FFF00000 00000000
+r 30B0.10
+*Want "MDBR/MDB NF -inf/+inf Tr"        FFF00000 00000000 FFF00000 00000000
+r 30C0.10
+*Want "MDBR/MDB NF -inf/-QNaN NT"       FFF8B000 00000000 FFF8B000 00000000
+r 30D0.10
+*Want "MDBR/MDB NF -inf/-QNaN Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 30E0.10
+*Want "MDBR/MDB NF -inf/+SNaN NT"       7FF8A000 00000000 FFF00000 00000000
+r 30F0.10
+*Want "MDBR/MDB NF -inf/+SNaN Tr"       7FF8A000 00000000 FFF00000 00000000
+r 3100.10
+*Want "MDBR/MDB NF -2.0/-inf NT"        7FF00000 00000000 7FF00000 00000000
+r 3110.10
+*Want "MDBR/MDB NF -2.0/-inf Tr"        7FF00000 00000000 7FF00000 00000000
+r 3120.10
+*Want "MDBR/MDB NF -2.0/-2.0 NT"        40100000 00000000 40100000 00000000
+r 3130.10
+*Want "MDBR/MDB NF -2.0/-2.0 Tr"        40100000 00000000 40100000 00000000
+r 3140.10
+*Want "MDBR/MDB NF -2.0/-0 NT"          00000000 00000000 00000000 00000000
+r 3150.10
+*Want "MDBR/MDB NF -2.0/-0 Tr"          00000000 00000000 00000000 00000000
+r 3160.10
+*Want "MDBR/MDB NF -2.0/+0 NT"          80000000 00000000 80000000 00000000
+r 3170.10
+*Want "MDBR/MDB NF -2.0/+0 Tr"          80000000 00000000 80000000 00000000
+r 3180.10
+*Want "MDBR/MDB NF -2.0/+2.0 NT"        C0100000 00000000 C0100000 00000000
+r 3190.10
+*Want "MDBR/MDB NF -2.0/+2.0 Tr"        C0100000 00000000 C0100000 00000000
+r 31A0.10
+*Want "MDBR/MDB NF -2.0/+inf NT"        FFF00000 00000000 FFF00000 00000000
+r 31B0.10
+*Want "MDBR/MDB NF -2.0/+inf Tr"        FFF00000 00000000 FFF00000 00000000
+r 31C0.10
+*Want "MDBR/MDB NF -2.0/-QNaN NT"       FFF8B000 00000000 FFF8B000 00000000
+r 31D0.10
+*Want "MDBR/MDB NF -2.0/-QNaN Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 31E0.10
+*Want "MDBR/MDB NF -2.0/+SNaN NT"       7FF8A000 00000000 C0000000 00000000
+r 31F0.10
+*Want "MDBR/MDB NF -2.0/+SNaN Tr"       7FF8A000 00000000 C0000000 00000000
+r 3200.10
+*Want "MDBR/MDB NF -0/-inf NT"          7FF80000 00000000 80000000 00000000
+r 3210.10
+*Want "MDBR/MDB NF -0/-inf Tr"          7FF80000 00000000 80000000 00000000
+r 3220.10
+*Want "MDBR/MDB NF -0/-2.0 NT"          00000000 00000000 00000000 00000000
+r 3230.10
+*Want "MDBR/MDB NF -0/-2.0 Tr"          00000000 00000000 00000000 00000000
+r 3240.10
+*Want "MDBR/MDB NF -0/-0 NT"            00000000 00000000 00000000 00000000
+r 3250.10
+*Want "MDBR/MDB NF -0/-0 Tr"            00000000 00000000 00000000 00000000
+r 3260.10
+*Want "MDBR/MDB NF -0/+0 NT"            80000000 00000000 80000000 00000000
+r 3270.10
+*Want "MDBR/MDB NF -0/+0 Tr"            80000000 00000000 80000000 00000000
+r 3280.10
+*Want "MDBR/MDB NF -0/+2.0 NT"          80000000 00000000 80000000 00000000
+r 3290.10
+*Want "MDBR/MDB NF -0/+2.0 Tr"          80000000 00000000 80000000 00000000
+r 32A0.10
+*Want "MDBR/MDB NF -0/+inf NT"          7FF80000 00000000 80000000 00000000
+r 32B0.10
+*Want "MDBR/MDB NF -0/+inf Tr"          7FF80000 00000000 80000000 00000000
+r 32C0.10
+*Want "MDBR/MDB NF -0/-QNaN NT"         FFF8B000 00000000 FFF8B000 00000000
+r 32D0.10
+*Want "MDBR/MDB NF -0/-QNaN Tr"         FFF8B000 00000000 FFF8B000 00000000
+r 32E0.10
+*Want "MDBR/MDB NF -0/+SNaN NT"         7FF8A000 00000000 80000000 00000000
+r 32F0.10
+*Want "MDBR/MDB NF -0/+SNaN Tr"         7FF8A000 00000000 80000000 00000000
+r 3300.10
+*Want "MDBR/MDB NF +0/-inf NT"          7FF80000 00000000 00000000 00000000
+r 3310.10
+*Want "MDBR/MDB NF +0/-inf Tr"          7FF80000 00000000 00000000 00000000
+r 3320.10
+*Want "MDBR/MDB NF +0/-2.0 NT"          80000000 00000000 80000000 00000000
+r 3330.10
+*Want "MDBR/MDB NF +0/-2.0 Tr"          80000000 00000000 80000000 00000000
+r 3340.10
+*Want "MDBR/MDB NF +0/-0 NT"            80000000 00000000 80000000 00000000
+r 3350.10
+*Want "MDBR/MDB NF +0/-0 Tr"            80000000 00000000 80000000 00000000
+r 3360.10
+*Want "MDBR/MDB NF +0/+0 NT"            00000000 00000000 00000000 00000000
+r 3370.10
+*Want "MDBR/MDB NF +0/+0 Tr"            00000000 00000000 00000000 00000000
+r 3380.10
+*Want "MDBR/MDB NF +0/+2.0 NT"          00000000 00000000 00000000 00000000
+r 3390.10
+*Want "MDBR/MDB NF +0/+2.0 Tr"          00000000 00000000 00000000 00000000
+r 33A0.10
+*Want "MDBR/MDB NF +0/+inf NT"          7FF80000 00000000 00000000 00000000
+r 33B0.10
+*Want "MDBR/MDB NF +0/+inf Tr"          7FF80000 00000000 00000000 00000000
+r 33C0.10
+*Want "MDBR/MDB NF +0/-QNaN NT"         FFF8B000 00000000 FFF8B000 00000000
+r 33D0.10
+*Want "MDBR/MDB NF +0/-QNaN Tr"         FFF8B000 00000000 FFF8B000 00000000
+r 33E0.10
+*Want "MDBR/MDB NF +0/+SNaN NT"         7FF8A000 00000000 00000000 00000000
+r 33F0.10
+*Want "MDBR/MDB NF +0/+SNaN Tr"         7FF8A000 00000000 00000000 00000000
+r 3400.10
+*Want "MDBR/MDB NF +2.0/-inf NT"        FFF00000 00000000 FFF00000 00000000
+r 3410.10
+*Want "MDBR/MDB NF +2.0/-inf Tr"        FFF00000 00000000 FFF00000 00000000
+r 3420.10
+*Want "MDBR/MDB NF +2.0/-2.0 NT"        C0100000 00000000 C0100000 00000000
+r 3430.10
+*Want "MDBR/MDB NF +2.0/-2.0 Tr"        C0100000 00000000 C0100000 00000000
+r 3440.10
+*Want "MDBR/MDB NF +2.0/-0 NT"          80000000 00000000 80000000 00000000
+r 3450.10
+*Want "MDBR/MDB NF +2.0/-0 Tr"          80000000 00000000 80000000 00000000
+r 3460.10
+*Want "MDBR/MDB NF +2.0/+0 NT"          00000000 00000000 00000000 00000000
+r 3470.10
+*Want "MDBR/MDB NF +2.0/+0 Tr"          00000000 00000000 00000000 00000000
+r 3480.10
+*Want "MDBR/MDB NF +2.0/+2.0 NT"        40100000 00000000 40100000 00000000
+r 3490.10
+*Want "MDBR/MDB NF +2.0/+2.0 Tr"        40100000 00000000 40100000 00000000
+r 34A0.10
+*Want "MDBR/MDB NF +2.0/+inf NT"        7FF00000 00000000 7FF00000 00000000
+r 34B0.10
+*Want "MDBR/MDB NF +2.0/+inf Tr"        7FF00000 00000000 7FF00000 00000000
+r 34C0.10
+*Want "MDBR/MDB NF +2.0/-QNaN NT"       FFF8B000 00000000 FFF8B000 00000000
+r 34D0.10
+*Want "MDBR/MDB NF +2.0/-QNaN Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 34E0.10
+*Want "MDBR/MDB NF +2.0/+SNaN NT"       7FF8A000 00000000 40000000 00000000
+r 34F0.10
+*Want "MDBR/MDB NF +2.0/+SNaN Tr"       7FF8A000 00000000 40000000 00000000
+r 3500.10
+*Want "MDBR/MDB NF +inf/-inf NT"        FFF00000 00000000 FFF00000 00000000
+r 3510.10
+*Want "MDBR/MDB NF +inf/-inf Tr"        FFF00000 00000000 FFF00000 00000000
+r 3520.10
+*Want "MDBR/MDB NF +inf/-2.0 NT"        FFF00000 00000000 FFF00000 00000000
+r 3530.10
+*Want "MDBR/MDB NF +inf/-2.0 Tr"        FFF00000 00000000 FFF00000 00000000
+r 3540.10
+*Want "MDBR/MDB NF +inf/-0 NT"          7FF80000 00000000 7FF00000 00000000
+r 3550.10
+*Want "MDBR/MDB NF +inf/-0 Tr"          7FF80000 00000000 7FF00000 00000000
+r 3560.10
+*Want "MDBR/MDB NF +inf/+0 NT"          7FF80000 00000000 7FF00000 00000000
+r 3570.10
+*Want "MDBR/MDB NF +inf/+0 Tr"          7FF80000 00000000 7FF00000 00000000
+r 3580.10
+*Want "MDBR/MDB NF +inf/+2.0 NT"        7FF00000 00000000 7FF00000 00000000
+r 3590.10
+*Want "MDBR/MDB NF +inf/+2.0 Tr"        7FF00000 00000000 7FF00000 00000000
+r 35A0.10
+*Want "MDBR/MDB NF +inf/+inf NT"        7FF00000 00000000 7FF00000 00000000
+r 35B0.10
+*Want "MDBR/MDB NF +inf/+inf Tr"        7FF00000 00000000 7FF00000 00000000
+r 35C0.10
+*Want "MDBR/MDB NF +inf/-QNaN NT"       FFF8B000 00000000 FFF8B000 00000000
+r 35D0.10
+*Want "MDBR/MDB NF +inf/-QNaN Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 35E0.10
+*Want "MDBR/MDB NF +inf/+SNaN NT"       7FF8A000 00000000 7FF00000 00000000
+r 35F0.10
+*Want "MDBR/MDB NF +inf/+SNaN Tr"       7FF8A000 00000000 7FF00000 00000000
+r 3600.10
+*Want "MDBR/MDB NF -QNaN/-inf NT"       FFF8B000 00000000 FFF8B000 00000000
+r 3610.10
+*Want "MDBR/MDB NF -QNaN/-inf Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 3620.10
+*Want "MDBR/MDB NF -QNaN/-2.0 NT"       FFF8B000 00000000 FFF8B000 00000000
+r 3630.10
+*Want "MDBR/MDB NF -QNaN/-2.0 Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 3640.10
+*Want "MDBR/MDB NF -QNaN/-0 NT"         FFF8B000 00000000 FFF8B000 00000000
+r 3650.10
+*Want "MDBR/MDB NF -QNaN/-0 Tr"         FFF8B000 00000000 FFF8B000 00000000
+r 3660.10
+*Want "MDBR/MDB NF -QNaN/+0 NT"         FFF8B000 00000000 FFF8B000 00000000
+r 3670.10
+*Want "MDBR/MDB NF -QNaN/+0 Tr"         FFF8B000 00000000 FFF8B000 00000000
+r 3680.10
+*Want "MDBR/MDB NF -QNaN/+2.0 NT"       FFF8B000 00000000 FFF8B000 00000000
+r 3690.10
+*Want "MDBR/MDB NF -QNaN/+2.0 Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 36A0.10
+*Want "MDBR/MDB NF -QNaN/+inf NT"       FFF8B000 00000000 FFF8B000 00000000
+r 36B0.10
+*Want "MDBR/MDB NF -QNaN/+inf Tr"       FFF8B000 00000000 FFF8B000 00000000
+r 36C0.10
+*Want "MDBR/MDB NF -QNaN/-QNaN NT"      FFF8B000 00000000 FFF8B000 00000000
+r 36D0.10
+*Want "MDBR/MDB NF -QNaN/-QNaN Tr"      FFF8B000 00000000 FFF8B000 00000000
+r 36E0.10
+*Want "MDBR/MDB NF -QNaN/+SNaN NT"      7FF8A000 00000000 FFF8B000 00000000
+r 36F0.10
+*Want "MDBR/MDB NF -QNaN/+SNaN Tr"      7FF8A000 00000000 FFF8B000 00000000
+r 3700.10
+*Want "MDBR/MDB NF +SNaN/-inf NT"       7FF8A000 00000000 7FF0A000 00000000
+r 3710.10
+*Want "MDBR/MDB NF +SNaN/-inf Tr"       7FF8A000 00000000 7FF0A000 00000000
+r 3720.10
+*Want "MDBR/MDB NF +SNaN/-2.0 NT"       7FF8A000 00000000 7FF0A000 00000000
+r 3730.10
+*Want "MDBR/MDB NF +SNaN/-2.0 Tr"       7FF8A000 00000000 7FF0A000 00000000
+r 3740.10
+*Want "MDBR/MDB NF +SNaN/-0 NT"         7FF8A000 00000000 7FF0A000 00000000
+r 3750.10
+*Want "MDBR/MDB NF +SNaN/-0 Tr"         7FF8A000 00000000 7FF0A000 00000000
+r 3760.10
+*Want "MDBR/MDB NF +SNaN/+0 NT"         7FF8A000 00000000 7FF0A000 00000000
+r 3770.10
+*Want "MDBR/MDB NF +SNaN/+0 Tr"         7FF8A000 00000000 7FF0A000 00000000
+r 3780.10
+*Want "MDBR/MDB NF +SNaN/+2.0 NT"       7FF8A000 00000000 7FF0A000 00000000
+r 3790.10
+*Want "MDBR/MDB NF +SNaN/+2.0 Tr"       7FF8A000 00000000 7FF0A000 00000000
+r 37A0.10
+*Want "MDBR/MDB NF +SNaN/+inf NT"       7FF8A000 00000000 7FF0A000 00000000
+r 37B0.10
+*Want "MDBR/MDB NF +SNaN/+inf Tr"       7FF8A000 00000000 7FF0A000 00000000
+r 37C0.10
+*Want "MDBR/MDB NF +SNaN/-QNaN NT"      7FF8A000 00000000 7FF0A000 00000000
+r 37D0.10
+*Want "MDBR/MDB NF +SNaN/-QNaN Tr"      7FF8A000 00000000 7FF0A000 00000000
+r 37E0.10
+*Want "MDBR/MDB NF +SNaN/+SNaN NT"      7FF8A000 00000000 7FF0A000 00000000
+r 37F0.10
+*Want "MDBR/MDB NF +SNaN/+SNaN Tr"      7FF8A000 00000000 7FF0A000 00000000
+
+
+# Long BFP non-finite test results - FPCR contents
+*Compare
+r 3800.10
+*Want "MDBR NF -inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3810.10
+*Want "MDB NF -inf/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3820.10
+*Want "MDBR NF -inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 3830.10
+*Want "MDB NF -inf/+0 FPCR"             00800000 F8008000 00800000 F8008000
+r 3840.10
+*Want "MDBR NF -inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3850.10
+*Want "MDB NF -inf/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 3860.10
+*Want "MDBR NF -inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 3870.10
+*Want "MDB NF -inf/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 3880.10
+*Want "MDBR NF -2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3890.10
+*Want "MDB NF -2.0/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 38A0.10
+*Want "MDBR NF -2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 38B0.10
+*Want "MDB NF -2.0/+0 FPCR"             00000000 F8000000 00000000 F8000000
+r 38C0.10
+*Want "MDBR NF -2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 38D0.10
+*Want "MDB NF -2.0/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 38E0.10
+*Want "MDBR NF -2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 38F0.10
+*Want "MDB NF -2.0/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 3900.10
+*Want "MDBR NF -0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 3910.10
+*Want "MDB NF -0/-2.0 FPCR"             00000000 F8000000 00000000 F8000000
+r 3920.10
+*Want "MDBR NF -0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 3930.10
+*Want "MDB NF -0/+0 FPCR"               00000000 F8000000 00000000 F8000000
+r 3940.10
+*Want "MDBR NF -0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3950.10
+*Want "MDB NF -0/+inf FPCR"             00800000 F8008000 00800000 F8008000
+r 3960.10
+*Want "MDBR NF -0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 3970.10
+*Want "MDB NF -0/+SNaN FPCR"            00800000 F8008000 00800000 F8008000
+r 3980.10
+*Want "MDBR NF +0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 3990.10
+*Want "MDB NF +0/-2.0 FPCR"             00000000 F8000000 00000000 F8000000
+r 39A0.10
+*Want "MDBR NF +0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 39B0.10
+*Want "MDB NF +0/+0 FPCR"               00000000 F8000000 00000000 F8000000
+r 39C0.10
+*Want "MDBR NF +0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 39D0.10
+*Want "MDB NF +0/+inf FPCR"             00800000 F8008000 00800000 F8008000
+r 39E0.10
+*Want "MDBR NF +0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 39F0.10
+*Want "MDB NF +0/+SNaN FPCR"            00800000 F8008000 00800000 F8008000
+r 3A00.10
+*Want "MDBR NF +2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3A10.10
+*Want "MDB NF +2.0/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3A20.10
+*Want "MDBR NF +2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3A30.10
+*Want "MDB NF +2.0/+0 FPCR"             00000000 F8000000 00000000 F8000000
+r 3A40.10
+*Want "MDBR NF +2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3A50.10
+*Want "MDB NF +2.0/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 3A60.10
+*Want "MDBR NF +2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 3A70.10
+*Want "MDB NF +2.0/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 3A80.10
+*Want "MDBR NF +inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3A90.10
+*Want "MDB NF +inf/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3AA0.10
+*Want "MDBR NF +inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 3AB0.10
+*Want "MDB NF +inf/+0 FPCR"             00800000 F8008000 00800000 F8008000
+r 3AC0.10
+*Want "MDBR NF +inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3AD0.10
+*Want "MDB NF +inf/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 3AE0.10
+*Want "MDBR NF +inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 3AF0.10
+*Want "MDB NF +inf/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 3B00.10
+*Want "MDBR NF -QNaN/-inf FPCR"         00000000 F8000000 00000000 F8000000
+r 3B10.10
+*Want "MDB NF -QNaN/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3B20.10
+*Want "MDBR NF -QNaN/-0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3B30.10
+*Want "MDB NF -QNaN/+0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3B40.10
+*Want "MDBR NF -QNaN/+2.0 FPCR"         00000000 F8000000 00000000 F8000000
+r 3B50.10
+*Want "MDB NF -QNaN/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3B60.10
+*Want "MDBR NF -QNaN/-QNaN FPCR"        00000000 F8000000 00000000 F8000000
+r 3B70.10
+*Want "MDB NF -QNaN/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 3B80.10
+*Want "MDBR NF +SNaN/-inf FPCR"         00800000 F8008000 00800000 F8008000
+r 3B90.10
+*Want "MDB NF +SNaN/-2.0 FPCR"          00800000 F8008000 00800000 F8008000
+r 3BA0.10
+*Want "MDBR NF +SNaN/-0 FPCR"           00800000 F8008000 00800000 F8008000
+r 3BB0.10
+*Want "MDB NF +SNaN/+0 FPCR"            00800000 F8008000 00800000 F8008000
+r 3BC0.10
+*Want "MDBR NF +SNaN/+2.0 FPCR"         00800000 F8008000 00800000 F8008000
+r 3BD0.10
+*Want "MDB NF +SNaN/+inf FPCR"          00800000 F8008000 00800000 F8008000
+r 3BE0.10
+*Want "MDBR NF +SNaN/-QNaN FPCR"        00800000 F8008000 00800000 F8008000
+r 3BF0.10
+*Want "MDB NF +SNaN/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+
+
+# Long BFP finite test results
+*Compare
+r 3C00.10
+*Want "MDBR F Ovfl NT"                  FFF00000 00000000 DFEFFFFF FFFFFFFE
+r 3C10.10
+*Want "MDB F Ovfl Tr"                   FFF00000 00000000 DFEFFFFF FFFFFFFE
+r 3C20.10
+*Want "MDBR F Ufl 1 NT"                 00000000 00000000 203FFFFF FFFFFFFF
+r 3C30.10
+*Want "MDB F Ufl 1 Tr"                  00000000 00000000 203FFFFF FFFFFFFF
+r 3C40.10
+*Want "MDBR F Ufl 2 NT"                 00000000 00000000 1FDE1E00 00000000
+r 3C50.10
+*Want "MDB F Ufl 2 Tr"                  00000000 00000000 1FDE1E00 00000000
+r 3C60.10
+*Want "MDBR F Nmin NT"                  001FFFFF FFFFFFFE 001FFFFF FFFFFFFE
+r 3C70.10
+*Want "MDB F Nmin Tr"                   001FFFFF FFFFFFFE 001FFFFF FFFFFFFE
+r 3C80.10
+*Want "MDBR F Incr NT"                  3FF10000 0000000D 3FF10000 0000000D
+r 3C90.10
+*Want "MDB F Incr Tr"                   3FF10000 0000000D 3FF10000 0000000D
+r 3CA0.10
+*Want "MDBR F Trun NT"                  3FF10000 00000007 3FF10000 00000007
+r 3CB0.10
+*Want "MDB F Trun Tr"                   3FF10000 00000007 3FF10000 00000007
+
+
+# Long BFP finite test results - FPCR contents
+*Compare
+r 3E00.10
+*Want "MDBR/MDB F Ovfl FPCR"            00280000 F8002800 00280000 F8002800
+r 3E10.10
+*Want "MDBR/MDB F Ufl 1 FPCR"           00180000 F8001000 00180000 F8001000
+r 3E20.10
+*Want "MDBR/MDB F Ufl 2 FPCR"           00180000 F8001000 00180000 F8001000
+r 3E30.10
+*Want "MDBR/MDB F Nmin FPCR"            00000000 F8000000 00000000 F8000000
+r 3E40.10
+*Want "MDBR/MDB F Incr FPCR"            00080000 F8000C00 00080000 F8000C00
+r 3E50.10
+*Want "MDBR/MDB F Trun FPCR"            00080000 F8000800 00080000 F8000800
+
+
+# Long BFP rounding mode test results
+*Compare
+r 4000.10
+*Want "MDBR RM +NZ RNTE"                3FF10000 00000007 3FF10000 00000007
+r 4010.10
+*Want "MDB RM +NZ RZ"                   3FF10000 00000007 3FF10000 00000007
+r 4020.10
+*Want "MDBR RM +NZ RP"                  3FF10000 00000008 3FF10000 00000008
+r 4030.10
+*Want "MDB RM +NZ RM"                   3FF10000 00000007 3FF10000 00000007
+r 4040.10
+*Want "MDBR RM +NZ RFS"                 3FF10000 00000007 3FF10000 00000007
+r 4050.10
+*Want "MDB RM -NZ RNTE"                 BFF10000 00000007 BFF10000 00000007
+r 4060.10
+*Want "MDBR RM -NZ RZ"                  BFF10000 00000007 BFF10000 00000007
+r 4070.10
+*Want "MDB RM -NZ RP"                   BFF10000 00000007 BFF10000 00000007
+r 4080.10
+*Want "MDBR RM -NZ RM"                  BFF10000 00000008 BFF10000 00000008
+r 4090.10
+*Want "MDB RM -NZ RFS"                  BFF10000 00000007 BFF10000 00000007
+r 40A0.10
+*Want "MDBR RM +NA RNTE"                3FF10000 0000000D 3FF10000 0000000D
+r 40B0.10
+*Want "MDB RM +NA RZ"                   3FF10000 0000000C 3FF10000 0000000C
+r 40C0.10
+*Want "MDBR RM +NA RP"                  3FF10000 0000000D 3FF10000 0000000D
+r 40D0.10
+*Want "MDB RM +NA RM"                   3FF10000 0000000C 3FF10000 0000000C
+r 40E0.10
+*Want "MDBR RM +NA RFS"                 3FF10000 0000000D 3FF10000 0000000D
+r 40F0.10
+*Want "MDB RM -NA RNTE"                 BFF10000 0000000D BFF10000 0000000D
+r 4100.10
+*Want "MDBR RM -NA RZ"                  BFF10000 0000000C BFF10000 0000000C
+r 4110.10
+*Want "MDB RM -NA RP"                   BFF10000 0000000C BFF10000 0000000C
+r 4120.10
+*Want "MDBR RM -NA RM"                  BFF10000 0000000D BFF10000 0000000D
+r 4130.10
+*Want "MDB RM -NA RFS"                  BFF10000 0000000D BFF10000 0000000D
+r 4140.10
+*Want "MDBR RM +TZ RNTE"                3FF10000 00000008 3FF10000 00000008
+r 4150.10
+*Want "MDB RM +TZ RZ"                   3FF10000 00000008 3FF10000 00000008
+r 4160.10
+*Want "MDBR RM +TZ RP"                  3FF10000 00000009 3FF10000 00000009
+r 4170.10
+*Want "MDB RM +TZ RM"                   3FF10000 00000008 3FF10000 00000008
+r 4180.10
+*Want "MDBR RM +TZ RFS"                 3FF10000 00000009 3FF10000 00000009
+r 4190.10
+*Want "MDB RM -TZ RNTE"                 BFF10000 00000008 BFF10000 00000008
+r 41A0.10
+*Want "MDBR RM -TZ RZ"                  BFF10000 00000008 BFF10000 00000008
+r 41B0.10
+*Want "MDB RM -TZ RP"                   BFF10000 00000008 BFF10000 00000008
+r 41C0.10
+*Want "MDBR RM -TZ RM"                  BFF10000 00000009 BFF10000 00000009
+r 41D0.10
+*Want "MDB RM -TZ RFS"                  BFF10000 00000009 BFF10000 00000009
+r 41E0.10
+*Want "MDBR RM +TA RNTE"                3FF10000 0000001A 3FF10000 0000001A
+r 41F0.10
+*Want "MDB RM +TA RZ"                   3FF10000 00000019 3FF10000 00000019
+r 4200.10
+*Want "MDBR RM +TA RP"                  3FF10000 0000001A 3FF10000 0000001A
+r 4210.10
+*Want "MDB RM +TA RM"                   3FF10000 00000019 3FF10000 00000019
+r 4220.10
+*Want "MDBR RM +TA RFS"                 3FF10000 00000019 3FF10000 00000019
+r 4230.10
+*Want "MDB RM -TA RNTE"                 BFF10000 0000001A BFF10000 0000001A
+r 4240.10
+*Want "MDBR RM -TA RZ"                  BFF10000 00000019 BFF10000 00000019
+r 4250.10
+*Want "MDB RM -TA RP"                   BFF10000 00000019 BFF10000 00000019
+r 4260.10
+*Want "MDBR RM -TA RM"                  BFF10000 0000001A BFF10000 0000001A
+r 4270.10
+*Want "MDB RM -TA RFS"                  BFF10000 00000019 BFF10000 00000019
+
+
+# Long BFP rounding mode test results - FPCR contents
+*Compare
+r 4500.10
+*Want "MDBR/MDB RM +NZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4510.10
+*Want "MDBR/MDB RM +NZ RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4520.8
+*Want "MDBR/MDB RM +NZ RFS FPCR"        00080007 00080007  
+r 4530.10
+*Want "MDBR/MDB RM +NZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4540.10
+*Want "MDBR/MDB RM +NZ RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4550.8
+*Want "MDBR/MDB RM -NZ RFS FPCR"        00080007 00080007  
+r 4560.10
+*Want "MDBR/MDB RM -NZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4570.10
+*Want "MDBR/MDB RM -NZ RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4580.8
+*Want "MDBR/MDB RM -NZ RFS FPCR"        00080007 00080007  
+r 4590.10
+*Want "MDBR/MDB RM -NZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 45A0.10
+*Want "MDBR/MDB RM -NA RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 45B0.8
+*Want "MDBR/MDB RM -NA RFS FPCR"        00080007 00080007  
+r 45C0.10
+*Want "MDBR/MDB RM +TZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 45D0.10
+*Want "MDBR/MDB RM +TZ RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 45E0.8
+*Want "MDBR/MDB RM +TZ RFS FPCR"        00080007 00080007  
+r 45F0.10
+*Want "MDBR/MDB RM -TZ RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4600.10
+*Want "MDBR/MDB RM -TZ RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4610.8
+*Want "MDBR/MDB RM -TZ RFS FPCR"        00080007 00080007  
+r 4620.10
+*Want "MDBR/MDB RM +TA RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4630.10
+*Want "MDBR/MDB RM +TA RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4640.8
+*Want "MDBR/MDB RM +TA RFS FPCR"        00080007 00080007  
+r 4650.10
+*Want "MDBR/MDB RM -TA RNTE, RZ FPCR"   00080000 00080000 00080001 00080001
+r 4660.10
+*Want "MDBR/MDB RM -TA RP, RM FPCR"     00080002 00080002 00080003 00080003
+r 4670.8
+*Want "MDBR/MDB RM -TA RFS FPCR"        00080007 00080007  
+
+
+# Extended BFP non-finite test results
+*Compare
+r 5000.10
+*Want "MXBR NF -inf/-inf NT"            7FFF0000 00000000 00000000 00000000
+r 5010.10
+*Want "MXBR NF -inf/-inf Tr"            7FFF0000 00000000 00000000 00000000
+r 5020.10
+*Want "MXBR NF -inf/-2.0 NT"            7FFF0000 00000000 00000000 00000000
+r 5030.10
+*Want "MXBR NF -inf/-2.0 Tr"            7FFF0000 00000000 00000000 00000000
+r 5040.10
+*Want "MXBR NF -inf/-0 NT"              7FFF8000 00000000 00000000 00000000
+r 5050.10
+*Want "MXBR NF -inf/-0 Tr"              FFFF0000 00000000 00000000 00000000
+r 5060.10
+*Want "MXBR NF -inf/+0 NT"              7FFF8000 00000000 00000000 00000000
+r 5070.10
+*Want "MXBR NF -inf/+0 Tr"              FFFF0000 00000000 00000000 00000000
+r 5080.10
+*Want "MXBR NF -inf/+2.0 NT"            FFFF0000 00000000 00000000 00000000
+r 5090.10
+*Want "MXBR NF -inf/+2.0 Tr"            FFFF0000 00000000 00000000 00000000
+r 50A0.10
+*Want "MXBR NF -inf/+inf NT"            FFFF0000 00000000 00000000 00000000
+r 50B0.10
+*Want "MXBR NF -inf/+inf Tr"            FFFF0000 00000000 00000000 00000000
+r 50C0.10
+*Want "MXBR NF -inf/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 50D0.10
+*Want "MXBR NF -inf/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 50E0.10
+*Want "MXBR NF -inf/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 50F0.10
+*Want "MXBR NF -inf/+SNaN Tr"           FFFF0000 00000000 00000000 00000000
+r 5100.10
+*Want "MXBR NF -2.0/-inf NT"            7FFF0000 00000000 00000000 00000000
+r 5110.10
+*Want "MXBR NF -2.0/-inf Tr"            7FFF0000 00000000 00000000 00000000
+r 5120.10
+*Want "MXBR NF -2.0/-2.0 NT"            40010000 00000000 00000000 00000000
+r 5130.10
+*Want "MXBR NF -2.0/-2.0 Tr"            40010000 00000000 00000000 00000000
+r 5140.10
+*Want "MXBR NF -2.0/-0 NT"              00000000 00000000 00000000 00000000
+r 5150.10
+*Want "MXBR NF -2.0/-0 Tr"              00000000 00000000 00000000 00000000
+r 5160.10
+*Want "MXBR NF -2.0/+0 NT"              80000000 00000000 00000000 00000000
+r 5170.10
+*Want "MXBR NF -2.0/+0 Tr"              80000000 00000000 00000000 00000000
+r 5180.10
+*Want "MXBR NF -2.0/+2.0 NT"            C0010000 00000000 00000000 00000000
+r 5190.10
+*Want "MXBR NF -2.0/+2.0 Tr"            C0010000 00000000 00000000 00000000
+r 51A0.10
+*Want "MXBR NF -2.0/+inf NT"            FFFF0000 00000000 00000000 00000000
+r 51B0.10
+*Want "MXBR NF -2.0/+inf Tr"            FFFF0000 00000000 00000000 00000000
+r 51C0.10
+*Want "MXBR NF -2.0/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 51D0.10
+*Want "MXBR NF -2.0/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 51E0.10
+*Want "MXBR NF -2.0/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 51F0.10
+*Want "MXBR NF -2.0/+SNaN Tr"           C0000000 00000000 00000000 00000000
+r 5200.10
+*Want "MXBR NF -0/-inf NT"              7FFF8000 00000000 00000000 00000000
+r 5210.10
+*Want "MXBR NF -0/-inf Tr"              80000000 00000000 00000000 00000000
+r 5220.10
+*Want "MXBR NF -0/-2.0 NT"              00000000 00000000 00000000 00000000
+r 5230.10
+*Want "MXBR NF -0/-2.0 Tr"              00000000 00000000 00000000 00000000
+r 5240.10
+*Want "MXBR NF -0/-0 NT"                00000000 00000000 00000000 00000000
+r 5250.10
+*Want "MXBR NF -0/-0 Tr"                00000000 00000000 00000000 00000000
+r 5260.10
+*Want "MXBR NF -0/+0 NT"                80000000 00000000 00000000 00000000
+r 5270.10
+*Want "MXBR NF -0/+0 Tr"                80000000 00000000 00000000 00000000
+r 5280.10
+*Want "MXBR NF -0/+2.0 NT"              80000000 00000000 00000000 00000000
+r 5290.10
+*Want "MXBR NF -0/+2.0 Tr"              80000000 00000000 00000000 00000000
+r 52A0.10
+*Want "MXBR NF -0/+inf NT"              7FFF8000 00000000 00000000 00000000
+r 52B0.10
+*Want "MXBR NF -0/+inf Tr"              80000000 00000000 00000000 00000000
+r 52C0.10
+*Want "MXBR NF -0/-QNaN NT"             FFFF8B00 00000000 00000000 00000000
+r 52D0.10
+*Want "MXBR NF -0/-QNaN Tr"             FFFF8B00 00000000 00000000 00000000
+r 52E0.10
+*Want "MXBR NF -0/+SNaN NT"             7FFF8A00 00000000 00000000 00000000
+r 52F0.10
+*Want "MXBR NF -0/+SNaN Tr"             80000000 00000000 00000000 00000000
+r 5300.10
+*Want "MXBR NF +0/-inf NT"              7FFF8000 00000000 00000000 00000000
+r 5310.10
+*Want "MXBR NF +0/-inf Tr"              00000000 00000000 00000000 00000000
+r 5320.10
+*Want "MXBR NF +0/-2.0 NT"              80000000 00000000 00000000 00000000
+r 5330.10
+*Want "MXBR NF +0/-2.0 Tr"              80000000 00000000 00000000 00000000
+r 5340.10
+*Want "MXBR NF +0/-0 NT"                80000000 00000000 00000000 00000000
+r 5350.10
+*Want "MXBR NF +0/-0 Tr"                80000000 00000000 00000000 00000000
+r 5360.10
+*Want "MXBR NF +0/+0 NT"                00000000 00000000 00000000 00000000
+r 5370.10
+*Want "MXBR NF +0/+0 Tr"                00000000 00000000 00000000 00000000
+r 5380.10
+*Want "MXBR NF +0/+2.0 NT"              00000000 00000000 00000000 00000000
+r 5390.10
+*Want "MXBR NF +0/+2.0 Tr"              00000000 00000000 00000000 00000000
+r 53A0.10
+*Want "MXBR NF +0/+inf NT"              7FFF8000 00000000 00000000 00000000
+r 53B0.10
+*Want "MXBR NF +0/+inf Tr"              00000000 00000000 00000000 00000000
+r 53C0.10
+*Want "MXBR NF +0/-QNaN NT"             FFFF8B00 00000000 00000000 00000000
+r 53D0.10
+*Want "MXBR NF +0/-QNaN Tr"             FFFF8B00 00000000 00000000 00000000
+r 53E0.10
+*Want "MXBR NF +0/+SNaN NT"             7FFF8A00 00000000 00000000 00000000
+r 53F0.10
+*Want "MXBR NF +0/+SNaN Tr"             00000000 00000000 00000000 00000000
+r 5400.10
+*Want "MXBR NF +2.0/-inf NT"            FFFF0000 00000000 00000000 00000000
+r 5410.10
+*Want "MXBR NF +2.0/-inf Tr"            FFFF0000 00000000 00000000 00000000
+r 5420.10
+*Want "MXBR NF +2.0/-2.0 NT"            C0010000 00000000 00000000 00000000
+r 5430.10
+*Want "MXBR NF +2.0/-2.0 Tr"            C0010000 00000000 00000000 00000000
+r 5440.10
+*Want "MXBR NF +2.0/-0 NT"              80000000 00000000 00000000 00000000
+r 5450.10
+*Want "MXBR NF +2.0/-0 Tr"              80000000 00000000 00000000 00000000
+r 5460.10
+*Want "MXBR NF +2.0/+0 NT"              00000000 00000000 00000000 00000000
+r 5470.10
+*Want "MXBR NF +2.0/+0 Tr"              00000000 00000000 00000000 00000000
+r 5480.10
+*Want "MXBR NF +2.0/+2.0 NT"            40010000 00000000 00000000 00000000
+r 5490.10
+*Want "MXBR NF +2.0/+2.0 Tr"            40010000 00000000 00000000 00000000
+r 54A0.10
+*Want "MXBR NF +2.0/+inf NT"            7FFF0000 00000000 00000000 00000000
+r 54B0.10
+*Want "MXBR NF +2.0/+inf Tr"            7FFF0000 00000000 00000000 00000000
+r 54C0.10
+*Want "MXBR NF +2.0/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 54D0.10
+*Want "MXBR NF +2.0/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 54E0.10
+*Want "MXBR NF +2.0/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 54F0.10
+*Want "MXBR NF +2.0/+SNaN Tr"           40000000 00000000 00000000 00000000
+r 5500.10
+*Want "MXBR NF +inf/-inf NT"            FFFF0000 00000000 00000000 00000000
+r 5510.10
+*Want "MXBR NF +inf/-inf Tr"            FFFF0000 00000000 00000000 00000000
+r 5520.10
+*Want "MXBR NF +inf/-2.0 NT"            FFFF0000 00000000 00000000 00000000
+r 5530.10
+*Want "MXBR NF +inf/-2.0 Tr"            FFFF0000 00000000 00000000 00000000
+r 5540.10
+*Want "MXBR NF +inf/-0 NT"              7FFF8000 00000000 00000000 00000000
+r 5550.10
+*Want "MXBR NF +inf/-0 Tr"              7FFF0000 00000000 00000000 00000000
+r 5560.10
+*Want "MXBR NF +inf/+0 NT"              7FFF8000 00000000 00000000 00000000
+r 5570.10
+*Want "MXBR NF +inf/+0 Tr"              7FFF0000 00000000 00000000 00000000
+r 5580.10
+*Want "MXBR NF +inf/+2.0 NT"            7FFF0000 00000000 00000000 00000000
+r 5590.10
+*Want "MXBR NF +inf/+2.0 Tr"            7FFF0000 00000000 00000000 00000000
+r 55A0.10
+*Want "MXBR NF +inf/+inf NT"            7FFF0000 00000000 00000000 00000000
+r 55B0.10
+*Want "MXBR NF +inf/+inf Tr"            7FFF0000 00000000 00000000 00000000
+r 55C0.10
+*Want "MXBR NF +inf/-QNaN NT"           FFFF8B00 00000000 00000000 00000000
+r 55D0.10
+*Want "MXBR NF +inf/-QNaN Tr"           FFFF8B00 00000000 00000000 00000000
+r 55E0.10
+*Want "MXBR NF +inf/+SNaN NT"           7FFF8A00 00000000 00000000 00000000
+r 55F0.10
+*Want "MXBR NF +inf/+SNaN Tr"           7FFF0000 00000000 00000000 00000000
+r 5600.10
+*Want "MXBR NF -QNaN/-inf NT"           FFFF8B00 00000000 00000000 00000000
+r 5610.10
+*Want "MXBR NF -QNaN/-inf Tr"           FFFF8B00 00000000 00000000 00000000
+r 5620.10
+*Want "MXBR NF -QNaN/-2.0 NT"           FFFF8B00 00000000 00000000 00000000
+r 5630.10
+*Want "MXBR NF -QNaN/-2.0 Tr"           FFFF8B00 00000000 00000000 00000000
+r 5640.10
+*Want "MXBR NF -QNaN/-0 NT"             FFFF8B00 00000000 00000000 00000000
+r 5650.10
+*Want "MXBR NF -QNaN/-0 Tr"             FFFF8B00 00000000 00000000 00000000
+r 5660.10
+*Want "MXBR NF -QNaN/+0 NT"             FFFF8B00 00000000 00000000 00000000
+r 5670.10
+*Want "MXBR NF -QNaN/+0 Tr"             FFFF8B00 00000000 00000000 00000000
+r 5680.10
+*Want "MXBR NF -QNaN/+2.0 NT"           FFFF8B00 00000000 00000000 00000000
+r 5690.10
+*Want "MXBR NF -QNaN/+2.0 Tr"           FFFF8B00 00000000 00000000 00000000
+r 56A0.10
+*Want "MXBR NF -QNaN/+inf NT"           FFFF8B00 00000000 00000000 00000000
+r 56B0.10
+*Want "MXBR NF -QNaN/+inf Tr"           FFFF8B00 00000000 00000000 00000000
+r 56C0.10
+*Want "MXBR NF -QNaN/-QNaN NT"          FFFF8B00 00000000 00000000 00000000
+r 56D0.10
+*Want "MXBR NF -QNaN/-QNaN Tr"          FFFF8B00 00000000 00000000 00000000
+r 56E0.10
+*Want "MXBR NF -QNaN/+SNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 56F0.10
+*Want "MXBR NF -QNaN/+SNaN Tr"          FFFF8B00 00000000 00000000 00000000
+r 5700.10
+*Want "MXBR NF +SNaN/-inf NT"           7FFF8A00 00000000 00000000 00000000
+r 5710.10
+*Want "MXBR NF +SNaN/-inf Tr"           7FFF0A00 00000000 00000000 00000000
+r 5720.10
+*Want "MXBR NF +SNaN/-2.0 NT"           7FFF8A00 00000000 00000000 00000000
+r 5730.10
+*Want "MXBR NF +SNaN/-2.0 Tr"           7FFF0A00 00000000 00000000 00000000
+r 5740.10
+*Want "MXBR NF +SNaN/-0 NT"             7FFF8A00 00000000 00000000 00000000
+r 5750.10
+*Want "MXBR NF +SNaN/-0 Tr"             7FFF0A00 00000000 00000000 00000000
+r 5760.10
+*Want "MXBR NF +SNaN/+0 NT"             7FFF8A00 00000000 00000000 00000000
+r 5770.10
+*Want "MXBR NF +SNaN/+0 Tr"             7FFF0A00 00000000 00000000 00000000
+r 5780.10
+*Want "MXBR NF +SNaN/+2.0 NT"           7FFF8A00 00000000 00000000 00000000
+r 5790.10
+*Want "MXBR NF +SNaN/+2.0 Tr"           7FFF0A00 00000000 00000000 00000000
+r 57A0.10
+*Want "MXBR NF +SNaN/+inf NT"           7FFF8A00 00000000 00000000 00000000
+r 57B0.10
+*Want "MXBR NF +SNaN/+inf Tr"           7FFF0A00 00000000 00000000 00000000
+r 57C0.10
+*Want "MXBR NF +SNaN/-QNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 57D0.10
+*Want "MXBR NF +SNaN/-QNaN Tr"          7FFF0A00 00000000 00000000 00000000
+r 57E0.10
+*Want "MXBR NF +SNaN/+SNaN NT"          7FFF8A00 00000000 00000000 00000000
+r 57F0.10
+*Want "MXBR NF +SNaN/+SNaN Tr"          7FFF0A00 00000000 00000000 00000000
+
+
+# Extended BFP non-finite test results - FPCR contents
+*Compare
+r 5800.08
+*Want "MXBR NF -inf/-inf FPCR"          00000000 F8000000
+r 5810.08
+*Want "MXBR NF -inf/-2.0 FPCR"          00000000 F8000000
+r 5820.08
+*Want "MXBR NF -inf/-0 FPCR"            00800000 F8008000
+r 5830.08
+*Want "MXBR NF -inf/+0 FPCR"            00800000 F8008000
+r 5840.08
+*Want "MXBR NF -inf/+2.0 FPCR"          00000000 F8000000
+r 5850.08
+*Want "MXBR NF -inf/+inf FPCR"          00000000 F8000000
+r 5860.08
+*Want "MXBR NF -inf/-QNaN FPCR"         00000000 F8000000
+r 5870.08
+*Want "MXBR NF -inf/+SNaN FPCR"         00800000 F8008000
+r 5880.08
+*Want "MXBR NF -2.0/-inf FPCR"          00000000 F8000000
+r 5890.08
+*Want "MXBR NF -2.0/-2.0 FPCR"          00000000 F8000000
+r 58A0.08
+*Want "MXBR NF -2.0/-0 FPCR"            00000000 F8000000
+r 58B0.08
+*Want "MXBR NF -2.0/+0 FPCR"            00000000 F8000000
+r 58C0.08
+*Want "MXBR NF -2.0/+2.0 FPCR"          00000000 F8000000
+r 58D0.08
+*Want "MXBR NF -2.0/+inf FPCR"          00000000 F8000000
+r 58E0.08
+*Want "MXBR NF -2.0/-QNaN FPCR"         00000000 F8000000
+r 58F0.08
+*Want "MXBR NF -2.0/+SNaN FPCR"         00800000 F8008000
+r 5900.08
+*Want "MXBR NF -0/-inf FPCR"            00800000 F8008000
+r 5910.08
+*Want "MXBR NF -0/-2.0 FPCR"            00000000 F8000000
+r 5920.08
+*Want "MXBR NF -0/-0 FPCR"              00000000 F8000000
+r 5930.08
+*Want "MXBR NF -0/+0 FPCR"              00000000 F8000000
+r 5940.08
+*Want "MXBR NF -0/+2.0 FPCR"            00000000 F8000000
+r 5950.08
+*Want "MXBR NF -0/+inf FPCR"            00800000 F8008000
+r 5960.08
+*Want "MXBR NF -0/-QNaN FPCR"           00000000 F8000000
+r 5970.08
+*Want "MXBR NF -0/+SNaN FPCR"           00800000 F8008000
+r 5980.08
+*Want "MXBR NF +0/-inf FPCR"            00800000 F8008000
+r 5990.08
+*Want "MXBR NF +0/-2.0 FPCR"            00000000 F8000000
+r 59A0.08
+*Want "MXBR NF +0/-0 FPCR"              00000000 F8000000
+r 59B0.08
+*Want "MXBR NF +0/+0 FPCR"              00000000 F8000000
+r 59C0.08
+*Want "MXBR NF +0/+2.0 FPCR"            00000000 F8000000
+r 59D0.08
+*Want "MXBR NF +0/+inf FPCR"            00800000 F8008000
+r 59E0.08
+*Want "MXBR NF +0/-QNaN FPCR"           00000000 F8000000
+r 59F0.08
+*Want "MXBR NF +0/+SNaN FPCR"           00800000 F8008000
+r 5A00.08
+*Want "MXBR NF +2.0/-inf FPCR"          00000000 F8000000
+r 5A10.08
+*Want "MXBR NF +2.0/-2.0 FPCR"          00000000 F8000000
+r 5A20.08
+*Want "MXBR NF +2.0/-0 FPCR"            00000000 F8000000
+r 5A30.08
+*Want "MXBR NF +2.0/+0 FPCR"            00000000 F8000000
+r 5A40.08
+*Want "MXBR NF +2.0/+2.0 FPCR"          00000000 F8000000
+r 5A50.08
+*Want "MXBR NF +2.0/+inf FPCR"          00000000 F8000000
+r 5A60.08
+*Want "MXBR NF +2.0/-QNaN FPCR"         00000000 F8000000
+r 5A70.08
+*Want "MXBR NF +2.0/+SNaN FPCR"         00800000 F8008000
+r 5A80.08
+*Want "MXBR NF +inf/-inf FPCR"          00000000 F8000000
+r 5A90.08
+*Want "MXBR NF +inf/-2.0 FPCR"          00000000 F8000000
+r 5AA0.08
+*Want "MXBR NF +inf/-0 FPCR"            00800000 F8008000
+r 5AB0.08
+*Want "MXBR NF +inf/+0 FPCR"            00800000 F8008000
+r 5AC0.08
+*Want "MXBR NF +inf/+2.0 FPCR"          00000000 F8000000
+r 5AD0.08
+*Want "MXBR NF +inf/+inf FPCR"          00000000 F8000000
+r 5AE0.08
+*Want "MXBR NF +inf/-QNaN FPCR"         00000000 F8000000
+r 5AF0.08
+*Want "MXBR NF +inf/+SNaN FPCR"         00800000 F8008000
+r 5B00.08
+*Want "MXBR NF -QNaN/-inf FPCR"         00000000 F8000000
+r 5B10.08
+*Want "MXBR NF -QNaN/-2.0 FPCR"         00000000 F8000000
+r 5B20.08
+*Want "MXBR NF -QNaN/-0 FPCR"           00000000 F8000000
+r 5B30.08
+*Want "MXBR NF -QNaN/+0 FPCR"           00000000 F8000000
+r 5B40.08
+*Want "MXBR NF -QNaN/+2.0 FPCR"         00000000 F8000000
+r 5B50.08
+*Want "MXBR NF -QNaN/+inf FPCR"         00000000 F8000000
+r 5B60.08
+*Want "MXBR NF -QNaN/-QNaN FPCR"        00000000 F8000000
+r 5B70.08
+*Want "MXBR NF -QNaN/+SNaN FPCR"        00800000 F8008000
+r 5B80.08
+*Want "MXBR NF +SNaN/-inf FPCR"         00800000 F8008000
+r 5B90.08
+*Want "MXBR NF +SNaN/-2.0 FPCR"         00800000 F8008000
+r 5BA0.08
+*Want "MXBR NF +SNaN/-0 FPCR"           00800000 F8008000
+r 5BB0.08
+*Want "MXBR NF +SNaN/+0 FPCR"           00800000 F8008000
+r 5BC0.08
+*Want "MXBR NF +SNaN/+2.0 FPCR"         00800000 F8008000
+r 5BD0.08
+*Want "MXBR NF +SNaN/+inf FPCR"         00800000 F8008000
+r 5BE0.08
+*Want "MXBR NF +SNaN/-QNaN FPCR"        00800000 F8008000
+r 5BF0.08
+*Want "MXBR NF +SNaN/+SNaN FPCR"        00800000 F8008000
+
+
+# Extended BFP finite test results
+*Compare
+r 5C00.10
+*Want "MXBR F Ovfl NT"                  FFFF0000 00000000 00000000 00000000
+r 5C10.10
+*Want "MXBR F Ovfl Tr"                  DFFEFFFF FFFFFFFF FFFFFFFF FFFFFFFE
+r 5C20.10
+*Want "MXBR F Ufl 1 NT"                 00000000 00000000 00000000 00000000
+r 5C30.10
+*Want "MXBR F Ufl 1 Tr"                 2003FFFF FFFFFFFF FFFFFFFF FFFFFFFF
+r 5C40.10
+*Want "MXBR F Ufl 2 NT"                 00000000 00000000 00000000 00000000
+r 5C50.10
+*Want "MXBR F Ufl 2 Tr"                 1FFDE1E0 00000000 00000000 00000000
+r 5C60.10
+*Want "MXBR F Nmin NT"                  00020000 00000000 00000000 00000000
+r 5C70.10
+*Want "MXBR F Nmin Tr"                  00020000 00000000 00000000 00000000
+r 5C80.10
+*Want "MXBR F Incr NT"                  3FFF1000 00000000 00000000 0000000D
+r 5C90.10
+*Want "MXBR F Incr Tr"                  3FFF1000 00000000 00000000 0000000D
+r 5CA0.10
+*Want "MXBR F Trun NT"                  3FFF1000 00000000 00000000 00000007
+r 5CB0.10
+*Want "MXBR F Trun Tr"                  3FFF1000 00000000 00000000 00000007
+
+
+# Extended BFP finite test results - FPCR contents
+*Compare
+r 5E00.8
+*Want "MXBR F Ovfl FPCR"                00280000 F8002800
+r 5E10.8  
+*Want "MXBR F Ufl 1 FPCR"               00180000 F8001000  
+r 5E20.8
+*Want "MXBR F Ufl 2 FPCR"               00180000 F8001000  
+r 5E30.8
+*Want "MXBR F Nmin FPCR"                00080000 F8000C00  
+r 5E40.8
+*Want "MXBR F Incr FPCR"                00080000 F8000C00  
+r 5E50.8
+*Want "MXBR F Trun FPCR"                00080000 F8000800  
+
+
+# Extended BFP rounding mode test results
+*Compare
+r 6000.10
+*Want "MXBR RM +NZ RNTE"                3FFF1000 00000000 00000000 00000007
+r 6010.10
+*Want "MXBR RM +NZ RZ"                  3FFF1000 00000000 00000000 00000007
+r 6020.10
+*Want "MXBR RM +NZ RP"                  3FFF1000 00000000 00000000 00000008
+r 6030.10
+*Want "MXBR RM +NZ RM"                  3FFF1000 00000000 00000000 00000007
+r 6040.10
+*Want "MXBR RM +NZ RFS"                 3FFF1000 00000000 00000000 00000007
+r 6050.10
+*Want "MXBR RM -NZ RNTE"                BFFF1000 00000000 00000000 00000007
+r 6060.10
+*Want "MXBR RM -NZ RZ"                  BFFF1000 00000000 00000000 00000007
+r 6070.10
+*Want "MXBR RM -NZ RP"                  BFFF1000 00000000 00000000 00000007
+r 6080.10
+*Want "MXBR RM -NZ RM"                  BFFF1000 00000000 00000000 00000008
+r 6090.10
+*Want "MXBR RM -NZ RFS"                 BFFF1000 00000000 00000000 00000007
+r 60A0.10
+*Want "MXBR RM +NA RNTE"                3FFF1000 00000000 00000000 0000000D
+r 60B0.10
+*Want "MXBR RM +NA RZ"                  3FFF1000 00000000 00000000 0000000C
+r 60C0.10
+*Want "MXBR RM +NA RP"                  3FFF1000 00000000 00000000 0000000D
+r 60D0.10
+*Want "MXBR RM +NA RM"                  3FFF1000 00000000 00000000 0000000C
+r 60E0.10
+*Want "MXBR RM +NA RFS"                 3FFF1000 00000000 00000000 0000000D
+r 60F0.10
+*Want "MXBR RM -NA RNTE"                BFFF1000 00000000 00000000 0000000D
+r 6100.10
+*Want "MXBR RM -NA RZ"                  BFFF1000 00000000 00000000 0000000C
+r 6110.10
+*Want "MXBR RM -NA RP"                  BFFF1000 00000000 00000000 0000000C
+r 6120.10
+*Want "MXBR RM -NA RM"                  BFFF1000 00000000 00000000 0000000D
+r 6130.10
+*Want "MXBR RM -NA RFS"                 BFFF1000 00000000 00000000 0000000D
+r 6140.10
+*Want "MXBR RM +TZ RNTE"                3FFF1000 00000000 00000000 00000008
+r 6150.10
+*Want "MXBR RM +TZ RZ"                  3FFF1000 00000000 00000000 00000008
+r 6160.10
+*Want "MXBR RM +TZ RP"                  3FFF1000 00000000 00000000 00000009
+r 6170.10
+*Want "MXBR RM +TZ RM"                  3FFF1000 00000000 00000000 00000008
+r 6180.10
+*Want "MXBR RM +TZ RFS"                 3FFF1000 00000000 00000000 00000009
+r 6190.10
+*Want "MXBR RM -TZ RNTE"                BFFF1000 00000000 00000000 00000008
+r 61A0.10
+*Want "MXBR RM -TZ RZ"                  BFFF1000 00000000 00000000 00000008
+r 61B0.10
+*Want "MXBR RM -TZ RP"                  BFFF1000 00000000 00000000 00000008
+r 61C0.10
+*Want "MXBR RM -TZ RM"                  BFFF1000 00000000 00000000 00000009
+r 61D0.10
+*Want "MXBR RM -TZ RFS"                 BFFF1000 00000000 00000000 00000009
+r 61E0.10
+*Want "MXBR RM +TA RNTE"                3FFF1000 00000000 00000000 0000001A
+r 61F0.10
+*Want "MXBR RM +TA RZ"                  3FFF1000 00000000 00000000 00000019
+r 6200.10
+*Want "MXBR RM +TA RP"                  3FFF1000 00000000 00000000 0000001A
+r 6210.10
+*Want "MXBR RM +TA RM"                  3FFF1000 00000000 00000000 00000019
+r 6220.10
+*Want "MXBR RM +TA RFS"                 3FFF1000 00000000 00000000 00000019
+r 6230.10
+*Want "MXBR RM -TA RNTE"                BFFF1000 00000000 00000000 0000001A
+r 6240.10
+*Want "MXBR RM -TA RZ"                  BFFF1000 00000000 00000000 00000019
+r 6250.10
+*Want "MXBR RM -TA RP"                  BFFF1000 00000000 00000000 00000019
+r 6260.10
+*Want "MXBR RM -TA RM"                  BFFF1000 00000000 00000000 0000001A
+r 6270.10
+*Want "MXBR RM -TA RFS"                 BFFF1000 00000000 00000000 00000019
+
+
+# Extended BFP rounding mode test results - FPCR contents
+*Compare
+r 6500.10
+*Want "MXBR RM +NZ RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 6510.4
+*Want "MXBR RM +NZ RFS FPCR"            00080007
+r 6520.10
+*Want "MXBR RM -NZ RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 6530.4
+*Want "MXBR RM -NZ RFS FPCR"            00080007
+r 6540.10
+*Want "MXBR RM +NA RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 6550.4
+*Want "MXBR RM +NA RFS FPCR"            00080007
+r 6560.10
+*Want "MXBR RM -NA RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 6570.4
+*Want "MXBR RM -NA RFS FPCR"            00080007
+r 6580.10
+*Want "MXBR RM +TZ RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 6590.4
+*Want "MXBR RM +TZ RFS FPCR"            00080007
+r 65A0.10
+*Want "MXBR RM -TZ RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 65B0.4
+*Want "MXBR RM -TZ RFS FPCR"            00080007
+r 65C0.10
+*Want "MXBR RM +TA RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 65D0.4
+*Want "MXBR RM +TA RFS FPCR"            00080007
+r 65E0.10
+*Want "MXBR RM -TA RNTE, RZ,RP,RM FPCR" 00080000 00080001 00080002 00080003
+r 65F0.4
+*Want "MXBR RM -TA RFS FPCR"            00080007
+
+
+
+*Done
+
@@ -0,0 +1,1068 @@
+*Testcase bfp-020-multlonger.tst: MDEBR, MDEB, MXDBR, MXDB
+
+#Testcase bfp-020-multlonger.tst: Multiplication to longer format tests Multiply (4)
+#..Includes only multiply to increased precision MDEBR/MDEB and MXDBR/MXDB
+#..Test cases evaluate NaN propagation, NaN generation, operations
+#..using non-finite values, trappable and non-trappable IEEE
+#..exceptions, result scaling, and exhaustive rounding testing.
+#..Excludes multiply to same precision and fused multiply.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 92 program check messages that have no
+# value in the validation process.
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-020-multlonger.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+# Short BFP multiply to long results
+*Compare
+r 1000.10
+*Want "MDEBR NF -inf/-inf"        7FF00000 00000000 7FF00000 00000000
+r 1010.10
+*Want "MDEB NF -inf/-inf"         7FF00000 00000000 7FF00000 00000000
+r 1020.10
+*Want "MDEBR NF -inf/-2.0"        7FF00000 00000000 7FF00000 00000000
+r 1030.10
+*Want "MDEB NF -inf/-2.0"         7FF00000 00000000 7FF00000 00000000
+r 1040.10
+*Want "MDEBR NF -inf/-0"          7FF80000 00000000 FF800000 00000000
+r 1050.10
+*Want "MDEB NF -inf/-0"           7FF80000 00000000 FF800000 00000000
+r 1060.10
+*Want "MDEBR NF -inf/+0"          7FF80000 00000000 FF800000 00000000
+r 1070.10
+*Want "MDEB NF -inf/+0"           7FF80000 00000000 FF800000 00000000
+r 1080.10
+*Want "MDEBR NF -inf/+2.0"        FFF00000 00000000 FFF00000 00000000
+r 1090.10
+*Want "MDEB NF -inf/+2.0"         FFF00000 00000000 FFF00000 00000000
+r 10A0.10
+*Want "MDEBR NF -inf/+inf"        FFF00000 00000000 FFF00000 00000000
+r 10B0.10
+*Want "MDEB NF -inf/+inf"         FFF00000 00000000 FFF00000 00000000
+r 10C0.10
+*Want "MDEBR NF -inf/-QNaN"       FFF96000 00000000 FFF96000 00000000
+r 10D0.10
+*Want "MDEB NF -inf/-QNaN"        FFF96000 00000000 FFF96000 00000000
+r 10E0.10
+*Want "MDEBR NF -inf/+SNaN"       7FF94000 00000000 FF800000 00000000
+r 10F0.10
+*Want "MDEB NF -inf/+SNaN"        7FF94000 00000000 FF800000 00000000
+r 1100.10
+*Want "MDEBR NF -2.0/-inf"        7FF00000 00000000 7FF00000 00000000
+r 1110.10
+*Want "MDEB NF -2.0/-inf"         7FF00000 00000000 7FF00000 00000000
+r 1120.10
+*Want "MDEBR NF -2.0/-2.0"        40100000 00000000 40100000 00000000
+r 1130.10
+*Want "MDEB NF -2.0/-2.0"         40100000 00000000 40100000 00000000
+r 1140.10
+*Want "MDEBR NF -2.0/-0"          00000000 00000000 00000000 00000000
+r 1150.10
+*Want "MDEB NF -2.0/-0"           00000000 00000000 00000000 00000000
+r 1160.10
+*Want "MDEBR NF -2.0/+0"          80000000 00000000 80000000 00000000
+r 1170.10
+*Want "MDEB NF -2.0/+0"           80000000 00000000 80000000 00000000
+r 1180.10
+*Want "MDEBR NF -2.0/+2.0"        C0100000 00000000 C0100000 00000000
+r 1190.10
+*Want "MDEB NF -2.0/+2.0"         C0100000 00000000 C0100000 00000000
+r 11A0.10
+*Want "MDEBR NF -2.0/+inf"        FFF00000 00000000 FFF00000 00000000
+r 11B0.10
+*Want "MDEB NF -2.0/+inf"         FFF00000 00000000 FFF00000 00000000
+r 11C0.10
+*Want "MDEBR NF -2.0/-QNaN"       FFF96000 00000000 FFF96000 00000000
+r 11D0.10
+*Want "MDEB NF -2.0/-QNaN"        FFF96000 00000000 FFF96000 00000000
+r 11E0.10
+*Want "MDEBR NF -2.0/+SNaN"       7FF94000 00000000 C0000000 00000000
+r 11F0.10
+*Want "MDEB NF -2.0/+SNaN"        7FF94000 00000000 C0000000 00000000
+r 1200.10
+*Want "MDEBR NF -0/-inf"          7FF80000 00000000 80000000 00000000
+r 1210.10
+*Want "MDEB NF -0/-inf"           7FF80000 00000000 80000000 00000000
+r 1220.10
+*Want "MDEBR NF -0/-2.0"          00000000 00000000 00000000 00000000
+r 1230.10
+*Want "MDEB NF -0/-2.0"           00000000 00000000 00000000 00000000
+r 1240.10
+*Want "MDEBR NF -0/-0"            00000000 00000000 00000000 00000000
+r 1250.10
+*Want "MDEB NF -0/-0"             00000000 00000000 00000000 00000000
+r 1260.10
+*Want "MDEBR NF -0/+0"            80000000 00000000 80000000 00000000
+r 1270.10
+*Want "MDEB NF -0/+0"             80000000 00000000 80000000 00000000
+r 1280.10
+*Want "MDEBR NF -0/+2.0"          80000000 00000000 80000000 00000000
+r 1290.10
+*Want "MDEB NF -0/+2.0"           80000000 00000000 80000000 00000000
+r 12A0.10
+*Want "MDEBR NF -0/+inf"          7FF80000 00000000 80000000 00000000
+r 12B0.10
+*Want "MDEB NF -0/+inf"           7FF80000 00000000 80000000 00000000
+r 12C0.10
+*Want "MDEBR NF -0/-QNaN"         FFF96000 00000000 FFF96000 00000000
+r 12D0.10
+*Want "MDEB NF -0/-QNaN"          FFF96000 00000000 FFF96000 00000000
+r 12E0.10
+*Want "MDEBR NF -0/+SNaN"         7FF94000 00000000 80000000 00000000
+r 12F0.10
+*Want "MDEB NF -0/+SNaN"          7FF94000 00000000 80000000 00000000
+r 1300.10
+*Want "MDEBR NF +0/-inf"          7FF80000 00000000 00000000 00000000
+r 1310.10
+*Want "MDEB NF +0/-inf"           7FF80000 00000000 00000000 00000000
+r 1320.10
+*Want "MDEBR NF +0/-2.0"          80000000 00000000 80000000 00000000
+r 1330.10
+*Want "MDEB NF +0/-2.0"           80000000 00000000 80000000 00000000
+r 1340.10
+*Want "MDEBR NF +0/-0"            80000000 00000000 80000000 00000000
+r 1350.10
+*Want "MDEB NF +0/-0"             80000000 00000000 80000000 00000000
+r 1360.10
+*Want "MDEBR NF +0/+0"            00000000 00000000 00000000 00000000
+r 1370.10
+*Want "MDEB NF +0/+0"             00000000 00000000 00000000 00000000
+r 1380.10
+*Want "MDEBR NF +0/+2.0"          00000000 00000000 00000000 00000000
+r 1390.10
+*Want "MDEB NF +0/+2.0"           00000000 00000000 00000000 00000000
+r 13A0.10
+*Want "MDEBR NF +0/+inf"          7FF80000 00000000 00000000 00000000
+r 13B0.10
+*Want "MDEB NF +0/+inf"           7FF80000 00000000 00000000 00000000
+r 13C0.10
+*Want "MDEBR NF +0/-QNaN"         FFF96000 00000000 FFF96000 00000000
+r 13D0.10
+*Want "MDEB NF +0/-QNaN"          FFF96000 00000000 FFF96000 00000000
+r 13E0.10
+*Want "MDEBR NF +0/+SNaN"         7FF94000 00000000 00000000 00000000
+r 13F0.10
+*Want "MDEB NF +0/+SNaN"          7FF94000 00000000 00000000 00000000
+r 1400.10
+*Want "MDEBR NF +2.0/-inf"        FFF00000 00000000 FFF00000 00000000
+r 1410.10
+*Want "MDEB NF +2.0/-inf"         FFF00000 00000000 FFF00000 00000000
+r 1420.10
+*Want "MDEBR NF +2.0/-2.0"        C0100000 00000000 C0100000 00000000
+r 1430.10
+*Want "MDEB NF +2.0/-2.0"         C0100000 00000000 C0100000 00000000
+r 1440.10
+*Want "MDEBR NF +2.0/-0"          80000000 00000000 80000000 00000000
+r 1450.10
+*Want "MDEB NF +2.0/-0"           80000000 00000000 80000000 00000000
+r 1460.10
+*Want "MDEBR NF +2.0/+0"          00000000 00000000 00000000 00000000
+r 1470.10
+*Want "MDEB NF +2.0/+0"           00000000 00000000 00000000 00000000
+r 1480.10
+*Want "MDEBR NF +2.0/+2.0"        40100000 00000000 40100000 00000000
+r 1490.10
+*Want "MDEB NF +2.0/+2.0"         40100000 00000000 40100000 00000000
+r 14A0.10
+*Want "MDEBR NF +2.0/+inf"        7FF00000 00000000 7FF00000 00000000
+r 14B0.10
+*Want "MDEB NF +2.0/+inf"         7FF00000 00000000 7FF00000 00000000
+r 14C0.10
+*Want "MDEBR NF +2.0/-QNaN"       FFF96000 00000000 FFF96000 00000000
+r 14D0.10
+*Want "MDEB NF +2.0/-QNaN"        FFF96000 00000000 FFF96000 00000000
+r 14E0.10
+*Want "MDEBR NF +2.0/+SNaN"       7FF94000 00000000 40000000 00000000
+r 14F0.10
+*Want "MDEB NF +2.0/+SNaN"        7FF94000 00000000 40000000 00000000
+r 1500.10
+*Want "MDEBR NF +inf/-inf"        FFF00000 00000000 FFF00000 00000000
+r 1510.10
+*Want "MDEB NF +inf/-inf"         FFF00000 00000000 FFF00000 00000000
+r 1520.10
+*Want "MDEBR NF +inf/-2.0"        FFF00000 00000000 FFF00000 00000000
+r 1530.10
+*Want "MDEB NF +inf/-2.0"         FFF00000 00000000 FFF00000 00000000
+r 1540.10
+*Want "MDEBR NF +inf/-0"          7FF80000 00000000 7F800000 00000000
+r 1550.10
+*Want "MDEB NF +inf/-0"           7FF80000 00000000 7F800000 00000000
+r 1560.10
+*Want "MDEBR NF +inf/+0"          7FF80000 00000000 7F800000 00000000
+r 1570.10
+*Want "MDEB NF +inf/+0"           7FF80000 00000000 7F800000 00000000
+r 1580.10
+*Want "MDEBR NF +inf/+2.0"        7FF00000 00000000 7FF00000 00000000
+r 1590.10
+*Want "MDEB NF +inf/+2.0"         7FF00000 00000000 7FF00000 00000000
+r 15A0.10
+*Want "MDEBR NF +inf/+inf"        7FF00000 00000000 7FF00000 00000000
+r 15B0.10
+*Want "MDEB NF +inf/+inf"         7FF00000 00000000 7FF00000 00000000
+r 15C0.10
+*Want "MDEBR NF +inf/-QNaN"       FFF96000 00000000 FFF96000 00000000
+r 15D0.10
+*Want "MDEB NF +inf/-QNaN"        FFF96000 00000000 FFF96000 00000000
+r 15E0.10
+*Want "MDEBR NF +inf/+SNaN"       7FF94000 00000000 7F800000 00000000
+r 15F0.10
+*Want "MDEB NF +inf/+SNaN"        7FF94000 00000000 7F800000 00000000
+r 1600.10
+*Want "MDEBR NF -QNaN/-inf"       FFF96000 00000000 FFF96000 00000000
+r 1610.10
+*Want "MDEB NF -QNaN/-inf"        FFF96000 00000000 FFF96000 00000000
+r 1620.10
+*Want "MDEBR NF -QNaN/-2.0"       FFF96000 00000000 FFF96000 00000000
+r 1630.10
+*Want "MDEB NF -QNaN/-2.0"        FFF96000 00000000 FFF96000 00000000
+r 1640.10
+*Want "MDEBR NF -QNaN/-0"         FFF96000 00000000 FFF96000 00000000
+r 1650.10
+*Want "MDEB NF -QNaN/-0"          FFF96000 00000000 FFF96000 00000000
+r 1660.10
+*Want "MDEBR NF -QNaN/+0"         FFF96000 00000000 FFF96000 00000000
+r 1670.10
+*Want "MDEB NF -QNaN/+0"          FFF96000 00000000 FFF96000 00000000
+r 1680.10
+*Want "MDEBR NF -QNaN/+2.0"       FFF96000 00000000 FFF96000 00000000
+r 1690.10
+*Want "MDEB NF -QNaN/+2.0"        FFF96000 00000000 FFF96000 00000000
+r 16A0.10
+*Want "MDEBR NF -QNaN/+inf"       FFF96000 00000000 FFF96000 00000000
+r 16B0.10
+*Want "MDEB NF -QNaN/+inf"        FFF96000 00000000 FFF96000 00000000
+r 16C0.10
+*Want "MDEBR NF -QNaN/-QNaN"      FFF96000 00000000 FFF96000 00000000
+r 16D0.10
+*Want "MDEB NF -QNaN/-QNaN"       FFF96000 00000000 FFF96000 00000000
+r 16E0.10
+*Want "MDEBR NF -QNaN/+SNaN"      7FF94000 00000000 FFCB0000 00000000
+r 16F0.10
+*Want "MDEB NF -QNaN/+SNaN"       7FF94000 00000000 FFCB0000 00000000
+r 1700.10
+*Want "MDEBR NF +SNaN/-inf"       7FF94000 00000000 7F8A0000 00000000
+r 1710.10
+*Want "MDEB NF +SNaN/-inf"        7FF94000 00000000 7F8A0000 00000000
+r 1720.10
+*Want "MDEBR NF +SNaN/-2.0"       7FF94000 00000000 7F8A0000 00000000
+r 1730.10
+*Want "MDEB NF +SNaN/-2.0"        7FF94000 00000000 7F8A0000 00000000
+r 1740.10
+*Want "MDEBR NF +SNaN/-0"         7FF94000 00000000 7F8A0000 00000000
+r 1750.10
+*Want "MDEB NF +SNaN/-0"          7FF94000 00000000 7F8A0000 00000000
+r 1760.10
+*Want "MDEBR NF +SNaN/+0"         7FF94000 00000000 7F8A0000 00000000
+r 1770.10
+*Want "MDEB NF +SNaN/+0"          7FF94000 00000000 7F8A0000 00000000
+r 1780.10
+*Want "MDEBR NF +SNaN/+2.0"       7FF94000 00000000 7F8A0000 00000000
+r 1790.10
+*Want "MDEB NF +SNaN/+2.0"        7FF94000 00000000 7F8A0000 00000000
+r 17A0.10
+*Want "MDEBR NF +SNaN/+inf"       7FF94000 00000000 7F8A0000 00000000
+r 17B0.10
+*Want "MDEB NF +SNaN/+inf"        7FF94000 00000000 7F8A0000 00000000
+r 17C0.10
+*Want "MDEBR NF +SNaN/-QNaN"      7FF94000 00000000 7F8A0000 00000000
+r 17D0.10
+*Want "MDEBR NF +SNaN/-QNaN"      7FF94000 00000000 7F8A0000 00000000
+r 17E0.10
+*Want "MDEBR NF +SNaN/+SNaN"      7FF94000 00000000 7F8A0000 00000000
+r 17F0.10
+*Want "MDEB NF +SNaN/+SNaN"       7FF94000 00000000 7F8A0000 00000000
+
+
+# Short BFP multiply to long results - FPCR contents
+*Compare
+r 1800.10
+*Want "MDBR NF -inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 1810.10
+*Want "MDB NF -inf/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 1820.10
+*Want "MDBR NF -inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 1830.10
+*Want "MDB NF -inf/+0 FPCR"             00800000 F8008000 00800000 F8008000
+r 1840.10
+*Want "MDBR NF -inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1850.10
+*Want "MDB NF -inf/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 1860.10
+*Want "MDBR NF -inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 1870.10
+*Want "MDB NF -inf/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 1880.10
+*Want "MDBR NF -2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 1890.10
+*Want "MDB NF -2.0/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 18A0.10
+*Want "MDBR NF -2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 18B0.10
+*Want "MDB NF -2.0/+0 FPCR"             00000000 F8000000 00000000 F8000000
+r 18C0.10
+*Want "MDBR NF -2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 18D0.10
+*Want "MDB NF -2.0/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 18E0.10
+*Want "MDBR NF -2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 18F0.10
+*Want "MDB NF -2.0/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 1900.10
+*Want "MDBR NF -0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 1910.10
+*Want "MDB NF -0/-2.0 FPCR"             00000000 F8000000 00000000 F8000000
+r 1920.10
+*Want "MDBR NF -0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 1930.10
+*Want "MDB NF -0/+0 FPCR"               00000000 F8000000 00000000 F8000000
+r 1940.10
+*Want "MDBR NF -0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 1950.10
+*Want "MDB NF -0/+inf FPCR"             00800000 F8008000 00800000 F8008000
+r 1960.10
+*Want "MDBR NF -0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 1970.10
+*Want "MDB NF -0/+SNaN FPCR"            00800000 F8008000 00800000 F8008000
+r 1980.10
+*Want "MDBR NF +0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 1990.10
+*Want "MDB NF +0/-2.0 FPCR"             00000000 F8000000 00000000 F8000000
+r 19A0.10
+*Want "MDBR NF +0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 19B0.10
+*Want "MDB NF +0/+0 FPCR"               00000000 F8000000 00000000 F8000000
+r 19C0.10
+*Want "MDBR NF +0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 19D0.10
+*Want "MDB NF +0/+inf FPCR"             00800000 F8008000 00800000 F8008000
+r 19E0.10
+*Want "MDBR NF +0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 19F0.10
+*Want "MDB NF +0/+SNaN FPCR"            00800000 F8008000 00800000 F8008000
+r 1A00.10
+*Want "MDBR NF +2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 1A10.10
+*Want "MDB NF +2.0/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 1A20.10
+*Want "MDBR NF +2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 1A30.10
+*Want "MDB NF +2.0/+0 FPCR"             00000000 F8000000 00000000 F8000000
+r 1A40.10
+*Want "MDBR NF +2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1A50.10
+*Want "MDB NF +2.0/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 1A60.10
+*Want "MDBR NF +2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 1A70.10
+*Want "MDB NF +2.0/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 1A80.10
+*Want "MDBR NF +inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 1A90.10
+*Want "MDB NF +inf/-2.0 FPCR"           00000000 F8000000 00000000 F8000000
+r 1AA0.10
+*Want "MDBR NF +inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 1AB0.10
+*Want "MDB NF +inf/+0 FPCR"             00800000 F8008000 00800000 F8008000
+r 1AC0.10
+*Want "MDBR NF +inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1AD0.10
+*Want "MDB NF +inf/+inf FPCR"           00000000 F8000000 00000000 F8000000
+r 1AE0.10
+*Want "MDBR NF +inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 1AF0.10
+*Want "MDB NF +inf/+SNaN FPCR"          00800000 F8008000 00800000 F8008000
+r 1B00.10
+*Want "MDBR NF -QNaN/-inf FPCR"         00000000 F8000000 00000000 F8000000
+r 1B10.10
+*Want "MDB NF -QNaN/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 1B20.10
+*Want "MDBR NF -QNaN/-0 FPCR"           00000000 F8000000 00000000 F8000000
+r 1B30.10
+*Want "MDB NF -QNaN/+0 FPCR"            00000000 F8000000 00000000 F8000000
+r 1B40.10
+*Want "MDBR NF -QNaN/+2.0 FPCR"         00000000 F8000000 00000000 F8000000
+r 1B50.10
+*Want "MDB NF -QNaN/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 1B60.10
+*Want "MDBR NF -QNaN/-QNaN FPCR"        00000000 F8000000 00000000 F8000000
+r 1B70.10
+*Want "MDB NF -QNaN/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 1B80.10
+*Want "MDBR NF +SNaN/-inf FPCR"         00800000 F8008000 00800000 F8008000
+r 1B90.10
+*Want "MDB NF +SNaN/-2.0 FPCR"          00800000 F8008000 00800000 F8008000
+r 1BA0.10
+*Want "MDBR NF +SNaN/-0 FPCR"           00800000 F8008000 00800000 F8008000
+r 1BB0.10
+*Want "MDB NF +SNaN/+0 FPCR"            00800000 F8008000 00800000 F8008000
+r 1BC0.10
+*Want "MDBR NF +SNaN/+2.0 FPCR"         00800000 F8008000 00800000 F8008000
+r 1BD0.10
+*Want "MDB NF +SNaN/+inf FPCR"          00800000 F8008000 00800000 F8008000
+r 1BE0.10
+*Want "MDBR NF +SNaN/-QNaN FPCR"        00800000 F8008000 00800000 F8008000
+r 1BF0.10
+*Want "MDB NF +SNaN/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+
+
+# Long BFP multiply to extended results
+*Compare
+r 2000.10
+*Want "MXDBR NF -inf/-inf NT"   7FFF0000 00000000 00000000 00000000
+r 2010.10
+*Want "MXDBR NF -inf/-inf Tr"   7FFF0000 00000000 00000000 00000000
+r 2020.10
+*Want "MXDB NF -inf/-inf NT"    7FFF0000 00000000 00000000 00000000
+r 2030.10
+*Want "MXDB NF -inf/-inf Tr"    7FFF0000 00000000 00000000 00000000
+r 2040.10
+*Want "MXDBR NF -inf/-2.0 NT"   7FFF0000 00000000 00000000 00000000
+r 2050.10
+*Want "MXDBR NF -inf/-2.0 Tr"   7FFF0000 00000000 00000000 00000000
+r 2060.10
+*Want "MXDB NF -inf/-2.0 NT"    7FFF0000 00000000 00000000 00000000
+r 2070.10
+*Want "MXDB NF -inf/-2.0 Tr"    7FFF0000 00000000 00000000 00000000
+r 2080.10
+*Want "MXDBR NF -inf/-0 NT"     7FFF8000 00000000 00000000 00000000
+r 2090.10
+*Want "MXDBR NF -inf/-0 Tr"     FFF00000 00000000 00000000 00000000
+r 20A0.10
+*Want "MXDB NF -inf/-0 NT"      7FFF8000 00000000 00000000 00000000
+r 20B0.10
+*Want "MXDB NF -inf/-0 Tr"      FFF00000 00000000 00000000 00000000
+r 20C0.10
+*Want "MXDBR NF -inf/+0 NT"     7FFF8000 00000000 00000000 00000000
+r 20D0.10
+*Want "MXDBR NF -inf/+0 Tr"     FFF00000 00000000 00000000 00000000
+r 20E0.10
+*Want "MXDB NF -inf/+0 NT"      7FFF8000 00000000 00000000 00000000
+r 20F0.10
+*Want "MXDB NF -inf/+0 Tr"      FFF00000 00000000 00000000 00000000
+r 2100.10
+*Want "MXDBR NF -inf/+2.0 NT"   FFFF0000 00000000 00000000 00000000
+r 2110.10
+*Want "MXDBR NF -inf/+2.0 Tr"   FFFF0000 00000000 00000000 00000000
+r 2120.10
+*Want "MXDB NF -inf/+2.0 NT"    FFFF0000 00000000 00000000 00000000
+r 2130.10
+*Want "MXDB NF -inf/+2.0 Tr"    FFFF0000 00000000 00000000 00000000
+r 2140.10
+*Want "MXDBR NF -inf/+inf NT"   FFFF0000 00000000 00000000 00000000
+r 2150.10
+*Want "MXDBR NF -inf/+inf Tr"   FFFF0000 00000000 00000000 00000000
+r 2160.10
+*Want "MXDB NF -inf/+inf NT"    FFFF0000 00000000 00000000 00000000
+r 2170.10
+*Want "MXDB NF -inf/+inf Tr"    FFFF0000 00000000 00000000 00000000
+r 2180.10
+*Want "MXDBR NF -inf/-QNaN NT"  FFFF8B00 00000000 00000000 00000000
+r 2190.10
+*Want "MXDBR NF -inf/-QNaN Tr"  FFFF8B00 00000000 00000000 00000000
+r 21A0.10
+*Want "MXDB NF -inf/-QNaN NT"   FFFF8B00 00000000 00000000 00000000
+r 21B0.10
+*Want "MXDB NF -inf/-QNaN Tr"   FFFF8B00 00000000 00000000 00000000
+r 21C0.10
+*Want "MXDBR NF -inf/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 21D0.10
+*Want "MXDBR NF -inf/+SNaN Tr"  FFF00000 00000000 00000000 00000000
+r 21E0.10
+*Want "MXDB NF -inf/+SNaN NT"   7FFF8A00 00000000 00000000 00000000
+r 21F0.10
+*Want "MXDB NF -inf/+SNaN Tr"   FFF00000 00000000 00000000 00000000
+r 2200.10
+*Want "MXDBR NF -2.0/-inf NT"   7FFF0000 00000000 00000000 00000000
+r 2210.10
+*Want "MXDBR NF -2.0/-inf Tr"   7FFF0000 00000000 00000000 00000000
+r 2220.10
+*Want "MXDB NF -2.0/-inf NT"    7FFF0000 00000000 00000000 00000000
+r 2230.10
+*Want "MXDB NF -2.0/-inf Tr"    7FFF0000 00000000 00000000 00000000
+r 2240.10
+*Want "MXDBR NF -2.0/-2.0 NT"   40010000 00000000 00000000 00000000
+r 2250.10
+*Want "MXDBR NF -2.0/-2.0 Tr"   40010000 00000000 00000000 00000000
+r 2260.10
+*Want "MXDB NF -2.0/-2.0 NT"    40010000 00000000 00000000 00000000
+r 2270.10
+*Want "MXDB NF -2.0/-2.0 Tr"    40010000 00000000 00000000 00000000
+r 2280.10
+*Want "MXDBR NF -2.0/-0 NT"     00000000 00000000 00000000 00000000
+r 2290.10
+*Want "MXDBR NF -2.0/-0 Tr"     00000000 00000000 00000000 00000000
+r 22A0.10
+*Want "MXDB NF -2.0/-0 NT"      00000000 00000000 00000000 00000000
+r 22B0.10
+*Want "MXDB NF -2.0/-0 Tr"      00000000 00000000 00000000 00000000
+r 22C0.10
+*Want "MXDBR NF -2.0/+0 NT"     80000000 00000000 00000000 00000000
+r 22D0.10
+*Want "MXDBR NF -2.0/+0 Tr"     80000000 00000000 00000000 00000000
+r 22E0.10
+*Want "MXDB NF -2.0/+0 NT"      80000000 00000000 00000000 00000000
+r 22F0.10
+*Want "MXDB NF -2.0/+0 Tr"      80000000 00000000 00000000 00000000
+r 2300.10
+*Want "MXDBR NF -2.0/+2.0 NT"   C0010000 00000000 00000000 00000000
+r 2310.10
+*Want "MXDBR NF -2.0/+2.0 Tr"   C0010000 00000000 00000000 00000000
+r 2320.10
+*Want "MXDB NF -2.0/+2.0 NT"    C0010000 00000000 00000000 00000000
+r 2330.10
+*Want "MXDB NF -2.0/+2.0 Tr"    C0010000 00000000 00000000 00000000
+r 2340.10
+*Want "MXDBR NF -2.0/+inf NT"   FFFF0000 00000000 00000000 00000000
+r 2350.10
+*Want "MXDBR NF -2.0/+inf Tr"   FFFF0000 00000000 00000000 00000000
+r 2360.10
+*Want "MXDB NF -2.0/+inf NT"    FFFF0000 00000000 00000000 00000000
+r 2370.10
+*Want "MXDB NF -2.0/+inf Tr"    FFFF0000 00000000 00000000 00000000
+r 2380.10
+*Want "MXDBR NF -2.0/-QNaN NT"  FFFF8B00 00000000 00000000 00000000
+r 2390.10
+*Want "MXDBR NF -2.0/-QNaN Tr"  FFFF8B00 00000000 00000000 00000000
+r 23A0.10
+*Want "MXDB NF -2.0/-QNaN NT"   FFFF8B00 00000000 00000000 00000000
+r 23B0.10
+*Want "MXDB NF -2.0/-QNaN Tr"   FFFF8B00 00000000 00000000 00000000
+r 23C0.10
+*Want "MXDBR NF -2.0/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 23D0.10
+*Want "MXDBR NF -2.0/+SNaN Tr"  C0000000 00000000 00000000 00000000
+r 23E0.10
+*Want "MXDB NF -2.0/+SNaN NT"   7FFF8A00 00000000 00000000 00000000
+r 23F0.10
+*Want "MXDB NF -2.0/+SNaN Tr"   C0000000 00000000 00000000 00000000
+r 2400.10
+*Want "MXDBR NF -0/-inf NT"     7FFF8000 00000000 00000000 00000000
+r 2410.10
+*Want "MXDBR NF -0/-inf Tr"     80000000 00000000 00000000 00000000
+r 2420.10
+*Want "MXDB NF -0/-inf NT"      7FFF8000 00000000 00000000 00000000
+r 2430.10
+*Want "MXDB NF -0/-inf Tr"      80000000 00000000 00000000 00000000
+r 2440.10
+*Want "MXDBR NF -0/-2.0 NT"     00000000 00000000 00000000 00000000
+r 2450.10
+*Want "MXDBR NF -0/-2.0 Tr"     00000000 00000000 00000000 00000000
+r 2460.10
+*Want "MXDB NF -0/-2.0 NT"      00000000 00000000 00000000 00000000
+r 2470.10
+*Want "MXDB NF -0/-2.0 Tr"      00000000 00000000 00000000 00000000
+r 2480.10
+*Want "MXDBR NF -0/-0 NT"       00000000 00000000 00000000 00000000
+r 2490.10
+*Want "MXDBR NF -0/-0 Tr"       00000000 00000000 00000000 00000000
+r 24A0.10
+*Want "MXDB NF -0/-0 NT"        00000000 00000000 00000000 00000000
+r 24B0.10
+*Want "MXDB NF -0/-0 Tr"        00000000 00000000 00000000 00000000
+r 24C0.10
+*Want "MXDBR NF -0/+0 NT"       80000000 00000000 00000000 00000000
+r 24D0.10
+*Want "MXDBR NF -0/+0 Tr"       80000000 00000000 00000000 00000000
+r 24E0.10
+*Want "MXDB NF -0/+0 NT"        80000000 00000000 00000000 00000000
+r 24F0.10
+*Want "MXDB NF -0/+0 Tr"        80000000 00000000 00000000 00000000
+r 2500.10
+*Want "MXDBR NF -0/+2.0 NT"     80000000 00000000 00000000 00000000
+r 2510.10
+*Want "MXDBR NF -0/+2.0 Tr"     80000000 00000000 00000000 00000000
+r 2520.10
+*Want "MXDB NF -0/+2.0 NT"      80000000 00000000 00000000 00000000
+r 2530.10
+*Want "MXDB NF -0/+2.0 Tr"      80000000 00000000 00000000 00000000
+r 2540.10
+*Want "MXDBR NF -0/+inf NT"     7FFF8000 00000000 00000000 00000000
+r 2550.10
+*Want "MXDBR NF -0/+inf Tr"     80000000 00000000 00000000 00000000
+r 2560.10
+*Want "MXDB NF -0/+inf NT"      7FFF8000 00000000 00000000 00000000
+r 2570.10
+*Want "MXDB NF -0/+inf Tr"      80000000 00000000 00000000 00000000
+r 2580.10
+*Want "MXDBR NF -0/-QNaN NT"    FFFF8B00 00000000 00000000 00000000
+r 2590.10
+*Want "MXDBR NF -0/-QNaN Tr"    FFFF8B00 00000000 00000000 00000000
+r 25A0.10
+*Want "MXDB NF -0/-QNaN NT"     FFFF8B00 00000000 00000000 00000000
+r 25B0.10
+*Want "MXDB NF -0/-QNaN Tr"     FFFF8B00 00000000 00000000 00000000
+r 25C0.10
+*Want "MXDBR NF -0/+SNaN NT"    7FFF8A00 00000000 00000000 00000000
+r 25D0.10
+*Want "MXDBR NF -0/+SNaN Tr"    80000000 00000000 00000000 00000000
+r 25E0.10
+*Want "MXDB NF -0/+SNaN NT"     7FFF8A00 00000000 00000000 00000000
+r 25F0.10
+*Want "MXDB NF -0/+SNaN Tr"     80000000 00000000 00000000 00000000
+r 2600.10
+*Want "MXDBR NF +0/-inf NT"     7FFF8000 00000000 00000000 00000000
+r 2610.10
+*Want "MXDBR NF +0/-inf Tr"     00000000 00000000 00000000 00000000
+r 2620.10
+*Want "MXDB NF +0/-inf NT"      7FFF8000 00000000 00000000 00000000
+r 2630.10
+*Want "MXDB NF +0/-inf Tr"      00000000 00000000 00000000 00000000
+r 2640.10
+*Want "MXDBR NF +0/-2.0 NT"     80000000 00000000 00000000 00000000
+r 2650.10
+*Want "MXDBR NF +0/-2.0 Tr"     80000000 00000000 00000000 00000000
+r 2660.10
+*Want "MXDB NF +0/-2.0 NT"      80000000 00000000 00000000 00000000
+r 2670.10
+*Want "MXDB NF +0/-2.0 Tr"      80000000 00000000 00000000 00000000
+r 2680.10
+*Want "MXDBR NF +0/-0 NT"       80000000 00000000 00000000 00000000
+r 2690.10
+*Want "MXDBR NF +0/-0 Tr"       80000000 00000000 00000000 00000000
+r 26A0.10
+*Want "MXDB NF +0/-0 NT"        80000000 00000000 00000000 00000000
+r 26B0.10
+*Want "MXDB NF +0/-0 Tr"        80000000 00000000 00000000 00000000
+r 26C0.10
+*Want "MXDBR NF +0/+0 NT"       00000000 00000000 00000000 00000000
+r 26D0.10
+*Want "MXDBR NF +0/+0 Tr"       00000000 00000000 00000000 00000000
+r 26E0.10
+*Want "MXDB NF +0/+0 NT"        00000000 00000000 00000000 00000000
+r 26F0.10
+*Want "MXDB NF +0/+0 Tr"        00000000 00000000 00000000 00000000
+r 2700.10
+*Want "MXDBR NF +0/+2.0 NT"     00000000 00000000 00000000 00000000
+r 2710.10
+*Want "MXDBR NF +0/+2.0 Tr"     00000000 00000000 00000000 00000000
+r 2720.10
+*Want "MXDB NF +0/+2.0 NT"      00000000 00000000 00000000 00000000
+r 2730.10
+*Want "MXDB NF +0/+2.0 Tr"      00000000 00000000 00000000 00000000
+r 2740.10
+*Want "MXDBR NF +0/+inf NT"     7FFF8000 00000000 00000000 00000000
+r 2750.10
+*Want "MXDBR NF +0/+inf Tr"     00000000 00000000 00000000 00000000
+r 2760.10
+*Want "MXDB NF +0/+inf NT"      7FFF8000 00000000 00000000 00000000
+r 2770.10
+*Want "MXDB NF +0/+inf Tr"      00000000 00000000 00000000 00000000
+r 2780.10
+*Want "MXDBR NF +0/-QNaN NT"    FFFF8B00 00000000 00000000 00000000
+r 2790.10
+*Want "MXDBR NF +0/-QNaN Tr"    FFFF8B00 00000000 00000000 00000000
+r 27A0.10
+*Want "MXDB NF +0/-QNaN NT"     FFFF8B00 00000000 00000000 00000000
+r 27B0.10
+*Want "MXDB NF +0/-QNaN Tr"     FFFF8B00 00000000 00000000 00000000
+r 27C0.10
+*Want "MXDBR NF +0/+SNaN NT"    7FFF8A00 00000000 00000000 00000000
+r 27D0.10
+*Want "MXDBR NF +0/+SNaN Tr"    00000000 00000000 00000000 00000000
+r 27E0.10
+*Want "MXDB NF +0/+SNaN NT"     7FFF8A00 00000000 00000000 00000000
+r 27F0.10
+*Want "MXDB NF +0/+SNaN Tr"     00000000 00000000 00000000 00000000
+r 2800.10
+*Want "MXDBR NF +2.0/-inf NT"   FFFF0000 00000000 00000000 00000000
+r 2810.10
+*Want "MXDBR NF +2.0/-inf Tr"   FFFF0000 00000000 00000000 00000000
+r 2820.10
+*Want "MXDB NF +2.0/-inf NT"    FFFF0000 00000000 00000000 00000000
+r 2830.10
+*Want "MXDB NF +2.0/-inf Tr"    FFFF0000 00000000 00000000 00000000
+r 2840.10
+*Want "MXDBR NF +2.0/-2.0 NT"   C0010000 00000000 00000000 00000000
+r 2850.10
+*Want "MXDBR NF +2.0/-2.0 Tr"   C0010000 00000000 00000000 00000000
+r 2860.10
+*Want "MXDB NF +2.0/-2.0 NT"    C0010000 00000000 00000000 00000000
+r 2870.10
+*Want "MXDB NF +2.0/-2.0 Tr"    C0010000 00000000 00000000 00000000
+r 2880.10
+*Want "MXDBR NF +2.0/-0 NT"     80000000 00000000 00000000 00000000
+r 2890.10
+*Want "MXDBR NF +2.0/-0 Tr"     80000000 00000000 00000000 00000000
+r 28A0.10
+*Want "MXDB NF +2.0/-0 NT"      80000000 00000000 00000000 00000000
+r 28B0.10
+*Want "MXDB NF +2.0/-0 Tr"      80000000 00000000 00000000 00000000
+r 28C0.10
+*Want "MXDBR NF +2.0/+0 NT"     00000000 00000000 00000000 00000000
+r 28D0.10
+*Want "MXDBR NF +2.0/+0 Tr"     00000000 00000000 00000000 00000000
+r 28E0.10
+*Want "MXDB NF +2.0/+0 NT"      00000000 00000000 00000000 00000000
+r 28F0.10
+*Want "MXDB NF +2.0/+0 Tr"      00000000 00000000 00000000 00000000
+r 2900.10
+*Want "MXDBR NF +2.0/+2.0 NT"   40010000 00000000 00000000 00000000
+r 2910.10
+*Want "MXDBR NF +2.0/+2.0 Tr"   40010000 00000000 00000000 00000000
+r 2920.10
+*Want "MXDB NF +2.0/+2.0 NT"    40010000 00000000 00000000 00000000
+r 2930.10
+*Want "MXDB NF +2.0/+2.0 Tr"    40010000 00000000 00000000 00000000
+r 2940.10
+*Want "MXDBR NF +2.0/+inf NT"   7FFF0000 00000000 00000000 00000000
+r 2950.10
+*Want "MXDBR NF +2.0/+inf Tr"   7FFF0000 00000000 00000000 00000000
+r 2960.10
+*Want "MXDB NF +2.0/+inf NT"    7FFF0000 00000000 00000000 00000000
+r 2970.10
+*Want "MXDB NF +2.0/+inf Tr"    7FFF0000 00000000 00000000 00000000
+r 2980.10
+*Want "MXDBR NF +2.0/-QNaN NT"  FFFF8B00 00000000 00000000 00000000
+r 2990.10
+*Want "MXDBR NF +2.0/-QNaN Tr"  FFFF8B00 00000000 00000000 00000000
+r 29A0.10
+*Want "MXDB NF +2.0/-QNaN NT"   FFFF8B00 00000000 00000000 00000000
+r 29B0.10
+*Want "MXDB NF +2.0/-QNaN Tr"   FFFF8B00 00000000 00000000 00000000
+r 29C0.10
+*Want "MXDBR NF +2.0/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 29D0.10
+*Want "MXDBR NF +2.0/+SNaN Tr"  40000000 00000000 00000000 00000000
+r 29E0.10
+*Want "MXDB NF +2.0/+SNaN NT"   7FFF8A00 00000000 00000000 00000000
+r 29F0.10
+*Want "MXDB NF +2.0/+SNaN Tr"   40000000 00000000 00000000 00000000
+r 2A00.10
+*Want "MXDBR NF +inf/-inf NT"   FFFF0000 00000000 00000000 00000000
+r 2A10.10
+*Want "MXDBR NF +inf/-inf Tr"   FFFF0000 00000000 00000000 00000000
+r 2A20.10
+*Want "MXDB NF +inf/-inf NT"    FFFF0000 00000000 00000000 00000000
+r 2A30.10
+*Want "MXDB NF +inf/-inf Tr"    FFFF0000 00000000 00000000 00000000
+r 2A40.10
+*Want "MXDBR NF +inf/-2.0 NT"   FFFF0000 00000000 00000000 00000000
+r 2A50.10
+*Want "MXDBR NF +inf/-2.0 Tr"   FFFF0000 00000000 00000000 00000000
+r 2A60.10
+*Want "MXDB NF +inf/-2.0 NT"    FFFF0000 00000000 00000000 00000000
+r 2A70.10
+*Want "MXDB NF +inf/-2.0 Tr"    FFFF0000 00000000 00000000 00000000
+r 2A80.10
+*Want "MXDBR NF +inf/-0 NT"     7FFF8000 00000000 00000000 00000000
+r 2A90.10
+*Want "MXDBR NF +inf/-0 Tr"     7FF00000 00000000 00000000 00000000
+r 2AA0.10
+*Want "MXDB NF +inf/-0 NT"      7FFF8000 00000000 00000000 00000000
+r 2AB0.10
+*Want "MXDB NF +inf/-0 Tr"      7FF00000 00000000 00000000 00000000
+r 2AC0.10
+*Want "MXDBR NF +inf/+0 NT"     7FFF8000 00000000 00000000 00000000
+r 2AD0.10
+*Want "MXDBR NF +inf/+0 Tr"     7FF00000 00000000 00000000 00000000
+r 2AE0.10
+*Want "MXDB NF +inf/+0 NT"      7FFF8000 00000000 00000000 00000000
+r 2AF0.10
+*Want "MXDB NF +inf/+0 Tr"      7FF00000 00000000 00000000 00000000
+r 2B00.10
+*Want "MXDBR NF +inf/+2.0 NT"   7FFF0000 00000000 00000000 00000000
+r 2B10.10
+*Want "MXDBR NF +inf/+2.0 Tr"   7FFF0000 00000000 00000000 00000000
+r 2B20.10
+*Want "MXDB NF +inf/+2.0 NT"    7FFF0000 00000000 00000000 00000000
+r 2B30.10
+*Want "MXDB NF +inf/+2.0 Tr"    7FFF0000 00000000 00000000 00000000
+r 2B40.10
+*Want "MXDBR NF +inf/+inf NT"   7FFF0000 00000000 00000000 00000000
+r 2B50.10
+*Want "MXDBR NF +inf/+inf Tr"   7FFF0000 00000000 00000000 00000000
+r 2B60.10
+*Want "MXDB NF +inf/+inf NT"    7FFF0000 00000000 00000000 00000000
+r 2B70.10
+*Want "MXDB NF +inf/+inf Tr"    7FFF0000 00000000 00000000 00000000
+r 2B80.10
+*Want "MXDBR NF +inf/-QNaN NT"  FFFF8B00 00000000 00000000 00000000
+r 2B90.10
+*Want "MXDBR NF +inf/-QNaN Tr"  FFFF8B00 00000000 00000000 00000000
+r 2BA0.10
+*Want "MXDB NF +inf/-QNaN NT"   FFFF8B00 00000000 00000000 00000000
+r 2BB0.10
+*Want "MXDB NF +inf/-QNaN Tr"   FFFF8B00 00000000 00000000 00000000
+r 2BC0.10
+*Want "MXDBR NF +inf/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 2BD0.10
+*Want "MXDBR NF +inf/+SNaN Tr"  7FF00000 00000000 00000000 00000000
+r 2BE0.10
+*Want "MXDB NF +inf/+SNaN NT"   7FFF8A00 00000000 00000000 00000000
+r 2BF0.10
+*Want "MXDB NF +inf/+SNaN Tr"   7FF00000 00000000 00000000 00000000
+r 2C00.10
+*Want "MXDBR NF -QNaN/-inf NT"  FFFF8B00 00000000 00000000 00000000
+r 2C10.10
+*Want "MXDBR NF -QNaN/-inf Tr"  FFFF8B00 00000000 00000000 00000000
+r 2C20.10
+*Want "MXDB NF -QNaN/-inf NT"   FFFF8B00 00000000 00000000 00000000
+r 2C30.10
+*Want "MXDB NF -QNaN/-inf Tr"   FFFF8B00 00000000 00000000 00000000
+r 2C40.10
+*Want "MXDBR NF -QNaN/-2.0 NT"  FFFF8B00 00000000 00000000 00000000
+r 2C50.10
+*Want "MXDBR NF -QNaN/-2.0 Tr"  FFFF8B00 00000000 00000000 00000000
+r 2C60.10
+*Want "MXDB NF -QNaN/-2.0 NT"   FFFF8B00 00000000 00000000 00000000
+r 2C70.10
+*Want "MXDB NF -QNaN/-2.0 Tr"   FFFF8B00 00000000 00000000 00000000
+r 2C80.10
+*Want "MXDBR NF -QNaN/-0 NT"    FFFF8B00 00000000 00000000 00000000
+r 2C90.10
+*Want "MXDBR NF -QNaN/-0 Tr"    FFFF8B00 00000000 00000000 00000000
+r 2CA0.10
+*Want "MXDB NF -QNaN/-0 NT"     FFFF8B00 00000000 00000000 00000000
+r 2CB0.10
+*Want "MXDB NF -QNaN/-0 Tr"     FFFF8B00 00000000 00000000 00000000
+r 2CC0.10
+*Want "MXDBR NF -QNaN/+0 NT"    FFFF8B00 00000000 00000000 00000000
+r 2CD0.10
+*Want "MXDBR NF -QNaN/+0 Tr"    FFFF8B00 00000000 00000000 00000000
+r 2CE0.10
+*Want "MXDB NF -QNaN/+0 NT"     FFFF8B00 00000000 00000000 00000000
+r 2CF0.10
+*Want "MXDB NF -QNaN/+0 Tr"     FFFF8B00 00000000 00000000 00000000
+r 2D00.10
+*Want "MXDBR NF -QNaN/+2.0 NT"  FFFF8B00 00000000 00000000 00000000
+r 2D10.10
+*Want "MXDBR NF -QNaN/+2.0 Tr"  FFFF8B00 00000000 00000000 00000000
+r 2D20.10
+*Want "MXDB NF -QNaN/+2.0 NT"   FFFF8B00 00000000 00000000 00000000
+r 2D30.10
+*Want "MXDB NF -QNaN/+2.0 Tr"   FFFF8B00 00000000 00000000 00000000
+r 2D40.10
+*Want "MXDBR NF -QNaN/+inf NT"  FFFF8B00 00000000 00000000 00000000
+r 2D50.10
+*Want "MXDBR NF -QNaN/+inf Tr"  FFFF8B00 00000000 00000000 00000000
+r 2D60.10
+*Want "MXDB NF -QNaN/+inf NT"   FFFF8B00 00000000 00000000 00000000
+r 2D70.10
+*Want "MXDB NF -QNaN/+inf Tr"   FFFF8B00 00000000 00000000 00000000
+r 2D80.10
+*Want "MXDBR NF -QNaN/-QNaN NT" FFFF8B00 00000000 00000000 00000000
+r 2D90.10
+*Want "MXDBR NF -QNaN/-QNaN Tr" FFFF8B00 00000000 00000000 00000000
+r 2DA0.10
+*Want "MXDB NF -QNaN/-QNaN NT"  FFFF8B00 00000000 00000000 00000000
+r 2DB0.10
+*Want "MXDB NF -QNaN/-QNaN Tr"  FFFF8B00 00000000 00000000 00000000
+r 2DC0.10
+*Want "MXDBR NF -QNaN/+SNaN NT" 7FFF8A00 00000000 00000000 00000000
+r 2DD0.10
+*Want "MXDBR NF -QNaN/+SNaN Tr" FFF8B000 00000000 00000000 00000000
+r 2DE0.10
+*Want "MXDB NF -QNaN/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 2DF0.10
+*Want "MXDB NF -QNaN/+SNaN Tr"  FFF8B000 00000000 00000000 00000000
+r 2E00.10
+*Want "MXDBR NF +SNaN/-inf NT"  7FFF8A00 00000000 00000000 00000000
+r 2E10.10
+*Want "MXDBR NF +SNaN/-inf Tr"  7FF0A000 00000000 00000000 00000000
+r 2E20.10
+*Want "MXDB NF +SNaN/-inf NT"   7FFF8A00 00000000 00000000 00000000
+r 2E30.10
+*Want "MXDB NF +SNaN/-inf Tr"   7FF0A000 00000000 00000000 00000000
+r 2E40.10
+*Want "MXDBR NF +SNaN/-2.0 NT"  7FFF8A00 00000000 00000000 00000000
+r 2E50.10
+*Want "MXDBR NF +SNaN/-2.0 Tr"  7FF0A000 00000000 00000000 00000000
+r 2E60.10
+*Want "MXDB NF +SNaN/-2.0 NT"   7FFF8A00 00000000 00000000 00000000
+r 2E70.10
+*Want "MXDB NF +SNaN/-2.0 Tr"   7FF0A000 00000000 00000000 00000000
+r 2E80.10
+*Want "MXDBR NF +SNaN/-0 NT"    7FFF8A00 00000000 00000000 00000000
+r 2E90.10
+*Want "MXDBR NF +SNaN/-0 Tr"    7FF0A000 00000000 00000000 00000000
+r 2EA0.10
+*Want "MXDB NF +SNaN/-0 NT"     7FFF8A00 00000000 00000000 00000000
+r 2EB0.10
+*Want "MXDB NF +SNaN/-0 Tr"     7FF0A000 00000000 00000000 00000000
+r 2EC0.10
+*Want "MXDBR NF +SNaN/+0 NT"    7FFF8A00 00000000 00000000 00000000
+r 2ED0.10
+*Want "MXDBR NF +SNaN/+0 Tr"    7FF0A000 00000000 00000000 00000000
+r 2EE0.10
+*Want "MXDB NF +SNaN/+0 NT"     7FFF8A00 00000000 00000000 00000000
+r 2EF0.10
+*Want "MXDB NF +SNaN/+0 Tr"     7FF0A000 00000000 00000000 00000000
+r 2F00.10
+*Want "MXDBR NF +SNaN/+2.0 NT"  7FFF8A00 00000000 00000000 00000000
+r 2F10.10
+*Want "MXDBR NF +SNaN/+2.0 Tr"  7FF0A000 00000000 00000000 00000000
+r 2F20.10
+*Want "MXDB NF +SNaN/+2.0 NT"   7FFF8A00 00000000 00000000 00000000
+r 2F30.10
+*Want "MXDB NF +SNaN/+2.0 Tr"   7FF0A000 00000000 00000000 00000000
+r 2F40.10
+*Want "MXDBR NF +SNaN/+inf NT"  7FFF8A00 00000000 00000000 00000000
+r 2F50.10
+*Want "MXDBR NF +SNaN/+inf Tr"  7FF0A000 00000000 00000000 00000000
+r 2F60.10
+*Want "MXDB NF +SNaN/+inf NT"   7FFF8A00 00000000 00000000 00000000
+r 2F70.10
+*Want "MXDB NF +SNaN/+inf Tr"   7FF0A000 00000000 00000000 00000000
+r 2F80.10
+*Want "MXDBR NF +SNaN/-QNaN NT" 7FFF8A00 00000000 00000000 00000000
+r 2F90.10
+*Want "MXDBR NF +SNaN/-QNaN Tr" 7FF0A000 00000000 00000000 00000000
+r 2FA0.10
+*Want "MXDB NF +SNaN/-QNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 2FB0.10
+*Want "MXDB NF +SNaN/-QNaN Tr"  7FF0A000 00000000 00000000 00000000
+r 2FC0.10
+*Want "MXDBR NF +SNaN/+SNaN NT" 7FFF8A00 00000000 00000000 00000000
+r 2FD0.10
+*Want "MXDBR NF +SNaN/+SNaN Tr" 7FF0A000 00000000 00000000 00000000
+r 2FE0.10
+*Want "MXDB NF +SNaN/+SNaN NT"  7FFF8A00 00000000 00000000 00000000
+r 2FF0.10
+*Want "MXDB NF +SNaN/+SNaN Tr"  7FF0A000 00000000 00000000 00000000
+
+
+# Long BFP multiply to extended results - FPCR contents
+*Compare
+r 3000.10
+*Want "MXDBR/MXDB NF -inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3010.10
+*Want "MXDBR/MXDB NF -inf/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3020.10
+*Want "MXDBR/MXDB NF -inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 3030.10
+*Want "MXDBR/MXDB NF -inf/+0 FPCR"            00800000 F8008000 00800000 F8008000
+r 3040.10
+*Want "MXDBR/MXDB NF -inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3050.10
+*Want "MXDBR/MXDB NF -inf/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3060.10
+*Want "MXDBR/MXDB NF -inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 3070.10
+*Want "MXDBR/MXDB NF -inf/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 3080.10
+*Want "MXDBR/MXDB NF -2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3090.10
+*Want "MXDBR/MXDB NF -2.0/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 30A0.10
+*Want "MXDBR/MXDB NF -2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 30B0.10
+*Want "MXDBR/MXDB NF -2.0/+0 FPCR"            00000000 F8000000 00000000 F8000000
+r 30C0.10
+*Want "MXDBR/MXDB NF -2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 30D0.10
+*Want "MXDBR/MXDB NF -2.0/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 30E0.10
+*Want "MXDBR/MXDB NF -2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 30F0.10
+*Want "MXDBR/MXDB NF -2.0/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 3100.10
+*Want "MXDBR/MXDB NF -0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 3110.10
+*Want "MXDBR/MXDB NF -0/-2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3120.10
+*Want "MXDBR/MXDB NF -0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 3130.10
+*Want "MXDBR/MXDB NF -0/+0 FPCR"              00000000 F8000000 00000000 F8000000
+r 3140.10
+*Want "MXDBR/MXDB NF -0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3150.10
+*Want "MXDBR/MXDB NF -0/+inf FPCR"            00800000 F8008000 00800000 F8008000
+r 3160.10
+*Want "MXDBR/MXDB NF -0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 3170.10
+*Want "MXDBR/MXDB NF -0/+SNaN FPCR"           00800000 F8008000 00800000 F8008000
+r 3180.10
+*Want "MXDBR/MXDB NF +0/-inf FPCR"            00800000 F8008000 00800000 F8008000
+r 3190.10
+*Want "MXDBR/MXDB NF +0/-2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 31A0.10
+*Want "MXDBR/MXDB NF +0/-0 FPCR"              00000000 F8000000 00000000 F8000000
+r 31B0.10
+*Want "MXDBR/MXDB NF +0/+0 FPCR"              00000000 F8000000 00000000 F8000000
+r 31C0.10
+*Want "MXDBR/MXDB NF +0/+2.0 FPCR"            00000000 F8000000 00000000 F8000000
+r 31D0.10
+*Want "MXDBR/MXDB NF +0/+inf FPCR"            00800000 F8008000 00800000 F8008000
+r 31E0.10
+*Want "MXDBR/MXDB NF +0/-QNaN FPCR"           00000000 F8000000 00000000 F8000000
+r 31F0.10
+*Want "MXDBR/MXDB NF +0/+SNaN FPCR"           00800000 F8008000 00800000 F8008000
+r 3200.10
+*Want "MXDBR/MXDB NF +2.0/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3210.10
+*Want "MXDBR/MXDB NF +2.0/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3220.10
+*Want "MXDBR/MXDB NF +2.0/-0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3230.10
+*Want "MXDBR/MXDB NF +2.0/+0 FPCR"            00000000 F8000000 00000000 F8000000
+r 3240.10
+*Want "MXDBR/MXDB NF +2.0/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3250.10
+*Want "MXDBR/MXDB NF +2.0/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3260.10
+*Want "MXDBR/MXDB NF +2.0/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 3270.10
+*Want "MXDBR/MXDB NF +2.0/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 3280.10
+*Want "MXDBR/MXDB NF +inf/-inf FPCR"          00000000 F8000000 00000000 F8000000
+r 3290.10
+*Want "MXDBR/MXDB NF +inf/-2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 32A0.10
+*Want "MXDBR/MXDB NF +inf/-0 FPCR"            00800000 F8008000 00800000 F8008000
+r 32B0.10
+*Want "MXDBR/MXDB NF +inf/+0 FPCR"            00800000 F8008000 00800000 F8008000
+r 32C0.10
+*Want "MXDBR/MXDB NF +inf/+2.0 FPCR"          00000000 F8000000 00000000 F8000000
+r 32D0.10
+*Want "MXDBR/MXDB NF +inf/+inf FPCR"          00000000 F8000000 00000000 F8000000
+r 32E0.10
+*Want "MXDBR/MXDB NF +inf/-QNaN FPCR"         00000000 F8000000 00000000 F8000000
+r 32F0.10
+*Want "MXDBR/MXDB NF +inf/+SNaN FPCR"         00800000 F8008000 00800000 F8008000
+r 3300.10
+*Want "MXDBR/MXDB NF -QNaN/-inf FPCR"         00000000 F8000000 00000000 F8000000
+r 3310.10
+*Want "MXDBR/MXDB NF -QNaN/-2.0 FPCR"         00000000 F8000000 00000000 F8000000
+r 3320.10
+*Want "MXDBR/MXDB NF -QNaN/-0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3330.10
+*Want "MXDBR/MXDB NF -QNaN/+0 FPCR"           00000000 F8000000 00000000 F8000000
+r 3340.10
+*Want "MXDBR/MXDB NF -QNaN/+2.0 FPCR"         00000000 F8000000 00000000 F8000000
+r 3350.10
+*Want "MXDBR/MXDB NF -QNaN/+inf FPCR"         00000000 F8000000 00000000 F8000000
+r 3360.10
+*Want "MXDBR/MXDB NF -QNaN/-QNaN FPCR"        00000000 F8000000 00000000 F8000000
+r 3370.10
+*Want "MXDBR/MXDB NF -QNaN/+SNaN FPCR"        00800000 F8008000 00800000 F8008000
+r 3380.10
+*Want "MXDBR/MXDB NF +SNaN/-inf FPCR"         00800000 F8008000 00800000 F8008000
+r 3390.10
+*Want "MXDBR/MXDB NF +SNaN/-2.0 FPCR"         00800000 F8008000 00800000 F8008000
+r 33A0.10
+*Want "MXDBR/MXDB NF +SNaN/-0 FPCR"           00800000 F8008000 00800000 F8008000
+r 33B0.10
+*Want "MXDBR/MXDB NF +SNaN/+0 FPCR"           00800000 F8008000 00800000 F8008000
+r 33C0.10
+*Want "MXDBR/MXDB NF +SNaN/+2.0 FPCR"         00800000 F8008000 00800000 F8008000
+r 33D0.10
+*Want "MXDBR/MXDB NF +SNaN/+inf FPCR"         00800000 F8008000 00800000 F8008000
+r 33E0.10
+*Want "MXDBR/MXDB NF +SNaN/-QNaN FPCR"        00800000 F8008000 00800000 F8008000
+r 33F0.10
+*Want "MXDBR/MXDB NF +SNaN/+SNaN FPCR"        00800000 F8008000 00800000 F8008000
+
+
+*Done
+
@@ -0,0 +1,5495 @@
+*Testcase bfp-022-multsub.tst:    MSEBR, MSEB, MSDBR, MSDB
+
+#Testcase bfp-022-multsub.tst: Multiplication tests Multiply And Subtract (4)
+#..Test cases evaluate NaN propagation, NaN generation, operations
+#..using non-finite values, trappable and non-trappable IEEE
+#..exceptions, result scaling, and exhaustive rounding testing.
+
+sysclear
+archmode esame
+
+#
+# Following suppresses logging of program checks.  This test program, as part
+# of its normal operation, generates 1,211 program check messages that have no
+# value in the validation process.  (The messages, not the program checks.)
+#
+ostailor quiet
+
+loadcore "$(testpath)/bfp-022-multsub.core"
+
+runtest 1.0
+
+ostailor null   # restore messages for subsequent tests
+
+
+
+# Short BFP Multiply And Subtract finite results
+*Compare
+r 1000.10
+*Want "MSEBR/MSEB NF -inf/-inf/-inf"    7F800000 7F800000 7F800000 7F800000
+r 1010.10
+*Want "MSEBR/MSEB NF -inf/-inf/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 1020.10
+*Want "MSEBR/MSEB NF -inf/-inf/-0"      7F800000 7F800000 7F800000 7F800000
+r 1030.10
+*Want "MSEBR/MSEB NF -inf/-inf/+0"      7F800000 7F800000 7F800000 7F800000
+r 1040.10
+*Want "MSEBR/MSEB NF -inf/-inf/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 1050.10
+*Want "MSEBR/MSEB NF -inf/-inf/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 1060.10
+*Want "MSEBR/MSEB NF -inf/-inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1070.10
+*Want "MSEBR/MSEB NF -inf/-inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1080.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 1090.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 10A0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-0"      7F800000 7F800000 7F800000 7F800000
+r 10B0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+0"      7F800000 7F800000 7F800000 7F800000
+r 10C0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 10D0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 10E0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 10F0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1100.10
+*Want "MSEBR/MSEB NF -inf/-0/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1110.10
+*Want "MSEBR/MSEB NF -inf/-0/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 1120.10
+*Want "MSEBR/MSEB NF -inf/-0/-0"        7FC00000 80000000 7FC00000 80000000
+r 1130.10
+*Want "MSEBR/MSEB NF -inf/-0/+0"        7FC00000 00000000 7FC00000 00000000
+r 1140.10
+*Want "MSEBR/MSEB NF -inf/-0/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 1150.10
+*Want "MSEBR/MSEB NF -inf/-0/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 1160.10
+*Want "MSEBR/MSEB NF -inf/-0/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 1170.10
+*Want "MSEBR/MSEB NF -inf/-0/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1180.10
+*Want "MSEBR/MSEB NF -inf/+0/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1190.10
+*Want "MSEBR/MSEB NF -inf/+0/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 11A0.10
+*Want "MSEBR/MSEB NF -inf/+0/-0"        7FC00000 80000000 7FC00000 80000000
+r 11B0.10
+*Want "MSEBR/MSEB NF -inf/+0/+0"        7FC00000 00000000 7FC00000 00000000
+r 11C0.10
+*Want "MSEBR/MSEB NF -inf/+0/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 11D0.10
+*Want "MSEBR/MSEB NF -inf/+0/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 11E0.10
+*Want "MSEBR/MSEB NF -inf/+0/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 11F0.10
+*Want "MSEBR/MSEB NF -inf/+0/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1200.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 1210.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 1220.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-0"      FF800000 FF800000 FF800000 FF800000
+r 1230.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+0"      FF800000 FF800000 FF800000 FF800000
+r 1240.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 1250.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 1260.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1270.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1280.10
+*Want "MSEBR/MSEB NF -inf/+inf/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 1290.10
+*Want "MSEBR/MSEB NF -inf/+inf/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 12A0.10
+*Want "MSEBR/MSEB NF -inf/+inf/-0"      FF800000 FF800000 FF800000 FF800000
+r 12B0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+0"      FF800000 FF800000 FF800000 FF800000
+r 12C0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 12D0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+inf"    FF800000 FF800000 FF800000 FF800000
+r 12E0.10
+*Want "MSEBR/MSEB NF -inf/+inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 12F0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1300.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1310.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1320.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1330.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1340.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1350.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1360.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1370.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1380.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 1390.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 13A0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 13B0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 13C0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 13D0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 13E0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 13F0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1400.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-inf"    7F800000 7F800000 7F800000 7F800000
+r 1410.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 1420.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-0"      7F800000 7F800000 7F800000 7F800000
+r 1430.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+0"      7F800000 7F800000 7F800000 7F800000
+r 1440.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 1450.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 1460.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1470.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1480.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 1490.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-2.0"    40C00000 40C00000 40C00000 40C00000
+r 14A0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-0"      40800000 40800000 40800000 40800000
+r 14B0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+0"      40800000 40800000 40800000 40800000
+r 14C0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+2.0"    40000000 40000000 40000000 40000000
+r 14D0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 14E0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 14F0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1500.10
+*Want "MSEBR/MSEB NF -2.0/-0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1510.10
+*Want "MSEBR/MSEB NF -2.0/-0/-2.0"      40000000 40000000 40000000 40000000
+r 1520.10
+*Want "MSEBR/MSEB NF -2.0/-0/-0"        00000000 00000000 00000000 00000000
+r 1530.10
+*Want "MSEBR/MSEB NF -2.0/-0/+0"        00000000 00000000 00000000 00000000
+r 1540.10
+*Want "MSEBR/MSEB NF -2.0/-0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 1550.10
+*Want "MSEBR/MSEB NF -2.0/-0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 1560.10
+*Want "MSEBR/MSEB NF -2.0/-0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1570.10
+*Want "MSEBR/MSEB NF -2.0/-0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1580.10
+*Want "MSEBR/MSEB NF -2.0/+0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1590.10
+*Want "MSEBR/MSEB NF -2.0/+0/-2.0"      40000000 40000000 40000000 40000000
+r 15A0.10
+*Want "MSEBR/MSEB NF -2.0/+0/-0"        00000000 00000000 00000000 00000000
+r 15B0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+0"        80000000 80000000 80000000 80000000
+r 15C0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 15D0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 15E0.10
+*Want "MSEBR/MSEB NF -2.0/+0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 15F0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1600.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 1610.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-2.0"    C0000000 C0000000 C0000000 C0000000
+r 1620.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-0"      C0800000 C0800000 C0800000 C0800000
+r 1630.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+0"      C0800000 C0800000 C0800000 C0800000
+r 1640.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+2.0"    C0C00000 C0C00000 C0C00000 C0C00000
+r 1650.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 1660.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1670.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1680.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 1690.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 16A0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-0"      FF800000 FF800000 FF800000 FF800000
+r 16B0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+0"      FF800000 FF800000 FF800000 FF800000
+r 16C0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 16D0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+inf"    FF800000 FF800000 FF800000 FF800000
+r 16E0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 16F0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1700.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1710.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1720.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1730.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1740.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1750.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1760.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1770.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1780.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 1790.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 17A0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 17B0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 17C0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 17D0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 17E0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 17F0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1800.10
+*Want "MSEBR/MSEB NF -0/-inf/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1810.10
+*Want "MSEBR/MSEB NF -0/-inf/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 1820.10
+*Want "MSEBR/MSEB NF -0/-inf/-0"        7FC00000 80000000 7FC00000 80000000
+r 1830.10
+*Want "MSEBR/MSEB NF -0/-inf/+0"        7FC00000 00000000 7FC00000 00000000
+r 1840.10
+*Want "MSEBR/MSEB NF -0/-inf/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 1850.10
+*Want "MSEBR/MSEB NF -0/-inf/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 1860.10
+*Want "MSEBR/MSEB NF -0/-inf/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 1870.10
+*Want "MSEBR/MSEB NF -0/-inf/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1880.10
+*Want "MSEBR/MSEB NF -0/-2.0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1890.10
+*Want "MSEBR/MSEB NF -0/-2.0/-2.0"      40000000 40000000 40000000 40000000
+r 18A0.10
+*Want "MSEBR/MSEB NF -0/-2.0/-0"        00000000 00000000 00000000 00000000
+r 18B0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+0"        00000000 00000000 00000000 00000000
+r 18C0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 18D0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 18E0.10
+*Want "MSEBR/MSEB NF -0/-2.0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 18F0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1900.10
+*Want "MSEBR/MSEB NF -0/-0/-inf"        7F800000 7F800000 7F800000 7F800000
+r 1910.10
+*Want "MSEBR/MSEB NF -0/-0/-2.0"        40000000 40000000 40000000 40000000
+r 1920.10
+*Want "MSEBR/MSEB NF -0/-0/-0"          00000000 00000000 00000000 00000000
+r 1930.10
+*Want "MSEBR/MSEB NF -0/-0/+0"          00000000 00000000 00000000 00000000
+r 1940.10
+*Want "MSEBR/MSEB NF -0/-0/+2.0"        C0000000 C0000000 C0000000 C0000000
+r 1950.10
+*Want "MSEBR/MSEB NF -0/-0/+inf"        FF800000 FF800000 FF800000 FF800000
+r 1960.10
+*Want "MSEBR/MSEB NF -0/-0/-QNaN"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1970.10
+*Want "MSEBR/MSEB NF -0/-0/+SNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1980.10
+*Want "MSEBR/MSEB NF -0/+0/-inf"        7F800000 7F800000 7F800000 7F800000
+r 1990.10
+*Want "MSEBR/MSEB NF -0/+0/-2.0"        40000000 40000000 40000000 40000000
+r 19A0.10
+*Want "MSEBR/MSEB NF -0/+0/-0"          00000000 00000000 00000000 00000000
+r 19B0.10
+*Want "MSEBR/MSEB NF -0/+0/+0"          80000000 80000000 80000000 80000000
+r 19C0.10
+*Want "MSEBR/MSEB NF -0/+0/+2.0"        C0000000 C0000000 C0000000 C0000000
+r 19D0.10
+*Want "MSEBR/MSEB NF -0/+0/+inf"        FF800000 FF800000 FF800000 FF800000
+r 19E0.10
+*Want "MSEBR/MSEB NF -0/+0/-QNaN"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 19F0.10
+*Want "MSEBR/MSEB NF -0/+0/+SNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1A00.10
+*Want "MSEBR/MSEB NF -0/+2.0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1A10.10
+*Want "MSEBR/MSEB NF -0/+2.0/-2.0"      40000000 40000000 40000000 40000000
+r 1A20.10
+*Want "MSEBR/MSEB NF -0/+2.0/-0"        00000000 00000000 00000000 00000000
+r 1A30.10
+*Want "MSEBR/MSEB NF -0/+2.0/+0"        80000000 80000000 80000000 80000000
+r 1A40.10
+*Want "MSEBR/MSEB NF -0/+2.0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 1A50.10
+*Want "MSEBR/MSEB NF -0/+2.0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 1A60.10
+*Want "MSEBR/MSEB NF -0/+2.0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1A70.10
+*Want "MSEBR/MSEB NF -0/+2.0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1A80.10
+*Want "MSEBR/MSEB NF -0/+inf/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1A90.10
+*Want "MSEBR/MSEB NF -0/+inf/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 1AA0.10
+*Want "MSEBR/MSEB NF -0/+inf/-0"        7FC00000 80000000 7FC00000 80000000
+r 1AB0.10
+*Want "MSEBR/MSEB NF -0/+inf/+0"        7FC00000 00000000 7FC00000 00000000
+r 1AC0.10
+*Want "MSEBR/MSEB NF -0/+inf/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 1AD0.10
+*Want "MSEBR/MSEB NF -0/+inf/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 1AE0.10
+*Want "MSEBR/MSEB NF -0/+inf/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 1AF0.10
+*Want "MSEBR/MSEB NF -0/+inf/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1B00.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B10.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B20.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B30.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B40.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B50.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B60.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1B70.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1B80.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-inf"     7FCA0000 FF800000 7FCA0000 FF800000
+r 1B90.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-2.0"     7FCA0000 C0000000 7FCA0000 C0000000
+r 1BA0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-0"       7FCA0000 80000000 7FCA0000 80000000
+r 1BB0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+0"       7FCA0000 00000000 7FCA0000 00000000
+r 1BC0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+2.0"     7FCA0000 40000000 7FCA0000 40000000
+r 1BD0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+inf"     7FCA0000 7F800000 7FCA0000 7F800000
+r 1BE0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-QNaN"    7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 1BF0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1C00.10
+*Want "MSEBR/MSEB NF +0/-inf/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1C10.10
+*Want "MSEBR/MSEB NF +0/-inf/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 1C20.10
+*Want "MSEBR/MSEB NF +0/-inf/-0"        7FC00000 80000000 7FC00000 80000000
+r 1C30.10
+*Want "MSEBR/MSEB NF +0/-inf/+0"        7FC00000 00000000 7FC00000 00000000
+r 1C40.10
+*Want "MSEBR/MSEB NF +0/-inf/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 1C50.10
+*Want "MSEBR/MSEB NF +0/-inf/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 1C60.10
+*Want "MSEBR/MSEB NF +0/-inf/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 1C70.10
+*Want "MSEBR/MSEB NF +0/-inf/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1C80.10
+*Want "MSEBR/MSEB NF +0/-2.0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1C90.10
+*Want "MSEBR/MSEB NF +0/-2.0/-2.0"      40000000 40000000 40000000 40000000
+r 1CA0.10
+*Want "MSEBR/MSEB NF +0/-2.0/-0"        00000000 00000000 00000000 00000000
+r 1CB0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+0"        80000000 80000000 80000000 80000000
+r 1CC0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 1CD0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 1CE0.10
+*Want "MSEBR/MSEB NF +0/-2.0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1CF0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1D00.10
+*Want "MSEBR/MSEB NF +0/-0/-inf"        7F800000 7F800000 7F800000 7F800000
+r 1D10.10
+*Want "MSEBR/MSEB NF +0/-0/-2.0"        40000000 40000000 40000000 40000000
+r 1D20.10
+*Want "MSEBR/MSEB NF +0/-0/-0"          00000000 00000000 00000000 00000000
+r 1D30.10
+*Want "MSEBR/MSEB NF +0/-0/+0"          80000000 80000000 80000000 80000000
+r 1D40.10
+*Want "MSEBR/MSEB NF +0/-0/+2.0"        C0000000 C0000000 C0000000 C0000000
+r 1D50.10
+*Want "MSEBR/MSEB NF +0/-0/+inf"        FF800000 FF800000 FF800000 FF800000
+r 1D60.10
+*Want "MSEBR/MSEB NF +0/-0/-QNaN"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1D70.10
+*Want "MSEBR/MSEB NF +0/-0/+SNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1D80.10
+*Want "MSEBR/MSEB NF +0/+0/-inf"        7F800000 7F800000 7F800000 7F800000
+r 1D90.10
+*Want "MSEBR/MSEB NF +0/+0/-2.0"        40000000 40000000 40000000 40000000
+r 1DA0.10
+*Want "MSEBR/MSEB NF +0/+0/-0"          00000000 00000000 00000000 00000000
+r 1DB0.10
+*Want "MSEBR/MSEB NF +0/+0/+0"          00000000 00000000 00000000 00000000
+r 1DC0.10
+*Want "MSEBR/MSEB NF +0/+0/+2.0"        C0000000 C0000000 C0000000 C0000000
+r 1DD0.10
+*Want "MSEBR/MSEB NF +0/+0/+inf"        FF800000 FF800000 FF800000 FF800000
+r 1DE0.10
+*Want "MSEBR/MSEB NF +0/+0/-QNaN"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1DF0.10
+*Want "MSEBR/MSEB NF +0/+0/+SNaN"       7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1E00.10
+*Want "MSEBR/MSEB NF +0/+2.0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 1E10.10
+*Want "MSEBR/MSEB NF +0/+2.0/-2.0"      40000000 40000000 40000000 40000000
+r 1E20.10
+*Want "MSEBR/MSEB NF +0/+2.0/-0"        00000000 00000000 00000000 00000000
+r 1E30.10
+*Want "MSEBR/MSEB NF +0/+2.0/+0"        00000000 00000000 00000000 00000000
+r 1E40.10
+*Want "MSEBR/MSEB NF +0/+2.0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 1E50.10
+*Want "MSEBR/MSEB NF +0/+2.0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 1E60.10
+*Want "MSEBR/MSEB NF +0/+2.0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1E70.10
+*Want "MSEBR/MSEB NF +0/+2.0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1E80.10
+*Want "MSEBR/MSEB NF +0/+inf/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 1E90.10
+*Want "MSEBR/MSEB NF +0/+inf/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 1EA0.10
+*Want "MSEBR/MSEB NF +0/+inf/-0"        7FC00000 80000000 7FC00000 80000000
+r 1EB0.10
+*Want "MSEBR/MSEB NF +0/+inf/+0"        7FC00000 00000000 7FC00000 00000000
+r 1EC0.10
+*Want "MSEBR/MSEB NF +0/+inf/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 1ED0.10
+*Want "MSEBR/MSEB NF +0/+inf/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 1EE0.10
+*Want "MSEBR/MSEB NF +0/+inf/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 1EF0.10
+*Want "MSEBR/MSEB NF +0/+inf/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 1F00.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F10.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F20.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F30.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F40.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F50.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F60.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 1F70.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 1F80.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-inf"     7FCA0000 FF800000 7FCA0000 FF800000
+r 1F90.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-2.0"     7FCA0000 C0000000 7FCA0000 C0000000
+r 1FA0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-0"       7FCA0000 80000000 7FCA0000 80000000
+r 1FB0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+0"       7FCA0000 00000000 7FCA0000 00000000
+r 1FC0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+2.0"     7FCA0000 40000000 7FCA0000 40000000
+r 1FD0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+inf"     7FCA0000 7F800000 7FCA0000 7F800000
+r 1FE0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-QNaN"    7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 1FF0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2000.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 2010.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 2020.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-0"      FF800000 FF800000 FF800000 FF800000
+r 2030.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+0"      FF800000 FF800000 FF800000 FF800000
+r 2040.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 2050.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+inf"    FF800000 FF800000 FF800000 FF800000
+r 2060.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2070.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2080.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 2090.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-2.0"    C0000000 C0000000 C0000000 C0000000
+r 20A0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-0"      C0800000 C0800000 C0800000 C0800000
+r 20B0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+0"      C0800000 C0800000 C0800000 C0800000
+r 20C0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+2.0"    C0C00000 C0C00000 C0C00000 C0C00000
+r 20D0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 20E0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 20F0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2100.10
+*Want "MSEBR/MSEB NF +2.0/-0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 2110.10
+*Want "MSEBR/MSEB NF +2.0/-0/-2.0"      40000000 40000000 40000000 40000000
+r 2120.10
+*Want "MSEBR/MSEB NF +2.0/-0/-0"        00000000 00000000 00000000 00000000
+r 2130.10
+*Want "MSEBR/MSEB NF +2.0/-0/+0"        80000000 80000000 80000000 80000000
+r 2140.10
+*Want "MSEBR/MSEB NF +2.0/-0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 2150.10
+*Want "MSEBR/MSEB NF +2.0/-0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 2160.10
+*Want "MSEBR/MSEB NF +2.0/-0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2170.10
+*Want "MSEBR/MSEB NF +2.0/-0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2180.10
+*Want "MSEBR/MSEB NF +2.0/+0/-inf"      7F800000 7F800000 7F800000 7F800000
+r 2190.10
+*Want "MSEBR/MSEB NF +2.0/+0/-2.0"      40000000 40000000 40000000 40000000
+r 21A0.10
+*Want "MSEBR/MSEB NF +2.0/+0/-0"        00000000 00000000 00000000 00000000
+r 21B0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+0"        00000000 00000000 00000000 00000000
+r 21C0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+2.0"      C0000000 C0000000 C0000000 C0000000
+r 21D0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+inf"      FF800000 FF800000 FF800000 FF800000
+r 21E0.10
+*Want "MSEBR/MSEB NF +2.0/+0/-QNaN"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 21F0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+SNaN"     7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2200.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 2210.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-2.0"    40C00000 40C00000 40C00000 40C00000
+r 2220.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-0"      40800000 40800000 40800000 40800000
+r 2230.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+0"      40800000 40800000 40800000 40800000
+r 2240.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+2.0"    40000000 40000000 40000000 40000000
+r 2250.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 2260.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2270.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2280.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-inf"    7F800000 7F800000 7F800000 7F800000
+r 2290.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 22A0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-0"      7F800000 7F800000 7F800000 7F800000
+r 22B0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+0"      7F800000 7F800000 7F800000 7F800000
+r 22C0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 22D0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 22E0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 22F0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2300.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2310.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2320.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2330.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2340.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2350.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2360.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2370.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2380.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2390.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 23A0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 23B0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 23C0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 23D0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 23E0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 23F0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2400.10
+*Want "MSEBR/MSEB NF +inf/-inf/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 2410.10
+*Want "MSEBR/MSEB NF +inf/-inf/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 2420.10
+*Want "MSEBR/MSEB NF +inf/-inf/-0"      FF800000 FF800000 FF800000 FF800000
+r 2430.10
+*Want "MSEBR/MSEB NF +inf/-inf/+0"      FF800000 FF800000 FF800000 FF800000
+r 2440.10
+*Want "MSEBR/MSEB NF +inf/-inf/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 2450.10
+*Want "MSEBR/MSEB NF +inf/-inf/+inf"    FF800000 FF800000 FF800000 FF800000
+r 2460.10
+*Want "MSEBR/MSEB NF +inf/-inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2470.10
+*Want "MSEBR/MSEB NF +inf/-inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2480.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-inf"    7FC00000 FF800000 7FC00000 FF800000
+r 2490.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-2.0"    FF800000 FF800000 FF800000 FF800000
+r 24A0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-0"      FF800000 FF800000 FF800000 FF800000
+r 24B0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+0"      FF800000 FF800000 FF800000 FF800000
+r 24C0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+2.0"    FF800000 FF800000 FF800000 FF800000
+r 24D0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+inf"    FF800000 FF800000 FF800000 FF800000
+r 24E0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 24F0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2500.10
+*Want "MSEBR/MSEB NF +inf/-0/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 2510.10
+*Want "MSEBR/MSEB NF +inf/-0/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 2520.10
+*Want "MSEBR/MSEB NF +inf/-0/-0"        7FC00000 80000000 7FC00000 80000000
+r 2530.10
+*Want "MSEBR/MSEB NF +inf/-0/+0"        7FC00000 00000000 7FC00000 00000000
+r 2540.10
+*Want "MSEBR/MSEB NF +inf/-0/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 2550.10
+*Want "MSEBR/MSEB NF +inf/-0/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 2560.10
+*Want "MSEBR/MSEB NF +inf/-0/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 2570.10
+*Want "MSEBR/MSEB NF +inf/-0/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 2580.10
+*Want "MSEBR/MSEB NF +inf/+0/-inf"      7FC00000 FF800000 7FC00000 FF800000
+r 2590.10
+*Want "MSEBR/MSEB NF +inf/+0/-2.0"      7FC00000 C0000000 7FC00000 C0000000
+r 25A0.10
+*Want "MSEBR/MSEB NF +inf/+0/-0"        7FC00000 80000000 7FC00000 80000000
+r 25B0.10
+*Want "MSEBR/MSEB NF +inf/+0/+0"        7FC00000 00000000 7FC00000 00000000
+r 25C0.10
+*Want "MSEBR/MSEB NF +inf/+0/+2.0"      7FC00000 40000000 7FC00000 40000000
+r 25D0.10
+*Want "MSEBR/MSEB NF +inf/+0/+inf"      7FC00000 7F800000 7FC00000 7F800000
+r 25E0.10
+*Want "MSEBR/MSEB NF +inf/+0/-QNaN"     7FC00000 FFCB0000 7FC00000 FFCB0000
+r 25F0.10
+*Want "MSEBR/MSEB NF +inf/+0/+SNaN"     7FC00000 7F8A0000 7FC00000 7F8A0000
+r 2600.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-inf"    7F800000 7F800000 7F800000 7F800000
+r 2610.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 2620.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-0"      7F800000 7F800000 7F800000 7F800000
+r 2630.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+0"      7F800000 7F800000 7F800000 7F800000
+r 2640.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 2650.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 2660.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2670.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2680.10
+*Want "MSEBR/MSEB NF +inf/+inf/-inf"    7F800000 7F800000 7F800000 7F800000
+r 2690.10
+*Want "MSEBR/MSEB NF +inf/+inf/-2.0"    7F800000 7F800000 7F800000 7F800000
+r 26A0.10
+*Want "MSEBR/MSEB NF +inf/+inf/-0"      7F800000 7F800000 7F800000 7F800000
+r 26B0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+0"      7F800000 7F800000 7F800000 7F800000
+r 26C0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+2.0"    7F800000 7F800000 7F800000 7F800000
+r 26D0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+inf"    7FC00000 7F800000 7FC00000 7F800000
+r 26E0.10
+*Want "MSEBR/MSEB NF +inf/+inf/-QNaN"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 26F0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+SNaN"   7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2700.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2710.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2720.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2730.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2740.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2750.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2760.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2770.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2780.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2790.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 27A0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 27B0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 27C0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 27D0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 27E0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 27F0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2800.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2810.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2820.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2830.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2840.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2850.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2860.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2870.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2880.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2890.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28A0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28B0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28C0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28D0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28E0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 28F0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2900.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2910.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2920.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2930.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2940.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2950.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2960.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2970.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2980.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2990.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29A0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29B0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+0"       FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29C0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+2.0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29D0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+inf"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29E0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-QNaN"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 29F0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2A00.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A10.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A20.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A30.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A40.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A50.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A60.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A70.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2A80.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2A90.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AA0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AB0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+0"     FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AC0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+2.0"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AD0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+inf"   FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AE0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-QNaN"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2AF0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2B00.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-inf"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B10.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-2.0"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B20.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-0"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B30.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+0"    FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B40.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+2.0"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B50.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+inf"  FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B60.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-QNaN" FFCB0000 FFCB0000 FFCB0000 FFCB0000
+r 2B70.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+SNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2B80.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-inf"  7FCA0000 FF800000 7FCA0000 FF800000
+r 2B90.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-2.0"  7FCA0000 C0000000 7FCA0000 C0000000
+r 2BA0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-0"    7FCA0000 80000000 7FCA0000 80000000
+r 2BB0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+0"    7FCA0000 00000000 7FCA0000 00000000
+r 2BC0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+2.0"  7FCA0000 40000000 7FCA0000 40000000
+r 2BD0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+inf"  7FCA0000 7F800000 7FCA0000 7F800000
+r 2BE0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-QNaN" 7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2BF0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+SNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2C00.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2C10.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 2C20.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 2C30.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 2C40.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 2C50.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 2C60.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2C70.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2C80.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2C90.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 2CA0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 2CB0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 2CC0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 2CD0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 2CE0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2CF0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2D00.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-inf"     7FCA0000 FF800000 7FCA0000 FF800000
+r 2D10.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-2.0"     7FCA0000 C0000000 7FCA0000 C0000000
+r 2D20.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-0"       7FCA0000 80000000 7FCA0000 80000000
+r 2D30.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+0"       7FCA0000 00000000 7FCA0000 00000000
+r 2D40.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+2.0"     7FCA0000 40000000 7FCA0000 40000000
+r 2D50.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+inf"     7FCA0000 7F800000 7FCA0000 7F800000
+r 2D60.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-QNaN"    7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2D70.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2D80.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-inf"     7FCA0000 FF800000 7FCA0000 FF800000
+r 2D90.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-2.0"     7FCA0000 C0000000 7FCA0000 C0000000
+r 2DA0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-0"       7FCA0000 80000000 7FCA0000 80000000
+r 2DB0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+0"       7FCA0000 00000000 7FCA0000 00000000
+r 2DC0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+2.0"     7FCA0000 40000000 7FCA0000 40000000
+r 2DD0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+inf"     7FCA0000 7F800000 7FCA0000 7F800000
+r 2DE0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-QNaN"    7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2DF0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+SNaN"    7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2E00.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2E10.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 2E20.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 2E30.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 2E40.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 2E50.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 2E60.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2E70.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2E80.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-inf"   7FCA0000 FF800000 7FCA0000 FF800000
+r 2E90.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-2.0"   7FCA0000 C0000000 7FCA0000 C0000000
+r 2EA0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-0"     7FCA0000 80000000 7FCA0000 80000000
+r 2EB0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+0"     7FCA0000 00000000 7FCA0000 00000000
+r 2EC0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+2.0"   7FCA0000 40000000 7FCA0000 40000000
+r 2ED0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+inf"   7FCA0000 7F800000 7FCA0000 7F800000
+r 2EE0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-QNaN"  7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2EF0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+SNaN"  7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2F00.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-inf"  7FCA0000 FF800000 7FCA0000 FF800000
+r 2F10.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-2.0"  7FCA0000 C0000000 7FCA0000 C0000000
+r 2F20.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-0"    7FCA0000 80000000 7FCA0000 80000000
+r 2F30.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+0"    7FCA0000 00000000 7FCA0000 00000000
+r 2F40.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+2.0"  7FCA0000 40000000 7FCA0000 40000000
+r 2F50.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+inf"  7FCA0000 7F800000 7FCA0000 7F800000
+r 2F60.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-QNaN" 7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2F70.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+SNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+r 2F80.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-inf"  7FCA0000 FF800000 7FCA0000 FF800000
+r 2F90.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-2.0"  7FCA0000 C0000000 7FCA0000 C0000000
+r 2FA0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-0"    7FCA0000 80000000 7FCA0000 80000000
+r 2FB0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+0"    7FCA0000 00000000 7FCA0000 00000000
+r 2FC0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+2.0"  7FCA0000 40000000 7FCA0000 40000000
+r 2FD0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+inf"  7FCA0000 7F800000 7FCA0000 7F800000
+r 2FE0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-QNaN" 7FCA0000 FFCB0000 7FCA0000 FFCB0000
+r 2FF0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+SNaN" 7FCA0000 7F8A0000 7FCA0000 7F8A0000
+
+
+# Short BFP Multiply And Subtract finite results - FPCR contents
+*Compare
+r 3000.10
+*Want "MSEBR/MSEB NF -inf/-inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3010.10
+*Want "MSEBR/MSEB NF -inf/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3020.10
+*Want "MSEBR/MSEB NF -inf/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3030.10
+*Want "MSEBR/MSEB NF -inf/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3040.10
+*Want "MSEBR/MSEB NF -inf/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3050.10
+*Want "MSEBR/MSEB NF -inf/-inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 3060.10
+*Want "MSEBR/MSEB NF -inf/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 3070.10
+*Want "MSEBR/MSEB NF -inf/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3080.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3090.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 30A0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 30B0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 30C0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 30D0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 30E0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 30F0.10
+*Want "MSEBR/MSEB NF -inf/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3100.10
+*Want "MSEBR/MSEB NF -inf/-0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3110.10
+*Want "MSEBR/MSEB NF -inf/-0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3120.10
+*Want "MSEBR/MSEB NF -inf/-0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3130.10
+*Want "MSEBR/MSEB NF -inf/-0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3140.10
+*Want "MSEBR/MSEB NF -inf/-0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3150.10
+*Want "MSEBR/MSEB NF -inf/-0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3160.10
+*Want "MSEBR/MSEB NF -inf/-0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3170.10
+*Want "MSEBR/MSEB NF -inf/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3180.10
+*Want "MSEBR/MSEB NF -inf/+0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3190.10
+*Want "MSEBR/MSEB NF -inf/+0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 31A0.10
+*Want "MSEBR/MSEB NF -inf/+0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 31B0.10
+*Want "MSEBR/MSEB NF -inf/+0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 31C0.10
+*Want "MSEBR/MSEB NF -inf/+0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 31D0.10
+*Want "MSEBR/MSEB NF -inf/+0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 31E0.10
+*Want "MSEBR/MSEB NF -inf/+0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 31F0.10
+*Want "MSEBR/MSEB NF -inf/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3200.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 3210.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3220.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3230.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3240.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3250.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3260.10
+*Want "MSEBR/MSEB NF -inf/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 3270.10
+*Want "MSEBR/MSEB NF -inf/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3280.10
+*Want "MSEBR/MSEB NF -inf/+inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 3290.10
+*Want "MSEBR/MSEB NF -inf/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 32A0.10
+*Want "MSEBR/MSEB NF -inf/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 32B0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 32C0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 32D0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 32E0.10
+*Want "MSEBR/MSEB NF -inf/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 32F0.10
+*Want "MSEBR/MSEB NF -inf/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3300.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 3310.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 3320.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3330.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3340.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 3350.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 3360.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 3370.10
+*Want "MSEBR/MSEB NF -inf/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3380.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3390.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 33A0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 33B0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 33C0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 33D0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 33E0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 33F0.10
+*Want "MSEBR/MSEB NF -inf/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3400.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3410.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3420.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3430.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3440.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3450.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 3460.10
+*Want "MSEBR/MSEB NF -2.0/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 3470.10
+*Want "MSEBR/MSEB NF -2.0/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3480.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3490.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 34A0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 34B0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 34C0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 34D0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 34E0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 34F0.10
+*Want "MSEBR/MSEB NF -2.0/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3500.10
+*Want "MSEBR/MSEB NF -2.0/-0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3510.10
+*Want "MSEBR/MSEB NF -2.0/-0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3520.10
+*Want "MSEBR/MSEB NF -2.0/-0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3530.10
+*Want "MSEBR/MSEB NF -2.0/-0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3540.10
+*Want "MSEBR/MSEB NF -2.0/-0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3550.10
+*Want "MSEBR/MSEB NF -2.0/-0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3560.10
+*Want "MSEBR/MSEB NF -2.0/-0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 3570.10
+*Want "MSEBR/MSEB NF -2.0/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3580.10
+*Want "MSEBR/MSEB NF -2.0/+0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3590.10
+*Want "MSEBR/MSEB NF -2.0/+0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 35A0.10
+*Want "MSEBR/MSEB NF -2.0/+0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 35B0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 35C0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 35D0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 35E0.10
+*Want "MSEBR/MSEB NF -2.0/+0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 35F0.10
+*Want "MSEBR/MSEB NF -2.0/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3600.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3610.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3620.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3630.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3640.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 3650.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 3660.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 3670.10
+*Want "MSEBR/MSEB NF -2.0/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3680.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 3690.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 36A0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 36B0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 36C0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 36D0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 36E0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 36F0.10
+*Want "MSEBR/MSEB NF -2.0/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 3700.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 3710.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 3720.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3730.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3740.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 3750.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 3760.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 3770.10
+*Want "MSEBR/MSEB NF -2.0/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3780.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 3790.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 37A0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 37B0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 37C0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 37D0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 37E0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 37F0.10
+*Want "MSEBR/MSEB NF -2.0/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 3800.10
+*Want "MSEBR/MSEB NF -0/-inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3810.10
+*Want "MSEBR/MSEB NF -0/-inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3820.10
+*Want "MSEBR/MSEB NF -0/-inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3830.10
+*Want "MSEBR/MSEB NF -0/-inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3840.10
+*Want "MSEBR/MSEB NF -0/-inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3850.10
+*Want "MSEBR/MSEB NF -0/-inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3860.10
+*Want "MSEBR/MSEB NF -0/-inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3870.10
+*Want "MSEBR/MSEB NF -0/-inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3880.10
+*Want "MSEBR/MSEB NF -0/-2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3890.10
+*Want "MSEBR/MSEB NF -0/-2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 38A0.10
+*Want "MSEBR/MSEB NF -0/-2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 38B0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 38C0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 38D0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 38E0.10
+*Want "MSEBR/MSEB NF -0/-2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 38F0.10
+*Want "MSEBR/MSEB NF -0/-2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3900.10
+*Want "MSEBR/MSEB NF -0/-0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3910.10
+*Want "MSEBR/MSEB NF -0/-0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3920.10
+*Want "MSEBR/MSEB NF -0/-0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3930.10
+*Want "MSEBR/MSEB NF -0/-0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3940.10
+*Want "MSEBR/MSEB NF -0/-0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3950.10
+*Want "MSEBR/MSEB NF -0/-0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3960.10
+*Want "MSEBR/MSEB NF -0/-0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r 3970.10
+*Want "MSEBR/MSEB NF -0/-0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r 3980.10
+*Want "MSEBR/MSEB NF -0/+0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3990.10
+*Want "MSEBR/MSEB NF -0/+0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 39A0.10
+*Want "MSEBR/MSEB NF -0/+0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 39B0.10
+*Want "MSEBR/MSEB NF -0/+0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 39C0.10
+*Want "MSEBR/MSEB NF -0/+0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 39D0.10
+*Want "MSEBR/MSEB NF -0/+0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r 39E0.10
+*Want "MSEBR/MSEB NF -0/+0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r 39F0.10
+*Want "MSEBR/MSEB NF -0/+0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r 3A00.10
+*Want "MSEBR/MSEB NF -0/+2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3A10.10
+*Want "MSEBR/MSEB NF -0/+2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3A20.10
+*Want "MSEBR/MSEB NF -0/+2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3A30.10
+*Want "MSEBR/MSEB NF -0/+2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3A40.10
+*Want "MSEBR/MSEB NF -0/+2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3A50.10
+*Want "MSEBR/MSEB NF -0/+2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3A60.10
+*Want "MSEBR/MSEB NF -0/+2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 3A70.10
+*Want "MSEBR/MSEB NF -0/+2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3A80.10
+*Want "MSEBR/MSEB NF -0/+inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3A90.10
+*Want "MSEBR/MSEB NF -0/+inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3AA0.10
+*Want "MSEBR/MSEB NF -0/+inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3AB0.10
+*Want "MSEBR/MSEB NF -0/+inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3AC0.10
+*Want "MSEBR/MSEB NF -0/+inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3AD0.10
+*Want "MSEBR/MSEB NF -0/+inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3AE0.10
+*Want "MSEBR/MSEB NF -0/+inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3AF0.10
+*Want "MSEBR/MSEB NF -0/+inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3B00.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3B10.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3B20.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r 3B30.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r 3B40.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3B50.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3B60.10
+*Want "MSEBR/MSEB NF -0/-QNaN/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 3B70.10
+*Want "MSEBR/MSEB NF -0/-QNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3B80.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r 3B90.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 3BA0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3BB0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3BC0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 3BD0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r 3BE0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3BF0.10
+*Want "MSEBR/MSEB NF -0/+SNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3C00.10
+*Want "MSEBR/MSEB NF +0/-inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3C10.10
+*Want "MSEBR/MSEB NF +0/-inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3C20.10
+*Want "MSEBR/MSEB NF +0/-inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3C30.10
+*Want "MSEBR/MSEB NF +0/-inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3C40.10
+*Want "MSEBR/MSEB NF +0/-inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3C50.10
+*Want "MSEBR/MSEB NF +0/-inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3C60.10
+*Want "MSEBR/MSEB NF +0/-inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3C70.10
+*Want "MSEBR/MSEB NF +0/-inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3C80.10
+*Want "MSEBR/MSEB NF +0/-2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3C90.10
+*Want "MSEBR/MSEB NF +0/-2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3CA0.10
+*Want "MSEBR/MSEB NF +0/-2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3CB0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3CC0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3CD0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3CE0.10
+*Want "MSEBR/MSEB NF +0/-2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 3CF0.10
+*Want "MSEBR/MSEB NF +0/-2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3D00.10
+*Want "MSEBR/MSEB NF +0/-0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3D10.10
+*Want "MSEBR/MSEB NF +0/-0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3D20.10
+*Want "MSEBR/MSEB NF +0/-0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3D30.10
+*Want "MSEBR/MSEB NF +0/-0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3D40.10
+*Want "MSEBR/MSEB NF +0/-0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3D50.10
+*Want "MSEBR/MSEB NF +0/-0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3D60.10
+*Want "MSEBR/MSEB NF +0/-0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r 3D70.10
+*Want "MSEBR/MSEB NF +0/-0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r 3D80.10
+*Want "MSEBR/MSEB NF +0/+0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3D90.10
+*Want "MSEBR/MSEB NF +0/+0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3DA0.10
+*Want "MSEBR/MSEB NF +0/+0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3DB0.10
+*Want "MSEBR/MSEB NF +0/+0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r 3DC0.10
+*Want "MSEBR/MSEB NF +0/+0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3DD0.10
+*Want "MSEBR/MSEB NF +0/+0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r 3DE0.10
+*Want "MSEBR/MSEB NF +0/+0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r 3DF0.10
+*Want "MSEBR/MSEB NF +0/+0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r 3E00.10
+*Want "MSEBR/MSEB NF +0/+2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3E10.10
+*Want "MSEBR/MSEB NF +0/+2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3E20.10
+*Want "MSEBR/MSEB NF +0/+2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3E30.10
+*Want "MSEBR/MSEB NF +0/+2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 3E40.10
+*Want "MSEBR/MSEB NF +0/+2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 3E50.10
+*Want "MSEBR/MSEB NF +0/+2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 3E60.10
+*Want "MSEBR/MSEB NF +0/+2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 3E70.10
+*Want "MSEBR/MSEB NF +0/+2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3E80.10
+*Want "MSEBR/MSEB NF +0/+inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3E90.10
+*Want "MSEBR/MSEB NF +0/+inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3EA0.10
+*Want "MSEBR/MSEB NF +0/+inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3EB0.10
+*Want "MSEBR/MSEB NF +0/+inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 3EC0.10
+*Want "MSEBR/MSEB NF +0/+inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 3ED0.10
+*Want "MSEBR/MSEB NF +0/+inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 3EE0.10
+*Want "MSEBR/MSEB NF +0/+inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3EF0.10
+*Want "MSEBR/MSEB NF +0/+inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 3F00.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3F10.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3F20.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r 3F30.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r 3F40.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 3F50.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 3F60.10
+*Want "MSEBR/MSEB NF +0/-QNaN/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 3F70.10
+*Want "MSEBR/MSEB NF +0/-QNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3F80.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r 3F90.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 3FA0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3FB0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 3FC0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 3FD0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r 3FE0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 3FF0.10
+*Want "MSEBR/MSEB NF +0/+SNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4000.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 4010.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4020.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4030.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4040.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4050.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4060.10
+*Want "MSEBR/MSEB NF +2.0/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 4070.10
+*Want "MSEBR/MSEB NF +2.0/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4080.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4090.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 40A0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 40B0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 40C0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 40D0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 40E0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 40F0.10
+*Want "MSEBR/MSEB NF +2.0/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4100.10
+*Want "MSEBR/MSEB NF +2.0/-0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 4110.10
+*Want "MSEBR/MSEB NF +2.0/-0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4120.10
+*Want "MSEBR/MSEB NF +2.0/-0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 4130.10
+*Want "MSEBR/MSEB NF +2.0/-0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 4140.10
+*Want "MSEBR/MSEB NF +2.0/-0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4150.10
+*Want "MSEBR/MSEB NF +2.0/-0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 4160.10
+*Want "MSEBR/MSEB NF +2.0/-0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 4170.10
+*Want "MSEBR/MSEB NF +2.0/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 4180.10
+*Want "MSEBR/MSEB NF +2.0/+0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r 4190.10
+*Want "MSEBR/MSEB NF +2.0/+0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 41A0.10
+*Want "MSEBR/MSEB NF +2.0/+0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r 41B0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r 41C0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r 41D0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r 41E0.10
+*Want "MSEBR/MSEB NF +2.0/+0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r 41F0.10
+*Want "MSEBR/MSEB NF +2.0/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 4200.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4210.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4220.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4230.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4240.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4250.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4260.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 4270.10
+*Want "MSEBR/MSEB NF +2.0/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4280.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4290.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 42A0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 42B0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 42C0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 42D0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 42E0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 42F0.10
+*Want "MSEBR/MSEB NF +2.0/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4300.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4310.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4320.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4330.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4340.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4350.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4360.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 4370.10
+*Want "MSEBR/MSEB NF +2.0/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4380.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4390.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 43A0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 43B0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 43C0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 43D0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 43E0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 43F0.10
+*Want "MSEBR/MSEB NF +2.0/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4400.10
+*Want "MSEBR/MSEB NF +inf/-inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 4410.10
+*Want "MSEBR/MSEB NF +inf/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4420.10
+*Want "MSEBR/MSEB NF +inf/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4430.10
+*Want "MSEBR/MSEB NF +inf/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4440.10
+*Want "MSEBR/MSEB NF +inf/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4450.10
+*Want "MSEBR/MSEB NF +inf/-inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4460.10
+*Want "MSEBR/MSEB NF +inf/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 4470.10
+*Want "MSEBR/MSEB NF +inf/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4480.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r 4490.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 44A0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 44B0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 44C0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 44D0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r 44E0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 44F0.10
+*Want "MSEBR/MSEB NF +inf/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4500.10
+*Want "MSEBR/MSEB NF +inf/-0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 4510.10
+*Want "MSEBR/MSEB NF +inf/-0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 4520.10
+*Want "MSEBR/MSEB NF +inf/-0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 4530.10
+*Want "MSEBR/MSEB NF +inf/-0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 4540.10
+*Want "MSEBR/MSEB NF +inf/-0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 4550.10
+*Want "MSEBR/MSEB NF +inf/-0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 4560.10
+*Want "MSEBR/MSEB NF +inf/-0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 4570.10
+*Want "MSEBR/MSEB NF +inf/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 4580.10
+*Want "MSEBR/MSEB NF +inf/+0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r 4590.10
+*Want "MSEBR/MSEB NF +inf/+0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 45A0.10
+*Want "MSEBR/MSEB NF +inf/+0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r 45B0.10
+*Want "MSEBR/MSEB NF +inf/+0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r 45C0.10
+*Want "MSEBR/MSEB NF +inf/+0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r 45D0.10
+*Want "MSEBR/MSEB NF +inf/+0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r 45E0.10
+*Want "MSEBR/MSEB NF +inf/+0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 45F0.10
+*Want "MSEBR/MSEB NF +inf/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r 4600.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4610.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4620.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4630.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 4640.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4650.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 4660.10
+*Want "MSEBR/MSEB NF +inf/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 4670.10
+*Want "MSEBR/MSEB NF +inf/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4680.10
+*Want "MSEBR/MSEB NF +inf/+inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r 4690.10
+*Want "MSEBR/MSEB NF +inf/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 46A0.10
+*Want "MSEBR/MSEB NF +inf/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r 46B0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r 46C0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r 46D0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r 46E0.10
+*Want "MSEBR/MSEB NF +inf/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r 46F0.10
+*Want "MSEBR/MSEB NF +inf/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r 4700.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4710.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4720.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4730.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4740.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4750.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4760.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 4770.10
+*Want "MSEBR/MSEB NF +inf/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4780.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4790.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 47A0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 47B0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 47C0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 47D0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 47E0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 47F0.10
+*Want "MSEBR/MSEB NF +inf/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4800.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4810.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4820.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4830.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4840.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4850.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4860.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 4870.10
+*Want "MSEBR/MSEB NF -QNaN/-inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4880.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4890.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 48A0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 48B0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 48C0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 48D0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 48E0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 48F0.10
+*Want "MSEBR/MSEB NF -QNaN/-2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4900.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 4910.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4920.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r 4930.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r 4940.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4950.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 4960.10
+*Want "MSEBR/MSEB NF -QNaN/-0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 4970.10
+*Want "MSEBR/MSEB NF -QNaN/-0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4980.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r 4990.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 49A0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r 49B0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r 49C0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r 49D0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r 49E0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r 49F0.10
+*Want "MSEBR/MSEB NF -QNaN/+0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4A00.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4A10.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4A20.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4A30.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4A40.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4A50.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4A60.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 4A70.10
+*Want "MSEBR/MSEB NF -QNaN/+2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4A80.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4A90.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4AA0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4AB0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r 4AC0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r 4AD0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r 4AE0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r 4AF0.10
+*Want "MSEBR/MSEB NF -QNaN/+inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4B00.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-inf FPCR"  00000000 F8000000 00000000 F8000000
+r 4B10.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-2.0 FPCR"  00000000 F8000000 00000000 F8000000
+r 4B20.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4B30.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+0 FPCR"    00000000 F8000000 00000000 F8000000
+r 4B40.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+2.0 FPCR"  00000000 F8000000 00000000 F8000000
+r 4B50.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+inf FPCR"  00000000 F8000000 00000000 F8000000
+r 4B60.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/-QNaN FPCR" 00000000 F8000000 00000000 F8000000
+r 4B70.10
+*Want "MSEBR/MSEB NF -QNaN/-QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4B80.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4B90.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4BA0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4BB0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4BC0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4BD0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4BE0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4BF0.10
+*Want "MSEBR/MSEB NF -QNaN/+SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4C00.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4C10.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4C20.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4C30.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4C40.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4C50.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4C60.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4C70.10
+*Want "MSEBR/MSEB NF +SNaN/-inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4C80.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4C90.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4CA0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4CB0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4CC0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4CD0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4CE0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4CF0.10
+*Want "MSEBR/MSEB NF +SNaN/-2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4D00.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r 4D10.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4D20.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 4D30.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 4D40.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4D50.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r 4D60.10
+*Want "MSEBR/MSEB NF +SNaN/-0/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4D70.10
+*Want "MSEBR/MSEB NF +SNaN/-0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4D80.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r 4D90.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4DA0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r 4DB0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r 4DC0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4DD0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r 4DE0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4DF0.10
+*Want "MSEBR/MSEB NF +SNaN/+0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r 4E00.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4E10.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4E20.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4E30.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4E40.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4E50.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4E60.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4E70.10
+*Want "MSEBR/MSEB NF +SNaN/+2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4E80.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4E90.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4EA0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4EB0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r 4EC0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r 4ED0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r 4EE0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4EF0.10
+*Want "MSEBR/MSEB NF +SNaN/+inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r 4F00.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4F10.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4F20.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4F30.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4F40.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4F50.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4F60.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4F70.10
+*Want "MSEBR/MSEB NF +SNaN/-QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4F80.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4F90.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4FA0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4FB0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r 4FC0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r 4FD0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r 4FE0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r 4FF0.10
+*Want "MSEBR/MSEB NF +SNaN/+SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+
+
+
+# Short BFP Multiply And Subtract finite results
+*Compare
+r 5000.10
+*Want "MSEBR/MSEB F Ovfl 1"             FF800000 DF7FFFFE FF800000 DF7FFFFE
+r 5010.10
+*Want "MSEBR/MSEB F Ovfl 2"             FF800000 9FFFFFFF FF800000 9FFFFFFF
+r 5020.10
+*Want "MSEBR/MSEB F Ufl 1"              80400001 E0000002 80400001 E0000002
+r 5030.10
+*Want "MSEBR/MSEB F Ufl 2"              003FFFFE 5FFFFFFA 003FFFFE 5FFFFFFA
+r 5040.10
+*Want "MSEBR/MSEB F Nmin"               00BFFFFE 00BFFFFE 00BFFFFE 00BFFFFE
+r 5050.10
+*Want "MSEBR/MSEB F Incr"               BFC8000D BFC8000D BFC8000D BFC8000D
+r 5060.10
+*Want "MSEBR/MSEB F Trun"               BFC80007 BFC80007 BFC80007 BFC80007
+
+
+# Short BFP Multiply And Subtract finite results - FPCR contents
+*Compare
+r 5100.10
+*Want "MSEBR/MSEB F Ovfl 1 FPCR"        00280000 F8002800 00280000 F8002800
+r 5110.10
+*Want "MSEBR/MSEB F Ovfl 2 FPCR"        00280000 F8002000 00280000 F8002000
+r 5120.10
+*Want "MSEBR/MSEB F Ufl 1 FPCR"         00180000 F8001C00 00180000 F8001C00
+r 5130.10
+*Want "MSEBR/MSEB F Ufl 2 FPCR"         00180000 F8001000 00180000 F8001000
+r 5140.10
+*Want "MSEBR/MSEB F Nmin FPCR"          00000000 F8000000 00000000 F8000000
+r 5150.10
+*Want "MSEBR/MSEB F Incr FPCR"          00080000 F8000C00 00080000 F8000C00
+r 5160.10
+*Want "MSEBR/MSEB F Trun FPCR"          00080000 F8000800 00080000 F8000800
+
+
+# Short BFP Multiply And Subtract rounding mode results
+*Compare
+r 5200.10
+*Want "MSEBR/MSEB RM +NZ RNTE, RZ" 3FC80007 3FC80007 3FC80007 3FC80007
+r 5210.10
+*Want "MSEBR/MSEB RM +NZ RP, RM"   3FC80008 3FC80008 3FC80007 3FC80007
+r 5220.10
+*Want "MSEBR/MSEB RM +NZ RFS"      3FC80007 3FC80007 00000000 00000000
+r 5230.10
+*Want "MSEBR/MSEB RM -NZ RNTE, RZ" BFC80007 BFC80007 BFC80007 BFC80007
+r 5240.10
+*Want "MSEBR/MSEB RM -NZ RP, RM"   BFC80007 BFC80007 BFC80008 BFC80008
+r 5250.10
+*Want "MSEBR/MSEB RM -NZ RFS"      BFC80007 BFC80007 00000000 00000000
+r 5260.10
+*Want "MSEBR/MSEB RM +NA RNTE, RZ" 3FC8000D 3FC8000D 3FC8000C 3FC8000C
+r 5270.10
+*Want "MSEBR/MSEB RM +NA RP, RM"   3FC8000D 3FC8000D 3FC8000C 3FC8000C
+r 5280.10
+*Want "MSEBR/MSEB RM +NA RFS"      3FC8000D 3FC8000D 00000000 00000000
+r 5290.10
+*Want "MSEBR/MSEB RM -NA RNTE, RZ" BFC8000D BFC8000D BFC8000C BFC8000C
+r 52A0.10
+*Want "MSEBR/MSEB RM -NA RP, RM"   BFC8000C BFC8000C BFC8000D BFC8000D
+r 52B0.10
+*Want "MSEBR/MSEB RM -NA RFS"      BFC8000D BFC8000D 00000000 00000000
+r 52C0.10
+*Want "MSEBR/MSEB RM +TZ RNTE, RZ" 3FC80008 3FC80008 3FC80008 3FC80008
+r 52D0.10
+*Want "MSEBR/MSEB RM +TZ RP, RM"   3FC80009 3FC80009 3FC80008 3FC80008
+r 52E0.10
+*Want "MSEBR/MSEB RM +TZ RFS"      3FC80009 3FC80009 00000000 00000000
+r 52F0.10
+*Want "MSEBR/MSEB RM -TZ RNTE, RZ" BFC80008 BFC80008 BFC80008 BFC80008
+r 5300.10
+*Want "MSEBR/MSEB RM -TZ RP, RM"   BFC80008 BFC80008 BFC80009 BFC80009
+r 5310.10
+*Want "MSEBR/MSEB RM -TZ RFS"      BFC80009 BFC80009 00000000 00000000
+r 5320.10
+*Want "MSEBR/MSEB RM +TA RNTE, RZ" 3FC8001A 3FC8001A 3FC80019 3FC80019
+r 5330.10
+*Want "MSEBR/MSEB RM +TA RP, RM"   3FC8001A 3FC8001A 3FC80019 3FC80019
+r 5340.10
+*Want "MSEBR/MSEB RM +TA RFS"      3FC80019 3FC80019 00000000 00000000
+r 5350.10
+*Want "MSEBR/MSEB RM -TA RNTE, RZ" BFC8001A BFC8001A BFC80019 BFC80019
+r 5360.10
+*Want "MSEBR/MSEB RM -TA RP, RM"   BFC80019 BFC80019 BFC8001A BFC8001A
+r 5370.10
+*Want "MSEBR/MSEB RM -TA RFS"      BFC80019 BFC80019 00000000 00000000
+
+
+# Short BFP Multiply And Subtract rounding mode results - FPCR contents
+*Compare
+r 5500.10
+*Want "MSEBR/MSEB RM +NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5510.10
+*Want "MSEBR/MSEB RM +NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5520.10
+*Want "MSEBR/MSEB RM +NZ RFS FPCR"      00080007 00080007 00000000 00000000
+r 5530.10
+*Want "MSEBR/MSEB RM -NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5540.10
+*Want "MSEBR/MSEB RM -NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5550.10
+*Want "MSEBR/MSEB RM -NZ RFS FPCR"      00080007 00080007 00000000 00000000
+r 5560.10
+*Want "MSEBR/MSEB RM +NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5570.10
+*Want "MSEBR/MSEB RM +NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5580.10
+*Want "MSEBR/MSEB RM +NA RFS FPCR"      00080007 00080007 00000000 00000000
+r 5590.10
+*Want "MSEBR/MSEB RM -NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 55A0.10
+*Want "MSEBR/MSEB RM -NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 55B0.10
+*Want "MSEBR/MSEB RM -NA RFS FPCR"      00080007 00080007 00000000 00000000
+r 55C0.10
+*Want "MSEBR/MSEB RM +TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 55D0.10
+*Want "MSEBR/MSEB RM +TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 55E0.10
+*Want "MSEBR/MSEB RM +TZ RFS FPCR"      00080007 00080007 00000000 00000000
+r 55F0.10
+*Want "MSEBR/MSEB RM -TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5600.10
+*Want "MSEBR/MSEB RM -TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5610.10
+*Want "MSEBR/MSEB RM -TZ RFS FPCR"      00080007 00080007 00000000 00000000
+r 5620.10
+*Want "MSEBR/MSEB RM +TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5630.10
+*Want "MSEBR/MSEB RM +TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5640.10
+*Want "MSEBR/MSEB RM +TA RFS FPCR"      00080007 00080007 00000000 00000000
+r 5650.10
+*Want "MSEBR/MSEB RM -TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r 5660.10
+*Want "MSEBR/MSEB RM -TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r 5670.10
+*Want "MSEBR/MSEB RM -TA RFS FPCR"      00080007 00080007 00000000 00000000
+
+
+# Long BFP Multiply And Subtract non-finite finite results
+*Compare
+r 6000.10
+*Want "MSDBR NF -inf/-inf/-inf"    7FF00000 00000000 7FF00000 00000000
+r 6010.10
+*Want "MSDB NF -inf/-inf/-inf"     7FF00000 00000000 7FF00000 00000000
+r 6020.10
+*Want "MSDBR NF -inf/-inf/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 6030.10
+*Want "MSDB NF -inf/-inf/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 6040.10
+*Want "MSDBR NF -inf/-inf/-0"      7FF00000 00000000 7FF00000 00000000
+r 6050.10
+*Want "MSDB NF -inf/-inf/-0"       7FF00000 00000000 7FF00000 00000000
+r 6060.10
+*Want "MSDBR NF -inf/-inf/+0"      7FF00000 00000000 7FF00000 00000000
+r 6070.10
+*Want "MSDB NF -inf/-inf/+0"       7FF00000 00000000 7FF00000 00000000
+r 6080.10
+*Want "MSDBR NF -inf/-inf/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 6090.10
+*Want "MSDB NF -inf/-inf/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 60A0.10
+*Want "MSDBR NF -inf/-inf/+inf"    7FF80000 00000000 7FF00000 00000000
+r 60B0.10
+*Want "MSDB NF -inf/-inf/+inf"     7FF80000 00000000 7FF00000 00000000
+r 60C0.10
+*Want "MSDBR NF -inf/-inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 60D0.10
+*Want "MSDB NF -inf/-inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 60E0.10
+*Want "MSDBR NF -inf/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 60F0.10
+*Want "MSDB NF -inf/-inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6100.10
+*Want "MSDBR NF -inf/-2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 6110.10
+*Want "MSDB NF -inf/-2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 6120.10
+*Want "MSDBR NF -inf/-2.0/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 6130.10
+*Want "MSDB NF -inf/-2.0/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 6140.10
+*Want "MSDBR NF -inf/-2.0/-0"      7FF00000 00000000 7FF00000 00000000
+r 6150.10
+*Want "MSDB NF -inf/-2.0/-0"       7FF00000 00000000 7FF00000 00000000
+r 6160.10
+*Want "MSDBR NF -inf/-2.0/+0"      7FF00000 00000000 7FF00000 00000000
+r 6170.10
+*Want "MSDB NF -inf/-2.0/+0"       7FF00000 00000000 7FF00000 00000000
+r 6180.10
+*Want "MSDBR NF -inf/-2.0/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 6190.10
+*Want "MSDB NF -inf/-2.0/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 61A0.10
+*Want "MSDBR NF -inf/-2.0/+inf"    7FF80000 00000000 7FF00000 00000000
+r 61B0.10
+*Want "MSDB NF -inf/-2.0/+inf"     7FF80000 00000000 7FF00000 00000000
+r 61C0.10
+*Want "MSDBR NF -inf/-2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 61D0.10
+*Want "MSDB NF -inf/-2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 61E0.10
+*Want "MSDBR NF -inf/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 61F0.10
+*Want "MSDB NF -inf/-2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6200.10
+*Want "MSDBR NF -inf/-0/-inf"      7FF80000 00000000 FFF00000 00000000
+r 6210.10
+*Want "MSDB NF -inf/-0/-inf"       7FF80000 00000000 FFF00000 00000000
+r 6220.10
+*Want "MSDBR NF -inf/-0/-2.0"      7FF80000 00000000 C0000000 00000000
+r 6230.10
+*Want "MSDB NF -inf/-0/-2.0"       7FF80000 00000000 C0000000 00000000
+r 6240.10
+*Want "MSDBR NF -inf/-0/-0"        7FF80000 00000000 80000000 00000000
+r 6250.10
+*Want "MSDB NF -inf/-0/-0"         7FF80000 00000000 80000000 00000000
+r 6260.10
+*Want "MSDBR NF -inf/-0/+0"        7FF80000 00000000 00000000 00000000
+r 6270.10
+*Want "MSDB NF -inf/-0/+0"         7FF80000 00000000 00000000 00000000
+r 6280.10
+*Want "MSDBR NF -inf/-0/+2.0"      7FF80000 00000000 40000000 00000000
+r 6290.10
+*Want "MSDB NF -inf/-0/+2.0"       7FF80000 00000000 40000000 00000000
+r 62A0.10
+*Want "MSDBR NF -inf/-0/+inf"      7FF80000 00000000 7FF00000 00000000
+r 62B0.10
+*Want "MSDB NF -inf/-0/+inf"       7FF80000 00000000 7FF00000 00000000
+r 62C0.10
+*Want "MSDBR NF -inf/-0/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 62D0.10
+*Want "MSDB NF -inf/-0/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 62E0.10
+*Want "MSDBR NF -inf/-0/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 62F0.10
+*Want "MSDB NF -inf/-0/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 6300.10
+*Want "MSDBR NF -inf/+0/-inf"      7FF80000 00000000 FFF00000 00000000
+r 6310.10
+*Want "MSDB NF -inf/+0/-inf"       7FF80000 00000000 FFF00000 00000000
+r 6320.10
+*Want "MSDBR NF -inf/+0/-2.0"      7FF80000 00000000 C0000000 00000000
+r 6330.10
+*Want "MSDB NF -inf/+0/-2.0"       7FF80000 00000000 C0000000 00000000
+r 6340.10
+*Want "MSDBR NF -inf/+0/-0"        7FF80000 00000000 80000000 00000000
+r 6350.10
+*Want "MSDB NF -inf/+0/-0"         7FF80000 00000000 80000000 00000000
+r 6360.10
+*Want "MSDBR NF -inf/+0/+0"        7FF80000 00000000 00000000 00000000
+r 6370.10
+*Want "MSDB NF -inf/+0/+0"         7FF80000 00000000 00000000 00000000
+r 6380.10
+*Want "MSDBR NF -inf/+0/+2.0"      7FF80000 00000000 40000000 00000000
+r 6390.10
+*Want "MSDB NF -inf/+0/+2.0"       7FF80000 00000000 40000000 00000000
+r 63A0.10
+*Want "MSDBR NF -inf/+0/+inf"      7FF80000 00000000 7FF00000 00000000
+r 63B0.10
+*Want "MSDB NF -inf/+0/+inf"       7FF80000 00000000 7FF00000 00000000
+r 63C0.10
+*Want "MSDBR NF -inf/+0/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 63D0.10
+*Want "MSDB NF -inf/+0/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 63E0.10
+*Want "MSDBR NF -inf/+0/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 63F0.10
+*Want "MSDB NF -inf/+0/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 6400.10
+*Want "MSDBR NF -inf/+2.0/-inf"    7FF80000 00000000 FFF00000 00000000
+r 6410.10
+*Want "MSDB NF -inf/+2.0/-inf"     7FF80000 00000000 FFF00000 00000000
+r 6420.10
+*Want "MSDBR NF -inf/+2.0/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 6430.10
+*Want "MSDB NF -inf/+2.0/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 6440.10
+*Want "MSDBR NF -inf/+2.0/-0"      FFF00000 00000000 FFF00000 00000000
+r 6450.10
+*Want "MSDB NF -inf/+2.0/-0"       FFF00000 00000000 FFF00000 00000000
+r 6460.10
+*Want "MSDBR NF -inf/+2.0/+0"      FFF00000 00000000 FFF00000 00000000
+r 6470.10
+*Want "MSDB NF -inf/+2.0/+0"       FFF00000 00000000 FFF00000 00000000
+r 6480.10
+*Want "MSDBR NF -inf/+2.0/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 6490.10
+*Want "MSDB NF -inf/+2.0/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 64A0.10
+*Want "MSDBR NF -inf/+2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 64B0.10
+*Want "MSDB NF -inf/+2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 64C0.10
+*Want "MSDBR NF -inf/+2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 64D0.10
+*Want "MSDB NF -inf/+2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 64E0.10
+*Want "MSDBR NF -inf/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 64F0.10
+*Want "MSDB NF -inf/+2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6500.10
+*Want "MSDBR NF -inf/+inf/-inf"    7FF80000 00000000 FFF00000 00000000
+r 6510.10
+*Want "MSDB NF -inf/+inf/-inf"     7FF80000 00000000 FFF00000 00000000
+r 6520.10
+*Want "MSDBR NF -inf/+inf/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 6530.10
+*Want "MSDB NF -inf/+inf/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 6540.10
+*Want "MSDBR NF -inf/+inf/-0"      FFF00000 00000000 FFF00000 00000000
+r 6550.10
+*Want "MSDB NF -inf/+inf/-0"       FFF00000 00000000 FFF00000 00000000
+r 6560.10
+*Want "MSDBR NF -inf/+inf/+0"      FFF00000 00000000 FFF00000 00000000
+r 6570.10
+*Want "MSDB NF -inf/+inf/+0"       FFF00000 00000000 FFF00000 00000000
+r 6580.10
+*Want "MSDBR NF -inf/+inf/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 6590.10
+*Want "MSDB NF -inf/+inf/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 65A0.10
+*Want "MSDBR NF -inf/+inf/+inf"    FFF00000 00000000 FFF00000 00000000
+r 65B0.10
+*Want "MSDB NF -inf/+inf/+inf"     FFF00000 00000000 FFF00000 00000000
+r 65C0.10
+*Want "MSDBR NF -inf/+inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 65D0.10
+*Want "MSDB NF -inf/+inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 65E0.10
+*Want "MSDBR NF -inf/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 65F0.10
+*Want "MSDB NF -inf/+inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6600.10
+*Want "MSDBR NF -inf/-QNaN/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 6610.10
+*Want "MSDB NF -inf/-QNaN/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 6620.10
+*Want "MSDBR NF -inf/-QNaN/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 6630.10
+*Want "MSDB NF -inf/-QNaN/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 6640.10
+*Want "MSDBR NF -inf/-QNaN/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 6650.10
+*Want "MSDB NF -inf/-QNaN/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 6660.10
+*Want "MSDBR NF -inf/-QNaN/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 6670.10
+*Want "MSDB NF -inf/-QNaN/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 6680.10
+*Want "MSDBR NF -inf/-QNaN/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 6690.10
+*Want "MSDB NF -inf/-QNaN/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 66A0.10
+*Want "MSDBR NF -inf/-QNaN/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 66B0.10
+*Want "MSDB NF -inf/-QNaN/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 66C0.10
+*Want "MSDBR NF -inf/-QNaN/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 66D0.10
+*Want "MSDB NF -inf/-QNaN/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 66E0.10
+*Want "MSDBR NF -inf/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 66F0.10
+*Want "MSDB NF -inf/-QNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 6700.10
+*Want "MSDBR NF -inf/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 6710.10
+*Want "MSDB NF -inf/+SNaN/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 6720.10
+*Want "MSDBR NF -inf/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 6730.10
+*Want "MSDB NF -inf/+SNaN/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 6740.10
+*Want "MSDBR NF -inf/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 6750.10
+*Want "MSDB NF -inf/+SNaN/-0"      7FF8A000 00000000 80000000 00000000
+r 6760.10
+*Want "MSDBR NF -inf/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 6770.10
+*Want "MSDB NF -inf/+SNaN/+0"      7FF8A000 00000000 00000000 00000000
+r 6780.10
+*Want "MSDBR NF -inf/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 6790.10
+*Want "MSDB NF -inf/+SNaN/+2.0"    7FF8A000 00000000 40000000 00000000
+r 67A0.10
+*Want "MSDBR NF -inf/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 67B0.10
+*Want "MSDB NF -inf/+SNaN/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 67C0.10
+*Want "MSDBR NF -inf/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 67D0.10
+*Want "MSDB NF -inf/+SNaN/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 67E0.10
+*Want "MSDBR NF -inf/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 67F0.10
+*Want "MSDB NF -inf/+SNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 6800.10
+*Want "MSDBR NF -2.0/-inf/-inf"    7FF00000 00000000 7FF00000 00000000
+r 6810.10
+*Want "MSDB NF -2.0/-inf/-inf"     7FF00000 00000000 7FF00000 00000000
+r 6820.10
+*Want "MSDBR NF -2.0/-inf/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 6830.10
+*Want "MSDB NF -2.0/-inf/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 6840.10
+*Want "MSDBR NF -2.0/-inf/-0"      7FF00000 00000000 7FF00000 00000000
+r 6850.10
+*Want "MSDB NF -2.0/-inf/-0"       7FF00000 00000000 7FF00000 00000000
+r 6860.10
+*Want "MSDBR NF -2.0/-inf/+0"      7FF00000 00000000 7FF00000 00000000
+r 6870.10
+*Want "MSDB NF -2.0/-inf/+0"       7FF00000 00000000 7FF00000 00000000
+r 6880.10
+*Want "MSDBR NF -2.0/-inf/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 6890.10
+*Want "MSDB NF -2.0/-inf/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 68A0.10
+*Want "MSDBR NF -2.0/-inf/+inf"    7FF80000 00000000 7FF00000 00000000
+r 68B0.10
+*Want "MSDB NF -2.0/-inf/+inf"     7FF80000 00000000 7FF00000 00000000
+r 68C0.10
+*Want "MSDBR NF -2.0/-inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 68D0.10
+*Want "MSDB NF -2.0/-inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 68E0.10
+*Want "MSDBR NF -2.0/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 68F0.10
+*Want "MSDB NF -2.0/-inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6900.10
+*Want "MSDBR NF -2.0/-2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 6910.10
+*Want "MSDB NF -2.0/-2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 6920.10
+*Want "MSDBR NF -2.0/-2.0/-2.0"    40180000 00000000 40180000 00000000
+r 6930.10
+*Want "MSDB NF -2.0/-2.0/-2.0"     40180000 00000000 40180000 00000000
+r 6940.10
+*Want "MSDBR NF -2.0/-2.0/-0"      40100000 00000000 40100000 00000000
+r 6950.10
+*Want "MSDB NF -2.0/-2.0/-0"       40100000 00000000 40100000 00000000
+r 6960.10
+*Want "MSDBR NF -2.0/-2.0/+0"      40100000 00000000 40100000 00000000
+r 6970.10
+*Want "MSDB NF -2.0/-2.0/+0"       40100000 00000000 40100000 00000000
+r 6980.10
+*Want "MSDBR NF -2.0/-2.0/+2.0"    40000000 00000000 40000000 00000000
+r 6990.10
+*Want "MSDB NF -2.0/-2.0/+2.0"     40000000 00000000 40000000 00000000
+r 69A0.10
+*Want "MSDBR NF -2.0/-2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 69B0.10
+*Want "MSDB NF -2.0/-2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 69C0.10
+*Want "MSDBR NF -2.0/-2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 69D0.10
+*Want "MSDB NF -2.0/-2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 69E0.10
+*Want "MSDBR NF -2.0/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 69F0.10
+*Want "MSDB NF -2.0/-2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6A00.10
+*Want "MSDBR NF -2.0/-0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 6A10.10
+*Want "MSDB NF -2.0/-0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 6A20.10
+*Want "MSDBR NF -2.0/-0/-2.0"      40000000 00000000 40000000 00000000
+r 6A30.10
+*Want "MSDB NF -2.0/-0/-2.0"       40000000 00000000 40000000 00000000
+r 6A40.10
+*Want "MSDBR NF -2.0/-0/-0"        00000000 00000000 00000000 00000000
+r 6A50.10
+*Want "MSDB NF -2.0/-0/-0"         00000000 00000000 00000000 00000000
+r 6A60.10
+*Want "MSDBR NF -2.0/-0/+0"        00000000 00000000 00000000 00000000
+r 6A70.10
+*Want "MSDB NF -2.0/-0/+0"         00000000 00000000 00000000 00000000
+r 6A80.10
+*Want "MSDBR NF -2.0/-0/+2.0"      C0000000 00000000 C0000000 00000000
+r 6A90.10
+*Want "MSDB NF -2.0/-0/+2.0"       C0000000 00000000 C0000000 00000000
+r 6AA0.10
+*Want "MSDBR NF -2.0/-0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 6AB0.10
+*Want "MSDB NF -2.0/-0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 6AC0.10
+*Want "MSDBR NF -2.0/-0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 6AD0.10
+*Want "MSDB NF -2.0/-0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 6AE0.10
+*Want "MSDBR NF -2.0/-0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 6AF0.10
+*Want "MSDB NF -2.0/-0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 6B00.10
+*Want "MSDBR NF -2.0/+0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 6B10.10
+*Want "MSDB NF -2.0/+0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 6B20.10
+*Want "MSDBR NF -2.0/+0/-2.0"      40000000 00000000 40000000 00000000
+r 6B30.10
+*Want "MSDB NF -2.0/+0/-2.0"       40000000 00000000 40000000 00000000
+r 6B40.10
+*Want "MSDBR NF -2.0/+0/-0"        00000000 00000000 00000000 00000000
+r 6B50.10
+*Want "MSDB NF -2.0/+0/-0"         00000000 00000000 00000000 00000000
+r 6B60.10
+*Want "MSDBR NF -2.0/+0/+0"        80000000 00000000 80000000 00000000
+r 6B70.10
+*Want "MSDB NF -2.0/+0/+0"         80000000 00000000 80000000 00000000
+r 6B80.10
+*Want "MSDBR NF -2.0/+0/+2.0"      C0000000 00000000 C0000000 00000000
+r 6B90.10
+*Want "MSDB NF -2.0/+0/+2.0"       C0000000 00000000 C0000000 00000000
+r 6BA0.10
+*Want "MSDBR NF -2.0/+0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 6BB0.10
+*Want "MSDB NF -2.0/+0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 6BC0.10
+*Want "MSDBR NF -2.0/+0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 6BD0.10
+*Want "MSDB NF -2.0/+0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 6BE0.10
+*Want "MSDBR NF -2.0/+0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 6BF0.10
+*Want "MSDB NF -2.0/+0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 6C00.10
+*Want "MSDBR NF -2.0/+2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 6C10.10
+*Want "MSDB NF -2.0/+2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 6C20.10
+*Want "MSDBR NF -2.0/+2.0/-2.0"    C0000000 00000000 C0000000 00000000
+r 6C30.10
+*Want "MSDB NF -2.0/+2.0/-2.0"     C0000000 00000000 C0000000 00000000
+r 6C40.10
+*Want "MSDBR NF -2.0/+2.0/-0"      C0100000 00000000 C0100000 00000000
+r 6C50.10
+*Want "MSDB NF -2.0/+2.0/-0"       C0100000 00000000 C0100000 00000000
+r 6C60.10
+*Want "MSDBR NF -2.0/+2.0/+0"      C0100000 00000000 C0100000 00000000
+r 6C70.10
+*Want "MSDB NF -2.0/+2.0/+0"       C0100000 00000000 C0100000 00000000
+r 6C80.10
+*Want "MSDBR NF -2.0/+2.0/+2.0"    C0180000 00000000 C0180000 00000000
+r 6C90.10
+*Want "MSDB NF -2.0/+2.0/+2.0"     C0180000 00000000 C0180000 00000000
+r 6CA0.10
+*Want "MSDBR NF -2.0/+2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 6CB0.10
+*Want "MSDB NF -2.0/+2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 6CC0.10
+*Want "MSDBR NF -2.0/+2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 6CD0.10
+*Want "MSDB NF -2.0/+2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 6CE0.10
+*Want "MSDBR NF -2.0/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 6CF0.10
+*Want "MSDB NF -2.0/+2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6D00.10
+*Want "MSDBR NF -2.0/+inf/-inf"    7FF80000 00000000 FFF00000 00000000
+r 6D10.10
+*Want "MSDB NF -2.0/+inf/-inf"     7FF80000 00000000 FFF00000 00000000
+r 6D20.10
+*Want "MSDBR NF -2.0/+inf/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 6D30.10
+*Want "MSDB NF -2.0/+inf/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 6D40.10
+*Want "MSDBR NF -2.0/+inf/-0"      FFF00000 00000000 FFF00000 00000000
+r 6D50.10
+*Want "MSDB NF -2.0/+inf/-0"       FFF00000 00000000 FFF00000 00000000
+r 6D60.10
+*Want "MSDBR NF -2.0/+inf/+0"      FFF00000 00000000 FFF00000 00000000
+r 6D70.10
+*Want "MSDB NF -2.0/+inf/+0"       FFF00000 00000000 FFF00000 00000000
+r 6D80.10
+*Want "MSDBR NF -2.0/+inf/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 6D90.10
+*Want "MSDB NF -2.0/+inf/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 6DA0.10
+*Want "MSDBR NF -2.0/+inf/+inf"    FFF00000 00000000 FFF00000 00000000
+r 6DB0.10
+*Want "MSDB NF -2.0/+inf/+inf"     FFF00000 00000000 FFF00000 00000000
+r 6DC0.10
+*Want "MSDBR NF -2.0/+inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 6DD0.10
+*Want "MSDB NF -2.0/+inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 6DE0.10
+*Want "MSDBR NF -2.0/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 6DF0.10
+*Want "MSDB NF -2.0/+inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 6E00.10
+*Want "MSDBR NF -2.0/-QNaN/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 6E10.10
+*Want "MSDB NF -2.0/-QNaN/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 6E20.10
+*Want "MSDBR NF -2.0/-QNaN/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 6E30.10
+*Want "MSDB NF -2.0/-QNaN/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 6E40.10
+*Want "MSDBR NF -2.0/-QNaN/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 6E50.10
+*Want "MSDB NF -2.0/-QNaN/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 6E60.10
+*Want "MSDBR NF -2.0/-QNaN/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 6E70.10
+*Want "MSDB NF -2.0/-QNaN/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 6E80.10
+*Want "MSDBR NF -2.0/-QNaN/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 6E90.10
+*Want "MSDB NF -2.0/-QNaN/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 6EA0.10
+*Want "MSDBR NF -2.0/-QNaN/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 6EB0.10
+*Want "MSDB NF -2.0/-QNaN/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 6EC0.10
+*Want "MSDBR NF -2.0/-QNaN/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 6ED0.10
+*Want "MSDB NF -2.0/-QNaN/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 6EE0.10
+*Want "MSDBR NF -2.0/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 6EF0.10
+*Want "MSDB NF -2.0/-QNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 6F00.10
+*Want "MSDBR NF -2.0/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 6F10.10
+*Want "MSDB NF -2.0/+SNaN/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 6F20.10
+*Want "MSDBR NF -2.0/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 6F30.10
+*Want "MSDB NF -2.0/+SNaN/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 6F40.10
+*Want "MSDBR NF -2.0/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 6F50.10
+*Want "MSDB NF -2.0/+SNaN/-0"      7FF8A000 00000000 80000000 00000000
+r 6F60.10
+*Want "MSDBR NF -2.0/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 6F70.10
+*Want "MSDB NF -2.0/+SNaN/+0"      7FF8A000 00000000 00000000 00000000
+r 6F80.10
+*Want "MSDBR NF -2.0/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 6F90.10
+*Want "MSDB NF -2.0/+SNaN/+2.0"    7FF8A000 00000000 40000000 00000000
+r 6FA0.10
+*Want "MSDBR NF -2.0/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 6FB0.10
+*Want "MSDB NF -2.0/+SNaN/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 6FC0.10
+*Want "MSDBR NF -2.0/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 6FD0.10
+*Want "MSDB NF -2.0/+SNaN/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 6FE0.10
+*Want "MSDBR NF -2.0/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 6FF0.10
+*Want "MSDB NF -2.0/+SNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 7000.10
+*Want "MSDBR NF -0/-inf/-inf"      7FF80000 00000000 FFF00000 00000000
+r 7010.10
+*Want "MSDB NF -0/-inf/-inf"       7FF80000 00000000 FFF00000 00000000
+r 7020.10
+*Want "MSDBR NF -0/-inf/-2.0"      7FF80000 00000000 C0000000 00000000
+r 7030.10
+*Want "MSDB NF -0/-inf/-2.0"       7FF80000 00000000 C0000000 00000000
+r 7040.10
+*Want "MSDBR NF -0/-inf/-0"        7FF80000 00000000 80000000 00000000
+r 7050.10
+*Want "MSDB NF -0/-inf/-0"         7FF80000 00000000 80000000 00000000
+r 7060.10
+*Want "MSDBR NF -0/-inf/+0"        7FF80000 00000000 00000000 00000000
+r 7070.10
+*Want "MSDB NF -0/-inf/+0"         7FF80000 00000000 00000000 00000000
+r 7080.10
+*Want "MSDBR NF -0/-inf/+2.0"      7FF80000 00000000 40000000 00000000
+r 7090.10
+*Want "MSDB NF -0/-inf/+2.0"       7FF80000 00000000 40000000 00000000
+r 70A0.10
+*Want "MSDBR NF -0/-inf/+inf"      7FF80000 00000000 7FF00000 00000000
+r 70B0.10
+*Want "MSDB NF -0/-inf/+inf"       7FF80000 00000000 7FF00000 00000000
+r 70C0.10
+*Want "MSDBR NF -0/-inf/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 70D0.10
+*Want "MSDB NF -0/-inf/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 70E0.10
+*Want "MSDBR NF -0/-inf/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 70F0.10
+*Want "MSDB NF -0/-inf/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 7100.10
+*Want "MSDBR NF -0/-2.0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 7110.10
+*Want "MSDB NF -0/-2.0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 7120.10
+*Want "MSDBR NF -0/-2.0/-2.0"      40000000 00000000 40000000 00000000
+r 7130.10
+*Want "MSDB NF -0/-2.0/-2.0"       40000000 00000000 40000000 00000000
+r 7140.10
+*Want "MSDBR NF -0/-2.0/-0"        00000000 00000000 00000000 00000000
+r 7150.10
+*Want "MSDB NF -0/-2.0/-0"         00000000 00000000 00000000 00000000
+r 7160.10
+*Want "MSDBR NF -0/-2.0/+0"        00000000 00000000 00000000 00000000
+r 7170.10
+*Want "MSDB NF -0/-2.0/+0"         00000000 00000000 00000000 00000000
+r 7180.10
+*Want "MSDBR NF -0/-2.0/+2.0"      C0000000 00000000 C0000000 00000000
+r 7190.10
+*Want "MSDB NF -0/-2.0/+2.0"       C0000000 00000000 C0000000 00000000
+r 71A0.10
+*Want "MSDBR NF -0/-2.0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 71B0.10
+*Want "MSDB NF -0/-2.0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 71C0.10
+*Want "MSDBR NF -0/-2.0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 71D0.10
+*Want "MSDB NF -0/-2.0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 71E0.10
+*Want "MSDBR NF -0/-2.0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 71F0.10
+*Want "MSDB NF -0/-2.0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 7200.10
+*Want "MSDBR NF -0/-0/-inf"        7FF00000 00000000 7FF00000 00000000
+r 7210.10
+*Want "MSDB NF -0/-0/-inf"         7FF00000 00000000 7FF00000 00000000
+r 7220.10
+*Want "MSDBR NF -0/-0/-2.0"        40000000 00000000 40000000 00000000
+r 7230.10
+*Want "MSDB NF -0/-0/-2.0"         40000000 00000000 40000000 00000000
+r 7240.10
+*Want "MSDBR NF -0/-0/-0"          00000000 00000000 00000000 00000000
+r 7250.10
+*Want "MSDB NF -0/-0/-0"           00000000 00000000 00000000 00000000
+r 7260.10
+*Want "MSDBR NF -0/-0/+0"          00000000 00000000 00000000 00000000
+r 7270.10
+*Want "MSDB NF -0/-0/+0"           00000000 00000000 00000000 00000000
+r 7280.10
+*Want "MSDBR NF -0/-0/+2.0"        C0000000 00000000 C0000000 00000000
+r 7290.10
+*Want "MSDB NF -0/-0/+2.0"         C0000000 00000000 C0000000 00000000
+r 72A0.10
+*Want "MSDBR NF -0/-0/+inf"        FFF00000 00000000 FFF00000 00000000
+r 72B0.10
+*Want "MSDB NF -0/-0/+inf"         FFF00000 00000000 FFF00000 00000000
+r 72C0.10
+*Want "MSDBR NF -0/-0/-QNaN"       FFF8B000 00000000 FFF8B000 00000000
+r 72D0.10
+*Want "MSDB NF -0/-0/-QNaN"        FFF8B000 00000000 FFF8B000 00000000
+r 72E0.10
+*Want "MSDBR NF -0/-0/+SNaN"       7FF8A000 00000000 7FF0A000 00000000
+r 72F0.10
+*Want "MSDB NF -0/-0/+SNaN"        7FF8A000 00000000 7FF0A000 00000000
+r 7300.10
+*Want "MSDBR NF -0/+0/-inf"        7FF00000 00000000 7FF00000 00000000
+r 7310.10
+*Want "MSDB NF -0/+0/-inf"         7FF00000 00000000 7FF00000 00000000
+r 7320.10
+*Want "MSDBR NF -0/+0/-2.0"        40000000 00000000 40000000 00000000
+r 7330.10
+*Want "MSDB NF -0/+0/-2.0"         40000000 00000000 40000000 00000000
+r 7340.10
+*Want "MSDBR NF -0/+0/-0"          00000000 00000000 00000000 00000000
+r 7350.10
+*Want "MSDB NF -0/+0/-0"           00000000 00000000 00000000 00000000
+r 7360.10
+*Want "MSDBR NF -0/+0/+0"          80000000 00000000 80000000 00000000
+r 7370.10
+*Want "MSDB NF -0/+0/+0"           80000000 00000000 80000000 00000000
+r 7380.10
+*Want "MSDBR NF -0/+0/+2.0"        C0000000 00000000 C0000000 00000000
+r 7390.10
+*Want "MSDB NF -0/+0/+2.0"         C0000000 00000000 C0000000 00000000
+r 73A0.10
+*Want "MSDBR NF -0/+0/+inf"        FFF00000 00000000 FFF00000 00000000
+r 73B0.10
+*Want "MSDB NF -0/+0/+inf"         FFF00000 00000000 FFF00000 00000000
+r 73C0.10
+*Want "MSDBR NF -0/+0/-QNaN"       FFF8B000 00000000 FFF8B000 00000000
+r 73D0.10
+*Want "MSDB NF -0/+0/-QNaN"        FFF8B000 00000000 FFF8B000 00000000
+r 73E0.10
+*Want "MSDBR NF -0/+0/+SNaN"       7FF8A000 00000000 7FF0A000 00000000
+r 73F0.10
+*Want "MSDB NF -0/+0/+SNaN"        7FF8A000 00000000 7FF0A000 00000000
+r 7400.10
+*Want "MSDBR NF -0/+2.0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 7410.10
+*Want "MSDB NF -0/+2.0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 7420.10
+*Want "MSDBR NF -0/+2.0/-2.0"      40000000 00000000 40000000 00000000
+r 7430.10
+*Want "MSDB NF -0/+2.0/-2.0"       40000000 00000000 40000000 00000000
+r 7440.10
+*Want "MSDBR NF -0/+2.0/-0"        00000000 00000000 00000000 00000000
+r 7450.10
+*Want "MSDB NF -0/+2.0/-0"         00000000 00000000 00000000 00000000
+r 7460.10
+*Want "MSDBR NF -0/+2.0/+0"        80000000 00000000 80000000 00000000
+r 7470.10
+*Want "MSDB NF -0/+2.0/+0"         80000000 00000000 80000000 00000000
+r 7480.10
+*Want "MSDBR NF -0/+2.0/+2.0"      C0000000 00000000 C0000000 00000000
+r 7490.10
+*Want "MSDB NF -0/+2.0/+2.0"       C0000000 00000000 C0000000 00000000
+r 74A0.10
+*Want "MSDBR NF -0/+2.0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 74B0.10
+*Want "MSDB NF -0/+2.0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 74C0.10
+*Want "MSDBR NF -0/+2.0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 74D0.10
+*Want "MSDB NF -0/+2.0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 74E0.10
+*Want "MSDBR NF -0/+2.0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 74F0.10
+*Want "MSDB NF -0/+2.0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 7500.10
+*Want "MSDBR NF -0/+inf/-inf"      7FF80000 00000000 FFF00000 00000000
+r 7510.10
+*Want "MSDB NF -0/+inf/-inf"       7FF80000 00000000 FFF00000 00000000
+r 7520.10
+*Want "MSDBR NF -0/+inf/-2.0"      7FF80000 00000000 C0000000 00000000
+r 7530.10
+*Want "MSDB NF -0/+inf/-2.0"       7FF80000 00000000 C0000000 00000000
+r 7540.10
+*Want "MSDBR NF -0/+inf/-0"        7FF80000 00000000 80000000 00000000
+r 7550.10
+*Want "MSDB NF -0/+inf/-0"         7FF80000 00000000 80000000 00000000
+r 7560.10
+*Want "MSDBR NF -0/+inf/+0"        7FF80000 00000000 00000000 00000000
+r 7570.10
+*Want "MSDB NF -0/+inf/+0"         7FF80000 00000000 00000000 00000000
+r 7580.10
+*Want "MSDBR NF -0/+inf/+2.0"      7FF80000 00000000 40000000 00000000
+r 7590.10
+*Want "MSDB NF -0/+inf/+2.0"       7FF80000 00000000 40000000 00000000
+r 75A0.10
+*Want "MSDBR NF -0/+inf/+inf"      7FF80000 00000000 7FF00000 00000000
+r 75B0.10
+*Want "MSDB NF -0/+inf/+inf"       7FF80000 00000000 7FF00000 00000000
+r 75C0.10
+*Want "MSDBR NF -0/+inf/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 75D0.10
+*Want "MSDB NF -0/+inf/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 75E0.10
+*Want "MSDBR NF -0/+inf/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 75F0.10
+*Want "MSDB NF -0/+inf/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 7600.10
+*Want "MSDBR NF -0/-QNaN/-inf"     FFF8B000 00000000 FFF8B000 00000000
+r 7610.10
+*Want "MSDB NF -0/-QNaN/-inf"      FFF8B000 00000000 FFF8B000 00000000
+r 7620.10
+*Want "MSDBR NF -0/-QNaN/-2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 7630.10
+*Want "MSDB NF -0/-QNaN/-2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 7640.10
+*Want "MSDBR NF -0/-QNaN/-0"       FFF8B000 00000000 FFF8B000 00000000
+r 7650.10
+*Want "MSDB NF -0/-QNaN/-0"        FFF8B000 00000000 FFF8B000 00000000
+r 7660.10
+*Want "MSDBR NF -0/-QNaN/+0"       FFF8B000 00000000 FFF8B000 00000000
+r 7670.10
+*Want "MSDB NF -0/-QNaN/+0"        FFF8B000 00000000 FFF8B000 00000000
+r 7680.10
+*Want "MSDBR NF -0/-QNaN/+2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 7690.10
+*Want "MSDB NF -0/-QNaN/+2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 76A0.10
+*Want "MSDBR NF -0/-QNaN/+inf"     FFF8B000 00000000 FFF8B000 00000000
+r 76B0.10
+*Want "MSDB NF -0/-QNaN/+inf"      FFF8B000 00000000 FFF8B000 00000000
+r 76C0.10
+*Want "MSDBR NF -0/-QNaN/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 76D0.10
+*Want "MSDB NF -0/-QNaN/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 76E0.10
+*Want "MSDBR NF -0/-QNaN/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 76F0.10
+*Want "MSDB NF -0/-QNaN/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 7700.10
+*Want "MSDBR NF -0/+SNaN/-inf"     7FF8A000 00000000 FFF00000 00000000
+r 7710.10
+*Want "MSDB NF -0/+SNaN/-inf"      7FF8A000 00000000 FFF00000 00000000
+r 7720.10
+*Want "MSDBR NF -0/+SNaN/-2.0"     7FF8A000 00000000 C0000000 00000000
+r 7730.10
+*Want "MSDB NF -0/+SNaN/-2.0"      7FF8A000 00000000 C0000000 00000000
+r 7740.10
+*Want "MSDBR NF -0/+SNaN/-0"       7FF8A000 00000000 80000000 00000000
+r 7750.10
+*Want "MSDB NF -0/+SNaN/-0"        7FF8A000 00000000 80000000 00000000
+r 7760.10
+*Want "MSDBR NF -0/+SNaN/+0"       7FF8A000 00000000 00000000 00000000
+r 7770.10
+*Want "MSDB NF -0/+SNaN/+0"        7FF8A000 00000000 00000000 00000000
+r 7780.10
+*Want "MSDBR NF -0/+SNaN/+2.0"     7FF8A000 00000000 40000000 00000000
+r 7790.10
+*Want "MSDB NF -0/+SNaN/+2.0"      7FF8A000 00000000 40000000 00000000
+r 77A0.10
+*Want "MSDBR NF -0/+SNaN/+inf"     7FF8A000 00000000 7FF00000 00000000
+r 77B0.10
+*Want "MSDB NF -0/+SNaN/+inf"      7FF8A000 00000000 7FF00000 00000000
+r 77C0.10
+*Want "MSDBR NF -0/+SNaN/-QNaN"    7FF8A000 00000000 FFF8B000 00000000
+r 77D0.10
+*Want "MSDB NF -0/+SNaN/-QNaN"     7FF8A000 00000000 FFF8B000 00000000
+r 77E0.10
+*Want "MSDBR NF -0/+SNaN/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 77F0.10
+*Want "MSDB NF -0/+SNaN/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 7800.10
+*Want "MSDBR NF +0/-inf/-inf"      7FF80000 00000000 FFF00000 00000000
+r 7810.10
+*Want "MSDB NF +0/-inf/-inf"       7FF80000 00000000 FFF00000 00000000
+r 7820.10
+*Want "MSDBR NF +0/-inf/-2.0"      7FF80000 00000000 C0000000 00000000
+r 7830.10
+*Want "MSDB NF +0/-inf/-2.0"       7FF80000 00000000 C0000000 00000000
+r 7840.10
+*Want "MSDBR NF +0/-inf/-0"        7FF80000 00000000 80000000 00000000
+r 7850.10
+*Want "MSDB NF +0/-inf/-0"         7FF80000 00000000 80000000 00000000
+r 7860.10
+*Want "MSDBR NF +0/-inf/+0"        7FF80000 00000000 00000000 00000000
+r 7870.10
+*Want "MSDB NF +0/-inf/+0"         7FF80000 00000000 00000000 00000000
+r 7880.10
+*Want "MSDBR NF +0/-inf/+2.0"      7FF80000 00000000 40000000 00000000
+r 7890.10
+*Want "MSDB NF +0/-inf/+2.0"       7FF80000 00000000 40000000 00000000
+r 78A0.10
+*Want "MSDBR NF +0/-inf/+inf"      7FF80000 00000000 7FF00000 00000000
+r 78B0.10
+*Want "MSDB NF +0/-inf/+inf"       7FF80000 00000000 7FF00000 00000000
+r 78C0.10
+*Want "MSDBR NF +0/-inf/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 78D0.10
+*Want "MSDB NF +0/-inf/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 78E0.10
+*Want "MSDBR NF +0/-inf/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 78F0.10
+*Want "MSDB NF +0/-inf/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 7900.10
+*Want "MSDBR NF +0/-2.0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 7910.10
+*Want "MSDB NF +0/-2.0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 7920.10
+*Want "MSDBR NF +0/-2.0/-2.0"      40000000 00000000 40000000 00000000
+r 7930.10
+*Want "MSDB NF +0/-2.0/-2.0"       40000000 00000000 40000000 00000000
+r 7940.10
+*Want "MSDBR NF +0/-2.0/-0"        00000000 00000000 00000000 00000000
+r 7950.10
+*Want "MSDB NF +0/-2.0/-0"         00000000 00000000 00000000 00000000
+r 7960.10
+*Want "MSDBR NF +0/-2.0/+0"        80000000 00000000 80000000 00000000
+r 7970.10
+*Want "MSDB NF +0/-2.0/+0"         80000000 00000000 80000000 00000000
+r 7980.10
+*Want "MSDBR NF +0/-2.0/+2.0"      C0000000 00000000 C0000000 00000000
+r 7990.10
+*Want "MSDB NF +0/-2.0/+2.0"       C0000000 00000000 C0000000 00000000
+r 79A0.10
+*Want "MSDBR NF +0/-2.0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 79B0.10
+*Want "MSDB NF +0/-2.0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 79C0.10
+*Want "MSDBR NF +0/-2.0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 79D0.10
+*Want "MSDB NF +0/-2.0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 79E0.10
+*Want "MSDBR NF +0/-2.0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 79F0.10
+*Want "MSDB NF +0/-2.0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 7A00.10
+*Want "MSDBR NF +0/-0/-inf"        7FF00000 00000000 7FF00000 00000000
+r 7A10.10
+*Want "MSDB NF +0/-0/-inf"         7FF00000 00000000 7FF00000 00000000
+r 7A20.10
+*Want "MSDBR NF +0/-0/-2.0"        40000000 00000000 40000000 00000000
+r 7A30.10
+*Want "MSDB NF +0/-0/-2.0"         40000000 00000000 40000000 00000000
+r 7A40.10
+*Want "MSDBR NF +0/-0/-0"          00000000 00000000 00000000 00000000
+r 7A50.10
+*Want "MSDB NF +0/-0/-0"           00000000 00000000 00000000 00000000
+r 7A60.10
+*Want "MSDBR NF +0/-0/+0"          80000000 00000000 80000000 00000000
+r 7A70.10
+*Want "MSDB NF +0/-0/+0"           80000000 00000000 80000000 00000000
+r 7A80.10
+*Want "MSDBR NF +0/-0/+2.0"        C0000000 00000000 C0000000 00000000
+r 7A90.10
+*Want "MSDB NF +0/-0/+2.0"         C0000000 00000000 C0000000 00000000
+r 7AA0.10
+*Want "MSDBR NF +0/-0/+inf"        FFF00000 00000000 FFF00000 00000000
+r 7AB0.10
+*Want "MSDB NF +0/-0/+inf"         FFF00000 00000000 FFF00000 00000000
+r 7AC0.10
+*Want "MSDBR NF +0/-0/-QNaN"       FFF8B000 00000000 FFF8B000 00000000
+r 7AD0.10
+*Want "MSDB NF +0/-0/-QNaN"        FFF8B000 00000000 FFF8B000 00000000
+r 7AE0.10
+*Want "MSDBR NF +0/-0/+SNaN"       7FF8A000 00000000 7FF0A000 00000000
+r 7AF0.10
+*Want "MSDB NF +0/-0/+SNaN"        7FF8A000 00000000 7FF0A000 00000000
+r 7B00.10
+*Want "MSDBR NF +0/+0/-inf"        7FF00000 00000000 7FF00000 00000000
+r 7B10.10
+*Want "MSDB NF +0/+0/-inf"         7FF00000 00000000 7FF00000 00000000
+r 7B20.10
+*Want "MSDBR NF +0/+0/-2.0"        40000000 00000000 40000000 00000000
+r 7B30.10
+*Want "MSDB NF +0/+0/-2.0"         40000000 00000000 40000000 00000000
+r 7B40.10
+*Want "MSDBR NF +0/+0/-0"          00000000 00000000 00000000 00000000
+r 7B50.10
+*Want "MSDB NF +0/+0/-0"           00000000 00000000 00000000 00000000
+r 7B60.10
+*Want "MSDBR NF +0/+0/+0"          00000000 00000000 00000000 00000000
+r 7B70.10
+*Want "MSDB NF +0/+0/+0"           00000000 00000000 00000000 00000000
+r 7B80.10
+*Want "MSDBR NF +0/+0/+2.0"        C0000000 00000000 C0000000 00000000
+r 7B90.10
+*Want "MSDB NF +0/+0/+2.0"         C0000000 00000000 C0000000 00000000
+r 7BA0.10
+*Want "MSDBR NF +0/+0/+inf"        FFF00000 00000000 FFF00000 00000000
+r 7BB0.10
+*Want "MSDB NF +0/+0/+inf"         FFF00000 00000000 FFF00000 00000000
+r 7BC0.10
+*Want "MSDBR NF +0/+0/-QNaN"       FFF8B000 00000000 FFF8B000 00000000
+r 7BD0.10
+*Want "MSDB NF +0/+0/-QNaN"        FFF8B000 00000000 FFF8B000 00000000
+r 7BE0.10
+*Want "MSDBR NF +0/+0/+SNaN"       7FF8A000 00000000 7FF0A000 00000000
+r 7BF0.10
+*Want "MSDB NF +0/+0/+SNaN"        7FF8A000 00000000 7FF0A000 00000000
+r 7C00.10
+*Want "MSDBR NF +0/+2.0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 7C10.10
+*Want "MSDB NF +0/+2.0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 7C20.10
+*Want "MSDBR NF +0/+2.0/-2.0"      40000000 00000000 40000000 00000000
+r 7C30.10
+*Want "MSDB NF +0/+2.0/-2.0"       40000000 00000000 40000000 00000000
+r 7C40.10
+*Want "MSDBR NF +0/+2.0/-0"        00000000 00000000 00000000 00000000
+r 7C50.10
+*Want "MSDB NF +0/+2.0/-0"         00000000 00000000 00000000 00000000
+r 7C60.10
+*Want "MSDBR NF +0/+2.0/+0"        00000000 00000000 00000000 00000000
+r 7C70.10
+*Want "MSDB NF +0/+2.0/+0"         00000000 00000000 00000000 00000000
+r 7C80.10
+*Want "MSDBR NF +0/+2.0/+2.0"      C0000000 00000000 C0000000 00000000
+r 7C90.10
+*Want "MSDB NF +0/+2.0/+2.0"       C0000000 00000000 C0000000 00000000
+r 7CA0.10
+*Want "MSDBR NF +0/+2.0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 7CB0.10
+*Want "MSDB NF +0/+2.0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 7CC0.10
+*Want "MSDBR NF +0/+2.0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 7CD0.10
+*Want "MSDB NF +0/+2.0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 7CE0.10
+*Want "MSDBR NF +0/+2.0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 7CF0.10
+*Want "MSDB NF +0/+2.0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 7D00.10
+*Want "MSDBR NF +0/+inf/-inf"      7FF80000 00000000 FFF00000 00000000
+r 7D10.10
+*Want "MSDB NF +0/+inf/-inf"       7FF80000 00000000 FFF00000 00000000
+r 7D20.10
+*Want "MSDBR NF +0/+inf/-2.0"      7FF80000 00000000 C0000000 00000000
+r 7D30.10
+*Want "MSDB NF +0/+inf/-2.0"       7FF80000 00000000 C0000000 00000000
+r 7D40.10
+*Want "MSDBR NF +0/+inf/-0"        7FF80000 00000000 80000000 00000000
+r 7D50.10
+*Want "MSDB NF +0/+inf/-0"         7FF80000 00000000 80000000 00000000
+r 7D60.10
+*Want "MSDBR NF +0/+inf/+0"        7FF80000 00000000 00000000 00000000
+r 7D70.10
+*Want "MSDB NF +0/+inf/+0"         7FF80000 00000000 00000000 00000000
+r 7D80.10
+*Want "MSDBR NF +0/+inf/+2.0"      7FF80000 00000000 40000000 00000000
+r 7D90.10
+*Want "MSDB NF +0/+inf/+2.0"       7FF80000 00000000 40000000 00000000
+r 7DA0.10
+*Want "MSDBR NF +0/+inf/+inf"      7FF80000 00000000 7FF00000 00000000
+r 7DB0.10
+*Want "MSDB NF +0/+inf/+inf"       7FF80000 00000000 7FF00000 00000000
+r 7DC0.10
+*Want "MSDBR NF +0/+inf/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 7DD0.10
+*Want "MSDB NF +0/+inf/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 7DE0.10
+*Want "MSDBR NF +0/+inf/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 7DF0.10
+*Want "MSDB NF +0/+inf/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 7E00.10
+*Want "MSDBR NF +0/-QNaN/-inf"     FFF8B000 00000000 FFF8B000 00000000
+r 7E10.10
+*Want "MSDB NF +0/-QNaN/-inf"      FFF8B000 00000000 FFF8B000 00000000
+r 7E20.10
+*Want "MSDBR NF +0/-QNaN/-2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 7E30.10
+*Want "MSDB NF +0/-QNaN/-2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 7E40.10
+*Want "MSDBR NF +0/-QNaN/-0"       FFF8B000 00000000 FFF8B000 00000000
+r 7E50.10
+*Want "MSDB NF +0/-QNaN/-0"        FFF8B000 00000000 FFF8B000 00000000
+r 7E60.10
+*Want "MSDBR NF +0/-QNaN/+0"       FFF8B000 00000000 FFF8B000 00000000
+r 7E70.10
+*Want "MSDB NF +0/-QNaN/+0"        FFF8B000 00000000 FFF8B000 00000000
+r 7E80.10
+*Want "MSDBR NF +0/-QNaN/+2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 7E90.10
+*Want "MSDB NF +0/-QNaN/+2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 7EA0.10
+*Want "MSDBR NF +0/-QNaN/+inf"     FFF8B000 00000000 FFF8B000 00000000
+r 7EB0.10
+*Want "MSDB NF +0/-QNaN/+inf"      FFF8B000 00000000 FFF8B000 00000000
+r 7EC0.10
+*Want "MSDBR NF +0/-QNaN/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 7ED0.10
+*Want "MSDB NF +0/-QNaN/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 7EE0.10
+*Want "MSDBR NF +0/-QNaN/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 7EF0.10
+*Want "MSDB NF +0/-QNaN/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 7F00.10
+*Want "MSDBR NF +0/+SNaN/-inf"     7FF8A000 00000000 FFF00000 00000000
+r 7F10.10
+*Want "MSDB NF +0/+SNaN/-inf"      7FF8A000 00000000 FFF00000 00000000
+r 7F20.10
+*Want "MSDBR NF +0/+SNaN/-2.0"     7FF8A000 00000000 C0000000 00000000
+r 7F30.10
+*Want "MSDB NF +0/+SNaN/-2.0"      7FF8A000 00000000 C0000000 00000000
+r 7F40.10
+*Want "MSDBR NF +0/+SNaN/-0"       7FF8A000 00000000 80000000 00000000
+r 7F50.10
+*Want "MSDB NF +0/+SNaN/-0"        7FF8A000 00000000 80000000 00000000
+r 7F60.10
+*Want "MSDBR NF +0/+SNaN/+0"       7FF8A000 00000000 00000000 00000000
+r 7F70.10
+*Want "MSDB NF +0/+SNaN/+0"        7FF8A000 00000000 00000000 00000000
+r 7F80.10
+*Want "MSDBR NF +0/+SNaN/+2.0"     7FF8A000 00000000 40000000 00000000
+r 7F90.10
+*Want "MSDB NF +0/+SNaN/+2.0"      7FF8A000 00000000 40000000 00000000
+r 7FA0.10
+*Want "MSDBR NF +0/+SNaN/+inf"     7FF8A000 00000000 7FF00000 00000000
+r 7FB0.10
+*Want "MSDB NF +0/+SNaN/+inf"      7FF8A000 00000000 7FF00000 00000000
+r 7FC0.10
+*Want "MSDBR NF +0/+SNaN/-QNaN"    7FF8A000 00000000 FFF8B000 00000000
+r 7FD0.10
+*Want "MSDB NF +0/+SNaN/-QNaN"     7FF8A000 00000000 FFF8B000 00000000
+r 7FE0.10
+*Want "MSDBR NF +0/+SNaN/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 7FF0.10
+*Want "MSDB NF +0/+SNaN/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 8000.10
+*Want "MSDBR NF +2.0/-inf/-inf"    7FF80000 00000000 FFF00000 00000000
+r 8010.10
+*Want "MSDB NF +2.0/-inf/-inf"     7FF80000 00000000 FFF00000 00000000
+r 8020.10
+*Want "MSDBR NF +2.0/-inf/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 8030.10
+*Want "MSDB NF +2.0/-inf/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 8040.10
+*Want "MSDBR NF +2.0/-inf/-0"      FFF00000 00000000 FFF00000 00000000
+r 8050.10
+*Want "MSDB NF +2.0/-inf/-0"       FFF00000 00000000 FFF00000 00000000
+r 8060.10
+*Want "MSDBR NF +2.0/-inf/+0"      FFF00000 00000000 FFF00000 00000000
+r 8070.10
+*Want "MSDB NF +2.0/-inf/+0"       FFF00000 00000000 FFF00000 00000000
+r 8080.10
+*Want "MSDBR NF +2.0/-inf/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 8090.10
+*Want "MSDB NF +2.0/-inf/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 80A0.10
+*Want "MSDBR NF +2.0/-inf/+inf"    FFF00000 00000000 FFF00000 00000000
+r 80B0.10
+*Want "MSDB NF +2.0/-inf/+inf"     FFF00000 00000000 FFF00000 00000000
+r 80C0.10
+*Want "MSDBR NF +2.0/-inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 80D0.10
+*Want "MSDB NF +2.0/-inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 80E0.10
+*Want "MSDBR NF +2.0/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 80F0.10
+*Want "MSDB NF +2.0/-inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8100.10
+*Want "MSDBR NF +2.0/-2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 8110.10
+*Want "MSDB NF +2.0/-2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 8120.10
+*Want "MSDBR NF +2.0/-2.0/-2.0"    C0000000 00000000 C0000000 00000000
+r 8130.10
+*Want "MSDB NF +2.0/-2.0/-2.0"     C0000000 00000000 C0000000 00000000
+r 8140.10
+*Want "MSDBR NF +2.0/-2.0/-0"      C0100000 00000000 C0100000 00000000
+r 8150.10
+*Want "MSDB NF +2.0/-2.0/-0"       C0100000 00000000 C0100000 00000000
+r 8160.10
+*Want "MSDBR NF +2.0/-2.0/+0"      C0100000 00000000 C0100000 00000000
+r 8170.10
+*Want "MSDB NF +2.0/-2.0/+0"       C0100000 00000000 C0100000 00000000
+r 8180.10
+*Want "MSDBR NF +2.0/-2.0/+2.0"    C0180000 00000000 C0180000 00000000
+r 8190.10
+*Want "MSDB NF +2.0/-2.0/+2.0"     C0180000 00000000 C0180000 00000000
+r 81A0.10
+*Want "MSDBR NF +2.0/-2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 81B0.10
+*Want "MSDB NF +2.0/-2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 81C0.10
+*Want "MSDBR NF +2.0/-2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 81D0.10
+*Want "MSDB NF +2.0/-2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 81E0.10
+*Want "MSDBR NF +2.0/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 81F0.10
+*Want "MSDB NF +2.0/-2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8200.10
+*Want "MSDBR NF +2.0/-0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 8210.10
+*Want "MSDB NF +2.0/-0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 8220.10
+*Want "MSDBR NF +2.0/-0/-2.0"      40000000 00000000 40000000 00000000
+r 8230.10
+*Want "MSDB NF +2.0/-0/-2.0"       40000000 00000000 40000000 00000000
+r 8240.10
+*Want "MSDBR NF +2.0/-0/-0"        00000000 00000000 00000000 00000000
+r 8250.10
+*Want "MSDB NF +2.0/-0/-0"         00000000 00000000 00000000 00000000
+r 8260.10
+*Want "MSDBR NF +2.0/-0/+0"        80000000 00000000 80000000 00000000
+r 8270.10
+*Want "MSDB NF +2.0/-0/+0"         80000000 00000000 80000000 00000000
+r 8280.10
+*Want "MSDBR NF +2.0/-0/+2.0"      C0000000 00000000 C0000000 00000000
+r 8290.10
+*Want "MSDB NF +2.0/-0/+2.0"       C0000000 00000000 C0000000 00000000
+r 82A0.10
+*Want "MSDBR NF +2.0/-0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 82B0.10
+*Want "MSDB NF +2.0/-0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 82C0.10
+*Want "MSDBR NF +2.0/-0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 82D0.10
+*Want "MSDB NF +2.0/-0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 82E0.10
+*Want "MSDBR NF +2.0/-0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 82F0.10
+*Want "MSDB NF +2.0/-0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 8300.10
+*Want "MSDBR NF +2.0/+0/-inf"      7FF00000 00000000 7FF00000 00000000
+r 8310.10
+*Want "MSDB NF +2.0/+0/-inf"       7FF00000 00000000 7FF00000 00000000
+r 8320.10
+*Want "MSDBR NF +2.0/+0/-2.0"      40000000 00000000 40000000 00000000
+r 8330.10
+*Want "MSDB NF +2.0/+0/-2.0"       40000000 00000000 40000000 00000000
+r 8340.10
+*Want "MSDBR NF +2.0/+0/-0"        00000000 00000000 00000000 00000000
+r 8350.10
+*Want "MSDB NF +2.0/+0/-0"         00000000 00000000 00000000 00000000
+r 8360.10
+*Want "MSDBR NF +2.0/+0/+0"        00000000 00000000 00000000 00000000
+r 8370.10
+*Want "MSDB NF +2.0/+0/+0"         00000000 00000000 00000000 00000000
+r 8380.10
+*Want "MSDBR NF +2.0/+0/+2.0"      C0000000 00000000 C0000000 00000000
+r 8390.10
+*Want "MSDB NF +2.0/+0/+2.0"       C0000000 00000000 C0000000 00000000
+r 83A0.10
+*Want "MSDBR NF +2.0/+0/+inf"      FFF00000 00000000 FFF00000 00000000
+r 83B0.10
+*Want "MSDB NF +2.0/+0/+inf"       FFF00000 00000000 FFF00000 00000000
+r 83C0.10
+*Want "MSDBR NF +2.0/+0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 83D0.10
+*Want "MSDB NF +2.0/+0/-QNaN"      FFF8B000 00000000 FFF8B000 00000000
+r 83E0.10
+*Want "MSDBR NF +2.0/+0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 83F0.10
+*Want "MSDB NF +2.0/+0/+SNaN"      7FF8A000 00000000 7FF0A000 00000000
+r 8400.10
+*Want "MSDBR NF +2.0/+2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 8410.10
+*Want "MSDB NF +2.0/+2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 8420.10
+*Want "MSDBR NF +2.0/+2.0/-2.0"    40180000 00000000 40180000 00000000
+r 8430.10
+*Want "MSDB NF +2.0/+2.0/-2.0"     40180000 00000000 40180000 00000000
+r 8440.10
+*Want "MSDBR NF +2.0/+2.0/-0"      40100000 00000000 40100000 00000000
+r 8450.10
+*Want "MSDB NF +2.0/+2.0/-0"       40100000 00000000 40100000 00000000
+r 8460.10
+*Want "MSDBR NF +2.0/+2.0/+0"      40100000 00000000 40100000 00000000
+r 8470.10
+*Want "MSDB NF +2.0/+2.0/+0"       40100000 00000000 40100000 00000000
+r 8480.10
+*Want "MSDBR NF +2.0/+2.0/+2.0"    40000000 00000000 40000000 00000000
+r 8490.10
+*Want "MSDB NF +2.0/+2.0/+2.0"     40000000 00000000 40000000 00000000
+r 84A0.10
+*Want "MSDBR NF +2.0/+2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 84B0.10
+*Want "MSDB NF +2.0/+2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 84C0.10
+*Want "MSDBR NF +2.0/+2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 84D0.10
+*Want "MSDB NF +2.0/+2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 84E0.10
+*Want "MSDBR NF +2.0/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 84F0.10
+*Want "MSDB NF +2.0/+2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8500.10
+*Want "MSDBR NF +2.0/+inf/-inf"    7FF00000 00000000 7FF00000 00000000
+r 8510.10
+*Want "MSDB NF +2.0/+inf/-inf"     7FF00000 00000000 7FF00000 00000000
+r 8520.10
+*Want "MSDBR NF +2.0/+inf/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 8530.10
+*Want "MSDB NF +2.0/+inf/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 8540.10
+*Want "MSDBR NF +2.0/+inf/-0"      7FF00000 00000000 7FF00000 00000000
+r 8550.10
+*Want "MSDB NF +2.0/+inf/-0"       7FF00000 00000000 7FF00000 00000000
+r 8560.10
+*Want "MSDBR NF +2.0/+inf/+0"      7FF00000 00000000 7FF00000 00000000
+r 8570.10
+*Want "MSDB NF +2.0/+inf/+0"       7FF00000 00000000 7FF00000 00000000
+r 8580.10
+*Want "MSDBR NF +2.0/+inf/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 8590.10
+*Want "MSDB NF +2.0/+inf/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 85A0.10
+*Want "MSDBR NF +2.0/+inf/+inf"    7FF80000 00000000 7FF00000 00000000
+r 85B0.10
+*Want "MSDB NF +2.0/+inf/+inf"     7FF80000 00000000 7FF00000 00000000
+r 85C0.10
+*Want "MSDBR NF +2.0/+inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 85D0.10
+*Want "MSDB NF +2.0/+inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 85E0.10
+*Want "MSDBR NF +2.0/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 85F0.10
+*Want "MSDB NF +2.0/+inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8600.10
+*Want "MSDBR NF +2.0/-QNaN/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 8610.10
+*Want "MSDB NF +2.0/-QNaN/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 8620.10
+*Want "MSDBR NF +2.0/-QNaN/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 8630.10
+*Want "MSDB NF +2.0/-QNaN/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 8640.10
+*Want "MSDBR NF +2.0/-QNaN/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 8650.10
+*Want "MSDB NF +2.0/-QNaN/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 8660.10
+*Want "MSDBR NF +2.0/-QNaN/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 8670.10
+*Want "MSDB NF +2.0/-QNaN/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 8680.10
+*Want "MSDBR NF +2.0/-QNaN/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 8690.10
+*Want "MSDB NF +2.0/-QNaN/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 86A0.10
+*Want "MSDBR NF +2.0/-QNaN/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 86B0.10
+*Want "MSDB NF +2.0/-QNaN/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 86C0.10
+*Want "MSDBR NF +2.0/-QNaN/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 86D0.10
+*Want "MSDB NF +2.0/-QNaN/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 86E0.10
+*Want "MSDBR NF +2.0/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 86F0.10
+*Want "MSDB NF +2.0/-QNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 8700.10
+*Want "MSDBR NF +2.0/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 8710.10
+*Want "MSDB NF +2.0/+SNaN/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 8720.10
+*Want "MSDBR NF +2.0/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 8730.10
+*Want "MSDB NF +2.0/+SNaN/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 8740.10
+*Want "MSDBR NF +2.0/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 8750.10
+*Want "MSDB NF +2.0/+SNaN/-0"      7FF8A000 00000000 80000000 00000000
+r 8760.10
+*Want "MSDBR NF +2.0/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 8770.10
+*Want "MSDB NF +2.0/+SNaN/+0"      7FF8A000 00000000 00000000 00000000
+r 8780.10
+*Want "MSDBR NF +2.0/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 8790.10
+*Want "MSDB NF +2.0/+SNaN/+2.0"    7FF8A000 00000000 40000000 00000000
+r 87A0.10
+*Want "MSDBR NF +2.0/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 87B0.10
+*Want "MSDB NF +2.0/+SNaN/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 87C0.10
+*Want "MSDBR NF +2.0/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 87D0.10
+*Want "MSDB NF +2.0/+SNaN/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 87E0.10
+*Want "MSDBR NF +2.0/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 87F0.10
+*Want "MSDB NF +2.0/+SNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 8800.10
+*Want "MSDBR NF +inf/-inf/-inf"    7FF80000 00000000 FFF00000 00000000
+r 8810.10
+*Want "MSDB NF +inf/-inf/-inf"     7FF80000 00000000 FFF00000 00000000
+r 8820.10
+*Want "MSDBR NF +inf/-inf/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 8830.10
+*Want "MSDB NF +inf/-inf/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 8840.10
+*Want "MSDBR NF +inf/-inf/-0"      FFF00000 00000000 FFF00000 00000000
+r 8850.10
+*Want "MSDB NF +inf/-inf/-0"       FFF00000 00000000 FFF00000 00000000
+r 8860.10
+*Want "MSDBR NF +inf/-inf/+0"      FFF00000 00000000 FFF00000 00000000
+r 8870.10
+*Want "MSDB NF +inf/-inf/+0"       FFF00000 00000000 FFF00000 00000000
+r 8880.10
+*Want "MSDBR NF +inf/-inf/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 8890.10
+*Want "MSDB NF +inf/-inf/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 88A0.10
+*Want "MSDBR NF +inf/-inf/+inf"    FFF00000 00000000 FFF00000 00000000
+r 88B0.10
+*Want "MSDB NF +inf/-inf/+inf"     FFF00000 00000000 FFF00000 00000000
+r 88C0.10
+*Want "MSDBR NF +inf/-inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 88D0.10
+*Want "MSDB NF +inf/-inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 88E0.10
+*Want "MSDBR NF +inf/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 88F0.10
+*Want "MSDB NF +inf/-inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8900.10
+*Want "MSDBR NF +inf/-2.0/-inf"    7FF80000 00000000 FFF00000 00000000
+r 8910.10
+*Want "MSDB NF +inf/-2.0/-inf"     7FF80000 00000000 FFF00000 00000000
+r 8920.10
+*Want "MSDBR NF +inf/-2.0/-2.0"    FFF00000 00000000 FFF00000 00000000
+r 8930.10
+*Want "MSDB NF +inf/-2.0/-2.0"     FFF00000 00000000 FFF00000 00000000
+r 8940.10
+*Want "MSDBR NF +inf/-2.0/-0"      FFF00000 00000000 FFF00000 00000000
+r 8950.10
+*Want "MSDB NF +inf/-2.0/-0"       FFF00000 00000000 FFF00000 00000000
+r 8960.10
+*Want "MSDBR NF +inf/-2.0/+0"      FFF00000 00000000 FFF00000 00000000
+r 8970.10
+*Want "MSDB NF +inf/-2.0/+0"       FFF00000 00000000 FFF00000 00000000
+r 8980.10
+*Want "MSDBR NF +inf/-2.0/+2.0"    FFF00000 00000000 FFF00000 00000000
+r 8990.10
+*Want "MSDB NF +inf/-2.0/+2.0"     FFF00000 00000000 FFF00000 00000000
+r 89A0.10
+*Want "MSDBR NF +inf/-2.0/+inf"    FFF00000 00000000 FFF00000 00000000
+r 89B0.10
+*Want "MSDB NF +inf/-2.0/+inf"     FFF00000 00000000 FFF00000 00000000
+r 89C0.10
+*Want "MSDBR NF +inf/-2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 89D0.10
+*Want "MSDB NF +inf/-2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 89E0.10
+*Want "MSDBR NF +inf/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 89F0.10
+*Want "MSDB NF +inf/-2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8A00.10
+*Want "MSDBR NF +inf/-0/-inf"      7FF80000 00000000 FFF00000 00000000
+r 8A10.10
+*Want "MSDB NF +inf/-0/-inf"       7FF80000 00000000 FFF00000 00000000
+r 8A20.10
+*Want "MSDBR NF +inf/-0/-2.0"      7FF80000 00000000 C0000000 00000000
+r 8A30.10
+*Want "MSDB NF +inf/-0/-2.0"       7FF80000 00000000 C0000000 00000000
+r 8A40.10
+*Want "MSDBR NF +inf/-0/-0"        7FF80000 00000000 80000000 00000000
+r 8A50.10
+*Want "MSDB NF +inf/-0/-0"         7FF80000 00000000 80000000 00000000
+r 8A60.10
+*Want "MSDBR NF +inf/-0/+0"        7FF80000 00000000 00000000 00000000
+r 8A70.10
+*Want "MSDB NF +inf/-0/+0"         7FF80000 00000000 00000000 00000000
+r 8A80.10
+*Want "MSDBR NF +inf/-0/+2.0"      7FF80000 00000000 40000000 00000000
+r 8A90.10
+*Want "MSDB NF +inf/-0/+2.0"       7FF80000 00000000 40000000 00000000
+r 8AA0.10
+*Want "MSDBR NF +inf/-0/+inf"      7FF80000 00000000 7FF00000 00000000
+r 8AB0.10
+*Want "MSDB NF +inf/-0/+inf"       7FF80000 00000000 7FF00000 00000000
+r 8AC0.10
+*Want "MSDBR NF +inf/-0/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 8AD0.10
+*Want "MSDB NF +inf/-0/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 8AE0.10
+*Want "MSDBR NF +inf/-0/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 8AF0.10
+*Want "MSDB NF +inf/-0/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 8B00.10
+*Want "MSDBR NF +inf/+0/-inf"      7FF80000 00000000 FFF00000 00000000
+r 8B10.10
+*Want "MSDB NF +inf/+0/-inf"       7FF80000 00000000 FFF00000 00000000
+r 8B20.10
+*Want "MSDBR NF +inf/+0/-2.0"      7FF80000 00000000 C0000000 00000000
+r 8B30.10
+*Want "MSDB NF +inf/+0/-2.0"       7FF80000 00000000 C0000000 00000000
+r 8B40.10
+*Want "MSDBR NF +inf/+0/-0"        7FF80000 00000000 80000000 00000000
+r 8B50.10
+*Want "MSDB NF +inf/+0/-0"         7FF80000 00000000 80000000 00000000
+r 8B60.10
+*Want "MSDBR NF +inf/+0/+0"        7FF80000 00000000 00000000 00000000
+r 8B70.10
+*Want "MSDB NF +inf/+0/+0"         7FF80000 00000000 00000000 00000000
+r 8B80.10
+*Want "MSDBR NF +inf/+0/+2.0"      7FF80000 00000000 40000000 00000000
+r 8B90.10
+*Want "MSDB NF +inf/+0/+2.0"       7FF80000 00000000 40000000 00000000
+r 8BA0.10
+*Want "MSDBR NF +inf/+0/+inf"      7FF80000 00000000 7FF00000 00000000
+r 8BB0.10
+*Want "MSDB NF +inf/+0/+inf"       7FF80000 00000000 7FF00000 00000000
+r 8BC0.10
+*Want "MSDBR NF +inf/+0/-QNaN"     7FF80000 00000000 FFF8B000 00000000
+r 8BD0.10
+*Want "MSDB NF +inf/+0/-QNaN"      7FF80000 00000000 FFF8B000 00000000
+r 8BE0.10
+*Want "MSDBR NF +inf/+0/+SNaN"     7FF80000 00000000 7FF0A000 00000000
+r 8BF0.10
+*Want "MSDB NF +inf/+0/+SNaN"      7FF80000 00000000 7FF0A000 00000000
+r 8C00.10
+*Want "MSDBR NF +inf/+2.0/-inf"    7FF00000 00000000 7FF00000 00000000
+r 8C10.10
+*Want "MSDB NF +inf/+2.0/-inf"     7FF00000 00000000 7FF00000 00000000
+r 8C20.10
+*Want "MSDBR NF +inf/+2.0/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 8C30.10
+*Want "MSDB NF +inf/+2.0/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 8C40.10
+*Want "MSDBR NF +inf/+2.0/-0"      7FF00000 00000000 7FF00000 00000000
+r 8C50.10
+*Want "MSDB NF +inf/+2.0/-0"       7FF00000 00000000 7FF00000 00000000
+r 8C60.10
+*Want "MSDBR NF +inf/+2.0/+0"      7FF00000 00000000 7FF00000 00000000
+r 8C70.10
+*Want "MSDB NF +inf/+2.0/+0"       7FF00000 00000000 7FF00000 00000000
+r 8C80.10
+*Want "MSDBR NF +inf/+2.0/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 8C90.10
+*Want "MSDB NF +inf/+2.0/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 8CA0.10
+*Want "MSDBR NF +inf/+2.0/+inf"    7FF80000 00000000 7FF00000 00000000
+r 8CB0.10
+*Want "MSDB NF +inf/+2.0/+inf"     7FF80000 00000000 7FF00000 00000000
+r 8CC0.10
+*Want "MSDBR NF +inf/+2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 8CD0.10
+*Want "MSDB NF +inf/+2.0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 8CE0.10
+*Want "MSDBR NF +inf/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 8CF0.10
+*Want "MSDB NF +inf/+2.0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8D00.10
+*Want "MSDBR NF +inf/+inf/-inf"    7FF00000 00000000 7FF00000 00000000
+r 8D10.10
+*Want "MSDB NF +inf/+inf/-inf"     7FF00000 00000000 7FF00000 00000000
+r 8D20.10
+*Want "MSDBR NF +inf/+inf/-2.0"    7FF00000 00000000 7FF00000 00000000
+r 8D30.10
+*Want "MSDB NF +inf/+inf/-2.0"     7FF00000 00000000 7FF00000 00000000
+r 8D40.10
+*Want "MSDBR NF +inf/+inf/-0"      7FF00000 00000000 7FF00000 00000000
+r 8D50.10
+*Want "MSDB NF +inf/+inf/-0"       7FF00000 00000000 7FF00000 00000000
+r 8D60.10
+*Want "MSDBR NF +inf/+inf/+0"      7FF00000 00000000 7FF00000 00000000
+r 8D70.10
+*Want "MSDB NF +inf/+inf/+0"       7FF00000 00000000 7FF00000 00000000
+r 8D80.10
+*Want "MSDBR NF +inf/+inf/+2.0"    7FF00000 00000000 7FF00000 00000000
+r 8D90.10
+*Want "MSDB NF +inf/+inf/+2.0"     7FF00000 00000000 7FF00000 00000000
+r 8DA0.10
+*Want "MSDBR NF +inf/+inf/+inf"    7FF80000 00000000 7FF00000 00000000
+r 8DB0.10
+*Want "MSDB NF +inf/+inf/+inf"     7FF80000 00000000 7FF00000 00000000
+r 8DC0.10
+*Want "MSDBR NF +inf/+inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 8DD0.10
+*Want "MSDB NF +inf/+inf/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 8DE0.10
+*Want "MSDBR NF +inf/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 8DF0.10
+*Want "MSDB NF +inf/+inf/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 8E00.10
+*Want "MSDBR NF +inf/-QNaN/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 8E10.10
+*Want "MSDB NF +inf/-QNaN/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 8E20.10
+*Want "MSDBR NF +inf/-QNaN/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 8E30.10
+*Want "MSDB NF +inf/-QNaN/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 8E40.10
+*Want "MSDBR NF +inf/-QNaN/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 8E50.10
+*Want "MSDB NF +inf/-QNaN/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 8E60.10
+*Want "MSDBR NF +inf/-QNaN/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 8E70.10
+*Want "MSDB NF +inf/-QNaN/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 8E80.10
+*Want "MSDBR NF +inf/-QNaN/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 8E90.10
+*Want "MSDB NF +inf/-QNaN/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 8EA0.10
+*Want "MSDBR NF +inf/-QNaN/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 8EB0.10
+*Want "MSDB NF +inf/-QNaN/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 8EC0.10
+*Want "MSDBR NF +inf/-QNaN/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 8ED0.10
+*Want "MSDB NF +inf/-QNaN/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 8EE0.10
+*Want "MSDBR NF +inf/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 8EF0.10
+*Want "MSDB NF +inf/-QNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 8F00.10
+*Want "MSDBR NF +inf/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 8F10.10
+*Want "MSDB NF +inf/+SNaN/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 8F20.10
+*Want "MSDBR NF +inf/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 8F30.10
+*Want "MSDB NF +inf/+SNaN/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 8F40.10
+*Want "MSDBR NF +inf/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 8F50.10
+*Want "MSDB NF +inf/+SNaN/-0"      7FF8A000 00000000 80000000 00000000
+r 8F60.10
+*Want "MSDBR NF +inf/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 8F70.10
+*Want "MSDB NF +inf/+SNaN/+0"      7FF8A000 00000000 00000000 00000000
+r 8F80.10
+*Want "MSDBR NF +inf/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 8F90.10
+*Want "MSDB NF +inf/+SNaN/+2.0"    7FF8A000 00000000 40000000 00000000
+r 8FA0.10
+*Want "MSDBR NF +inf/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 8FB0.10
+*Want "MSDB NF +inf/+SNaN/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 8FC0.10
+*Want "MSDBR NF +inf/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 8FD0.10
+*Want "MSDB NF +inf/+SNaN/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 8FE0.10
+*Want "MSDBR NF +inf/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 8FF0.10
+*Want "MSDB NF +inf/+SNaN/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9000.10
+*Want "MSDBR NF -QNaN/-inf/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 9010.10
+*Want "MSDB NF -QNaN/-inf/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 9020.10
+*Want "MSDBR NF -QNaN/-inf/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9030.10
+*Want "MSDB NF -QNaN/-inf/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 9040.10
+*Want "MSDBR NF -QNaN/-inf/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 9050.10
+*Want "MSDB NF -QNaN/-inf/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 9060.10
+*Want "MSDBR NF -QNaN/-inf/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 9070.10
+*Want "MSDB NF -QNaN/-inf/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 9080.10
+*Want "MSDBR NF -QNaN/-inf/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9090.10
+*Want "MSDB NF -QNaN/-inf/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 90A0.10
+*Want "MSDBR NF -QNaN/-inf/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 90B0.10
+*Want "MSDB NF -QNaN/-inf/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 90C0.10
+*Want "MSDBR NF -QNaN/-inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 90D0.10
+*Want "MSDB NF -QNaN/-inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 90E0.10
+*Want "MSDBR NF -QNaN/-inf/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 90F0.10
+*Want "MSDB NF -QNaN/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9100.10
+*Want "MSDBR NF -QNaN/-2.0/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 9110.10
+*Want "MSDB NF -QNaN/-2.0/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 9120.10
+*Want "MSDBR NF -QNaN/-2.0/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9130.10
+*Want "MSDB NF -QNaN/-2.0/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 9140.10
+*Want "MSDBR NF -QNaN/-2.0/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 9150.10
+*Want "MSDB NF -QNaN/-2.0/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 9160.10
+*Want "MSDBR NF -QNaN/-2.0/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 9170.10
+*Want "MSDB NF -QNaN/-2.0/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 9180.10
+*Want "MSDBR NF -QNaN/-2.0/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9190.10
+*Want "MSDB NF -QNaN/-2.0/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 91A0.10
+*Want "MSDBR NF -QNaN/-2.0/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 91B0.10
+*Want "MSDB NF -QNaN/-2.0/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 91C0.10
+*Want "MSDBR NF -QNaN/-2.0/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 91D0.10
+*Want "MSDB NF -QNaN/-2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 91E0.10
+*Want "MSDBR NF -QNaN/-2.0/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 91F0.10
+*Want "MSDB NF -QNaN/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9200.10
+*Want "MSDBR NF -QNaN/-0/-inf"     FFF8B000 00000000 FFF8B000 00000000
+r 9210.10
+*Want "MSDB NF -QNaN/-0/-inf"      FFF8B000 00000000 FFF8B000 00000000
+r 9220.10
+*Want "MSDBR NF -QNaN/-0/-2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 9230.10
+*Want "MSDB NF -QNaN/-0/-2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 9240.10
+*Want "MSDBR NF -QNaN/-0/-0"       FFF8B000 00000000 FFF8B000 00000000
+r 9250.10
+*Want "MSDB NF -QNaN/-0/-0"        FFF8B000 00000000 FFF8B000 00000000
+r 9260.10
+*Want "MSDBR NF -QNaN/-0/+0"       FFF8B000 00000000 FFF8B000 00000000
+r 9270.10
+*Want "MSDB NF -QNaN/-0/+0"        FFF8B000 00000000 FFF8B000 00000000
+r 9280.10
+*Want "MSDBR NF -QNaN/-0/+2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 9290.10
+*Want "MSDB NF -QNaN/-0/+2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 92A0.10
+*Want "MSDBR NF -QNaN/-0/+inf"     FFF8B000 00000000 FFF8B000 00000000
+r 92B0.10
+*Want "MSDB NF -QNaN/-0/+inf"      FFF8B000 00000000 FFF8B000 00000000
+r 92C0.10
+*Want "MSDBR NF -QNaN/-0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 92D0.10
+*Want "MSDB NF -QNaN/-0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 92E0.10
+*Want "MSDBR NF -QNaN/-0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 92F0.10
+*Want "MSDB NF -QNaN/-0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 9300.10
+*Want "MSDBR NF -QNaN/+0/-inf"     FFF8B000 00000000 FFF8B000 00000000
+r 9310.10
+*Want "MSDB NF -QNaN/+0/-inf"      FFF8B000 00000000 FFF8B000 00000000
+r 9320.10
+*Want "MSDBR NF -QNaN/+0/-2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 9330.10
+*Want "MSDB NF -QNaN/+0/-2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 9340.10
+*Want "MSDBR NF -QNaN/+0/-0"       FFF8B000 00000000 FFF8B000 00000000
+r 9350.10
+*Want "MSDB NF -QNaN/+0/-0"        FFF8B000 00000000 FFF8B000 00000000
+r 9360.10
+*Want "MSDBR NF -QNaN/+0/+0"       FFF8B000 00000000 FFF8B000 00000000
+r 9370.10
+*Want "MSDB NF -QNaN/+0/+0"        FFF8B000 00000000 FFF8B000 00000000
+r 9380.10
+*Want "MSDBR NF -QNaN/+0/+2.0"     FFF8B000 00000000 FFF8B000 00000000
+r 9390.10
+*Want "MSDB NF -QNaN/+0/+2.0"      FFF8B000 00000000 FFF8B000 00000000
+r 93A0.10
+*Want "MSDBR NF -QNaN/+0/+inf"     FFF8B000 00000000 FFF8B000 00000000
+r 93B0.10
+*Want "MSDB NF -QNaN/+0/+inf"      FFF8B000 00000000 FFF8B000 00000000
+r 93C0.10
+*Want "MSDBR NF -QNaN/+0/-QNaN"    FFF8B000 00000000 FFF8B000 00000000
+r 93D0.10
+*Want "MSDB NF -QNaN/+0/-QNaN"     FFF8B000 00000000 FFF8B000 00000000
+r 93E0.10
+*Want "MSDBR NF -QNaN/+0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 93F0.10
+*Want "MSDB NF -QNaN/+0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 9400.10
+*Want "MSDBR NF -QNaN/+2.0/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 9410.10
+*Want "MSDB NF -QNaN/+2.0/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 9420.10
+*Want "MSDBR NF -QNaN/+2.0/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9430.10
+*Want "MSDB NF -QNaN/+2.0/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 9440.10
+*Want "MSDBR NF -QNaN/+2.0/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 9450.10
+*Want "MSDB NF -QNaN/+2.0/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 9460.10
+*Want "MSDBR NF -QNaN/+2.0/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 9470.10
+*Want "MSDB NF -QNaN/+2.0/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 9480.10
+*Want "MSDBR NF -QNaN/+2.0/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9490.10
+*Want "MSDB NF -QNaN/+2.0/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 94A0.10
+*Want "MSDBR NF -QNaN/+2.0/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 94B0.10
+*Want "MSDB NF -QNaN/+2.0/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 94C0.10
+*Want "MSDBR NF -QNaN/+2.0/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 94D0.10
+*Want "MSDB NF -QNaN/+2.0/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 94E0.10
+*Want "MSDBR NF -QNaN/+2.0/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 94F0.10
+*Want "MSDB NF -QNaN/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9500.10
+*Want "MSDBR NF -QNaN/+inf/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 9510.10
+*Want "MSDB NF -QNaN/+inf/-inf"    FFF8B000 00000000 FFF8B000 00000000
+r 9520.10
+*Want "MSDBR NF -QNaN/+inf/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9530.10
+*Want "MSDB NF -QNaN/+inf/-2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 9540.10
+*Want "MSDBR NF -QNaN/+inf/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 9550.10
+*Want "MSDB NF -QNaN/+inf/-0"      FFF8B000 00000000 FFF8B000 00000000
+r 9560.10
+*Want "MSDBR NF -QNaN/+inf/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 9570.10
+*Want "MSDB NF -QNaN/+inf/+0"      FFF8B000 00000000 FFF8B000 00000000
+r 9580.10
+*Want "MSDBR NF -QNaN/+inf/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9590.10
+*Want "MSDB NF -QNaN/+inf/+2.0"    FFF8B000 00000000 FFF8B000 00000000
+r 95A0.10
+*Want "MSDBR NF -QNaN/+inf/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 95B0.10
+*Want "MSDB NF -QNaN/+inf/+inf"    FFF8B000 00000000 FFF8B000 00000000
+r 95C0.10
+*Want "MSDBR NF -QNaN/+inf/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 95D0.10
+*Want "MSDB NF -QNaN/+inf/-QNaN"   FFF8B000 00000000 FFF8B000 00000000
+r 95E0.10
+*Want "MSDBR NF -QNaN/+inf/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 95F0.10
+*Want "MSDB NF -QNaN/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9600.10
+*Want "MSDBR NF -QNaN/-QNaN/-inf"  FFF8B000 00000000 FFF8B000 00000000
+r 9610.10
+*Want "MSDB NF -QNaN/-QNaN/-inf"   FFF8B000 00000000 FFF8B000 00000000
+r 9620.10
+*Want "MSDBR NF -QNaN/-QNaN/-2.0"  FFF8B000 00000000 FFF8B000 00000000
+r 9630.10
+*Want "MSDB NF -QNaN/-QNaN/-2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 9640.10
+*Want "MSDBR NF -QNaN/-QNaN/-0"    FFF8B000 00000000 FFF8B000 00000000
+r 9650.10
+*Want "MSDB NF -QNaN/-QNaN/-0"     FFF8B000 00000000 FFF8B000 00000000
+r 9660.10
+*Want "MSDBR NF -QNaN/-QNaN/+0"    FFF8B000 00000000 FFF8B000 00000000
+r 9670.10
+*Want "MSDB NF -QNaN/-QNaN/+0"     FFF8B000 00000000 FFF8B000 00000000
+r 9680.10
+*Want "MSDBR NF -QNaN/-QNaN/+2.0"  FFF8B000 00000000 FFF8B000 00000000
+r 9690.10
+*Want "MSDB NF -QNaN/-QNaN/+2.0"   FFF8B000 00000000 FFF8B000 00000000
+r 96A0.10
+*Want "MSDBR NF -QNaN/-QNaN/+inf"  FFF8B000 00000000 FFF8B000 00000000
+r 96B0.10
+*Want "MSDB NF -QNaN/-QNaN/+inf"   FFF8B000 00000000 FFF8B000 00000000
+r 96C0.10
+*Want "MSDBR NF -QNaN/-QNaN/-QNaN" FFF8B000 00000000 FFF8B000 00000000
+r 96D0.10
+*Want "MSDB NF -QNaN/-QNaN/-QNaN"  FFF8B000 00000000 FFF8B000 00000000
+r 96E0.10
+*Want "MSDBR NF -QNaN/-QNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 96F0.10
+*Want "MSDB NF -QNaN/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 9700.10
+*Want "MSDBR NF -QNaN/+SNaN/-inf"  7FF8A000 00000000 FFF00000 00000000
+r 9710.10
+*Want "MSDB NF -QNaN/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9720.10
+*Want "MSDBR NF -QNaN/+SNaN/-2.0"  7FF8A000 00000000 C0000000 00000000
+r 9730.10
+*Want "MSDB NF -QNaN/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9740.10
+*Want "MSDBR NF -QNaN/+SNaN/-0"    7FF8A000 00000000 80000000 00000000
+r 9750.10
+*Want "MSDB NF -QNaN/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 9760.10
+*Want "MSDBR NF -QNaN/+SNaN/+0"    7FF8A000 00000000 00000000 00000000
+r 9770.10
+*Want "MSDB NF -QNaN/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 9780.10
+*Want "MSDBR NF -QNaN/+SNaN/+2.0"  7FF8A000 00000000 40000000 00000000
+r 9790.10
+*Want "MSDB NF -QNaN/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 97A0.10
+*Want "MSDBR NF -QNaN/+SNaN/+inf"  7FF8A000 00000000 7FF00000 00000000
+r 97B0.10
+*Want "MSDB NF -QNaN/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 97C0.10
+*Want "MSDBR NF -QNaN/+SNaN/-QNaN" 7FF8A000 00000000 FFF8B000 00000000
+r 97D0.10
+*Want "MSDB NF -QNaN/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 97E0.10
+*Want "MSDBR NF -QNaN/+SNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 97F0.10
+*Want "MSDB NF -QNaN/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 9800.10
+*Want "MSDBR NF +SNaN/-inf/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9810.10
+*Want "MSDB NF +SNaN/-inf/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 9820.10
+*Want "MSDBR NF +SNaN/-inf/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9830.10
+*Want "MSDB NF +SNaN/-inf/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 9840.10
+*Want "MSDBR NF +SNaN/-inf/-0"     7FF8A000 00000000 80000000 00000000
+r 9850.10
+*Want "MSDB NF +SNaN/-inf/-0"      7FF8A000 00000000 80000000 00000000
+r 9860.10
+*Want "MSDBR NF +SNaN/-inf/+0"     7FF8A000 00000000 00000000 00000000
+r 9870.10
+*Want "MSDB NF +SNaN/-inf/+0"      7FF8A000 00000000 00000000 00000000
+r 9880.10
+*Want "MSDBR NF +SNaN/-inf/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9890.10
+*Want "MSDB NF +SNaN/-inf/+2.0"    7FF8A000 00000000 40000000 00000000
+r 98A0.10
+*Want "MSDBR NF +SNaN/-inf/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 98B0.10
+*Want "MSDB NF +SNaN/-inf/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 98C0.10
+*Want "MSDBR NF +SNaN/-inf/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 98D0.10
+*Want "MSDB NF +SNaN/-inf/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 98E0.10
+*Want "MSDBR NF +SNaN/-inf/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 98F0.10
+*Want "MSDB NF +SNaN/-inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9900.10
+*Want "MSDBR NF +SNaN/-2.0/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9910.10
+*Want "MSDB NF +SNaN/-2.0/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 9920.10
+*Want "MSDBR NF +SNaN/-2.0/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9930.10
+*Want "MSDB NF +SNaN/-2.0/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 9940.10
+*Want "MSDBR NF +SNaN/-2.0/-0"     7FF8A000 00000000 80000000 00000000
+r 9950.10
+*Want "MSDB NF +SNaN/-2.0/-0"      7FF8A000 00000000 80000000 00000000
+r 9960.10
+*Want "MSDBR NF +SNaN/-2.0/+0"     7FF8A000 00000000 00000000 00000000
+r 9970.10
+*Want "MSDB NF +SNaN/-2.0/+0"      7FF8A000 00000000 00000000 00000000
+r 9980.10
+*Want "MSDBR NF +SNaN/-2.0/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9990.10
+*Want "MSDB NF +SNaN/-2.0/+2.0"    7FF8A000 00000000 40000000 00000000
+r 99A0.10
+*Want "MSDBR NF +SNaN/-2.0/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 99B0.10
+*Want "MSDB NF +SNaN/-2.0/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 99C0.10
+*Want "MSDBR NF +SNaN/-2.0/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 99D0.10
+*Want "MSDB NF +SNaN/-2.0/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 99E0.10
+*Want "MSDBR NF +SNaN/-2.0/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 99F0.10
+*Want "MSDB NF +SNaN/-2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9A00.10
+*Want "MSDBR NF +SNaN/-0/-inf"     7FF8A000 00000000 FFF00000 00000000
+r 9A10.10
+*Want "MSDB NF +SNaN/-0/-inf"      7FF8A000 00000000 FFF00000 00000000
+r 9A20.10
+*Want "MSDBR NF +SNaN/-0/-2.0"     7FF8A000 00000000 C0000000 00000000
+r 9A30.10
+*Want "MSDB NF +SNaN/-0/-2.0"      7FF8A000 00000000 C0000000 00000000
+r 9A40.10
+*Want "MSDBR NF +SNaN/-0/-0"       7FF8A000 00000000 80000000 00000000
+r 9A50.10
+*Want "MSDB NF +SNaN/-0/-0"        7FF8A000 00000000 80000000 00000000
+r 9A60.10
+*Want "MSDBR NF +SNaN/-0/+0"       7FF8A000 00000000 00000000 00000000
+r 9A70.10
+*Want "MSDB NF +SNaN/-0/+0"        7FF8A000 00000000 00000000 00000000
+r 9A80.10
+*Want "MSDBR NF +SNaN/-0/+2.0"     7FF8A000 00000000 40000000 00000000
+r 9A90.10
+*Want "MSDB NF +SNaN/-0/+2.0"      7FF8A000 00000000 40000000 00000000
+r 9AA0.10
+*Want "MSDBR NF +SNaN/-0/+inf"     7FF8A000 00000000 7FF00000 00000000
+r 9AB0.10
+*Want "MSDB NF +SNaN/-0/+inf"      7FF8A000 00000000 7FF00000 00000000
+r 9AC0.10
+*Want "MSDBR NF +SNaN/-0/-QNaN"    7FF8A000 00000000 FFF8B000 00000000
+r 9AD0.10
+*Want "MSDB NF +SNaN/-0/-QNaN"     7FF8A000 00000000 FFF8B000 00000000
+r 9AE0.10
+*Want "MSDBR NF +SNaN/-0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 9AF0.10
+*Want "MSDB NF +SNaN/-0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 9B00.10
+*Want "MSDBR NF +SNaN/+0/-inf"     7FF8A000 00000000 FFF00000 00000000
+r 9B10.10
+*Want "MSDB NF +SNaN/+0/-inf"      7FF8A000 00000000 FFF00000 00000000
+r 9B20.10
+*Want "MSDBR NF +SNaN/+0/-2.0"     7FF8A000 00000000 C0000000 00000000
+r 9B30.10
+*Want "MSDB NF +SNaN/+0/-2.0"      7FF8A000 00000000 C0000000 00000000
+r 9B40.10
+*Want "MSDBR NF +SNaN/+0/-0"       7FF8A000 00000000 80000000 00000000
+r 9B50.10
+*Want "MSDB NF +SNaN/+0/-0"        7FF8A000 00000000 80000000 00000000
+r 9B60.10
+*Want "MSDBR NF +SNaN/+0/+0"       7FF8A000 00000000 00000000 00000000
+r 9B70.10
+*Want "MSDB NF +SNaN/+0/+0"        7FF8A000 00000000 00000000 00000000
+r 9B80.10
+*Want "MSDBR NF +SNaN/+0/+2.0"     7FF8A000 00000000 40000000 00000000
+r 9B90.10
+*Want "MSDB NF +SNaN/+0/+2.0"      7FF8A000 00000000 40000000 00000000
+r 9BA0.10
+*Want "MSDBR NF +SNaN/+0/+inf"     7FF8A000 00000000 7FF00000 00000000
+r 9BB0.10
+*Want "MSDB NF +SNaN/+0/+inf"      7FF8A000 00000000 7FF00000 00000000
+r 9BC0.10
+*Want "MSDBR NF +SNaN/+0/-QNaN"    7FF8A000 00000000 FFF8B000 00000000
+r 9BD0.10
+*Want "MSDB NF +SNaN/+0/-QNaN"     7FF8A000 00000000 FFF8B000 00000000
+r 9BE0.10
+*Want "MSDBR NF +SNaN/+0/+SNaN"    7FF8A000 00000000 7FF0A000 00000000
+r 9BF0.10
+*Want "MSDB NF +SNaN/+0/+SNaN"     7FF8A000 00000000 7FF0A000 00000000
+r 9C00.10
+*Want "MSDBR NF +SNaN/+2.0/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9C10.10
+*Want "MSDB NF +SNaN/+2.0/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 9C20.10
+*Want "MSDBR NF +SNaN/+2.0/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9C30.10
+*Want "MSDB NF +SNaN/+2.0/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 9C40.10
+*Want "MSDBR NF +SNaN/+2.0/-0"     7FF8A000 00000000 80000000 00000000
+r 9C50.10
+*Want "MSDB NF +SNaN/+2.0/-0"      7FF8A000 00000000 80000000 00000000
+r 9C60.10
+*Want "MSDBR NF +SNaN/+2.0/+0"     7FF8A000 00000000 00000000 00000000
+r 9C70.10
+*Want "MSDB NF +SNaN/+2.0/+0"      7FF8A000 00000000 00000000 00000000
+r 9C80.10
+*Want "MSDBR NF +SNaN/+2.0/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9C90.10
+*Want "MSDB NF +SNaN/+2.0/+2.0"    7FF8A000 00000000 40000000 00000000
+r 9CA0.10
+*Want "MSDBR NF +SNaN/+2.0/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 9CB0.10
+*Want "MSDB NF +SNaN/+2.0/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 9CC0.10
+*Want "MSDBR NF +SNaN/+2.0/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 9CD0.10
+*Want "MSDB NF +SNaN/+2.0/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 9CE0.10
+*Want "MSDBR NF +SNaN/+2.0/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 9CF0.10
+*Want "MSDB NF +SNaN/+2.0/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9D00.10
+*Want "MSDBR NF +SNaN/+inf/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9D10.10
+*Want "MSDB NF +SNaN/+inf/-inf"    7FF8A000 00000000 FFF00000 00000000
+r 9D20.10
+*Want "MSDBR NF +SNaN/+inf/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9D30.10
+*Want "MSDB NF +SNaN/+inf/-2.0"    7FF8A000 00000000 C0000000 00000000
+r 9D40.10
+*Want "MSDBR NF +SNaN/+inf/-0"     7FF8A000 00000000 80000000 00000000
+r 9D50.10
+*Want "MSDB NF +SNaN/+inf/-0"      7FF8A000 00000000 80000000 00000000
+r 9D60.10
+*Want "MSDBR NF +SNaN/+inf/+0"     7FF8A000 00000000 00000000 00000000
+r 9D70.10
+*Want "MSDB NF +SNaN/+inf/+0"      7FF8A000 00000000 00000000 00000000
+r 9D80.10
+*Want "MSDBR NF +SNaN/+inf/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9D90.10
+*Want "MSDB NF +SNaN/+inf/+2.0"    7FF8A000 00000000 40000000 00000000
+r 9DA0.10
+*Want "MSDBR NF +SNaN/+inf/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 9DB0.10
+*Want "MSDB NF +SNaN/+inf/+inf"    7FF8A000 00000000 7FF00000 00000000
+r 9DC0.10
+*Want "MSDBR NF +SNaN/+inf/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 9DD0.10
+*Want "MSDB NF +SNaN/+inf/-QNaN"   7FF8A000 00000000 FFF8B000 00000000
+r 9DE0.10
+*Want "MSDBR NF +SNaN/+inf/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 9DF0.10
+*Want "MSDB NF +SNaN/+inf/+SNaN"   7FF8A000 00000000 7FF0A000 00000000
+r 9E00.10
+*Want "MSDBR NF +SNaN/-QNaN/-inf"  7FF8A000 00000000 FFF00000 00000000
+r 9E10.10
+*Want "MSDB NF +SNaN/-QNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9E20.10
+*Want "MSDBR NF +SNaN/-QNaN/-2.0"  7FF8A000 00000000 C0000000 00000000
+r 9E30.10
+*Want "MSDB NF +SNaN/-QNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9E40.10
+*Want "MSDBR NF +SNaN/-QNaN/-0"    7FF8A000 00000000 80000000 00000000
+r 9E50.10
+*Want "MSDB NF +SNaN/-QNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 9E60.10
+*Want "MSDBR NF +SNaN/-QNaN/+0"    7FF8A000 00000000 00000000 00000000
+r 9E70.10
+*Want "MSDB NF +SNaN/-QNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 9E80.10
+*Want "MSDBR NF +SNaN/-QNaN/+2.0"  7FF8A000 00000000 40000000 00000000
+r 9E90.10
+*Want "MSDB NF +SNaN/-QNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9EA0.10
+*Want "MSDBR NF +SNaN/-QNaN/+inf"  7FF8A000 00000000 7FF00000 00000000
+r 9EB0.10
+*Want "MSDB NF +SNaN/-QNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 9EC0.10
+*Want "MSDBR NF +SNaN/-QNaN/-QNaN" 7FF8A000 00000000 FFF8B000 00000000
+r 9ED0.10
+*Want "MSDB NF +SNaN/-QNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 9EE0.10
+*Want "MSDBR NF +SNaN/-QNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 9EF0.10
+*Want "MSDB NF +SNaN/-QNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+r 9F00.10
+*Want "MSDBR NF +SNaN/+SNaN/-inf"  7FF8A000 00000000 FFF00000 00000000
+r 9F10.10
+*Want "MSDB NF +SNaN/+SNaN/-inf"   7FF8A000 00000000 FFF00000 00000000
+r 9F20.10
+*Want "MSDBR NF +SNaN/+SNaN/-2.0"  7FF8A000 00000000 C0000000 00000000
+r 9F30.10
+*Want "MSDB NF +SNaN/+SNaN/-2.0"   7FF8A000 00000000 C0000000 00000000
+r 9F40.10
+*Want "MSDBR NF +SNaN/+SNaN/-0"    7FF8A000 00000000 80000000 00000000
+r 9F50.10
+*Want "MSDB NF +SNaN/+SNaN/-0"     7FF8A000 00000000 80000000 00000000
+r 9F60.10
+*Want "MSDBR NF +SNaN/+SNaN/+0"    7FF8A000 00000000 00000000 00000000
+r 9F70.10
+*Want "MSDB NF +SNaN/+SNaN/+0"     7FF8A000 00000000 00000000 00000000
+r 9F80.10
+*Want "MSDBR NF +SNaN/+SNaN/+2.0"  7FF8A000 00000000 40000000 00000000
+r 9F90.10
+*Want "MSDB NF +SNaN/+SNaN/+2.0"   7FF8A000 00000000 40000000 00000000
+r 9FA0.10
+*Want "MSDBR NF +SNaN/+SNaN/+inf"  7FF8A000 00000000 7FF00000 00000000
+r 9FB0.10
+*Want "MSDB NF +SNaN/+SNaN/+inf"   7FF8A000 00000000 7FF00000 00000000
+r 9FC0.10
+*Want "MSDBR NF +SNaN/+SNaN/-QNaN" 7FF8A000 00000000 FFF8B000 00000000
+r 9FD0.10
+*Want "MSDB NF +SNaN/+SNaN/-QNaN"  7FF8A000 00000000 FFF8B000 00000000
+r 9FE0.10
+*Want "MSDBR NF +SNaN/+SNaN/+SNaN" 7FF8A000 00000000 7FF0A000 00000000
+r 9FF0.10
+*Want "MSDB NF +SNaN/+SNaN/+SNaN"  7FF8A000 00000000 7FF0A000 00000000
+
+
+
+
+# Long BFP Multiply And Subtract non-finite results - FPCR contents
+*Compare
+r A000.10
+*Want "MSDBR/MSDB NF -inf/-inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r A010.10
+*Want "MSDBR/MSDB NF -inf/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A020.10
+*Want "MSDBR/MSDB NF -inf/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A030.10
+*Want "MSDBR/MSDB NF -inf/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A040.10
+*Want "MSDBR/MSDB NF -inf/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A050.10
+*Want "MSDBR/MSDB NF -inf/-inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r A060.10
+*Want "MSDBR/MSDB NF -inf/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A070.10
+*Want "MSDBR/MSDB NF -inf/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A080.10
+*Want "MSDBR/MSDB NF -inf/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r A090.10
+*Want "MSDBR/MSDB NF -inf/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A0A0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A0B0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A0C0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A0D0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r A0E0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A0F0.10
+*Want "MSDBR/MSDB NF -inf/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A100.10
+*Want "MSDBR/MSDB NF -inf/-0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r A110.10
+*Want "MSDBR/MSDB NF -inf/-0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A120.10
+*Want "MSDBR/MSDB NF -inf/-0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r A130.10
+*Want "MSDBR/MSDB NF -inf/-0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r A140.10
+*Want "MSDBR/MSDB NF -inf/-0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A150.10
+*Want "MSDBR/MSDB NF -inf/-0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r A160.10
+*Want "MSDBR/MSDB NF -inf/-0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A170.10
+*Want "MSDBR/MSDB NF -inf/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A180.10
+*Want "MSDBR/MSDB NF -inf/+0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r A190.10
+*Want "MSDBR/MSDB NF -inf/+0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A1A0.10
+*Want "MSDBR/MSDB NF -inf/+0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r A1B0.10
+*Want "MSDBR/MSDB NF -inf/+0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r A1C0.10
+*Want "MSDBR/MSDB NF -inf/+0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A1D0.10
+*Want "MSDBR/MSDB NF -inf/+0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r A1E0.10
+*Want "MSDBR/MSDB NF -inf/+0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A1F0.10
+*Want "MSDBR/MSDB NF -inf/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A200.10
+*Want "MSDBR/MSDB NF -inf/+2.0/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r A210.10
+*Want "MSDBR/MSDB NF -inf/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A220.10
+*Want "MSDBR/MSDB NF -inf/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A230.10
+*Want "MSDBR/MSDB NF -inf/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A240.10
+*Want "MSDBR/MSDB NF -inf/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A250.10
+*Want "MSDBR/MSDB NF -inf/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r A260.10
+*Want "MSDBR/MSDB NF -inf/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A270.10
+*Want "MSDBR/MSDB NF -inf/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A280.10
+*Want "MSDBR/MSDB NF -inf/+inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r A290.10
+*Want "MSDBR/MSDB NF -inf/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A2A0.10
+*Want "MSDBR/MSDB NF -inf/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A2B0.10
+*Want "MSDBR/MSDB NF -inf/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A2C0.10
+*Want "MSDBR/MSDB NF -inf/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A2D0.10
+*Want "MSDBR/MSDB NF -inf/+inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r A2E0.10
+*Want "MSDBR/MSDB NF -inf/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A2F0.10
+*Want "MSDBR/MSDB NF -inf/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A300.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r A310.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r A320.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r A330.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r A340.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r A350.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r A360.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r A370.10
+*Want "MSDBR/MSDB NF -inf/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A380.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r A390.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r A3A0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r A3B0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r A3C0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r A3D0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r A3E0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A3F0.10
+*Want "MSDBR/MSDB NF -inf/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A400.10
+*Want "MSDBR/MSDB NF -2.0/-inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r A410.10
+*Want "MSDBR/MSDB NF -2.0/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A420.10
+*Want "MSDBR/MSDB NF -2.0/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A430.10
+*Want "MSDBR/MSDB NF -2.0/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A440.10
+*Want "MSDBR/MSDB NF -2.0/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A450.10
+*Want "MSDBR/MSDB NF -2.0/-inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r A460.10
+*Want "MSDBR/MSDB NF -2.0/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A470.10
+*Want "MSDBR/MSDB NF -2.0/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A480.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r A490.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A4A0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A4B0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A4C0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A4D0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r A4E0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A4F0.10
+*Want "MSDBR/MSDB NF -2.0/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A500.10
+*Want "MSDBR/MSDB NF -2.0/-0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r A510.10
+*Want "MSDBR/MSDB NF -2.0/-0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A520.10
+*Want "MSDBR/MSDB NF -2.0/-0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r A530.10
+*Want "MSDBR/MSDB NF -2.0/-0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r A540.10
+*Want "MSDBR/MSDB NF -2.0/-0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A550.10
+*Want "MSDBR/MSDB NF -2.0/-0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r A560.10
+*Want "MSDBR/MSDB NF -2.0/-0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r A570.10
+*Want "MSDBR/MSDB NF -2.0/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A580.10
+*Want "MSDBR/MSDB NF -2.0/+0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r A590.10
+*Want "MSDBR/MSDB NF -2.0/+0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A5A0.10
+*Want "MSDBR/MSDB NF -2.0/+0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r A5B0.10
+*Want "MSDBR/MSDB NF -2.0/+0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r A5C0.10
+*Want "MSDBR/MSDB NF -2.0/+0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A5D0.10
+*Want "MSDBR/MSDB NF -2.0/+0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r A5E0.10
+*Want "MSDBR/MSDB NF -2.0/+0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r A5F0.10
+*Want "MSDBR/MSDB NF -2.0/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A600.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r A610.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A620.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A630.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A640.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A650.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r A660.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A670.10
+*Want "MSDBR/MSDB NF -2.0/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A680.10
+*Want "MSDBR/MSDB NF -2.0/+inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r A690.10
+*Want "MSDBR/MSDB NF -2.0/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A6A0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r A6B0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r A6C0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r A6D0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r A6E0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r A6F0.10
+*Want "MSDBR/MSDB NF -2.0/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r A700.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r A710.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r A720.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r A730.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r A740.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r A750.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r A760.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r A770.10
+*Want "MSDBR/MSDB NF -2.0/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A780.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r A790.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r A7A0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r A7B0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r A7C0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r A7D0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r A7E0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A7F0.10
+*Want "MSDBR/MSDB NF -2.0/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r A800.10
+*Want "MSDBR/MSDB NF -0/-inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r A810.10
+*Want "MSDBR/MSDB NF -0/-inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A820.10
+*Want "MSDBR/MSDB NF -0/-inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r A830.10
+*Want "MSDBR/MSDB NF -0/-inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r A840.10
+*Want "MSDBR/MSDB NF -0/-inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r A850.10
+*Want "MSDBR/MSDB NF -0/-inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r A860.10
+*Want "MSDBR/MSDB NF -0/-inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A870.10
+*Want "MSDBR/MSDB NF -0/-inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A880.10
+*Want "MSDBR/MSDB NF -0/-2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r A890.10
+*Want "MSDBR/MSDB NF -0/-2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A8A0.10
+*Want "MSDBR/MSDB NF -0/-2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r A8B0.10
+*Want "MSDBR/MSDB NF -0/-2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r A8C0.10
+*Want "MSDBR/MSDB NF -0/-2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r A8D0.10
+*Want "MSDBR/MSDB NF -0/-2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r A8E0.10
+*Want "MSDBR/MSDB NF -0/-2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r A8F0.10
+*Want "MSDBR/MSDB NF -0/-2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r A900.10
+*Want "MSDBR/MSDB NF -0/-0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r A910.10
+*Want "MSDBR/MSDB NF -0/-0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r A920.10
+*Want "MSDBR/MSDB NF -0/-0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r A930.10
+*Want "MSDBR/MSDB NF -0/-0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r A940.10
+*Want "MSDBR/MSDB NF -0/-0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r A950.10
+*Want "MSDBR/MSDB NF -0/-0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r A960.10
+*Want "MSDBR/MSDB NF -0/-0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r A970.10
+*Want "MSDBR/MSDB NF -0/-0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r A980.10
+*Want "MSDBR/MSDB NF -0/+0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r A990.10
+*Want "MSDBR/MSDB NF -0/+0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r A9A0.10
+*Want "MSDBR/MSDB NF -0/+0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r A9B0.10
+*Want "MSDBR/MSDB NF -0/+0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r A9C0.10
+*Want "MSDBR/MSDB NF -0/+0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r A9D0.10
+*Want "MSDBR/MSDB NF -0/+0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r A9E0.10
+*Want "MSDBR/MSDB NF -0/+0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r A9F0.10
+*Want "MSDBR/MSDB NF -0/+0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r AA00.10
+*Want "MSDBR/MSDB NF -0/+2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r AA10.10
+*Want "MSDBR/MSDB NF -0/+2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r AA20.10
+*Want "MSDBR/MSDB NF -0/+2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r AA30.10
+*Want "MSDBR/MSDB NF -0/+2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r AA40.10
+*Want "MSDBR/MSDB NF -0/+2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r AA50.10
+*Want "MSDBR/MSDB NF -0/+2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r AA60.10
+*Want "MSDBR/MSDB NF -0/+2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r AA70.10
+*Want "MSDBR/MSDB NF -0/+2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AA80.10
+*Want "MSDBR/MSDB NF -0/+inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r AA90.10
+*Want "MSDBR/MSDB NF -0/+inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AAA0.10
+*Want "MSDBR/MSDB NF -0/+inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r AAB0.10
+*Want "MSDBR/MSDB NF -0/+inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r AAC0.10
+*Want "MSDBR/MSDB NF -0/+inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AAD0.10
+*Want "MSDBR/MSDB NF -0/+inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r AAE0.10
+*Want "MSDBR/MSDB NF -0/+inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AAF0.10
+*Want "MSDBR/MSDB NF -0/+inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AB00.10
+*Want "MSDBR/MSDB NF -0/-QNaN/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r AB10.10
+*Want "MSDBR/MSDB NF -0/-QNaN/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r AB20.10
+*Want "MSDBR/MSDB NF -0/-QNaN/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r AB30.10
+*Want "MSDBR/MSDB NF -0/-QNaN/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r AB40.10
+*Want "MSDBR/MSDB NF -0/-QNaN/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r AB50.10
+*Want "MSDBR/MSDB NF -0/-QNaN/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r AB60.10
+*Want "MSDBR/MSDB NF -0/-QNaN/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r AB70.10
+*Want "MSDBR/MSDB NF -0/-QNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r AB80.10
+*Want "MSDBR/MSDB NF -0/+SNaN/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r AB90.10
+*Want "MSDBR/MSDB NF -0/+SNaN/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r ABA0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r ABB0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r ABC0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r ABD0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r ABE0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r ABF0.10
+*Want "MSDBR/MSDB NF -0/+SNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r AC00.10
+*Want "MSDBR/MSDB NF +0/-inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r AC10.10
+*Want "MSDBR/MSDB NF +0/-inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AC20.10
+*Want "MSDBR/MSDB NF +0/-inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r AC30.10
+*Want "MSDBR/MSDB NF +0/-inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r AC40.10
+*Want "MSDBR/MSDB NF +0/-inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AC50.10
+*Want "MSDBR/MSDB NF +0/-inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r AC60.10
+*Want "MSDBR/MSDB NF +0/-inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AC70.10
+*Want "MSDBR/MSDB NF +0/-inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AC80.10
+*Want "MSDBR/MSDB NF +0/-2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r AC90.10
+*Want "MSDBR/MSDB NF +0/-2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r ACA0.10
+*Want "MSDBR/MSDB NF +0/-2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r ACB0.10
+*Want "MSDBR/MSDB NF +0/-2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r ACC0.10
+*Want "MSDBR/MSDB NF +0/-2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r ACD0.10
+*Want "MSDBR/MSDB NF +0/-2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r ACE0.10
+*Want "MSDBR/MSDB NF +0/-2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r ACF0.10
+*Want "MSDBR/MSDB NF +0/-2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AD00.10
+*Want "MSDBR/MSDB NF +0/-0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r AD10.10
+*Want "MSDBR/MSDB NF +0/-0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r AD20.10
+*Want "MSDBR/MSDB NF +0/-0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r AD30.10
+*Want "MSDBR/MSDB NF +0/-0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r AD40.10
+*Want "MSDBR/MSDB NF +0/-0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r AD50.10
+*Want "MSDBR/MSDB NF +0/-0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r AD60.10
+*Want "MSDBR/MSDB NF +0/-0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r AD70.10
+*Want "MSDBR/MSDB NF +0/-0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r AD80.10
+*Want "MSDBR/MSDB NF +0/+0/-inf FPCR"        00000000 F8000000 00000000 F8000000
+r AD90.10
+*Want "MSDBR/MSDB NF +0/+0/-2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r ADA0.10
+*Want "MSDBR/MSDB NF +0/+0/-0 FPCR"          00000000 F8000000 00000000 F8000000
+r ADB0.10
+*Want "MSDBR/MSDB NF +0/+0/+0 FPCR"          00000000 F8000000 00000000 F8000000
+r ADC0.10
+*Want "MSDBR/MSDB NF +0/+0/+2.0 FPCR"        00000000 F8000000 00000000 F8000000
+r ADD0.10
+*Want "MSDBR/MSDB NF +0/+0/+inf FPCR"        00000000 F8000000 00000000 F8000000
+r ADE0.10
+*Want "MSDBR/MSDB NF +0/+0/-QNaN FPCR"       00000000 F8000000 00000000 F8000000
+r ADF0.10
+*Want "MSDBR/MSDB NF +0/+0/+SNaN FPCR"       00800000 F8008000 00800000 F8008000
+r AE00.10
+*Want "MSDBR/MSDB NF +0/+2.0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r AE10.10
+*Want "MSDBR/MSDB NF +0/+2.0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r AE20.10
+*Want "MSDBR/MSDB NF +0/+2.0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r AE30.10
+*Want "MSDBR/MSDB NF +0/+2.0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r AE40.10
+*Want "MSDBR/MSDB NF +0/+2.0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r AE50.10
+*Want "MSDBR/MSDB NF +0/+2.0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r AE60.10
+*Want "MSDBR/MSDB NF +0/+2.0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r AE70.10
+*Want "MSDBR/MSDB NF +0/+2.0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AE80.10
+*Want "MSDBR/MSDB NF +0/+inf/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r AE90.10
+*Want "MSDBR/MSDB NF +0/+inf/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AEA0.10
+*Want "MSDBR/MSDB NF +0/+inf/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r AEB0.10
+*Want "MSDBR/MSDB NF +0/+inf/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r AEC0.10
+*Want "MSDBR/MSDB NF +0/+inf/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r AED0.10
+*Want "MSDBR/MSDB NF +0/+inf/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r AEE0.10
+*Want "MSDBR/MSDB NF +0/+inf/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AEF0.10
+*Want "MSDBR/MSDB NF +0/+inf/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r AF00.10
+*Want "MSDBR/MSDB NF +0/-QNaN/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r AF10.10
+*Want "MSDBR/MSDB NF +0/-QNaN/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r AF20.10
+*Want "MSDBR/MSDB NF +0/-QNaN/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r AF30.10
+*Want "MSDBR/MSDB NF +0/-QNaN/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r AF40.10
+*Want "MSDBR/MSDB NF +0/-QNaN/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r AF50.10
+*Want "MSDBR/MSDB NF +0/-QNaN/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r AF60.10
+*Want "MSDBR/MSDB NF +0/-QNaN/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r AF70.10
+*Want "MSDBR/MSDB NF +0/-QNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r AF80.10
+*Want "MSDBR/MSDB NF +0/+SNaN/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r AF90.10
+*Want "MSDBR/MSDB NF +0/+SNaN/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r AFA0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r AFB0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r AFC0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r AFD0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r AFE0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r AFF0.10
+*Want "MSDBR/MSDB NF +0/+SNaN/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r B000.10
+*Want "MSDBR/MSDB NF +2.0/-inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r B010.10
+*Want "MSDBR/MSDB NF +2.0/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B020.10
+*Want "MSDBR/MSDB NF +2.0/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B030.10
+*Want "MSDBR/MSDB NF +2.0/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B040.10
+*Want "MSDBR/MSDB NF +2.0/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B050.10
+*Want "MSDBR/MSDB NF +2.0/-inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r B060.10
+*Want "MSDBR/MSDB NF +2.0/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B070.10
+*Want "MSDBR/MSDB NF +2.0/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B080.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r B090.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B0A0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B0B0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B0C0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B0D0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r B0E0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B0F0.10
+*Want "MSDBR/MSDB NF +2.0/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B100.10
+*Want "MSDBR/MSDB NF +2.0/-0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r B110.10
+*Want "MSDBR/MSDB NF +2.0/-0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r B120.10
+*Want "MSDBR/MSDB NF +2.0/-0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r B130.10
+*Want "MSDBR/MSDB NF +2.0/-0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r B140.10
+*Want "MSDBR/MSDB NF +2.0/-0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r B150.10
+*Want "MSDBR/MSDB NF +2.0/-0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r B160.10
+*Want "MSDBR/MSDB NF +2.0/-0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r B170.10
+*Want "MSDBR/MSDB NF +2.0/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B180.10
+*Want "MSDBR/MSDB NF +2.0/+0/-inf FPCR"      00000000 F8000000 00000000 F8000000
+r B190.10
+*Want "MSDBR/MSDB NF +2.0/+0/-2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r B1A0.10
+*Want "MSDBR/MSDB NF +2.0/+0/-0 FPCR"        00000000 F8000000 00000000 F8000000
+r B1B0.10
+*Want "MSDBR/MSDB NF +2.0/+0/+0 FPCR"        00000000 F8000000 00000000 F8000000
+r B1C0.10
+*Want "MSDBR/MSDB NF +2.0/+0/+2.0 FPCR"      00000000 F8000000 00000000 F8000000
+r B1D0.10
+*Want "MSDBR/MSDB NF +2.0/+0/+inf FPCR"      00000000 F8000000 00000000 F8000000
+r B1E0.10
+*Want "MSDBR/MSDB NF +2.0/+0/-QNaN FPCR"     00000000 F8000000 00000000 F8000000
+r B1F0.10
+*Want "MSDBR/MSDB NF +2.0/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B200.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r B210.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B220.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B230.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B240.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B250.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r B260.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B270.10
+*Want "MSDBR/MSDB NF +2.0/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B280.10
+*Want "MSDBR/MSDB NF +2.0/+inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r B290.10
+*Want "MSDBR/MSDB NF +2.0/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B2A0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B2B0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B2C0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B2D0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r B2E0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B2F0.10
+*Want "MSDBR/MSDB NF +2.0/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B300.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r B310.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B320.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r B330.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r B340.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B350.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r B360.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r B370.10
+*Want "MSDBR/MSDB NF +2.0/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B380.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r B390.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r B3A0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r B3B0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r B3C0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r B3D0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r B3E0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B3F0.10
+*Want "MSDBR/MSDB NF +2.0/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B400.10
+*Want "MSDBR/MSDB NF +inf/-inf/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r B410.10
+*Want "MSDBR/MSDB NF +inf/-inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B420.10
+*Want "MSDBR/MSDB NF +inf/-inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B430.10
+*Want "MSDBR/MSDB NF +inf/-inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B440.10
+*Want "MSDBR/MSDB NF +inf/-inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B450.10
+*Want "MSDBR/MSDB NF +inf/-inf/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r B460.10
+*Want "MSDBR/MSDB NF +inf/-inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B470.10
+*Want "MSDBR/MSDB NF +inf/-inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B480.10
+*Want "MSDBR/MSDB NF +inf/-2.0/-inf FPCR"    00800000 F8008000 00800000 F8008000
+r B490.10
+*Want "MSDBR/MSDB NF +inf/-2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B4A0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B4B0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B4C0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B4D0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/+inf FPCR"    00000000 F8000000 00000000 F8000000
+r B4E0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B4F0.10
+*Want "MSDBR/MSDB NF +inf/-2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B500.10
+*Want "MSDBR/MSDB NF +inf/-0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r B510.10
+*Want "MSDBR/MSDB NF +inf/-0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r B520.10
+*Want "MSDBR/MSDB NF +inf/-0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r B530.10
+*Want "MSDBR/MSDB NF +inf/-0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r B540.10
+*Want "MSDBR/MSDB NF +inf/-0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r B550.10
+*Want "MSDBR/MSDB NF +inf/-0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r B560.10
+*Want "MSDBR/MSDB NF +inf/-0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B570.10
+*Want "MSDBR/MSDB NF +inf/-0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B580.10
+*Want "MSDBR/MSDB NF +inf/+0/-inf FPCR"      00800000 F8008000 00800000 F8008000
+r B590.10
+*Want "MSDBR/MSDB NF +inf/+0/-2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r B5A0.10
+*Want "MSDBR/MSDB NF +inf/+0/-0 FPCR"        00800000 F8008000 00800000 F8008000
+r B5B0.10
+*Want "MSDBR/MSDB NF +inf/+0/+0 FPCR"        00800000 F8008000 00800000 F8008000
+r B5C0.10
+*Want "MSDBR/MSDB NF +inf/+0/+2.0 FPCR"      00800000 F8008000 00800000 F8008000
+r B5D0.10
+*Want "MSDBR/MSDB NF +inf/+0/+inf FPCR"      00800000 F8008000 00800000 F8008000
+r B5E0.10
+*Want "MSDBR/MSDB NF +inf/+0/-QNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B5F0.10
+*Want "MSDBR/MSDB NF +inf/+0/+SNaN FPCR"     00800000 F8008000 00800000 F8008000
+r B600.10
+*Want "MSDBR/MSDB NF +inf/+2.0/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r B610.10
+*Want "MSDBR/MSDB NF +inf/+2.0/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B620.10
+*Want "MSDBR/MSDB NF +inf/+2.0/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B630.10
+*Want "MSDBR/MSDB NF +inf/+2.0/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B640.10
+*Want "MSDBR/MSDB NF +inf/+2.0/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B650.10
+*Want "MSDBR/MSDB NF +inf/+2.0/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r B660.10
+*Want "MSDBR/MSDB NF +inf/+2.0/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B670.10
+*Want "MSDBR/MSDB NF +inf/+2.0/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B680.10
+*Want "MSDBR/MSDB NF +inf/+inf/-inf FPCR"    00000000 F8000000 00000000 F8000000
+r B690.10
+*Want "MSDBR/MSDB NF +inf/+inf/-2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B6A0.10
+*Want "MSDBR/MSDB NF +inf/+inf/-0 FPCR"      00000000 F8000000 00000000 F8000000
+r B6B0.10
+*Want "MSDBR/MSDB NF +inf/+inf/+0 FPCR"      00000000 F8000000 00000000 F8000000
+r B6C0.10
+*Want "MSDBR/MSDB NF +inf/+inf/+2.0 FPCR"    00000000 F8000000 00000000 F8000000
+r B6D0.10
+*Want "MSDBR/MSDB NF +inf/+inf/+inf FPCR"    00800000 F8008000 00800000 F8008000
+r B6E0.10
+*Want "MSDBR/MSDB NF +inf/+inf/-QNaN FPCR"   00000000 F8000000 00000000 F8000000
+r B6F0.10
+*Want "MSDBR/MSDB NF +inf/+inf/+SNaN FPCR"   00800000 F8008000 00800000 F8008000
+r B700.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r B710.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B720.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r B730.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r B740.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B750.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r B760.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r B770.10
+*Want "MSDBR/MSDB NF +inf/-QNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B780.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r B790.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r B7A0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r B7B0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r B7C0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r B7D0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r B7E0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B7F0.10
+*Want "MSDBR/MSDB NF +inf/+SNaN/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B800.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r B810.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B820.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r B830.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r B840.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B850.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r B860.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r B870.10
+*Want "MSDBR/MSDB NF -QNaN/-inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B880.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r B890.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B8A0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r B8B0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r B8C0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r B8D0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r B8E0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r B8F0.10
+*Want "MSDBR/MSDB NF -QNaN/-2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r B900.10
+*Want "MSDBR/MSDB NF -QNaN/-0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r B910.10
+*Want "MSDBR/MSDB NF -QNaN/-0/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r B920.10
+*Want "MSDBR/MSDB NF -QNaN/-0/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r B930.10
+*Want "MSDBR/MSDB NF -QNaN/-0/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r B940.10
+*Want "MSDBR/MSDB NF -QNaN/-0/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r B950.10
+*Want "MSDBR/MSDB NF -QNaN/-0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r B960.10
+*Want "MSDBR/MSDB NF -QNaN/-0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r B970.10
+*Want "MSDBR/MSDB NF -QNaN/-0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r B980.10
+*Want "MSDBR/MSDB NF -QNaN/+0/-inf FPCR"     00000000 F8000000 00000000 F8000000
+r B990.10
+*Want "MSDBR/MSDB NF -QNaN/+0/-2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r B9A0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/-0 FPCR"       00000000 F8000000 00000000 F8000000
+r B9B0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/+0 FPCR"       00000000 F8000000 00000000 F8000000
+r B9C0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/+2.0 FPCR"     00000000 F8000000 00000000 F8000000
+r B9D0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/+inf FPCR"     00000000 F8000000 00000000 F8000000
+r B9E0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/-QNaN FPCR"    00000000 F8000000 00000000 F8000000
+r B9F0.10
+*Want "MSDBR/MSDB NF -QNaN/+0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r BA00.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r BA10.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r BA20.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r BA30.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r BA40.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r BA50.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r BA60.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r BA70.10
+*Want "MSDBR/MSDB NF -QNaN/+2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BA80.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/-inf FPCR"   00000000 F8000000 00000000 F8000000
+r BA90.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/-2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r BAA0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/-0 FPCR"     00000000 F8000000 00000000 F8000000
+r BAB0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/+0 FPCR"     00000000 F8000000 00000000 F8000000
+r BAC0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/+2.0 FPCR"   00000000 F8000000 00000000 F8000000
+r BAD0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/+inf FPCR"   00000000 F8000000 00000000 F8000000
+r BAE0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/-QNaN FPCR"  00000000 F8000000 00000000 F8000000
+r BAF0.10
+*Want "MSDBR/MSDB NF -QNaN/+inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BB00.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/-inf FPCR"  00000000 F8000000 00000000 F8000000
+r BB10.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/-2.0 FPCR"  00000000 F8000000 00000000 F8000000
+r BB20.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/-0 FPCR"    00000000 F8000000 00000000 F8000000
+r BB30.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/+0 FPCR"    00000000 F8000000 00000000 F8000000
+r BB40.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/+2.0 FPCR"  00000000 F8000000 00000000 F8000000
+r BB50.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/+inf FPCR"  00000000 F8000000 00000000 F8000000
+r BB60.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/-QNaN FPCR" 00000000 F8000000 00000000 F8000000
+r BB70.10
+*Want "MSDBR/MSDB NF -QNaN/-QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BB80.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r BB90.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BBA0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r BBB0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r BBC0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BBD0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r BBE0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BBF0.10
+*Want "MSDBR/MSDB NF -QNaN/+SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BC00.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r BC10.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BC20.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r BC30.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r BC40.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BC50.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r BC60.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BC70.10
+*Want "MSDBR/MSDB NF +SNaN/-inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BC80.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r BC90.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BCA0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r BCB0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r BCC0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BCD0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r BCE0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BCF0.10
+*Want "MSDBR/MSDB NF +SNaN/-2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BD00.10
+*Want "MSDBR/MSDB NF +SNaN/-0/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r BD10.10
+*Want "MSDBR/MSDB NF +SNaN/-0/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r BD20.10
+*Want "MSDBR/MSDB NF +SNaN/-0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r BD30.10
+*Want "MSDBR/MSDB NF +SNaN/-0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r BD40.10
+*Want "MSDBR/MSDB NF +SNaN/-0/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r BD50.10
+*Want "MSDBR/MSDB NF +SNaN/-0/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r BD60.10
+*Want "MSDBR/MSDB NF +SNaN/-0/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r BD70.10
+*Want "MSDBR/MSDB NF +SNaN/-0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r BD80.10
+*Want "MSDBR/MSDB NF +SNaN/+0/-inf FPCR"     00800000 F8008000 00800000 F8008000
+r BD90.10
+*Want "MSDBR/MSDB NF +SNaN/+0/-2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r BDA0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/-0 FPCR"       00800000 F8008000 00800000 F8008000
+r BDB0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/+0 FPCR"       00800000 F8008000 00800000 F8008000
+r BDC0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/+2.0 FPCR"     00800000 F8008000 00800000 F8008000
+r BDD0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/+inf FPCR"     00800000 F8008000 00800000 F8008000
+r BDE0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/-QNaN FPCR"    00800000 F8008000 00800000 F8008000
+r BDF0.10
+*Want "MSDBR/MSDB NF +SNaN/+0/+SNaN FPCR"    00800000 F8008000 00800000 F8008000
+r BE00.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r BE10.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BE20.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r BE30.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r BE40.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BE50.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r BE60.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BE70.10
+*Want "MSDBR/MSDB NF +SNaN/+2.0/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BE80.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/-inf FPCR"   00800000 F8008000 00800000 F8008000
+r BE90.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/-2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BEA0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/-0 FPCR"     00800000 F8008000 00800000 F8008000
+r BEB0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/+0 FPCR"     00800000 F8008000 00800000 F8008000
+r BEC0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/+2.0 FPCR"   00800000 F8008000 00800000 F8008000
+r BED0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/+inf FPCR"   00800000 F8008000 00800000 F8008000
+r BEE0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/-QNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BEF0.10
+*Want "MSDBR/MSDB NF +SNaN/+inf/+SNaN FPCR"  00800000 F8008000 00800000 F8008000
+r BF00.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r BF10.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BF20.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r BF30.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r BF40.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BF50.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r BF60.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BF70.10
+*Want "MSDBR/MSDB NF +SNaN/-QNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BF80.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/-inf FPCR"  00800000 F8008000 00800000 F8008000
+r BF90.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/-2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BFA0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/-0 FPCR"    00800000 F8008000 00800000 F8008000
+r BFB0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/+0 FPCR"    00800000 F8008000 00800000 F8008000
+r BFC0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/+2.0 FPCR"  00800000 F8008000 00800000 F8008000
+r BFD0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/+inf FPCR"  00800000 F8008000 00800000 F8008000
+r BFE0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/-QNaN FPCR" 00800000 F8008000 00800000 F8008000
+r BFF0.10
+*Want "MSDBR/MSDB NF +SNaN/+SNaN/+SNaN FPCR" 00800000 F8008000 00800000 F8008000
+
+
+# Long BFP Multiply And Subtract finite results
+*Compare
+r C000.10
+*Want "MSDBR F Ovfl 1"                   FFF00000 00000000 DFEFFFFF FFFFFFFE
+r C010.10
+*Want "MSDB F Ovfl 1"                    FFF00000 00000000 DFEFFFFF FFFFFFFE
+r C020.10
+*Want "MSDBR F Ovfl 2"                   FFF00000 00000000 9FFFFFFF FFFFFFFF
+r C030.10
+*Want "MSDB F Ovfl 2"                    FFF00000 00000000 9FFFFFFF FFFFFFFF
+r C040.10
+*Want "MSDBR F Ufl 1"                    80080000 00000001 E0000000 00000002
+r C050.10
+*Want "MSDB F Ufl 1"                     80080000 00000001 E0000000 00000002
+r C060.10
+*Want "MSDBR F Ufl 2"                    0007FFFF FFFFFFFE 5FFFFFFF FFFFFFFA
+r C070.10
+*Want "MSDB F Ufl 2"                     0007FFFF FFFFFFFE 5FFFFFFF FFFFFFFA
+r C080.10
+*Want "MSDBR F Nmin"                     0017FFFF FFFFFFFE 0017FFFF FFFFFFFE
+r C090.10
+*Want "MSDB F Nmin"                      0017FFFF FFFFFFFE 0017FFFF FFFFFFFE
+r C0A0.10
+*Want "MSDBR F Incr"                     3FF90000 0000000D 3FF90000 0000000D
+r C0B0.10
+*Want "MSDB F Incr"                      3FF90000 0000000D 3FF90000 0000000D
+r C0C0.10
+*Want "MSDBR F Trun"                     3FF90000 00000007 3FF90000 00000007
+r C0D0.10
+*Want "MSDB F Trun"                      3FF90000 00000007 3FF90000 00000007
+
+# Long BFP Multiply And Subtract finite results - FPCR contents
+*Compare
+r C200.10
+*Want "MSDBR/MSDB F Ovfl 1 FPCR"        00280000 F8002800 00280000 F8002800
+r C210.10
+*Want "MSDBR/MSDB F Ovfl 2 FPCR"        00280000 F8002000 00280000 F8002000
+r C220.10
+*Want "MSDBR/MSDB F Ufl 1 FPCR"         00180000 F8001C00 00180000 F8001C00
+r C230.10
+*Want "MSDBR/MSDB F Ufl 2 FPCR"         00180000 F8001000 00180000 F8001000
+r C240.10
+*Want "MSDBR/MSDB F Nmin FPCR"          00000000 F8000000 00000000 F8000000
+r C250.10
+*Want "MSDBR/MSDB F Incr FPCR"          00080000 F8000C00 00080000 F8000C00
+r C260.10
+*Want "MSDBR/MSDB F Trun FPCR"          00080000 F8000800 00080000 F8000800
+
+# Long BFP Multiply And Subtract rounding mode results
+*Compare
+r C500.10
+*Want "MSDBR/MSDB RM +NZ RNTE" 3FF90000 00000007 3FF90000 00000007
+r C510.10
+*Want "MSDBR/MSDB RM +NZ RZ"   3FF90000 00000007 3FF90000 00000007
+r C520.10
+*Want "MSDBR/MSDB RM +NZ RP"   3FF90000 00000008 3FF90000 00000008
+r C530.10
+*Want "MSDBR/MSDB RM +NZ RM"   3FF90000 00000007 3FF90000 00000007
+r C540.10
+*Want "MSDBR/MSDB RM +NZ RFS"  3FF90000 00000007 3FF90000 00000007
+r C550.10
+*Want "MSDBR/MSDB RM -NZ RNTE" BFF90000 00000007 BFF90000 00000007
+r C560.10
+*Want "MSDBR/MSDB RM -NZ RZ"   BFF90000 00000007 BFF90000 00000007
+r C570.10
+*Want "MSDBR/MSDB RM -NZ RP"   BFF90000 00000007 BFF90000 00000007
+r C580.10
+*Want "MSDBR/MSDB RM -NZ RM"   BFF90000 00000008 BFF90000 00000008
+r C590.10
+*Want "MSDBR/MSDB RM -NZ RFS"  BFF90000 00000007 BFF90000 00000007
+r C5A0.10
+*Want "MSDBR/MSDB RM +NA RNTE" 3FF90000 0000000D 3FF90000 0000000D
+r C5B0.10
+*Want "MSDBR/MSDB RM +NA RZ"   3FF90000 0000000C 3FF90000 0000000C
+r C5C0.10
+*Want "MSDBR/MSDB RM +NA RP"   3FF90000 0000000D 3FF90000 0000000D
+r C5D0.10
+*Want "MSDBR/MSDB RM +NA RM"   3FF90000 0000000C 3FF90000 0000000C
+r C5E0.10
+*Want "MSDBR/MSDB RM +NA RFS"  3FF90000 0000000D 3FF90000 0000000D
+r C5F0.10
+*Want "MSDBR/MSDB RM -NA RNTE" BFF90000 0000000D BFF90000 0000000D
+r C600.10
+*Want "MSDBR/MSDB RM -NA RZ"   BFF90000 0000000C BFF90000 0000000C
+r C610.10
+*Want "MSDBR/MSDB RM -NA RP"   BFF90000 0000000C BFF90000 0000000C
+r C620.10
+*Want "MSDBR/MSDB RM -NA RM"   BFF90000 0000000D BFF90000 0000000D
+r C630.10
+*Want "MSDBR/MSDB RM -NA RFS"  BFF90000 0000000D BFF90000 0000000D
+r C640.10
+*Want "MSDBR/MSDB RM +TZ RNTE" 3FF90000 00000008 3FF90000 00000008
+r C650.10
+*Want "MSDBR/MSDB RM +TZ RZ"   3FF90000 00000008 3FF90000 00000008
+r C660.10
+*Want "MSDBR/MSDB RM +TZ RP"   3FF90000 00000009 3FF90000 00000009
+r C670.10
+*Want "MSDBR/MSDB RM +TZ RM"   3FF90000 00000008 3FF90000 00000008
+r C680.10
+*Want "MSDBR/MSDB RM +TZ RFS"  3FF90000 00000009 3FF90000 00000009
+r C690.10
+*Want "MSDBR/MSDB RM -TZ RNTE" BFF90000 00000008 BFF90000 00000008
+r C6A0.10
+*Want "MSDBR/MSDB RM -TZ RZ"   BFF90000 00000008 BFF90000 00000008
+r C6B0.10
+*Want "MSDBR/MSDB RM -TZ RP"   BFF90000 00000008 BFF90000 00000008
+r C6C0.10
+*Want "MSDBR/MSDB RM -TZ RM"   BFF90000 00000009 BFF90000 00000009
+r C6D0.10
+*Want "MSDBR/MSDB RM -TZ RFS"  BFF90000 00000009 BFF90000 00000009
+r C6E0.10
+*Want "MSDBR/MSDB RM +TA RNTE" 3FF90000 0000001A 3FF90000 0000001A
+r C6F0.10
+*Want "MSDBR/MSDB RM +TA RZ"   3FF90000 00000019 3FF90000 00000019
+r C700.10
+*Want "MSDBR/MSDB RM +TA RP"   3FF90000 0000001A 3FF90000 0000001A
+r C710.10
+*Want "MSDBR/MSDB RM +TA RM"   3FF90000 00000019 3FF90000 00000019
+r C720.10
+*Want "MSDBR/MSDB RM +TA RFS"  3FF90000 00000019 3FF90000 00000019
+r C730.10
+*Want "MSDBR/MSDB RM -TA RNTE" BFF90000 0000001A BFF90000 0000001A
+r C740.10
+*Want "MSDBR/MSDB RM -TA RZ"   BFF90000 00000019 BFF90000 00000019
+r C750.10
+*Want "MSDBR/MSDB RM -TA RP"   BFF90000 00000019 BFF90000 00000019
+r C760.10
+*Want "MSDBR/MSDB RM -TA RM"   BFF90000 0000001A BFF90000 0000001A
+r C770.10
+*Want "MSDBR/MSDB RM -TA RFS"  BFF90000 00000019 BFF90000 00000019
+
+
+# Long BFP Multiply And Subtract rounding mode results - FPCR contents
+*Compare
+r CA00.10
+*Want "MSDBR/MSDB RM +NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CA10.10
+*Want "MSDBR/MSDB RM +NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CA20.10
+*Want "MSDBR/MSDB RM +NZ RFS FPCR"      00080007 00080007 00000000 00000000
+r CA30.10
+*Want "MSDBR/MSDB RM -NZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CA40.10
+*Want "MSDBR/MSDB RM -NZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CA50.10
+*Want "MSDBR/MSDB RM -NZ RFS FPCR"      00080007 00080007 00000000 00000000
+r CA60.10
+*Want "MSDBR/MSDB RM +NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CA70.10
+*Want "MSDBR/MSDB RM +NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CA80.10
+*Want "MSDBR/MSDB RM +NA RFS FPCR"      00080007 00080007 00000000 00000000
+r CA90.10
+*Want "MSDBR/MSDB RM -NA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CAA0.10
+*Want "MSDBR/MSDB RM -NA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CAB0.10
+*Want "MSDBR/MSDB RM -NA RFS FPCR"      00080007 00080007 00000000 00000000
+r CAC0.10
+*Want "MSDBR/MSDB RM +TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CAD0.10
+*Want "MSDBR/MSDB RM +TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CAE0.10
+*Want "MSDBR/MSDB RM +TZ RFS FPCR"      00080007 00080007 00000000 00000000
+r CAF0.10
+*Want "MSDBR/MSDB RM -TZ RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CB00.10
+*Want "MSDBR/MSDB RM -TZ RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CB10.10
+*Want "MSDBR/MSDB RM -TZ RFS FPCR"      00080007 00080007 00000000 00000000
+r CB20.10
+*Want "MSDBR/MSDB RM +TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CB30.10
+*Want "MSDBR/MSDB RM +TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CB40.10
+*Want "MSDBR/MSDB RM +TA RFS FPCR"      00080007 00080007 00000000 00000000
+r CB50.10
+*Want "MSDBR/MSDB RM -TA RNTE, RZ FPCR" 00080000 00080000 00080001 00080001
+r CB60.10
+*Want "MSDBR/MSDB RM -TA RP, RM FPCR"   00080002 00080002 00080003 00080003
+r CB70.10
+*Want "MSDBR/MSDB RM -TA RFS FPCR"      00080007 00080007 00000000 00000000
+
+
+r 1000.2000
+
+r 6000.4000
+
+ 
+*Done
+
@@ -0,0 +1,13 @@
+*
+#--------------
+defsym cmd abs
+#--------------
+*
+defsym arch S/370
+script "$(testpath)/cmd-abs-2K.subtst"
+*
+defsym arch S/390
+script "$(testpath)/cmd-abs-4K.subtst"
+*
+defsym arch z/Arch
+script "$(testpath)/cmd-abs-4K.subtst"
@@ -0,0 +1,26 @@
+*
+#------------
+defsym cmd r
+#------------
+*
+defsym arch S/370
+script "$(testpath)/cmd-rv-2K.subtst"
+*
+defsym arch S/390
+script "$(testpath)/cmd-rv-4K-32.subtst"
+*
+defsym arch z/Arch
+script "$(testpath)/cmd-rv-4K-64.subtst"
+*
+#------------
+defsym cmd v
+#------------
+*
+defsym arch S/370
+script "$(testpath)/cmd-rv-2K.subtst"
+*
+defsym arch S/390
+script "$(testpath)/cmd-rv-4K-32.subtst"
+*
+defsym arch z/Arch
+script "$(testpath)/cmd-rv-4K-64.subtst"
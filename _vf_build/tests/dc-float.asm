@@ -0,0 +1,852 @@
+* This file was put into the public domain 2016-06-05 
+* by John P. Hartmann.  You can use it for anything you like, 
+* as long as this notice remains. 
+* 
+* While some of the constants are rather extreme, this file 
+* may be useful for a source of hexadecimal constants with ASMA 
+                        F50008799CDCBEFF
+ DC X'3CB9B888EBFBB6EF  F50008799CDCBEFF'        LB'09388667083711153328546184797976114503588624E-295'
+ DC X'FFFFFFFF'                                  eh'-(max)'
+ DC X'7FFFFFFF00100000'                          eh'(max),(min)'
+ DC X'7FFFFFFF'                                  eh'(max)'
+ DC X'00100000'                                  eh'(min)'
+ DC X'00000001'                                  eh'(dmin)'
+ DC X'7FA00000'                                  eb'(snan)'
+ DC X'7FE00000'                                  eb'(qnan)'
+ DC X'7FC00000'                                  eb'(nan)'
+ DC X'7F800000'                                  eb'(inf)'
+ DC X'7F7FFFFF'                                  eb'(max)'
+ DC X'00800000'                                  eb'(min)'
+ DC X'00000001'                                  eb'(dmin)'
+ DC X'7FFFFFFFFFFFFFFF'                          dh'(max)'
+ DC X'0010000000000000'                          dh'(min)'
+ DC X'0000000000000001'                          dh'(dmin)'
+ DC X'7FF4000000000000'                          db'(snan)'
+ DC X'7FFC000000000000'                          db'(qnan)'
+ DC X'7FF8000000000000'                          db'(nan)'
+ DC X'7FF0000000000000'                          db'(inf)'
+ DC X'7FEFFFFFFFFFFFFF'                          db'(max)'
+ DC X'0010000000000000'                          db'(min)'
+ DC X'0000000000000001'                          db'(dmin)'
+ DC X'7FFFFFFFFFFFFFFF  71FFFFFFFFFFFFFF'        lh'(max)'
+ DC X'0010000000000000  7200000000000000'        lh'(min)'
+ DC X'0000000000000000  7200000000000001'        lh'(dmin)'
+ DC X'7FFF400000000000  0000000000000000'        lb'(snan)'
+ DC X'7FFFC00000000000  0000000000000000'        lb'(qnan)'
+ DC X'7FFF800000000000  0000000000000000'        lb'(nan)'
+ DC X'7FFF000000000000  0000000000000000'        lb'(inf)'
+ DC X'7FFEFFFFFFFFFFFF  FFFFFFFFFFFFFFFF'        lb'(max)'
+ DC X'0001000000000000  0000000000000000'        lb'(min)'
+ DC X'0000000000000000  0000000000000001'        lb'(dmin)'
+ DC X'0000000000000001  72'                      lhl9'(dmin)'
+ DC X'0000000000000001  72'                      lhl.72'(dmin)'
+ DC X'0000000000000001'                          lhl.64'(dmin)'
+ DC X'4180'                                      dl.9'10'
+ DC X'41C0'                                      dl.10'10'
+ DC X'41A0'                                      dl.11'10'
+ DC X'41A0'                                      dl.12'10'
+ DC X'41A0'                                      dl.13'10'
+ DC X'41A0'                                      dl.14'10'
+ DC X'41A0'                                      dl.15'10'
+ DC X'41A0'                                      dl.16'10'
+ DC X'41A000'                                    dl.17'10'
+ DC X'41A000'                                    dl.18'10'
+ DC X'41A000'                                    dl.19'10'
+ DC X'41A000'                                    dl.20'10'
+ DC X'41A000'                                    dl.21'10'
+ DC X'41A000'                                    dl.22'10'
+ DC X'41A000'                                    dl.23'10'
+ DC X'41A000'                                    dl.24'10'
+ DC X'41A00000'                                  dl.25'10'
+ DC X'41A00000'                                  dl.26'10'
+ DC X'41A00000'                                  dl.27'10'
+ DC X'41A00000'                                  dl.28'10'
+ DC X'41A00000'                                  dl.29'10'
+ DC X'41A00000'                                  dl.30'10'
+ DC X'41A00000'                                  dl.31'10'
+ DC X'41A00000'                                  dl.32'10'
+ DC X'41A0'                                      dl2'10'
+ DC X'41A000'                                    dl3'10'
+ DC X'C180'                                      dl.9'-10'
+ DC X'C1C0'                                      dl.10'-10'
+ DC X'C1A0'                                      dl.11'-10'
+ DC X'C1A0'                                      dl.12'-10'
+ DC X'C1A0'                                      dl.13'-10'
+ DC X'C1A0'                                      dl.14'-10'
+ DC X'C1A0'                                      dl.15'-10'
+ DC X'C1A0'                                      dl.16'-10'
+ DC X'C1A000'                                    dl.17'-10'
+ DC X'C1A000'                                    dl.18'-10'
+ DC X'C1A000'                                    dl.19'-10'
+ DC X'C1A000'                                    dl.20'-10'
+ DC X'C1A000'                                    dl.21'-10'
+ DC X'C1A000'                                    dl.22'-10'
+ DC X'C1A000'                                    dl.23'-10'
+ DC X'C1A000'                                    dl.24'-10'
+ DC X'C1A00000'                                  dl.25'-10'
+ DC X'C1A00000'                                  dl.26'-10'
+ DC X'C1A00000'                                  dl.27'-10'
+ DC X'C1A00000'                                  dl.28'-10'
+ DC X'C1A00000'                                  dl.29'-10'
+ DC X'C1A00000'                                  dl.30'-10'
+ DC X'C1A00000'                                  dl.31'-10'
+ DC X'C1A00000'                                  dl.32'-10'
+ DC X'C1A0'                                      dl2'-10'
+ DC X'C1A000'                                    dl3'-10'
+ DC X'4039000000000000'                          db'25'
+ DC X'406C200000000000'                          db'225'
+ DC X'40A1620000000000'                          db'2225'
+ DC X'40D5B44000000000'                          db'22225'
+ DC X'410B208800000000'                          db'222225'
+ DC X'4140F44880000000'                          db'2222225'
+ DC X'4175315910000000'                          db'22222225'
+ DC X'41AA7DAF22000000'                          db'222222225'
+ DC X'41E08E8D72200000'                          db'2222222225'
+ DC X'4214B230CE440000'                          db'22222222225'
+ DC X'4249DEBD01C88000'                          db'222222222225'
+ DC X'42802B36211C8800'                          db'2222222222225'
+ DC X'42B43603A9639100'                          db'22222222222225'
+ DC X'42E9438493BC7220'                          db'222222222222225'
+ DC X'431F9465B8AB8E44'                          db'2222222222222225'
+ DC X'4353BCBF936B38E4'                          db'22222222222222225'
+ DC X'4353BCBF936B38E5'                          db'22222222222222228'
+ DC X'4353BCBF936B38E5'                          db'22222222222222229'
+ DC X'4353BCBF936B38E6'                          db'22222222222222230'
+ DC X'4388ABEF7846071D'                          db'222222222222222225'
+ DC X'43BED6EB565788E4'                          db'2222222222222222225'
+ DC X'43F3465315F6B58E'                          db'22222222222222222225'
+ DC X'442817E7DB7462F2'                          db'222222222222222222225'
+ DC X'445E1DE1D2517BAE'                          db'2222222222222222222225'
+ DC X'4492D2AD2372ED4D'                          db'22222222222222222222225'
+ DC X'44C787586C4FA8A0'                          db'222222222222222222222225'
+ DC X'44FD692E876392C8'                          db'2222222222222222222222225'
+ DC X'453261BD149E3BBD'                          db'22222222222222222222222225'
+ DC X'4566FA2C59C5CAAC'                          db'222222222222222222222222225'
+ DC X'459CB8B770373D57'                          db'2222222222222222222222222225'
+ DC X'45D1F372A6228657'                          db'22222222222222222222222222225'
+ DC X'4606704F4FAB27EC'                          db'222222222222222222222222222225'
+ DC X'463C0C632395F1E7'                          db'2222222222222222222222222222225'
+ DC X'467187BDF63DB731'                          db'22222222222222222222222222222225'
+ DC X'3F393EE5EEDCC20D'                          dh'0.013976'
+ DC X'7F31703792979513'                          dh'0.013976e77'
+ DC X'3FDD15F02C4D65E4'                          dh'0.053976'
+ DC X'7FBEEEEEF308359E'                          dh'0.053976e77'
+ DC X'00000000'                                  e'0'
+ DC X'00000000'                                  eb'0'
+ DC X'00000000'                                  eh'0'
+ DC X'00000000'                                  e'-0'
+ DC X'80000000'                                  eb'-0'
+ DC X'80000000'                                  eh'-0'
+ DC X'41100000'                                  e'1'
+ DC X'3F800000'                                  eb'1'
+ DC X'41100000'                                  eh'1'
+ DC X'40800000'                                  e'.5'
+ DC X'3F000000'                                  eb'.5'
+ DC X'40800000'                                  eh'.5'
+ DC X'41300000'                                  e'3'
+ DC X'40400000'                                  eb'3'
+ DC X'41300000'                                  eh'3'
+ DC X'4180'                                      el.9'10'
+ DC X'41C0'                                      el.10'10'
+ DC X'41A0'                                      el.11'10'
+ DC X'41A0'                                      el.12'10'
+ DC X'41A0'                                      el.13'10'
+ DC X'41A0'                                      el.14'10'
+ DC X'41A0'                                      el.15'10'
+ DC X'41A0'                                      el.16'10'
+ DC X'41A000'                                    el.17'10'
+ DC X'41A000'                                    el.18'10'
+ DC X'41A000'                                    el.19'10'
+ DC X'41A000'                                    el.20'10'
+ DC X'41A000'                                    el.21'10'
+ DC X'41A000'                                    el.22'10'
+ DC X'41A000'                                    el.23'10'
+ DC X'41A000'                                    el.24'10'
+ DC X'41A00000'                                  el.25'10'
+ DC X'41A00000'                                  el.26'10'
+ DC X'41A00000'                                  el.27'10'
+ DC X'41A00000'                                  el.28'10'
+ DC X'41A00000'                                  el.29'10'
+ DC X'41A00000'                                  el.30'10'
+ DC X'41A00000'                                  el.31'10'
+ DC X'41A00000'                                  el.32'10'
+ DC X'41A0'                                      el2'10'
+ DC X'41A000'                                    el3'10'
+ DC X'C180'                                      el.9'-10'
+ DC X'C1C0'                                      el.10'-10'
+ DC X'C1A0'                                      el.11'-10'
+ DC X'C1A0'                                      el.12'-10'
+ DC X'C1A0'                                      el.13'-10'
+ DC X'C1A0'                                      el.14'-10'
+ DC X'C1A0'                                      el.15'-10'
+ DC X'C1A0'                                      el.16'-10'
+ DC X'C1A000'                                    el.17'-10'
+ DC X'C1A000'                                    el.18'-10'
+ DC X'C1A000'                                    el.19'-10'
+ DC X'C1A000'                                    el.20'-10'
+ DC X'C1A000'                                    el.21'-10'
+ DC X'C1A000'                                    el.22'-10'
+ DC X'C1A000'                                    el.23'-10'
+ DC X'C1A000'                                    el.24'-10'
+ DC X'C1A00000'                                  el.25'-10'
+ DC X'C1A00000'                                  el.26'-10'
+ DC X'C1A00000'                                  el.27'-10'
+ DC X'C1A00000'                                  el.28'-10'
+ DC X'C1A00000'                                  el.29'-10'
+ DC X'C1A00000'                                  el.30'-10'
+ DC X'C1A00000'                                  el.31'-10'
+ DC X'C1A00000'                                  el.32'-10'
+ DC X'C1A0'                                      el2'-10'
+ DC X'C1A000'                                    el3'-10'
+ DC X'41C80000'                                  eb'25'
+ DC X'43610000'                                  eb'225'
+ DC X'450B1000'                                  eb'2225'
+ DC X'46ADA200'                                  eb'22225'
+ DC X'48590440'                                  eb'222225'
+ DC X'4A07A244'                                  eb'2222225'
+ DC X'4BA98AC8'                                  eb'22222224'
+ DC X'4BA98AC8'                                  eb'22222225'
+ DC X'4BA98AC9'                                  eb'22222226'
+ DC X'4D53ED79'                                  eb'222222225'
+ DC X'4F04746C'                                  eb'2222222225'
+ DC X'50A59186'                                  eb'22222222225'
+ DC X'524EF5E8'                                  eb'222222222225'
+ DC X'540159B1'                                  eb'2222222222225'
+ DC X'55A1B01D'                                  eb'22222222222225'
+ DC X'574A1C25'                                  eb'222222222222225'
+ DC X'58FCA32E'                                  eb'2222222222222225'
+ DC X'5A9DE5FD'                                  eb'22222222222222225'
+ DC X'5C455F7C'                                  eb'222222222222222225'
+ DC X'5DF6B75B'                                  eb'2222222222222222225'
+ DC X'5F9A3299'                                  eb'22222222222222222225'
+ DC X'6140BF3F'                                  eb'222222222222222222225'
+ DC X'62F0EF0F'                                  eb'2222222222222222222225'
+ DC X'64969569'                                  eb'22222222222222222222225'
+ DC X'663C3AC3'                                  eb'222222222222222222222225'
+ DC X'67EB4974'                                  eb'2222222222222222222222225'
+ DC X'00000000'                                  e'-0e17'
+ DC X'46FFFFFE'                                  eh'16777214'
+ DC X'46FFFFFE'                                  eh'16777214.5r4'
+ DC X'46FFFFFE'                                  eh'16777214.0000000000000000000000000000000000000000000000000001r4'
+ DC X'46FFFFFF'                                  eh'16777214.5000000000000000000000000000000000000000000000000001r4'
+ DC X'46FFFFFF'                                  eh'16777214.5000000000000000000000000000000000000000000000000001r4'
+ DC X'46FFFFFF'                                  eh'16777215'
+ DC X'47100000'                                  eh'16777215.5r4'
+ DC X'46FFFFFF'                                  eh'16777215.0000000000000000000000000000000000000000000000000001r4'
+ DC X'47100000'                                  eh'16777215.5000000000000000000000000000000000000000000000000001r4'
+ DC X'47100000'                                  eh'16777216'
+ DC X'47100000'                                  eh'16777216.5r4'
+ DC X'47100000'                                  eh'16777216.0000000000000000000000000000000000000000000000000001r4'
+ DC X'47100000'                                  eh'16777216.5000000000000000000000000000000000000000000000000001r4'
+ DC X'4BA98AC9'                                  eb'22222225.1'
+ DC X'4BA98AC9'                                  eb'22222225.1r1'
+ DC X'4BA98AC9'                                  eb'22222225.1r4'
+ DC X'4BA98AC8'                                  eb'22222225.1r5'
+ DC X'4BA98AC9'                                  eb'22222225.1r6'
+ DC X'4BA98AC8'                                  eb'22222225.1r7'
+ DC X'CBA98AC9'                                  eb'-22222225.1r1'
+ DC X'CBA98AC9'                                  eb'-22222225.1r4'
+ DC X'CBA98AC8'                                  eb'-22222225.1r5'
+ DC X'CBA98AC8'                                  eb'-22222225.1r6'
+ DC X'CBA98AC9'                                  eb'-22222225.1r7'
+ DC X'4BA98AC9'                                  eb'22222225.00000000000000001'
+ DC X'4BA98AC9'                                  eb'22222225.00000000000000001r1'
+ DC X'4BA98AC9'                                  eb'22222225.00000000000000001r4'
+ DC X'4BA98AC8'                                  eb'22222225.00000000000000001r5'
+ DC X'4BA98AC9'                                  eb'22222225.00000000000000001r6'
+ DC X'4BA98AC8'                                  eb'22222225.00000000000000001r7'
+ DC X'CBA98AC9'                                  eb'-22222225.00000000000000001r1'
+ DC X'CBA98AC9'                                  eb'-22222225.00000000000000001r4'
+ DC X'CBA98AC8'                                  eb'-22222225.00000000000000001r5'
+ DC X'CBA98AC8'                                  eb'-22222225.00000000000000001r6'
+ DC X'CBA98AC9'                                  eb'-22222225.00000000000000001r7'
+ DC X'4BA98AC9'                                  eb'22222225.000000000000000000000000000000001'
+ DC X'4BA98AC9'                                  eb'22222225.000000000000000000000000000000001r1'
+ DC X'4BA98AC9'                                  eb'22222225.000000000000000000000000000000001r4'
+ DC X'4BA98AC8'                                  eb'22222225.000000000000000000000000000000001r5'
+ DC X'4BA98AC9'                                  eb'22222225.000000000000000000000000000000001r6'
+ DC X'4BA98AC8'                                  eb'22222225.000000000000000000000000000000001r7'
+ DC X'CBA98AC9'                                  eb'-22222225.000000000000000000000000000000001r1'
+ DC X'CBA98AC9'                                  eb'-22222225.000000000000000000000000000000001r4'
+ DC X'CBA98AC8'                                  eb'-22222225.000000000000000000000000000000001r5'
+ DC X'CBA98AC8'                                  eb'-22222225.000000000000000000000000000000001r6'
+ DC X'CBA98AC9'                                  eb'-22222225.000000000000000000000000000000001r7'
+ DC X'4BA98AC8'                                  eb'22222225'
+ DC X'4BA98AC9'                                  eb'22222225r1'
+ DC X'4BA98AC8'                                  eb'22222225r4'
+ DC X'4BA98AC8'                                  eb'22222225r5'
+ DC X'4BA98AC9'                                  eb'22222225r6'
+ DC X'4BA98AC8'                                  eb'22222225r7'
+ DC X'CBA98AC9'                                  eb'-22222225r1'
+ DC X'CBA98AC8'                                  eb'-22222225r4'
+ DC X'CBA98AC8'                                  eb'-22222225r5'
+ DC X'CBA98AC8'                                  eb'-22222225r6'
+ DC X'CBA98AC9'                                  eb'-22222225r7'
+ DC X'4BA98AC8'                                  eb'22222224r1'
+ DC X'4BA98AC8'                                  eb'22222224r4'
+ DC X'4BA98AC8'                                  eb'22222224r5'
+ DC X'4BA98AC8'                                  eb'22222224r6'
+ DC X'4BA98AC8'                                  eb'22222224r7'
+ DC X'CBA98AC8'                                  eb'-22222224r1'
+ DC X'CBA98AC8'                                  eb'-22222224r4'
+ DC X'CBA98AC8'                                  eb'-22222224r5'
+ DC X'CBA98AC8'                                  eb'-22222224r6'
+ DC X'CBA98AC8'                                  eb'-22222224r7'
+ DC X'4BA98AC9'                                  eb'22222226r1'
+ DC X'4BA98AC9'                                  eb'22222226r4'
+ DC X'4BA98AC9'                                  eb'22222226r5'
+ DC X'4BA98AC9'                                  eb'22222226r6'
+ DC X'4BA98AC9'                                  eb'22222226r7'
+ DC X'CBA98AC9'                                  eb'-22222226r1'
+ DC X'CBA98AC9'                                  eb'-22222226r4'
+ DC X'CBA98AC9'                                  eb'-22222226r5'
+ DC X'CBA98AC9'                                  eb'-22222226r6'
+ DC X'CBA98AC9'                                  eb'-22222226r7'
+ DC X'47153159'                                  eh'22222225'
+ DC X'47153159'                                  eh'22222225r1'
+ DC X'47153159'                                  eh'22222225r4'
+ DC X'47153159'                                  eh'22222225r5'
+ DC X'4715315A'                                  eh'22222225r6'
+ DC X'47153159'                                  eh'22222225r7'
+ DC X'742A5177'                                  eb'0.53976e32'
+ DC X'09E03521'                                  eb'0.53976e-32'
+ DC X'00100000'                                  eh'0.5397605e-78'
+ DC X'0000'
+ DC X'011373FC'                                  e'10.5e-78'
+ DC X'001F1FFA'                                  e'10.5e-79'
+ DC X'001F152C'                                  e'1.048576e-78'
+ DC X'00104DB4'                                  e'0.550e-78'
+ DC X'00104DB4'                                  eh'0.550e-78'
+ DC X'001F152C'                                  eh'1.048576e-78'
+ DC X'001F'                                      el2'10.5e-79'
+ DC X'011373FC'                                  eh'10.5e-78'
+ DC X'001F1FFA'                                  eh'10.5e-79'
+ DC X'001F'                                      ehl2'10.5e-79'
+ DC X'03FF'                                      ebl2'1.5e-36'
+ DC X'011286D8'                                  e'1e-77'
+ DC X'001DA48D'                                  e'1e-78'
+ DC X'0113'                                      el2'1e-77'
+ DC X'001E'                                      el2'1e-78'
+ DC X'7FFFFFFF'                                  e'7.23700523e75'
+ DC X'7FFFFFFF'                                  eh'7.2370055e75r5'
+ DC X'00800000'                                  eb'1.1754943157898e-38'
+ DC X'00800000'                                  eb'1.1754943157899e-38'
+ DC X'00800000'                                  eb'1.17549435082228751e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228752e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228753e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228755e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228756e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228757e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228758e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228759e-38r5'
+ DC X'00800000'                                  eb'1.1754944e-38r5'
+ DC X'00800000'                                  eb'1.17549436e-38r5'
+ DC X'00800000'                                  eb'1.175494351e-38r5'
+ DC X'00800000'                                  eb'1.1754943509e-38r5'
+ DC X'00800000'                                  eb'1.17549435083e-38r5'
+ DC X'00800000'                                  eb'1.175494350823e-38r5'
+ DC X'00800000'                                  eb'1.1754943508223e-38r5'
+ DC X'00800000'                                  eb'1.17549435082229e-38r5'
+ DC X'00800000'                                  eb'1.175494350822288e-38r5'
+ DC X'00800000'                                  eb'1.1754943508222876e-38r5'
+ DC X'00800000'                                  eb'1.17549435082228751e-38r5'
+ DC X'4180'                                      ll.9'10'
+ DC X'41C0'                                      ll.10'10'
+ DC X'41A0'                                      ll.11'10'
+ DC X'41A0'                                      ll.12'10'
+ DC X'41A0'                                      ll.13'10'
+ DC X'41A0'                                      ll.14'10'
+ DC X'41A0'                                      ll.15'10'
+ DC X'41A0'                                      ll.16'10'
+ DC X'41A000'                                    ll.17'10'
+ DC X'41A000'                                    ll.18'10'
+ DC X'41A000'                                    ll.19'10'
+ DC X'41A000'                                    ll.20'10'
+ DC X'41A000'                                    ll.21'10'
+ DC X'41A000'                                    ll.22'10'
+ DC X'41A000'                                    ll.23'10'
+ DC X'41A000'                                    ll.24'10'
+ DC X'41A00000'                                  ll.25'10'
+ DC X'41A00000'                                  ll.26'10'
+ DC X'41A00000'                                  ll.27'10'
+ DC X'41A00000'                                  ll.28'10'
+ DC X'41A00000'                                  ll.29'10'
+ DC X'41A00000'                                  ll.30'10'
+ DC X'41A00000'                                  ll.31'10'
+ DC X'41A00000'                                  ll.32'10'
+ DC X'41A0'                                      ll2'10'
+ DC X'41A000'                                    ll3'10'
+ DC X'C180'                                      ll.9'-10'
+ DC X'C1C0'                                      ll.10'-10'
+ DC X'C1A0'                                      ll.11'-10'
+ DC X'C1A0'                                      ll.12'-10'
+ DC X'C1A0'                                      ll.13'-10'
+ DC X'C1A0'                                      ll.14'-10'
+ DC X'C1A0'                                      ll.15'-10'
+ DC X'C1A0'                                      ll.16'-10'
+ DC X'C1A000'                                    ll.17'-10'
+ DC X'C1A000'                                    ll.18'-10'
+ DC X'C1A000'                                    ll.19'-10'
+ DC X'C1A000'                                    ll.20'-10'
+ DC X'C1A000'                                    ll.21'-10'
+ DC X'C1A000'                                    ll.22'-10'
+ DC X'C1A000'                                    ll.23'-10'
+ DC X'C1A000'                                    ll.24'-10'
+ DC X'C1A00000'                                  ll.25'-10'
+ DC X'C1A00000'                                  ll.26'-10'
+ DC X'C1A00000'                                  ll.27'-10'
+ DC X'C1A00000'                                  ll.28'-10'
+ DC X'C1A00000'                                  ll.29'-10'
+ DC X'C1A00000'                                  ll.30'-10'
+ DC X'C1A00000'                                  ll.31'-10'
+ DC X'C1A00000'                                  ll.32'-10'
+ DC X'C1A0'                                      ll2'-10'
+ DC X'C1A000'                                    ll3'-10'
+ DC X'4003900000000000  0000000000000000'        lb'25'
+ DC X'4006C20000000000  0000000000000000'        lb'225'
+ DC X'400A162000000000  0000000000000000'        lb'2225'
+ DC X'400D5B4400000000  0000000000000000'        lb'22225'
+ DC X'4010B20880000000  0000000000000000'        lb'222225'
+ DC X'40140F4488000000  0000000000000000'        lb'2222225'
+ DC X'4017531591000000  0000000000000000'        lb'22222225'
+ DC X'401AA7DAF2200000  0000000000000000'        lb'222222225'
+ DC X'401E08E8D7220000  0000000000000000'        lb'2222222225'
+ DC X'40214B230CE44000  0000000000000000'        lb'22222222225'
+ DC X'40249DEBD01C8800  0000000000000000'        lb'222222222225'
+ DC X'402802B36211C880  0000000000000000'        lb'2222222222225'
+ DC X'402B43603A963910  0000000000000000'        lb'22222222222225'
+ DC X'402E9438493BC722  0000000000000000'        lb'222222222222225'
+ DC X'4031F9465B8AB8E4  4000000000000000'        lb'2222222222222225'
+ DC X'40353BCBF936B38E  4400000000000000'        lb'22222222222222225'
+ DC X'40388ABEF7846071  C880000000000000'        lb'222222222222222225'
+ DC X'403BED6EB565788E  3910000000000000'        lb'2222222222222222225'
+ DC X'403F3465315F6B58  E391000000000000'        lb'22222222222222222225'
+ DC X'4042817E7DB7462F  1C72200000000000'        lb'222222222222222222225'
+ DC X'4045E1DE1D2517BA  E38E440000000000'        lb'2222222222222222222225'
+ DC X'40492D2AD2372ED4  CE38E44000000000'        lb'22222222222222222222225'
+ DC X'404C787586C4FA8A  01C71C8800000000'        lb'222222222222222222222225'
+ DC X'404FD692E876392C  8238E39100000000'        lb'2222222222222222222222225'
+ DC X'4053261BD149E3BB  D1638E3910000000'        lb'22222222222222222222222225'
+ DC X'40566FA2C59C5CAA  C5BC71C722000000'        lb'222222222222222222222222225'
+ DC X'4059CB8B770373D5  772B8E38E4400000'        lb'2222222222222222222222222225'
+ DC X'405D1F372A622865  6A7B38E38E440000'        lb'22222222222222222222222222225'
+ DC X'40606704F4FAB27E  C51A071C71C88000'        lb'222222222222222222222222222225'
+ DC X'4063C0C632395F1E  766088E38E391000'        lb'2222222222222222222222222222225'
+ DC X'4067187BDF63DB73  09FC558E38E39100'        lb'22222222222222222222222222222225'
+ DC X'406A5E9AD73CD24F  CC7B6AF1C71C7220'        lb'222222222222222222222222222222225'
+ DC X'406DB6418D0C06E3  BF9A45AE38E38E44'        lb'2222222222222222222222222222222225'
+ DC X'407111E8F827844E  57C06B8CE38E38E4'        lb'22222222222222222222222222222222225'
+ DC X'407111E8F827844E  57C06B8CE38E38E5'        lb'22222222222222222222222222222222228'
+ DC X'407111E8F827844E  57C06B8CE38E38E5'        lb'22222222222222222222222222222222229'
+ DC X'407111E8F827844E  57C06B8CE38E38E6'        lb'22222222222222222222222222222222230'
+ DC X'4074566336316561  EDB086701C71C71D'        lb'222222222222222222222222222222222225'
+ DC X'4077ABFC03BDBEBA  691CA80C238E38E4'        lb'2222222222222222222222222222222222225'
+ DC X'407B0B7D82569734  81B1E9079638E38E'        lb'22222222222222222222222222222222222225'
+ DC X'407E4E5CE2EC3D01  A21E63497BC71C72'        lb'222222222222222222222222222222222222225'
+ DC X'4081A1F41BA74C42  0AA5FC1BDAB8E38E'        lb'2222222222222222222222222222222222222225'
+ DC X'4085053891488FA9  46A7BD9168B38E39'        lb'22222222222222222222222222222222222222225'
+ DC X'40884686B59AB393  9851ACF5C2E071C7'        lb'222222222222222222222222222222222222222225'
+ DC X'408B982863016078  7E66183333988E39'        lb'2222222222222222222222222222222222222222225'
+ DC X'408EFE327BC1B896  9DFF9E40007EB1C7'        lb'22222222222222222222222222222222222222222225'
+ DC X'40923EDF8D59135E  22BFC2E8004F2F1C'        lb'222222222222222222222222222222222222222222225'
+ DC X'40958E9770AF5835  AB6FB3A20062FAE4'        lb'2222222222222222222222222222222222222222222225'
+ DC X'4098F23D4CDB2E43  164BA08A807BB99C'        lb'22222222222222222222222222222222222222222222225'
+ DC X'409C37665008FCE9  EDEF4456904D5402'        lb'222222222222222222222222222222222222222222222225'
+ DC X'409F853FE40B3C24  696B156C3460A902'        lb'2222222222222222222222222222222222222222222222225'
+ DC X'40A2E68FDD0E0B2D  83C5DAC74178D343'        lb'22222222222222222222222222222222222222222222222225'
+ DC X'40A63019EA28C6FC  725BA8BC88EB840A'        lb'222222222222222222222222222222222222222222222222225'
+ DC X'40A97C2064B2F8BB  8EF292EBAB26650C'        lb'2222222222222222222222222222222222222222222222222225'
+ DC X'40ACDB287DDFB6EA  72AF37A695EFFE4F'        lb'22222222222222222222222222222222222222222222222222225'
+ DC X'40B028F94EABD252  87AD82C81DB5FEF2'        lb'222222222222222222222222222222222222222222222222222225'
+ DC X'40B37337A256C6E7  2998E37A25237EAE'        lb'2222222222222222222222222222222222222222222222222222225'
+ DC X'40B6D0058AEC78A0  F3FF1C58AE6C5E59'        lb'22222222222222222222222222222222222222222222222222222225'
+ DC X'40BA220376D3CB64  987F71B76D03BAF8'        lb'222222222222222222222222222222222222222222222222222222225'
+ DC X'40BD6A845488BE3D  BE9F4E254844A9B6'        lb'2222222222222222222222222222222222222222222222222222222225'
+ DC X'0000000000000000'                          lh'.0000000000000000000000000000000000000000000000001e-85'
+ DC X'0000000000000000'                          l'9.99999999999999999999999999999999999999999999999e-85'
+ DC X'4110000000000000'                          l'1e-86'
+ DC X'3F393EE5EEDCC20D'                          l'0.013976e77'
+ DC X'3FDD15F02C4D65E4'                          l'0.053976e77'
+ DC X'5A118427B3B4A05B  4CC8A8A4DE845987'        LH'0.1387778780781445675529539585113525390625E31'
+ DC X'0000000000000000'                          d'0'
+ DC X'22500000'                                  ed'0'
+ DC X'7E000000'                                  ed'(snan)'
+ DC X'7C000000'                                  ed'(qnan)'
+ DC X'78000000'                                  ed'(inf)'
+ DC X'22500001'                                  ed'1'
+ DC X'25F24491'                                  ed'1.111111111111111111111111111111111111111111111111111111111111'
+ DC X'22500011'                                  ed'11'
+ DC X'22500091'                                  ed'111'
+ DC X'22500491'                                  ed'1111'
+ DC X'22504491'                                  ed'11111'
+ DC X'22524491'                                  ed'111111'
+ DC X'26524491'                                  ed'1111111'
+ DC X'26624491'                                  ed'11111111'
+ DC X'26724491'                                  ed'111111111'
+ DC X'26824491'                                  ed'1111111111'
+ DC X'26924491'                                  ed'11111111111'
+ DC X'26A24491'                                  ed'111111111111'
+ DC X'26B24491'                                  ed'1111111111111'
+ DC X'26C24491'                                  ed'11111111111111'
+ DC X'26D24491'                                  ed'111111111111111'
+ DC X'26E24491'                                  ed'1111111111111111'
+ DC X'26F24491'                                  ed'11111111111111111'
+ DC X'27024491'                                  ed'111111111111111111'
+ DC X'27124491'                                  ed'1111111111111111111'
+ DC X'27224491'                                  ed'11111111111111111111'
+ DC X'27324491'                                  ed'111111111111111111111'
+ DC X'27424491'                                  ed'1111111111111111111111'
+ DC X'27524491'                                  ed'11111111111111111111111'
+ DC X'27624491'                                  ed'111111111111111111111111'
+ DC X'27724491'                                  ed'1111111111111111111111111'
+ DC X'27824491'                                  ed'11111111111111111111111111'
+ DC X'27924491'                                  ed'111111111111111111111111111'
+ DC X'27A24491'                                  ed'1111111111111111111111111111'
+ DC X'27B24491'                                  ed'11111111111111111111111111111'
+ DC X'27C24491'                                  ed'111111111111111111111111111111'
+ DC X'27D24491'                                  ed'1111111111111111111111111111111'
+ DC X'27E24491'                                  ed'11111111111111111111111111111111'
+ DC X'27F24491'                                  ed'111111111111111111111111111111111'
+ DC X'44024491'                                  ed'1111111111111111111111111111111111'
+ DC X'44124491'                                  ed'11111111111111111111111111111111111'
+ DC X'2664D2E8'                                  ed'12345675'
+ DC X'26700000'                                  ed'99999999'
+ DC X'26700000'                                  ed'99999999r8'
+ DC X'6E63FCFF'                                  ed'99999999r9'
+ DC X'2664D2E7'                                  ed'12345674r8'
+ DC X'2664D2E8'                                  ed'12345675r8'
+ DC X'2664D2E7'                                  ed'12345671r9'
+ DC X'2664D2E7'                                  ed'12345674r9'
+ DC X'2664D2E7'                                  ed'12345675r9'
+ DC X'43F00009'                                  ed'9e90'
+ DC X'43F0001A'                                  ed'90e90'
+ DC X'43F0008C'                                  ed'900e90'
+ DC X'43F02400'                                  ed'9000e90'
+ DC X'43F06800'                                  ed'90000e90'
+ DC X'43F23000'                                  ed'900000e90'
+ DC X'77F00000'                                  ed'9000000e90'
+ DC X'000000A3'                                  ed'.123e-98'
+ DC X'00100001'                                  ed'.1e-99'
+ DC X'00000001'                                  ed'.1e-100'
+ DC X'2238000000000000'                          dd'0'
+ DC X'7E00000000000000'                          dd'(snan)'
+ DC X'7C00000000000000'                          dd'(qnan)'
+ DC X'7800000000000000'                          dd'(inf)'
+ DC X'2238000000000001'                          dd'1'
+ DC X'25FC912449124491'                          dd'1.111111111111111111111111111111111111111111111111111111111111'
+ DC X'2238000000000011'                          dd'11'
+ DC X'2238000000000091'                          dd'111'
+ DC X'2238000000000491'                          dd'1111'
+ DC X'2238000000004491'                          dd'11111'
+ DC X'2238000000024491'                          dd'111111'
+ DC X'2238000000124491'                          dd'1111111'
+ DC X'2238000001124491'                          dd'11111111'
+ DC X'2238000009124491'                          dd'111111111'
+ DC X'2238000049124491'                          dd'1111111111'
+ DC X'2238000449124491'                          dd'11111111111'
+ DC X'2238002449124491'                          dd'111111111111'
+ DC X'2238012449124491'                          dd'1111111111111'
+ DC X'2238112449124491'                          dd'11111111111111'
+ DC X'2238912449124491'                          dd'111111111111111'
+ DC X'2638912449124491'                          dd'1111111111111111'
+ DC X'263C912449124491'                          dd'11111111111111111'
+ DC X'2640912449124491'                          dd'111111111111111111'
+ DC X'2644912449124491'                          dd'1111111111111111111'
+ DC X'2648912449124491'                          dd'11111111111111111111'
+ DC X'264C912449124491'                          dd'111111111111111111111'
+ DC X'2650912449124491'                          dd'1111111111111111111111'
+ DC X'2654912449124491'                          dd'11111111111111111111111'
+ DC X'2658912449124491'                          dd'111111111111111111111111'
+ DC X'265C912449124491'                          dd'1111111111111111111111111'
+ DC X'2660912449124491'                          dd'11111111111111111111111111'
+ DC X'2664912449124491'                          dd'111111111111111111111111111'
+ DC X'2668912449124491'                          dd'1111111111111111111111111111'
+ DC X'266C912449124491'                          dd'11111111111111111111111111111'
+ DC X'2670912449124491'                          dd'111111111111111111111111111111'
+ DC X'2674912449124491'                          dd'1111111111111111111111111111111'
+ DC X'2678912449124491'                          dd'11111111111111111111111111111111'
+ DC X'267C912449124491'                          dd'111111111111111111111111111111111'
+ DC X'2680912449124491'                          dd'1111111111111111111111111111111111'
+ DC X'2684912449124491'                          dd'11111111111111111111111111111111111'
+ DC X'2238000001271775'                          dd'12345675'
+ DC X'2238000005F3FCFF'                          dd'99999999'
+ DC X'2238000005F3FCFF'                          dd'99999999r8'
+ DC X'2238000005F3FCFF'                          dd'99999999r9'
+ DC X'2238000001271774'                          dd'12345674r8'
+ DC X'2238000001271775'                          dd'12345675r8'
+ DC X'2238000001271771'                          dd'12345671r9'
+ DC X'2238000001271774'                          dd'12345674r9'
+ DC X'2238000001271775'                          dd'12345675r9'
+ DC X'23A0000000000009'                          dd'9e90'
+ DC X'23A000000000001A'                          dd'90e90'
+ DC X'23A000000000008C'                          dd'900e90'
+ DC X'23A0000000002400'                          dd'9000e90'
+ DC X'23A0000000006800'                          dd'90000e90'
+ DC X'23A0000000023000'                          dd'900000e90'
+ DC X'23A0000000900000'                          dd'9000000e90'
+ DC X'23A0000001A00000'                          dd'90000000e90'
+ DC X'20A40000000000A3'                          dd'.123e-98'
+ DC X'20A00000000000A3'                          dd'.123e-99'
+ DC X'20A40000000000A3  20A00000000000A3'        dd'.123e-98,.123e-99'
+ DC X'20A00000000000A3  20A40000000000A3'        dd'.123e-99,.123e-98'
+ DC X'209C0000000000A3'                          dd'.123e-100'
+ DC X'20A8000000000001'                          dd'.1e-99'
+ DC X'20A4000000000001'                          dd'.1e-100'
+ DC X'20A0000000000004'                          dd'.04e-100'
+ DC X'20A0000000000009'                          dd'.09e-100'
+ DC X'20A0000000000014'                          dd'.14e-100'
+ DC X'20A0000000000015'                          dd'.15e-100'
+ DC X'20A0000000000001'                          dd'.1e-101'
+ DC X'2208000000000000  0000000000000000'        ld'0'
+ DC X'7E00000000000000  0000000000000000'        ld'(snan)'
+ DC X'7C00000000000000  0000000000000000'        ld'(qnan)'
+ DC X'7800000000000000  0000000000000000'        ld'(inf)'
+ DC X'2208000000000000  0000000000000001'        ld'1'
+ DC X'25FFC91244912449  1244912449124491'        ld'1.111111111111111111111111111111111111111111111111111111111111'
+ DC X'2208000000000000  0000000000000011'        ld'11'
+ DC X'2208000000000000  0000000000000091'        ld'111'
+ DC X'2208000000000000  0000000000000491'        ld'1111'
+ DC X'2208000000000000  0000000000004491'        ld'11111'
+ DC X'2208000000000000  0000000000024491'        ld'111111'
+ DC X'2208000000000000  0000000000124491'        ld'1111111'
+ DC X'2208000000000000  0000000001124491'        ld'11111111'
+ DC X'2208000000000000  0000000009124491'        ld'111111111'
+ DC X'2208000000000000  0000000049124491'        ld'1111111111'
+ DC X'2208000000000000  0000000449124491'        ld'11111111111'
+ DC X'2208000000000000  0000002449124491'        ld'111111111111'
+ DC X'2208000000000000  0000012449124491'        ld'1111111111111'
+ DC X'2208000000000000  0000112449124491'        ld'11111111111111'
+ DC X'2208000000000000  0000912449124491'        ld'111111111111111'
+ DC X'2208000000000000  0004912449124491'        ld'1111111111111111'
+ DC X'2208000000000000  0044912449124491'        ld'11111111111111111'
+ DC X'2208000000000000  0244912449124491'        ld'111111111111111111'
+ DC X'2208000000000000  1244912449124491'        ld'1111111111111111111'
+ DC X'2208000000000001  1244912449124491'        ld'11111111111111111111'
+ DC X'2208000000000009  1244912449124491'        ld'111111111111111111111'
+ DC X'2208000000000049  1244912449124491'        ld'1111111111111111111111'
+ DC X'2208000000000449  1244912449124491'        ld'11111111111111111111111'
+ DC X'2208000000002449  1244912449124491'        ld'111111111111111111111111'
+ DC X'2208000000012449  1244912449124491'        ld'1111111111111111111111111'
+ DC X'2208000000112449  1244912449124491'        ld'11111111111111111111111111'
+ DC X'2208000000912449  1244912449124491'        ld'111111111111111111111111111'
+ DC X'2208000004912449  1244912449124491'        ld'1111111111111111111111111111'
+ DC X'2208000044912449  1244912449124491'        ld'11111111111111111111111111111'
+ DC X'2208000244912449  1244912449124491'        ld'111111111111111111111111111111'
+ DC X'2208001244912449  1244912449124491'        ld'1111111111111111111111111111111'
+ DC X'2208011244912449  1244912449124491'        ld'11111111111111111111111111111111'
+ DC X'2208091244912449  1244912449124491'        ld'111111111111111111111111111111111'
+ DC X'2608091244912449  1244912449124491'        ld'1111111111111111111111111111111111'
+ DC X'2608491244912449  1244912449124491'        ld'11111111111111111111111111111111111'
+ DC X'2208000000000000  0000000001271775'        ld'12345675'
+ DC X'2208000000000000  0000000005F3FCFF'        ld'99999999'
+ DC X'2208000000000000  0000000005F3FCFF'        ld'99999999r8'
+ DC X'2208000000000000  0000000005F3FCFF'        ld'99999999r9'
+ DC X'2208000000000000  0000000001271774'        ld'12345674r8'
+ DC X'2208000000000000  0000000001271775'        ld'12345675r8'
+ DC X'2208000000000000  0000000001271771'        ld'12345671r9'
+ DC X'2208000000000000  0000000001271774'        ld'12345674r9'
+ DC X'2208000000000000  0000000001271775'        ld'12345675r9'
+ DC X'221E800000000000  0000000000000009'        ld'9e90'
+ DC X'221E800000000000  000000000000001A'        ld'90e90'
+ DC X'221E800000000000  000000000000008C'        ld'900e90'
+ DC X'221E800000000000  0000000000002400'        ld'9000e90'
+ DC X'221E800000000000  0000000000006800'        ld'90000e90'
+ DC X'221E800000000000  0000000000023000'        ld'900000e90'
+ DC X'221E800000000000  0000000000900000'        ld'9000000e90'
+ DC X'221E800000000000  0000000001A00000'        ld'90000000e90'
+ DC X'21EEC00000000000  00000000000000A3'        ld'.123e-98'
+ DC X'21EE800000000000  00000000000000A3'        ld'.123e-99'
+ DC X'21EEC00000000000  00000000000000A3'        ld'.123e-98,.123e-99'
+ DC X'21EE800000000000  00000000000000A3'
+ DC X'21EE800000000000  00000000000000A3'        ld'.123e-99,.123e-98'
+ DC X'21EEC00000000000  00000000000000A3'
+ DC X'21EE400000000000  00000000000000A3'        ld'.123e-100'
+ DC X'21EF000000000000  0000000000000001'        ld'.1e-99'
+ DC X'21EEC00000000000  0000000000000001'        ld'.1e-100'
+ DC X'21EE800000000000  0000000000000004'        ld'.04e-100'
+ DC X'21EE800000000000  0000000000000009'        ld'.09e-100'
+ DC X'21EE800000000000  0000000000000014'        ld'.14e-100'
+ DC X'21EE800000000000  0000000000000015'        ld'.15e-100'
+ DC X'21EE800000000000  0000000000000001'        ld'.1e-101'
+ DC X'0000'
+ DC X'4612D684'                                  eh'1234564.00r1'
+ DC X'4612D684'                                  eh'1234564.00r4'
+ DC X'4612D684'                                  eh'1234564.00r5'
+ DC X'4612D684'                                  eh'1234564.00r6'
+ DC X'4612D684'                                  eh'1234564.00r7'
+ DC X'4612D684'                                  eh'1234564.01r1'
+ DC X'4612D684'                                  eh'1234564.01r4'
+ DC X'4612D684'                                  eh'1234564.01r5'
+ DC X'4612D685'                                  eh'1234564.01r6'
+ DC X'4612D684'                                  eh'1234564.01r7'
+ DC X'4612D685'                                  eh'1234564.50r1'
+ DC X'4612D684'                                  eh'1234564.50r4'
+ DC X'4612D684'                                  eh'1234564.50r5'
+ DC X'4612D685'                                  eh'1234564.50r6'
+ DC X'4612D684'                                  eh'1234564.50r7'
+ DC X'4612D685'                                  eh'1234564.51r1'
+ DC X'4612D685'                                  eh'1234564.51r4'
+ DC X'4612D684'                                  eh'1234564.51r5'
+ DC X'4612D685'                                  eh'1234564.51r6'
+ DC X'4612D684'                                  eh'1234564.51r7'
+ DC X'4612D685'                                  eh'1234565.00r1'
+ DC X'4612D685'                                  eh'1234565.00r4'
+ DC X'4612D685'                                  eh'1234565.00r5'
+ DC X'4612D685'                                  eh'1234565.00r6'
+ DC X'4612D685'                                  eh'1234565.00r7'
+ DC X'4612D685'                                  eh'1234565.01r1'
+ DC X'4612D685'                                  eh'1234565.01r4'
+ DC X'4612D685'                                  eh'1234565.01r5'
+ DC X'4612D686'                                  eh'1234565.01r6'
+ DC X'4612D685'                                  eh'1234565.01r7'
+ DC X'4612D686'                                  eh'1234565.50r1'
+ DC X'4612D686'                                  eh'1234565.50r4'
+ DC X'4612D685'                                  eh'1234565.50r5'
+ DC X'4612D686'                                  eh'1234565.50r6'
+ DC X'4612D685'                                  eh'1234565.50r7'
+ DC X'4612D686'                                  eh'1234565.51r1'
+ DC X'4612D686'                                  eh'1234565.51r4'
+ DC X'4612D685'                                  eh'1234565.51r5'
+ DC X'4612D686'                                  eh'1234565.51r6'
+ DC X'4612D685'                                  eh'1234565.51r7'
+ DC X'4612D687'                                  eh'1234566.50r1'
+ DC X'4612D686'                                  eh'1234566.50r4'
+ DC X'4612D686'                                  eh'1234566.50r5'
+ DC X'4612D687'                                  eh'1234566.50r6'
+ DC X'4612D686'                                  eh'1234566.50r7'
+ DC X'4996B420'                                  eb'1234564.00r1'
+ DC X'4996B420'                                  eb'1234564.00r4'
+ DC X'4996B420'                                  eb'1234564.00r5'
+ DC X'4996B420'                                  eb'1234564.00r6'
+ DC X'4996B420'                                  eb'1234564.00r7'
+ DC X'4996B420'                                  eb'1234564.01r1'
+ DC X'4996B420'                                  eb'1234564.01r4'
+ DC X'4996B420'                                  eb'1234564.01r5'
+ DC X'4996B421'                                  eb'1234564.01r6'
+ DC X'4996B420'                                  eb'1234564.01r7'
+ DC X'4996B424'                                  eb'1234564.50r1'
+ DC X'4996B424'                                  eb'1234564.50r4'
+ DC X'4996B424'                                  eb'1234564.50r5'
+ DC X'4996B424'                                  eb'1234564.50r6'
+ DC X'4996B424'                                  eb'1234564.50r7'
+ DC X'4996B424'                                  eb'1234564.51r1'
+ DC X'4996B424'                                  eb'1234564.51r4'
+ DC X'4996B424'                                  eb'1234564.51r5'
+ DC X'4996B425'                                  eb'1234564.51r6'
+ DC X'4996B424'                                  eb'1234564.51r7'
+ DC X'4996B428'                                  eb'1234565.00r1'
+ DC X'4996B428'                                  eb'1234565.00r4'
+ DC X'4996B428'                                  eb'1234565.00r5'
+ DC X'4996B428'                                  eb'1234565.00r6'
+ DC X'4996B428'                                  eb'1234565.00r7'
+ DC X'4996B428'                                  eb'1234565.01r1'
+ DC X'4996B428'                                  eb'1234565.01r4'
+ DC X'4996B428'                                  eb'1234565.01r5'
+ DC X'4996B429'                                  eb'1234565.01r6'
+ DC X'4996B428'                                  eb'1234565.01r7'
+ DC X'4996B42C'                                  eb'1234565.50r1'
+ DC X'4996B42C'                                  eb'1234565.50r4'
+ DC X'4996B42C'                                  eb'1234565.50r5'
+ DC X'4996B42C'                                  eb'1234565.50r6'
+ DC X'4996B42C'                                  eb'1234565.50r7'
+ DC X'4996B42C'                                  eb'1234565.51r1'
+ DC X'4996B42C'                                  eb'1234565.51r4'
+ DC X'4996B42C'                                  eb'1234565.51r5'
+ DC X'4996B42D'                                  eb'1234565.51r6'
+ DC X'4996B42C'                                  eb'1234565.51r7'
+ DC X'4996B434'                                  eb'1234566.50r1'
+ DC X'4996B434'                                  eb'1234566.50r4'
+ DC X'4996B434'                                  eb'1234566.50r5'
+ DC X'4996B434'                                  eb'1234566.50r6'
+ DC X'4996B434'                                  eb'1234566.50r7'
+ DC X'C612D685'                                  eh'-1234564.51r4'
+ DC X'C612D684828F5C29'                          dh'-1234564.51r4'
+ DC X'C612D684'                                  eh'-1234564.00r1'
+ DC X'C612D684'                                  eh'-1234564.00r4'
+ DC X'C612D684'                                  eh'-1234564.00r5'
+ DC X'C612D684'                                  eh'-1234564.00r6'
+ DC X'C612D684'                                  eh'-1234564.00r7'
+ DC X'C612D684'                                  eh'-1234564.01r1'
+ DC X'C612D684'                                  eh'-1234564.01r4'
+ DC X'C612D684'                                  eh'-1234564.01r5'
+ DC X'C612D684'                                  eh'-1234564.01r6'
+ DC X'C612D685'                                  eh'-1234564.01r7'
+ DC X'C612D685'                                  eh'-1234564.50r1'
+ DC X'C612D684'                                  eh'-1234564.50r4'
+ DC X'C612D684'                                  eh'-1234564.50r5'
+ DC X'C612D684'                                  eh'-1234564.50r6'
+ DC X'C612D685'                                  eh'-1234564.50r7'
+ DC X'C612D685'                                  eh'-1234564.51r1'
+ DC X'C612D685'                                  eh'-1234564.51r4'
+ DC X'C612D684'                                  eh'-1234564.51r5'
+ DC X'C612D684'                                  eh'-1234564.51r6'
+ DC X'C612D685'                                  eh'-1234564.51r7'
+ DC X'C612D685'                                  eh'-1234565.00r1'
+ DC X'C612D685'                                  eh'-1234565.00r4'
+ DC X'C612D685'                                  eh'-1234565.00r5'
+ DC X'C612D685'                                  eh'-1234565.00r6'
+ DC X'C612D685'                                  eh'-1234565.00r7'
+ DC X'C612D685'                                  eh'-1234565.01r1'
+ DC X'C612D685'                                  eh'-1234565.01r4'
+ DC X'C612D685'                                  eh'-1234565.01r5'
+ DC X'C612D685'                                  eh'-1234565.01r6'
+ DC X'C612D686'                                  eh'-1234565.01r7'
+ DC X'C612D686'                                  eh'-1234565.50r1'
+ DC X'C612D686'                                  eh'-1234565.50r4'
+ DC X'C612D685'                                  eh'-1234565.50r5'
+ DC X'C612D685'                                  eh'-1234565.50r6'
+ DC X'C612D686'                                  eh'-1234565.50r7'
+ DC X'C612D686'                                  eh'-1234565.51r1'
+ DC X'C612D686'                                  eh'-1234565.51r4'
+ DC X'C612D685'                                  eh'-1234565.51r5'
+ DC X'C612D685'                                  eh'-1234565.51r6'
+ DC X'C612D686'                                  eh'-1234565.51r7'
+ DC X'C612D687'                                  eh'-1234566.50r1'
+ DC X'C612D686'                                  eh'-1234566.50r4'
+ DC X'C612D686'                                  eh'-1234566.50r5'
+ DC X'C612D686'                                  eh'-1234566.50r6'
+ DC X'C612D687'                                  eh'-1234566.50r7'
+ DC X'C996B420'                                  eb'-1234564.00r1'
+ DC X'C996B420'                                  eb'-1234564.00r4'
+ DC X'C996B420'                                  eb'-1234564.00r5'
+ DC X'C996B420'                                  eb'-1234564.00r6'
+ DC X'C996B420'                                  eb'-1234564.00r7'
+ DC X'C996B420'                                  eb'-1234564.01r1'
+ DC X'C996B420'                                  eb'-1234564.01r4'
+ DC X'C996B420'                                  eb'-1234564.01r5'
+ DC X'C996B420'                                  eb'-1234564.01r6'
+ DC X'C996B421'                                  eb'-1234564.01r7'
+ DC X'C996B424'                                  eb'-1234564.50r1'
+ DC X'C996B424'                                  eb'-1234564.50r4'
+ DC X'C996B424'                                  eb'-1234564.50r5'
+ DC X'C996B424'                                  eb'-1234564.50r6'
+ DC X'C996B424'                                  eb'-1234564.50r7'
+ DC X'C996B424'                                  eb'-1234564.51r1'
+ DC X'C996B424'                                  eb'-1234564.51r4'
+ DC X'C996B424'                                  eb'-1234564.51r5'
+ DC X'C996B424'                                  eb'-1234564.51r6'
+ DC X'C996B425'                                  eb'-1234564.51r7'
+ DC X'C996B428'                                  eb'-1234565.00r1'
+ DC X'C996B428'                                  eb'-1234565.00r4'
+ DC X'C996B428'                                  eb'-1234565.00r5'
+ DC X'C996B428'                                  eb'-1234565.00r6'
+ DC X'C996B428'                                  eb'-1234565.00r7'
+ DC X'C996B428'                                  eb'-1234565.01r1'
+ DC X'C996B428'                                  eb'-1234565.01r4'
+ DC X'C996B428'                                  eb'-1234565.01r5'
+ DC X'C996B428'                                  eb'-1234565.01r6'
+ DC X'C996B429'                                  eb'-1234565.01r7'
+ DC X'C996B42C'                                  eb'-1234565.50r1'
+ DC X'C996B42C'                                  eb'-1234565.50r4'
+ DC X'C996B42C'                                  eb'-1234565.50r5'
+ DC X'C996B42C'                                  eb'-1234565.50r6'
+ DC X'C996B42C'                                  eb'-1234565.50r7'
+ DC X'C996B42C'                                  eb'-1234565.51r1'
+ DC X'C996B42C'                                  eb'-1234565.51r4'
+ DC X'C996B42C'                                  eb'-1234565.51r5'
+ DC X'C996B42C'                                  eb'-1234565.51r6'
+ DC X'C996B42D'                                  eb'-1234565.51r7'
+ DC X'C996B434'                                  eb'-1234566.50r1'
+ DC X'C996B434'                                  eb'-1234566.50r4'
+ DC X'C996B434'                                  eb'-1234566.50r5'
+ DC X'C996B434'                                  eb'-1234566.50r6'
@@ -0,0 +1,316 @@
+* Decimal floating point arithmetic and compare tests
+*
+* Each case loads the rounding mode into the FPC, runs one instruction
+* and stores the result, the FPC and the condition code (from IPM).
+* MDTR and DDTR leave the condition code unchanged.
+* The expected results were computed independently with the decimal
+* arithmetic rules at 16 and 34 digits; an FPC of 00080000 means that
+* the inexact flag is set.
+
+*Testcase ADTR MDTR DDTR rounding and inexact
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000530002F # LCTLG R0,R0,CTLR0  Set CR0 AFP control
+r 206=B29D0500     # LFPC FPCMODE0
+r 20A=68200800     # LD 2,OPA0
+r 20E=68400808     # LD 4,OPB0
+r 212=B3D24002     # ADTR 0,2,4
+r 216=60000600     # STD 0,RES0
+r 21A=B29C0608     # STFPC RES0+8
+r 21E=B2220090     # IPM R9
+r 222=5090060C     # ST R9,RES0+12
+r 226=B29D0500     # LFPC FPCMODE0
+r 22A=68200810     # LD 2,OPA1
+r 22E=68400818     # LD 4,OPB1
+r 232=B3D24002     # ADTR 0,2,4
+r 236=60000610     # STD 0,RES1
+r 23A=B29C0618     # STFPC RES1+8
+r 23E=B2220090     # IPM R9
+r 242=5090061C     # ST R9,RES1+12
+r 246=B29D0500     # LFPC FPCMODE0
+r 24A=68200820     # LD 2,OPA2
+r 24E=68400828     # LD 4,OPB2
+r 252=B3D24002     # ADTR 0,2,4
+r 256=60000620     # STD 0,RES2
+r 25A=B29C0628     # STFPC RES2+8
+r 25E=B2220090     # IPM R9
+r 262=5090062C     # ST R9,RES2+12
+r 266=B29D0504     # LFPC FPCMODE1
+r 26A=68200830     # LD 2,OPA3
+r 26E=68400838     # LD 4,OPB3
+r 272=B3D24002     # ADTR 0,2,4
+r 276=60000630     # STD 0,RES3
+r 27A=B29C0638     # STFPC RES3+8
+r 27E=B2220090     # IPM R9
+r 282=5090063C     # ST R9,RES3+12
+r 286=B29D0500     # LFPC FPCMODE0
+r 28A=68200840     # LD 2,OPA4
+r 28E=68400848     # LD 4,OPB4
+r 292=B3D24002     # ADTR 0,2,4
+r 296=60000640     # STD 0,RES4
+r 29A=B29C0648     # STFPC RES4+8
+r 29E=B2220090     # IPM R9
+r 2A2=5090064C     # ST R9,RES4+12
+r 2A6=B29D0500     # LFPC FPCMODE0
+r 2AA=68200850     # LD 2,OPA5
+r 2AE=68400858     # LD 4,OPB5
+r 2B2=B3D24002     # ADTR 0,2,4
+r 2B6=60000650     # STD 0,RES5
+r 2BA=B29C0658     # STFPC RES5+8
+r 2BE=B2220090     # IPM R9
+r 2C2=5090065C     # ST R9,RES5+12
+r 2C6=B29D0500     # LFPC FPCMODE0
+r 2CA=68200860     # LD 2,OPA6
+r 2CE=68400868     # LD 4,OPB6
+r 2D2=B3D04002     # MDTR 0,2,4
+r 2D6=60000660     # STD 0,RES6
+r 2DA=B29C0668     # STFPC RES6+8
+r 2DE=B2220090     # IPM R9
+r 2E2=5090066C     # ST R9,RES6+12
+r 2E6=B29D0500     # LFPC FPCMODE0
+r 2EA=68200870     # LD 2,OPA7
+r 2EE=68400878     # LD 4,OPB7
+r 2F2=B3D04002     # MDTR 0,2,4
+r 2F6=60000670     # STD 0,RES7
+r 2FA=B29C0678     # STFPC RES7+8
+r 2FE=B2220090     # IPM R9
+r 302=5090067C     # ST R9,RES7+12
+r 306=B29D0510     # LFPC FPCMODE4
+r 30A=68200880     # LD 2,OPA8
+r 30E=68400888     # LD 4,OPB8
+r 312=B3D04002     # MDTR 0,2,4
+r 316=60000680     # STD 0,RES8
+r 31A=B29C0688     # STFPC RES8+8
+r 31E=B2220090     # IPM R9
+r 322=5090068C     # ST R9,RES8+12
+r 326=B29D0500     # LFPC FPCMODE0
+r 32A=68200890     # LD 2,OPA9
+r 32E=68400898     # LD 4,OPB9
+r 332=B3D04002     # MDTR 0,2,4
+r 336=60000690     # STD 0,RES9
+r 33A=B29C0698     # STFPC RES9+8
+r 33E=B2220090     # IPM R9
+r 342=5090069C     # ST R9,RES9+12
+r 346=B29D0500     # LFPC FPCMODE0
+r 34A=682008A0     # LD 2,OPA10
+r 34E=684008A8     # LD 4,OPB10
+r 352=B3D14002     # DDTR 0,2,4
+r 356=600006A0     # STD 0,RES10
+r 35A=B29C06A8     # STFPC RES10+8
+r 35E=B2220090     # IPM R9
+r 362=509006AC     # ST R9,RES10+12
+r 366=B29D0508     # LFPC FPCMODE2
+r 36A=682008B0     # LD 2,OPA11
+r 36E=684008B8     # LD 4,OPB11
+r 372=B3D14002     # DDTR 0,2,4
+r 376=600006B0     # STD 0,RES11
+r 37A=B29C06B8     # STFPC RES11+8
+r 37E=B2220090     # IPM R9
+r 382=509006BC     # ST R9,RES11+12
+r 386=B29D050C     # LFPC FPCMODE3
+r 38A=682008C0     # LD 2,OPA12
+r 38E=684008C8     # LD 4,OPB12
+r 392=B3D14002     # DDTR 0,2,4
+r 396=600006C0     # STD 0,RES12
+r 39A=B29C06C8     # STFPC RES12+8
+r 39E=B2220090     # IPM R9
+r 3A2=509006CC     # ST R9,RES12+12
+r 3A6=B29D0504     # LFPC FPCMODE1
+r 3AA=682008D0     # LD 2,OPA13
+r 3AE=684008D8     # LD 4,OPB13
+r 3B2=B3D14002     # DDTR 0,2,4
+r 3B6=600006D0     # STD 0,RES13
+r 3BA=B29C06D8     # STFPC RES13+8
+r 3BE=B2220090     # IPM R9
+r 3C2=509006DC     # ST R9,RES13+12
+r 3C6=B29D0500     # LFPC FPCMODE0
+r 3CA=682008E0     # LD 2,OPA14
+r 3CE=684008E8     # LD 4,OPB14
+r 3D2=B3D14002     # DDTR 0,2,4
+r 3D6=600006E0     # STD 0,RES14
+r 3DA=B29C06E8     # STFPC RES14+8
+r 3DE=B2220090     # IPM R9
+r 3E2=509006EC     # ST R9,RES14+12
+r 3E6=B29D0500     # LFPC FPCMODE0
+r 3EA=682008F0     # LD 2,OPA15
+r 3EE=684008F8     # LD 4,OPB15
+r 3F2=B3D14002     # DDTR 0,2,4
+r 3F6=600006F0     # STD 0,RES15
+r 3FA=B29C06F8     # STFPC RES15+8
+r 3FE=B2220090     # IPM R9
+r 402=509006FC     # ST R9,RES15+12
+r 406=B2B20520     # LPSWE WAITPSW
+r 500=00000000                         # FPCMODE0
+r 504=00000010                         # FPCMODE1
+r 508=00000020                         # FPCMODE2
+r 50C=00000030                         # FPCMODE3
+r 510=00000040                         # FPCMODE4
+r 514=00000050                         # FPCMODE5
+r 518=00000060                         # FPCMODE6
+r 51C=00000070                         # FPCMODE7
+r 520=00020001800000000000000000000000 # WAITPSW
+r 530=0000000000040000                 # CTLR0
+r 800=22380000000000012238000000000002 # OPA0 1, OPB0 2
+r 810=6E38FF3FCFF3FCFF2238000000000001 # OPA1 9999999999999999, OPB1 1
+r 820=6E38FF3FCFF3FCFF2234000000000005 # OPA2 9999999999999999, OPB2 0.5
+r 830=6E38FF3FCFF3FCFF2234000000000005 # OPA3 9999999999999999, OPB3 0.5
+r 840=2234000000000015A230000000000225 # OPA4 1.5, OPB4 -4.25
+r 850=22300000000000D0A234000000000015 # OPA5 1.50, OPB5 -1.5
+r 860=263934B9C1E28E562238000000000009 # OPA6 1234567890123456, OPB6 9
+r 870=2A3A692D78A5199D2238000000000005 # OPA7 2469135780246913, OPB7 5
+r 880=2A3A692D78A5199D2238000000000005 # OPA8 2469135780246913, OPB8 5
+r 890=22340000000000152230000000000150 # OPA9 1.5, OPB9 2.50
+r 8A0=22380000000000012238000000000003 # OPA10 1, OPB10 3
+r 8B0=22380000000000012238000000000003 # OPA11 1, OPB11 3
+r 8C0=A2380000000000022238000000000003 # OPA12 -2, OPB12 3
+r 8D0=22380000000000022238000000000003 # OPA13 2, OPB13 3
+r 8E0=22380000000000012238000000000004 # OPA14 1, OPB14 4
+r 8F0=22340000000000602238000000000002 # OPA15 6.0, OPB15 2
+ostailor null
+runtest .1
+*Compare
+r 600.10
+*Want "ADTR 1 + 2 = 3" 22380000 00000003 00000000 20000000
+r 610.10
+*Want "ADTR carry to 17 digits, exact = 1.000000000000000E+16" 263C0000 00000000 00000000 20000000
+r 620.10
+*Want "ADTR half to even, inexact = 1.000000000000000E+16" 263C0000 00000000 00080000 20000000
+r 630.10
+*Want "ADTR toward zero, inexact = 9999999999999999" 6E38FF3F CFF3FCFF 00080010 20000000
+r 640.10
+*Want "ADTR negative result = -2.75" A2300000 00000175 00000000 10000000
+r 650.10
+*Want "ADTR zero keeps smaller exponent = 0.00" 22300000 00000000 00000000 00000000
+r 660.10
+*Want "MDTR 17-digit product rounded = 1.111111101111110E+16" 263C9124 48124490 00080000 00000000
+r 670.10
+*Want "MDTR tie, half to even = 1.234567890123456E+16" 263D34B9 C1E28E56 00080000 00000000
+r 680.10
+*Want "MDTR tie, half away from zero = 1.234567890123457E+16" 263D34B9 C1E28E57 00080040 00000000
+r 690.10
+*Want "MDTR exponent is the sum = 3.750" 222C0000 00000FD0 00000000 00000000
+r 6A0.10
+*Want "DDTR 1/3 to nearest = 0.3333333333333333" 2DF9B36C DB36CDB3 00080000 00000000
+r 6B0.10
+*Want "DDTR 1/3 toward +infinity = 0.3333333333333334" 2DF9B36C DB36CDB4 00080020 00000000
+r 6C0.10
+*Want "DDTR -2/3 toward -infinity = -0.6666666666666667" B9FB66D9 B66D9B67 00080030 00000000
+r 6D0.10
+*Want "DDTR 2/3 toward zero = 0.6666666666666666" 39FB66D9 B66D9B66 00080010 00000000
+r 6E0.10
+*Want "DDTR 1/4 exact = 0.25" 22300000 00000025 00000000 00000000
+r 6F0.10
+*Want "DDTR 6.0/2 exact = 3.0" 22340000 00000030 00000000 00000000
+*Done
+
+*Testcase CXTR compare extended
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000530002F # LCTLG R0,R0,CTLR0  Set CR0 AFP control
+r 206=B29D0500     # LFPC FPCMODE0
+r 20A=68000800     # LD 0,OPA0
+r 20E=68200808     # LD 2,OPA0+8
+r 212=68400810     # LD 4,OPB0
+r 216=68600818     # LD 6,OPB0+8
+r 21A=B3EC0004     # CXTR 0,4
+r 21E=B29C0600     # STFPC RES0
+r 222=B2220090     # IPM R9
+r 226=50900604     # ST R9,RES0+4
+r 22A=B29D0500     # LFPC FPCMODE0
+r 22E=68000820     # LD 0,OPA1
+r 232=68200828     # LD 2,OPA1+8
+r 236=68400830     # LD 4,OPB1
+r 23A=68600838     # LD 6,OPB1+8
+r 23E=B3EC0004     # CXTR 0,4
+r 242=B29C0608     # STFPC RES1
+r 246=B2220090     # IPM R9
+r 24A=5090060C     # ST R9,RES1+4
+r 24E=B29D0500     # LFPC FPCMODE0
+r 252=68000840     # LD 0,OPA2
+r 256=68200848     # LD 2,OPA2+8
+r 25A=68400850     # LD 4,OPB2
+r 25E=68600858     # LD 6,OPB2+8
+r 262=B3EC0004     # CXTR 0,4
+r 266=B29C0610     # STFPC RES2
+r 26A=B2220090     # IPM R9
+r 26E=50900614     # ST R9,RES2+4
+r 272=B29D0500     # LFPC FPCMODE0
+r 276=68000860     # LD 0,OPA3
+r 27A=68200868     # LD 2,OPA3+8
+r 27E=68400870     # LD 4,OPB3
+r 282=68600878     # LD 6,OPB3+8
+r 286=B3EC0004     # CXTR 0,4
+r 28A=B29C0618     # STFPC RES3
+r 28E=B2220090     # IPM R9
+r 292=5090061C     # ST R9,RES3+4
+r 296=B29D0500     # LFPC FPCMODE0
+r 29A=68000880     # LD 0,OPA4
+r 29E=68200888     # LD 2,OPA4+8
+r 2A2=68400890     # LD 4,OPB4
+r 2A6=68600898     # LD 6,OPB4+8
+r 2AA=B3EC0004     # CXTR 0,4
+r 2AE=B29C0620     # STFPC RES4
+r 2B2=B2220090     # IPM R9
+r 2B6=50900624     # ST R9,RES4+4
+r 2BA=B29D0500     # LFPC FPCMODE0
+r 2BE=680008A0     # LD 0,OPA5
+r 2C2=682008A8     # LD 2,OPA5+8
+r 2C6=684008B0     # LD 4,OPB5
+r 2CA=686008B8     # LD 6,OPB5+8
+r 2CE=B3EC0004     # CXTR 0,4
+r 2D2=B29C0628     # STFPC RES5
+r 2D6=B2220090     # IPM R9
+r 2DA=5090062C     # ST R9,RES5+4
+r 2DE=B2B20520     # LPSWE WAITPSW
+r 500=00000000                         # FPCMODE0
+r 520=00020001800000000000000000000000 # WAITPSW
+r 530=0000000000040000                 # CTLR0
+r 800=2207C000000000000000000000000010 # OPA0 1.0
+r 810=22080000000000000000000000000001 # OPB0 1
+r 820=A2080000000000000000000000000001 # OPA1 -1
+r 830=22080000000000000000000000000001 # OPB1 1
+r 840=22080000000000000000000000000002 # OPA2 2
+r 850=22080000000000000000000000000001 # OPB2 1
+r 860=6E080FF3FCFF3FCFF3FCFF3FCFF3FCFF # OPA3 34 nines
+r 870=22108000000000000000000000000001 # OPB3 1E34
+r 880=7C000000000000000000000000000000 # OPA4 NaN
+r 890=22080000000000000000000000000001 # OPB4 1
+r 8A0=7E000000000000000000000000000000 # OPA5 sNaN
+r 8B0=22080000000000000000000000000001 # OPB5 1
+ostailor null
+runtest .1
+*Compare
+r 600.10
+*Want "1.0 equals 1; -1 is low" 00000000 00000000 00000000 10000000
+r 610.10
+*Want "2 is high; 34 nines below 1E34" 00000000 20000000 00000000 10000000
+r 620.10
+*Want "Quiet NaN is unordered; Signaling NaN is unordered and invalid" 00000000 30000000 00800000 30000000
+*Done
+
+*Testcase DDTR inexact with the IEEE-inexact mask on
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000530002F # LCTLG R0,R0,CTLR0  Set CR0 AFP control
+r 206=B29D0500     # LFPC FPCMASK       Inexact mask on, round to nearest
+r 20A=68200800     # LD 2,OPA
+r 20E=68400808     # LD 4,OPB
+r 212=B3D14002     # DDTR 0,2,4         2/3 rounds up, inexact
+r 216=B2B20520     # LPSWE WAITPSW      Not reached
+r 500=08000000                         # FPCMASK
+r 520=00020001800000000000000000000000 # WAITPSW
+r 530=0000000000040000                 # CTLR0
+r 800=22380000000000022238000000000003 # OPA 2, OPB 3
+ostailor null
+*Program 7
+runtest .1
+*Compare
+r 90.4
+*Want "DXC 0C, inexact and incremented" 0000000C
+*Done
@@ -0,0 +1,9 @@
+# This test file was generated from offline assembler source
+# by bldhtc.rexx 16 Jan 2016 12:11:11
+# Treat as object code.  That is, modifications will be lost.
+# assemble and listing files are provided for information only.
+*Testcase invpsw processed 16 Jan 2016 12:11:11 by bldhtc.rexx
+r    1D0=0000000100000000FFFFFFFFDEADDEAD
+runtest .1
+*Program 1
+*Done
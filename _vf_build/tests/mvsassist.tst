@@ -0,0 +1,39 @@
+* MVS assist lock instructions
+*
+* Obtains the local lock, retries it to take the software path through
+* the lock interface table, then releases it.  Checks the lockword, the
+* locks held indicators, the register 13 results and the register 12
+* error exit address.
+
+*Testcase Obtain and release local lock
+sysclear
+archmode S/370
+r 000=0008000000000200 # EC mode restart PSW
+r 068=000A00000000DEAD # EC mode pgm new PSW
+r 200=E504040002F8     # OLL  ASCBPTR,PSAHLHI  Obtain local lock
+r 206=50D00300         # ST   R13,RESULT       Zero, lock obtained
+r 20A=D20703100880     # MVC  RESULT+16(8),ASCBLOCK
+r 210=E504040002F8     # OLL  ASCBPTR,PSAHLHI  Already held: LITOLOC
+r 216=50D00304         # LOLFAIL ST R13,RESULT+4
+r 21A=E505040002F8     # RLL  ASCBPTR,PSAHLHI  Release local lock
+r 220=50D00308         # ST   R13,RESULT+8     Zero, lock released
+r 224=50C0030C         # ST   R12,RESULT+12    Error exit address
+r 228=82000280         # LPSW WAITPSW
+r 280=000A000000000000 # WAITPSW
+r 2F4=00000040         # PSALCPUA              Logical CPU address
+r 2F8=00000000         # PSAHLHI               No locks held
+r 2FC=00000510         # Lock interface table address
+r 400=00000800         # ASCBPTR
+r 500=00000216         # LITOLOC               Obtain local error exit
+r 880=0000000000000000 # ASCBLOCK, ASCBLSWQ
+runtest .1
+*Compare
+r 310.8
+*Want "Lock held by CPU 40" 00000040 00000000
+r 300.10
+*Want "Obtained, error exit, released" 00000000 00000216 00000000 00000216
+r 880.8
+*Want "Lock released" 00000000 00000000
+r 2F8.4
+*Want "No locks held" 00000000
+*Done
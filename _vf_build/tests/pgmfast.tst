@@ -0,0 +1,27 @@
+* Program interruption fast path
+*
+* With program interruption tracing suppressed (ostailor null) the
+* protection exception below is presented on the fast path.  Checks
+* the program interruption code and the program old PSW.
+
+*Testcase Low-address protection exception
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 35 (LAP)
+r 206=92AA0100     # MVI X'100',X'AA'   Protection exception
+r 20A=B2B20290     # LPSWE FAILPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0000000010000000                 # CTLR0
+ostailor null
+*Program 0004
+runtest .1
+*Compare
+r 8C.4
+*Want "Interruption code 0004, ilc 4" 00040004
+r 100.4
+*Want "Store suppressed" 00000000
+r 150.10
+*Want "Old PSW designates next instruction" 00000001 80000000 00000000 0000020A
+*Done
@@ -0,0 +1,241 @@
+* Transactional-execution facility tests
+*
+* Each test enables the TX control in CR0 (bit 8), runs a short
+* transaction and checks the stores, registers, condition code and
+* transaction diagnostic blocks left behind.
+
+*Testcase TBEGIN TEND commit
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=E5600000FF00 # TBEGIN 0,X'FF00'   Begin, save all GR pairs
+r 20C=92AA0400     # MVI RESULT,X'AA'   Transactional store
+r 210=41200001     # LA R2,1            Modify R2
+r 214=B2F80000     # TEND               End transaction
+r 218=B2220030     # IPM R3             Save condition code
+r 21C=50300404     # ST R3,RESULT+4
+r 220=B2EC0040     # ETND R4            Extract nesting depth
+r 224=50400408     # ST R4,RESULT+8
+r 228=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 300=0080000000000000                 # CTLR0
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "Stores committed, cc 0, depth 0" AA000000 00000000 00000000 00000000
+gpr
+*Gpr 2 1
+*Done
+
+*Testcase TABORT discards stores and stores TDB
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=41200005     # LA R2,5            Value to be restored
+r 20A=41500500     # LA R5,TDB          TDB address
+r 20E=E56050004000 # TBEGIN 0(R5),X'4000' Save R2-R3, TDB at 500
+r 214=A774000A     # BRC 7,ABORTED      Branch if aborted
+r 218=92BB0400     # MVI RESULT,X'BB'   Transactional store
+r 21C=41200009     # LA R2,9            Modify R2
+r 220=B2FC0101     # TABORT 257         Abort, odd code gives cc 3
+r 224=B2B20290     # LPSWE FAILPSW
+r 228=B2220030     # ABORTED IPM R3     Save condition code
+r 22C=50300404     # ST R3,RESULT+4
+r 230=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "Store discarded, cc 3" 00000000 30000000 00000000 00000000
+gpr
+*Gpr 2 5
+r 500.10
+*Want "TDB format, depth and abort code" 01000000 00000001 00000000 00000101
+r 510.10
+*Want "TDB aborted instruction address" 00000000 00000000 00000000 00000220
+r 590.10
+*Want "TDB R2 and R3 at abort" 00000000 00000009 00000000 00000000
+*Done
+
+*Testcase Filtered program interruption
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=41500500     # LA R5,TDB          TDB address
+r 20A=E56050000001 # TBEGIN 0(R5),X'0001' PIFC 1, TDB at 500
+r 210=A7740008     # BRC 7,ABORTED      Branch if aborted
+r 214=4F200310     # CVB R2,BADDEC      Data exception (filtered)
+r 218=B2F80000     # TEND
+r 21C=B2B20290     # LPSWE FAILPSW
+r 220=B2220030     # ABORTED IPM R3     Save condition code
+r 224=50300404     # ST R3,RESULT+4
+r 228=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+r 310=0000000000000000                 # BADDEC  Invalid sign
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "No interruption, cc 3" 00000000 30000000 00000000 00000000
+r 500.10
+*Want "TDB abort code 12" 01000000 00000001 00000000 0000000C
+*Done
+
+*Testcase Unfiltered program interruption
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=E56000000000 # TBEGIN 0,0         PIFC 0, no TDB
+r 20C=92DD0400     # MVI RESULT,X'DD'   Transactional store
+r 210=4F200310     # CVB R2,BADDEC      Data exception (not filtered)
+r 214=B2F80000     # TEND
+r 218=B2B20290     # LPSWE FAILPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+r 310=0000000000000000                 # BADDEC  Invalid sign
+ostailor null
+*Program 0207
+runtest .1
+*Compare
+r 400.4
+*Want "Store discarded" 00000000
+r 150.10
+*Want "Old PSW is the abort PSW" 00002001 80000000 00000000 0000020C
+r 1800.10
+*Want "Program-interruption TDB" 01000000 00000001 00000000 00000004
+*Done
+
+*Testcase Restricted instruction
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=41500500     # LA R5,TDB          TDB address
+r 20A=E56050000000 # TBEGIN 0(R5),0     TDB at 500
+r 210=A7740008     # BRC 7,ABORTED      Branch if aborted
+r 214=B2100310     # SPX PREFIX         Restricted in a transaction
+r 218=B2F80000     # TEND
+r 21C=B2B20290     # LPSWE FAILPSW
+r 220=B2220030     # ABORTED IPM R3     Save condition code
+r 224=50300404     # ST R3,RESULT+4
+r 228=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+r 310=00002000                         # PREFIX
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "Prefix unchanged, cc 3" 00000000 30000000 00000000 00000000
+r 500.10
+*Want "TDB abort code 11" 01000000 00000001 00000000 0000000B
+*Done
+
+*Testcase Nested transactions and ETND
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=E56000000000 # TBEGIN 0,0         Outer transaction
+r 20C=E56000000000 # TBEGIN 0,0         Inner transaction
+r 212=B2EC0040     # ETND R4            Nesting depth 2
+r 216=50400400     # ST R4,RESULT
+r 21A=B2F80000     # TEND               End inner transaction
+r 21E=B2F80000     # TEND               End outer transaction
+r 222=B2EC0050     # ETND R5            Nesting depth 0
+r 226=50500404     # ST R5,RESULT+4
+r 22A=B2F80000     # TEND               Not in a transaction: cc 2
+r 22E=B2220030     # IPM R3             Save condition code
+r 232=50300408     # ST R3,RESULT+8
+r 236=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 300=0080000000000000                 # CTLR0
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "Depth 2, depth 0, cc 2" 00000002 00000000 20000000 00000000
+*Done
+
+*Testcase NTSTG survives abort
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=41200077     # LA R2,X'77'
+r 20A=E56000000000 # TBEGIN 0,0
+r 210=A774000B     # BRC 7,ABORTED      Branch if aborted
+r 214=E32004000025 # NTSTG R2,RESULT    Nontransactional store
+r 21A=92EE0408     # MVI RESULT+8,X'EE' Transactional store
+r 21E=B2FC0100     # TABORT 256         Abort, even code gives cc 2
+r 222=B2B20290     # LPSWE FAILPSW
+r 226=B2220030     # ABORTED IPM R3     Save condition code
+r 22A=5030040C     # ST R3,RESULT+12
+r 22E=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "NTSTG kept, MVI discarded, cc 2" 00000000 00000077 00000000 20000000
+*Done
+
+*Testcase Constrained transaction
+sysclear
+archmode z
+archlvl enable transact_exec
+archlvl enable constrained_transact
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 bit 8 (TX control)
+r 206=E56100000000 # TBEGINC 0,0
+r 20C=92CC0400     # MVI RESULT,X'CC'   Transactional store
+r 210=B2F80000     # TEND               Commit
+r 214=E56100000000 # TBEGINC 0,0
+r 21A=E56100000000 # TBEGINC 0,0        Transaction-constraint exception
+r 220=B2B20290     # LPSWE FAILPSW
+r 290=00020001800000000000000000000BAD # FAILPSW
+r 300=0080000000000000                 # CTLR0
+ostailor null
+*Program 0218
+runtest .1
+*Compare
+r 400.4
+*Want "First transaction committed" CC000000
+r 150.10
+*Want "Old PSW designates TBEGINC" 00002001 80000000 00000000 00000214
+*Done
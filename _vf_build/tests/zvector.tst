@@ -0,0 +1,312 @@
+* Vector facility tests
+*
+* Each test sets the AFP-register and vector-enablement controls in
+* CR0, runs a short sequence of vector instructions and stores the
+* results and condition codes.  Condition codes are stored by IPM, so
+* a word of 10000000 is cc 1, 30000000 is cc 3 and so on.
+
+*Testcase VL VST VLBB VLL VSTL VLGV
+sysclear
+archmode z
+archlvl enable vector
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 AFP and VX controls
+r 206=E71006000006 # VL V1,SOURCE
+r 20C=E7100400000E # VST V1,RESULT
+r 212=E7F006000806 # VL V31,SOURCE     V31 via the RXB field
+r 218=E7F00410080E # VST V31,RESULT+X'10'
+r 21E=E72006100006 # VL V2,FILL
+r 224=E72006FC0007 # VLBB V2,BLOCK+4,0  Four bytes to 64-byte boundary
+r 22A=E7200420000E # VST V2,RESULT+X'20'
+r 230=E72006F86007 # VLBB V2,BLOCK,6    Sixteen bytes, 4K boundary
+r 236=E7200430000E # VST V2,RESULT+X'30'
+r 23C=E73006100006 # VL V3,FILL
+r 242=41400004     # LA R4,4
+r 246=E73406000037 # VLL V3,R4,SOURCE   Five bytes, rest zeroed
+r 24C=E7300440000E # VST V3,RESULT+X'40'
+r 252=41500002     # LA R5,2
+r 256=E7150450003F # VSTL V1,R5,RESULT+X'50'  Three bytes
+r 25C=41600064     # LA R6,100
+r 260=E7160460003F # VSTL V1,R6,RESULT+X'60'  Length capped at 16
+r 266=60100470     # STD F1,RESULT+X'70'      FPR1 overlays V1
+r 26A=E77100013021 # VLGV R7,V1,1,3     Doubleword element 1
+r 270=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 300=0000000000060000                 # CTLR0
+r 450=FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF # Preset VSTL target
+r 600=00112233445566778899AABBCCDDEEFF # SOURCE
+r 610=EEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEE # FILL
+r 6F8=01020304050607081112131415161718 # BLOCK
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "VL VST" 00112233 44556677 8899AABB CCDDEEFF
+r 410.10
+*Want "VL VST V31" 00112233 44556677 8899AABB CCDDEEFF
+r 420.10
+*Want "VLBB to 64-byte boundary" 05060708 EEEEEEEE EEEEEEEE EEEEEEEE
+r 430.10
+*Want "VLBB to 4K boundary" 01020304 05060708 11121314 15161718
+r 440.10
+*Want "VLL 5 bytes" 00112233 44000000 00000000 00000000
+r 450.10
+*Want "VSTL 3 bytes" 001122FF FFFFFFFF FFFFFFFF FFFFFFFF
+r 460.10
+*Want "VSTL capped" 00112233 44556677 8899AABB CCDDEEFF
+r 470.8
+*Want "STD of FPR1" 00112233 44556677
+gpr
+*Gpr 7 8899AABBCCDDEEFF
+*Done
+
+*Testcase VRR integer arithmetic, logical and compare
+sysclear
+archmode z
+archlvl enable vector
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 AFP and VX controls
+r 206=E71006000006 # VL V1,OPA
+r 20C=E72006100006 # VL V2,OPB
+r 212=E731200000F3 # VA V3,V1,V2,0      Add bytes
+r 218=E7300400000E # VST V3,RESULT
+r 21E=E731200030F3 # VA V3,V1,V2,3      Add doublewords
+r 224=E7300410000E # VST V3,RESULT+X'10'
+r 22A=E731200010F7 # VS V3,V1,V2,1      Subtract halfwords
+r 230=E7300420000E # VST V3,RESULT+X'20'
+r 236=E73120000068 # VN V3,V1,V2
+r 23C=E7300430000E # VST V3,RESULT+X'30'
+r 242=E7312000006A # VO V3,V1,V2
+r 248=E7300440000E # VST V3,RESULT+X'40'
+r 24E=E7312000006D # VX V3,V1,V2
+r 254=E7300450000E # VST V3,RESULT+X'50'
+r 25A=E731200000FE # VMN V3,V1,V2,0     Signed byte minimum
+r 260=E7300460000E # VST V3,RESULT+X'60'
+r 266=E731200000FD # VMXL V3,V1,V2,0    Logical byte maximum
+r 26C=E7300470000E # VST V3,RESULT+X'70'
+r 272=E731200000F0 # VAVGL V3,V1,V2,0   Logical byte average
+r 278=E7300480000E # VST V3,RESULT+X'80'
+r 27E=E731200020F2 # VAVG V3,V1,V2,2    Signed word average
+r 284=E7300490000E # VST V3,RESULT+X'90'
+r 28A=E731200010A2 # VML V3,V1,V2,1     Halfword multiply low
+r 290=E73004A0000E # VST V3,RESULT+X'A0'
+r 296=E731201000F8 # VCEQBS V3,V1,V2
+r 29C=E73004B0000E # VST V3,RESULT+X'B0'
+r 2A2=B2220090     # IPM R9
+r 2A6=509004F0     # ST R9,CCS
+r 2AA=E731201000FB # VCHBS V3,V1,V2
+r 2B0=E73004C0000E # VST V3,RESULT+X'C0'
+r 2B6=B2220090     # IPM R9
+r 2BA=509004F4     # ST R9,CCS+4
+r 2BE=E731201020F9 # VCHLFS V3,V1,V2
+r 2C4=E73004D0000E # VST V3,RESULT+X'D0'
+r 2CA=B2220090     # IPM R9
+r 2CE=509004F8     # ST R9,CCS+8
+r 2D2=E731101030F8 # VCEQGS V3,V1,V1    All equal
+r 2D8=B2220090     # IPM R9
+r 2DC=509004FC     # ST R9,CCS+12
+r 2E0=B2B20380     # LPSWE WAITPSW      Load disabled wait PSW
+r 300=0000000000060000                 # CTLR0
+r 380=00020001800000000000000000000000 # WAITPSW
+r 600=017F80FF10203040FFFFFFFF00000001 # OPA
+r 610=010101010F30303F00000001FFFFFFFF # OPB
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "VAB" 02808100 1F50607F FFFFFF00 FFFFFF00
+r 410.10
+*Want "VAG" 02808200 1F50607F 00000001 00000000
+r 420.10
+*Want "VSH" 007E7FFE 00F00001 FFFFFFFE 00010002
+r 430.10
+*Want "VN" 01010001 00203000 00000001 00000001
+r 440.10
+*Want "VO" 017F81FF 1F30307F FFFFFFFF FFFFFFFF
+r 450.10
+*Want "VX" 007E81FE 1F10007F FFFFFFFE FFFFFFFE
+r 460.10
+*Want "VMNB" 010180FF 0F20303F FFFFFFFF FFFFFFFF
+r 470.10
+*Want "VMXLB" 017F80FF 10303040 FFFFFFFF FFFFFFFF
+r 480.10
+*Want "VAVGLB" 01404180 10283040 80808080 80808080
+r 490.10
+*Want "VAVGF" 01404100 0FA83040 00000000 00000000
+r 4A0.10
+*Want "VMLHW" 807F7FFF E600DFC0 0000FFFF 0000FFFF
+r 4B0.10
+*Want "VCEQBS" FF000000 0000FF00 00000000 00000000
+r 4C0.10
+*Want "VCHBS" 00FF0000 FF0000FF 00000000 FFFFFFFF
+r 4D0.10
+*Want "VCHLFS" FFFFFFFF FFFFFFFF FFFFFFFF 00000000
+r 4F0.10
+*Want "Compare condition codes 1 1 1 0" 10000000 10000000 10000000 00000000
+*Done
+
+*Testcase VPERM
+sysclear
+archmode z
+archlvl enable vector
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 AFP and VX controls
+r 206=E71006000006 # VL V1,OPA
+r 20C=E72006100006 # VL V2,OPB
+r 212=E74006200006 # VL V4,PATTERN
+r 218=E7312000408C # VPERM V3,V1,V2,V4
+r 21E=E7300400000E # VST V3,RESULT
+r 224=E74006300806 # VL V20,PATTERN2
+r 22A=E7F12000498C # VPERM V31,V1,V2,V20  V31 and V20 via RXB
+r 230=E7F00410080E # VST V31,RESULT+X'10'
+r 236=B2B20280     # LPSWE WAITPSW      Load disabled wait PSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 300=0000000000060000                 # CTLR0
+r 600=101112131415161718191A1B1C1D1E1F # OPA
+r 610=202122232425262728292A2B2C2D2E2F # OPB
+r 620=1F00100F01113F2005150A1A0717E3C8 # PATTERN, high bits ignored
+r 630=0F0E0D0C0B0A09081716151413121110 # PATTERN2
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "VPERM" 2F10201F 11212F10 15251A2A 17271318
+r 410.10
+*Want "VPERM V31 V20" 1F1E1D1C 1B1A1918 27262524 23222120
+*Done
+
+*Testcase VFEE VFAE VSTRC
+sysclear
+archmode z
+archlvl enable vector
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB0003F0002F # LCTLG R0,R0,CTLR0  Set CR0 AFP and VX controls
+r 206=E71006000006 # VL V1,STRING       "ABCDE",0,"GHIJKLMNOP"
+r 20C=E72006100006 # VL V2,XSTRING
+r 212=E74006200006 # VL V4,ZSTRING
+r 218=E76006300006 # VL V6,ANYEH
+r 21E=E77006400006 # VL V7,ANYG
+r 224=E78006500006 # VL V8,RANGEDG
+r 22A=E79006600006 # VL V9,RANGECTL
+r 230=E7A006700006 # VL V10,RANGEGH
+r 236=E7B006800006 # VL V11,RANGEXZ
+r 23C=E73120100080 # VFEEBS V3,V1,V2     Equal at 9
+r 242=E7300400000E # VST V3,RESULT
+r 248=B2220090     # IPM R9
+r 24C=50900500     # ST R9,CCS
+r 250=E73120300080 # VFEEZBS V3,V1,V2    Zero at 5 first
+r 256=E7300410000E # VST V3,RESULT+X'10'
+r 25C=B2220090     # IPM R9
+r 260=50900504     # ST R9,CCS+4
+r 264=E73140100080 # VFEEBS V3,V1,V4     No match
+r 26A=E7300420000E # VST V3,RESULT+X'20'
+r 270=B2220090     # IPM R9
+r 274=50900508     # ST R9,CCS+8
+r 278=E73160100082 # VFAEBS V3,V1,V6     First E or H
+r 27E=E7300430000E # VST V3,RESULT+X'30'
+r 284=B2220090     # IPM R9
+r 288=5090050C     # ST R9,CCS+12
+r 28C=E73160500082 # VFAEBS V3,V1,V6,RT  Mask of E and H
+r 292=E7300440000E # VST V3,RESULT+X'40'
+r 298=B2220090     # IPM R9
+r 29C=50900510     # ST R9,CCS+16
+r 2A0=E73160900082 # VFAEBS V3,V1,V6,IN  First neither E nor H
+r 2A6=E7300450000E # VST V3,RESULT+X'50'
+r 2AC=B2220090     # IPM R9
+r 2B0=50900514     # ST R9,CCS+20
+r 2B4=E73160700082 # VFAEZBS V3,V1,V6,RT Mask stops at zero
+r 2BA=E7300460000E # VST V3,RESULT+X'60'
+r 2C0=B2220090     # IPM R9
+r 2C4=50900518     # ST R9,CCS+24
+r 2C8=E73170300082 # VFAEZBS V3,V1,V7    Zero before G
+r 2CE=E7300470000E # VST V3,RESULT+X'70'
+r 2D4=B2220090     # IPM R9
+r 2D8=5090051C     # ST R9,CCS+28
+r 2DC=E7318010908A # VSTRCBS V3,V1,V8,V9 First of D-G
+r 2E2=E7300480000E # VST V3,RESULT+X'80'
+r 2E8=B2220090     # IPM R9
+r 2EC=50900520     # ST R9,CCS+32
+r 2F0=E7318050908A # VSTRCBS V3,V1,V8,V9,RT  Mask of D-G
+r 2F6=E7300490000E # VST V3,RESULT+X'90'
+r 2FC=B2220090     # IPM R9
+r 300=50900524     # ST R9,CCS+36
+r 304=E731A030908A # VSTRCZBS V3,V1,V10,V9  Zero before G-H
+r 30A=E73004A0000E # VST V3,RESULT+X'A0'
+r 310=B2220090     # IPM R9
+r 314=50900528     # ST R9,CCS+40
+r 318=E731B010908A # VSTRCBS V3,V1,V11,V9  No X-Z
+r 31E=E73004B0000E # VST V3,RESULT+X'B0'
+r 324=B2220090     # IPM R9
+r 328=5090052C     # ST R9,CCS+44
+r 32C=B2B20380     # LPSWE WAITPSW      Load disabled wait PSW
+r 380=00020001800000000000000000000000 # WAITPSW
+r 3F0=0000000000060000                 # CTLR0
+r 600=4142434445004748494A4B4C4D4E4F50 # STRING
+r 610=5858585858585858584A585858585858 # XSTRING, J at 9
+r 620=5A5A5A5A5A5A5A5A5A5A5A5A5A5A5A5A # ZSTRING
+r 630=45484548454845484548454845484548 # ANYEH
+r 640=47474747474747474747474747474747 # ANYG
+r 650=44470000000000000000000000000000 # RANGEDG
+r 660=A0C00000000000000000000000000000 # RANGECTL, GE then LE
+r 670=47480000000000000000000000000000 # RANGEGH
+r 680=585A0000000000000000000000000000 # RANGEXZ
+ostailor null
+runtest .1
+*Compare
+r 400.10
+*Want "VFEE index 9" 00000000 00000009 00000000 00000000
+r 410.10
+*Want "VFEE zero index 5" 00000000 00000005 00000000 00000000
+r 420.10
+*Want "VFEE no match" 00000000 00000010 00000000 00000000
+r 430.10
+*Want "VFAE index 4" 00000000 00000004 00000000 00000000
+r 440.10
+*Want "VFAE RT mask" 00000000 FF0000FF 00000000 00000000
+r 450.10
+*Want "VFAE IN index 0" 00000000 00000000 00000000 00000000
+r 460.10
+*Want "VFAE ZS RT mask" 00000000 FF000000 00000000 00000000
+r 470.10
+*Want "VFAE zero index 5" 00000000 00000005 00000000 00000000
+r 480.10
+*Want "VSTRC index 3" 00000000 00000003 00000000 00000000
+r 490.10
+*Want "VSTRC RT mask" 000000FF FF00FF00 00000000 00000000
+r 4A0.10
+*Want "VSTRC zero index 5" 00000000 00000005 00000000 00000000
+r 4B0.10
+*Want "VSTRC no match" 00000000 00000010 00000000 00000000
+r 500.10
+*Want "VFEE VFAE cc 1 0 3 1" 10000000 00000000 30000000 10000000
+r 510.10
+*Want "VFAE cc 1 1 1 0" 10000000 10000000 10000000 00000000
+r 520.10
+*Want "VSTRC cc 1 1 0 3" 10000000 10000000 00000000 30000000
+*Done
+
+*Testcase Vector instruction with VX control off
+sysclear
+archmode z
+archlvl enable vector
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=EB000300002F # LCTLG R0,R0,CTLR0  Set CR0 AFP control only
+r 206=E71006000006 # VL V1,SOURCE       Data exception
+r 20C=B2B20280     # LPSWE WAITPSW      Not reached
+r 280=00020001800000000000000000000000 # WAITPSW
+r 300=0000000000040000                 # CTLR0
+r 600=00112233445566778899AABBCCDDEEFF # SOURCE
+ostailor null
+*Program 7
+runtest .1
+*Compare
+r 8C.4
+*Want "Data exception, ilc 6" 00060007
+r 90.4
+*Want "DXC FE" 000000FE
+*Done
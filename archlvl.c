@@ -308,6 +308,17 @@ FACILITY(INTERLOCKED_ACCESS_2, Z390,     NONE,      Z390,          ALS1 | ALS2 |
 #if defined(_FEATURE_MISC_INSTRUCTION_EXTENSIONS_FACILITY)
 FACILITY(MISC_INST_EXTN_1,Z390,          NONE,      Z390,          ALS3)
 #endif
+#if defined(_FEATURE_ZVECTOR_FACILITY)
+/* Not enabled by default: only the integer, string, load/store and
+   permute instruction groups are implemented (no vector FP) */
+FACILITY(VECTOR,           0, /*ZARCH*/  NONE,      ZARCH,         ALS3)
+#endif
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+/* Not enabled by default: conflicts are detected when the outermost
+   transaction ends, not when the conflicting access is made */
+FACILITY(TRANSACT_EXEC,    0, /*ZARCH*/  NONE,      ZARCH,         ALS3)
+FACILITY(CONSTRAINED_TRANSACT, 0, /*ZARCH*/ NONE,   ZARCH,         ALS3)
+#endif
 
 /* The Following entries are not part of STFL(E) but do indicate the availability of facilities */
 FACILITY(MOVE_INVERSE,     S370|ESA390|ZARCH, ZARCH, S370|ESA390|ZARCH, ALS0|ALS1|ALS2|ALS3)
@@ -58,6 +58,25 @@
 #define LITOCMS         (-8)            /* Obtain CMS error exit     */
 #define LITRCMS         (-4)            /* Release CMS error exit    */
 
+/*-------------------------------------------------------------------*/
+/* The lock assists change the lockword with a single compare and    */
+/* swap, so the main-storage access lock is only needed on hosts     */
+/* without interlocked compare and swap instructions                 */
+/*-------------------------------------------------------------------*/
+#if defined(ASSIST_CMPXCHG4) && defined(ASSIST_CMPXCHG8)
+ #define OBTAIN_ASSIST_LOCK(_regs)      do { } while (0)
+ #define RELEASE_ASSIST_LOCK(_regs)     do { } while (0)
+#else
+ #define OBTAIN_ASSIST_LOCK(_regs)      OBTAIN_MAINLOCK(_regs)
+ #define RELEASE_ASSIST_LOCK(_regs)     RELEASE_MAINLOCK(_regs)
+#endif
+
+/* Count an assist as performed or as handed back to software */
+#define ASSIST_PERFORMED(_inst, _regs) \
+        (_regs)->hostregs->mvsahit[(_inst)[1] & 0x0F]++
+#define ASSIST_DECLINED(_inst, _regs) \
+        (_regs)->hostregs->mvsamiss[(_inst)[1] & 0x0F]++
+
 #endif /*!defined(_ASSIST_C)*/
 
 
@@ -78,6 +97,8 @@ VADR    effective_addr1,
     PTT_ERR("*E502 PGFIX",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 #endif /*!defined(FEATURE_S390_DAT) && !defined(FEATURE_ESAME)*/
 
@@ -99,6 +120,8 @@ VADR    effective_addr1,
     /*INCOMPLETE: NO ACTION IS TAKEN, THE SVC IS UNASSISTED
                   AND MVS WILL HAVE TO HANDLE THE SITUATION*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -115,8 +138,11 @@ VADR    lock_addr;                      /* Virtual addr of ASCBLOCK  */
 U32     hlhi_word;                      /* Highest lock held word    */
 VADR    lit_addr;                       /* Virtual address of lock
                                            interface table           */
-U32     lock;                           /* Lock value                */
 U32     lcpa;                           /* Logical CPU address       */
+U32     old;                            /* Expected lock value       */
+BYTE   *main2;                          /* Mainstor addr of operand 2*/
+BYTE   *mainl;                          /* Mainstor addr of lock     */
+int     cc = 1;                         /* 0=Lock obtained           */
 VADR    newia;                          /* Unsuccessful branch addr  */
 int     acc_mode = 0;                   /* access mode to use        */
 
@@ -130,9 +156,6 @@ int     acc_mode = 0;                   /* access mode to use        */
 
     PERFORM_SERIALIZATION(regs);
 
-    /* Obtain main-storage access lock */
-    OBTAIN_MAINLOCK(regs);
-
     if (ACCESS_REGISTER_MODE(&regs->psw))
         acc_mode = USE_PRIMARY_SPACE;
 
@@ -147,26 +170,34 @@ int     acc_mode = 0;                   /* access mode to use        */
 
     lock_addr = (ascb_addr + ASCBLOCK) & ADDRESS_MAXWRAP(regs);
 
-    /* Fetch the local lock from the ASCB */
-    lock = ARCH_DEP(vfetch4) ( lock_addr, acc_mode, regs );
-
-    /* Obtain the local lock if not already held by any CPU */
-    if (lock == 0
-        && (hlhi_word & PSALCLLI) == 0)
+    /* Try for the local lock unless this CPU already holds it */
+    if ((hlhi_word & PSALCLLI) == 0
+        && (lock_addr & 0x00000003) == 0)
     {
-        /* Store the unchanged value into the second operand to
-           ensure suppression in the event of an access exception */
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
-
-        /* Store our logical CPU address in ASCBLOCK */
-        ARCH_DEP(vstore4) ( lcpa, lock_addr, acc_mode, regs );
-
-        /* Set the local lock held bit in the second operand */
-        hlhi_word |= PSALCLLI;
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
+        /* Translate both operands before the lock is changed so
+           that any access exception leaves the lock untouched  */
+        main2 = MADDRL (effective_addr2, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+        mainl = MADDRL (lock_addr, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+
+        /* Store our logical CPU address in ASCBLOCK if it is zero */
+        old = 0;
+        OBTAIN_ASSIST_LOCK(regs);
+        cc = cmpxchg4 (&old, CSWAP32(lcpa), mainl);
+        RELEASE_ASSIST_LOCK(regs);
+
+        if (cc == 0)
+            /* Set the local lock held bit in the second operand */
+            STORE_FW (main2, hlhi_word | PSALCLLI);
+    }
 
+    if (cc == 0)
+    {
         /* Set register 13 to zero to indicate lock obtained */
         regs->GR_L(13) = 0;
+
+        ASSIST_PERFORMED(inst, regs);
     }
     else
     {
@@ -185,10 +216,9 @@ int     acc_mode = 0;                   /* access mode to use        */
 
         /* Update the PSW instruction address */
         UPD_PSW_IA(regs, newia);
-    }
 
-    /* Release main-storage access lock */
-    RELEASE_MAINLOCK(regs);
+        ASSIST_DECLINED(inst, regs);
+    }
 
     PERFORM_SERIALIZATION(regs);
 
@@ -205,13 +235,15 @@ VADR    effective_addr1,
         effective_addr2;                /* Effective addresses       */
 VADR    ascb_addr;                      /* Virtual address of ASCB   */
 VADR    lock_addr;                      /* Virtual addr of ASCBLOCK  */
-VADR    susp_addr;                      /* Virtual addr of ASCBLSWQ  */
 U32     hlhi_word;                      /* Highest lock held word    */
 VADR    lit_addr;                       /* Virtual address of lock
                                            interface table           */
-U32     lock;                           /* Lock value                */
-U32     susp;                           /* Lock suspend queue        */
 U32     lcpa;                           /* Logical CPU address       */
+U64     old;                            /* Expected lock and suspend
+                                           queue doubleword          */
+BYTE   *main2;                          /* Mainstor addr of operand 2*/
+BYTE   *mainl;                          /* Mainstor addr of lock     */
+int     cc = 1;                         /* 0=Lock released           */
 VADR    newia;                          /* Unsuccessful branch addr  */
 int     acc_mode = 0;                   /* access mode to use        */
 
@@ -223,9 +255,6 @@ int     acc_mode = 0;                   /* access mode to use        */
     if ((effective_addr1 & 0x00000003) || (effective_addr2 & 0x00000003))
         ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
 
-    /* Obtain main-storage access lock */
-    OBTAIN_MAINLOCK(regs);
-
     if (ACCESS_REGISTER_MODE(&regs->psw))
         acc_mode = USE_PRIMARY_SPACE;
 
@@ -238,31 +267,39 @@ int     acc_mode = 0;                   /* access mode to use        */
     /* Fetch our logical CPU address from PSALCPUA */
     lcpa = ARCH_DEP(vfetch4) ( effective_addr2 - 4, acc_mode, regs );
 
-    /* Fetch the local lock and the suspend queue from the ASCB */
+    /* ASCBLOCK and ASCBLSWQ form a doubleword in the ASCB */
     lock_addr = (ascb_addr + ASCBLOCK) & ADDRESS_MAXWRAP(regs);
-    susp_addr = (ascb_addr + ASCBLSWQ) & ADDRESS_MAXWRAP(regs);
-    lock = ARCH_DEP(vfetch4) ( lock_addr, acc_mode, regs );
-    susp = ARCH_DEP(vfetch4) ( susp_addr, acc_mode, regs );
-
-    /* Test if this CPU holds the local lock, and does not hold
-       any CMS lock, and the local lock suspend queue is empty */
-    if (lock == lcpa
-        && (hlhi_word & (PSALCLLI | PSACMSLI)) == PSALCLLI
-        && susp == 0)
-    {
-        /* Store the unchanged value into the second operand to
-           ensure suppression in the event of an access exception */
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
-
-        /* Set the local lock to zero */
-        ARCH_DEP(vstore4) ( 0, lock_addr, acc_mode, regs );
 
-        /* Clear the local lock held bit in the second operand */
-        hlhi_word &= ~PSALCLLI;
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
+    /* Try to release the local lock if this CPU holds it and
+       does not hold any CMS lock */
+    if ((hlhi_word & (PSALCLLI | PSACMSLI)) == PSALCLLI
+        && (lock_addr & 0x00000007) == 0)
+    {
+        /* Translate both operands before the lock is changed so
+           that any access exception leaves the lock untouched  */
+        main2 = MADDRL (effective_addr2, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+        mainl = MADDRL (lock_addr, 8, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+
+        /* Set the local lock to zero if it holds our logical CPU
+           address and the local lock suspend queue is empty     */
+        old = CSWAP64((U64)lcpa << 32);
+        OBTAIN_ASSIST_LOCK(regs);
+        cc = cmpxchg8 (&old, 0, mainl);
+        RELEASE_ASSIST_LOCK(regs);
+
+        if (cc == 0)
+            /* Clear the local lock held bit in the second operand */
+            STORE_FW (main2, hlhi_word & ~PSALCLLI);
+    }
 
+    if (cc == 0)
+    {
         /* Set register 13 to zero to indicate lock released */
         regs->GR_L(13) = 0;
+
+        ASSIST_PERFORMED(inst, regs);
     }
     else
     {
@@ -281,10 +318,9 @@ int     acc_mode = 0;                   /* access mode to use        */
 
         /* Update the PSW instruction address */
         UPD_PSW_IA(regs, newia);
-    }
 
-    /* Release main-storage access lock */
-    RELEASE_MAINLOCK(regs);
+        ASSIST_DECLINED(inst, regs);
+    }
 
 } /* end function release_local_lock */
 
@@ -302,8 +338,10 @@ U32     hlhi_word;                      /* Highest lock held word    */
 VADR    lit_addr;                       /* Virtual address of lock
                                            interface table           */
 VADR    lock_addr;                      /* Lock address              */
-int     lock_arn;                       /* Lock access register      */
-U32     lock;                           /* Lock value                */
+U32     old;                            /* Expected lock value       */
+BYTE   *main2;                          /* Mainstor addr of operand 2*/
+BYTE   *mainl;                          /* Mainstor addr of lock     */
+int     cc = 1;                         /* 0=Lock obtained           */
 VADR    newia;                          /* Unsuccessful branch addr  */
 int     acc_mode = 0;                   /* access mode to use        */
 
@@ -319,10 +357,6 @@ int     acc_mode = 0;                   /* access mode to use        */
 
     /* General register 11 contains the lock address */
     lock_addr = regs->GR_L(11) & ADDRESS_MAXWRAP(regs);
-    lock_arn = 11;
-
-    /* Obtain main-storage access lock */
-    OBTAIN_MAINLOCK(regs);
 
     if (ACCESS_REGISTER_MODE(&regs->psw))
         acc_mode = USE_PRIMARY_SPACE;
@@ -333,27 +367,35 @@ int     acc_mode = 0;                   /* access mode to use        */
     /* Load locks held bits from second operand location */
     hlhi_word = ARCH_DEP(vfetch4) ( effective_addr2, acc_mode, regs );
 
-    /* Fetch the lock addressed by general register 11 */
-    lock = ARCH_DEP(vfetch4) ( lock_addr, acc_mode, regs );
-
-    /* Obtain the lock if not held by any ASCB, and if this CPU
-       holds the local lock and does not hold a CMS lock */
-    if (lock == 0
-        && (hlhi_word & (PSALCLLI | PSACMSLI)) == PSALCLLI)
+    /* Try for the lock if this CPU holds the local lock
+       and does not hold a CMS lock */
+    if ((hlhi_word & (PSALCLLI | PSACMSLI)) == PSALCLLI
+        && (lock_addr & 0x00000003) == 0)
     {
-        /* Store the unchanged value into the second operand to
-           ensure suppression in the event of an access exception */
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
-
-        /* Store the ASCB address in the CMS lock */
-        ARCH_DEP(vstore4) ( ascb_addr, lock_addr, acc_mode, regs );
-
-        /* Set the CMS lock held bit in the second operand */
-        hlhi_word |= PSACMSLI;
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
+        /* Translate both operands before the lock is changed so
+           that any access exception leaves the lock untouched  */
+        main2 = MADDRL (effective_addr2, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+        mainl = MADDRL (lock_addr, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+
+        /* Store the ASCB address in the CMS lock if it is zero */
+        old = 0;
+        OBTAIN_ASSIST_LOCK(regs);
+        cc = cmpxchg4 (&old, CSWAP32((U32)ascb_addr), mainl);
+        RELEASE_ASSIST_LOCK(regs);
+
+        if (cc == 0)
+            /* Set the CMS lock held bit in the second operand */
+            STORE_FW (main2, hlhi_word | PSACMSLI);
+    }
 
+    if (cc == 0)
+    {
         /* Set register 13 to zero to indicate lock obtained */
         regs->GR_L(13) = 0;
+
+        ASSIST_PERFORMED(inst, regs);
     }
     else
     {
@@ -372,10 +414,9 @@ int     acc_mode = 0;                   /* access mode to use        */
 
         /* Update the PSW instruction address */
         UPD_PSW_IA(regs, newia);
-    }
 
-    /* Release main-storage access lock */
-    RELEASE_MAINLOCK(regs);
+        ASSIST_DECLINED(inst, regs);
+    }
 
     PERFORM_SERIALIZATION(regs);
 
@@ -395,9 +436,11 @@ U32     hlhi_word;                      /* Highest lock held word    */
 VADR    lit_addr;                       /* Virtual address of lock
                                            interface table           */
 VADR    lock_addr;                      /* Lock address              */
-int     lock_arn;                       /* Lock access register      */
-U32     lock;                           /* Lock value                */
-U32     susp;                           /* Lock suspend queue        */
+U64     old;                            /* Expected lock and suspend
+                                           queue doubleword          */
+BYTE   *main2;                          /* Mainstor addr of operand 2*/
+BYTE   *mainl;                          /* Mainstor addr of lock     */
+int     cc = 1;                         /* 0=Lock released           */
 VADR    newia;                          /* Unsuccessful branch addr  */
 int     acc_mode = 0;                   /* access mode to use        */
 
@@ -411,10 +454,6 @@ int     acc_mode = 0;                   /* access mode to use        */
 
     /* General register 11 contains the lock address */
     lock_addr = regs->GR_L(11) & ADDRESS_MAXWRAP(regs);
-    lock_arn = 11;
-
-    /* Obtain main-storage access lock */
-    OBTAIN_MAINLOCK(regs);
 
     if (ACCESS_REGISTER_MODE(&regs->psw))
         acc_mode = USE_PRIMARY_SPACE;
@@ -425,29 +464,36 @@ int     acc_mode = 0;                   /* access mode to use        */
     /* Load locks held bits from second operand location */
     hlhi_word = ARCH_DEP(vfetch4) ( effective_addr2, acc_mode, regs );
 
-    /* Fetch the CMS lock and the suspend queue word */
-    lock = ARCH_DEP(vfetch4) ( lock_addr, acc_mode, regs );
-    susp = ARCH_DEP(vfetch4) ( lock_addr + 4, acc_mode, regs );
-
-    /* Test if current ASCB holds this lock, the locks held indicators
-       show a CMS lock is held, and the lock suspend queue is empty */
-    if (lock == ascb_addr
-        && (hlhi_word & PSACMSLI)
-        && susp == 0)
+    /* Try to release the lock if the locks held indicators
+       show a CMS lock is held */
+    if ((hlhi_word & PSACMSLI)
+        && (lock_addr & 0x00000007) == 0)
     {
-        /* Store the unchanged value into the second operand to
-           ensure suppression in the event of an access exception */
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
-
-        /* Set the CMS lock to zero */
-        ARCH_DEP(vstore4) ( 0, lock_addr, acc_mode, regs );
-
-        /* Clear the CMS lock held bit in the second operand */
-        hlhi_word &= ~PSACMSLI;
-        ARCH_DEP(vstore4) ( hlhi_word, effective_addr2, acc_mode, regs );
+        /* Translate both operands before the lock is changed so
+           that any access exception leaves the lock untouched  */
+        main2 = MADDRL (effective_addr2, 4, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+        mainl = MADDRL (lock_addr, 8, acc_mode, regs,
+                        ACCTYPE_WRITE, regs->psw.pkey);
+
+        /* Set the CMS lock to zero if the current ASCB holds it
+           and the lock suspend queue word is zero              */
+        old = CSWAP64((U64)(U32)ascb_addr << 32);
+        OBTAIN_ASSIST_LOCK(regs);
+        cc = cmpxchg8 (&old, 0, mainl);
+        RELEASE_ASSIST_LOCK(regs);
+
+        if (cc == 0)
+            /* Clear the CMS lock held bit in the second operand */
+            STORE_FW (main2, hlhi_word & ~PSACMSLI);
+    }
 
+    if (cc == 0)
+    {
         /* Set register 13 to zero to indicate lock released */
         regs->GR_L(13) = 0;
+
+        ASSIST_PERFORMED(inst, regs);
     }
     else
     {
@@ -466,10 +512,9 @@ int     acc_mode = 0;                   /* access mode to use        */
 
         /* Update the PSW instruction address */
         UPD_PSW_IA(regs, newia);
-    }
 
-    /* Release main-storage access lock */
-    RELEASE_MAINLOCK(regs);
+        ASSIST_DECLINED(inst, regs);
+    }
 
 } /* end function release_cms_lock */
 
@@ -495,6 +540,8 @@ VADR    effective_addr1,
     PTT_ERR("*E508 TRSVC",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -518,6 +565,8 @@ VADR    effective_addr1,
     PTT_ERR("*E509 TRPGM",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -541,6 +590,8 @@ VADR    effective_addr1,
     PTT_ERR("*E50A TRSRB",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -564,6 +615,8 @@ VADR    effective_addr1,
     PTT_ERR("*E50B TRIO",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -587,6 +640,8 @@ VADR    effective_addr1,
     PTT_ERR("*E50C TRTSK",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 
 
@@ -610,12 +665,73 @@ VADR    effective_addr1,
     PTT_ERR("*E50D TRRTN",effective_addr1,effective_addr2,regs->psw.IA_L);
     /*INCOMPLETE: NO TRACE ENTRY IS GENERATED*/
 
+    ASSIST_DECLINED(inst, regs);
+
 }
 #endif /*!defined(FEATURE_TRACING)*/
 
 
 #if !defined(_GEN_ARCH)
 
+/*-------------------------------------------------------------------*/
+/* Display or reset the MVS assist counts of all online CPUs         */
+/*-------------------------------------------------------------------*/
+void mvsassist_stats_disp(int reset)
+{
+static const char *name[16] = {
+        NULL,                           /* E500                      */
+        NULL,                           /* E501                      */
+        "Page fix",                     /* E502                      */
+        "SVC assist",                   /* E503                      */
+        "Obtain local lock",            /* E504                      */
+        "Release local lock",           /* E505                      */
+        "Obtain CMS lock",              /* E506                      */
+        "Release CMS lock",             /* E507                      */
+        "Trace SVC interruption",       /* E508                      */
+        "Trace program interruption",   /* E509                      */
+        "Trace initial SRB dispatch",   /* E50A                      */
+        "Trace I/O interruption",       /* E50B                      */
+        "Trace task dispatch",          /* E50C                      */
+        "Trace SVC return",             /* E50D                      */
+        NULL,                           /* E50E                      */
+        NULL };                         /* E50F                      */
+U64     hit[16], miss[16];              /* Counts by assist          */
+int     cpu, i, n = 0;
+
+    memset(hit, 0, sizeof(hit));
+    memset(miss, 0, sizeof(miss));
+
+    for (cpu = 0; cpu < sysblk.maxcpu; cpu++)
+    {
+        if (!IS_CPU_ONLINE(cpu))
+            continue;
+        if (reset)
+        {
+            memset(sysblk.regs[cpu]->mvsahit, 0,
+                   sizeof(sysblk.regs[cpu]->mvsahit));
+            memset(sysblk.regs[cpu]->mvsamiss, 0,
+                   sizeof(sysblk.regs[cpu]->mvsamiss));
+            continue;
+        }
+        for (i = 0; i < 16; i++)
+        {
+            hit[i] += sysblk.regs[cpu]->mvsahit[i];
+            miss[i] += sysblk.regs[cpu]->mvsamiss[i];
+        }
+        n++;
+    }
+
+    if (reset)
+        return;
+
+    WRMSG(HHC02356, "I", n);
+
+    for (i = 0; i < 16; i++)
+        if (name[i] && (hit[i] || miss[i]))
+            WRMSG(HHC02357, "I", i, name[i], hit[i], miss[i],
+                  (int)((hit[i] * 100) / (hit[i] + miss[i])));
+}
+
 #if defined(_ARCHMODE2)
  #define  _GEN_ARCH _ARCHMODE2
  #include "assist.c"
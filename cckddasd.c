@@ -1574,6 +1574,7 @@ void* cckd_ra (void* arg)
     TID             tid;                    /* Readahead thread id       */
     char            threadname[40];
     int             rc;
+    U32             affgen = 0;             /* Affinity generation       */
 
     UNREFERENCED(arg);
 
@@ -1614,6 +1615,13 @@ void* cckd_ra (void* arg)
         /* Possibly shutting down if no writes pending */
         if (cckdblk.ra1st < 0) continue;
 
+        /* Rebind if the cckd thread affinity was changed */
+        if (affgen != sysblk.devaffgen)
+        {
+            affgen = sysblk.devaffgen;
+            set_thread_affinity(0, &sysblk.cckdaff);
+        }
+
         r = cckdblk.ra1st;
         trk = cckdblk.ra[r].trk;
         dev = cckdblk.ra[r].dev;
@@ -1817,6 +1825,7 @@ static char    *compress[] = {"none", "zlib", "bzip2"};
 BYTE            buf2[65536];            /* Compress buffer           */
 char            threadname[40];
 int             rc;
+U32             affgen = 0;             /* Affinity generation       */
 
     UNREFERENCED(arg);
 
@@ -1863,6 +1872,13 @@ int             rc;
             cckdblk.wrwaiting--;
         }
 
+        /* Rebind if the cckd thread affinity was changed */
+        if (affgen != sysblk.devaffgen)
+        {
+            affgen = sysblk.devaffgen;
+            set_thread_affinity(0, &sysblk.cckdaff);
+        }
+
         /* Scan the cache for the oldest pending write */
         cache_lock (CACHE_DEVBUF);
         o = cache_scan (CACHE_DEVBUF, cckd_writer_scan, NULL);
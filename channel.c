@@ -2270,6 +2270,7 @@ DEVBLK *dev;
 int     current_priority;               /* Current thread priority   */
 int     rc = 0;                         /* Return code               */
 u_int   waitcount = 0;                  /* Wait counter              */
+U32     affgen = 0;                     /* Affinity generation       */
 
     UNREFERENCED(arg);
 
@@ -2319,6 +2320,13 @@ u_int   waitcount = 0;                  /* Wait counter              */
 
             release_lock (&sysblk.ioqlock);
 
+            /* Rebind if the device thread affinity was changed */
+            if (affgen != sysblk.devaffgen)
+            {
+                affgen = sysblk.devaffgen;
+                set_thread_affinity(0, &sysblk.devaff);
+            }
+
             /* Set priority to requested device priority; should not */
             /* have any Hercules locks held                          */
             if (dev->devprio != current_priority)
@@ -66,6 +66,130 @@ DISABLE_GCC_WARNING( "-Wunused-function" )
 #include "clock.h"
 
 
+/*----------------------------------------------------------------------------*/
+/* Invariant TSC clock source                                                 */
+/*                                                                            */
+/* When selected (clocksrc tsc), host_ETOD and host_tod derive the time of    */
+/* day from the processor's invariant time stamp counter rather than from a   */
+/* clock_gettime call.  The counter rate is measured against CLOCK_MONOTONIC  */
+/* and the time is resynchronised to CLOCK_REALTIME by tsc_resync, which the  */
+/* timer thread calls about once a second.  Small differences are slewed out  */
+/* over the following second so that the clock does not step; uniqueness and  */
+/* steering are applied on top of it by hw_adjust as for the system clock.    */
+/*                                                                            */
+/* The conversion parameters are double buffered: tsc_resync fills the copy   */
+/* not in use and then advances tsc_gen, and readers retry if tsc_gen changed */
+/* while they were reading.  Readers fence the counter read behind the load   */
+/* of tsc_gen, and a counter value below the base just installed (a read on   */
+/* another core, slightly behind) converts to the base time rather than       */
+/* wrapping to a time centuries ahead.                                        */
+/*----------------------------------------------------------------------------*/
+
+BYTE tsc_clock = 0;                 /* 1=Invariant TSC clock source in use    */
+
+#if defined(ASSIST_RDTSC)
+
+#include <cpuid.h>
+
+typedef struct TSCCLK {
+    U64     tsc;                    /* Time stamp counter at base             */
+    U64     ns;                     /* Nanoseconds since 1970 at base         */
+    U64     mult;                   /* Nanoseconds per tick << 32             */
+} TSCCLK;
+
+static TSCCLK       tsc_clk[2];     /* Conversion parameters                  */
+static volatile U32 tsc_gen;        /* Selects tsc_clk entry in use           */
+static U64          tsc_hz;         /* Measured ticks per second              */
+static U64          tsc_mono_tsc;   /* Counter at last rate measurement       */
+static U64          tsc_mono_ns;    /* CLOCK_MONOTONIC at last measurement    */
+
+#define TSC_BARRIER()   __asm__ __volatile__ ( "" ::: "memory" )
+
+static INLINE U64
+timespec2ns (const struct timespec* ts)
+{
+    return ( (U64)ts->tv_sec * 1000000000ULL + ts->tv_nsec );
+}
+
+static INLINE U64
+tsc_clk_ns (const TSCCLK* clk, U64 tsc)
+{
+    S64 diff  = (S64)(tsc - clk->tsc);
+    U64 delta = diff < 0 ? 0 : (U64)diff;
+    U64 dh = delta >> 32, dl = delta & 0xFFFFFFFFULL;
+    U64 mh = clk->mult >> 32, ml = clk->mult & 0xFFFFFFFFULL;
+
+    /* (delta * mult) >> 32, split into 32-bit halves so that no
+     * partial product overflows, whether the counter runs faster
+     * or slower than 1 GHz (mult below or above 1 << 32)
+     */
+    return ( clk->ns + ((dh * mh) << 32) + dh * ml + dl * mh
+                     + ((dl * ml) >> 32) );
+}
+
+static U64
+tsc_ns (void)
+{
+    U32 gen;
+    U64 ns;
+
+    do
+    {
+        gen = tsc_gen;
+        TSC_BARRIER();
+        ns = tsc_clk_ns(&tsc_clk[gen & 1], rdtsc_serial());
+        TSC_BARRIER();
+    } while (gen != tsc_gen);
+
+    return ( ns );
+}
+
+/* Install new conversion parameters */
+static void
+tsc_set (U64 tsc, U64 ns, U64 mult)
+{
+    TSCCLK* clk = &tsc_clk[(tsc_gen + 1) & 1];
+
+    clk->tsc  = tsc;
+    clk->ns   = ns;
+    clk->mult = mult;
+    TSC_BARRIER();
+    tsc_gen++;
+}
+
+/* Test for an invariant (constant rate, never stopping) counter */
+static int
+tsc_invariant (void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    return ( (edx & 0x00000100) != 0 );
+}
+
+#endif /* defined(ASSIST_RDTSC) */
+
+
+/*----------------------------------------------------------------------------*/
+/* tsc_host_tod - host_tod from the TSC clock source                          */
+/*----------------------------------------------------------------------------*/
+
+TOD
+tsc_host_tod (void)
+{
+#if defined(ASSIST_RDTSC)
+    U64 ns = tsc_ns();
+
+    return ( ((ns / 1000000000ULL) * ETOD_SEC) +
+             (((ns % 1000000000ULL) << 1) / 125) + ETOD_1970 );
+#else
+    return ( 0 );
+#endif
+}
+
+
 /*----------------------------------------------------------------------------*/
 /* host_ETOD - Primary high-resolution clock fetch and conversion             */
 /*----------------------------------------------------------------------------*/
@@ -75,6 +199,18 @@ host_ETOD (ETOD* ETOD)
 {
     struct timespec time;
 
+#if defined(ASSIST_RDTSC)
+    if (tsc_clock)
+    {
+        U64 ns = tsc_ns();
+
+        time.tv_sec  = ns / 1000000000ULL;
+        time.tv_nsec = ns % 1000000000ULL;
+        timespec2ETOD(ETOD, &time);
+        return ( ETOD );
+    }
+#endif
+
     /* Should use CLOCK_MONOTONIC + adjustment, but host sleep/hibernate
      * destroys consistent monotonic clock.
      */
@@ -223,6 +359,125 @@ register TOD temp_tod;
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* tsc_clock_enable - Select the invariant TSC or the system clock source     */
+/*                                                                            */
+/* Returns 0 on success, or -1 if the host has no invariant TSC.              */
+/*----------------------------------------------------------------------------*/
+
+int
+tsc_clock_enable (int enable)
+{
+#if defined(ASSIST_RDTSC)
+    struct timespec mono0, mono1, real;
+    U64             tsc0, tsc1;
+
+    if (!enable)
+    {
+        tsc_clock = 0;
+        return 0;
+    }
+
+    if (!tsc_invariant())
+        return -1;
+
+    /* Measure the counter rate over 20 milliseconds */
+    clock_gettime(CLOCK_MONOTONIC, &mono0);
+    tsc0 = rdtsc();
+    do
+        clock_gettime(CLOCK_MONOTONIC, &mono1);
+    while (timespec2ns(&mono1) - timespec2ns(&mono0) < 20000000);
+    tsc1 = rdtsc();
+    clock_gettime(CLOCK_REALTIME, &real);
+
+    if (tsc1 <= tsc0)
+        return -1;
+
+    tsc_mono_tsc = tsc1;
+    tsc_mono_ns  = timespec2ns(&mono1);
+    tsc_hz = ((tsc1 - tsc0) * 1000000000ULL) /
+             (timespec2ns(&mono1) - timespec2ns(&mono0));
+
+    obtain_lock(&sysblk.todlock);
+    tsc_set(tsc1, timespec2ns(&real),
+            ((timespec2ns(&mono1) - timespec2ns(&mono0)) << 32) / (tsc1 - tsc0));
+
+    /* Remeasure the uniqueness tick for the new clock source */
+    hw_unique_clock_tick.high = hw_unique_clock_tick.low = 0;
+    tsc_clock = 1;
+    release_lock(&sysblk.todlock);
+
+    return 0;
+#else
+    UNREFERENCED(enable);
+    return -1;
+#endif
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* tsc_clock_hz - Measured TSC rate, or 0 if the TSC clock is not in use      */
+/*----------------------------------------------------------------------------*/
+
+U64
+tsc_clock_hz (void)
+{
+#if defined(ASSIST_RDTSC)
+    return ( tsc_clock ? tsc_hz : 0 );
+#else
+    return 0;
+#endif
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* tsc_resync - Resynchronise the TSC clock with the system clock             */
+/*                                                                            */
+/* Called by the timer thread.  At most once a second the counter rate is    */
+/* remeasured against CLOCK_MONOTONIC and the difference from CLOCK_REALTIME  */
+/* is slewed out over the next second.  A difference of more than 100 ms, as  */
+/* when the host clock is set, is applied at once.                            */
+/*----------------------------------------------------------------------------*/
+
+void
+tsc_resync (void)
+{
+#if defined(ASSIST_RDTSC)
+    struct timespec mono, real;
+    U64             tsc, now, mult, elapsed;
+    S64             error;
+
+    if (!tsc_clock || rdtsc() - tsc_mono_tsc < tsc_hz)
+        return;
+
+    clock_gettime(CLOCK_MONOTONIC, &mono);
+    tsc = rdtsc();
+    clock_gettime(CLOCK_REALTIME, &real);
+
+    elapsed = timespec2ns(&mono) - tsc_mono_ns;
+
+    /* Remeasure the rate unless the host was suspended meanwhile */
+    if (elapsed < 4000000000ULL)
+        mult = (elapsed << 32) / (tsc - tsc_mono_tsc);
+    else
+        mult = tsc_clk[tsc_gen & 1].mult;
+
+    tsc_mono_tsc = tsc;
+    tsc_mono_ns  = timespec2ns(&mono);
+
+    now   = tsc_clk_ns(&tsc_clk[tsc_gen & 1], tsc);
+    error = (S64)(timespec2ns(&real) - now);
+
+    obtain_lock(&sysblk.todlock);
+    if (error > 100000000 || error < -100000000)
+        tsc_set(tsc, timespec2ns(&real), mult);
+    else
+        tsc_set(tsc, now, (U64)((S64)mult + (error * ((S64)1 << 32)) / (S64)tsc_hz));
+    release_lock(&sysblk.todlock);
+#endif
+}
+
+
 
 /* set_tod_steering(double) sets a new steering rate.                */
 /* When a new steering episode begins, the offset is adjusted,       */
@@ -146,14 +146,22 @@ void set_tod_steering(const double);    /* Set steering rate         */
 double get_tod_steering(void);          /* Get steering rate         */
 U64 update_tod_clock(void);             /* Update the TOD clock      */
 void update_cpu_timer(void);            /* Update the CPU timer      */
+void timer_reschedule(REGS *);          /* Wake timer thread early   */
 void set_tod_epoch(const S64);          /* Set TOD epoch             */
 void adjust_tod_epoch(const S64);       /* Adjust TOD epoch          */
 S64 get_tod_epoch(void);                /* Get TOD epoch             */
 U64 hw_clock(void);                     /* Get hardware clock        */
+int tsc_clock_enable(int);              /* Select TSC clock source   */
+U64 tsc_clock_hz(void);                 /* TSC rate if in use        */
+void tsc_resync(void);                  /* Resync TSC clock source   */
+TOD tsc_host_tod(void);                 /* host_tod from the TSC     */
 S64 cpu_timer(REGS *);                  /* Retrieve CPU timer        */
 void set_cpu_timer(REGS *, const S64);  /* Set CPU timer             */
 void set_int_timer(REGS *, const S32);  /* Set interval timer        */
 TOD tod_clock(REGS *);                  /* Get TOD clock non-unique  */
+
+_CLOCK_EXTERN BYTE tsc_clock;           /* 1=Invariant TSC clock     */
+
 typedef enum
 {
   ETOD_raw,
@@ -692,6 +700,10 @@ host_tod (void)
   register TOD  result;
   register U64  temp;
 
+  /* Use the invariant TSC when it is the selected clock source */
+  if (tsc_clock)
+    return ( tsc_host_tod() );
+
   /* Use the same clock source as host_ETOD; refer to host_ETOD in clock.c for
    * additional comments.
    */
@@ -97,7 +97,33 @@
   "digits.\n"
 
 #define aea_cmd_desc            "Display AEA tables"
+#define affinity_cmd_desc       "Display or set host processor affinity"
+#define affinity_cmd_help       \
+                                \
+  "Format: \"affinity [auto | none]\"\n"                                         \
+  "        \"affinity cpu  n|* list|none\"\n"                                    \
+  "        \"affinity timer|dev|cckd list|none\"\n"                              \
+  "\n"                                                                          \
+  "Binds Hercules threads to host processors. 'list' is a list of host\n"      \
+  "processor numbers and ranges such as 0-3,8. 'cpu n' binds the thread\n"    \
+  "of emulated CPU n (hexadecimal, or '*' for all CPUs); 'timer' binds the\n" \
+  "TOD clock and CPU timer thread; 'dev' the device threads and 'cckd'\n"     \
+  "the cckd writer and readahead threads. 'none' removes a binding.\n"        \
+  "\n"                                                                          \
+  "'affinity auto' gives each emulated CPU a physical core of its own,\n"      \
+  "filling one host package before the next and using SMT siblings only\n"   \
+  "when cores run out, and binds the other threads to the host processors\n" \
+  "left over. 'affinity none' removes all bindings. Enter the command\n"      \
+  "with no argument to display the current placement.\n"
 #define aia_cmd_desc            "Display AIA fields"
+#define alb_cmd_desc            "Display ALB and ASN translation cache"
+#define alb_cmd_help            \
+                                \
+  "Format: \"alb [reset]\"\n"                                                     \
+  "Displays the valid entries of the ART lookaside buffer and of the ASN\n"       \
+  "translation cache of the target CPU, with their hit and miss counts.  When\n"  \
+  "the CPU is in SIE the guest buffers are shown as well.  'reset' zeroes the\n"  \
+  "hit and miss counts.\n"
 #define alrf_cmd_desc           "Command deprecated: Use \"archlvl enable|disable|query asn_lx_reuse\" instead"
 #define ar_cmd_desc             "Display access registers"
 #define archlvl_cmd_desc        "Set Architecture Level"
@@ -209,6 +235,18 @@
 
 #define cfall_cmd_desc          "Configure all CPU's online or offline"
 #define clocks_cmd_desc         "Display tod clkc and cpu timer"
+#define clocksrc_cmd_desc       "Display/Set host clock source"
+#define clocksrc_cmd_help       \
+                                \
+  "Format: \"clocksrc [system | tsc]\"\n"                                        \
+  "\n"                                                                          \
+  "Selects the host clock from which the TOD clock and the CPU timers\n"        \
+  "are derived. 'system' (the default) reads the operating system clock.\n"    \
+  "'tsc' reads the processor's invariant time stamp counter, calibrated\n"     \
+  "against the system clock and periodically resynchronised with it by\n"     \
+  "the timer thread. TOD uniqueness and steering are unaffected. 'tsc'\n"     \
+  "is rejected when the host has no invariant TSC. Enter the command\n"       \
+  "with no argument to display the current clock source.\n"
 #define cmdlevel_cmd_desc       "Display/Set current command group"
 #define cmdlevel_cmd_help       \
                                 \
@@ -537,12 +575,33 @@
 #define hao_cmd_desc            "Hercules Automatic Operator"
 #define hao_cmd_help            \
                                 \
-  "Format: \"hao  tgt <tgt> | cmd <cmd> | list <n> | del <n> | clear \".\n"      \
+  "Format: \"hao tgt <tgt> | cmd <cmd> | list <n> | del <n> | clear | stats\"\n" \
   "  hao tgt <tgt> : define target rule (regex pattern) to react on\n"           \
   "  hao cmd <cmd> : define command for previously defined rule\n"               \
   "  hao list <n>  : list all rules/commands or only at index <n>\n"             \
   "  hao del <n>   : delete the rule at index <n>\n"                             \
-  "  hao clear     : delete all rules (stops automatic operator)\n"
+  "  hao clear     : delete all rules (stops automatic operator)\n"              \
+  "  hao stats     : display the match counts and regexec time of each rule\n"   \
+  "\n"                                                                           \
+  "Each target is reduced to the longest literal string that a matching\n"       \
+  "message must contain. Messages are scanned once for all these strings\n"      \
+  "and a target is only checked for the messages that contain its string.\n"
+
+#define haltpoll_cmd_desc       "Display or set the halt-poll window"
+#define haltpoll_cmd_help       \
+                                \
+  "Format: \"haltpoll [n | default | reset]\"\n"                                \
+  "\n"                                                                          \
+  "A CPU entering an enabled wait first spins for a short window looking\n"    \
+  "for an interrupt before blocking, which avoids a thread wakeup when the\n"  \
+  "interrupt arrives quickly. Each CPU adapts its window to the waits it\n"    \
+  "sees: it grows when waits end soon after the window and shrinks when\n"     \
+  "they are long. 'n' is the largest window in microseconds, from 0\n"        \
+  "(polling disabled) to " QSTR( MAX_HALT_POLL_USECS ) "; 'default' restores "                  \
+  QSTR( DEF_HALT_POLL_USECS ) ". 'reset' clears the statistics.\n"                              \
+  "Enter the command with no argument to display the setting together\n"      \
+  "with each CPU's current window and how many waits ended while polling\n"   \
+  "compared with how many blocked.\n"
 
 #define help_cmd_desc           "list all commands / command specific help"
 #define help_cmd_help           \
@@ -656,6 +715,33 @@
                                 \
   "This command is deprecated. Use \"ipl\" with clear option specified instead.\n"
 
+#define itrace_cmd_desc         "Binary instruction trace"
+#define itrace_cmd_help         \
+                                \
+  "Format: \"itrace [file=name [records=n]] [freeze=trig] | freeze | off\"\n"    \
+  "\n"                                                                           \
+  "Records every instruction executed by every processor, in binary, into\n"     \
+  "a ring of fixed size per processor held in a memory mapped file. Each\n"      \
+  "record holds the PSW, the instruction, its storage operand addresses and\n"   \
+  "the general registers, noting those changed since the previous record.\n"     \
+  "Program interruptions are recorded too. Use the tracedump utility to\n"       \
+  "format the file. Instructions are not displayed while recording, so\n"        \
+  "this is much faster than the t+ command.\n"                                   \
+  "\n"                                                                           \
+  "  file=name   start tracing into a new file, replacing any trace file\n"      \
+  "              already in use\n"                                               \
+  "  records=n   number of records per processor, rounded up to a power of\n"    \
+  "              two (default 65536)\n"                                          \
+  "  freeze=     stop recording, keeping the records leading up to:\n"           \
+  "     pgm         any program interruption\n"                                  \
+  "     pgm:code    a program interruption with the given hex code\n"            \
+  "     ia:addr     the instruction at the given hex address\n"                  \
+  "     none        nothing (the default)\n"                                     \
+  "  freeze      stop recording now\n"                                           \
+  "  off         stop tracing and close the file\n"                              \
+  "\n"                                                                           \
+  "Entered without operands the status of the trace is displayed.\n"
+
 #define k_cmd_desc              "Display cckd internal trace"
 #define kd_cmd_desc             "Short form of 'msghld clear'"
 #define ldmod_cmd_desc          "Load a module"
@@ -691,7 +777,15 @@
 #define locks_cmd_desc          "Display internal locks list"
 #define locks_cmd_help          \
                                 \
-  "Format: \"locks [HELD|tid|ALL] [SORT [TIME|TOD]|[OWNER|TID]|NAME|LOC]\"\n"
+  "Format: \"locks [HELD|tid|ALL] [SORT [TIME|TOD]|[OWNER|TID]|NAME|LOC]\"\n"    \
+  "    or: \"locks STATS [ON|OFF|RESET]\"\n"                                     \
+  "\n"                                                                           \
+  "'locks stats on' starts collecting lock contention statistics: how\n"         \
+  "many times each lock was obtained, how often the caller had to wait,\n"       \
+  "a histogram of the wait times and the call sites which waited the\n"          \
+  "longest. 'locks stats' displays them, most waited for lock first, and\n"      \
+  "'locks stats reset' clears them. The time each lock was obtained is\n"        \
+  "also only recorded while statistics are being collected.\n"
 
 #define log_cmd_desc            "Direct logger output"
 #define log_cmd_help            \
@@ -866,6 +960,16 @@
   "       dse       data secure erase\n"                                         \
   "       dvol1     display VOL1 header\n"
 
+#define mvsassist_cmd_desc      "Display or reset MVS assist counts"
+#define mvsassist_cmd_help      \
+                                \
+  "Format: \"mvsassist [reset]\"\n"                                              \
+  "Displays, summed over all online CPUs, how often each MVS assist\n"           \
+  "instruction (E502-E50D) was performed and how often it was handed back\n"     \
+  "to the guest's software path.  The lock assists are only handed back\n"       \
+  "when the lock is contended or the lock word is misaligned; the other\n"       \
+  "assists are always handed back.  'reset' zeroes the counts.\n"
+
 #define numcpu_cmd_desc         "Set numcpu parameter"
 #define numvec_cmd_desc         "Set numvec parameter"
 #define ostailor_cmd_desc       "Tailor trace information for specific OS"
@@ -928,6 +1032,17 @@
   "      sends their lawyers after you.\n"
 
 
+#define pgmcount_cmd_desc       "Display or reset program interruption counts"
+#define pgmcount_cmd_help       \
+                                \
+  "Format: \"pgmcount [reset]\"\n"                                                \
+  "Displays, summed over all online CPUs, the number of program interruptions\n"  \
+  "by interruption code and how many of them were presented on the fast path\n"   \
+  "for translation and protection exceptions.  That path is only taken when\n"    \
+  "the interruption is not traced (see 'pgmtrace' and 'ostailor') and neither\n"  \
+  "SIE, PER nor instruction stepping or tracing is active.  'reset' zeroes\n"     \
+  "the counts.\n"
+
 #define pgmtrace_cmd_desc       "Trace program interrupts"
 #define pgmtrace_cmd_help       \
                                 \
@@ -945,6 +1060,39 @@
   "to display the current value. Use the'cpu' command beforehand to choose\n"    \
   "which processor's prefix register should be displayed or altered.\n"
 
+#define prof_cmd_desc           "Sampling guest profiler"
+#define prof_cmd_help           \
+                                \
+  "Format: \"prof [operation]\"\n"                                               \
+  "\n"                                                                           \
+  "Samples the instruction address, address space (primary ASN and ASCE)\n"      \
+  "and PSW key of every running processor at a fixed rate, and counts the\n"     \
+  "samples taken at each distinct address. Processors in wait state are\n"       \
+  "only counted. Use it to find the hot spots of a guest program.\n"             \
+  "\n"                                                                           \
+  "Operations:\n"                                                                \
+  "\n"                                                                           \
+  "  start        start a new profile, discarding the previous one\n"            \
+  "    rate=n     samples per second per processor (default 1000)\n"             \
+  "    slots=n    size of the sample table, rounded up to a power of two\n"      \
+  "               (default 65536); samples at new addresses are lost once\n"     \
+  "               three quarters of it are in use\n"                             \
+  "  stop         stop sampling, keeping the profile for the reports\n"          \
+  "  top [n]      report the n addresses with the most samples (default 20)\n"   \
+  "  ranges [size [n]]\n"                                                        \
+  "               report the n address ranges of hex size bytes with the\n"      \
+  "               most samples (default size 1000), over all address spaces\n"   \
+  "  map file     load a map of symbols used to label the reports. Each\n"       \
+  "               line holds a hex address, an optional hex length and a\n"      \
+  "               name; lines starting with '#' or '*' are comments\n"           \
+  "  map none     discard the map\n"                                             \
+  "  fold file    write the profile in folded stack format for flame graph\n"    \
+  "               tools. The guest call stack is not known, so each stack\n"     \
+  "               is the address space, the symbol or 4K page, and the\n"        \
+  "               address\n"                                                     \
+  "\n"                                                                           \
+  "Entered without operands the status of the profiler is displayed.\n"
+
 #define pscp_cmd_desc           "Send prio message scp command"
 #define pscp_cmd_help           \
                                 \
@@ -985,7 +1133,9 @@
   "\n"                                                                              \
   "When specified with operands, the ptt command defines the trace parameters\n"    \
   "identifying which events are to be traced. When the last option is numeric,\n"   \
-  "it defines the size of the trace table itself and activates tracing.\n"          \
+  "it defines the size of each thread's trace table and activates tracing.\n"       \
+  "Every thread traces into its own table; the tables of all threads are\n"         \
+  "merged by time when they are displayed or dumped.\n"                             \
   "\n"                                                                              \
   "Events:    (should be specified first, before any options are specified)\n"      \
   "\n"                                                                              \
@@ -1005,11 +1155,13 @@
   "options:   (should be specified last, after any events are specified)\n"         \
   "\n"                                                                              \
   "     ?                show currently defined trace parameters\n"                 \
-  "     (no)lock         lock table before updating\n"                              \
+  "     (no)lock         (accepted for compatibility; has no effect)\n"             \
   "     (no)tod          timestamp table entries\n"                                 \
   "     (no)wrap         wraparound trace table\n"                                  \
   "     to=nnn           automatic display timeout  (number of seconds)\n"          \
-  "     nnnnnn           table size                 (number of entries)\n"
+  "     dump=file        write the trace tables to a binary dump file, which\n"     \
+  "                      the pttfmt utility merges and formats\n"                   \
+  "     nnnnnn           table size                 (entries per thread)\n"
 
 #define pwd_cmd_desc            "Print working directory"
 #define qcpuid_cmd_desc         "Display cpuid"
@@ -1343,6 +1495,15 @@
 #define shcmdopt_cmd_desc       "Set diag8 sh option"
 #define shrd_cmd_desc           "shrd command"
 #define shrdport_cmd_desc       "Set shrdport value"
+#define siestats_cmd_desc       "Display or reset SIE exit statistics"
+#define siestats_cmd_help       \
+                                \
+  "Format: \"siestats [reset]\"\n"                                                \
+  "Displays, for every SIE interception and exit code seen so far, the number\n"   \
+  "of exits, the average time the host spent before re-entering SIE and a\n"      \
+  "log2 histogram of those times in microseconds.  The header line also shows\n"  \
+  "how often the guest storage definition decode and the guest TLB were reused\n" \
+  "on SIE entry.  'reset' zeroes all counters.\n"
 #define sizeof_cmd_desc         "Display size of structures"
 #define spm_cmd_desc            "SIE performance monitor"
 #define srvprio_cmd_desc        "Set/Display srvprio parameter"
@@ -1432,9 +1593,11 @@
 #define timerint_cmd_help       \
                                 \
   "Specifies the internal timers update interval, in microseconds.\n"            \
-  "This parameter specifies how frequently Hercules's internal\n"                \
-  "timers-update thread updates the TOD Clock, CPU Timer, and other\n"           \
-  "architectural related clock/timer values. The default interval\n"             \
+  "Hercules's internal timers-update thread sleeps until the next\n"             \
+  "clock comparator or CPU timer interrupt is due, and at most one\n"            \
+  "second.  While a CPU is running in S/370 mode, whose interval timer\n"        \
+  "can be changed by any store into location 80, the thread also\n"             \
+  "wakes this often to check the interval timer. The default interval\n"        \
   "is 50 microseconds, which strikes a reasonable balance between\n"             \
   "clock accuracy and overall host performance. The minimum allowed\n"           \
   "value is 1 microsecond and the maximum is 1000000 microseconds\n"             \
@@ -1481,6 +1644,29 @@
   "instead of using the current PSW mode, which is the default.\n"
 
 #define version_cmd_desc        "Display version information"
+#if defined(_FEATURE_VECTOR_FACILITY)
+#define vfsectsize_cmd_desc     "Set/display the Vector Facility section size"
+#define vfsectsize_cmd_help     \
+                                \
+  "Format: \"vfsectsize [nnn]\"\n"                                                \
+  "\n"                                                                          \
+  "Defines the section size, the number of elements in each vector register,\n" \
+  "reported by the ESA/390 Vector Facility. It must be a power of 2 value\n"    \
+  "ranging from " QSTR( MIN_VECTOR_SECTION_SIZE ) " to " QSTR( MAX_VECTOR_SECTION_SIZE ) " and may only be changed while all CPUs\n" \
+  "are stopped. Changing it clears the vector registers, the vector mask\n"    \
+  "register and the vector status register of every CPU. Enter the command\n" \
+  "with no arguments to display the current value.\n"
+#define vfsimd_cmd_desc         "Set/display the Vector Facility SIMD level"
+#define vfsimd_cmd_help         \
+                                \
+  "Format: \"vfsimd [auto | avx2 | sse2 | scalar]\"\n"                             \
+  "\n"                                                                          \
+  "Limits the host instructions used to process the elements of the ESA/390\n" \
+  "Vector Facility fullword instructions. 'auto' (the default) and 'avx2'\n"  \
+  "use AVX2 when the host has it, 'sse2' uses at most SSE2 and 'scalar'\n"    \
+  "uses portable element loops only. The results are identical at every\n"   \
+  "level. Enter the command with no argument to display the current level.\n"
+#endif /* defined(_FEATURE_VECTOR_FACILITY) */
 #define xpndsize_cmd_desc       "Define/Display xpndsize parameter"
 #define xpndsize_cmd_help       \
                                 \
@@ -1566,6 +1752,7 @@ COMMAND( "stop",                    stop_cmd,               SYSCMD,
 COMMAND( "abs",                     abs_or_r_cmd,           SYSCMDNOPER,        abs_cmd_desc,           abs_cmd_help        )
 COMMAND( "aea",                     aea_cmd,                SYSCMDNOPER,        aea_cmd_desc,           NULL                )
 COMMAND( "aia",                     aia_cmd,                SYSCMDNOPER,        aia_cmd_desc,           NULL                )
+COMMAND( "alb",                     alb_cmd,                SYSCMDNOPER,        alb_cmd_desc,           alb_cmd_help        )
 COMMAND( "ar",                      ar_cmd,                 SYSCMDNOPER,        ar_cmd_desc,            NULL                )
 COMMAND( "autoinit",                autoinit_cmd,           SYSCMDNOPER,        autoinit_cmd_desc,      autoinit_cmd_help   )
 COMMAND( "automount",               automount_cmd,          SYSCMDNOPER,        automount_cmd_desc,     automount_cmd_help  )
@@ -1574,6 +1761,7 @@ COMMAND( "b",                       trace_cmd,              SYSCMDNOPER,
 COMMAND( "b+",                      trace_cmd,              SYSCMDNOPER,        bplus_cmd_desc,         NULL                )
 COMMAND( "cachestats",              EXTCMD(cachestats_cmd), SYSCMDNOPER,        cachestats_cmd_desc,    NULL                )
 COMMAND( "clocks",                  clocks_cmd,             SYSCMDNOPER,        clocks_cmd_desc,        NULL                )
+COMMAND( "clocksrc",                clocksrc_cmd,           SYSCMDNOPER,        clocksrc_cmd_desc,      clocksrc_cmd_help   )
 COMMAND( "codepage",                codepage_cmd,           SYSCMDNOPER,        codepage_cmd_desc,      codepage_cmd_help   )
 COMMAND( "conkpalv",                conkpalv_cmd,           SYSCMDNOPER,        conkpalv_cmd_desc,      conkpalv_cmd_help   )
 COMMAND( "cp_updt",                 cp_updt_cmd,            SYSCMDNOPER,        cp_updt_cmd_desc,       cp_updt_cmd_help    )
@@ -1585,18 +1773,23 @@ COMMAND( "fpc",                     fpc_cmd,                SYSCMDNOPER,
 COMMAND( "fpr",                     fpr_cmd,                SYSCMDNOPER,        fpr_cmd_desc,           fpr_cmd_help        )
 COMMAND( "g",                       g_cmd,                  SYSCMDNOPER,        g_cmd_desc,             NULL                )
 COMMAND( "gpr",                     gpr_cmd,                SYSCMDNOPER,        gpr_cmd_desc,           gpr_cmd_help        )
+COMMAND( "haltpoll",                haltpoll_cmd,           SYSCMDNOPER,        haltpoll_cmd_desc,      haltpoll_cmd_help   )
 COMMAND( "herclogo",                herclogo_cmd,           SYSCMDNOPER,        herclogo_cmd_desc,      herclogo_cmd_help   )
 COMMAND( "ipending",                ipending_cmd,           SYSCMDNOPER,        ipending_cmd_desc,      NULL                )
+COMMAND( "itrace",                  itrace_cmd,             SYSCMDNOPER,        itrace_cmd_desc,        itrace_cmd_help     )
 COMMAND( "k",                       k_cmd,                  SYSCMDNOPER,        k_cmd_desc,             NULL                )
 COMMAND( "loadcore",                loadcore_cmd,           SYSCMDNOPER,        loadcore_cmd_desc,      loadcore_cmd_help   )
 COMMAND( "loadtext",                loadtext_cmd,           SYSCMDNOPER,        loadtext_cmd_desc,      loadtext_cmd_help   )
 COMMAND( "maxcpu",                  maxcpu_cmd,             SYSCMDNOPER,        maxcpu_cmd_desc,        NULL                )
 CMDABBR( "mounted_tape_reinit",  9, mounted_tape_reinit_cmd,SYSCMDNOPER,        mtapeinit_cmd_desc,     mtapeinit_cmd_help  )
+COMMAND( "mvsassist",               mvsassist_cmd,          SYSCMDNOPER,        mvsassist_cmd_desc,     mvsassist_cmd_help  )
 COMMAND( "numcpu",                  numcpu_cmd,             SYSCMDNOPER,        numcpu_cmd_desc,        NULL                )
 COMMAND( "numvec",                  numvec_cmd,             SYSCMDNOPER,        numvec_cmd_desc,        NULL                )
 COMMAND( "ostailor",                ostailor_cmd,           SYSCMDNOPER,        ostailor_cmd_desc,      ostailor_cmd_help   )
+COMMAND( "pgmcount",                pgmcount_cmd,           SYSCMDNOPER,        pgmcount_cmd_desc,      pgmcount_cmd_help   )
 COMMAND( "pgmtrace",                pgmtrace_cmd,           SYSCMDNOPER,        pgmtrace_cmd_desc,      pgmtrace_cmd_help   )
 COMMAND( "pr",                      pr_cmd,                 SYSCMDNOPER,        pr_cmd_desc,            pr_cmd_help         )
+COMMAND( "prof",                    prof_cmd,               SYSCMDNOPER,        prof_cmd_desc,          prof_cmd_help       )
 COMMAND( "psw",                     psw_cmd,                SYSCMDNOPER,        psw_cmd_desc,           psw_cmd_help        )
 COMMAND( "ptp",                     ptp_cmd,                SYSCMDNOPER,        ptp_cmd_desc,           ptp_cmd_help        )
 COMMAND( "ptt",                     EXTCMD( ptt_cmd ),      SYSCMDNOPER,        ptt_cmd_desc,           ptt_cmd_help        )
@@ -1643,6 +1836,7 @@ COMMAND( "store",                   store_cmd,              SYSCMDNDIAG8,
 COMMAND( "sysclear",                sysclear_cmd,           SYSCMDNDIAG8,       sysclear_cmd_desc,      sysclear_cmd_help   )
 COMMAND( "sysreset",                sysreset_cmd,           SYSCMDNDIAG8,       sysreset_cmd_desc,      sysreset_cmd_help   )
 
+COMMAND( "affinity",                affinity_cmd,           SYSCFGNDIAG8,       affinity_cmd_desc,      affinity_cmd_help   )
 COMMAND( "capping",                 capping_cmd,            SYSCFGNDIAG8,       capping_cmd_desc,       capping_cmd_help    )
 COMMAND( "cnslport",                cnslport_cmd,           SYSCFGNDIAG8,       cnslport_cmd_desc,      NULL                )
 COMMAND( "cpuidfmt",                cpuidfmt_cmd,           SYSCFGNDIAG8,       cpuidfmt_cmd_desc,      NULL                )
@@ -1686,6 +1880,10 @@ COMMAND( "locks",                   EXTCMD( locks_cmd ),    SYSPROGDEVEL,
 #if defined(_FEATURE_CMPSC_ENHANCEMENT_FACILITY)
 COMMAND( "cmpscpad",                cmpscpad_cmd,           SYSCFGNDIAG8,       cmpscpad_cmd_desc,      cmpscpad_cmd_help   )
 #endif /* defined(_FEATURE_CMPSC_ENHANCEMENT_FACILITY) */
+#if defined(_FEATURE_VECTOR_FACILITY)
+COMMAND( "vfsectsize",              vfsectsize_cmd,         SYSCFGNDIAG8,       vfsectsize_cmd_desc,    vfsectsize_cmd_help )
+COMMAND( "vfsimd",                  vfsimd_cmd,             SYSCMDNOPER,        vfsimd_cmd_desc,        vfsimd_cmd_help     )
+#endif /* defined(_FEATURE_VECTOR_FACILITY) */
 #if defined( _FEATURE_ASN_AND_LX_REUSE )
 COMMAND( "alrf",                    alrf_cmd,               SYSCMDNOPER,        alrf_cmd_desc,          NULL                )
 COMMAND( "asn_and_lx_reuse",        alrf_cmd,               SYSCMDNOPER,        asnlx_cmd_desc,         NULL                )
@@ -1802,6 +2000,9 @@ COMMAND( "tt32",                    tt32_cmd,               SYSCMDNOPER,
 #if defined( PANEL_REFRESH_RATE )
 COMMAND( "panrate",                 panrate_cmd,            SYSCMD,             panrate_cmd_desc,       panrate_cmd_help    )
 #endif
+#if defined( _FEATURE_SIE )
+COMMAND( "siestats",                siestats_cmd,           SYSCMDNOPER,        siestats_cmd_desc,      siestats_cmd_help   )
+#endif
 #if defined( SIE_DEBUG_PERFMON )
 COMMAND( "spm",                     spm_cmd,                SYSCMDNOPER,        spm_cmd_desc,           NULL                )
 #endif
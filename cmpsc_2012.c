@@ -262,6 +262,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand ))( CMPSCBLK* pCMPSCBLK )
     GetIndex*   pGetIndex;      // Ptr to GetNextIndex function for this CBN
     GIBLK       giblk;          // GetIndex parameters block
     EXPBLK      expblk;         // EXPAND Index Symbol parameters block
+    DCTCACHE*   pDCTCACHE;      // Persistent dictionary cache or NULL
     U16         index[8];       // SRC Index values
     U8          bits;           // Number of bits per index
 
@@ -288,9 +289,13 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Expand ))( CMPSCBLK* pCMPSCBLK )
     expblk.dctblk.pkey      = pCMPSCBLK->regs->psw.pkey;
     expblk.dctblk.pDict     = pCMPSCBLK->pDict;
 
+    pDCTCACHE               = GetDCTCACHE( pCMPSCBLK->regs );
+
     expblk.eceblk.pDCTBLK   = &expblk.dctblk;
     expblk.eceblk.max_index = 0xFFFF >> (16 - bits);
     expblk.eceblk.pECE      = &expblk.ece;
+    expblk.eceblk.pCache    = pDCTCACHE ? pDCTCACHE->ece : NULL;
+    expblk.eceblk.gen       = NewDCTGEN( pDCTCACHE );
 
     expblk.op1blk.arn       = pCMPSCBLK->r1;
     expblk.op1blk.regs      = pCMPSCBLK->regs;
@@ -573,6 +578,7 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Compress ))( CMPSCBLK* pCMPSCBLK )
     DCTBLK      dctblk2;            // GetDCT parameters block  (exp dict)
     CCEBLK      cceblk;             // GetCCE parameters block
     SDEBLK      sdeblk;             // GetSDn parameters block
+    DCTCACHE*   pDCTCACHE;          // Persistent dictionary cache or NULL
     PIBLK       piblk;              // PutIndex parameters block
     U16         parent_index;       // Parent's CE Index value
     U16         child_index;        // Child's CE Index value
@@ -607,18 +613,20 @@ U8 (CMPSC_FASTCALL ARCH_DEP( cmpsc_Compress ))( CMPSCBLK* pCMPSCBLK )
     dctblk2.pkey      = pCMPSCBLK->regs->psw.pkey;
     dctblk2.pDict     = pCMPSCBLK->pDict + g_nDictSize[ pCMPSCBLK->cdss - 1 ];
 
+    pDCTCACHE         = GetDCTCACHE( pCMPSCBLK->regs );
+
     cceblk.pDCTBLK    = &dctblk;
     cceblk.max_index  = max_index;
     cceblk.pCCE       = NULL;           // (filled in before each call)
-
-    memset( &cceblk.cce, 0, sizeof( cceblk.cce ) );
+    cceblk.pCache     = pDCTCACHE ? pDCTCACHE->cce : NULL;
+    cceblk.gen        = NewDCTGEN( pDCTCACHE );
 
     sdeblk.pDCTBLK    = &dctblk;
     sdeblk.pDCTBLK2   = &dctblk2;
     sdeblk.pSDE       = &sibling;
     sdeblk.pCCE       = NULL;           // (depends if first sibling)
-
-    memset( &sdeblk.sde, 0, sizeof( sdeblk.sde ) );
+    sdeblk.pCache     = pDCTCACHE ? pDCTCACHE->sde : NULL;
+    sdeblk.gen        = cceblk.gen;
 
     piblk.ppPutIndex  = (void**) &pPutIndex;
     piblk.pCMPSCBLK   = pCMPSCBLK;
@@ -23,6 +23,43 @@
 #include "cmpsc.h"              // (Master header)
 
 #ifdef FEATURE_COMPRESSION
+
+#ifndef _CMPSCDCT_C_ONCE_
+#define _CMPSCDCT_C_ONCE_       // Code to be compiled ONLY ONCE goes after here
+///////////////////////////////////////////////////////////////////////////////
+// GetDCTCACHE: return this CPU's persistent dictionary cache, allocating it
+// on first use. Returns NULL (entries are then decoded on every use) if it
+// could not be allocated.
+
+DCTCACHE* (CMPSC_FASTCALL GetDCTCACHE)( REGS* regs )
+{
+#if !defined( NOT_HERC )        // (building Hercules?)
+    if (unlikely( !regs->cmpsc_dctcache ))
+        regs->cmpsc_dctcache = calloc( 1, sizeof( DCTCACHE ));
+    return (DCTCACHE*) regs->cmpsc_dctcache;
+#else
+    UNREFERENCED( regs );
+    return NULL;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// NewDCTGEN: start a new invocation; entries must be revalidated before use
+
+U32 (CMPSC_FASTCALL NewDCTGEN)( DCTCACHE* pDCTCACHE )
+{
+    if (!pDCTCACHE)
+        return 0;
+
+    if (unlikely( !++pDCTCACHE->gen ))   // (wrapped? start over)
+    {
+        memset( pDCTCACHE, 0, sizeof( DCTCACHE ));
+        pDCTCACHE->gen = 1;
+    }
+    return pDCTCACHE->gen;
+}
+#endif // _CMPSCDCT_C_ONCE_
+
 ///////////////////////////////////////////////////////////////////////////////
 // GetDCT: fetch 8-byte dictionary entry as a 64-bit unsigned integer
 
@@ -54,15 +91,23 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetECE ))( U16 index, ECEBLK* pECEBLK )
 {
     register U64 ece;
     register ECE* pECE = pECEBLK->pECE;
+    register ECECACHE* pEnt = pECEBLK->pCache ? &pECEBLK->pCache[ index ] : NULL;
 
-    if (pECEBLK->ece[ index ].cached)
+    if (pEnt && pEnt->gen == pECEBLK->gen)      // (validated this call?)
     {
-        *pECE = pECEBLK->ece[ index ];
+        *pECE = pEnt->ece;
         return TRUE;
     }
 
     ece = ARCH_DEP( GetDCT )( index, pECEBLK->pDCTBLK );
 
+    if (pEnt && pEnt->gen && pEnt->raw == ece)  // (entry unchanged?)
+    {
+        pEnt->gen = pECEBLK->gen;
+        *pECE = pEnt->ece;
+        return (pECE->psl && pECE->pptr > pECEBLK->max_index) ? FALSE : TRUE;
+    }
+
     if (!(pECE->psl = ECE_U8R( 0, 3 )))
     {
         if (!(pECE->csl = ECE_U8R( 5, 3 )))
@@ -80,8 +125,12 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetECE ))( U16 index, ECEBLK* pECEBLK )
         pECE->csl = 0;
     }
 
-    pECE->cached = TRUE;
-    pECEBLK->ece[ index ] = *pECE;
+    if (pEnt)
+    {
+        pEnt->ece = *pECE;
+        pEnt->raw = ece;
+        pEnt->gen = pECEBLK->gen;
+    }
 
     return TRUE;
 }
@@ -95,14 +144,23 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
 {
     register U64 cce;
     register CCE* pCCE = pCCEBLK->pCCE;
+    register CCECACHE* pEnt = pCCEBLK->pCache ? &pCCEBLK->pCache[ index ] : NULL;
 
-    if (pCCEBLK->cce[ index ].cached)
+    if (pEnt && pEnt->gen == pCCEBLK->gen)      // (validated this call?)
     {
-        *pCCE = pCCEBLK->cce[ index ];
-        return TRUE;
+        *pCCE = pEnt->cce;
+        return (pCCE->cct && pCCE->cptr > pCCEBLK->max_index) ? FALSE : TRUE;
     }
 
     cce = ARCH_DEP( GetDCT )( index, pCCEBLK->pDCTBLK );
+
+    if (pEnt && pEnt->gen && pEnt->raw == cce)  // (entry unchanged?)
+    {
+        pEnt->gen = pCCEBLK->gen;
+        *pCCE = pEnt->cce;
+        return (pCCE->cct && pCCE->cptr > pCCEBLK->max_index) ? FALSE : TRUE;
+    }
+
     pCCE->mc = FALSE;
 
     if (!(pCCE->cct = CCE_U8R( 0, 3 )))  // (no children)
@@ -112,14 +170,8 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
 
         if (pCCE->act)
             pCCE->ec_dw = CSWAP64( cce << 24 );
-
-        pCCE->cached = TRUE;
-        pCCEBLK->cce[ index ] = *pCCE;
-
-        return TRUE;
     }
-
-    if (pCCE->cct == 1)  // (only one child)
+    else if (pCCE->cct == 1)  // (only one child)
     {
         register U8 wrk;
 
@@ -165,10 +217,14 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetCCE ))( U16 index, CCEBLK* pCCEBLK )
         pCCE->yy   = CCE_U16L(  8,  2 );
     }
 
-    pCCE->cached = TRUE;
-    pCCEBLK->cce[ index ] = *pCCE;
+    if (pEnt)
+    {
+        pEnt->cce = *pCCE;
+        pEnt->raw = cce;
+        pEnt->gen = pCCEBLK->gen;
+    }
 
-    return (pCCE->cptr > pCCEBLK->max_index) ? FALSE : TRUE;
+    return (pCCE->cct && pCCE->cptr > pCCEBLK->max_index) ? FALSE : TRUE;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -180,25 +236,44 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
 {
     register U64 sd1;
     register SDE* pSDE = pSDEBLK->pSDE;
+    register SDECACHE* pEnt = pSDEBLK->pCache ? &pSDEBLK->pCache[ index ] : NULL;
 
-    if (pSDEBLK->sde[ index ].cached)
+    if (pEnt && pEnt->gen == pSDEBLK->gen)          // (validated this call?)
+        *pSDE = pEnt->sde;
+    else
     {
-        *pSDE = pSDEBLK->sde[ index ];
-        return TRUE;
-    }
+        sd1 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK );
 
-    sd1 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK );
-    pSDE->ms = FALSE;
+        if (pEnt && pEnt->gen && pEnt->raw == sd1 && !pEnt->f1)
+        {
+            pEnt->gen = pSDEBLK->gen;               // (entry unchanged)
+            *pSDE = pEnt->sde;
+        }
+        else
+        {
+            pSDE->ms = FALSE;
 
-    if (!(pSDE->sct = SD1_U8R( 0, 3 )) || pSDE->sct >= 7)
-    {
-        pSDE->sct = 7;
-        pSDE->ms = TRUE;
-    }
+            if (!(pSDE->sct = SD1_U8R( 0, 3 )) || pSDE->sct >= 7)
+            {
+                pSDE->sct = 7;
+                pSDE->ms = TRUE;
+            }
 
-    // Examine child bits for children 1 to 5
+            // Examine child bits for children 1 to 5
 
-    pSDE->ecb = SD1_U16L( 3, 5 );
+            pSDE->ecb = SD1_U16L( 3, 5 );
+
+            pSDE->sc_dw = CSWAP64( sd1 << 8 );
+
+            if (pEnt)
+            {
+                pEnt->sde = *pSDE;
+                pEnt->raw = sd1;
+                pEnt->f1  = FALSE;
+                pEnt->gen = pSDEBLK->gen;
+            }
+        }
+    }
 
     // If children exist append examine child bits for
     // children 6 and 7 which are in the parent CCE so
@@ -208,6 +283,9 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
     // of the parent. Examine child bits for children
     // 6 and 7 do not exist for subsequent siblings
     // of parent and thus must ALWAYS be examined.
+    //
+    // (Done on every call since the cached entry may
+    // be reached as first or as subsequent sibling.)
 
     if (pSDEBLK->pCCE)  // (first sibling of parent?)
     {
@@ -219,11 +297,6 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
         pSDE->ecb |= 0xFFFF >> 5;
     }
 
-    pSDE->sc_dw = CSWAP64( sd1 << 8 );
-
-    pSDE->cached = TRUE;
-    pSDEBLK->sde[ index ] = *pSDE;
-
     return TRUE;
 }
 
@@ -234,27 +307,66 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD0 ))( U16 index, SDEBLK* pSDEBLK )
 
 U8 (CMPSC_FASTCALL ARCH_DEP( GetSD1 ))( U16 index, SDEBLK* pSDEBLK )
 {
-    register U64 sd1;
+    register U64 sd1, sd2 = 0;
     register SDE* pSDE = pSDEBLK->pSDE;
+    register SDECACHE* pEnt = pSDEBLK->pCache ? &pSDEBLK->pCache[ index ] : NULL;
 
-    if (pSDEBLK->sde[ index ].cached)
+    if (pEnt && pEnt->gen == pSDEBLK->gen)          // (validated this call?)
+        *pSDE = pEnt->sde;
+    else
     {
-        *pSDE = pSDEBLK->sde[ index ];
-        return TRUE;
-    }
+        sd1 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK );
 
-    sd1 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK );
-    pSDE->ms = FALSE;
+        if (pEnt && pEnt->gen && pEnt->raw == sd1 && pEnt->f1
+            && (pEnt->sde.sct <= 6 || pEnt->raw2 ==
+                (sd2 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK2 ))))
+        {
+            pEnt->gen = pSDEBLK->gen;               // (entry unchanged)
+            *pSDE = pEnt->sde;
+        }
+        else
+        {
+            pSDE->ms = FALSE;
 
-    if (!(pSDE->sct = SD1_U8R( 0, 4 )) || pSDE->sct >= 15)
-    {
-        pSDE->sct = 14;
-        pSDE->ms = TRUE;
-    }
+            if (!(pSDE->sct = SD1_U8R( 0, 4 )) || pSDE->sct >= 15)
+            {
+                pSDE->sct = 14;
+                pSDE->ms = TRUE;
+            }
+
+            // Examine child bits for children 1 to 12
+
+            pSDE->ecb = SD1_U16L( 4, 12 );
+
+            if (pEnt)
+                pEnt->raw = sd1;
+
+            sd1 <<= 16;                             // (first 6 bytes)
 
-    // Examine child bits for children 1 to 12
+            if (pSDE->sct <= 6)
+                pSDE->sc_dw = CSWAP64( sd1 );       // (only 6 bytes)
+            else
+            {
+                sd2 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK2 );
 
-    pSDE->ecb = SD1_U16L( 4, 12 );
+                if (pEnt)
+                    pEnt->raw2 = sd2;
+
+                sd1 |= sd2 >> (64-16);              // (append 2 more)
+                pSDE->sc_dw= CSWAP64( sd1 );        // (store first 8)
+
+                sd2 <<= 16;                         // (next 6 bytes)
+                pSDE->sc_dw2 = CSWAP64( sd2 );      // (store next 6)
+            }
+
+            if (pEnt)
+            {
+                pEnt->sde = *pSDE;
+                pEnt->f1  = TRUE;
+                pEnt->gen = pSDEBLK->gen;
+            }
+        }
+    }
 
     // If children exist append examine child bits for
     // children 13 and 14 which are in the parent CCE
@@ -275,24 +387,6 @@ U8 (CMPSC_FASTCALL ARCH_DEP( GetSD1 ))( U16 index, SDEBLK* pSDEBLK )
         pSDE->ecb |= 0xFFFF >> 12;
     }
 
-    sd1 <<= 16;                               // (first 6 bytes)
-
-    if (pSDE->sct <= 6)
-        pSDE->sc_dw = CSWAP64( sd1 );         // (only 6 bytes)
-    else
-    {
-        register U64 sd2 = ARCH_DEP( GetDCT )( index, pSDEBLK->pDCTBLK2 );
-
-        sd1 |= sd2 >> (64-16);                // (append 2 more)
-        pSDE->sc_dw= CSWAP64( sd1 );          // (store first 8)
-
-        sd2 <<= 16;                           // (next 6 bytes)
-        pSDE->sc_dw2 = CSWAP64( sd2 );        // (store next 6)
-    }
-
-    pSDE->cached = TRUE;
-    pSDEBLK->sde[ index ] = *pSDE;
-
     return TRUE;
 }
 
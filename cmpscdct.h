@@ -46,7 +46,6 @@ struct ECE              //  Portable Expansion Character Entry
     U8      csl;        // 10:1  Complete-symbol length
     U8      psl;        // 11:1  Partial-symbol length
     U8      ofst;       // 12:1  Offset
-    U8      cached;     // 13:1  Cache entry active flag
 };
 typedef struct ECE ECE;
 
@@ -76,7 +75,6 @@ struct CCE              //  Portable Compression Character Entry
     U8      cct;        // 22:1  Child count
     U8      act;        // 23:1  Additional-extension-character count
     U8      mc;         // 24:1  More children flag
-    U8      cached;     // 25:1  Cache entry active flag
 };
 typedef struct CCE CCE;
 
@@ -96,19 +94,71 @@ struct SDE              //  Portable Sibling Descriptor Entry
     U16     ecb;        // 16:2  Examine-child bits for children 1-7 or 1-14
     U8      sct;        // 18:1  Sibling count
     U8      ms;         // 19:1  More siblings flag
-    U8      cached;     // 13:1  Cache entry active flag
 };
 typedef struct SDE SDE;
 
+///////////////////////////////////////////////////////////////////////////////
+// Persistent dictionary cache
+//
+// Decoded dictionary entries are kept from one CMPSC to the next in a DCTCACHE
+// anchored in the CPU's REGS. Each entry remembers the raw doubleword(s) it was
+// decoded from. The first time an invocation uses an entry the raw entry is
+// fetched again and compared; after that ('gen' matches) it is used as is for
+// the rest of the invocation. A guest that rewrites its dictionary thus never
+// gets stale entries, but repeated calls against an unchanged dictionary skip
+// decoding (and the clearing of per-call caches) entirely.
+//
+// The cache is keyed by entry index only, not by dictionary origin, format or
+// size. Decoding depends on nothing but the raw doubleword(s), which are always
+// compared; the pointer limit check is redone against the current call's
+// dictionary size; and 'f1' keeps format-0 and format-1 sibling descriptors
+// apart. A different dictionary at the same index is simply decoded afresh.
+
+struct ECECACHE             // Cached Expansion Character Entry
+{
+    ECE     ece;            // Decoded entry
+    U64     raw;            // Dictionary entry it was decoded from
+    U32     gen;            // Invocation that last validated it (0 = empty)
+};
+typedef struct ECECACHE ECECACHE;
+
+struct CCECACHE             // Cached Compression Character Entry
+{
+    CCE     cce;            // Decoded entry
+    U64     raw;            // Dictionary entry it was decoded from
+    U32     gen;            // Invocation that last validated it (0 = empty)
+};
+typedef struct CCECACHE CCECACHE;
+
+struct SDECACHE             // Cached Sibling Descriptor Entry
+{
+    SDE     sde;            // Decoded entry (without parent's ECB bits)
+    U64     raw;            // Dictionary entry it was decoded from
+    U64     raw2;           // Format-1 expansion dictionary half (sct > 6)
+    U32     gen;            // Invocation that last validated it (0 = empty)
+    U8      f1;             // Decoded as format-1 sibling descriptor
+};
+typedef struct SDECACHE SDECACHE;
+
+struct DCTCACHE             // Persistent dictionary cache (one per CPU)
+{
+    U32       gen;                          // Current invocation number
+    ECECACHE  ece[ MAX_DICT_ENTRIES ];      // Expansion dictionary entries
+    CCECACHE  cce[ MAX_DICT_ENTRIES ];      // Compression dictionary entries
+    SDECACHE  sde[ MAX_DICT_ENTRIES ];      // Sibling descriptor entries
+};
+typedef struct DCTCACHE DCTCACHE;
+
 ///////////////////////////////////////////////////////////////////////////////
 // GetECE parameters block
 
 struct ECEBLK               // GetECE parameters block
 {
-    DCTBLK*  pDCTBLK;       // Ptr to GetDCT parameters block
-    ECE*     pECE;          // Ptr to destination ECE structure
-    U16      max_index;     // Max index value (same as index's bitmask value)
-    ECE      ece[ MAX_DICT_ENTRIES ];   // ECE cache
+    DCTBLK*    pDCTBLK;     // Ptr to GetDCT parameters block
+    ECE*       pECE;        // Ptr to destination ECE structure
+    ECECACHE*  pCache;      // Ptr to ECE cache or NULL
+    U32        gen;         // Current cache generation
+    U16        max_index;   // Max index value (same as index's bitmask value)
 };
 typedef struct ECEBLK ECEBLK;
 
@@ -117,10 +167,11 @@ typedef struct ECEBLK ECEBLK;
 
 struct CCEBLK               // GetCCE parameters block
 {
-    DCTBLK*  pDCTBLK;       // Ptr to GetDCT parameters block
-    CCE*     pCCE;          // Ptr to destination CCE structure
-    U16      max_index;     // Max index value (same as index's bitmask value)
-    CCE      cce[ MAX_DICT_ENTRIES ];   // CCE cache
+    DCTBLK*    pDCTBLK;     // Ptr to GetDCT parameters block
+    CCE*       pCCE;        // Ptr to destination CCE structure
+    CCECACHE*  pCache;      // Ptr to CCE cache or NULL
+    U32        gen;         // Current cache generation
+    U16        max_index;   // Max index value (same as index's bitmask value)
 };
 typedef struct CCEBLK CCEBLK;
 
@@ -129,18 +180,22 @@ typedef struct CCEBLK CCEBLK;
 
 struct SDEBLK               // GetSDn parameters block
 {
-    DCTBLK*  pDCTBLK;       // Ptr to GetDCT parameters block  (cmp dict)
-    DCTBLK*  pDCTBLK2;      // Ptr to GetDCT parameters block  (exp dict)
-    SDE*     pSDE;          // Ptr to destination SDE structure
-    CCE*     pCCE;          // Ptr to Parent CCE structure where extra
+    DCTBLK*    pDCTBLK;     // Ptr to GetDCT parameters block  (cmp dict)
+    DCTBLK*    pDCTBLK2;    // Ptr to GetDCT parameters block  (exp dict)
+    SDE*       pSDE;        // Ptr to destination SDE structure
+    CCE*       pCCE;        // Ptr to Parent CCE structure where extra
                             // Examine-child bits reside, but ONLY if this
                             // is the parent's first sibling. Otherwise NULL.
-    SDE      sde[ MAX_DICT_ENTRIES ];   // SDE cache
+    SDECACHE*  pCache;      // Ptr to SDE cache or NULL
+    U32        gen;         // Current cache generation
 };
 typedef struct SDEBLK SDEBLK;
 
 typedef U8 (CMPSC_FASTCALL GETSD)( U16 index, SDEBLK* pSDEBLK );
 
+extern DCTCACHE* (CMPSC_FASTCALL GetDCTCACHE)( REGS* regs );
+extern U32       (CMPSC_FASTCALL NewDCTGEN  )( DCTCACHE* pDCTCACHE );
+
 ///////////////////////////////////////////////////////////////////////////////
 #endif // _CMPSCDCT_H_     // Place all 'ARCH_DEP' code after this statement
 
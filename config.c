@@ -992,6 +992,70 @@ int configure_srv_priority(int prio)
     return 0;
 }
 
+/*-------------------------------------------------------------------*/
+/* Host processor affinity of CPU, timer, device and cckd threads.   */
+/* Running CPU and timer threads are rebound at once; device and     */
+/* cckd threads rebind themselves when they see devaffgen change.    */
+/*-------------------------------------------------------------------*/
+int configure_cpu_affinity(int cpu, const HOSTCPUSET *set)
+{
+    sysblk.cpuaff[cpu] = *set;
+    if(sysblk.cputid[cpu])
+        return set_thread_affinity(sysblk.cputid[cpu], set);
+    return 0;
+}
+
+int configure_tod_affinity(const HOSTCPUSET *set)
+{
+    sysblk.todaff = *set;
+    if(sysblk.todtid)
+        return set_thread_affinity(sysblk.todtid, set);
+    return 0;
+}
+
+int configure_dev_affinity(const HOSTCPUSET *dev, const HOSTCPUSET *cckd)
+{
+    sysblk.devaff = *dev;
+    sysblk.cckdaff = *cckd;
+    sysblk.devaffgen++;
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Automatic placement: emulated CPU n is bound to the n'th entry of */
+/* get_hostcpu_order, i.e. to its own physical core while there are  */
+/* cores left, and the helper threads share the host processors not  */
+/* given to any configurable CPU.  Disabling removes all bindings.   */
+/*-------------------------------------------------------------------*/
+int configure_auto_affinity(int enable)
+{
+int        order[MAX_HOST_CPUS];
+HOSTCPUSET set, helpers;
+int        cpu, i, n = 0;
+
+    HOSTCPU_ZERO(&helpers);
+    if (enable)
+    {
+        n = get_hostcpu_order(order, MAX_HOST_CPUS);
+        if (n < 1)
+            return -1;
+        for (i = sysblk.maxcpu; i < n; i++)
+            HOSTCPU_SET(&helpers, order[i]);
+    }
+
+    for (cpu = 0; cpu < MAX_CPU_ENGINES; cpu++)
+    {
+        HOSTCPU_ZERO(&set);
+        if (enable)
+            HOSTCPU_SET(&set, order[cpu % n]);
+        configure_cpu_affinity(cpu, &set);
+    }
+    configure_tod_affinity(&helpers);
+    configure_dev_affinity(&helpers, &helpers);
+    sysblk.affauto = enable ? 1 : 0;
+    return 0;
+}
+
 /*-------------------------------------------------------------------*/
 /* Function to start a new CPU thread                                */
 /* Caller MUST own the intlock                                       */
@@ -339,6 +339,8 @@ CREG    inst_cr;                        /* Instruction CR            */
 
     RRE(inst, regs, r1, r2);
 
+    TXF_INSTR_CHECK(regs);
+
     SIE_XC_INTERCEPT(regs);
 
     /* Special operation exception if DAT is off or ASF not enabled */
@@ -702,6 +704,8 @@ U32     old;                            /* old value                 */
 
     RRE(inst, regs, r1, r2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     ODD_CHECK(r1, regs);
@@ -780,6 +784,8 @@ VADR    effective_addr2;                /* Effective address         */
 
     RS(inst, regs, r1, r3, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_ECPSVM)
     if(ecpsvm_dodiag(regs,r1,r3,b2,effective_addr2)==0)
     {
@@ -1515,6 +1521,8 @@ int     op3;
     RRE(inst, regs, r1, r2);
 #endif /*defined(FEATURE_IPTE_RANGE_FACILITY)*/
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     op1 = regs->GR(r1);
@@ -1864,6 +1872,8 @@ U16     updated = 0;                    /* Updated control regs      */
 
     RS(inst, regs, r1, r3, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_ECPSVM)
     if(ecpsvm_dolctl(regs,r1,r3,b2,effective_addr2)==0)
     {
@@ -1958,6 +1968,9 @@ int     amode64;
 #endif /*defined(FEATURE_ESAME)*/
 
     S(inst, regs, b2, effective_addr2);
+
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_ECPSVM)
     if(ecpsvm_dolpsw(regs,b2,effective_addr2)==0)
     {
@@ -2685,6 +2698,8 @@ CREG    savecr12 = 0;                   /* CR12 save                 */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     SIE_XC_INTERCEPT(regs);
 
 #if defined(_FEATURE_SIE)
@@ -3362,6 +3377,8 @@ int     rc;                             /* return code from load_psw */
 
     E(inst, regs);
 
+    TXF_INSTR_CHECK(regs);
+
     UNREFERENCED(inst);
 
     SIE_XC_INTERCEPT(regs);
@@ -3916,6 +3933,9 @@ DEF_INST(program_transfer)
 int     r1, r2;                         /* Values of R fields        */
 
     RRE(inst, regs, r1, r2);
+
+    TXF_INSTR_CHECK(regs);
+
     ARCH_DEP(program_transfer_proc) (regs, r1, r2, 0);
 
 } /* end DEF_INST(program_transfer) */
@@ -3936,6 +3956,9 @@ int     r1, r2;                         /* Values of R fields        */
     }
 
     RRE(inst, regs, r1, r2);
+
+    TXF_INSTR_CHECK(regs);
+
     ARCH_DEP(program_transfer_proc) (regs, r1, r2, 1);
 
 } /* end DEF_INST(program_transfer_with_instance) */
@@ -3982,6 +4005,8 @@ VADR    effective_addr2;                /* Effective address         */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_MULTIPLE_CONTROLLED_DATA_SPACE)
     /* This instruction is executed as a no-operation in XC mode */
     if(SIE_STATB(regs, MX, XC))
@@ -3998,6 +4023,13 @@ VADR    effective_addr2;                /* Effective address         */
     /* Purge the translation lookaside buffer for this CPU */
     ARCH_DEP(purge_tlb) (regs);
 
+#if defined(FEATURE_ACCESS_REGISTERS)
+    /* Also purge the ART lookaside buffer and ASN translation cache,
+       so that operating systems which change an ASTE and then issue
+       PTLB rather than PALB see the change */
+    ARCH_DEP(purge_alb) (regs);
+#endif /*defined(FEATURE_ACCESS_REGISTERS)*/
+
 }
 
 
@@ -4398,6 +4430,8 @@ int     ssevent = 0;                    /* 1=space switch event      */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_SET_ADDRESS_SPACE_CONTROL_FAST)
     if(inst[1] == 0x19) // SAC only
 #endif /*defined(FEATURE_SET_ADDRESS_SPACE_CONTROL_FAST)*/
@@ -4518,6 +4552,8 @@ U64     dreg;                           /* Clock value               */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     SIE_INTERCEPT(regs);
 
     PRIV_CHECK(regs);
@@ -4539,6 +4575,9 @@ U64     dreg;                           /* Clock value               */
     else
         OFF_IC_CLKC(regs);
 
+    /* Every clock comparator is now due at a different time */
+    timer_reschedule(NULL);
+
     RELEASE_INTLOCK(regs);
 
     /* Return condition code zero */
@@ -4563,6 +4602,8 @@ U64     dreg;                           /* Clock value               */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     DW_CHECK(effective_addr2, regs);
@@ -4590,6 +4631,9 @@ U64     dreg;                           /* Clock value               */
     else
         OFF_IC_CLKC(regs);
 
+    /* Wake the timer thread if it would sleep past the new value */
+    timer_reschedule(regs);
+
     RELEASE_INTLOCK(regs);
 
     RETURN_INTCHECK(regs);
@@ -4629,6 +4673,8 @@ S64     dreg;                           /* Timer value               */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     DW_CHECK(effective_addr2, regs);
@@ -4651,6 +4697,9 @@ S64     dreg;                           /* Timer value               */
     else
         OFF_IC_PTIMER(regs);
 
+    /* Wake the timer thread if it would sleep past the new value */
+    timer_reschedule(regs);
+
     RELEASE_INTLOCK(regs);
 
 //  /*debug*/logmsg("Set CPU timer=%16.16"PRIX64"\n", dreg);
@@ -4670,6 +4719,8 @@ RADR    n;                              /* Prefix value              */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -5195,6 +5246,8 @@ BYTE    r1key;
 
     RRF_M(inst, regs, r1, r2, m3);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     /* Load 4K block address from R2 register */
@@ -5465,6 +5518,9 @@ int     b2;                             /* Base of effective addr    */
 VADR    effective_addr2;                /* Effective address         */
 
     S(inst, regs, b2, effective_addr2);
+
+    TXF_INSTR_CHECK(regs);
+
     /*
      * ECPS:VM - Before checking for prob/priv
      * Check CR6 to see if S-ASSIST is requested
@@ -5567,6 +5623,8 @@ static char *ordername[] = {
 
     RS(inst, regs, r1, r3, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -7194,6 +7252,9 @@ int     b1;                             /* Base of effective addr    */
 VADR    effective_addr1;                /* Effective address         */
 
     SI(inst, regs, i2, b1, effective_addr1);
+
+    TXF_INSTR_CHECK(regs);
+
 #ifdef FEATURE_ECPSVM
     if(ecpsvm_dostnsm(regs,b1,effective_addr1,i2)==0)
     {
@@ -7233,6 +7294,8 @@ VADR    effective_addr1;                /* Effective address         */
 
     SI(inst, regs, i2, b1, effective_addr1);
 
+    TXF_INSTR_CHECK(regs);
+
 #ifdef FEATURE_ECPSVM
     if(ecpsvm_dostosm(regs,b1,effective_addr1,i2)==0)
     {
@@ -7373,6 +7436,8 @@ RADR    n;                              /* Real address              */
 
     RRE(inst, regs, r1, r2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(FEATURE_REGION_RELOCATE)
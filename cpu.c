@@ -45,6 +45,8 @@
 #include "hercules.h"
 #include "opcode.h"
 #include "inline.h"
+#include "itrace.h"
+#include "prof.h"
 
 // #define JPHTEST
 
@@ -300,36 +302,8 @@ int ARCH_DEP(load_psw) (REGS *regs, BYTE *addr)
     return 0;
 } /* end function ARCH_DEP(load_psw) */
 
-/*-------------------------------------------------------------------*/
-/* Load program interrupt new PSW                                    */
-/*-------------------------------------------------------------------*/
-void (ATTR_REGPARM(2) ARCH_DEP(program_interrupt)) (REGS *regs, int pcode)
-{
-PSA    *psa;                            /* -> Prefixed storage area  */
-REGS   *realregs;                       /* True regs structure       */
-RADR    px;                             /* host real address of pfx  */
-int     code;                           /* pcode without PER ind.    */
-int     ilc;                            /* instruction length        */
-#if defined(FEATURE_ESAME)
-/** FIXME : SEE ISW20090110-1 */
-void   *zmoncode=NULL;                  /* special reloc for z/Arch  */
-                 /* FIXME : zmoncode not being initialized here raises
-                    a potentially non-initialized warning in GCC..
-                    can't find why. ISW 2009/02/04 */
-                                        /* mon call SIE intercept    */
-#endif
-#if defined(FEATURE_INTERPRETIVE_EXECUTION)
-int     sie_ilc=0;                      /* SIE instruction length    */
-#endif
-#if defined(_FEATURE_SIE)
-int     nointercept;                    /* True for virtual pgmint   */
-#endif /*defined(_FEATURE_SIE)*/
-#if defined(OPTION_FOOTPRINT_BUFFER)
-U32     n;
-#endif /*defined(OPTION_FOOTPRINT_BUFFER)*/
-char    dxcstr[8]={0};                  /* " DXC=xx" if data excptn  */
-
-static char *pgmintname[] = {
+#if !defined(_GEN_ARCH)
+static const char *pgmintname[] = {
         /* 01 */        "Operation exception",
         /* 02 */        "Privileged-operation exception",
         /* 03 */        "Execute exception",
@@ -394,6 +368,258 @@ static char *pgmintname[] = {
         /* 3E */        "Unassigned exception",
         /* 3F */        "Unassigned exception",
         /* 40 */        "Monitor event" };
+#endif /*!defined(_GEN_ARCH)*/
+
+/*-------------------------------------------------------------------*/
+/* Store the old and load the new program PSW                        */
+/*                                                                   */
+/* Input:                                                            */
+/*      realregs  True regs structure                                */
+/*      psa       PSA (or SIE interruption parameter area)           */
+/*      ilc       Instruction length code                            */
+/*      pcode     Program interruption code                          */
+/*                                                                   */
+/*      This function does not return; it resumes the dispatch       */
+/*      loop in run_cpu (or SIE) by longjmp to progjmp.              */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(program_interrupt_swap_psw) (REGS *realregs,
+                                                 PSA *psa, int ilc, int pcode)
+{
+PSW     pgmold, pgmnew;                 /* Old/new PSW for loop check*/
+int     pgmintloop = 0;                 /* 1=Program interrupt loop  */
+int     detect_pgmintloop;              /* 1=Loop detection enabled  */
+
+    detect_pgmintloop = FACILITY_ENABLED( DETECT_PGMINTLOOP, realregs );
+
+    /* Store current PSW at PSA+X'28' or PSA+X'150' for ESAME */
+    ARCH_DEP(store_psw) (realregs, psa->pgmold);
+
+    /* Save program old psw */
+    if (detect_pgmintloop)
+    {
+        memcpy( &pgmold, &realregs->psw, sizeof( PSW ));
+        pgmold.cc      = 0;
+        pgmold.intcode = 0;
+        pgmold.ilc     = 0;
+        pgmold.unused  = 0;
+    }
+
+    /* Load new PSW from PSA+X'68' or PSA+X'1D0' for ESAME */
+    if ( ARCH_DEP(load_psw) (realregs, psa->pgmnew) )
+    {
+#if defined(_FEATURE_SIE)
+        if(SIE_MODE(realregs))
+        {
+            longjmp(realregs->progjmp, pcode);
+        }
+        else
+#endif /*defined(_FEATURE_SIE)*/
+        /* Invalid pgmnew ==> program interrupt loop */
+        pgmintloop = detect_pgmintloop;
+    }
+    else if (detect_pgmintloop)
+    {
+        /* Save program new psw */
+        memcpy( &pgmnew, &realregs->psw, sizeof( PSW ));
+        pgmnew.cc      = 0;
+        pgmnew.intcode = 0;
+        pgmnew.ilc     = 0;
+        pgmnew.unused  = 0;
+
+        /* Adjust pgmold instruction address */
+        pgmold.ia.D -= ilc;
+
+        /* Check for program interrupt loop (old==new) */
+        if (memcmp( &pgmold, &pgmnew, sizeof( PSW )) == 0)
+            pgmintloop = 1;
+    }
+
+    if (pgmintloop)
+    {
+        char buf[64];
+        // "Processor %s%02X: program interrupt loop PSW %s"
+        WRMSG(HHC00803, "I", PTYPSTR(realregs->cpuad), realregs->cpuad,
+                 str_psw (realregs, buf));
+        OBTAIN_INTLOCK(realregs);
+        realregs->cpustate = CPUSTATE_STOPPING;
+        ON_IC_INTERRUPT(realregs);
+        RELEASE_INTLOCK(realregs);
+    }
+
+    longjmp(realregs->progjmp, SIE_NO_INTERCEPT);
+
+} /* end function program_interrupt_swap_psw */
+
+/*-------------------------------------------------------------------*/
+/* Fast path for translation and protection program interruptions    */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    CPU register context                                 */
+/*      pcode   Program interruption code                            */
+/*                                                                   */
+/*      Demand paging guests take translation and protection         */
+/*      exceptions at a high rate.  When none of SIE, PER, tracing,  */
+/*      stepping, transactional execution or held locks apply, this  */
+/*      function presents the interruption directly and does not     */
+/*      return.  Otherwise it returns and program_interrupt takes    */
+/*      the general path.                                            */
+/*-------------------------------------------------------------------*/
+static INLINE void ARCH_DEP(fast_program_interrupt) (REGS *regs,
+                                                     int pcode)
+{
+PSA    *psa;                            /* -> Prefixed storage area  */
+RADR    px;                             /* Absolute address of pfx   */
+int     ilc;                            /* Instruction length        */
+int     translation;                    /* 1=Translation exception   */
+
+    switch (pcode) {
+    case PGM_PAGE_TRANSLATION_EXCEPTION:
+    case PGM_SEGMENT_TRANSLATION_EXCEPTION:
+#if defined(FEATURE_ESAME)
+    case PGM_ASCE_TYPE_EXCEPTION:
+    case PGM_REGION_FIRST_TRANSLATION_EXCEPTION:
+    case PGM_REGION_SECOND_TRANSLATION_EXCEPTION:
+    case PGM_REGION_THIRD_TRANSLATION_EXCEPTION:
+#endif /*defined(FEATURE_ESAME)*/
+        translation = 1;
+        break;
+    case PGM_PROTECTION_EXCEPTION:
+        translation = 0;
+        break;
+    default:
+        return;
+    }
+
+    /* Only the true regs of a CPU not in SIE qualify */
+    if (regs != sysblk.regs[regs->cpuad])
+        return;
+#if defined(_FEATURE_SIE)
+    if (SIE_MODE(regs) || regs->sie_active)
+        return;
+#endif /*defined(_FEATURE_SIE)*/
+
+    if (regs->tracing
+     || (sysblk.pgminttr & ((U64)1 << ((pcode - 1) & 0x3F)))
+     || EN_IC_PER(regs) || IS_IC_PER(regs)
+     || sysblk.intowner == regs->cpuad
+     || sysblk.mainowner == regs->cpuad
+     || (regs->psw.ilc == 0 && !regs->psw.zeroilc))
+        return;
+
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    if (regs->txf_tnd)
+        return;
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
+#if defined(FEATURE_BCMODE)
+    if (!ECMODE(&regs->psw))
+        return;
+#endif /*defined(FEATURE_BCMODE)*/
+
+    regs->pgmcount[pcode]++;
+    regs->pgmfast++;
+
+    /* Prevent machine check when in (almost) interrupt loop */
+    regs->instcount++;
+
+    INVALIDATE_AIA(regs);
+
+    ilc = regs->psw.zeroilc ? 0 : REAL_ILC(regs);
+    regs->execflag = 0;
+
+    PERFORM_SERIALIZATION (regs);
+    PERFORM_CHKPT_SYNC (regs);
+
+    /* Translation exceptions nullify, unless they occurred during
+       instruction fetch; protection exceptions during instruction
+       fetch increment the old PSW */
+    if (translation ? !regs->instinvalid : regs->instinvalid)
+    {
+        if (translation)
+            regs->psw.IA -= ilc;
+        else
+            regs->psw.IA += ilc;
+        regs->psw.IA &= ADDRESS_MAXWRAP(regs);
+    }
+
+    regs->psw.intcode = pcode;
+
+    HDC2(debug_program_interrupt, regs, pcode);
+
+    regs->instinvalid = 0;
+
+    /* Set the main storage reference and change bits */
+    px = regs->PX;
+    STORAGE_KEY(px, regs) |= (STORKEY_REF | STORKEY_CHANGE);
+
+    /* Point to PSA in main storage */
+    psa = (void*)(regs->mainstor + px);
+
+    /* Store the program interrupt code at PSA+X'8C' */
+    psa->pgmint[0] = 0;
+    psa->pgmint[1] = ilc;
+    STORE_HW(psa->pgmint + 2, pcode);
+
+#if !defined(FEATURE_SUPPRESSION_ON_PROTECTION)
+    if (translation)
+#endif /*!defined(FEATURE_SUPPRESSION_ON_PROTECTION)*/
+    {
+        /* Store the exception access identification at PSA+160 */
+        psa->excarid = regs->excarid;
+        psa->opndrid = regs->opndrid;
+        regs->opndrid = 0;
+
+        /* Store the translation exception address */
+#if defined(FEATURE_ESAME)
+        STORE_DW(psa->TEA_G, regs->TEA);
+#else /*!defined(FEATURE_ESAME)*/
+        STORE_FW(psa->tea, regs->TEA);
+#endif /*!defined(FEATURE_ESAME)*/
+    }
+    regs->TEA = 0;
+
+#if defined(FEATURE_PER3)
+    /* Store the breaking event address register in the PSA */
+    SET_BEAR_REG(regs, regs->bear_ip);
+    STORE_W(psa->bea, regs->bear);
+#endif /*defined(FEATURE_PER3)*/
+
+#if defined(_FEATURE_PROTECTION_INTERCEPTION_CONTROL)
+    regs->hostint = 0;
+#endif /*defined(_FEATURE_PROTECTION_INTERCEPTION_CONTROL)*/
+
+    ARCH_DEP(program_interrupt_swap_psw) (regs, psa, ilc, pcode);
+
+} /* end function fast_program_interrupt */
+
+/*-------------------------------------------------------------------*/
+/* Load program interrupt new PSW                                    */
+/*-------------------------------------------------------------------*/
+void (ATTR_REGPARM(2) ARCH_DEP(program_interrupt)) (REGS *regs, int pcode)
+{
+PSA    *psa;                            /* -> Prefixed storage area  */
+REGS   *realregs;                       /* True regs structure       */
+RADR    px;                             /* host real address of pfx  */
+int     code;                           /* pcode without PER ind.    */
+int     ilc;                            /* instruction length        */
+#if defined(FEATURE_ESAME)
+/** FIXME : SEE ISW20090110-1 */
+void   *zmoncode=NULL;                  /* special reloc for z/Arch  */
+                 /* FIXME : zmoncode not being initialized here raises
+                    a potentially non-initialized warning in GCC..
+                    can't find why. ISW 2009/02/04 */
+                                        /* mon call SIE intercept    */
+#endif
+#if defined(FEATURE_INTERPRETIVE_EXECUTION)
+int     sie_ilc=0;                      /* SIE instruction length    */
+#endif
+#if defined(_FEATURE_SIE)
+int     nointercept;                    /* True for virtual pgmint   */
+#endif /*defined(_FEATURE_SIE)*/
+#if defined(OPTION_FOOTPRINT_BUFFER)
+U32     n;
+#endif /*defined(OPTION_FOOTPRINT_BUFFER)*/
+char    dxcstr[8]={0};                  /* " DXC=xx" if data excptn  */
 
         /* 26 */ /* was "Page-fault-assist exception", */
         /* 27 */ /* was "Control-switch exception", */
@@ -406,6 +632,10 @@ static char *pgmintname[] = {
 
     PTT_PGM("*PROG",pcode,(U32)(regs->TEA & 0xffffffff),regs->psw.IA_L);
 
+    /* Present the common translation and protection exceptions
+       directly when none of the handling below is required */
+    ARCH_DEP(fast_program_interrupt) (regs, pcode);
+
     /* program_interrupt() may be called with a shadow copy of the
        regs structure, realregs is the pointer to the real structure
        which must be used when loading/storing the psw, or backing up
@@ -514,6 +744,10 @@ static char *pgmintname[] = {
     }
 #endif /*defined(FEATURE_INTERPRETIVE_EXECUTION)*/
 
+    /* Count the interruption; index 0 counts PER-only events and
+       codes outside the architected range */
+    realregs->pgmcount[code <= 0x40 ? code : 0]++;
+
     /* Back up the PSW for exceptions which cause nullification,
        unless the exception occurred during instruction fetch */
     if ((code == PGM_PAGE_TRANSLATION_EXCEPTION
@@ -573,12 +807,25 @@ static char *pgmintname[] = {
         realregs->psw.IA &= ADDRESS_MAXWRAP(realregs);
     }
 
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    /* An exception within a transaction aborts the transaction, and
+       the old PSW designates the abort address */
+    if (realregs->txf_tnd)
+        pcode = ARCH_DEP(txf_program_interrupt) (realregs, pcode, ilc);
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
     /* Store the interrupt code in the PSW */
     realregs->psw.intcode = pcode;
 
     /* Call debugger if active */
     HDC2(debug_program_interrupt, regs, pcode);
 
+    /* Record program checks other than PER event in the binary trace */
+    if (code && sysblk.itracing)
+        ARCH_DEP(itrace_inst) (realregs, realregs->instinvalid ? NULL
+                              : (realregs->ip - ilc < realregs->aip)
+                                ? realregs->inst : realregs->ip - ilc, pcode);
+
     /* Trace program checks other then PER event */
     if(code && (CPU_STEPPING_OR_TRACING(realregs, ilc)
         || sysblk.pgminttr & ((U64)1 << ((code - 1) & 0x3F))))
@@ -930,68 +1177,7 @@ static char *pgmintname[] = {
 #if defined(_FEATURE_SIE)
     if(nointercept)
 #endif /*defined(_FEATURE_SIE)*/
-    {
-        PSW pgmold, pgmnew;
-        int pgmintloop = 0;
-        int detect_pgmintloop = FACILITY_ENABLED( DETECT_PGMINTLOOP, realregs );
-
-        /* Store current PSW at PSA+X'28' or PSA+X'150' for ESAME */
-        ARCH_DEP(store_psw) (realregs, psa->pgmold);
-
-        /* Save program old psw */
-        if (detect_pgmintloop)
-        {
-            memcpy( &pgmold, &realregs->psw, sizeof( PSW ));
-            pgmold.cc      = 0;
-            pgmold.intcode = 0;
-            pgmold.ilc     = 0;
-            pgmold.unused  = 0;
-        }
-
-        /* Load new PSW from PSA+X'68' or PSA+X'1D0' for ESAME */
-        if ( (code = ARCH_DEP(load_psw) (realregs, psa->pgmnew)) )
-        {
-#if defined(_FEATURE_SIE)
-            if(SIE_MODE(realregs))
-            {
-                longjmp(realregs->progjmp, pcode);
-            }
-            else
-#endif /*defined(_FEATURE_SIE)*/
-            /* Invalid pgmnew ==> program interrupt loop */
-            pgmintloop = detect_pgmintloop;
-        }
-        else if (detect_pgmintloop)
-        {
-            /* Save program new psw */
-            memcpy( &pgmnew, &realregs->psw, sizeof( PSW ));
-            pgmnew.cc      = 0;
-            pgmnew.intcode = 0;
-            pgmnew.ilc     = 0;
-            pgmnew.unused  = 0;
-
-            /* Adjust pgmold instruction address */
-            pgmold.ia.D -= ilc;
-
-            /* Check for program interrupt loop (old==new) */
-            if (memcmp( &pgmold, &pgmnew, sizeof( PSW )) == 0)
-                pgmintloop = 1;
-        }
-
-        if (pgmintloop)
-        {
-            char buf[64];
-            // "Processor %s%02X: program interrupt loop PSW %s"
-            WRMSG(HHC00803, "I", PTYPSTR(realregs->cpuad), realregs->cpuad,
-                     str_psw (realregs, buf));
-            OBTAIN_INTLOCK(realregs);
-            realregs->cpustate = CPUSTATE_STOPPING;
-            ON_IC_INTERRUPT(realregs);
-            RELEASE_INTLOCK(realregs);
-        }
-
-        longjmp(realregs->progjmp, SIE_NO_INTERCEPT);
-    }
+        ARCH_DEP(program_interrupt_swap_psw) (realregs, psa, ilc, pcode);
 
 #if defined(_FEATURE_SIE)
     longjmp (realregs->progjmp, pcode);
@@ -1277,6 +1463,12 @@ int   rc;
     /* Set CPU thread priority */
     set_thread_priority(0, sysblk.cpuprio);
 
+    /* Bind to the host processors chosen for this CPU */
+    if (sysblk.affauto)
+        configure_auto_affinity(1);
+    if (!HOSTCPU_EMPTY(&sysblk.cpuaff[cpu]))
+        set_thread_affinity(0, &sysblk.cpuaff[cpu]);
+
     /* Display thread started message on control panel */
     MSGBUF( cpustr, "Processor %s%02X", PTYPSTR( cpu ), cpu );
     WRMSG(HHC00100, "I", thread_id(), get_thread_priority(0), cpustr);
@@ -1459,6 +1651,16 @@ void *cpu_uninit (int cpu, REGS *regs)
         release_lock (&sysblk.cpulock[cpu]);
     }
 
+    /* Free the CMPSC dictionary cache */
+    free(regs->cmpsc_dctcache);
+
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    /* Free the transaction page buffers */
+    if (regs->txf_tnd)
+        txf_release(regs);
+    free(regs->txf_pages);
+#endif /*defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
     /* Free the REGS structure */
     free_aligned(regs);
 
@@ -1517,9 +1719,89 @@ CPU_Wait (REGS* regs)
     sysblk.intowner = regs->cpuad;
 }
 
+
+/*-------------------------------------------------------------------*/
+/* CPU Halt - Enabled wait with adaptive halt-polling                */
+/*                                                                   */
+/* Before blocking in CPU_Wait the CPU spins for up to regs->hpoll   */
+/* TOD units watching for an interrupt to be made pending, which     */
+/* saves the condition wakeup and reschedule for short I/O waits.    */
+/* The window starts at HALT_POLL_START_USECS and doubles whenever   */
+/* a wait outlasts the window but ends within sysblk.hpollmax, and   */
+/* is halved (then dropped to zero) whenever a wait exceeds it.      */
+/*                                                                   */
+/* Locks Held                                                        */
+/*      sysblk.intlock                                               */
+/*-------------------------------------------------------------------*/
+void
+CPU_Halt (REGS* regs)
+{
+    U64     max = (U64)sysblk.hpollmax << 4;
+    U64     start, waited;
+
+    if (regs->hpoll > max)
+        regs->hpoll = max;
+
+    /* Spin on the interrupt flag with intlock released */
+    if (regs->hpoll && !sysblk.syncing)
+    {
+        RELEASE_INTLOCK(regs);
+        start = host_tod();
+        while (!(*(volatile U32*)&regs->ints_state & BIT(IC_INTERRUPT))
+            && host_tod() - start < regs->hpoll);
+        OBTAIN_INTLOCK(regs);
+
+        if (IS_IC_INTERRUPT(regs))
+        {
+            regs->hpollhit++;
+            return;
+        }
+    }
+
+    start = host_tod();
+    CPU_Wait(regs);
+    waited = host_tod() - start;
+    regs->hpollslp++;
+
+    /* Adjust the window to the length of the wait */
+    if (waited > max)
+    {
+        regs->hpoll >>= 1;
+        if (regs->hpoll < (HALT_POLL_START_USECS << 4))
+            regs->hpoll = 0;
+    }
+    else if (waited > regs->hpoll)
+    {
+        regs->hpoll = regs->hpoll ? regs->hpoll << 1
+                                  : (HALT_POLL_START_USECS << 4);
+        if (regs->hpoll > max)
+            regs->hpoll = max;
+    }
+}
+
 #endif /*!defined(_GEN_ARCH)*/
 
 
+/*-------------------------------------------------------------------*/
+/* Record a profiler sample of the current PSW: the instruction      */
+/* address, the address space it is fetched from and the key.        */
+/* Called with the interrupt lock held and psw.IA current.           */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(prof_sample)(REGS *regs)
+{
+U64     asce = 0;                       /* Instruction space ASCE    */
+U16     asn = 0;                        /* Primary ASN               */
+
+    if (!REAL_MODE(&regs->psw))
+        asce = HOME_SPACE_MODE(&regs->psw) ? regs->CR(13) : regs->CR(1);
+
+#if defined(FEATURE_DUAL_ADDRESS_SPACE)
+    asn = regs->CR_LHL(4);
+#endif /*defined(FEATURE_DUAL_ADDRESS_SPACE)*/
+
+    prof_sample(regs->psw.IA, asce, asn, regs->psw.pkey >> 4);
+}
+
 /*-------------------------------------------------------------------*/
 /* Process interrupt                                                 */
 /*-------------------------------------------------------------------*/
@@ -1532,15 +1814,28 @@ void (ATTR_REGPARM(1) ARCH_DEP(process_interrupt))(REGS *regs)
     /* Obtain the interrupt lock */
     OBTAIN_INTLOCK(regs);
     OFF_IC_INTERRUPT(regs);
-    regs->tracing = (sysblk.inststep || sysblk.insttrace);
+    regs->tracing = (sysblk.inststep || sysblk.insttrace || sysblk.itracing);
 
     /* Ensure psw.IA is set and invalidate the aia */
     INVALIDATE_AIA(regs);
 
+    /* Take a sample requested by the profiler thread */
+    if (unlikely(regs->profsample))
+    {
+        regs->profsample = 0;
+        ARCH_DEP(prof_sample)(regs);
+    }
+
     /* Perform invalidation */
     if (unlikely(regs->invalidate))
         ARCH_DEP(invalidate_tlbe)(regs, regs->invalidate_main);
 
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    /* Abort any transaction before an interruption is taken */
+    if (unlikely(regs->txf_tnd))
+        ARCH_DEP(txf_interrupt) (regs);
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
     /* Take interrupts if CPU is not stopped */
     if (likely(regs->cpustate == CPUSTATE_STARTED))
     {
@@ -1643,6 +1938,7 @@ cpustate_stopping:
         sysblk.started_mask |= regs->cpubit;
         regs->ints_state |= sysblk.ints_state;
         set_cpu_timer(regs,saved_timer);
+        timer_reschedule(NULL);
 
         ON_IC_INTERRUPT(regs);
 
@@ -1679,7 +1975,7 @@ cpustate_stopping:
 
         /* Indicate waiting and invoke CPU wait */
         sysblk.waiting_mask |= regs->cpubit;
-        CPU_Wait(regs);
+        CPU_Halt(regs);
 
         /* Turn off the waiting bit .
          *
@@ -1762,7 +2058,7 @@ register int    *caplocked = &sysblk.caplocked[cpu];
     regs->trace_br = (func)&ARCH_DEP(trace_br);
 #endif
 
-    regs->tracing = (sysblk.inststep || sysblk.insttrace);
+    regs->tracing = (sysblk.inststep || sysblk.insttrace || sysblk.itracing);
     regs->ints_state |= sysblk.ints_state;
 
     /* Establish longjmp destination for cpu thread exit */
@@ -1856,6 +2152,11 @@ int     shouldstep = 0;                 /* 1=Wait for start command  */
     if (CPU_STEPPING(regs, 0))
         shouldstep = 1;
 
+    /* Record the instruction in the binary trace */
+    if (sysblk.itracing)
+        ARCH_DEP(itrace_inst) (regs,
+            regs->ip < regs->aip ? regs->inst : regs->ip, 0);
+
     /* Display the instruction */
     if (shouldtrace || shouldstep)
     {
@@ -1890,6 +2191,7 @@ int     shouldstep = 0;                 /* 1=Wait for start command  */
         sysblk.started_mask |= hostregs->cpubit;
         set_cpu_timer(regs,saved_timer[0]);
         set_cpu_timer(hostregs,saved_timer[1]);
+        timer_reschedule(NULL);
 #ifdef OPTION_MIPS_COUNTING
         hostregs->waittime += host_tod() - hostregs->waittod;
         hostregs->waittod = 0;
@@ -2046,4 +2348,46 @@ const char* get_arch_mode_string(REGS* regs)
     else return arch_name[regs->arch_mode];
 }
 
+/*-------------------------------------------------------------------*/
+/* Display or reset program interruption counts (pgmcount command)   */
+/*-------------------------------------------------------------------*/
+void pgmint_stats_disp(int reset)
+{
+U64     count[0x41];                    /* Counts by interrupt code  */
+U64     total = 0;                      /* Total interruptions       */
+U64     fast = 0;                       /* Fast path interruptions   */
+int     cpu, i;
+
+    memset(count, 0, sizeof(count));
+
+    for (cpu = 0; cpu < sysblk.maxcpu; cpu++)
+    {
+        if (!IS_CPU_ONLINE(cpu))
+            continue;
+        if (reset)
+        {
+            memset(sysblk.regs[cpu]->pgmcount, 0,
+                   sizeof(sysblk.regs[cpu]->pgmcount));
+            sysblk.regs[cpu]->pgmfast = 0;
+            continue;
+        }
+        for (i = 0; i <= 0x40; i++)
+            count[i] += sysblk.regs[cpu]->pgmcount[i];
+        fast += sysblk.regs[cpu]->pgmfast;
+    }
+
+    if (reset)
+        return;
+
+    for (i = 0; i <= 0x40; i++)
+        total += count[i];
+
+    WRMSG(HHC02354, "I", total, fast);
+
+    for (i = 0; i <= 0x40; i++)
+        if (count[i])
+            WRMSG(HHC02355, "I", i,
+                  i ? pgmintname[i - 1] : "PER event or other", count[i]);
+}
+
 #endif /*!defined(_GEN_ARCH)*/
@@ -1233,6 +1233,55 @@ rijndaelDecrypt(const u32 rk[/*4*(Nr + 1)*/], int Nr, const u8 ct[16],
  PUTU32(pt + 12, s3);
 }
 
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+/*
+ * AES-NI versions of rijndaelEncrypt and rijndaelDecrypt. The round
+ * keys are the ones computed above, stored as bytes: AESDEC implements
+ * the equivalent inverse cipher, which is exactly what the dk schedule
+ * produced by rijndaelKeySetupDec holds.
+ */
+#include <wmmintrin.h>
+
+static void
+rijndaelKeyBytes(u8 *rkb, const u32 rk[], int Nr)
+{
+ int i;
+
+ for (i = 0; i < 4 * (Nr + 1); i++)
+  PUTU32(rkb + 4 * i, rk[i]);
+}
+
+__attribute__((target("aes,sse2")))
+static void
+rijndaelEncryptAESNI(const u8 *rkb, int Nr, const u8 pt[16], u8 ct[16])
+{
+ __m128i s;
+ int r;
+
+ s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)pt),
+     _mm_loadu_si128((const __m128i *)rkb));
+ for (r = 1; r < Nr; r++)
+  s = _mm_aesenc_si128(s, _mm_loadu_si128((const __m128i *)(rkb + 16 * r)));
+ s = _mm_aesenclast_si128(s, _mm_loadu_si128((const __m128i *)(rkb + 16 * Nr)));
+ _mm_storeu_si128((__m128i *)ct, s);
+}
+
+__attribute__((target("aes,sse2")))
+static void
+rijndaelDecryptAESNI(const u8 *rkb, int Nr, const u8 ct[16], u8 pt[16])
+{
+ __m128i s;
+ int r;
+
+ s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)ct),
+     _mm_loadu_si128((const __m128i *)rkb));
+ for (r = 1; r < Nr; r++)
+  s = _mm_aesdec_si128(s, _mm_loadu_si128((const __m128i *)(rkb + 16 * r)));
+ s = _mm_aesdeclast_si128(s, _mm_loadu_si128((const __m128i *)(rkb + 16 * Nr)));
+ _mm_storeu_si128((__m128i *)pt, s);
+}
+#endif /* defined(HAVE_X86_CRYPTO_ACCEL) */
+
 /* setup key context for encryption only */
 int
 rijndael_set_key_enc_only(rijndael_ctx *ctx, u_char *key, int bits)
@@ -1245,6 +1294,10 @@ rijndael_set_key_enc_only(rijndael_ctx *ctx, u_char *key, int bits)
 
  ctx->Nr = rounds;
  ctx->enc_only = 1;
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+ if ((ctx->aesni = HWACCEL_HAVE(HWACCEL_AES)) != 0)
+  rijndaelKeyBytes(ctx->ekb, ctx->ek, rounds);
+#endif
 
  return 0;
 }
@@ -1263,6 +1316,12 @@ rijndael_set_key(rijndael_ctx *ctx, u_char *key, int bits)
 
  ctx->Nr = rounds;
  ctx->enc_only = 0;
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+ if ((ctx->aesni = HWACCEL_HAVE(HWACCEL_AES)) != 0) {
+  rijndaelKeyBytes(ctx->ekb, ctx->ek, rounds);
+  rijndaelKeyBytes(ctx->dkb, ctx->dk, rounds);
+ }
+#endif
 
  return 0;
 }
@@ -1270,12 +1329,24 @@ rijndael_set_key(rijndael_ctx *ctx, u_char *key, int bits)
 void
 rijndael_decrypt(rijndael_ctx *ctx, u_char *src, u_char *dst)
 {
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+ if (ctx->aesni) {
+  rijndaelDecryptAESNI(ctx->dkb, ctx->Nr, src, dst);
+  return;
+ }
+#endif
  rijndaelDecrypt(ctx->dk, ctx->Nr, src, dst);
 }
 
 void
 rijndael_encrypt(rijndael_ctx *ctx, u_char *src, u_char *dst)
 {
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+ if (ctx->aesni) {
+  rijndaelEncryptAESNI(ctx->ekb, ctx->Nr, src, dst);
+  return;
+ }
+#endif
  rijndaelEncrypt(ctx->ek, ctx->Nr, src, dst);
 }
 
@@ -37,6 +37,8 @@
 #ifndef __RIJNDAEL_H
 #define __RIJNDAEL_H
 
+#include "hwaccel.h"
+
 #define MAXKC   (256/32)
 #define MAXKB   (256/8)
 #define MAXNR   14
@@ -51,6 +53,11 @@ typedef struct {
         int     Nr;                     /* key-length-dependent number of rounds */
         u32     ek[4*(MAXNR + 1)];      /* encrypt key schedule */
         u32     dk[4*(MAXNR + 1)];      /* decrypt key schedule */
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+        int     aesni;                  /* use AES-NI instructions */
+        u8      ekb[16*(MAXNR + 1)];    /* ek in AES-NI byte order */
+        u8      dkb[16*(MAXNR + 1)];    /* dk in AES-NI byte order */
+#endif
 } rijndael_ctx;
 
 int      rijndael_set_key(rijndael_ctx *, u_char *, int);
@@ -209,6 +209,66 @@ static void gcm_rightshift(unsigned char *a)
   a[0] >>= 1;
 }
 
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+/*----------------------------------------------------------------------------*/
+/* c = b*a using PCLMULQDQ (Intel carry-less multiplication white paper,      */
+/* algorithm 5). The operands are byte reversed so the GCM bit order becomes  */
+/* a 128-bit reflected polynomial; the 256-bit product is shifted left one    */
+/* bit and reduced modulo x^128 + x^7 + x^2 + x + 1.                          */
+/*----------------------------------------------------------------------------*/
+#include <wmmintrin.h>
+
+__attribute__((target("pclmul,sse2")))
+static void gcm_gf_mult_clmul(const unsigned char *a, const unsigned char *b, unsigned char *c)
+{
+  unsigned char ar[16], br[16], cr[16];
+  __m128i x, y, lo, mid, hi, t1, t2, t3;
+  int i;
+
+  for(i = 0; i < 16; i++)
+  {
+    ar[i] = a[15 - i];
+    br[i] = b[15 - i];
+  }
+  x = _mm_loadu_si128((const __m128i *) ar);
+  y = _mm_loadu_si128((const __m128i *) br);
+
+  /* 256-bit carry-less product hi:lo */
+  lo  = _mm_clmulepi64_si128(x, y, 0x00);
+  hi  = _mm_clmulepi64_si128(x, y, 0x11);
+  mid = _mm_xor_si128(_mm_clmulepi64_si128(x, y, 0x10),
+                      _mm_clmulepi64_si128(x, y, 0x01));
+  lo  = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi  = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  /* Shift hi:lo left one bit (reflected operands) */
+  t1 = _mm_srli_epi32(lo, 31);
+  t2 = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  t3 = _mm_srli_si128(t1, 12);
+  t2 = _mm_slli_si128(t2, 4);
+  t1 = _mm_slli_si128(t1, 4);
+  lo = _mm_or_si128(lo, t1);
+  hi = _mm_or_si128(_mm_or_si128(hi, t2), t3);
+
+  /* Reduce */
+  t1 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31),
+                                   _mm_slli_epi32(lo, 30)),
+                                   _mm_slli_epi32(lo, 25));
+  t2 = _mm_srli_si128(t1, 4);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t1, 12));
+  t1 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1),
+                                   _mm_srli_epi32(lo, 2)),
+                     _mm_xor_si128(_mm_srli_epi32(lo, 7), t2));
+  hi = _mm_xor_si128(hi, _mm_xor_si128(lo, t1));
+
+  _mm_storeu_si128((__m128i *) cr, hi);
+  for(i = 0; i < 16; i++)
+    c[i] = cr[15 - i];
+}
+#endif /* #if defined(HAVE_X86_CRYPTO_ACCEL) */
+
 /* c = b*a */
 static const unsigned char mask[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
 static const unsigned char poly[] = { 0x00, 0xE1 };
@@ -218,6 +278,13 @@ void gcm_gf_mult(const unsigned char *a, const unsigned char *b, unsigned char *
   unsigned char Z[16], V[16];
   unsigned char x, y, z;
 
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+  if(HWACCEL_HAVE(HWACCEL_CLMUL))
+  {
+    gcm_gf_mult_clmul(a, b, c);
+    return;
+  }
+#endif /* #if defined(HAVE_X86_CRYPTO_ACCEL) */
   zeromem(Z, 16);
   XMEMCPY(V, a, 16);
   for (x = 0; x < 128; x++)
@@ -1402,6 +1469,60 @@ static void ARCH_DEP(klmd_sha)(int r1, int r2, REGS *regs)
   regs->psw.cc = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/* Map the next span of the operands of a block cipher loop                   */
+/*                                                                            */
+/* Translates the first (r1), second (r2) and, when op3 is not NULL, third    */
+/* (r3) operand once for the whole run of blocks up to the nearest 2K         */
+/* boundary of any of them, limited to the remaining second operand length.  */
+/* Returns the span length in bytes. When the next block itself crosses a     */
+/* boundary the span is one block and the operand pointers are set to NULL;   */
+/* the caller then moves that block with vfetchc/vstorec as before. Access    */
+/* exceptions are recognized in the same order as the block-by-block loop:    */
+/* second operand, third operand, first operand.                              */
+/*----------------------------------------------------------------------------*/
+static int ARCH_DEP(crypt_span)(int r1, int r2, int r3, int blocklen, BYTE **op1, BYTE **op2, BYTE **op3, REGS *regs)
+{
+  VADR addr1;
+  VADR addr2;
+  VADR addr3 = 0;
+  int span;
+
+  addr1 = GR_A(r1, regs) & ADDRESS_MAXWRAP(regs);
+  addr2 = GR_A(r2, regs) & ADDRESS_MAXWRAP(regs);
+  span = 0x800 - (addr1 & 0x7FF);
+  if(0x800 - (int)(addr2 & 0x7FF) < span)
+    span = 0x800 - (addr2 & 0x7FF);
+  if(op3)
+  {
+    addr3 = GR_A(r3, regs) & ADDRESS_MAXWRAP(regs);
+    if(0x800 - (int)(addr3 & 0x7FF) < span)
+      span = 0x800 - (addr3 & 0x7FF);
+  }
+  if(GR_A(r2 + 1, regs) < (VADR) span)
+    span = GR_A(r2 + 1, regs);
+  span -= span % blocklen;
+
+  /* Next block crosses a boundary */
+  if(unlikely(!span))
+  {
+    *op1 = *op2 = NULL;
+    if(op3)
+      *op3 = NULL;
+    return(blocklen);
+  }
+
+  *op2 = MADDRL(addr2, span, r2, regs, ACCTYPE_READ, regs->psw.pkey);
+  ITIMER_SYNC(addr2, span - 1, regs);
+  if(op3)
+  {
+    *op3 = MADDRL(addr3, span, r3, regs, ACCTYPE_READ, regs->psw.pkey);
+    ITIMER_SYNC(addr3, span - 1, regs);
+  }
+  *op1 = MADDRL(addr1, span, r1, regs, ACCTYPE_WRITE, regs->psw.pkey);
+  return(span);
+}
+
 /*----------------------------------------------------------------------------*/
 /* Cipher message (KM) FC 1-3 and 9-11                                        */
 /*----------------------------------------------------------------------------*/
@@ -1410,12 +1531,16 @@ static void ARCH_DEP(km_dea)(int r1, int r2, REGS *regs)
   int crypted;
   des_context des_ctx;
   des3_context des3_ctx;
+  int i;
   int keylen;
   BYTE message_block[8];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE parameter_block[48];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -1504,49 +1629,63 @@ static void ARCH_DEP(km_dea)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 8)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 8, &op1, &op2, NULL, regs);
+
+    for(i = 0; i < span; i += 8)
+    {
+      /* Fetch a block of data */
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + i, 8);
+      else
+        ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("input :", message_block, 8);
+      LOGBYTE("input :", message_block, 8);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
-    /* Do the job */
-    switch(tfc)
-    {
-      case 1: /* dea */
-      {
-        if(modifier_bit)
-          des_decrypt(&des_ctx, message_block, message_block);
-        else
-          des_encrypt(&des_ctx, message_block, message_block);
-        break;
-      }
-      case 2: /* tdea-128 */
-      case 3: /* tdea-192 */
+      /* Do the job */
+      switch(tfc)
       {
-        if(modifier_bit)
-          des3_decrypt(&des3_ctx, message_block, message_block);
-        else
-          des3_encrypt(&des3_ctx, message_block, message_block);
-        break;
+        case 1: /* dea */
+        {
+          if(modifier_bit)
+            des_decrypt(&des_ctx, message_block, message_block);
+          else
+            des_encrypt(&des_ctx, message_block, message_block);
+          break;
+        }
+        case 2: /* tdea-128 */
+        case 3: /* tdea-192 */
+        {
+          if(modifier_bit)
+            des3_decrypt(&des3_ctx, message_block, message_block);
+          else
+            des3_encrypt(&des3_ctx, message_block, message_block);
+          break;
+        }
       }
-    }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + i, message_block, 8);
+      else
+        ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("output:", message_block, 8);
+      LOGBYTE("output:", message_block, 8);
 #endif /* #ifdef OPTION_KM_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 8);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 8);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 8);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KM_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -1574,12 +1713,16 @@ static void ARCH_DEP(km_aes)(int r1, int r2, REGS *regs)
 {
   aes_context context;
   int crypted;
+  int i;
   int keylen;
   BYTE message_block[16];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE parameter_block[64];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -1631,33 +1774,47 @@ static void ARCH_DEP(km_aes)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 16, &op1, &op2, NULL, regs);
+
+    for(i = 0; i < span; i += 16)
+    {
+      /* Fetch a block of data */
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + i, 16);
+      else
+        ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
-    /* Do the job */
-    if(modifier_bit)
-      aes_decrypt(&context, message_block, message_block);
-    else
-      aes_encrypt(&context, message_block, message_block);
+      /* Do the job */
+      if(modifier_bit)
+        aes_decrypt(&context, message_block, message_block);
+      else
+        aes_encrypt(&context, message_block, message_block);
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + i, message_block, 16);
+      else
+        ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("output:", message_block, 16);
+      LOGBYTE("output:", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KM_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -1687,12 +1844,16 @@ static void ARCH_DEP(km_xts_aes)(int r1, int r2, REGS *regs)
   aes_context context;
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[16];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE parameter_block[80];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
   BYTE *xts;
@@ -1748,42 +1909,61 @@ static void ARCH_DEP(km_xts_aes)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 16, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += 16)
+    {
+      /* Fetch a block of data */
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, 16);
+      else
+        ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
-    /* XOR, decrypt/encrypt and XOR again*/
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
-    if(modifier_bit)
-      aes_decrypt(&context, message_block, message_block);
-    else
-      aes_encrypt(&context, message_block, message_block);
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
+      /* XOR, decrypt/encrypt and XOR again*/
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
+      if(modifier_bit)
+        aes_decrypt(&context, message_block, message_block);
+      else
+        aes_encrypt(&context, message_block, message_block);
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= parameter_block[parameter_blocklen - 16 + i];
+
+      /* Calculate output XTS */
+      xts_mult_x(xts);
 
-    /* Calculate output XTS */
-    xts_mult_x(xts);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, message_block, 16);
+      else
+        ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
-    /* Store the output and XTS */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+#ifdef OPTION_KM_DEBUG
+      LOGBYTE("output:", message_block, 16);
+#endif /* #ifdef OPTION_KM_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
+
+    /* Store the XTS */
     ARCH_DEP(vstorec)(xts, 15, (GR_A(1, regs) + parameter_blocklen - 16) & ADDRESS_MAXWRAP(regs), 1, regs);
 
 #ifdef OPTION_KM_DEBUG
-    LOGBYTE("output:", message_block, 16);
     LOGBYTE("xts   :", xts, 16);
 #endif /* #ifdef OPTION_KM_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KM_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2099,13 +2279,17 @@ static void ARCH_DEP(kmc_dea)(int r1, int r2, REGS *regs)
   des_context context3;
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[8];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE ocv[8];
   BYTE parameter_block[56];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -2201,95 +2385,112 @@ static void ARCH_DEP(kmc_dea)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 8)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 8, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += 8)
+    {
+      /* Fetch a block of data */
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, 8);
+      else
+        ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("input :", message_block, 8);
+      LOGBYTE("input :", message_block, 8);
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
-    /* Do the job */
-    switch(tfc)
-    {
-      case 1: /* dea */
+      /* Do the job */
+      switch(tfc)
       {
-        if(modifier_bit)
+        case 1: /* dea */
         {
-          /* Save, decrypt and XOR */
-          memcpy(ocv, message_block, 8);
-          des_decrypt(&context1, message_block, message_block);
-          for(i = 0; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
+          if(modifier_bit)
+          {
+            /* Save, decrypt and XOR */
+            memcpy(ocv, message_block, 8);
+            des_decrypt(&context1, message_block, message_block);
+            for(i = 0; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+          }
+          else
+          {
+            /* XOR, encrypt and save */
+            for(i = 0; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+            des_encrypt(&context1, message_block, message_block);
+            memcpy(ocv, message_block, 8);
+          }
+          break;
         }
-        else
+        case 2: /* tdea-128 */
         {
-          /* XOR, encrypt and save */
-          for(i = 0; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
-          des_encrypt(&context1, message_block, message_block);
-          memcpy(ocv, message_block, 8);
+          if(modifier_bit)
+          {
+            /* Save, decrypt and XOR */
+            memcpy(ocv, message_block, 8);
+            des_decrypt(&context1, message_block, message_block);
+            des_encrypt(&context2, message_block, message_block);
+            des_decrypt(&context1, message_block, message_block);
+            for(i = 0; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+          }
+          else
+          {
+            /* XOR, encrypt and save */
+            for(i = 0 ; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+            des_encrypt(&context1, message_block, message_block);
+            des_decrypt(&context2, message_block, message_block);
+            des_encrypt(&context1, message_block, message_block);
+            memcpy(ocv, message_block, 8);
+          }
+          break;
         }
-        break;
-      }
-      case 2: /* tdea-128 */
-      {
-        if(modifier_bit)
+        case 3: /* tdea-192 */
         {
-          /* Save, decrypt and XOR */
-          memcpy(ocv, message_block, 8);
-          des_decrypt(&context1, message_block, message_block);
-          des_encrypt(&context2, message_block, message_block);
-          des_decrypt(&context1, message_block, message_block);
-          for(i = 0; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
+          if(modifier_bit)
+          {
+            /* Save, decrypt and XOR */
+            memcpy(ocv, message_block, 8);
+            des_decrypt(&context3, message_block, message_block);
+            des_encrypt(&context2, message_block, message_block);
+            des_decrypt(&context1, message_block, message_block);
+            for(i = 0; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+          }
+          else
+          {
+            /* XOR, encrypt and save */
+            for(i = 0; i < 8; i++)
+              message_block[i] ^= parameter_block[i];
+            des_encrypt(&context1, message_block, message_block);
+            des_decrypt(&context2, message_block, message_block);
+            des_encrypt(&context3, message_block, message_block);
+            memcpy(ocv, message_block, 8);
+          }
+          break;
         }
-        else
-        {
-          /* XOR, encrypt and save */
-          for(i = 0 ; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
-          des_encrypt(&context1, message_block, message_block);
-          des_decrypt(&context2, message_block, message_block);
-          des_encrypt(&context1, message_block, message_block);
-          memcpy(ocv, message_block, 8);
-        }
-        break;
       }
-      case 3: /* tdea-192 */
-      {
-        if(modifier_bit)
-        {
-          /* Save, decrypt and XOR */
-          memcpy(ocv, message_block, 8);
-          des_decrypt(&context3, message_block, message_block);
-          des_encrypt(&context2, message_block, message_block);
-          des_decrypt(&context1, message_block, message_block);
-          for(i = 0; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
-        }
-        else
-        {
-          /* XOR, encrypt and save */
-          for(i = 0; i < 8; i++)
-            message_block[i] ^= parameter_block[i];
-          des_encrypt(&context1, message_block, message_block);
-          des_decrypt(&context2, message_block, message_block);
-          des_encrypt(&context3, message_block, message_block);
-          memcpy(ocv, message_block, 8);
-        }
-        break;
-      }
-    }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, message_block, 8);
+      else
+        ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("output:", message_block, 8);
+      LOGBYTE("output:", message_block, 8);
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
+      /* Set cv for next 8 bytes */
+      memcpy(parameter_block, ocv, 8);
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
+
     /* Store the output chaining value */
     ARCH_DEP(vstorec)(ocv, 7, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
 
@@ -2298,10 +2499,10 @@ static void ARCH_DEP(kmc_dea)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 8);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 8);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 8);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMC_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2315,9 +2516,6 @@ static void ARCH_DEP(kmc_dea)(int r1, int r2, REGS *regs)
       regs->psw.cc = 0;
       return;
     }
-
-    /* Set cv for next 8 bytes */
-    memcpy(parameter_block, ocv, 8);
   }
 
   /* CPU-determined amount of data processed */
@@ -2333,13 +2531,17 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
   aes_context context;
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[16];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE ocv[16];
   BYTE parameter_block[80];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -2395,41 +2597,58 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 16, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += 16)
+    {
+      /* Fetch a block of data */
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, 16);
+      else
+        ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
-    /* Do the job */
-    if(modifier_bit)
-    {
+      /* Do the job */
+      if(modifier_bit)
+      {
 
-      /* Save, decrypt and XOR */
-      memcpy(ocv, message_block, 16);
-      aes_decrypt(&context, message_block, message_block);
-      for(i = 0; i < 16; i++)
-        message_block[i] ^= parameter_block[i];
-    }
-    else
-    {
-      /* XOR, encrypt and save */
-      for(i = 0; i < 16; i++)
-        message_block[i] ^= parameter_block[i];
-      aes_encrypt(&context, message_block, message_block);
-      memcpy(ocv, message_block, 16);
-    }
+        /* Save, decrypt and XOR */
+        memcpy(ocv, message_block, 16);
+        aes_decrypt(&context, message_block, message_block);
+        for(i = 0; i < 16; i++)
+          message_block[i] ^= parameter_block[i];
+      }
+      else
+      {
+        /* XOR, encrypt and save */
+        for(i = 0; i < 16; i++)
+          message_block[i] ^= parameter_block[i];
+        aes_encrypt(&context, message_block, message_block);
+        memcpy(ocv, message_block, 16);
+      }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, message_block, 16);
+      else
+        ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMC_DEBUG
-    LOGBYTE("output:", message_block, 16);
+      LOGBYTE("output:", message_block, 16);
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
+      /* Set cv for next 16 bytes */
+      memcpy(parameter_block, ocv, 16);
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
+
     /* Store the output chaining value */
     ARCH_DEP(vstorec)(ocv, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
 
@@ -2438,10 +2657,10 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMC_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMC_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2455,9 +2674,6 @@ static void ARCH_DEP(kmc_aes)(int r1, int r2, REGS *regs)
       regs->psw.cc = 0;
       return;
     }
-
-    /* Set cv for next 16 bytes */
-    memcpy(parameter_block, ocv, 16);
   }
 
   /* CPU-determined amount of data processed */
@@ -2603,13 +2819,18 @@ static void ARCH_DEP(kmctr_dea)(int r1, int r2, int r3, REGS *regs)
   BYTE countervalue_block[8];
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[8];
+  BYTE *op1;
+  BYTE *op2;
+  BYTE *op3;
   BYTE parameter_block[48];
   int parameter_blocklen;
   int r1_is_not_r2;
   int r1_is_not_r3;
   int r2_is_not_r3;
+  int span;
   int tfc;
   int wrap;
 
@@ -2700,60 +2921,79 @@ static void ARCH_DEP(kmctr_dea)(int r1, int r2, int r3, REGS *regs)
   r1_is_not_r2 = r1 != r2;
   r1_is_not_r3 = r1 != r3;
   r2_is_not_r3 = r2 != r3;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 8)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data and counter-value */
-    ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
-    ARCH_DEP(vfetchc)(countervalue_block, 7, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, r3, 8, &op1, &op2, &op3, regs);
 
-#ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("input :", message_block, 8);
-    LOGBYTE("cv    :", countervalue_block, 8);
-#endif /* #ifdef OPTION_KMCTR_DEBUG */
-
-    /* Do the job */
-    switch(tfc)
+    for(j = 0; j < span; j += 8)
     {
-      /* Encrypt */
-      case 1: /* dea */
+      /* Fetch a block of data and counter-value */
+      if(likely(op2 != NULL))
       {
-        des_encrypt(&context1, countervalue_block, countervalue_block);
-        break;
+        memcpy(message_block, op2 + j, 8);
+        memcpy(countervalue_block, op3 + j, 8);
       }
-      case 2: /* tdea-128 */
+      else
       {
-        des_encrypt(&context1, countervalue_block, countervalue_block);
-        des_decrypt(&context2, countervalue_block, countervalue_block);
-        des_encrypt(&context1, countervalue_block, countervalue_block);
-        break;
+        ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+        ARCH_DEP(vfetchc)(countervalue_block, 7, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
       }
-      case 3: /* tdea-192 */
+
+#ifdef OPTION_KMCTR_DEBUG
+      LOGBYTE("input :", message_block, 8);
+      LOGBYTE("cv    :", countervalue_block, 8);
+#endif /* #ifdef OPTION_KMCTR_DEBUG */
+
+      /* Do the job */
+      switch(tfc)
       {
-        des_encrypt(&context1, countervalue_block, countervalue_block);
-        des_decrypt(&context2, countervalue_block, countervalue_block);
-        des_encrypt(&context3, countervalue_block, countervalue_block);
-        break;
+        /* Encrypt */
+        case 1: /* dea */
+        {
+          des_encrypt(&context1, countervalue_block, countervalue_block);
+          break;
+        }
+        case 2: /* tdea-128 */
+        {
+          des_encrypt(&context1, countervalue_block, countervalue_block);
+          des_decrypt(&context2, countervalue_block, countervalue_block);
+          des_encrypt(&context1, countervalue_block, countervalue_block);
+          break;
+        }
+        case 3: /* tdea-192 */
+        {
+          des_encrypt(&context1, countervalue_block, countervalue_block);
+          des_decrypt(&context2, countervalue_block, countervalue_block);
+          des_encrypt(&context3, countervalue_block, countervalue_block);
+          break;
+        }
       }
-    }
 
-    /* XOR */
-    for(i = 0; i < 8; i++)
-      countervalue_block[i] ^= message_block[i];
+      /* XOR */
+      for(i = 0; i < 8; i++)
+        countervalue_block[i] ^= message_block[i];
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(countervalue_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, countervalue_block, 8);
+      else
+        ARCH_DEP(vstorec)(countervalue_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("output:", countervalue_block, 8);
+      LOGBYTE("output:", countervalue_block, 8);
 #endif /* #ifdef OPTION_KMCTR_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 8);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 8);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 8);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
     if(likely(r1_is_not_r3 && r2_is_not_r3))
-      SET_GR_A(r3, regs, GR_A(r3, regs) + 8);
+      SET_GR_A(r3, regs, GR_A(r3, regs) + span);
 
 #ifdef OPTION_KMCTR_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2783,13 +3023,18 @@ static void ARCH_DEP(kmctr_aes)(int r1, int r2, int r3, REGS *regs)
   BYTE countervalue_block[16];
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[16];
+  BYTE *op1;
+  BYTE *op2;
+  BYTE *op3;
   BYTE parameter_block[64];
   int parameter_blocklen;
   int r1_is_not_r2;
   int r1_is_not_r3;
   int r2_is_not_r3;
+  int span;
   int fc;
   int tfc;
   int wrap;
@@ -2842,38 +3087,57 @@ static void ARCH_DEP(kmctr_aes)(int r1, int r2, int r3, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   r1_is_not_r2 = r1 != r2;
   r1_is_not_r3 = r1 != r3;
-  r2_is_not_r3 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  r2_is_not_r3 = r2 != r3;
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Fetch a block of data and counter-value */
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
-    ARCH_DEP(vfetchc)(countervalue_block, 15, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, r3, 16, &op1, &op2, &op3, regs);
+
+    for(j = 0; j < span; j += 16)
+    {
+      /* Fetch a block of data and counter-value */
+      if(likely(op2 != NULL))
+      {
+        memcpy(message_block, op2 + j, 16);
+        memcpy(countervalue_block, op3 + j, 16);
+      }
+      else
+      {
+        ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+        ARCH_DEP(vfetchc)(countervalue_block, 15, GR_A(r3, regs) & ADDRESS_MAXWRAP(regs), r3, regs);
+      }
 
 #ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("input :", message_block, 16);
-    LOGBYTE("cv    :", countervalue_block, 16);
+      LOGBYTE("input :", message_block, 16);
+      LOGBYTE("cv    :", countervalue_block, 16);
 #endif /* #ifdef OPTION_KMCTR_DEBUG */
 
-    /* Do the job */
-    /* Encrypt and XOR */
-    aes_encrypt(&context, countervalue_block, countervalue_block);
-    for(i = 0; i < 16; i++)
-      countervalue_block[i] ^= message_block[i];
+      /* Do the job */
+      /* Encrypt and XOR */
+      aes_encrypt(&context, countervalue_block, countervalue_block);
+      for(i = 0; i < 16; i++)
+        countervalue_block[i] ^= message_block[i];
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(countervalue_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, countervalue_block, 16);
+      else
+        ARCH_DEP(vstorec)(countervalue_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMCTR_DEBUG
-    LOGBYTE("output:", countervalue_block, 16);
+      LOGBYTE("output:", countervalue_block, 16);
 #endif /* #ifdef OPTION_KMCTR_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
     if(likely(r1_is_not_r3 && r2_is_not_r3))
-      SET_GR_A(r3, regs, GR_A(r3, regs) + 16);
+      SET_GR_A(r3, regs, GR_A(r3, regs) + span);
 
 #ifdef OPTION_KMCTR_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -2904,14 +3168,18 @@ static void ARCH_DEP(kmf_dea)(int r1, int r2, REGS *regs)
   des_context context3;
   int crypted;
   int i;
+  int j;
   int keylen;
   int lcfb;
   BYTE message_block[8];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE output_block[8];
   BYTE parameter_block[56];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -3008,60 +3276,74 @@ static void ARCH_DEP(kmf_dea)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += lcfb)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Do the job */
-    switch(tfc)
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, lcfb, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += lcfb)
     {
-      case 1: /* dea */
+      /* Do the job */
+      switch(tfc)
       {
-        des_encrypt(&context1, parameter_block, output_block);
-        break;
-      }
-      case 2: /* tdea-128 */
-      {
-        des_encrypt(&context1, parameter_block, output_block);
-        des_decrypt(&context2, output_block, output_block);
-        des_encrypt(&context1, output_block, output_block);
-        break;
-      }
-      case 3: /* tdea-192 */
-      {
-        des_encrypt(&context1, parameter_block, output_block);
-        des_decrypt(&context2, output_block, output_block);
-        des_encrypt(&context3, output_block, output_block);
-        break;
+        case 1: /* dea */
+        {
+          des_encrypt(&context1, parameter_block, output_block);
+          break;
+        }
+        case 2: /* tdea-128 */
+        {
+          des_encrypt(&context1, parameter_block, output_block);
+          des_decrypt(&context2, output_block, output_block);
+          des_encrypt(&context1, output_block, output_block);
+          break;
+        }
+        case 3: /* tdea-192 */
+        {
+          des_encrypt(&context1, parameter_block, output_block);
+          des_decrypt(&context2, output_block, output_block);
+          des_encrypt(&context3, output_block, output_block);
+          break;
+        }
       }
-    }
-    ARCH_DEP(vfetchc)(message_block, lcfb - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, lcfb);
+      else
+        ARCH_DEP(vfetchc)(message_block, lcfb - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMF_DEBUG
-    LOGBYTE("input :", message_block, lcfb);
+      LOGBYTE("input :", message_block, lcfb);
 #endif /* #ifdef OPTION_KMF_DEBUG */
 
-    for(i = 0; i < lcfb; i++)
-      output_block[i] ^= message_block[i];
-    for(i = 0; i < 8 - lcfb; i++)
-       parameter_block[i] = parameter_block[i + lcfb];
-    if(modifier_bit)
-    {
-      /* Decipher */
-      for(i = 0; i < lcfb; i++)
-        parameter_block[i + 8 - lcfb] = message_block[i];
-    }
-    else
-    {
-      /* Encipher */
       for(i = 0; i < lcfb; i++)
-        parameter_block[i + 8 - lcfb] = output_block[i];
-    }
+        output_block[i] ^= message_block[i];
+      for(i = 0; i < 8 - lcfb; i++)
+         parameter_block[i] = parameter_block[i + lcfb];
+      if(modifier_bit)
+      {
+        /* Decipher */
+        for(i = 0; i < lcfb; i++)
+          parameter_block[i + 8 - lcfb] = message_block[i];
+      }
+      else
+      {
+        /* Encipher */
+        for(i = 0; i < lcfb; i++)
+          parameter_block[i + 8 - lcfb] = output_block[i];
+      }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(output_block, lcfb - 1, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, output_block, lcfb);
+      else
+        ARCH_DEP(vstorec)(output_block, lcfb - 1, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMF_DEBUG
-    LOGBYTE("output:", output_block, lcfb);
+      LOGBYTE("output:", output_block, lcfb);
 #endif /* #ifdef OPTION_KMF_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Store the chaining value */
     ARCH_DEP(vstorec)(parameter_block, 7, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -3071,10 +3353,10 @@ static void ARCH_DEP(kmf_dea)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMF_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + lcfb);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + lcfb);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - lcfb);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMF_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -3102,14 +3384,18 @@ static void ARCH_DEP(kmf_aes)(int r1, int r2, REGS *regs)
   aes_context context;
   int crypted;
   int i;
+  int j;
   int keylen;
   int lcfb;
   BYTE message_block[16];
   int modifier_bit;
+  BYTE *op1;
+  BYTE *op2;
   BYTE output_block[16];
   BYTE parameter_block[80];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -3166,38 +3452,52 @@ static void ARCH_DEP(kmf_aes)(int r1, int r2, REGS *regs)
   /* Try to process the CPU-determined amount of data */
   modifier_bit = GR0_m(regs);
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += lcfb)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    aes_encrypt(&context, parameter_block, output_block);
-    ARCH_DEP(vfetchc)(message_block, lcfb - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, lcfb, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += lcfb)
+    {
+      aes_encrypt(&context, parameter_block, output_block);
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, lcfb);
+      else
+        ARCH_DEP(vfetchc)(message_block, lcfb - 1, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMF_DEBUG
-    LOGBYTE("input :", message_block, lcfb);
+      LOGBYTE("input :", message_block, lcfb);
 #endif /* #ifdef OPTION_KMF_DEBUG */
 
-    for(i = 0; i < lcfb; i++)
-      output_block[i] ^= message_block[i];
-    for(i = 0; i < 16 - lcfb; i++)
-      parameter_block[i] = parameter_block[i + lcfb];
-    if(modifier_bit)
-    {
-      /* Decipher */
       for(i = 0; i < lcfb; i++)
-        parameter_block[i + 16 - lcfb] = message_block[i];
-    }
-    else
-    {
-      /* Encipher */
-      for(i = 0; i < lcfb; i++)
-        parameter_block[i + 16 - lcfb] = output_block[i];
-    }
+        output_block[i] ^= message_block[i];
+      for(i = 0; i < 16 - lcfb; i++)
+        parameter_block[i] = parameter_block[i + lcfb];
+      if(modifier_bit)
+      {
+        /* Decipher */
+        for(i = 0; i < lcfb; i++)
+          parameter_block[i + 16 - lcfb] = message_block[i];
+      }
+      else
+      {
+        /* Encipher */
+        for(i = 0; i < lcfb; i++)
+          parameter_block[i + 16 - lcfb] = output_block[i];
+      }
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(output_block, lcfb - 1, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, output_block, lcfb);
+      else
+        ARCH_DEP(vstorec)(output_block, lcfb - 1, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMF_DEBUG
-    LOGBYTE("output:", output_block, lcfb);
+      LOGBYTE("output:", output_block, lcfb);
 #endif /* #ifdef OPTION_KMF_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Store the chaining value */
     ARCH_DEP(vstorec)(parameter_block, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -3207,10 +3507,10 @@ static void ARCH_DEP(kmf_aes)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMF_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + lcfb);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + lcfb);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - lcfb);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMF_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -3240,11 +3540,15 @@ static void ARCH_DEP(kmo_dea)(int r1, int r2, REGS *regs)
   des_context context3;
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[8];
+  BYTE *op1;
+  BYTE *op2;
   BYTE parameter_block[56];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -3337,46 +3641,60 @@ static void ARCH_DEP(kmo_dea)(int r1, int r2, REGS *regs)
 
   /* Try to process the CPU-determined amount of data */
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 8)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    /* Do the job */
-    switch(tfc)
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 8, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += 8)
     {
-      case 1: /* dea */
-      {
-        des_encrypt(&context1, parameter_block, parameter_block);
-        break;
-      }
-      case 2: /* tdea-128 */
-      {
-        des_encrypt(&context1, parameter_block, parameter_block);
-        des_decrypt(&context2, parameter_block, parameter_block);
-        des_encrypt(&context1, parameter_block, parameter_block);
-        break;
-      }
-      case 3: /* tdea-192 */
+      /* Do the job */
+      switch(tfc)
       {
-        des_encrypt(&context1, parameter_block, parameter_block);
-        des_decrypt(&context2, parameter_block, parameter_block);
-        des_encrypt(&context3, parameter_block, parameter_block);
-        break;
+        case 1: /* dea */
+        {
+          des_encrypt(&context1, parameter_block, parameter_block);
+          break;
+        }
+        case 2: /* tdea-128 */
+        {
+          des_encrypt(&context1, parameter_block, parameter_block);
+          des_decrypt(&context2, parameter_block, parameter_block);
+          des_encrypt(&context1, parameter_block, parameter_block);
+          break;
+        }
+        case 3: /* tdea-192 */
+        {
+          des_encrypt(&context1, parameter_block, parameter_block);
+          des_decrypt(&context2, parameter_block, parameter_block);
+          des_encrypt(&context3, parameter_block, parameter_block);
+          break;
+        }
       }
-    }
-    ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, 8);
+      else
+        ARCH_DEP(vfetchc)(message_block, 7, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMO_DEBUG
-    LOGBYTE("input :", message_block, 8);
+      LOGBYTE("input :", message_block, 8);
 #endif /* #ifdef OPTION_KMO_DEBUG */
 
-    for(i = 0; i < 8; i++)
-      message_block[i] ^= parameter_block[i];
+      for(i = 0; i < 8; i++)
+        message_block[i] ^= parameter_block[i];
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, message_block, 8);
+      else
+        ARCH_DEP(vstorec)(message_block, 7, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMO_DEBUG
-    LOGBYTE("output:", message_block, 8);
+      LOGBYTE("output:", message_block, 8);
 #endif /* #ifdef OPTION_KMO_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Store the chaining value */
     ARCH_DEP(vstorec)(parameter_block, 7, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -3386,10 +3704,10 @@ static void ARCH_DEP(kmo_dea)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMO_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 8);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 8);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 8);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMO_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -3417,11 +3735,15 @@ static void ARCH_DEP(kmo_aes)(int r1, int r2, REGS *regs)
   aes_context context;
   int crypted;
   int i;
+  int j;
   int keylen;
   BYTE message_block[16];
+  BYTE *op1;
+  BYTE *op2;
   BYTE parameter_block[80];
   int parameter_blocklen;
   int r1_is_not_r2;
+  int span;
   int tfc;
   int wrap;
 
@@ -3474,24 +3796,38 @@ static void ARCH_DEP(kmo_aes)(int r1, int r2, REGS *regs)
 
   /* Try to process the CPU-determined amount of data */
   r1_is_not_r2 = r1 != r2;
-  for(crypted = 0; crypted < PROCESS_MAX; crypted += 16)
+  for(crypted = 0; crypted < PROCESS_MAX; crypted += span)
   {
-    aes_encrypt(&context, parameter_block, parameter_block);
-    ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
+    /* Map the operands up to the next 2K boundary */
+    span = ARCH_DEP(crypt_span)(r1, r2, 0, 16, &op1, &op2, NULL, regs);
+
+    for(j = 0; j < span; j += 16)
+    {
+      aes_encrypt(&context, parameter_block, parameter_block);
+      if(likely(op2 != NULL))
+        memcpy(message_block, op2 + j, 16);
+      else
+        ARCH_DEP(vfetchc)(message_block, 15, GR_A(r2, regs) & ADDRESS_MAXWRAP(regs), r2, regs);
 
 #ifdef OPTION_KMO_DEBUG
-    LOGBYTE("input :", message_block, 16);
+      LOGBYTE("input :", message_block, 16);
 #endif /* #ifdef OPTION_KMO_DEBUG */
 
-    for(i = 0; i < 16; i++)
-      message_block[i] ^= parameter_block[i];
+      for(i = 0; i < 16; i++)
+        message_block[i] ^= parameter_block[i];
 
-    /* Store the output */
-    ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
+      /* Store the output */
+      if(likely(op1 != NULL))
+        memcpy(op1 + j, message_block, 16);
+      else
+        ARCH_DEP(vstorec)(message_block, 15, GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), r1, regs);
 
 #ifdef OPTION_KMO_DEBUG
-    LOGBYTE("output:", message_block, 16);
+      LOGBYTE("output:", message_block, 16);
 #endif /* #ifdef OPTION_KMO_DEBUG */
+    }
+    if(likely(op1 != NULL))
+      ITIMER_UPDATE(GR_A(r1, regs) & ADDRESS_MAXWRAP(regs), span - 1, regs);
 
     /* Store the chaining value */
     ARCH_DEP(vstorec)(parameter_block, 15, GR_A(1, regs) & ADDRESS_MAXWRAP(regs), 1, regs);
@@ -3501,10 +3837,10 @@ static void ARCH_DEP(kmo_aes)(int r1, int r2, REGS *regs)
 #endif /* #ifdef OPTION_KMO_DEBUG */
 
     /* Update the registers */
-    SET_GR_A(r1, regs, GR_A(r1, regs) + 16);
+    SET_GR_A(r1, regs, GR_A(r1, regs) + span);
     if(likely(r1_is_not_r2))
-      SET_GR_A(r2, regs, GR_A(r2, regs) + 16);
-    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - 16);
+      SET_GR_A(r2, regs, GR_A(r2, regs) + span);
+    SET_GR_A(r2 + 1, regs, GR_A(r2 + 1, regs) - span);
 
 #ifdef OPTION_KMO_DEBUG
     WRMSG(HHC90108, "D", r1, (regs)->GR(r1));
@@ -0,0 +1,70 @@
+/* HWACCEL.H    Host crypto instruction detection for dyncrypt       */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* When built with gcc or clang for an x86 host the AES, GHASH and   */
+/* SHA-1/SHA-256 primitives used by dyncrypt can use the host's      */
+/* AES-NI, PCLMULQDQ and SHA extensions.  Availability is decided    */
+/* at run time with CPUID, so a binary built on a new host still     */
+/* runs (using the portable C code) on an older one.                 */
+/*-------------------------------------------------------------------*/
+
+#ifndef _HWACCEL_H_
+#define _HWACCEL_H_
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+
+#define HAVE_X86_CRYPTO_ACCEL           /* Intrinsic paths compiled  */
+
+#include <cpuid.h>
+
+#define HWACCEL_AES     0x01            /* AES-NI                    */
+#define HWACCEL_CLMUL   0x02            /* PCLMULQDQ                 */
+#define HWACCEL_SHA     0x04            /* SHA-NI (+ SSSE3, SSE4.1)  */
+
+/*-------------------------------------------------------------------*/
+/* Return mask of usable host crypto extensions. The CPUID probe is  */
+/* done once per translation unit; a concurrent first call simply    */
+/* performs the same probe twice and stores the same answer.         */
+/*-------------------------------------------------------------------*/
+static inline int hwaccel_features( void )
+{
+    static int features = -1;
+    unsigned int eax, ebx, ecx, edx;
+    int f = 0;
+
+    if (features >= 0)
+        return features;
+
+    if (__get_cpuid( 1, &eax, &ebx, &ecx, &edx ))
+    {
+        if (ecx & bit_AES)
+            f |= HWACCEL_AES;
+        if (ecx & bit_PCLMUL)
+            f |= HWACCEL_CLMUL;
+
+        if ((ecx & bit_SSSE3) && (ecx & bit_SSE4_1)
+         && __get_cpuid_max( 0, NULL ) >= 7)
+        {
+            __cpuid_count( 7, 0, eax, ebx, ecx, edx );
+            if (ebx & bit_SHA)
+                f |= HWACCEL_SHA;
+        }
+    }
+
+    features = f;
+    return f;
+}
+
+#define HWACCEL_HAVE( _f )  ( hwaccel_features() & (_f) )
+
+#else /* !x86 gcc/clang */
+
+#define HWACCEL_HAVE( _f )  ( 0 )
+
+#endif
+
+#endif /* _HWACCEL_H_ */
@@ -27,6 +27,7 @@
 
 #include "hstdinc.h"
 #include "sha1.h"
+#include "hwaccel.h"
 
 #ifndef bcopy
 #define bcopy(_src,_dest,_len) memcpy(_dest,_src,_len)
@@ -186,11 +187,96 @@ SHA1Final(unsigned char digest[SHA1_DIGEST_LENGTH], SHA1_CTX *context)
 }
 
 
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+/* SHA1Transform using the SHA extensions (SHA1RNDS4 and friends).
+ * ABCD is kept in one register with A in the high lane; E rides in
+ * the high lane of E0/E1, which alternate as in the instruction
+ * descriptions.  Each SHA1_RNDS4 does four rounds for message group
+ * i and advances the message schedule for the groups that follow.
+ */
+#include <immintrin.h>
+
+#define SHA1_RNDS4(i, Ex, Ey, Mi, Mn, Mx, Mp)                           \
+    Ex = _mm_sha1nexte_epu32(Ex, Mi);                                   \
+    Ey = abcd;                                                          \
+    Mn = _mm_sha1msg2_epu32(Mn, Mi);                                    \
+    abcd = _mm_sha1rnds4_epu32(abcd, Ex, (i) / 5);                      \
+    Mp = _mm_sha1msg1_epu32(Mp, Mi);                                    \
+    Mx = _mm_xor_si128(Mx, Mi);
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static void
+SHA1TransformSHANI(u_int32_t state[5], const unsigned char buffer[64])
+{
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL,
+                                        0x08090a0b0c0d0e0fULL);
+    __m128i abcd, abcd_save, e0, e0_save, e1;
+    __m128i m0, m1, m2, m3;
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1B);
+    e0 = _mm_set_epi32(state[4], 0, 0, 0);
+    abcd_save = abcd;
+    e0_save = e0;
+
+    /* Rounds 0-11: load the message and prime the schedule */
+    m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buffer +  0)), mask);
+    e0 = _mm_add_epi32(e0, m0);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+    m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buffer + 16)), mask);
+    e1 = _mm_sha1nexte_epu32(e1, m1);
+    e0 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+    m0 = _mm_sha1msg1_epu32(m0, m1);
+
+    m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buffer + 32)), mask);
+    e0 = _mm_sha1nexte_epu32(e0, m2);
+    e1 = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+    m1 = _mm_sha1msg1_epu32(m1, m2);
+    m0 = _mm_xor_si128(m0, m2);
+
+    m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(buffer + 48)), mask);
+
+    /* Rounds 12-79 */
+    SHA1_RNDS4( 3, e1, e0, m3, m0, m1, m2);
+    SHA1_RNDS4( 4, e0, e1, m0, m1, m2, m3);
+    SHA1_RNDS4( 5, e1, e0, m1, m2, m3, m0);
+    SHA1_RNDS4( 6, e0, e1, m2, m3, m0, m1);
+    SHA1_RNDS4( 7, e1, e0, m3, m0, m1, m2);
+    SHA1_RNDS4( 8, e0, e1, m0, m1, m2, m3);
+    SHA1_RNDS4( 9, e1, e0, m1, m2, m3, m0);
+    SHA1_RNDS4(10, e0, e1, m2, m3, m0, m1);
+    SHA1_RNDS4(11, e1, e0, m3, m0, m1, m2);
+    SHA1_RNDS4(12, e0, e1, m0, m1, m2, m3);
+    SHA1_RNDS4(13, e1, e0, m1, m2, m3, m0);
+    SHA1_RNDS4(14, e0, e1, m2, m3, m0, m1);
+    SHA1_RNDS4(15, e1, e0, m3, m0, m1, m2);
+    SHA1_RNDS4(16, e0, e1, m0, m1, m2, m3);
+    SHA1_RNDS4(17, e1, e0, m1, m2, m3, m0);
+    SHA1_RNDS4(18, e0, e1, m2, m3, m0, m1);
+    SHA1_RNDS4(19, e1, e0, m3, m0, m1, m2);
+
+    e0 = _mm_sha1nexte_epu32(e0, e0_save);
+    abcd = _mm_add_epi32(abcd, abcd_save);
+
+    _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = _mm_extract_epi32(e0, 3);
+}
+#endif /* defined(HAVE_X86_CRYPTO_ACCEL) */
+
 /* Hashing-only function called by dyncrypt */
 
 void
 sha1_process(sha1_context *ctx, unsigned char data[64])
 {
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+    if (HWACCEL_HAVE(HWACCEL_SHA)) {
+        SHA1TransformSHANI(ctx->state, data);
+        return;
+    }
+#endif
     SHA1Transform(ctx->state, data);
 }
 
@@ -53,6 +53,7 @@
 #include "opcode.h" /* For CSWAP macros */
 
 #include "sha256.h"
+#include "hwaccel.h"
 
 #ifndef bcopy
 #define bcopy(_src,_dest,_len) memcpy(_dest,_src,_len)
@@ -517,11 +518,93 @@ SHA256_Final(u_int8_t digest[], SHA256_CTX *context)
 }
 
 
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+/*
+ * SHA256_Transform using the SHA extensions.  SHA256RNDS2 wants the
+ * state split as ABEF/CDGH; each SHA256_RNDS4 does four rounds for
+ * message group j and advances the schedule for the groups after it.
+ */
+#include <immintrin.h>
+
+#define SHA256_RNDS4(j, Mj, Mn, Mp)                                     \
+ msg = _mm_add_epi32(Mj, _mm_loadu_si128((const __m128i *)&K256[4*(j)])); \
+ state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                   \
+ tmp = _mm_alignr_epi8(Mj, Mp, 4);                                      \
+ Mn = _mm_add_epi32(Mn, tmp);                                           \
+ Mn = _mm_sha256msg2_epu32(Mn, Mj);                                     \
+ msg = _mm_shuffle_epi32(msg, 0x0E);                                    \
+ state0 = _mm_sha256rnds2_epu32(state0, state1, msg);                   \
+ Mp = _mm_sha256msg1_epu32(Mp, Mj);
+
+#define SHA256_RNDS4_LOAD(j, Mj)                                        \
+ Mj = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16*(j))), mask); \
+ msg = _mm_add_epi32(Mj, _mm_loadu_si128((const __m128i *)&K256[4*(j)])); \
+ state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                   \
+ msg = _mm_shuffle_epi32(msg, 0x0E);                                    \
+ state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static void
+SHA256_TransformSHANI(u_int32_t state[8], const u_int8_t *data)
+{
+ const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                     0x0405060700010203ULL);
+ __m128i state0, state1, abef_save, cdgh_save;
+ __m128i msg, tmp, m0, m1, m2, m3;
+
+ tmp    = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+ state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+ state0 = _mm_alignr_epi8(tmp, state1, 8);      /* ABEF */
+ state1 = _mm_blend_epi16(state1, tmp, 0xF0);   /* CDGH */
+ abef_save = state0;
+ cdgh_save = state1;
+
+ SHA256_RNDS4_LOAD(0, m0);
+ SHA256_RNDS4_LOAD(1, m1);
+ m0 = _mm_sha256msg1_epu32(m0, m1);
+ SHA256_RNDS4_LOAD(2, m2);
+ m1 = _mm_sha256msg1_epu32(m1, m2);
+ m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+
+ SHA256_RNDS4( 3, m3, m0, m2);
+ SHA256_RNDS4( 4, m0, m1, m3);
+ SHA256_RNDS4( 5, m1, m2, m0);
+ SHA256_RNDS4( 6, m2, m3, m1);
+ SHA256_RNDS4( 7, m3, m0, m2);
+ SHA256_RNDS4( 8, m0, m1, m3);
+ SHA256_RNDS4( 9, m1, m2, m0);
+ SHA256_RNDS4(10, m2, m3, m1);
+ SHA256_RNDS4(11, m3, m0, m2);
+ SHA256_RNDS4(12, m0, m1, m3);
+ SHA256_RNDS4(13, m1, m2, m0);
+ SHA256_RNDS4(14, m2, m3, m1);
+
+ msg = _mm_add_epi32(m3, _mm_loadu_si128((const __m128i *)&K256[60]));
+ state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+ msg = _mm_shuffle_epi32(msg, 0x0E);
+ state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+ state0 = _mm_add_epi32(state0, abef_save);
+ state1 = _mm_add_epi32(state1, cdgh_save);
+
+ tmp    = _mm_shuffle_epi32(state0, 0x1B);      /* FEBA */
+ state1 = _mm_shuffle_epi32(state1, 0xB1);      /* DCHG */
+ _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+ _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+#endif /* defined(HAVE_X86_CRYPTO_ACCEL) */
+
 /* Hashing-only functions called by dyncrypt */
 
 void
 sha256_process(sha256_context *ctx, u_int8_t data[64])
 {
+#if defined(HAVE_X86_CRYPTO_ACCEL)
+ if (HWACCEL_HAVE(HWACCEL_SHA)) {
+  SHA256_TransformSHANI(ctx->state, data);
+  return;
+ }
+#endif
  SHA256_Transform(ctx, data);
 }
 
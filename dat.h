@@ -53,6 +53,12 @@
 /*      A program check may be generated for addressing and ASN      */
 /*      translation specification exceptions, in which case the      */
 /*      function does not return.                                    */
+/*                                                                   */
+/*      Where purge_alb exists (access-register architectures) the   */
+/*      real address of the ASTE is remembered in the ASN            */
+/*      translation cache, so that the AFTE lookup is skipped when   */
+/*      the same ASN is translated again.  The ASTE itself is always */
+/*      fetched and checked.                                         */
 /*-------------------------------------------------------------------*/
 _DAT_C_STATIC U16 ARCH_DEP(translate_asn) (U16 asn, REGS *regs,
                                                 U32 *asteo, U32 aste[])
@@ -64,6 +70,25 @@ BYTE   *aste_main;                      /* ASTE mainstor address     */
 int     code;                           /* Exception code            */
 int     numwords;                       /* ASTE size (4 or 16 words) */
 int     i;                              /* Array subscript           */
+#if defined(FEATURE_ACCESS_REGISTERS)
+ASNENT *ent;                            /* ASN translation cache ent */
+U32     afto;                           /* ASN cache key             */
+#endif /*defined(FEATURE_ACCESS_REGISTERS)*/
+
+    numwords = ASF_ENABLED(regs) ? 16 : 4;
+
+#if defined(FEATURE_ACCESS_REGISTERS)
+    /* ASN translation cache lookup */
+    afto = ((regs->CR_L(14) & CR14_AFTO) << 1) | (numwords == 16);
+    ent = &regs->asncache[asn & (ASNCACHE_ENTRIES - 1)];
+    if (ent->valid && ent->asn == asn && ent->afto == afto)
+    {
+        regs->asnhit++;
+        aste_addr = ent->asteo;
+        goto asn_fetch_aste;
+    }
+    regs->asnmiss++;
+#endif /*defined(FEATURE_ACCESS_REGISTERS)*/
 
     /* [3.9.3.1] Use the AFX to obtain the real address of the AFTE */
     afte_addr = (regs->CR(14) & CR14_AFTO) << 12;
@@ -97,11 +122,9 @@ int     i;                              /* Array subscript           */
     if (!ASF_ENABLED(regs)) {
         aste_addr = afte & AFTE_ASTO_0;
         aste_addr += (asn & ASN_ASX) << 4;
-        numwords = 4;
     } else {
         aste_addr = afte & AFTE_ASTO_1;
         aste_addr += (asn & ASN_ASX) << 6;
-        numwords = 16;
     }
 
     /* Ignore carry into bit position 0 of ASTO */
@@ -111,6 +134,15 @@ int     i;                              /* Array subscript           */
     if (aste_addr > regs->mainlim)
         goto asn_addr_excp;
 
+#if defined(FEATURE_ACCESS_REGISTERS)
+    /* Remember the ASTE address in the ASN translation cache */
+    ent->asn   = asn;
+    ent->afto  = afto;
+    ent->asteo = aste_addr;
+    ent->valid = 1;
+
+asn_fetch_aste:
+#endif /*defined(FEATURE_ACCESS_REGISTERS)*/
     /* Return the real address of the ASTE */
     *asteo = aste_addr;
 
@@ -494,11 +526,18 @@ int i;
     for(i = 1; i < 16; i++)
         if(regs->AEA_AR(i) >= CR_ALB_OFFSET)
             regs->AEA_AR(i) = 0;
+    memset(regs->albent, 0, sizeof(regs->albent));
+    memset(regs->asncache, 0, sizeof(regs->asncache));
 
     if(regs->host && regs->guestregs)
+    {
         for(i = 1; i < 16; i++)
             if(regs->guestregs->AEA_AR(i) >= CR_ALB_OFFSET)
                 regs->guestregs->AEA_AR(i) = 0;
+        memset(regs->guestregs->albent, 0, sizeof(regs->guestregs->albent));
+        memset(regs->guestregs->asncache, 0,
+               sizeof(regs->guestregs->asncache));
+    }
 
 } /* end function purge_alb */
 
@@ -570,6 +609,8 @@ U32     alet;                           /* Access list entry token   */
 U32     asteo;                          /* Real address of ASTE      */
 U32     aste[16];                       /* ASN second table entry    */
 U16     eax;                            /* Authorization index       */
+U32     cb;                             /* DUCT or PASTE address     */
+ALBENT *ent;                            /* ART lookaside buffer entry*/
 #else
     UNREFERENCED(acctype);
 #endif /*defined(FEATURE_ACCESS_REGISTERS)*/
@@ -663,24 +704,56 @@ U16     eax;                            /* Authorization index       */
                     /* Extract the extended AX from CR8 bits 0-15 (32-47) */
                     eax = regs->CR_LHH(8);
 
-                    /* [5.8.4.3] Perform ALET translation to obtain ASTE */
-                    if (ARCH_DEP(translate_alet) (alet, eax, acctype,
-                                                  regs, &asteo, aste))
-                        /* Exit if ALET translation error */
-                        return regs->dat.xcode;
+                    /* Control block holding the effective ALD */
+                    cb = (alet & ALET_PRI_LIST) ?
+                            regs->CR(5) & CR5_PASTEO :
+                            regs->CR(2) & CR2_DUCTO;
 
-                    /* [5.8.4.9] Obtain the STD or ASCE from the ASTE */
-                    regs->dat.asd = ASTE_AS_DESIGNATOR(aste);
-                    regs->dat.stid = TEA_ST_ARMODE;
-                    if(regs->dat.protect & 2)
+                    /* Look up the ALET in the ART lookaside buffer */
+                    ent = &regs->albent[(alet ^ (alet >> 16) ^ (cb >> 6))
+                                        & (ALB_ENTRIES - 1)];
+                    if (ent->valid && ent->alet == alet && ent->cb == cb
+                     && ent->eax == eax)
+                    {
+                        regs->albhit++;
+                        regs->dat.asd = ent->asd;
+                        regs->dat.protect = ent->protect;
+                        regs->dat.stid = TEA_ST_ARMODE;
+                    }
+                    else
                     {
-                #if defined(FEATURE_ESAME)
-                       regs->dat.asd ^= ASCE_RESV;
-                       regs->dat.asd |= ASCE_P;
-                #else
-                       regs->dat.asd ^= STD_RESV;
-                       regs->dat.asd |= STD_PRIVATE;
-                #endif
+                        regs->albmiss++;
+
+                        /* [5.8.4.3] Perform ALET translation to obtain ASTE */
+                        if (ARCH_DEP(translate_alet) (alet, eax, acctype,
+                                                      regs, &asteo, aste))
+                            /* Exit if ALET translation error */
+                            return regs->dat.xcode;
+
+                        /* [5.8.4.9] Obtain the STD or ASCE from the ASTE */
+                        regs->dat.asd = ASTE_AS_DESIGNATOR(aste);
+                        regs->dat.stid = TEA_ST_ARMODE;
+                        if(regs->dat.protect & 2)
+                        {
+                    #if defined(FEATURE_ESAME)
+                           regs->dat.asd ^= ASCE_RESV;
+                           regs->dat.asd |= ASCE_P;
+                    #else
+                           regs->dat.asd ^= STD_RESV;
+                           regs->dat.asd |= STD_PRIVATE;
+                    #endif
+                        }
+
+                        /* Make an ALB entry for ordinary ART */
+                        if (!(acctype & ACC_SPECIAL_ART))
+                        {
+                            ent->asd     = regs->dat.asd;
+                            ent->alet    = alet;
+                            ent->cb      = cb;
+                            ent->eax     = eax;
+                            ent->protect = regs->dat.protect & 2;
+                            ent->valid   = 1;
+                        }
                     }
 
                     /* Update ALB */
@@ -1731,11 +1804,79 @@ tran_excp_addr:
 } /* end function translate_addr */
 
 
+#if defined(_FEATURE_SIE)
+/*-------------------------------------------------------------------*/
+/* Assign a new tlbID to the guest TLB                               */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    Guest register context                               */
+/*                                                                   */
+/*      Guest TLB entries made under the tlbID of a retained SIE     */
+/*      context (see sie.c) are valid again when that context is     */
+/*      resumed, so guest tlbIDs are issued from sie_tlbIDmax and    */
+/*      are not reused until the identifier space wraps.  On a wrap  */
+/*      the whole guest TLB and all retained contexts are cleared.   */
+/*-------------------------------------------------------------------*/
+_DAT_C_STATIC void ARCH_DEP(new_guest_tlbid) (REGS *regs)
+{
+int i;
+
+    INVALIDATE_AIA(regs);
+    if (((++regs->sie_tlbIDmax) & TLBID_BYTEMASK) == 0)
+    {
+        memset(&regs->tlb.vaddr, 0, TLBN * sizeof(DW));
+        for (i = 0; i < SIE_TLBCTX_MAX; i++)
+            regs->sie_tlbctx[i].tlbID = 0;
+        regs->sie_tlbIDmax = 1;
+    }
+    regs->tlbID = regs->sie_tlbIDmax;
+
+} /* end function new_guest_tlbid */
+
+
+/*-------------------------------------------------------------------*/
+/* Purge the guest translation lookaside buffer                      */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    Guest register context                               */
+/*      all     0=Purge the current guest TLB entries only; the      */
+/*                context that owned them moves to the new tlbID     */
+/*              1=Also discard every retained SIE context, as the    */
+/*                host translation they were made under has changed  */
+/*-------------------------------------------------------------------*/
+_DAT_C_STATIC void ARCH_DEP(purge_guest_tlb) (REGS *regs, int all)
+{
+int i;
+unsigned int oldID = regs->tlbID;
+
+    ARCH_DEP(new_guest_tlbid) (regs);
+
+    for (i = 0; i < SIE_TLBCTX_MAX; i++)
+        if (all)
+            regs->sie_tlbctx[i].tlbID = 0;
+        else if (regs->sie_tlbctx[i].tlbID == oldID)
+            regs->sie_tlbctx[i].tlbID = regs->tlbID;
+
+} /* end function purge_guest_tlb */
+#endif /*defined(_FEATURE_SIE)*/
+
+
 /*-------------------------------------------------------------------*/
 /* Purge the translation lookaside buffer                            */
 /*-------------------------------------------------------------------*/
 _DAT_C_STATIC void ARCH_DEP(purge_tlb) (REGS *regs)
 {
+    INVALIDATE_TRACE_PAGE(regs);
+
+#if defined(_FEATURE_SIE)
+    /* Guest tlbIDs are shared with the retained SIE contexts */
+    if (regs->guest)
+    {
+        ARCH_DEP(purge_guest_tlb) (regs, 0);
+        return;
+    }
+#endif /*defined(_FEATURE_SIE)*/
+
     INVALIDATE_AIA(regs);
     if (((++regs->tlbID) & TLBID_BYTEMASK) == 0)
     {
@@ -1745,14 +1886,7 @@ _DAT_C_STATIC void ARCH_DEP(purge_tlb) (REGS *regs)
 #if defined(_FEATURE_SIE)
     /* Also clear the guest registers in the SIE copy */
     if(regs->host && regs->guestregs)
-    {
-        INVALIDATE_AIA(regs->guestregs);
-        if (((++regs->guestregs->tlbID) & TLBID_BYTEMASK) == 0)
-        {
-            memset(&regs->guestregs->tlb.vaddr, 0, TLBN * sizeof(DW));
-            regs->guestregs->tlbID = 1;
-        }
-    }
+        ARCH_DEP(purge_guest_tlb) (regs->guestregs, 1);
 #endif /*defined(_FEATURE_SIE)*/
 } /* end function purge_tlb */
 
@@ -1768,6 +1902,14 @@ int i;
         if (IS_CPU_ONLINE(i)
          && (sysblk.regs[i]->cpubit & sysblk.started_mask))
             ARCH_DEP(purge_tlb) (sysblk.regs[i]);
+#if defined(_FEATURE_SIE)
+        /* A stopped CPU must not resume a retained guest context */
+        else if (IS_CPU_ONLINE(i) && sysblk.regs[i]->guestregs)
+        {
+            INVALIDATE_TRACE_PAGE(sysblk.regs[i]);
+            ARCH_DEP(purge_guest_tlb) (sysblk.regs[i]->guestregs, 1);
+        }
+#endif /*defined(_FEATURE_SIE)*/
 
 } /* end function purge_tlb_all */
 
@@ -1797,6 +1939,9 @@ RADR ptemask;
     pte = pfra & ptemask;
 #endif /* defined(FEATURE_ESAME) */
 
+    /* The trace table page translation is not tied to a TLB entry */
+    INVALIDATE_TRACE_PAGE(regs);
+
     INVALIDATE_AIA(regs);
     for (i = 0; i < TLBN; i++)
         if ((regs->tlb.TLB_PTE(i) & ptemask) == pte)
@@ -1808,23 +1953,16 @@ RADR ptemask;
     {
         INVALIDATE_AIA(regs->guestregs);
         for (i = 0; i < TLBN; i++)
-/************************************************************************** @PJJ */
-/* The guest registers in the SIE copy TLB PTE entries for DAT-OFF guests * @PJJ */
-/* like CMS do NOT actually contain the PTE (but rather the host primary  * @PJJ */
-/* virtual address, both masked with TBLID_PAGEMASK).  In order to check  * @PJJ */
-/* if such guest TLB entry needs to be cleared, one needs to check the    * @PJJ */
-/* parallel host registers TLB PTE entry.  Hence that the if-test that    * @PJJ */
-/* follows needed to be expanded.  Originally it was just :               * @PJJ */
-/*                                                                        * @PJJ */
-/*          if ((regs->guestregs->tlb.TLB_PTE(i) & ptemask) == pte)       * @PJJ */
-/*                                                                        * @PJJ */
-/* and it is now expanded with the additional test as follows :           * @PJJ */
-/*                                                                        * @PJJ */
-/*                                        (Peter J. Jansen, 29-Jul-2016)  * @PJJ */
-/************************************************************************** @PJJ */
-            if ((regs->guestregs->tlb.TLB_PTE(i) & ptemask) == pte ||    /* @PJJ */
-                 (regs->hostregs->tlb.TLB_PTE(i) & ptemask) == pte)      /* @PJJ */
+            /* DAT-off guest entries like those of CMS hold no guest    */
+            /* PTE, so also test the host page frame backing the entry  */
+            if ((regs->guestregs->tlb.TLB_PTE(i) & ptemask) == pte ||
+                (regs->guestregs->tlb.hpfra[i] & ptemask) == pte)
                 regs->guestregs->tlb.TLB_VADDR(i) &= TLBID_PAGEMASK;
+
+        /* Drop retained prefix area translations backed by the page */
+        for (i = 0; i < SIE_TLBCTX_MAX; i++)
+            if ((regs->guestregs->sie_tlbctx[i].hostpfra & ptemask) == pte)
+                regs->guestregs->sie_tlbctx[i].pxvalid = 0;
     }
     else
     /* For guests, clear any host entries */
@@ -1851,6 +1989,11 @@ int i;
         if (IS_CPU_ONLINE(i)
          && (sysblk.regs[i]->cpubit & sysblk.started_mask))
             ARCH_DEP(purge_tlbe) (sysblk.regs[i], pfra);
+#if defined(_FEATURE_SIE)
+        /* A stopped CPU must not resume guest entries for the page */
+        else if (IS_CPU_ONLINE(i) && sysblk.regs[i]->guestregs)
+            ARCH_DEP(purge_tlbe) (sysblk.regs[i], pfra);
+#endif /*defined(_FEATURE_SIE)*/
 
 } /* end function purge_tlbe_all */
 
@@ -1916,14 +2059,15 @@ int  i;
 /* NOTES:                                                            */
 /*   TLB_VADDR does not contain all the effective address bits and   */
 /*   must be created on-the-fly using the tlb index (i << shift).    */
-/*   TLB_VADDR also contains the tlbid, so the regs->tlbid is merged */
-/*   with the main input variable before the search is begun.        */
+/*   TLB_VADDR also contains the tlbid, which is masked off so that  */
+/*   entries made under any tlbid match.  A guest TLB holds entries  */
+/*   of SIE contexts retained under other tlbids (see sie.c), and a  */
+/*   storage key change must reach those as well.                    */
 /*-------------------------------------------------------------------*/
 _DAT_C_STATIC void ARCH_DEP(invalidate_tlbe) (REGS *regs, BYTE *main)
 {
     int     i;                          /* index into TLB            */
     int     shift;                      /* Number of bits to shift   */
-    BYTE    *mainwid;                   /* mainstore with tlbid      */
 
     if (main == NULL)
     {
@@ -1931,14 +2075,13 @@ _DAT_C_STATIC void ARCH_DEP(invalidate_tlbe) (REGS *regs, BYTE *main)
         return;
     }
 
-    mainwid = main + regs->tlbID;
-
     INVALIDATE_AIA_MAIN(regs, main);
     shift = regs->arch_mode == ARCH_370 ? 11 : 12;
     for (i = 0; i < TLBN; i++)
         if (MAINADDR(regs->tlb.main[i],
-                     (regs->tlb.TLB_VADDR(i) | (i << shift)))
-                     == mainwid)
+                     (regs->tlb.TLB_VADDR(i) & TLBID_PAGEMASK)
+                     | (i << shift))
+                     == main)
         {
             regs->tlb.acc[i] = 0;
 #if !defined(FEATURE_S390_DAT) && !defined(FEATURE_ESAME)
@@ -1955,8 +2098,9 @@ _DAT_C_STATIC void ARCH_DEP(invalidate_tlbe) (REGS *regs, BYTE *main)
         shift = regs->guestregs->arch_mode == ARCH_370 ? 11 : 12;
         for (i = 0; i < TLBN; i++)
             if (MAINADDR(regs->guestregs->tlb.main[i],
-                         (regs->guestregs->tlb.TLB_VADDR(i) | (i << shift)))
-                         == mainwid)
+                         (regs->guestregs->tlb.TLB_VADDR(i) & TLBID_PAGEMASK)
+                         | (i << shift))
+                         == main)
             {
                 regs->guestregs->tlb.acc[i] = 0;
 #if !defined(FEATURE_S390_DAT) && !defined(FEATURE_ESAME)
@@ -1973,8 +2117,9 @@ _DAT_C_STATIC void ARCH_DEP(invalidate_tlbe) (REGS *regs, BYTE *main)
         shift = regs->hostregs->arch_mode == ARCH_370 ? 11 : 12;
         for (i = 0; i < TLBN; i++)
             if (MAINADDR(regs->hostregs->tlb.main[i],
-                         (regs->hostregs->tlb.TLB_VADDR(i) | (i << shift)))
-                         == mainwid)
+                         (regs->hostregs->tlb.TLB_VADDR(i) & TLBID_PAGEMASK)
+                         | (i << shift))
+                         == main)
             {
                 regs->hostregs->tlb.acc[i] = 0;
 #if !defined(FEATURE_S390_DAT) && !defined(FEATURE_ESAME)
@@ -2120,7 +2265,8 @@ RADR    pfra;
     }
 #endif /*defined(FEATURE_ESAME)*/
 
-    /* Invalidate TLB entries */
+    /* Invalidate TLB entries, including the guest entries backed
+       by the page, whatever SIE context they were retained for */
     ARCH_DEP(purge_tlbe_all) (pfra);
 
 } /* end function invalidate_pte */
@@ -2244,6 +2390,9 @@ int     ix = TLBIX(addr);               /* TLB index                 */
         regs->dat.protect     |= regs->hostregs->dat.protect;
         regs->tlb.protect[ix] |= regs->hostregs->dat.protect;
 
+        /* Remember the host page frame for a host IPTE */
+        regs->tlb.hpfra[ix] = regs->hostregs->dat.rpfra;
+
         if ( REAL_MODE(&regs->psw) || (arn == USE_REAL_ADDR) )
             regs->tlb.TLB_PTE(ix)   = addr & TLBID_PAGEMASK;
 
@@ -2272,11 +2421,13 @@ int     ix = TLBIX(addr);               /* TLB index                 */
                         s390_apply_prefixing( regs->hostregs->dat.raddr, regs->hostregs->PX );
                 apfra = s390_apply_prefixing( regs->hostregs->dat.rpfra, regs->hostregs->PX );
                 break;
+#if defined(_FEATURE_ZSIE)
             case ARCH_900:
                 regs->hostregs->dat.aaddr = aaddr =
                         z900_apply_prefixing( regs->hostregs->dat.raddr, regs->hostregs->PX );
                 apfra = z900_apply_prefixing( regs->hostregs->dat.rpfra, regs->hostregs->PX );
                 break;
+#endif /*defined(_FEATURE_ZSIE)*/
             /* No S/370 or any other SIE host exist */
             default:
             case ARCH_370:
@@ -25,6 +25,8 @@
 #include "decimal64.h"
 #include "decimal32.h"
 #include "decPacked.h"
+#include "decDouble.h"
+#include "decQuad.h"
 #endif /*defined(FEATURE_DECIMAL_FLOATING_POINT)*/
 
 #if defined(FEATURE_FPS_ENHANCEMENT)
@@ -463,6 +465,24 @@ int             cc;                     /* Condition code            */
     return cc;
 } /* end function dfp_compare_exponent */
 
+/*-------------------------------------------------------------------*/
+/* Adjust context status after a decDouble/decQuad operation         */
+/*                                                                   */
+/* The fixed-size decDouble and decQuad modules never set the        */
+/* DEC_Rounded status flag, whereas decNumber sets it together with  */
+/* DEC_Inexact whenever digits are discarded. Set it here so that    */
+/* dfp_status_check produces the same DXC for both paths.            */
+/*                                                                   */
+/* Input:                                                            */
+/*      pset    Pointer to decimal number context structure          */
+/*-------------------------------------------------------------------*/
+static inline void
+dfp_decfloat_status(decContext *pset)
+{
+    if (pset->status & DEC_Inexact)
+        pset->status |= DEC_Rounded;
+} /* end function dfp_decfloat_status */
+
 /*-------------------------------------------------------------------*/
 /* Convert 64-bit signed binary integer to decimal number            */
 /*                                                                   */
@@ -1571,6 +1591,70 @@ QW      *qwp;                           /* Quadword pointer          */
 
 } /* end function dfp_reg_from_decimal128 */
 
+/*-------------------------------------------------------------------*/
+/* Copy a DFP long register into a decDouble structure               */
+/*                                                                   */
+/* The decDouble encoding is identical to decimal64, so the DFP      */
+/* long arithmetic instructions can operate on the register contents */
+/* directly without a round trip through a decNumber.                */
+/*                                                                   */
+/* Input:                                                            */
+/*      rn      FP register number                                   */
+/*      xp      Pointer to decDouble structure                       */
+/*      regs    CPU register context                                 */
+/*-------------------------------------------------------------------*/
+static inline void
+ARCH_DEP(dfp_reg_to_decDouble) (int rn, decDouble *xp, REGS *regs)
+{
+    ARCH_DEP(dfp_reg_to_decimal64)(rn, (decimal64*)xp, regs);
+
+} /* end function dfp_reg_to_decDouble */
+
+/*-------------------------------------------------------------------*/
+/* Load a DFP long register from a decDouble structure               */
+/*                                                                   */
+/* Input:                                                            */
+/*      rn      FP register number (left register of pair)           */
+/*      xp      Pointer to decDouble structure                       */
+/*      regs    CPU register context                                 */
+/*-------------------------------------------------------------------*/
+static inline void
+ARCH_DEP(dfp_reg_from_decDouble) (int rn, decDouble *xp, REGS *regs)
+{
+    ARCH_DEP(dfp_reg_from_decimal64)(rn, (decimal64*)xp, regs);
+
+} /* end function dfp_reg_from_decDouble */
+
+/*-------------------------------------------------------------------*/
+/* Copy a DFP extended register into a decQuad structure             */
+/*                                                                   */
+/* Input:                                                            */
+/*      rn      FP register number (left register of pair)           */
+/*      xp      Pointer to decQuad structure                         */
+/*      regs    CPU register context                                 */
+/*-------------------------------------------------------------------*/
+static inline void
+ARCH_DEP(dfp_reg_to_decQuad) (int rn, decQuad *xp, REGS *regs)
+{
+    ARCH_DEP(dfp_reg_to_decimal128)(rn, (decimal128*)xp, regs);
+
+} /* end function dfp_reg_to_decQuad */
+
+/*-------------------------------------------------------------------*/
+/* Load a DFP extended register from a decQuad structure             */
+/*                                                                   */
+/* Input:                                                            */
+/*      rn      FP register number (left register of pair)           */
+/*      xp      Pointer to decQuad structure                         */
+/*      regs    CPU register context                                 */
+/*-------------------------------------------------------------------*/
+static inline void
+ARCH_DEP(dfp_reg_from_decQuad) (int rn, decQuad *xp, REGS *regs)
+{
+    ARCH_DEP(dfp_reg_from_decimal128)(rn, (decimal128*)xp, regs);
+
+} /* end function dfp_reg_from_decQuad */
+
 /*-------------------------------------------------------------------*/
 /* Check for DFP exception conditions                                */
 /*                                                                   */
@@ -1737,8 +1821,7 @@ int     suppress = 0;                   /* 1=suppress, 0=complete    */
 DEF_INST(add_dfp_ext_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal128      x1, x2, x3;             /* Extended DFP values       */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decQuad         x1, x2, x3;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1751,23 +1834,21 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Add FP register r3 to FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r3, &x3, regs);
-    decimal128ToNumber(&x2, &d2);
-    decimal128ToNumber(&x3, &d3);
-    decNumberAdd(&d1, &d2, &d3, &set);
-    decimal128FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r3, &x3, regs);
+    decQuadAdd(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal128)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decQuad)(r1, &x1, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&d1) ? 3 :
-                   decNumberIsZero(&d1) ? 0 :
-                   decNumberIsNegative(&d1) ? 1 : 2;
+    regs->psw.cc = decQuadIsNaN(&x1) ? 3 :
+                   decQuadIsZero(&x1) ? 0 :
+                   decQuadIsSigned(&x1) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -1785,8 +1866,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(add_dfp_long_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal64       x1, x2, x3;             /* Long DFP values           */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decDouble       x1, x2, x3;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1798,23 +1878,21 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Add FP register r3 to FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r3, &x3, regs);
-    decimal64ToNumber(&x2, &d2);
-    decimal64ToNumber(&x3, &d3);
-    decNumberAdd(&d1, &d2, &d3, &set);
-    decimal64FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r3, &x3, regs);
+    decDoubleAdd(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal64)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decDouble)(r1, &x1, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&d1) ? 3 :
-                   decNumberIsZero(&d1) ? 0 :
-                   decNumberIsNegative(&d1) ? 1 : 2;
+    regs->psw.cc = decDoubleIsNaN(&x1) ? 3 :
+                   decDoubleIsZero(&x1) ? 0 :
+                   decDoubleIsSigned(&x1) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -1832,8 +1910,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(compare_dfp_ext_reg)
 {
 int             r1, r2;                 /* Values of R fields        */
-decimal128      x1, x2;                 /* Extended DFP values       */
-decNumber       d1, d2, dr;             /* Working decimal numbers   */
+decQuad         x1, x2, xr;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1845,19 +1922,17 @@ BYTE            dxc;                    /* Data exception code       */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
 
     /* Compare FP register r1 with FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r1, &x1, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    decimal128ToNumber(&x1, &d1);
-    decimal128ToNumber(&x2, &d2);
-    decNumberCompare(&dr, &d1, &d2, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    decQuadCompare(&xr, &x1, &x2, &set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&dr) ? 3 :
-                   decNumberIsZero(&dr) ? 0 :
-                   decNumberIsNegative(&dr) ? 1 : 2;
+    regs->psw.cc = decQuadIsNaN(&xr) ? 3 :
+                   decQuadIsZero(&xr) ? 0 :
+                   decQuadIsSigned(&xr) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -1875,8 +1950,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(compare_dfp_long_reg)
 {
 int             r1, r2;                 /* Values of R fields        */
-decimal64       x1, x2;                 /* Long DFP values           */
-decNumber       d1, d2, dr;             /* Working decimal numbers   */
+decDouble       x1, x2, xr;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1887,19 +1961,17 @@ BYTE            dxc;                    /* Data exception code       */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
 
     /* Compare FP register r1 with FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r1, &x1, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    decimal64ToNumber(&x1, &d1);
-    decimal64ToNumber(&x2, &d2);
-    decNumberCompare(&dr, &d1, &d2, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    decDoubleCompare(&xr, &x1, &x2, &set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&dr) ? 3 :
-                   decNumberIsZero(&dr) ? 0 :
-                   decNumberIsNegative(&dr) ? 1 : 2;
+    regs->psw.cc = decDoubleIsNaN(&xr) ? 3 :
+                   decDoubleIsZero(&xr) ? 0 :
+                   decDoubleIsSigned(&xr) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -1917,8 +1989,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(compare_and_signal_dfp_ext_reg)
 {
 int             r1, r2;                 /* Values of R fields        */
-decimal128      x1, x2;                 /* Extended DFP values       */
-decNumber       d1, d2, dr;             /* Working decimal numbers   */
+decQuad         x1, x2, xr;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1930,23 +2001,21 @@ BYTE            dxc;                    /* Data exception code       */
     decContextDefault(&set, DEC_INIT_DECIMAL128);
 
     /* Compare FP register r1 with FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r1, &x1, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    decimal128ToNumber(&x1, &d1);
-    decimal128ToNumber(&x2, &d2);
-    decNumberCompare(&dr, &d1, &d2, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    decQuadCompareSignal(&xr, &x1, &x2, &set);
 
     /* Force signaling condition if result is a NaN */
-    if (decNumberIsNaN(&dr))
+    if (decQuadIsNaN(&xr))
         set.status |= DEC_IEEE_854_Invalid_operation;
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&dr) ? 3 :
-                   decNumberIsZero(&dr) ? 0 :
-                   decNumberIsNegative(&dr) ? 1 : 2;
+    regs->psw.cc = decQuadIsNaN(&xr) ? 3 :
+                   decQuadIsZero(&xr) ? 0 :
+                   decQuadIsSigned(&xr) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -1964,8 +2033,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(compare_and_signal_dfp_long_reg)
 {
 int             r1, r2;                 /* Values of R fields        */
-decimal64       x1, x2;                 /* Long DFP values           */
-decNumber       d1, d2, dr;             /* Working decimal numbers   */
+decDouble       x1, x2, xr;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -1976,23 +2044,21 @@ BYTE            dxc;                    /* Data exception code       */
     decContextDefault(&set, DEC_INIT_DECIMAL64);
 
     /* Compare FP register r1 with FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r1, &x1, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    decimal64ToNumber(&x1, &d1);
-    decimal64ToNumber(&x2, &d2);
-    decNumberCompare(&dr, &d1, &d2, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    decDoubleCompareSignal(&xr, &x1, &x2, &set);
 
     /* Force signaling condition if result is a NaN */
-    if (decNumberIsNaN(&dr))
+    if (decDoubleIsNaN(&xr))
         set.status |= DEC_IEEE_854_Invalid_operation;
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&dr) ? 3 :
-                   decNumberIsZero(&dr) ? 0 :
-                   decNumberIsNegative(&dr) ? 1 : 2;
+    regs->psw.cc = decDoubleIsNaN(&xr) ? 3 :
+                   decDoubleIsZero(&xr) ? 0 :
+                   decDoubleIsSigned(&xr) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -3310,8 +3376,7 @@ char            zoned[CZDT_MAXLEN];     /* Zoned decimal result      */
 DEF_INST(divide_dfp_ext_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal128      x1, x2, x3;             /* Extended DFP values       */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decQuad         x1, x2, x3;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -3324,18 +3389,16 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Divide FP register r2 by FP register r3 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r3, &x3, regs);
-    decimal128ToNumber(&x2, &d2);
-    decimal128ToNumber(&x3, &d3);
-    decNumberDivide(&d1, &d2, &d3, &set);
-    decimal128FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r3, &x3, regs);
+    decQuadDivide(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal128)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decQuad)(r1, &x1, regs);
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -3353,8 +3416,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(divide_dfp_long_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal64       x1, x2, x3;             /* Long DFP values           */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decDouble       x1, x2, x3;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -3366,18 +3428,16 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Divide FP register r2 by FP register r3 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r3, &x3, regs);
-    decimal64ToNumber(&x2, &d2);
-    decimal64ToNumber(&x3, &d3);
-    decNumberDivide(&d1, &d2, &d3, &set);
-    decimal64FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r3, &x3, regs);
+    decDoubleDivide(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal64)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decDouble)(r1, &x1, regs);
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -4246,8 +4306,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(multiply_dfp_ext_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal128      x1, x2, x3;             /* Extended DFP values       */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decQuad         x1, x2, x3;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -4260,18 +4319,16 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Multiply FP register r2 by FP register r3 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r3, &x3, regs);
-    decimal128ToNumber(&x2, &d2);
-    decimal128ToNumber(&x3, &d3);
-    decNumberMultiply(&d1, &d2, &d3, &set);
-    decimal128FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r3, &x3, regs);
+    decQuadMultiply(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal128)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decQuad)(r1, &x1, regs);
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -4289,8 +4346,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(multiply_dfp_long_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal64       x1, x2, x3;             /* Long DFP values           */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decDouble       x1, x2, x3;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -4302,18 +4358,16 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Multiply FP register r2 by FP register r3 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r3, &x3, regs);
-    decimal64ToNumber(&x2, &d2);
-    decimal64ToNumber(&x3, &d3);
-    decNumberMultiply(&d1, &d2, &d3, &set);
-    decimal64FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r3, &x3, regs);
+    decDoubleMultiply(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal64)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decDouble)(r1, &x1, regs);
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -4763,8 +4817,7 @@ int             n;                      /* Number of bits to shift   */
 DEF_INST(subtract_dfp_ext_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal128      x1, x2, x3;             /* Extended DFP values       */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decQuad         x1, x2, x3;             /* Extended DFP values       */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -4777,23 +4830,21 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Subtract FP register r3 from FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal128)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal128)(r3, &x3, regs);
-    decimal128ToNumber(&x2, &d2);
-    decimal128ToNumber(&x3, &d3);
-    decNumberSubtract(&d1, &d2, &d3, &set);
-    decimal128FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decQuad)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decQuad)(r3, &x3, regs);
+    decQuadSubtract(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal128)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decQuad)(r1, &x1, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&d1) ? 3 :
-                   decNumberIsZero(&d1) ? 0 :
-                   decNumberIsNegative(&d1) ? 1 : 2;
+    regs->psw.cc = decQuadIsNaN(&x1) ? 3 :
+                   decQuadIsZero(&x1) ? 0 :
+                   decQuadIsSigned(&x1) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -4811,8 +4862,7 @@ BYTE            dxc;                    /* Data exception code       */
 DEF_INST(subtract_dfp_long_reg)
 {
 int             r1, r2, r3;             /* Values of R fields        */
-decimal64       x1, x2, x3;             /* Long DFP values           */
-decNumber       d1, d2, d3;             /* Working decimal numbers   */
+decDouble       x1, x2, x3;             /* Long DFP values           */
 decContext      set;                    /* Working context           */
 BYTE            dxc;                    /* Data exception code       */
 
@@ -4824,23 +4874,21 @@ BYTE            dxc;                    /* Data exception code       */
     ARCH_DEP(dfp_rounding_mode)(&set, 0, regs);
 
     /* Subtract FP register r3 from FP register r2 */
-    ARCH_DEP(dfp_reg_to_decimal64)(r2, &x2, regs);
-    ARCH_DEP(dfp_reg_to_decimal64)(r3, &x3, regs);
-    decimal64ToNumber(&x2, &d2);
-    decimal64ToNumber(&x3, &d3);
-    decNumberSubtract(&d1, &d2, &d3, &set);
-    decimal64FromNumber(&x1, &d1, &set);
+    ARCH_DEP(dfp_reg_to_decDouble)(r2, &x2, regs);
+    ARCH_DEP(dfp_reg_to_decDouble)(r3, &x3, regs);
+    decDoubleSubtract(&x1, &x2, &x3, &set);
+    dfp_decfloat_status(&set);
 
     /* Check for exception condition */
     dxc = ARCH_DEP(dfp_status_check)(&set, regs);
 
     /* Load result into FP register r1 */
-    ARCH_DEP(dfp_reg_from_decimal64)(r1, &x1, regs);
+    ARCH_DEP(dfp_reg_from_decDouble)(r1, &x1, regs);
 
     /* Set condition code */
-    regs->psw.cc = decNumberIsNaN(&d1) ? 3 :
-                   decNumberIsZero(&d1) ? 0 :
-                   decNumberIsNegative(&d1) ? 1 : 2;
+    regs->psw.cc = decDoubleIsNaN(&x1) ? 3 :
+                   decDoubleIsZero(&x1) ? 0 :
+                   decDoubleIsSigned(&x1) ? 1 : 2;
 
     /* Raise data exception if error occurred */
     if (dxc != 0)
@@ -57,6 +57,30 @@
 
 #endif // defined(WORDS_BIGENDIAN)
 
+/* z/Architecture vector register.  The register is held as a single
+   native 128-bit quantity, so element e of a given size is not at a
+   fixed array index on every host; always go through the VR_x macros.
+   On a little-endian host this puts every element size in the same
+   lane order the host SIMD instructions use.                        */
+typedef union {
+                 U64  D[2];
+                 U32  F[4];
+                 U16  H[8];
+                 BYTE B[16];
+               } VREG;
+
+#if defined(WORDS_BIGENDIAN)
+ #define VR_B(_v,_e)    ((_v).B[(_e)])
+ #define VR_H(_v,_e)    ((_v).H[(_e)])
+ #define VR_F(_v,_e)    ((_v).F[(_e)])
+ #define VR_D(_v,_e)    ((_v).D[(_e)])
+#else // !defined(WORDS_BIGENDIAN)
+ #define VR_B(_v,_e)    ((_v).B[15-(_e)])
+ #define VR_H(_v,_e)    ((_v).H[7-(_e)])
+ #define VR_F(_v,_e)    ((_v).F[3-(_e)])
+ #define VR_D(_v,_e)    ((_v).D[1-(_e)])
+#endif // defined(WORDS_BIGENDIAN)
+
 typedef union {
                  HWORD H;
                  struct { BYTE H; BYTE L; } B;
@@ -175,6 +199,7 @@ typedef struct _TLB  {
         DW              pte[TLBN];      /* Copy of page table entry  */
 #define TLB_PTE_G(_n)   pte[(_n)].D
 #define TLB_PTE_L(_n)   pte[(_n)].F.L.F
+        U64             hpfra[TLBN];    /* Host PFRA of guest entry  */
         BYTE           *main[TLBN];     /* Mainstor address          */
         BYTE           *storkey[TLBN];  /* -> Storage key            */
         BYTE            skey[TLBN];     /* Storage key key-value     */
@@ -188,6 +213,8 @@ typedef struct _TLB  {
  * protect.
  * Fields set by logical_to_main() are main, storkey, skey, read and
  * write and are used for accelerated address lookup (formerly AEA).
+ * For a pageable SIE guest logical_to_main() also sets hpfra, the
+ * host page frame backing the entry, so that a host IPTE can find it.
  */
 
 /* Structure for Dynamic Address Translation */
@@ -205,6 +232,11 @@ typedef struct _DAT {
       } DAT;
 
 /* Bit definitions for control register 0 */
+#define CR0_TXC         0x0080000000000000ULL   /* Transactional-execution
+                                                   control                    */
+#define CR0_PIFO        0x0040000000000000ULL   /* Transaction program-
+                                                   interruption filtering
+                                                   override                   */
 #define CR0_MCX_AUTH    0x0001000000000000ULL   /* Measurement Counter
                                                    Extraction Authority       */
 #define CR0_TRACE_TOD           0x80000000      /* TRACE TOD-clock control    */
@@ -229,6 +261,7 @@ typedef struct _DAT {
 #define CR0_ASN_LX_REUS         0x00080000      /* ASN-and-LX-reuse control   */
 #define CR0_AFP                 0x00040000      /* AFP register control       */
 #define CR0_VOP                 0x00020000      /* Vector control         390 */
+#define CR0_VX                  0x00020000      /* Vector enablement      z13 */
 #define CR0_ASF                 0x00010000      /* AS function control    390 */
 #define CR0_XM_MALFALT          0x00008000      /* Malfunction alert mask     */
 #define CR0_XM_EMERSIG          0x00004000      /* Emergency signal mask      */
@@ -801,6 +834,49 @@ typedef struct _PSA_900 {               /* Prefixed storage area     */
 /*1380*/ DBLWRD storecr[16];            /* Control register save area*/
 } PSA_900;
 
+/* Transaction diagnostic block */
+typedef struct _TDB {
+/*000*/ BYTE   format;                  /* TDB format (1)            */
+/*001*/ BYTE   flags;                   /* Flags                     */
+/*002*/ BYTE   resv002[4];              /* Reserved                  */
+/*006*/ HWORD  tnd;                     /* Transaction nesting depth */
+/*008*/ DBLWRD tac;                     /* Transaction abort code    */
+/*010*/ DBLWRD cti;                     /* Conflict token            */
+/*018*/ DBLWRD atia;                    /* Aborted transaction
+                                           instruction address       */
+/*020*/ BYTE   eaid;                    /* Exception access id       */
+/*021*/ BYTE   dxc;                     /* Data exception code       */
+/*022*/ HWORD  resv022;                 /* Reserved                  */
+/*024*/ FWORD  piid;                    /* Program interruption id   */
+/*028*/ DBLWRD teid;                    /* Translation exception id  */
+/*030*/ DBLWRD bea;                     /* Breaking event address    */
+/*038*/ BYTE   resv038[72];             /* Reserved                  */
+/*080*/ DBLWRD gpr[16];                 /* General registers         */
+} TDB;
+
+#define TDB_FORMAT1     0x01            /* Format 1 TDB              */
+#define TDB_CTV         0x80            /* Conflict token valid      */
+#define TDB_CTI         0x40            /* Constrained transaction   */
+
+#define PSA_PITDB       0x1800          /* Program-interruption TDB  */
+
+/* Transaction abort codes */
+#define TAC_EXT            2            /* External interruption     */
+#define TAC_UPGM           4            /* Unfiltered program int    */
+#define TAC_MCK            5            /* Machine check interruption*/
+#define TAC_IO             6            /* I/O interruption          */
+#define TAC_FETCH_OVF      7            /* Fetch overflow            */
+#define TAC_STORE_OVF      8            /* Store overflow            */
+#define TAC_FETCH_CNF      9            /* Fetch conflict            */
+#define TAC_STORE_CNF     10            /* Store conflict            */
+#define TAC_INSTR         11            /* Restricted instruction    */
+#define TAC_FPGM          12            /* Filtered program int      */
+#define TAC_NESTING       13            /* Nesting depth exceeded    */
+#define TAC_MISC         255            /* Miscellaneous condition   */
+#define TAC_TABORT       256            /* Lowest TABORT abort code  */
+
+#define MAX_TXF_TND       15            /* Maximum nesting depth     */
+
 /* Bit settings for Translation Exception Address */
 #define TEA_SECADDR     0x80000000      /* Secondary addr (370,390)  */
 #define TEA_FETCH       0x800           /* Fetch exception        810*/
@@ -917,6 +993,7 @@ typedef struct _PSA_900 {               /* Prefixed storage area     */
 #define PGM_OPERAND_EXCEPTION                           0x0015
 #define PGM_TRACE_TABLE_EXCEPTION                       0x0016
 #define PGM_ASN_TRANSLATION_SPECIFICATION_EXCEPTION     0x0017
+#define PGM_TRANSACTION_CONSTRAINT_EXCEPTION            0x0018
 #define PGM_VECTOR_OPERATION_EXCEPTION                  0x0019
 #define PGM_SPACE_SWITCH_EVENT                          0x001C
 #define PGM_SQUARE_ROOT_EXCEPTION                       0x001D
@@ -949,6 +1026,7 @@ typedef struct _PSA_900 {               /* Prefixed storage area     */
 #define PGM_REGION_THIRD_TRANSLATION_EXCEPTION          0x003B
 #define PGM_MONITOR_EVENT                               0x0040
 #define PGM_PER_EVENT                                   0x0080
+#define PGM_TXF_EVENT                                   0x0200
 #define PGM_CRYPTO_OPERATION_EXCEPTION                  0x0119
 
 /* External interrupt codes */
@@ -1427,6 +1505,8 @@ typedef struct _MBK {
                                            Facility 1 installed   912
                                            Plus Load And Trap and
                                            Processor Assist Facility */
+#define STFL_CONSTRAINED_TRANSACT 50    /* Constrained transactional-
+                                           execution facility     zEC12*/
 #define STFL_INTERLOCKED_ACCESS_2 52 /* Interlocked access facility 2 */
 
 #define STFL_RESERVED_62          62    /* Reserved */
@@ -1441,10 +1521,14 @@ typedef struct _MBK {
                                            indication facility    810*/
 #define STFL_MSA_EXTENSION_3      76    /* Message Security Assist  810
                                            Extension 3 installed  810*/
+#define STFL_TRANSACT_EXEC        73    /* Transactional-execution
+                                           facility installed   zEC12*/
 #define STFL_MSA_EXTENSION_4      77    /* Message Security Assist  810
                                            Extension 4 installed  810*/
+#define STFL_VECTOR              129    /* Vector facility for
+                                           z/Architecture         z13*/
 
-#define STFL_MAX                  77
+#define STFL_MAX                 129
 #define STFL_BYTESIZE (((STFL_MAX+8))/8)
 #define STFL_DWRDSIZE ((STFL_BYTESIZE+7)/8)
 
@@ -2254,6 +2338,7 @@ typedef struct _PTFFQSI {               /* Query Steering Information*/
 #define DXC_IEEE_DIV_ZERO_IISE  0x43    /* IEEE div by zero(IISE) DFP*/
 #define DXC_IEEE_INVALID_OP     0x80    /* IEEE invalid operation    */
 #define DXC_IEEE_INV_OP_IISE    0x83    /* IEEE invalid op (IISE) DFP*/
+#define DXC_VECTOR_INSTRUCTION  0xFE    /* Vector instruction        */
 #define DXC_COMPARE_AND_TRAP    0xFF    /* Compare-and-trap exception*/
 /* Note: IISE = IEEE-interruption-simulation event */
 
@@ -942,6 +942,8 @@ U64     old;                            /* Old value                 */
 
     RRE(inst, regs, r1, r2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     ODD_CHECK(r1, regs);
@@ -1026,6 +1028,8 @@ BYTE   *mn;                             /* Mainstor address of ASCE  */
 
     RRF_RM(inst, regs, r1, r2, r3, m4);
 
+    TXF_INSTR_CHECK(regs);
+
     SIE_XC_INTERCEPT(regs);
 
     PRIV_CHECK(regs);
@@ -4191,6 +4195,8 @@ U16     updated = 0;                    /* Updated control regs      */
 
     RSY(inst, regs, r1, r3, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     DW_CHECK(effective_addr2, regs);
@@ -4793,6 +4799,8 @@ int     rc;
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     DW_CHECK(effective_addr2, regs);
@@ -8469,7 +8477,12 @@ int     code;                           /* PPA code                  */
     switch(code)
     {
         case 1:	/* Transaction Abort Assist */
-            /* ARCH_DEP(transaction_abort_assist)(regs,r1); */
+            /* R1 bits 32-63 contain the number of times the
+               transaction has aborted; once it is retried more
+               than once give the other CPUs a chance to finish
+               with the storage it conflicts on */
+            if (regs->GR_L(r1) > 1)
+                sched_yield();
             break;
         default:
             break;
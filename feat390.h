@@ -101,7 +101,9 @@
 #define FEATURE_TRACING
 #define FEATURE_VM_BLOCKIO
 // #define FEATURE_WAITSTATE_ASSIST
-// #define FEATURE_VECTOR_FACILITY
+#if defined(OPTION_VECTOR_FACILITY)     /* (needs NO_900_MODE)       */
+#define FEATURE_VECTOR_FACILITY
+#endif
 
 #endif /*defined(OPTION_390_MODE)*/
 /* end of FEAT390.H */
@@ -151,9 +151,11 @@
 #define FEATURE_TEST_BLOCK
 #define FEATURE_TOD_CLOCK_STEERING                              /*@Z9*/
 #define FEATURE_TRACING
+#define FEATURE_TRANSACTIONAL_EXECUTION_FACILITY                /*EC12*/
 #define FEATURE_VIRTUAL_ARCHITECTURE_LEVEL
 #define FEATURE_VM_BLOCKIO
 // #define FEATURE_WAITSTATE_ASSIST
+#define FEATURE_ZVECTOR_FACILITY                                /*z13*/
 
 #endif /*defined(OPTION_900_MODE)*/
 /* end of FEAT900.H */
@@ -30,7 +30,11 @@
 #define OPTION_SMP                      /* Enable SMP support        */
 #endif
 
-#define VECTOR_SECTION_SIZE         128 /* Vector section size       */
+#if !defined(VECTOR_SECTION_SIZE)
+#define VECTOR_SECTION_SIZE         128 /* Default vector section size*/
+#endif
+#define MIN_VECTOR_SECTION_SIZE       8 /* Section sizes selectable  */
+#define MAX_VECTOR_SECTION_SIZE     512 /*   with vfsectsize         */
 #define VECTOR_PARTIAL_SUM_NUMBER     1 /* Vector partial sum number */
 
 #define CKD_MAXFILES                 27 /* Max files per CKD volume  */
@@ -53,6 +57,11 @@
 #define MAX_TOD_UPDATE_USECS  1000000   /* Max TOD updt freq (usecs) */
 #endif
 
+#define MIN_HALT_POLL_USECS         0   /* Halt-poll disabled        */
+#define DEF_HALT_POLL_USECS       200   /* Def max halt-poll window  */
+#define MAX_HALT_POLL_USECS     10000   /* Max halt-poll window      */
+#define HALT_POLL_START_USECS      10   /* Initial halt-poll window  */
+
 #define MAX_DEVICE_THREAD_IDLE_SECS 300 /* 5 Minute thread timeout   */
 
 /*-------------------------------------------------------------------*\
@@ -350,9 +359,11 @@
 #undef FEATURE_TEST_BLOCK
 #undef FEATURE_TOD_CLOCK_STEERING                               /*@Z9*/
 #undef FEATURE_TRACING
+#undef FEATURE_TRANSACTIONAL_EXECUTION_FACILITY                  /*EC12*/
 #undef FEATURE_VECTOR_FACILITY
 #undef FEATURE_VIRTUAL_ARCHITECTURE_LEVEL
 #undef FEATURE_VM_BLOCKIO
 #undef FEATURE_WAITSTATE_ASSIST
+#undef FEATURE_ZVECTOR_FACILITY                                  /*z13*/
 
 /* end of FEATALL.H */
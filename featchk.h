@@ -286,6 +286,14 @@
  #define _FEATURE_MISC_INSTRUCTION_EXTENSIONS_FACILITY
 #endif
 
+#if defined(FEATURE_ZVECTOR_FACILITY)
+ #define _FEATURE_ZVECTOR_FACILITY
+#endif
+
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+ #define _FEATURE_TRANSACTIONAL_EXECUTION_FACILITY
+#endif
+
 #if defined(FEATURE_MESSAGE_SECURITY_ASSIST_EXTENSION_1)
  #define _FEATURE_MESSAGE_SECURITY_ASSIST_EXTENSION_1
 #endif
@@ -493,7 +501,22 @@
 #endif
 
 #if defined(_900) && defined(FEATURE_VECTOR_FACILITY)
- #error Vector Facility not supported on ESAME capable processors
+ #error Vector Facility not supported on ESAME capable processors (OPTION_VECTOR_FACILITY requires NO_900_MODE)
+#endif
+
+#if defined(FEATURE_VECTOR_FACILITY) \
+ && (VECTOR_SECTION_SIZE < MIN_VECTOR_SECTION_SIZE \
+  || VECTOR_SECTION_SIZE > MAX_VECTOR_SECTION_SIZE \
+  || (VECTOR_SECTION_SIZE & (VECTOR_SECTION_SIZE - 1)))
+ #error Vector section size must be a power of 2 from 8 to 512
+#endif
+
+#if defined(FEATURE_ZVECTOR_FACILITY) && !defined(FEATURE_ESAME)
+ #error z/Architecture Vector Facility requires ESAME
+#endif
+
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY) && !defined(FEATURE_ESAME)
+ #error Transactional-Execution Facility requires ESAME
 #endif
 
 #if !defined(FEATURE_S370_CHANNEL) && !defined(FEATURE_CHANNEL_SUBSYSTEM)
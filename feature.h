@@ -681,6 +681,8 @@ z900_ ## _name
 #undef TEST_SET_AEA_MODE
 #undef SET_AEA_AR
 #undef MADDR
+#undef MADDRL
+#undef _MADDRL
 
 #if defined(FEATURE_DUAL_ADDRESS_SPACE) && defined(FEATURE_LINKAGE_STACK)
 #define SET_AEA_COMMON(_regs) \
@@ -839,7 +841,7 @@ do { \
  /*
   * Accelerated lookup
   */
-#define MADDRL(_addr, _len, _arn, _regs, _acctype, _akey) \
+#define _MADDRL(_addr, _len, _arn, _regs, _acctype, _akey) \
  ( \
        likely((_regs)->AEA_AR((_arn))) \
    &&  likely( \
@@ -860,6 +862,24 @@ do { \
      ) \
  )
 
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+/* Operand accesses made within a transaction go to the CPU's
+   transaction page buffers rather than to main storage, and while
+   any CPU is in a transaction other operand accesses are checked
+   against the pages it has fetched or stored */
+#define MADDRL(_addr, _len, _arn, _regs, _acctype, _akey) \
+ ( \
+       unlikely((_regs)->txf_tnd) && (_arn) != USE_INST_SPACE \
+   ? ARCH_DEP(txf_maddr_l) ((_addr), (_len), (_arn), (_regs), (_acctype), (_akey)) \
+   : unlikely(sysblk.txf_cpus) && (_arn) != USE_INST_SPACE \
+   ? ARCH_DEP(txf_check_maddr_l) ((_addr), (_len), (_arn), (_regs), (_acctype), (_akey)) \
+   : _MADDRL((_addr), (_len), (_arn), (_regs), (_acctype), (_akey)) \
+ )
+#else
+#define MADDRL(_addr, _len, _arn, _regs, _acctype, _akey) \
+    _MADDRL((_addr), (_len), (_arn), (_regs), (_acctype), (_akey))
+#endif
+
 /* Old style accelerated lookup (without length) */
 #define MADDR(_addr, _arn, _regs, _acctype, _akey) \
     MADDRL( (_addr), 1, (_arn), (_regs), (_acctype), (_akey))
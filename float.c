@@ -695,6 +695,19 @@ static inline void normal_sf( SHORT_FLOAT *fl )
 /*-------------------------------------------------------------------*/
 static inline void normal_lf( LONG_FLOAT *fl )
 {
+#if defined(HAVE_U128_T)
+int     digits;                         /* Leading zero hex digits   */
+
+    if (fl->long_fract) {
+        /* fraction occupies the low order 56 bits */
+        digits = (__builtin_clzll( fl->long_fract ) - 8) >> 2;
+        fl->long_fract <<= (digits << 2);
+        fl->expo -= digits;
+    } else {
+        fl->sign = POS;
+        fl->expo = 0;
+    }
+#else /*!defined(HAVE_U128_T)*/
     if (fl->long_fract) {
         if ((fl->long_fract & 0x00FFFFFFFF000000ULL) == 0) {
             fl->long_fract <<= 32;
@@ -716,6 +729,7 @@ static inline void normal_lf( LONG_FLOAT *fl )
         fl->sign = POS;
         fl->expo = 0;
     }
+#endif /*!defined(HAVE_U128_T)*/
 
 } /* end function normal_lf */
 
@@ -728,6 +742,30 @@ static inline void normal_lf( LONG_FLOAT *fl )
 /*-------------------------------------------------------------------*/
 static inline void normal_ef( EXTENDED_FLOAT *fl )
 {
+#if defined(HAVE_U128_T)
+U128_T  fract;                          /* 112 bit fraction          */
+int     digits;                         /* Leading zero hex digits   */
+
+    if (fl->ms_fract
+    || fl->ls_fract) {
+        /* fraction occupies the low order 48 bits of ms_fract */
+        if (fl->ms_fract)
+            digits = (__builtin_clzll( fl->ms_fract ) - 16) >> 2;
+        else
+            digits = (__builtin_clzll( fl->ls_fract ) + 48) >> 2;
+
+        if (digits) {
+            fract = (((U128_T) fl->ms_fract << 64) | fl->ls_fract)
+                  << (digits << 2);
+            fl->ms_fract = (U64) (fract >> 64);
+            fl->ls_fract = (U64) fract;
+            fl->expo -= digits;
+        }
+    } else {
+        fl->sign = POS;
+        fl->expo = 0;
+    }
+#else /*!defined(HAVE_U128_T)*/
     if (fl->ms_fract
     || fl->ls_fract) {
         if (fl->ms_fract == 0) {
@@ -779,6 +817,7 @@ static inline void normal_ef( EXTENDED_FLOAT *fl )
         fl->sign = POS;
         fl->expo = 0;
     }
+#endif /*!defined(HAVE_U128_T)*/
 
 } /* end function normal_ef */
 
@@ -1963,7 +2002,11 @@ static int mul_sf_to_lf( SHORT_FLOAT *fl, SHORT_FLOAT *mul_fl,
 static int mul_lf_to_ef( LONG_FLOAT *fl, LONG_FLOAT *mul_fl,
     EXTENDED_FLOAT *result_fl, REGS *regs )
 {
+#if defined(HAVE_U128_T)
+U128_T  wk;
+#else
 U64     wk;
+#endif
 
     if (fl->long_fract
     && mul_fl->long_fract) {
@@ -1971,6 +2014,12 @@ U64     wk;
         normal_lf( fl );
         normal_lf( mul_fl );
 
+#if defined(HAVE_U128_T)
+        /* multiply fracts */
+        wk = (U128_T) fl->long_fract * mul_fl->long_fract;
+        result_fl->ms_fract = (U64) (wk >> 64);
+        result_fl->ls_fract = (U64) wk;
+#else /*!defined(HAVE_U128_T)*/
         /* multiply fracts by sum of partial multiplications */
         wk = (fl->long_fract & 0x00000000FFFFFFFFULL) * (mul_fl->long_fract & 0x00000000FFFFFFFFULL);
         result_fl->ls_fract = wk & 0x00000000FFFFFFFFULL;
@@ -1981,6 +2030,7 @@ U64     wk;
         result_fl->ls_fract |= wk << 32;
 
         result_fl->ms_fract = (wk >> 32) + ((fl->long_fract >> 32) * (mul_fl->long_fract >> 32));
+#endif /*!defined(HAVE_U128_T)*/
 
         /* normalize result and compute expo */
         if (result_fl->ms_fract & 0x0000F00000000000ULL) {
@@ -2082,8 +2132,12 @@ U64     wk;
 static int mul_lf( LONG_FLOAT *fl, LONG_FLOAT *mul_fl,
     BYTE ovunf, REGS *regs )
 {
+#if defined(HAVE_U128_T)
+U128_T  wk;
+#else
 U64     wk;
 U32     v;
+#endif
 
     if (fl->long_fract
     && mul_fl->long_fract) {
@@ -2091,6 +2145,19 @@ U32     v;
         normal_lf( fl );
         normal_lf( mul_fl );
 
+#if defined(HAVE_U128_T)
+        /* multiply fracts */
+        wk = (U128_T) fl->long_fract * mul_fl->long_fract;
+
+        /* normalize result and compute expo */
+        if (wk & ((U128_T) 0xF << 108)) {
+            fl->long_fract = (U64) (wk >> 56);
+            fl->expo = fl->expo + mul_fl->expo - 64;
+        } else {
+            fl->long_fract = (U64) (wk >> 52);
+            fl->expo = fl->expo + mul_fl->expo - 65;
+        }
+#else /*!defined(HAVE_U128_T)*/
         /* multiply fracts by sum of partial multiplications */
         wk = ((fl->long_fract & 0x00000000FFFFFFFFULL) * (mul_fl->long_fract & 0x00000000FFFFFFFFULL)) >> 32;
 
@@ -2110,6 +2177,7 @@ U32     v;
                            | (v >> 20);
             fl->expo = fl->expo + mul_fl->expo - 65;
         }
+#endif /*!defined(HAVE_U128_T)*/
 
         /* determine sign */
         fl->sign = (fl->sign == mul_fl->sign) ? POS : NEG;
@@ -2145,6 +2213,10 @@ U32     v;
 static int mul_ef( EXTENDED_FLOAT *fl, EXTENDED_FLOAT *mul_fl,
     REGS *regs )
 {
+#if defined(HAVE_U128_T)
+U128_T wk;
+U128_T wkm;
+#else
 U64 wk1;
 U64 wk2;
 U64 wk3;
@@ -2152,6 +2224,7 @@ U64 wk4;
 U64 wk;
 U32 wk0;
 U32 v;
+#endif
 
     if ((fl->ms_fract
         || fl->ls_fract)
@@ -2161,6 +2234,26 @@ U32 v;
         normal_ef ( fl );
         normal_ef ( mul_fl );
 
+#if defined(HAVE_U128_T)
+        /* multiply fracts, keeping bits 96-223 of the 224 bit product */
+        wk  = (U128_T) fl->ls_fract * mul_fl->ls_fract;
+        wkm = (U128_T) fl->ls_fract * mul_fl->ms_fract
+            + (U128_T) fl->ms_fract * mul_fl->ls_fract
+            + (wk >> 64);
+        wk  = (((U128_T) fl->ms_fract * mul_fl->ms_fract) << 32)
+            + (wkm >> 32);
+
+        /* normalize result and compute expo */
+        if (wk >> 124) {
+            wk >>= 16;
+            fl->expo = fl->expo + mul_fl->expo - 64;
+        } else {
+            wk >>= 12;
+            fl->expo = fl->expo + mul_fl->expo - 65;
+        }
+        fl->ms_fract = (U64) (wk >> 64);
+        fl->ls_fract = (U64) wk;
+#else /*!defined(HAVE_U128_T)*/
         /* multiply fracts by sum of partial multiplications */
         wk0 = ((fl->ls_fract & 0x00000000FFFFFFFFULL) * (mul_fl->ls_fract & 0x00000000FFFFFFFFULL)) >> 32;
 
@@ -2213,6 +2306,7 @@ U32 v;
                          | (v >> 12);
             fl->expo = fl->expo + mul_fl->expo - 65;
         }
+#endif /*!defined(HAVE_U128_T)*/
 
         /* determine sign */
         fl->sign = (fl->sign == mul_fl->sign) ? POS : NEG;
@@ -2297,9 +2391,11 @@ U64     wk;
 /*-------------------------------------------------------------------*/
 static int div_lf( LONG_FLOAT *fl, LONG_FLOAT *div_fl, REGS *regs )
 {
+#if !defined(HAVE_U128_T)
 U64     wk;
 U64     wk2;
 int     i;
+#endif
 
     if (div_fl->long_fract) {
         if (fl->long_fract) {
@@ -2315,6 +2411,11 @@ int     i;
                 div_fl->long_fract <<= 4;
             }
 
+#if defined(HAVE_U128_T)
+            /* divide fractions */
+            fl->long_fract = (U64) (((U128_T) fl->long_fract << 56)
+                                    / div_fl->long_fract);
+#else /*!defined(HAVE_U128_T)*/
             /* partial divide first hex digit */
             wk2 = fl->long_fract / div_fl->long_fract;
             wk = (fl->long_fract % div_fl->long_fract) << 4;
@@ -2330,6 +2431,7 @@ int     i;
             /* partial divide last hex digit */
             fl->long_fract = (wk2 << 4)
                            | (wk / div_fl->long_fract);
+#endif /*!defined(HAVE_U128_T)*/
 
             /* determine sign */
             fl->sign = (fl->sign == div_fl->sign) ? POS : NEG;
@@ -2366,8 +2468,15 @@ int     i;
 static int div_ef( EXTENDED_FLOAT *fl, EXTENDED_FLOAT *div_fl,
     REGS *regs )
 {
+#if defined(HAVE_U128_T)
+U128_T  wkd;                            /* Divisor                   */
+U128_T  wkr;                            /* Partial remainder         */
+U128_T  wkq;                            /* Quotient                  */
+U128_T  q;                              /* Quotient byte             */
+#else
 U64     wkm;
 U64     wkl;
+#endif
 int     i;
 
     if (div_fl->ms_fract
@@ -2392,6 +2501,20 @@ int     i;
 
             /* divide fractions */
 
+#if defined(HAVE_U128_T)
+            /* a quotient byte at a time, remainder stays below 2**125 */
+            wkd = ((U128_T) div_fl->ms_fract << 64) | div_fl->ls_fract;
+            wkr = ((U128_T) fl->ms_fract << 64) | fl->ls_fract;
+            wkq = 0;
+            for (i = 0; i < 14; i++) {
+                wkr <<= 8;
+                q = wkr / wkd;
+                wkr -= q * wkd;
+                wkq = (wkq << 8) | q;
+            }
+            fl->ms_fract = (U64) (wkq >> 64);
+            fl->ls_fract = (U64) wkq;
+#else /*!defined(HAVE_U128_T)*/
             /* the first binary digit */
             wkm = fl->ms_fract;
             wkl = fl->ls_fract;
@@ -2433,6 +2556,7 @@ int     i;
             if (((S64)wkm) >= 0) {
                 fl->ls_fract |= 1;
             }
+#endif /*!defined(HAVE_U128_T)*/
 
             /* determine sign */
             fl->sign = (fl->sign == div_fl->sign) ? POS : NEG;
@@ -2767,6 +2891,9 @@ static const unsigned short sqtab[] = {
 /*-------------------------------------------------------------------*/
 static U64 div_U128( U64 msa, U64 lsa, U64 div )
 {
+#if defined(HAVE_U128_T)
+    return( (U64) ((((U128_T) msa << 64) | lsa) / div) );
+#else /*!defined(HAVE_U128_T)*/
 U64     q;
 int     i;
 
@@ -2803,6 +2930,7 @@ int     i;
     }
 
     return(q);
+#endif /*!defined(HAVE_U128_T)*/
 
 } /* end function div_U128 */
 
@@ -2216,6 +2216,8 @@ BYTE    sc;                             /* Store characteristic      */
 
     SSF(inst, regs, b1, addr1, b2, addr2, r3);
 
+    TXF_INSTR_CHECK(regs);
+
     /* Extract function code from register 0 bits 56-63 */
     fc = regs->GR_LHLCL(0);
 
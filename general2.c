@@ -324,6 +324,8 @@ VADR    effective_addr2,
     SS(inst, regs, r1, r3, b2, effective_addr2,
                                      b4, effective_addr4);
 
+    TXF_INSTR_CHECK(regs);
+
     if(regs->GR_L(0) & PLO_GPR0_RESV)
         regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
 
@@ -1338,6 +1340,9 @@ RADR    px;                             /* prefix                    */
 int     rc;                             /* Return code               */
 
     RR_SVC(inst, regs, i);
+
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_ECPSVM)
     if(ecpsvm_dosvc(regs,i)==0)
     {
@@ -29,8 +29,21 @@
 /* constants                                                                 */
 /*---------------------------------------------------------------------------*/
 #define HAO_WKLEN    256    /* (maximum message length able to tolerate) */
-#define HAO_MAXRULE  64     /* (purely arbitrary and easily increasable) */
+#define HAO_MAXRULE  256    /* (purely arbitrary and easily increasable) */
 #define HAO_MAXCAPT  9      /* (maximum number of capturing groups)      */
+#define HAO_MAXLIT   16     /* (longest prefilter literal kept per rule) */
+
+/*---------------------------------------------------------------------------*/
+/* per-rule statistics                                                       */
+/*---------------------------------------------------------------------------*/
+typedef struct HAOSTAT
+{
+  U64   matched;                /* messages matched by the rule              */
+  U64   checked;                /* messages checked with regexec             */
+  U64   skipped;                /* messages rejected by the prefilter        */
+  U64   usecs;                  /* time spent in regexec (microseconds)      */
+}
+HAOSTAT;
 
 /*---------------------------------------------------------------------------*/
 /* local variables                                                           */
@@ -41,6 +54,25 @@ static regex_t  ao_preg[HAO_MAXRULE];
 static char    *ao_cmd[HAO_MAXRULE];
 static char    *ao_tgt[HAO_MAXRULE];
 static char     ao_msgbuf[LOG_DEFSIZE+1];   /* (plus+1 for NULL termination) */
+static HAOSTAT  ao_stat[HAO_MAXRULE];
+static BYTE     ao_capt[HAO_MAXRULE];       /* command has $ replacements    */
+
+/*---------------------------------------------------------------------------*/
+/* Prefilter: every target regex is reduced to a literal string that any     */
+/* message it matches must contain. All literals are combined into one       */
+/* Aho-Corasick automaton, so a single pass over a message finds the rules   */
+/* that can possibly match it, and regexec only runs for those rules (and    */
+/* for the rules from which no literal could be derived).                    */
+/*---------------------------------------------------------------------------*/
+static char     ao_lit[HAO_MAXRULE][HAO_MAXLIT+1]; /* literal, or empty      */
+static BYTE     ao_acdirty = TRUE;          /* rules changed; rebuild        */
+static BYTE     ao_acclass[256];            /* char -> class, 0 = unused     */
+static int      ao_acnclass;                /* number of character classes   */
+static U16     *ao_acnext;                  /* [state*ao_acnclass + class]   */
+static U16     *ao_acdict;                  /* next state down the fail chain */
+                                            /* with an output, 0 = none      */
+static short   *ao_acout;                   /* first rule ending at state    */
+static short    ao_acrnext[HAO_MAXRULE];    /* next rule with same end state */
 
 /*---------------------------------------------------------------------------*/
 /* function prototypes                                                       */
@@ -53,6 +85,8 @@ static     void  hao_cmd(char *arg);
 static     void  hao_cpstrp(char *dest, char *src);
 static     void  hao_del(char *arg);
 static     void  hao_list(char *arg);
+static     void  hao_literal(const char *pat, char *lit);
+static     void  hao_stats(void);
 static     void  hao_tgt(char *arg);
 static     void* hao_thread(void* dummy);
 
@@ -157,6 +191,12 @@ DLL_EXPORT void hao_command(char *cmd)
     return;
   }
 
+  if(!strncasecmp(work2, "stats", 5))
+  {
+    hao_stats();
+    return;
+  }
+
   WRMSG(HHC00070, "E");
 }
 
@@ -177,6 +217,156 @@ static void hao_cpstrp(char *dest, char *src)
   dest[i] = 0;
 }
 
+/*---------------------------------------------------------------------------*/
+/* const char *hao_skipbracket(const char *p)                                */
+/* const char *hao_skipgroup(const char *p)                                  */
+/*                                                                           */
+/* These functions return the position following the bracket expression or   */
+/* the parenthesized group that starts at p.                                 */
+/*---------------------------------------------------------------------------*/
+static const char *hao_skipbracket(const char *p)
+{
+  const char *q;
+
+  p++;
+  if(*p == '^')
+    p++;
+  if(*p == ']')
+    p++;
+  while(*p && *p != ']')
+  {
+    /* skip [:class:], [.coll.] and [=equiv=] */
+    if(p[0] == '[' && (p[1] == ':' || p[1] == '.' || p[1] == '='))
+    {
+      char end[3] = { p[1], ']', 0 };
+      if((q = strstr(p + 2, end)))
+      {
+        p = q + 2;
+        continue;
+      }
+    }
+    p++;
+  }
+  return *p ? p + 1 : p;
+}
+
+static const char *hao_skipgroup(const char *p)
+{
+  int depth = 0;
+
+  while(*p)
+  {
+    if(*p == '\\')
+      p += p[1] ? 2 : 1;
+    else if(*p == '[')
+      p = hao_skipbracket(p);
+    else if(*p == '(')
+    {
+      depth++;
+      p++;
+    }
+    else if(*p++ == ')' && !--depth)
+      break;
+  }
+  return p;
+}
+
+/*---------------------------------------------------------------------------*/
+/* void hao_literal(const char *pat, char *lit)                              */
+/*                                                                           */
+/* This function derives from the extended regular expression pat the        */
+/* longest string of literal characters that every match must contain, for   */
+/* use by the prefilter. Groups, bracket expressions and optional characters */
+/* end a literal string. lit is set to the empty string when nothing is      */
+/* required, e.g. when the expression has alternatives at its outer level.   */
+/*---------------------------------------------------------------------------*/
+static void hao_literal(const char *pat, char *lit)
+{
+  char run[HAO_WKLEN];
+  int  runlen = 0;
+  int  best = 0;
+  const char *p = pat;
+
+#define HAO_ENDRUN()                                                \
+  do {                                                              \
+    if(runlen > HAO_MAXLIT)                                         \
+      runlen = HAO_MAXLIT;                                          \
+    if(runlen > best)                                               \
+    {                                                               \
+      memcpy(lit, run, runlen);                                     \
+      lit[best = runlen] = 0;                                       \
+    }                                                               \
+    runlen = 0;                                                     \
+  } while (0)
+
+  lit[0] = 0;
+
+  while(*p)
+  {
+    switch(*p)
+    {
+      case '|':
+        /* alternatives: no literal is required */
+        lit[0] = 0;
+        return;
+
+      case '\\':
+        /* an escaped punctuation character stands for itself */
+        if(p[1] && ispunct((unsigned char) p[1]) && runlen < (int) sizeof(run))
+        {
+          run[runlen++] = p[1];
+          p += 2;
+          continue;
+        }
+        HAO_ENDRUN();
+        p += p[1] ? 2 : 1;
+        continue;
+
+      case '[':
+        HAO_ENDRUN();
+        p = hao_skipbracket(p);
+        continue;
+
+      case '(':
+        HAO_ENDRUN();
+        p = hao_skipgroup(p);
+        continue;
+
+      case '*':
+      case '?':
+      case '{':
+        /* the preceding character is optional */
+        if(runlen)
+          runlen--;
+        HAO_ENDRUN();
+        if(*p == '{')
+          while(*p && *p != '}')
+            p++;
+        if(*p)
+          p++;
+        continue;
+
+      case '+':
+      case '.':
+      case '^':
+      case '$':
+      case ')':
+        HAO_ENDRUN();
+        p++;
+        continue;
+
+      default:
+        if(runlen < (int) sizeof(run))
+          run[runlen++] = *p;
+        p++;
+        continue;
+    }
+  }
+  HAO_ENDRUN();
+
+#undef HAO_ENDRUN
+}
+
 /*---------------------------------------------------------------------------*/
 /* void hao_tgt(char *arg)                                                   */
 /*                                                                           */
@@ -272,6 +462,11 @@ static void hao_tgt(char *arg)
     return;
   }
 
+  /* derive the prefilter literal and start counting afresh */
+  hao_literal(arg, ao_lit[i]);
+  memset(&ao_stat[i], 0, sizeof(HAOSTAT));
+  ao_acdirty = TRUE;
+
   release_lock(&ao_lock);
   WRMSG(HHC00077, "I", "target", i);
 }
@@ -340,6 +535,7 @@ static void hao_cmd(char *arg)
 
   /* duplicate the string */
   ao_cmd[i] = strdup(arg);
+  ao_capt[i] = (strchr(arg, '$') != NULL);
 
   /* check duplication */
   if(!ao_cmd[i])
@@ -394,6 +590,7 @@ static void hao_del(char *arg)
   free(ao_tgt[i]);
   ao_tgt[i] = NULL;
   regfree(&ao_preg[i]);
+  ao_acdirty = TRUE;
   if(ao_cmd[i])
   {
     free(ao_cmd[i]);
@@ -490,11 +687,50 @@ static void hao_clear(void)
       ao_cmd[i] = NULL;
     }
   }
+  ao_acdirty = TRUE;
 
   release_lock(&ao_lock);
   WRMSG(HHC00080, "I");
 }
 
+/*---------------------------------------------------------------------------*/
+/* void hao_stats(void)                                                      */
+/*                                                                           */
+/* This function is called when the hao stats command is given. It lists     */
+/* the match counters and regexec timing of all rules, together with the     */
+/* literal the prefilter looks for.                                          */
+/*---------------------------------------------------------------------------*/
+static void hao_stats(void)
+{
+  int i;
+  int size = 0;
+  char lit[HAO_MAXLIT+3];
+
+  /* serialize */
+  obtain_lock(&ao_lock);
+
+  for(i = 0; i < HAO_MAXRULE; i++)
+  {
+    if(ao_tgt[i])
+    {
+      if(ao_lit[i][0])
+        MSGBUF(lit, "'%.*s'", HAO_MAXLIT, ao_lit[i]);
+      else
+        strlcpy(lit, "none", sizeof(lit));
+
+      WRMSG(HHC00090, "I", i, ao_stat[i].matched, ao_stat[i].checked,
+        ao_stat[i].skipped, ao_stat[i].usecs, lit);
+      size++;
+    }
+  }
+  release_lock(&ao_lock);
+
+  if(!size)
+    WRMSG(HHC00089, "I");
+  else
+    WRMSG(HHC00082, "I", size);
+}
+
 /*---------------------------------------------------------------------------*/
 /* void* hao_thread(void* dummy)                                             */
 /*                                                                           */
@@ -627,6 +863,151 @@ static size_t hao_subst(char *str, size_t soff, size_t eoff,
   return len;
 }
 
+/*---------------------------------------------------------------------------*/
+/* void hao_acbuild(void)                                                    */
+/*                                                                           */
+/* This function builds the prefilter automaton from the literals of all     */
+/* defined rules. It is called with ao_lock held after the rules changed.    */
+/* If storage cannot be obtained there is no prefilter and every rule is     */
+/* checked with regexec.                                                     */
+/*---------------------------------------------------------------------------*/
+static void hao_acbuild(void)
+{
+  U16   *fail;
+  U16   *queue;
+  int    nstates;
+  int    maxstates;
+  int    head, tail;
+  int    i, c, s, t;
+  char  *p;
+
+  free(ao_acnext);
+  free(ao_acdict);
+  free(ao_acout);
+  ao_acnext = NULL;
+  ao_acdict = NULL;
+  ao_acout  = NULL;
+  ao_acdirty = FALSE;
+
+  /* give each character used in a literal its own class */
+  memset(ao_acclass, 0, sizeof(ao_acclass));
+  ao_acnclass = 1;
+  maxstates = 1;
+  for(i = 0; i < HAO_MAXRULE; i++)
+  {
+    if(!ao_tgt[i])
+      continue;
+    for(p = ao_lit[i]; *p; p++, maxstates++)
+      if(!ao_acclass[(BYTE) *p])
+        ao_acclass[(BYTE) *p] = (BYTE) ao_acnclass++;
+  }
+
+  ao_acnext = calloc(maxstates * ao_acnclass, sizeof(U16));
+  ao_acdict = calloc(maxstates, sizeof(U16));
+  ao_acout  = malloc(maxstates * sizeof(short));
+  fail      = calloc(maxstates, sizeof(U16));
+  queue     = malloc(maxstates * sizeof(U16));
+
+  if(!ao_acnext || !ao_acdict || !ao_acout || !fail || !queue)
+  {
+    free(ao_acnext);
+    free(ao_acdict);
+    free(ao_acout);
+    ao_acnext = NULL;
+    ao_acdict = NULL;
+    ao_acout  = NULL;
+    free(fail);
+    free(queue);
+    return;
+  }
+
+  for(s = 0; s < maxstates; s++)
+    ao_acout[s] = -1;
+
+  /* enter the literals into the trie */
+  nstates = 1;
+  for(i = 0; i < HAO_MAXRULE; i++)
+  {
+    if(!ao_tgt[i] || !ao_lit[i][0])
+      continue;
+    for(s = 0, p = ao_lit[i]; *p; p++)
+    {
+      c = ao_acclass[(BYTE) *p];
+      if(!ao_acnext[s * ao_acnclass + c])
+        ao_acnext[s * ao_acnclass + c] = (U16) nstates++;
+      s = ao_acnext[s * ao_acnclass + c];
+    }
+    ao_acrnext[i] = ao_acout[s];
+    ao_acout[s] = (short) i;
+  }
+
+  /* complete the transitions and dictionary links breadth first */
+  head = tail = 0;
+  for(c = 0; c < ao_acnclass; c++)
+    if((t = ao_acnext[c]))
+      queue[tail++] = (U16) t;
+
+  while(head < tail)
+  {
+    s = queue[head++];
+    for(c = 0; c < ao_acnclass; c++)
+    {
+      t = ao_acnext[s * ao_acnclass + c];
+      if(t)
+      {
+        fail[t] = ao_acnext[fail[s] * ao_acnclass + c];
+        ao_acdict[t] = (ao_acout[fail[t]] >= 0) ? fail[t] : ao_acdict[fail[t]];
+        queue[tail++] = (U16) t;
+      }
+      else
+        ao_acnext[s * ao_acnclass + c] = ao_acnext[fail[s] * ao_acnclass + c];
+    }
+  }
+
+  free(fail);
+  free(queue);
+}
+
+/*---------------------------------------------------------------------------*/
+/* void hao_acscan(char *msg, BYTE *cand)                                    */
+/*                                                                           */
+/* This function sets cand[i] for each rule i whose literal occurs in msg,   */
+/* or for all rules when there is no prefilter.                              */
+/*---------------------------------------------------------------------------*/
+static void hao_acscan(char *msg, BYTE *cand)
+{
+  int s, t, r;
+
+  if(!ao_acnext)
+  {
+    memset(cand, 1, HAO_MAXRULE);
+    return;
+  }
+
+  memset(cand, 0, HAO_MAXRULE);
+
+  for(s = 0; *msg; msg++)
+  {
+    s = ao_acnext[s * ao_acnclass + ao_acclass[(BYTE) *msg]];
+    for(t = (ao_acout[s] >= 0) ? s : ao_acdict[s]; t; t = ao_acdict[t])
+      for(r = ao_acout[t]; r >= 0; r = ao_acrnext[r])
+        cand[r] = 1;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/* U64 hao_usecs(void)                                                       */
+/*                                                                           */
+/* Returns the host time of day in microseconds, for the rule timing.        */
+/*---------------------------------------------------------------------------*/
+static U64 hao_usecs(void)
+{
+  struct timeval now;
+
+  gettimeofday(&now, NULL);
+  return ((U64) now.tv_sec * 1000000) + now.tv_usec;
+}
+
 /*---------------------------------------------------------------------------*/
 /* void hao_message(char *buf)                                               */
 /*                                                                           */
@@ -639,9 +1020,11 @@ static void hao_message(char *buf)
   char work[HAO_WKLEN];
   char cmd[HAO_WKLEN];
   regmatch_t rm[HAO_MAXCAPT+1];
-  int i, j, k, numcapt;
+  BYTE cand[HAO_MAXRULE];
+  int i, j, k, rc, numcapt;
   size_t n;
   char *p;
+  U64 start;
 
   /* copy and strip spaces */
   hao_cpstrp(work, buf);
@@ -657,17 +1040,41 @@ static void hao_message(char *buf)
   /* serialize */
   obtain_lock(&ao_lock);
 
+  /* find the candidate rules in a single pass over the message */
+  if(ao_acdirty)
+    hao_acbuild();
+  hao_acscan(work, cand);
+
   /* check all defined rules */
   for(i = 0; i < HAO_MAXRULE; i++)
   {
     if(ao_tgt[i] && ao_cmd[i])  /* complete rule defined in this slot? */
     {
-      /* does this rule match our message? */
-      if (regexec(&ao_preg[i], work, HAO_MAXCAPT+1, rm, 0) == 0)
+      /* can't match if its literal is missing from the message */
+      if(ao_lit[i][0] && !cand[i])
       {
+        ao_stat[i].skipped++;
+        continue;
+      }
+
+      /* does this rule match our message? (no captures unless used) */
+      start = hao_usecs();
+      rc = regexec(&ao_preg[i], work, ao_capt[i] ? HAO_MAXCAPT+1 : 0,
+        ao_capt[i] ? rm : NULL, 0);
+      ao_stat[i].usecs += hao_usecs() - start;
+      ao_stat[i].checked++;
+
+      if (rc == 0)
+      {
+        ao_stat[i].matched++;
+
         /* count the capturing group matches */
-        for (j = 0; j <= HAO_MAXCAPT && rm[j].rm_so >= 0; j++);
-        numcapt = j - 1;
+        numcapt = 0;
+        if (ao_capt[i])
+        {
+          for (j = 0; j <= HAO_MAXCAPT && rm[j].rm_so >= 0; j++);
+          numcapt = j - 1;
+        }
 
         /* copy the command and process replacement patterns */
         for (n=0, p=ao_cmd[i]; *p && n < sizeof(cmd)-1; ) {
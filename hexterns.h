@@ -299,6 +299,11 @@ int  configure_dev_priority(int prio);
 int  configure_tod_priority(int prio);
 int  configure_srv_priority(int prio);
 
+int  configure_cpu_affinity(int cpu, const HOSTCPUSET *set);
+int  configure_tod_affinity(const HOSTCPUSET *set);
+int  configure_dev_affinity(const HOSTCPUSET *dev, const HOSTCPUSET *cckd);
+int  configure_auto_affinity(int enable);
+
 int  configure_shrdport(U16 shrdport);
 #define MAX_ARGS  1024                  /* Max argv[] array size     */
 int parse_and_attach_devices(const char *devnums,const char *devtype,int ac,char **av);
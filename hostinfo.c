@@ -326,3 +326,93 @@ DLL_EXPORT void display_hostinfo ( HOST_INFO* pHostInfo, FILE* f, int httpfd )
              fprintf( f, MSG( HHC01417, "I", host_info_str ));
     }
 }
+
+/*-------------------------------------------------------------------*/
+/* Order host processors for thread placement                        */
+/*-------------------------------------------------------------------*/
+typedef struct HOSTCPU
+{
+    int     cpu;                        /* Host processor number     */
+    int     pkg;                        /* Physical package id       */
+    int     core;                       /* Core id within package    */
+    int     rank;                       /* Sibling number in core    */
+}
+HOSTCPU;
+
+static int hostcpu_cmp ( const void* a, const void* b )
+{
+    const HOSTCPU* x = (const HOSTCPU*) a;
+    const HOSTCPU* y = (const HOSTCPU*) b;
+
+    if (x->rank != y->rank) return x->rank - y->rank;
+    if (x->pkg  != y->pkg ) return x->pkg  - y->pkg;
+    if (x->core != y->core) return x->core - y->core;
+    return x->cpu - y->cpu;
+}
+
+/*-------------------------------------------------------------------*/
+/* Fills order[] with up to max host processor numbers: first one    */
+/* logical processor of every physical core, package by package,     */
+/* then the remaining SMT siblings.  Returns the number of entries.  */
+/* Without topology information the processors are listed in order.  */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT int get_hostcpu_order ( int* order, int max )
+{
+    HOSTCPU hc[ MAX_HOST_CPUS ];        /* Online host processors    */
+    int     i, j, n = 0;
+
+#if defined( __linux__ )
+    char    path[80];
+    FILE*   f;
+    int     c;
+
+    for (i=0; i < MAX_HOST_CPUS; i++)
+    {
+        MSGBUF( path, "/sys/devices/system/cpu/cpu%d/online", i );
+        if ((f = fopen( path, "r" )))
+        {
+            c = fgetc( f );
+            fclose( f );
+            if (c == '0')
+                continue;
+        }
+        MSGBUF( path, "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", i );
+        if (!(f = fopen( path, "r" )))
+            continue;
+        if (fscanf( f, "%d", &hc[n].pkg ) != 1)
+            hc[n].pkg = 0;
+        fclose( f );
+        MSGBUF( path, "/sys/devices/system/cpu/cpu%d/topology/core_id", i );
+        if (!(f = fopen( path, "r" )))
+            continue;
+        if (fscanf( f, "%d", &hc[n].core ) != 1)
+            hc[n].core = i;
+        fclose( f );
+        hc[n++].cpu = i;
+    }
+#endif
+
+    if (!n)
+    {
+        n = MIN( MAX( hostinfo.num_procs, 1 ), MAX_HOST_CPUS );
+        for (i=0; i < n; i++)
+        {
+            hc[i].cpu  = i;
+            hc[i].pkg  = 0;
+            hc[i].core = i;
+        }
+    }
+
+    /* Number each processor among the siblings of its core */
+    for (i=0; i < n; i++)
+        for (hc[i].rank = 0, j=0; j < i; j++)
+            if (hc[j].pkg == hc[i].pkg && hc[j].core == hc[i].core)
+                hc[i].rank++;
+
+    qsort( hc, n, sizeof( HOSTCPU ), hostcpu_cmp );
+
+    for (i=0; i < n && i < max; i++)
+        order[i] = hc[i].cpu;
+
+    return i;
+}
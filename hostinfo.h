@@ -83,6 +83,7 @@ HI_DLL_IMPORT void  display_hostinfo ( HOST_INFO* pHostInfo, FILE* f, int httpfd
 HI_DLL_IMPORT char* get_hostinfo_str ( HOST_INFO* pHostInfo,
                                        char*      pszHostInfoStrBuff,
                                        size_t     nHostInfoStrBuffSiz );
+HI_DLL_IMPORT int get_hostcpu_order ( int* order, int max );
 
 /* Hercules Host Information structure  (similar to utsname struct)  */
 
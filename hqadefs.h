@@ -460,6 +460,22 @@
 
 #endif
 
+/*-------------------------------------------------------------------*/
+/*  HQA Scenario    23     ESA/390 with the Vector Facility          */
+/*-------------------------------------------------------------------*/
+
+#if HQA_SCENARIO == 23  // ESA/390 with the Vector Facility
+
+  #undef  CUSTOM_BUILD_STRING
+  #define CUSTOM_BUILD_STRING "\n\n         HQA Scenario 23\n"
+
+  #define OPTION_370_MODE
+  #define OPTION_390_MODE
+  #define NO_900_MODE
+  #define OPTION_VECTOR_FACILITY
+
+#endif
+
 /*-------------------------------------------------------------------*/
 
 #endif // !defined(HQA_SCENARIO) || HQA_SCENARIO == 0
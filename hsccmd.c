@@ -3998,6 +3998,178 @@ BYTE c;
 }
 
 
+/*-------------------------------------------------------------------*/
+/* affinity command helpers: parse and format host processor lists   */
+/*-------------------------------------------------------------------*/
+static int parse_hostcpus(const char *str, HOSTCPUSET *set)
+{
+int  lo, hi, n;
+
+    HOSTCPU_ZERO(set);
+    if (strcasecmp(str, "none") == 0)
+        return 0;
+
+    while (*str)
+    {
+        if (sscanf(str, "%d%n", &lo, &n) != 1)
+            return -1;
+        str += n;
+        hi = lo;
+        if (*str == '-')
+        {
+            if (sscanf(++str, "%d%n", &hi, &n) != 1)
+                return -1;
+            str += n;
+        }
+        if (lo < 0 || hi < lo || hi >= MAX_HOST_CPUS)
+            return -1;
+        for (; lo <= hi; lo++)
+            HOSTCPU_SET(set, lo);
+        if (*str == ',')
+            str++;
+        else if (*str)
+            return -1;
+    }
+    return 0;
+}
+
+static char *format_hostcpus(const HOSTCPUSET *set, char *buf, size_t len)
+{
+int  lo, hi;
+char range[16];
+
+    *buf = 0;
+    for (lo = 0; lo < MAX_HOST_CPUS; lo = hi + 1)
+    {
+        hi = lo;
+        if (!HOSTCPU_ISSET(set, lo))
+            continue;
+        while (hi + 1 < MAX_HOST_CPUS && HOSTCPU_ISSET(set, hi + 1))
+            hi++;
+        if (hi > lo)
+            MSGBUF(range, "%s%d-%d", *buf ? "," : "", lo, hi);
+        else
+            MSGBUF(range, "%s%d", *buf ? "," : "", lo);
+        strlcat(buf, range, len);
+    }
+    if (!*buf)
+        strlcpy(buf, "any", len);
+    return buf;
+}
+
+/*-------------------------------------------------------------------*/
+/* affinity command - bind threads to host processors                */
+/*-------------------------------------------------------------------*/
+int affinity_cmd(int argc, char *argv[], char *cmdline)
+{
+HOSTCPUSET set;
+char       buf[256];
+char       name[32];
+int        cpu, lo = 0, hi = -1;
+BYTE       c;
+
+    UNREFERENCED(cmdline);
+
+    if (argc == 1)
+    {
+        // "Host processor affinity%s:"
+        WRMSG(HHC02360, "I", sysblk.affauto ? " (automatic)" : "");
+        for (cpu = 0; cpu < sysblk.maxcpu; cpu++)
+        {
+            if (!IS_CPU_ONLINE(cpu) && HOSTCPU_EMPTY(&sysblk.cpuaff[cpu]))
+                continue;
+            MSGBUF(name, "Processor %s%02X", PTYPSTR(cpu), cpu);
+            WRMSG(HHC02361, "I", name,
+                  format_hostcpus(&sysblk.cpuaff[cpu], buf, sizeof(buf)));
+        }
+        WRMSG(HHC02361, "I", "Timer",
+              format_hostcpus(&sysblk.todaff, buf, sizeof(buf)));
+        WRMSG(HHC02361, "I", "Device threads",
+              format_hostcpus(&sysblk.devaff, buf, sizeof(buf)));
+        WRMSG(HHC02361, "I", "cckd threads",
+              format_hostcpus(&sysblk.cckdaff, buf, sizeof(buf)));
+        return 0;
+    }
+
+#if !defined(OPTION_THREAD_AFFINITY)
+    if (!CMD(argv[1], none, 4))
+    {
+        // "Host processor affinity is not supported on this host"
+        WRMSG(HHC02362, "E");
+        return -1;
+    }
+#endif
+
+    if (argc == 2 && (CMD(argv[1], auto, 4) || CMD(argv[1], none, 4)))
+    {
+        if (configure_auto_affinity(CMD(argv[1], auto, 4)) < 0)
+        {
+            // "Host processor affinity is not supported on this host"
+            WRMSG(HHC02362, "E");
+            return -1;
+        }
+    }
+    else if (argc == 4 && CMD(argv[1], cpu, 3))
+    {
+        if (strcmp(argv[2], "*") == 0)
+            hi = sysblk.maxcpu - 1;
+        else if (sscanf(argv[2], "%x%c", &lo, &c) == 1
+              && lo >= 0 && lo < sysblk.maxcpu)
+            hi = lo;
+        if (hi < lo)
+        {
+            // "Invalid argument '%s'%s"
+            WRMSG(HHC02205, "E", argv[2], ": must be a CPU address or '*'");
+            return -1;
+        }
+        if (parse_hostcpus(argv[3], &set) < 0)
+        {
+            WRMSG(HHC02205, "E", argv[3], ": must be a list such as 0-3,8 or 'none'");
+            return -1;
+        }
+        for (cpu = lo; cpu <= hi; cpu++)
+            configure_cpu_affinity(cpu, &set);
+        sysblk.affauto = 0;
+    }
+    else if (argc == 3 && (CMD(argv[1], timer, 5)
+                        || CMD(argv[1], dev, 3)
+                        || CMD(argv[1], cckd, 4)))
+    {
+        if (parse_hostcpus(argv[2], &set) < 0)
+        {
+            WRMSG(HHC02205, "E", argv[2], ": must be a list such as 0-3,8 or 'none'");
+            return -1;
+        }
+        if (CMD(argv[1], timer, 5))
+            configure_tod_affinity(&set);
+        else if (CMD(argv[1], dev, 3))
+            configure_dev_affinity(&set, &sysblk.cckdaff);
+        else
+            configure_dev_affinity(&sysblk.devaff, &set);
+        sysblk.affauto = 0;
+    }
+    else
+    {
+        // "Invalid command usage. Type 'help %s' for assistance."
+        WRMSG(HHC02299, "E", argv[0]);
+        return -1;
+    }
+
+    if (MLVL(VERBOSE))
+    {
+        for (buf[0] = 0, cpu = 1; cpu < argc; cpu++)
+        {
+            if (cpu > 1)
+                strlcat(buf, " ", sizeof(buf));
+            strlcat(buf, argv[cpu], sizeof(buf));
+        }
+        // "%-14s set to %s"
+        WRMSG(HHC02204, "I", argv[0], buf);
+    }
+    return 0;
+}
+
+
 /*-------------------------------------------------------------------*/
 /* numvec command                                                    */
 /*-------------------------------------------------------------------*/
@@ -6244,6 +6416,66 @@ int rc;
 }
 
 
+/*-------------------------------------------------------------------*/
+/* mvsassist command - display or reset MVS assist counts            */
+/*-------------------------------------------------------------------*/
+int mvsassist_cmd(int argc, char *argv[], char *cmdline)
+{
+    UNREFERENCED(cmdline);
+
+    if (argc > 2)
+    {
+        WRMSG( HHC02299, "E", argv[0] );
+        return -1;
+    }
+
+    if (argc > 1)
+    {
+        if (!CMD(argv[1],reset,5))
+        {
+            WRMSG( HHC02205, "E", argv[1], "" );
+            return -1;
+        }
+        mvsassist_stats_disp(1);
+        WRMSG(HHC02204, "I", "mvsassist", "zero");
+    }
+    else
+        mvsassist_stats_disp(0);
+
+    return 0;
+}
+
+
+/*-------------------------------------------------------------------*/
+/* pgmcount command - display or reset program interruption counts   */
+/*-------------------------------------------------------------------*/
+int pgmcount_cmd(int argc, char *argv[], char *cmdline)
+{
+    UNREFERENCED(cmdline);
+
+    if (argc > 2)
+    {
+        WRMSG( HHC02299, "E", argv[0] );
+        return -1;
+    }
+
+    if (argc > 1)
+    {
+        if (!CMD(argv[1],reset,5))
+        {
+            WRMSG( HHC02205, "E", argv[1], "" );
+            return -1;
+        }
+        pgmint_stats_disp(1);
+        WRMSG(HHC02204, "I", "pgmcount", "zero");
+    }
+    else
+        pgmint_stats_disp(0);
+
+    return 0;
+}
+
+
 /*-------------------------------------------------------------------*/
 /* pgmtrace command - trace program interrupts                       */
 /*-------------------------------------------------------------------*/
@@ -426,6 +426,78 @@ int tlb_cmd(int argc, char *argv[], char *cmdline)
     return 0;
 }
 
+/*-------------------------------------------------------------------*/
+/* alb - display ART lookaside buffer and ASN translation cache      */
+/*-------------------------------------------------------------------*/
+static void alb_display(REGS *regs, const char *pfx)
+{
+    int     i;                          /* Index                     */
+    char    buf[128];
+
+    MSGBUF( buf, "%sALB hits %"I64_FMT"u misses %"I64_FMT"u, "
+            "ASN cache hits %"I64_FMT"u misses %"I64_FMT"u", pfx,
+            regs->albhit, regs->albmiss, regs->asnhit, regs->asnmiss);
+    WRMSG(HHC02284, "I", buf);
+
+    for (i = 0; i < ALB_ENTRIES; i++)
+    {
+        if (!regs->albent[i].valid)
+            continue;
+        MSGBUF( buf, "%sALB %2.2X alet %8.8X cb %8.8X eax %4.4X p %d asd %16.16"PRIX64,
+                pfx, i, regs->albent[i].alet, regs->albent[i].cb,
+                regs->albent[i].eax, regs->albent[i].protect != 0,
+                regs->albent[i].asd);
+        WRMSG(HHC02284, "I", buf);
+    }
+
+    for (i = 0; i < ASNCACHE_ENTRIES; i++)
+    {
+        if (!regs->asncache[i].valid)
+            continue;
+        MSGBUF( buf, "%sASN %2.2X asn %4.4X afto %8.8X asteo %8.8X",
+                pfx, i, regs->asncache[i].asn, regs->asncache[i].afto >> 1,
+                regs->asncache[i].asteo);
+        WRMSG(HHC02284, "I", buf);
+    }
+}
+
+int alb_cmd(int argc, char *argv[], char *cmdline)
+{
+    REGS   *regs;
+
+    UNREFERENCED(cmdline);
+
+    obtain_lock(&sysblk.cpulock[sysblk.pcpu]);
+
+    if (!IS_CPU_ONLINE(sysblk.pcpu))
+    {
+        release_lock(&sysblk.cpulock[sysblk.pcpu]);
+        WRMSG(HHC00816, "W", PTYPSTR(sysblk.pcpu), sysblk.pcpu, "online");
+        return 0;
+    }
+    regs = sysblk.regs[sysblk.pcpu];
+
+    if (argc > 1 && CMD(argv[1],reset,5))
+    {
+        regs->albhit = regs->albmiss = regs->asnhit = regs->asnmiss = 0;
+        if (regs->guestregs)
+            regs->guestregs->albhit = regs->guestregs->albmiss =
+            regs->guestregs->asnhit = regs->guestregs->asnmiss = 0;
+        release_lock(&sysblk.cpulock[sysblk.pcpu]);
+        WRMSG(HHC02204, "I", "ALB counters", "zero");
+        return 0;
+    }
+
+    alb_display(regs, "");
+
+    if (regs->sie_active)
+        alb_display(regs->guestregs, "SIE: ");
+
+    release_lock(&sysblk.cpulock[sysblk.pcpu]);
+
+    return 0;
+}
+
 #if defined(SIE_DEBUG_PERFMON)
 /*-------------------------------------------------------------------*/
 /* spm - SIE performance monitor table                               */
@@ -442,6 +514,26 @@ int spm_cmd(int argc, char *argv[], char *cmdline)
 }
 #endif
 
+#if defined(_FEATURE_SIE)
+/*-------------------------------------------------------------------*/
+/* siestats - display or reset SIE exit statistics                   */
+/*-------------------------------------------------------------------*/
+int siestats_cmd(int argc, char *argv[], char *cmdline)
+{
+    UNREFERENCED(cmdline);
+
+    if (argc > 1 && CMD(argv[1],reset,5) )
+    {
+        sie_stats_disp(1);
+        WRMSG(HHC02204, "I", "SIE statistics", "zero");
+    }
+    else
+        sie_stats_disp(0);
+
+    return 0;
+}
+#endif
+
 
 /*-------------------------------------------------------------------*/
 /* ar command - display access registers                             */
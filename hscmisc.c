@@ -23,6 +23,7 @@
 #include "hconsole.h"
 #include "esa390io.h"
 #include "hexdumpe.h"
+#include "itrace.h"
 
 #if !defined(_HSCMISC_C)
 #define _HSCMISC_C
@@ -2541,6 +2542,119 @@ size_t  totamt;                         /* Total amount to be dumped */
 } /* end function alter_display_virt */
 
 
+/*-------------------------------------------------------------------*/
+/* Calculate the storage operand addresses of an instruction.        */
+/* The base register numbers are returned as -1 for operands which   */
+/* are not in storage.                                               */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(inst_operands) (REGS *regs, BYTE *inst,
+                                     int *b1, VADR *addr1,
+                                     int *b2, VADR *addr2)
+{
+BYTE    opcode = inst[0];               /* Instruction operation code*/
+int     ilc = ILC(opcode);              /* Instruction length        */
+int     x1;                             /* Index register number     */
+
+    *b1 = *b2 = -1;
+    *addr1 = *addr2 = 0;
+
+    /* Process the first storage operand */
+    if (ilc > 2
+        && opcode != 0x84 && opcode != 0x85
+        && opcode != 0xA5 && opcode != 0xA7
+        && opcode != 0xB3
+        && opcode != 0xC0 && opcode != 0xC4 && opcode != 0xC6
+        && opcode != 0xEC)
+    {
+        /* Calculate the effective address of the first operand */
+        *b1 = inst[2] >> 4;
+        *addr1 = ((inst[2] & 0x0F) << 8) | inst[3];
+        if (*b1 != 0)
+        {
+            *addr1 += regs->GR(*b1);
+            *addr1 &= ADDRESS_MAXWRAP(regs);
+        }
+
+        /* Apply indexing for RX/RXE/RXF instructions */
+        if ((opcode >= 0x40 && opcode <= 0x7F) || opcode == 0xB1
+            || opcode == 0xE3 || opcode == 0xED)
+        {
+            x1 = inst[1] & 0x0F;
+            if (x1 != 0)
+            {
+                *addr1 += regs->GR(x1);
+                *addr1 &= ADDRESS_MAXWRAP(regs);
+            }
+        }
+    }
+
+    /* Process the second storage operand */
+    if (ilc > 4
+        && opcode != 0xC0 && opcode != 0xC4 && opcode != 0xC6
+        && opcode != 0xE3 && opcode != 0xEB
+        && opcode != 0xEC && opcode != 0xED)
+    {
+        /* Calculate the effective address of the second operand */
+        *b2 = inst[4] >> 4;
+        *addr2 = ((inst[4] & 0x0F) << 8) | inst[5];
+        if (*b2 != 0)
+        {
+            *addr2 += regs->GR(*b2);
+            *addr2 &= ADDRESS_MAXWRAP(regs);
+        }
+    }
+
+    /* Calculate the operand addresses for MVCL(E) and CLCL(E) */
+    if (opcode == 0x0E || opcode == 0x0F
+        || opcode == 0xA8 || opcode == 0xA9)
+    {
+        *b1 = inst[1] >> 4;
+        *addr1 = regs->GR(*b1) & ADDRESS_MAXWRAP(regs);
+        *b2 = inst[1] & 0x0F;
+        *addr2 = regs->GR(*b2) & ADDRESS_MAXWRAP(regs);
+    }
+
+    /* Calculate the operand addresses for RRE instructions */
+    if ((opcode == 0xB2 &&
+            ((inst[1] >= 0x20 && inst[1] <= 0x2F)
+            || (inst[1] >= 0x40 && inst[1] <= 0x6F)
+            || (inst[1] >= 0xA0 && inst[1] <= 0xAF)))
+        || (opcode == 0xB9 &&
+            (0
+            || (inst[1] == 0x05)    /*LURAG*/
+            || (inst[1] == 0x25)    /*STURG*/
+            || (inst[1] >= 0x31)))) /*FIXME : Needs more specifics ! */
+    {
+        *b1 = inst[3] >> 4;
+        *addr1 = regs->GR(*b1) & ADDRESS_MAXWRAP(regs);
+        *b2 = inst[3] & 0x0F;
+        if (inst[1] >= 0x29 && inst[1] <= 0x2C)
+            *addr2 = regs->GR(*b2) & ADDRESS_MAXWRAP_E(regs);
+        else
+        if (inst[1] >= 0x29 && inst[1] <= 0x2C)
+            *addr2 = regs->GR(*b2) & ADDRESS_MAXWRAP(regs);
+        else
+        *addr2 = regs->GR(*b2) & ADDRESS_MAXWRAP(regs);
+    }
+
+    /* Calculate the operand address for RIL_A instructions */
+    if ((opcode == 0xC0 &&
+            ((inst[1] & 0x0F) == 0x00
+            || (inst[1] & 0x0F) == 0x04
+            || (inst[1] & 0x0F) == 0x05))
+        || opcode == 0xC4
+        || opcode == 0xC6)
+    {
+        S64 offset = 2LL*(S32)(fetch_fw(inst+2));
+        *addr1 = (likely(!regs->execflag)) ?
+                        PSW_IA(regs, offset) : \
+                        (regs->ET + offset) & ADDRESS_MAXWRAP(regs);
+        *b1 = 0;
+    }
+
+} /* end function inst_operands */
+
+
 /*-------------------------------------------------------------------*/
 /* Display instruction                                               */
 /*-------------------------------------------------------------------*/
@@ -2549,7 +2663,7 @@ void ARCH_DEP(display_inst) (REGS *iregs, BYTE *inst)
 QWORD   qword;                          /* Doubleword work area      */
 BYTE    opcode;                         /* Instruction operation code*/
 int     ilc;                            /* Instruction length        */
-int     b1=-1, b2=-1, x1;               /* Register numbers          */
+int     b1=-1, b2=-1;                   /* Register numbers          */
 U16     xcode = 0;                      /* Exception code            */
 VADR    addr1 = 0, addr2 = 0;           /* Operand addresses         */
 char    buf[2048];                      /* Message buffer            */
@@ -2632,99 +2746,8 @@ char    regs_msg_buf[4*512] = {0};
     n = 0;
     buf[0] = '\0';
 
-    /* Process the first storage operand */
-    if (ilc > 2
-        && opcode != 0x84 && opcode != 0x85
-        && opcode != 0xA5 && opcode != 0xA7
-        && opcode != 0xB3
-        && opcode != 0xC0 && opcode != 0xC4 && opcode != 0xC6
-        && opcode != 0xEC)
-    {
-        /* Calculate the effective address of the first operand */
-        b1 = inst[2] >> 4;
-        addr1 = ((inst[2] & 0x0F) << 8) | inst[3];
-        if (b1 != 0)
-        {
-            addr1 += regs->GR(b1);
-            addr1 &= ADDRESS_MAXWRAP(regs);
-        }
-
-        /* Apply indexing for RX/RXE/RXF instructions */
-        if ((opcode >= 0x40 && opcode <= 0x7F) || opcode == 0xB1
-            || opcode == 0xE3 || opcode == 0xED)
-        {
-            x1 = inst[1] & 0x0F;
-            if (x1 != 0)
-            {
-                addr1 += regs->GR(x1);
-                addr1 &= ADDRESS_MAXWRAP(regs);
-            }
-        }
-    }
-
-    /* Process the second storage operand */
-    if (ilc > 4
-        && opcode != 0xC0 && opcode != 0xC4 && opcode != 0xC6
-        && opcode != 0xE3 && opcode != 0xEB
-        && opcode != 0xEC && opcode != 0xED)
-    {
-        /* Calculate the effective address of the second operand */
-        b2 = inst[4] >> 4;
-        addr2 = ((inst[4] & 0x0F) << 8) | inst[5];
-        if (b2 != 0)
-        {
-            addr2 += regs->GR(b2);
-            addr2 &= ADDRESS_MAXWRAP(regs);
-        }
-    }
-
-    /* Calculate the operand addresses for MVCL(E) and CLCL(E) */
-    if (opcode == 0x0E || opcode == 0x0F
-        || opcode == 0xA8 || opcode == 0xA9)
-    {
-        b1 = inst[1] >> 4;
-        addr1 = regs->GR(b1) & ADDRESS_MAXWRAP(regs);
-        b2 = inst[1] & 0x0F;
-        addr2 = regs->GR(b2) & ADDRESS_MAXWRAP(regs);
-    }
-
-    /* Calculate the operand addresses for RRE instructions */
-    if ((opcode == 0xB2 &&
-            ((inst[1] >= 0x20 && inst[1] <= 0x2F)
-            || (inst[1] >= 0x40 && inst[1] <= 0x6F)
-            || (inst[1] >= 0xA0 && inst[1] <= 0xAF)))
-        || (opcode == 0xB9 &&
-            (0
-            || (inst[1] == 0x05)    /*LURAG*/
-            || (inst[1] == 0x25)    /*STURG*/
-            || (inst[1] >= 0x31)))) /*FIXME : Needs more specifics ! */
-    {
-        b1 = inst[3] >> 4;
-        addr1 = regs->GR(b1) & ADDRESS_MAXWRAP(regs);
-        b2 = inst[3] & 0x0F;
-        if (inst[1] >= 0x29 && inst[1] <= 0x2C)
-            addr2 = regs->GR(b2) & ADDRESS_MAXWRAP_E(regs);
-        else
-        if (inst[1] >= 0x29 && inst[1] <= 0x2C)
-            addr2 = regs->GR(b2) & ADDRESS_MAXWRAP(regs);
-        else
-        addr2 = regs->GR(b2) & ADDRESS_MAXWRAP(regs);
-    }
-
-    /* Calculate the operand address for RIL_A instructions */
-    if ((opcode == 0xC0 &&
-            ((inst[1] & 0x0F) == 0x00
-            || (inst[1] & 0x0F) == 0x04
-            || (inst[1] & 0x0F) == 0x05))
-        || opcode == 0xC4
-        || opcode == 0xC6)
-    {
-        S64 offset = 2LL*(S32)(fetch_fw(inst+2));
-        addr1 = (likely(!regs->execflag)) ?
-                        PSW_IA(regs, offset) : \
-                        (regs->ET + offset) & ADDRESS_MAXWRAP(regs);
-        b1 = 0;
-    }
+    /* Calculate the storage operand addresses */
+    ARCH_DEP(inst_operands) (regs, inst, &b1, &addr1, &b2, &addr2);
 
     /* Format storage at first storage operand location */
     if (b1 >= 0)
@@ -2811,6 +2834,103 @@ char    regs_msg_buf[4*512] = {0};
 } /* end function display_inst */
 
 
+/*-------------------------------------------------------------------*/
+/* Record an instruction, or a program interruption, in the binary   */
+/* instruction trace.  Called only by the CPU thread itself, so the  */
+/* per-CPU lock is never contended except by the itrace command.     */
+/*-------------------------------------------------------------------*/
+void ARCH_DEP(itrace_inst) (REGS *regs, BYTE *inst, U16 pcode)
+{
+ITRACE_CPU *tc;                         /* -> CPU recording state    */
+ITRACE_REC *rec;                        /* -> Trace record           */
+int     b1=-1, b2=-1;                   /* Register numbers          */
+VADR    addr1 = 0, addr2 = 0;           /* Operand addresses         */
+U16     grmask = 0;                     /* Registers changed         */
+U64     gr;                             /* Register contents         */
+int     freeze = 0;                     /* ITRACE_FRZ_xxx or zero    */
+int     r;
+
+    tc = &itrace.cpu[regs->cpuad];
+
+    obtain_lock (&tc->lock);
+
+    if (itrace.frozen || !tc->ring)
+    {
+        release_lock (&tc->lock);
+        return;
+    }
+
+    rec = &tc->ring[tc->next & (itrace.nrecs - 1)];
+
+    rec->type  = pcode ? ITRACE_PGM : ITRACE_INST;
+    rec->arch  = (BYTE) regs->arch_mode;
+    rec->flags = REAL_MODE(&regs->psw) ? ITRACE_REAL : 0;
+  #if defined(_FEATURE_SIE)
+    if (SIE_MODE(regs))
+        rec->flags |= ITRACE_SIE;
+  #endif /*defined(_FEATURE_SIE)*/
+    STORE_HW (rec->pcode, pcode);
+    STORE_DW (rec->seq, tc->next);
+    STORE_DW (rec->tod, host_tod());
+
+    memset (rec->psw, 0, sizeof(rec->psw));
+    ARCH_DEP(store_psw) (regs, rec->psw);
+
+    memset (rec->inst, 0, sizeof(rec->inst));
+    if (inst)
+    {
+        rec->ilc = ILC(inst[0]);
+        memcpy (rec->inst, inst, rec->ilc);
+        ARCH_DEP(inst_operands) (regs, inst, &b1, &addr1, &b2, &addr2);
+    }
+    else
+    {
+        rec->ilc = 0;
+        rec->flags |= ITRACE_NOINST;
+    }
+
+    rec->b1 = b1 < 0 ? ITRACE_NOREG : (BYTE) b1;
+    rec->b2 = b2 < 0 ? ITRACE_NOREG : (BYTE) b2;
+    STORE_DW (rec->addr1, (U64) addr1);
+    STORE_DW (rec->addr2, (U64) addr2);
+
+    /* Record the registers, noting those changed since the previous
+       record (all of them in the first record of the trace) */
+    for (r = 0; r < 16; r++)
+    {
+        gr = regs->GR(r);
+        if (gr != tc->gr[r] || !tc->next)
+        {
+            grmask |= 0x8000 >> r;
+            tc->gr[r] = gr;
+        }
+        STORE_DW (rec->gr[r], gr);
+    }
+    STORE_HW (rec->grmask, grmask);
+
+    /* The record is complete; count it in the trace file */
+    STORE_DW (tc->count, ++tc->next);
+
+    /* Check whether this record should freeze the trace */
+    if (pcode)
+    {
+        if (itrace.freeze == ITRACE_FRZ_PGM
+         && (!itrace.frzpgm
+          || itrace.frzpgm == (pcode & ~(PGM_PER_EVENT | PGM_TXF_EVENT))))
+            freeze = ITRACE_FRZ_PGM;
+    }
+    else if (itrace.freeze == ITRACE_FRZ_IA
+          && itrace.frzia == (U64) PSW_IA(regs, 0))
+        freeze = ITRACE_FRZ_IA;
+
+    release_lock (&tc->lock);
+
+    if (freeze)
+        itrace_freeze (regs->cpuad, freeze);
+
+} /* end function itrace_inst */
+
+
 #if !defined(_GEN_ARCH)
 
 #if defined(_ARCHMODE2)
@@ -696,6 +696,142 @@ int timerint_cmd( int argc, char *argv[], char *cmdline )
 }
 
 
+/*-------------------------------------------------------------------*/
+/* clocksrc command - display or set the host clock source           */
+/*-------------------------------------------------------------------*/
+int clocksrc_cmd( int argc, char *argv[], char *cmdline )
+{
+    char buf[32];
+    UNREFERENCED( cmdline );
+
+    if (argc == 2)  /* Define a new value? */
+    {
+        if (CMD( argv[1], system, 3 ))
+            tsc_clock_enable( 0 );
+        else if (CMD( argv[1], tsc, 3 ))
+        {
+            if (tsc_clock_enable( 1 ) < 0)
+            {
+                // "Invariant TSC clock source is not available on this host"
+                WRMSG( HHC02358, "E" );
+                return -1;
+            }
+        }
+        else
+        {
+            // "Invalid argument '%s'%s"
+            WRMSG( HHC02205, "E", argv[1], ": must be 'system' or 'tsc'" );
+            return -1;
+        }
+
+        if (MLVL( VERBOSE ))
+        {
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], tsc_clock ? "tsc" : "system" );
+        }
+    }
+    else if (argc == 1)
+    {
+        /* Display the current value */
+        if (tsc_clock)
+            MSGBUF( buf, "tsc (%"I64_FMT"u MHz)", tsc_clock_hz() / 1000000 );
+        else
+            strlcpy( buf, "system", sizeof( buf ));
+        // "%-14s: %s"
+        WRMSG( HHC02203, "I", argv[0], buf );
+    }
+    else
+    {
+        // "Invalid command usage. Type 'help %s' for assistance."
+        WRMSG( HHC02299, "E", argv[0] );
+        return -1;
+    }
+
+    return 0;
+}
+
+
+
+/*-------------------------------------------------------------------*/
+/* haltpoll command - display or set the halt-poll window            */
+/*-------------------------------------------------------------------*/
+int haltpoll_cmd( int argc, char *argv[], char *cmdline )
+{
+    char buf[25];
+    int  cpu;
+    UNREFERENCED( cmdline );
+
+    if (argc == 2)  /* Define a new value? */
+    {
+        if (CMD( argv[1], reset, 5 ))
+        {
+            for (cpu = 0; cpu < sysblk.maxcpu; cpu++)
+                if (IS_CPU_ONLINE( cpu ))
+                    sysblk.regs[cpu]->hpollhit =
+                    sysblk.regs[cpu]->hpollslp = 0;
+            return 0;
+        }
+        else if (CMD( argv[1], default, 7 ))
+            sysblk.hpollmax = DEF_HALT_POLL_USECS;
+        else
+        {
+            int hpollmax = 0; BYTE c;
+
+            if (1
+                && sscanf( argv[1], "%d%c", &hpollmax, &c ) == 1
+                && hpollmax >= MIN_HALT_POLL_USECS
+                && hpollmax <= MAX_HALT_POLL_USECS
+            )
+                sysblk.hpollmax = hpollmax;
+            else
+            {
+                // "Invalid argument '%s'%s"
+                WRMSG( HHC02205, "E", argv[1], ": must be 'default', 'reset' or n where "
+                    QSTR( MIN_HALT_POLL_USECS ) " <= n <= "
+                    QSTR( MAX_HALT_POLL_USECS ) );
+                return -1;
+            }
+        }
+
+        if (MLVL( VERBOSE ))
+        {
+            MSGBUF( buf, "%d", sysblk.hpollmax );
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], buf );
+        }
+    }
+    else if (argc == 1)
+    {
+        /* Display the current value and the statistics */
+        MSGBUF( buf, "%d", sysblk.hpollmax );
+        // "%-14s: %s"
+        WRMSG( HHC02203, "I", argv[0], buf );
+
+        for (cpu = 0; cpu < sysblk.maxcpu; cpu++)
+        {
+            REGS *regs = sysblk.regs[cpu];
+            U64   total;
+
+            if (!IS_CPU_ONLINE( cpu ))
+                continue;
+
+            total = regs->hpollhit + regs->hpollslp;
+            // "Processor %s%02X: halt-poll window %4"I64_FMT"u us, ..."
+            WRMSG( HHC02359, "I", PTYPSTR( cpu ), cpu, regs->hpoll >> 4,
+                   regs->hpollhit, regs->hpollslp,
+                   total ? (int)((regs->hpollhit * 100) / total) : 0 );
+        }
+    }
+    else
+    {
+        // "Invalid command usage. Type 'help %s' for assistance."
+        WRMSG( HHC02299, "E", argv[0] );
+        return -1;
+    }
+
+    return 0;
+}
+
 /* format_tod - generate displayable date from TOD value */
 /* always uses epoch of 1900 */
 char * format_tod(char *buf, U64 tod, int flagdate)
@@ -1133,3 +1269,138 @@ int cmpscpad_cmd( int argc, char* argv[], char* cmdline )
     return HNOERROR;
 }
 #endif /* defined(_FEATURE_CMPSC_ENHANCEMENT_FACILITY) */
+
+#if defined(_FEATURE_VECTOR_FACILITY)
+/*-------------------------------------------------------------------*/
+/* vfsectsize command - set Vector Facility section size             */
+/*-------------------------------------------------------------------*/
+int vfsectsize_cmd( int argc, char* argv[], char* cmdline )
+{
+    int size, i;
+    const char* ptr;
+    char* nxt;
+    char buf[8];
+
+    UNREFERENCED( cmdline );
+
+    if ( argc > 2 )
+    {
+        // "Invalid number of arguments for %s"
+        WRMSG( HHC01455, "E", argv[0] );
+        return HERROR;
+    }
+
+    /* Ensure all CPUs have been stopped */
+
+    OBTAIN_INTLOCK( NULL );
+
+    if (are_any_cpus_started_intlock_held())
+    {
+        RELEASE_INTLOCK( NULL );
+        // "CPUs must be offline or stopped"
+        WRMSG( HHC02389, "E" );
+        return HERRCPUONL;
+    }
+
+    if ( argc == 2 )
+    {
+        ptr   = argv[1];
+        errno = 0;
+        size  = (int) strtoul( ptr, &nxt, 10 );
+
+        if (0
+            || errno != 0
+            || nxt == ptr
+            || *nxt != 0
+            || size < MIN_VECTOR_SECTION_SIZE
+            || size > MAX_VECTOR_SECTION_SIZE
+            || (size & (size - 1))
+        )
+        {
+            RELEASE_INTLOCK( NULL );
+            // "Specified value is invalid or outside of range %d to %d"
+            WRMSG( HHC17014 , "E", MIN_VECTOR_SECTION_SIZE,
+                                   MAX_VECTOR_SECTION_SIZE );
+            return HERROR;
+        }
+
+        /* Vector counts and saved element numbers are only valid
+           for the section size they were set under */
+        if (size != (int) sysblk.vsectsz)
+        {
+            for (i = 0; i < MAX_CPU_ENGINES; i++)
+            {
+                sysblk.vf[i].vsr = 0;
+                memset( sysblk.vf[i].vmr, 0, sizeof( sysblk.vf[i].vmr ));
+                memset( sysblk.vf[i].vr,  0, sizeof( sysblk.vf[i].vr  ));
+            }
+        }
+
+        /* Update SYSBLK with new value */
+        sysblk.vsectsz = (U16) size;
+        RELEASE_INTLOCK( NULL );
+
+        MSGBUF( buf, "%d", size );
+        // "%-14s set to %s"
+        WRMSG( HHC02204, "I", argv[0], buf );
+    }
+    else
+    {
+        /* Display current SYSBLK value */
+        size = sysblk.vsectsz;
+        RELEASE_INTLOCK( NULL );
+
+        MSGBUF( buf, "%d", size );
+        // "%-14s: %s"
+        WRMSG( HHC02203, "I", argv[0], buf );
+    }
+
+    return HNOERROR;
+}
+
+/*-------------------------------------------------------------------*/
+/* vfsimd command - display or set the Vector Facility SIMD level    */
+/*-------------------------------------------------------------------*/
+int vfsimd_cmd( int argc, char* argv[], char* cmdline )
+{
+    static const char* levels[] = { "scalar", "sse2", "auto" };
+
+    UNREFERENCED( cmdline );
+
+    if (argc == 2)  /* Define a new value? */
+    {
+        if (CMD( argv[1], auto, 4 ) || CMD( argv[1], avx2, 4 ))
+            sysblk.vfsimd = VF_AVX2;
+        else if (CMD( argv[1], sse2, 4 ))
+            sysblk.vfsimd = VF_SSE2;
+        else if (CMD( argv[1], scalar, 3 ))
+            sysblk.vfsimd = VF_SCALAR;
+        else
+        {
+            // "Invalid argument '%s'%s"
+            WRMSG( HHC02205, "E", argv[1],
+                ": must be 'auto', 'avx2', 'sse2' or 'scalar'" );
+            return -1;
+        }
+
+        if (MLVL( VERBOSE ))
+        {
+            // "%-14s set to %s"
+            WRMSG( HHC02204, "I", argv[0], levels[ sysblk.vfsimd ] );
+        }
+    }
+    else if (argc == 1)
+    {
+        // "%-14s: %s"
+        WRMSG( HHC02203, "I", argv[0], levels[ sysblk.vfsimd ] );
+    }
+    else
+    {
+        // "Invalid command usage. Type 'help %s' for assistance."
+        WRMSG( HHC02299, "E", argv[0] );
+        return -1;
+    }
+
+    return 0;
+}
+#endif /* defined(_FEATURE_VECTOR_FACILITY) */
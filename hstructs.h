@@ -54,6 +54,87 @@
 #endif
 
 
+/*-------------------------------------------------------------------*/
+/* ART lookaside buffer and ASN translation cache entries            */
+/*                                                                   */
+/* The ALB holds the result of ordinary ART for an ALET, keyed on    */
+/* the ALET, the real address of the DUCT or primary ASTE that       */
+/* supplied the access-list designation, and the EAX.  The ASN       */
+/* cache holds the real address of the ASTE for an ASN, keyed on     */
+/* the AFT origin and ASF control.  Both are cleared by purge_alb.   */
+/*-------------------------------------------------------------------*/
+#define ALB_ENTRIES      64             /* ALB entries (power of 2)  */
+typedef struct ALBENT {
+        U64     asd;                    /* ASCE or STD from the ASTE */
+        U32     alet;                   /* Access-list-entry token   */
+        U32     cb;                     /* DUCT or PASTE real address*/
+        U16     eax;                    /* Extended authorization idx*/
+        BYTE    protect;                /* 2=ALE fetch-only bit set  */
+        BYTE    valid;                  /* 1=Entry is valid          */
+    } ALBENT;
+
+#define ASNCACHE_ENTRIES 32             /* ASN cache entries (pow 2) */
+typedef struct ASNENT {
+        U32     afto;                   /* CR14 AFTO << 1 | ASF      */
+        U32     asteo;                  /* Real address of the ASTE  */
+        U16     asn;                    /* Address space number      */
+        BYTE    valid;                  /* 1=Entry is valid          */
+    } ASNENT;
+
+
+#if defined(_FEATURE_SIE)
+/*-------------------------------------------------------------------*/
+/* Guest TLB context retained across SIE exits                       */
+/*                                                                   */
+/* Records the tlbID under which the guest TLB entries for a state   */
+/* descriptor were made, together with the host and guest storage   */
+/* parameters those entries depend on.  A context whose tlbID is 0   */
+/* is free.                                                          */
+/*-------------------------------------------------------------------*/
+#define SIE_TLBCTX_MAX  4               /* Contexts per host CPU     */
+typedef struct SIETLBCTX {
+        RADR    sdaddr;                 /* State descriptor address  */
+        U64     hostasd;                /* Host primary ASCE or STD  */
+        U64     cr0;                    /* Guest control register 0  */
+        BYTE   *mainstor;               /* Guest mainstor base       */
+        RADR    mso;                    /* Main storage origin       */
+        RADR    mainlim;                /* Main storage limit        */
+        RADR    px;                     /* Guest prefix              */
+        RADR    hostpx;                 /* Host absolute address of
+                                           the guest prefix area     */
+        RADR    hostpfra;               /* Host PFRA of prefix area  */
+        unsigned int tlbID;             /* Guest TLB identifier      */
+        BYTE    arch_mode;              /* Guest architecture mode   */
+        BYTE    pref;                   /* 1=Preferred-storage guest */
+        BYTE    pxvalid;                /* 1=hostpx is valid         */
+    } SIETLBCTX;
+
+/*-------------------------------------------------------------------*/
+/* Guest storage definition cache                                    */
+/*                                                                   */
+/* A copy of the state descriptor fields from which the guest        */
+/* storage definition in GUESTREGS was last decoded.  Fields are     */
+/* kept as raw bytes, sized for the largest state descriptor format. */
+/*-------------------------------------------------------------------*/
+typedef struct SIESDCACHE {
+        RADR    sdaddr;                 /* State descriptor address  */
+        RADR    hostlim;                /* Host main storage limit   */
+        BYTE    hostarch;               /* Host architecture mode    */
+        BYTE    valid;                  /* 1=Decode may be reused    */
+        BYTE    m;                      /* Mode controls             */
+        BYTE    mx;                     /* Machine mode control      */
+        BYTE    zone;                   /* Zone number               */
+        BYTE    xso[3];                 /* Expanded storage origin   */
+        BYTE    xsl[3];                 /* Expanded storage limit    */
+        BYTE    prefix[4];              /* Guest prefix register     */
+        BYTE    mso[8];                 /* Main storage origin       */
+        BYTE    mse[8];                 /* Main storage extent       */
+        BYTE    scao[4];                /* SCA area origin           */
+        BYTE    scaoh[4];               /* SCAO high word            */
+        BYTE    rcpo[4];                /* RCP area origin           */
+    } SIESDCACHE;
+#endif /*defined(_FEATURE_SIE)*/
+
 /*-------------------------------------------------------------------*/
 /* Structure definition for CPU register context                     */
 /*                                                                   */
@@ -114,7 +195,12 @@ struct REGS {                           /* Processor registers       */
 /*220*/ U64     bear;                   /* Breaking event address reg*/
 /*228*/ BYTE   *bear_ip;                /* Breaking event inst ptr   */
 
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+/*230*/ U16     txf_tnd;                /* Transaction nesting depth */
+/*232-27F*/                             /* Available...              */
+#else
 /*230-27F*/                             /* Available...              */
+#endif
 
 
 /*280*/ ALIGN_128
@@ -144,6 +230,13 @@ struct REGS {                           /* Processor registers       */
 /*4D0*/ DW      ea;                     /* Exception address         */
 /*4D8*/ DW      et;                     /* Execute Target address    */
 
+#if defined(_FEATURE_ZVECTOR_FACILITY)
+        ALIGN_16
+        VREG    vr[32];                 /* Vector registers; bits
+                                           0-63 of VR0-VR15 are held
+                                           in fpr, not here          */
+#endif /*defined(_FEATURE_ZVECTOR_FACILITY)*/
+
         unsigned int                    /* Flags (cpu thread only)   */
                 execflag:1,             /* 1=EXecuted instruction    */
                 exrl:1,                 /* 1=EXRL, 0=EX instruction  */
@@ -163,7 +256,8 @@ struct REGS {                           /* Processor registers       */
                 tracing:1,              /* 1=Trace is active         */
                 stepwait:1,             /* 1=Wait in inst stepping   */
                 sigpreset:1,            /* 1=SIGP cpu reset received */
-                sigpireset:1;           /* 1=SIGP initial cpu reset  */
+                sigpireset:1,           /* 1=SIGP initial cpu reset  */
+                profsample:1;           /* 1=Profiler sample wanted  */
 
         CACHE_ALIGN                     /* --- 64-byte cache line -- */
         S64     tod_epoch;              /* TOD epoch for this CPU    */
@@ -193,6 +287,7 @@ struct REGS {                           /* Processor registers       */
         U64     waittod;                /* Time of day last wait     */
         U64     waittime;               /* Wait time in interval     */
         U64     waittime_accumulated;   /* Wait time accumulated     */
+        U64     hpoll;                  /* Halt-poll window (TOD)    */
 
         CACHE_ALIGN                     /* --- 64-byte cache line -- */
         DAT     dat;                    /* Fields for DAT use        */
@@ -283,6 +378,11 @@ struct REGS {                           /* Processor registers       */
         RADR    sie_rcpo;               /* Ref and Change Preserv.   */
         RADR    sie_scao;               /* System Contol Area        */
         S64     sie_epoch;              /* TOD offset in state desc. */
+        unsigned int sie_tlbIDmax;      /* Highest guest tlbID issued*/
+        SIETLBCTX sie_tlbctx[SIE_TLBCTX_MAX]; /* Retained guest TLB
+                                           contexts (guestregs only) */
+        SIESDCACHE sie_sdcache;         /* Storage definition cache
+                                           (guestregs only)          */
 #endif /*defined(_FEATURE_SIE)*/
         unsigned int
                 sie_active:1,           /* SIE active (host only)    */
@@ -312,6 +412,44 @@ struct REGS {                           /* Processor registers       */
                                            instruction crosses a page
                                            boundary                  */
         BYTE    *invalidate_main;       /* Mainstor addr to invalidat*/
+        void    *cmpsc_dctcache;        /* CMPSC dictionary cache    */
+        U64     pgmcount[0x41];         /* Program interruptions by
+                                           code (0=PER only/other)   */
+        U64     pgmfast;                /* Program interruptions
+                                           taken on the fast path    */
+        ALBENT  albent[ALB_ENTRIES];    /* ART lookaside buffer      */
+        ASNENT  asncache[ASNCACHE_ENTRIES]; /* ASN translation cache */
+        U64     albhit, albmiss;        /* ALB lookups               */
+        U64     asnhit, asnmiss;        /* ASN cache lookups         */
+        U64     mvsahit[16];            /* MVS assists performed and */
+        U64     mvsamiss[16];           /*   handed back to software,
+                                           by second opcode byte     */
+        U64     hpollhit;               /* Waits ended while polling */
+        U64     hpollslp;               /* Waits that blocked        */
+        RADR    trace_page;             /* Cached trace table page:
+                                           real address,             */
+        RADR    trace_abs;              /*   absolute address,       */
+        RADR    trace_absg;             /*   guest absolute if SIE,  */
+        RADR    trace_px;               /*   prefix and              */
+        unsigned int trace_tlbID;       /*   tlbID when cached       */
+        BYTE    trace_valid;            /* 1=Trace page cache valid  */
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+        struct TXFPAGE *txf_pages;      /* Transaction page buffers  */
+        int     txf_npages;             /* Pages in use              */
+        int     txf_lastpage;           /* Most recently used page   */
+        U32     txf_state;              /* Transaction state, or the
+                                           abort code set by another
+                                           CPU (hostregs only)       */
+        U64     txf_tdba;               /* TBEGIN TDB address        */
+        U64     txf_tbeginia;           /* Address of outermost TBEGIN
+                                           or TBEGINC                */
+        DW      txf_savedgr[16];        /* GRs saved by TBEGIN       */
+        BYTE    txf_contran;            /* 1=Constrained transaction */
+        BYTE    txf_pifc;               /* Program int filter control*/
+        BYTE    txf_grsm;               /* General register save mask*/
+        BYTE    txf_tdbarn;             /* TDB address space         */
+        BYTE    txf_tdbvalid;           /* 1=TDB address specified   */
+#endif /*defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
         CACHE_ALIGN                     /* --- 64-byte cache line -- */
         PSW     captured_zpsw;          /* Captured-z/Arch PSW reg   */
 #if defined(_FEATURE_VECTOR_FACILITY)
@@ -368,16 +506,19 @@ struct REGS {                           /* Processor registers       */
      /* Runtime opcode tables, use replace_opcode to modify */
         const zz_func *s370_runtime_opcode_xxxx,
                *s370_runtime_opcode_e3________xx,
+               *s370_runtime_opcode_e7________xx,
                *s370_runtime_opcode_eb________xx,
                *s370_runtime_opcode_ec________xx,
                *s370_runtime_opcode_ed________xx;
         const zz_func *s390_runtime_opcode_xxxx,
                *s390_runtime_opcode_e3________xx,
+               *s390_runtime_opcode_e7________xx,
                *s390_runtime_opcode_eb________xx,
                *s390_runtime_opcode_ec________xx,
                *s390_runtime_opcode_ed________xx;
         const zz_func *z900_runtime_opcode_xxxx,
                *z900_runtime_opcode_e3________xx,
+               *z900_runtime_opcode_e7________xx,
                *z900_runtime_opcode_eb________xx,
                *z900_runtime_opcode_ec________xx,
                *z900_runtime_opcode_ed________xx;
@@ -389,6 +530,7 @@ struct REGS {                           /* Processor registers       */
 #endif /* #ifdef OPTION_OPTINST */
 
      /* TLB - Translation lookaside buffer                           */
+        CACHE_ALIGN                     /* --- 64-byte cache line -- */
         unsigned int tlbID;             /* Validation identifier     */
         TLB     tlb;                    /* Translation lookaside buf */
 
@@ -404,8 +546,8 @@ struct VFREGS {                          /* Vector Facility Registers*/
                 online:1;               /* 1=VF is online            */
         U64     vsr;                    /* Vector Status Register    */
         U64     vac;                    /* Vector Activity Count     */
-        BYTE    vmr[VECTOR_SECTION_SIZE/8];  /* Vector Mask Register */
-        U32     vr[16][VECTOR_SECTION_SIZE]; /* Vector Registers     */
+        BYTE    vmr[MAX_VECTOR_SECTION_SIZE/8];  /* Vector Mask Reg  */
+        U32     vr[16][MAX_VECTOR_SECTION_SIZE]; /* Vector Registers */
 };
 #endif /*defined(_FEATURE_VECTOR_FACILITY)*/
 
@@ -527,6 +669,7 @@ struct SYSBLK {
         BYTE    ptyp[MAX_CPU_ENGINES];  /* SCCB ptyp for each engine */
         LOCK    todlock;                /* TOD clock update lock     */
         TID     todtid;                 /* Thread-id for TOD update  */
+        COND    timercond;              /* Wakes the timer thread    */
         REGS   *regs[MAX_CPU_ENGINES+1];   /* Registers for each CPU */
         LOCK    caplock[MAX_CPU_ENGINES]; /* CP capping locks        */
         int     caplocked[MAX_CPU_ENGINES]; /* Indication locked     */
@@ -560,7 +703,18 @@ struct SYSBLK {
 
 #if defined(_FEATURE_VECTOR_FACILITY)
         VFREGS  vf[MAX_CPU_ENGINES];    /* Vector Facility           */
+        U16     vsectsz;                /* Vector section size       */
+#define VSECT_SIZE          ((U32)sysblk.vsectsz)
+        BYTE    vfsimd;                 /* Highest element kernel    */
+#define VF_SCALAR           0           /* Portable element loops    */
+#define VF_SSE2             1           /* 4 elements per operation  */
+#define VF_AVX2             2           /* 8 elements per operation  */
 #endif /*defined(_FEATURE_VECTOR_FACILITY)*/
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+        LOCK    txflock;                /* Transaction marks lock    */
+        struct TXFMARK *txf_marks;      /* Transaction page marks    */
+        U32     txf_cpus;               /* CPUs in transactions      */
+#endif /*defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
 #if defined(_FEATURE_SIE)
         ZPBLK   zpb[FEATURE_SIE_MAXZONES];  /* SIE Zone Parameter Blk*/
 #endif /*defined(_FEATURE_SIE)*/
@@ -568,13 +722,6 @@ struct SYSBLK {
         REGS    footprregs[MAX_CPU_ENGINES][OPTION_FOOTPRINT_BUFFER];
         U32     footprptr[MAX_CPU_ENGINES];
 #endif
-#define LOCK_OWNER_NONE  0xFFFF
-#define LOCK_OWNER_OTHER 0xFFFE
-        U16     mainowner;              /* Mainlock owner            */
-        U16     intowner;               /* Intlock owner             */
-
-        LOCK    mainlock;               /* Main storage lock         */
-        LOCK    intlock;                /* Interrupt lock            */
         LOCK    iointqlk;               /* I/O Interrupt Queue lock  */
         LOCK    sigplock;               /* Signal processor lock     */
         ATTR    detattr;                /* Detached thread attribute */
@@ -638,6 +785,7 @@ struct SYSBLK {
 #define SHCMDOPT_DIAG8    0x80          /* Allow DIAG8 'sh' also     */
         int     panrate;                /* Panel refresh rate        */
         int     timerint;               /* microsecs timer interval  */
+        int     hpollmax;               /* Max halt-poll window usecs*/
         char   *pantitle;               /* Alt console panel title   */
 #if defined( OPTION_SCSI_TAPE )
         /* Access to all SCSI fields controlled by sysblk.stape_lock */
@@ -724,6 +872,7 @@ struct SYSBLK {
                 sigintreq:1,            /* 1 = SIGINT request pending*/
                 insttrace:1,            /* 1 = Instruction trace     */
                 inststep:1,             /* 1 = Instruction step      */
+                itracing:1,             /* 1 = Binary instr trace    */
                 shutdown:1,             /* 1 = shutdown requested    */
                 shutfini:1,             /* 1 = shutdown complete     */
                 shutimmed:1,            /* 1 = shutdown req immed    */
@@ -744,10 +893,7 @@ struct SYSBLK {
 #define SHOWDVOL1_NO            0       /*   Do not show vol1 at all */
 #define SHOWDVOL1_YES           1       /*   Show vol1 AND filename  */
 #define SHOWDVOL1_ONLY          2       /*   Show vol1 NOT filename  */
-        U32     ints_state;             /* Common Interrupts Status  */
         CPU_BITMAP config_mask;         /* Configured CPUs           */
-        CPU_BITMAP started_mask;        /* Started CPUs              */
-        CPU_BITMAP waiting_mask;        /* Waiting CPUs              */
         U64     traceaddr[2];           /* Tracing address range     */
         U64     stepaddr[2];            /* Stepping address range    */
         BYTE    iplparmstring[64];      /* 64 bytes loadable at IPL  */
@@ -770,11 +916,15 @@ struct SYSBLK {
         int     cpuprio;                /* CPU thread priority       */
         int     devprio;                /* Device thread priority    */
         int     srvprio;                /* Listeners thread priority */
+        HOSTCPUSET cpuaff[MAX_CPU_ENGINES]; /* CPU thread host procs */
+        HOSTCPUSET todaff;              /* Timer thread host procs   */
+        HOSTCPUSET devaff;              /* Device thread host procs  */
+        HOSTCPUSET cckdaff;             /* cckd thread host procs    */
+        U32     devaffgen;              /* devaff/cckdaff changed    */
+        BYTE    affauto;                /* 1=Automatic placement     */
         TID     httptid;                /* HTTP listener thread id   */
 
-     /* Fields used by SYNCHRONIZE_CPUS */
-        int     syncing;                /* 1=Sync in progress        */
-        CPU_BITMAP sync_mask;           /* CPU mask for syncing CPUs */
+     /* Fields used by SYNCHRONIZE_CPUS (see also syncing below) */
         COND    sync_cond;              /* COND for syncing CPU      */
         COND    sync_bc_cond;           /* COND for other CPUs       */
 #if defined(OPTION_SHARED_DEVICES)
@@ -795,7 +945,36 @@ struct SYSBLK {
         gid_t   rgid, egid, sgid;
 #endif /*!defined(NO_SETUID)*/
 
+        /*-----------------------------------------------------------*/
+        /*      Shared CPU state                                     */
+        /*                                                           */
+        /* Fields written by one CPU and read by all the others live */
+        /* on cache lines of their own, apart from the read-mostly   */
+        /* configuration above, so that taking a lock or making an   */
+        /* interrupt pending does not evict the lines every CPU      */
+        /* reads.  The layout is checked by CASSERTs in hsys.c.      */
+        /*-----------------------------------------------------------*/
+
+        CACHE_ALIGN                     /* --- intlock cache line -- */
+        LOCK    intlock;                /* Interrupt lock            */
+#define LOCK_OWNER_NONE  0xFFFF
+#define LOCK_OWNER_OTHER 0xFFFE
+        U16     intowner;               /* Intlock owner             */
+        U32     ints_state;             /* Common Interrupts Status  */
+        CPU_BITMAP started_mask;        /* Started CPUs              */
+        CPU_BITMAP waiting_mask;        /* Waiting CPUs              */
+        U64     timernext;              /* Host TOD of the next timer
+                                           event (under intlock)     */
+        int     syncing;                /* 1=Sync in progress        */
+        CPU_BITMAP sync_mask;           /* CPU mask for syncing CPUs */
+
+        CACHE_ALIGN                     /* --- mainlock cache line - */
+        LOCK    mainlock;               /* Main storage lock         */
+        U16     mainowner;              /* Mainlock owner            */
+
+        /* Counters updated by every CPU */
 #if defined(OPTION_COUNTING)
+        CACHE_ALIGN                     /* --- 64-byte cache line -- */
         S64     count[OPTION_COUNTING];
 #define COUNT(n) sysblk.count[(n)]++
 #else
@@ -804,6 +983,7 @@ struct SYSBLK {
 
 #if defined(OPTION_INSTRUCTION_COUNTING)
 #define IMAP_FIRST sysblk.imap01
+        CACHE_ALIGN                     /* --- 64-byte cache line -- */
         U64 imap01[256];
         U64 imapa4[256];
         U64 imapa5[16];
@@ -847,6 +1027,7 @@ struct SYSBLK {
             + sizeof(sysblk.imapxx) )
 #endif
 
+        CACHE_ALIGN                     /* --- end of shared lines - */
         char    *cnslport;              /* console port string       */
         char    **herclogo;             /* Constructed logo screen   */
         char    *logofile;              /* File name of logo file    */
@@ -14,6 +14,38 @@
 
 DLL_EXPORT SYSBLK sysblk;
 
+/*-------------------------------------------------------------------*/
+/* SYSBLK and REGS layout checks                                     */
+/*                                                                   */
+/* The fields every CPU writes must start cache lines of their own,  */
+/* and the per-instruction REGS fields must not straddle a line.     */
+/*-------------------------------------------------------------------*/
+#define ON_CACHE_LINE(_s,_f)   (offsetof(_s,_f) % CACHE_LINE_SIZE == 0)
+#define SAME_CACHE_LINE(_s,_f1,_f2) \
+    (offsetof(_s,_f1) / CACHE_LINE_SIZE == offsetof(_s,_f2) / CACHE_LINE_SIZE)
+
+CASSERT( ON_CACHE_LINE( SYSBLK, intlock  ), hsys_c )
+CASSERT( ON_CACHE_LINE( SYSBLK, mainlock ), hsys_c )
+CASSERT( ON_CACHE_LINE( SYSBLK, cnslport ), hsys_c )
+CASSERT( SAME_CACHE_LINE( SYSBLK, intlock, syncing ), hsys_c )
+#if defined(OPTION_COUNTING)
+CASSERT( ON_CACHE_LINE( SYSBLK, count ), hsys_c )
+#endif
+#if defined(OPTION_INSTRUCTION_COUNTING)
+CASSERT( ON_CACHE_LINE( SYSBLK, imap01 ), hsys_c )
+#endif
+CASSERT( sizeof(SYSBLK) % CACHE_LINE_SIZE == 0, hsys_c )
+
+CASSERT( SAME_CACHE_LINE( REGS, ints_state, ip ), hsys_c )
+CASSERT( SAME_CACHE_LINE( REGS, aip, aiv ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, malfcpu ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, emercpu ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, tod_epoch ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, dat ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, progjmp ), hsys_c )
+CASSERT( ON_CACHE_LINE( REGS, tlbID ), hsys_c )
+CASSERT( sizeof(REGS) % CACHE_LINE_SIZE == 0, hsys_c )
+
 
 #if defined(EXTERNALGUI)
 DLL_EXPORT int extgui = 0;
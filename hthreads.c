@@ -18,6 +18,40 @@
 
 #include "hercules.h"
 
+/*-------------------------------------------------------------------*/
+/* Lock contention statistics                                        */
+/*                                                                   */
+/* Collected only while 'locks stats on' is in effect.  Wait times   */
+/* are measured in lock clock ticks (the TSC where the host has one, */
+/* microseconds otherwise) and converted for display.  Each bucket   */
+/* of the wait histogram covers one power of two of ticks.  The site */
+/* table keeps the call sites that have waited the longest; when it */
+/* is full the site with the least total wait is replaced.  Updates */
+/* are made while holding the lock exclusively, or under locklock    */
+/* for shared (read) acquisitions of a R/W lock.                     */
+/*-------------------------------------------------------------------*/
+#define LOCKSTAT_HIST   48          /* Wait histogram buckets        */
+#define LOCKSTAT_SITES  4           /* Top waiting call sites kept   */
+
+struct LOCKSITE                 /* Waiting call site                 */
+{
+    const char*  location;      /* Location of the obtain call       */
+    U64          count;         /* Number of contended obtains       */
+    U64          wait;          /* Total wait time in ticks          */
+};
+typedef struct LOCKSITE LOCKSITE;
+
+struct LOCKSTAT                 /* Per-lock contention statistics    */
+{
+    U64          acquired;      /* Number of times lock obtained     */
+    U64          contended;     /* Number of times we had to wait    */
+    U64          waittot;       /* Total wait time in ticks          */
+    U64          waitmax;       /* Longest wait time in ticks        */
+    U32          hist[ LOCKSTAT_HIST ];  /* log2(ticks) histogram    */
+    LOCKSITE     site[ LOCKSTAT_SITES ]; /* Top waiting call sites   */
+};
+typedef struct LOCKSTAT LOCKSTAT;
+
 /*-------------------------------------------------------------------*/
 /* Hercules Internal ILOCK structure                                 */
 /*-------------------------------------------------------------------*/
@@ -30,6 +64,7 @@ struct ILOCK                    /* Hercules internal ILOCK structure */
     TIMEVAL      time;          /* Time of day when it was obtained  */
     TID          tid;           /* Thread-Id of who obtained it      */
     HLOCK        locklock;      /* Internal ILOCK structure lock     */
+    LOCKSTAT     stats;         /* Contention statistics             */
     union      {
     HLOCK        lock;          /* The actual locking model mutex    */
     HRWLOCK      rwlock;        /* The actual locking model rwlock   */
@@ -38,21 +73,22 @@ struct ILOCK                    /* Hercules internal ILOCK structure */
 typedef struct ILOCK ILOCK;     /* Shorter name for the same thing   */
 
 /*-------------------------------------------------------------------*/
-/* Internal PTT trace helper macros                                  */
+/* Internal PTT trace helper macro                                   */
 /*-------------------------------------------------------------------*/
 #define PTTRACE(_type,_data1,_data2,_loc,_result)                     \
   do {                                                                \
-    if (pttclass & PTT_CL_THR)                                        \
-      ptt_pthread_trace(PTT_CL_THR,                                   \
-        _type,_data1,_data2,_loc,_result,NULL);                       \
-  } while(0)
-#define PTTRACE2(_type,_data1,_data2,_loc,_result,_tv)                \
-  do {                                                                \
-    if (pttclass & PTT_CL_THR)                                        \
+    if ((PTT_CL_COMPILED & PTT_CL_THR) && (pttclass & PTT_CL_THR))    \
       ptt_pthread_trace(PTT_CL_THR,                                   \
-        _type,_data1,_data2,_loc,_result,_tv);                        \
+        _type,_data1,_data2,_loc,_result);                            \
   } while(0)
 
+/*-------------------------------------------------------------------*/
+/* Contended lock waits are only timed when someone will look at it  */
+/*-------------------------------------------------------------------*/
+#define LOCK_TIMING()           (lockstats || (pttclass & PTT_CL_THR))
+#define PTT_WAITDUR(_ticks)     ((void*)(uintptr_t)                   \
+                                ((_ticks) / lockclk_ticks_per_usec()))
+
 /*-------------------------------------------------------------------*/
 /* Default stack size for create_thread                              */
 /*-------------------------------------------------------------------*/
@@ -103,6 +139,10 @@ static int         herc_pri_rvrsd;  /* More negative is higher prio  */
 static int         host_low_pri;    /* Host policy minimim priority  */
 static int         host_pri_amt;    /* Host policy priority range    */
 static int         host_pri_rvrsd;  /* More negative is higher prio  */
+static BYTE        lockstats;       /* 'locks stats on' in effect    */
+static U64         lockclk_tick0;   /* Lock clock at initialization  */
+static U64         lockclk_usec0;   /* Time of day at initialization */
+static U64         lockclk_rate;    /* Lock clock ticks per usec     */
 
 /*-------------------------------------------------------------------*/
 /* Internal macros to control access to our internal locks list      */
@@ -110,6 +150,152 @@ static int         host_pri_rvrsd;  /* More negative is higher prio  */
 #define LockLocksList()         hthread_mutex_lock( &listlock )
 #define UnlockLocksList()       hthread_mutex_unlock( &listlock )
 
+/*-------------------------------------------------------------------*/
+/* Lock clock used to time contended lock waits                      */
+/*-------------------------------------------------------------------*/
+static INLINE U64 lockclk_usec()
+{
+    TIMEVAL tv;
+    gettimeofday( &tv, NULL );
+    return ((U64) tv.tv_sec * 1000000) + tv.tv_usec;
+}
+#if defined( ASSIST_RDTSC )
+  #define lockclk()             rdtsc()
+#else
+  #define lockclk()             lockclk_usec()
+#endif
+
+/*-------------------------------------------------------------------*/
+/* Return the number of lock clock ticks per microsecond.  The rate  */
+/* is calibrated against the time of day over the whole interval     */
+/* since initialization, and fixed once that exceeds one second.     */
+/*-------------------------------------------------------------------*/
+static U64 lockclk_ticks_per_usec()
+{
+    U64 ticks, usecs, rate;
+
+    if (lockclk_rate)
+        return lockclk_rate;
+
+    ticks = lockclk() - lockclk_tick0;
+    usecs = lockclk_usec() - lockclk_usec0;
+    rate  = usecs ? (ticks / usecs) : 0;
+
+    if (!rate)
+        return 1;
+    if (usecs >= 1000000)
+        lockclk_rate = rate;
+    return rate;
+}
+
+/*-------------------------------------------------------------------*/
+/* Record an acquisition in the lock's contention statistics         */
+/*-------------------------------------------------------------------*/
+static void lockstat_record( ILOCK* ilk, const char* location,
+                             U64 waitdur )
+{
+    LOCKSTAT*  ls = &ilk->stats;
+    LOCKSITE*  site;
+    LOCKSITE*  least;
+    U64        ticks;
+    int        i;
+
+    ls->acquired++;
+
+    if (!waitdur)
+        return;
+
+    ls->contended++;
+    ls->waittot += waitdur;
+    if (waitdur > ls->waitmax)
+        ls->waitmax = waitdur;
+
+    for (i=0, ticks = waitdur; ticks > 1 && i < LOCKSTAT_HIST-1; ticks >>= 1)
+        i++;
+    ls->hist[i]++;
+
+    /* Find this call site, a free slot, or the least waiting site */
+
+    least = site = &ls->site[0];
+    for (i=0; i < LOCKSTAT_SITES; i++, site++)
+    {
+        if (site->location == location || !site->location)
+            break;
+        if (site->wait < least->wait)
+            least = site;
+    }
+    if (i >= LOCKSTAT_SITES)
+        site = least;
+    if (site->location != location)
+    {
+        site->location = location;
+        site->count = 0;
+        site->wait = 0;
+    }
+    site->count++;
+    site->wait += waitdur;
+}
+
+/*-------------------------------------------------------------------*/
+/* Record the new owner of an exclusively obtained lock              */
+/*                                                                   */
+/* The owner fields are only written by the thread holding the lock  */
+/* and are only informational to everyone else, so no lock is needed */
+/* to update them.  The time of day it was obtained (and contention  */
+/* statistics) are only kept while lock statistics are enabled;      */
+/* otherwise the time is cleared, so that the locks command shows    */
+/* no time rather than that of some earlier acquisition.             */
+/*-------------------------------------------------------------------*/
+static INLINE void lock_obtained( ILOCK* ilk, const char* location,
+                                  U64 waitdur )
+{
+    ilk->location = location;
+    ilk->tid = hthread_self();
+    if (lockstats)
+    {
+        gettimeofday( &ilk->time, NULL );
+        lockstat_record( ilk, location, waitdur );
+    }
+    else
+    {
+        ilk->time.tv_sec  = 0;
+        ilk->time.tv_usec = 0;
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Record a shared (read) acquisition of a R/W lock.  Other readers  */
+/* may be doing the same, so the statistics are updated under the   */
+/* lock's internal locklock.  Readers are not recorded as owners.    */
+/*-------------------------------------------------------------------*/
+static void lock_rdobtained( ILOCK* ilk, const char* location,
+                             U64 waitdur )
+{
+    hthread_mutex_lock( &ilk->locklock );
+    lockstat_record( ilk, location, waitdur );
+    hthread_mutex_unlock( &ilk->locklock );
+}
+
+/*-------------------------------------------------------------------*/
+/* Record the release of an exclusively obtained lock                */
+/*-------------------------------------------------------------------*/
+static INLINE void lock_released( ILOCK* ilk )
+{
+    ilk->location = "null:0";
+    ilk->tid = 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Format the time of day a lock was obtained (hh:mm:ss.uuuuuu)      */
+/*-------------------------------------------------------------------*/
+static const char* locktod( const TIMEVAL* tv, char* tod, size_t size )
+{
+    if (!tv->tv_sec && !tv->tv_usec)
+        return "--:--:--.------";
+    FormatTIMEVAL( tv, tod, size );
+    return &tod[11];
+}
+
 /*-------------------------------------------------------------------*/
 /* Initialize internal locks list                                    */
 /*-------------------------------------------------------------------*/
@@ -164,6 +350,11 @@ static void hthreads_internal_init()
         host_pri_amt = host_pri_rvrsd ? (host_low_pri - host_high_pri)
                                       : (host_high_pri - host_low_pri);
 
+        /* Remember where the lock clock started for calibration */
+
+        lockclk_usec0 = lockclk_usec();
+        lockclk_tick0 = lockclk();
+
         /* One-time initialization completed */
 
         bDidInit = TRUE;
@@ -216,6 +407,7 @@ static ILOCK* hthreads_get_ILOCK( void* addr, const char* name )
     ilk->tid = 0;
     ilk->time.tv_sec = 0;
     ilk->time.tv_usec = 0;
+    memset( &ilk->stats, 0, sizeof( ilk->stats ));
 
     UnlockLocksList();
 
@@ -325,35 +517,27 @@ fatal:
 DLL_EXPORT int  hthread_obtain_lock( LOCK* plk, const char* location )
 {
     int rc;
-    U64 waitdur;
+    U64 waitdur = 0;
     ILOCK* ilk;
-    TIMEVAL tv;
     ilk = (ILOCK*) plk->ilk;
     PTTRACE( "lock before", plk, NULL, location, PTT_MAGIC );
     rc = hthread_mutex_trylock( &ilk->lock );
     if (EBUSY == rc)
     {
-        waitdur = host_tod();
-        rc = hthread_mutex_lock( &ilk->lock );
-        gettimeofday( &tv, NULL );
-        waitdur = host_tod() - waitdur;
-    }
-    else
-    {
-        gettimeofday( &tv, NULL );
-        waitdur = 0;
+        if (LOCK_TIMING())
+        {
+            waitdur = lockclk();
+            rc = hthread_mutex_lock( &ilk->lock );
+            waitdur = MAX( lockclk() - waitdur, 1 );
+        }
+        else
+            rc = hthread_mutex_lock( &ilk->lock );
     }
-    PTTRACE2( "lock after", plk, (void*) waitdur, location, rc, &tv );
+    PTTRACE( "lock after", plk, PTT_WAITDUR( waitdur ), location, rc );
     if (rc)
         loglock( ilk, rc, "obtain_lock", location );
     if (!rc || EOWNERDEAD == rc)
-    {
-        hthread_mutex_lock( &ilk->locklock );
-        ilk->location = location;
-        ilk->tid = hthread_self();
-        memcpy( &ilk->time, &tv, sizeof( TIMEVAL ));
-        hthread_mutex_unlock( &ilk->locklock );
-    }
+        lock_obtained( ilk, location, waitdur );
     return rc;
 }
 
@@ -365,14 +549,11 @@ DLL_EXPORT int  hthread_release_lock( LOCK* plk, const char* location )
     int rc;
     ILOCK* ilk;
     ilk = (ILOCK*) plk->ilk;
+    lock_released( ilk );
     rc = hthread_mutex_unlock( &ilk->lock );
     PTTRACE( "unlock", plk, NULL, location, rc );
     if (rc)
         loglock( ilk, rc, "release_lock", location );
-    hthread_mutex_lock( &ilk->locklock );
-    ilk->location = "null:0";
-    ilk->tid = 0;
-    hthread_mutex_unlock( &ilk->locklock );
     return rc;
 }
 
@@ -384,14 +565,11 @@ DLL_EXPORT int  hthread_release_rwlock( RWLOCK* plk, const char* location )
     int rc;
     ILOCK* ilk;
     ilk = (ILOCK*) plk->ilk;
+    lock_released( ilk );
     rc = hthread_rwlock_unlock( &ilk->rwlock );
     PTTRACE( "rwunlock", plk, NULL, location, rc );
     if (rc)
         loglock( ilk, rc, "release_rwlock", location );
-    hthread_mutex_lock( &ilk->locklock );
-    ilk->location = "null:0";
-    ilk->tid = 0;
-    hthread_mutex_unlock( &ilk->locklock );
     return rc;
 }
 
@@ -440,22 +618,14 @@ DLL_EXPORT int  hthread_try_obtain_lock( LOCK* plk, const char* location )
 {
     int rc;
     ILOCK* ilk;
-    TIMEVAL tv;
     ilk = (ILOCK*) plk->ilk;
     PTTRACE( "try before", plk, NULL, location, PTT_MAGIC );
     rc = hthread_mutex_trylock( &ilk->lock );
-    gettimeofday( &tv, NULL );
-    PTTRACE2( "try after", plk, NULL, location, rc, &tv );
+    PTTRACE( "try after", plk, NULL, location, rc );
     if (rc && EBUSY != rc)
         loglock( ilk, rc, "try_obtain_lock", location );
     if (!rc || EOWNERDEAD == rc)
-    {
-        hthread_mutex_lock( &ilk->locklock );
-        ilk->location = location;
-        ilk->tid = hthread_self();
-        memcpy( &ilk->time, &tv, sizeof( TIMEVAL ));
-        hthread_mutex_unlock( &ilk->locklock );
-    }
+        lock_obtained( ilk, location, 0 );
     return rc;
 }
 
@@ -481,22 +651,27 @@ DLL_EXPORT int  hthread_test_lock( LOCK* plk, const char* location )
 DLL_EXPORT int  hthread_obtain_rdlock( RWLOCK* plk, const char* location )
 {
     int rc;
-    U64 waitdur;
+    U64 waitdur = 0;
     ILOCK* ilk;
     ilk = (ILOCK*) plk->ilk;
     PTTRACE( "rdlock before", plk, NULL, location, PTT_MAGIC );
     rc = hthread_rwlock_tryrdlock( &ilk->rwlock );
     if (EBUSY == rc)
     {
-        waitdur = host_tod();
-        rc = hthread_rwlock_rdlock( &ilk->rwlock );
-        waitdur = host_tod() - waitdur;
+        if (LOCK_TIMING())
+        {
+            waitdur = lockclk();
+            rc = hthread_rwlock_rdlock( &ilk->rwlock );
+            waitdur = MAX( lockclk() - waitdur, 1 );
+        }
+        else
+            rc = hthread_rwlock_rdlock( &ilk->rwlock );
     }
-    else
-        waitdur = 0;
-    PTTRACE( "rdlock after", plk, (void*) waitdur, location, rc );
+    PTTRACE( "rdlock after", plk, PTT_WAITDUR( waitdur ), location, rc );
     if (rc)
         loglock( ilk, rc, "obtain_rdloc", location );
+    else if (lockstats)
+        lock_rdobtained( ilk, location, waitdur );
     return rc;
 }
 
@@ -506,35 +681,27 @@ DLL_EXPORT int  hthread_obtain_rdlock( RWLOCK* plk, const char* location )
 DLL_EXPORT int  hthread_obtain_wrlock( RWLOCK* plk, const char* location )
 {
     int rc;
-    U64 waitdur;
+    U64 waitdur = 0;
     ILOCK* ilk;
-    TIMEVAL tv;
     ilk = (ILOCK*) plk->ilk;
     PTTRACE( "wrlock before", plk, NULL, location, PTT_MAGIC );
     rc = hthread_rwlock_trywrlock( &ilk->rwlock );
     if (EBUSY == rc)
     {
-        waitdur = host_tod();
-        rc = hthread_rwlock_wrlock( &ilk->rwlock );
-        gettimeofday( &tv, NULL );
-        waitdur = host_tod() - waitdur;
-    }
-    else
-    {
-        gettimeofday( &tv, NULL );
-        waitdur = 0;
+        if (LOCK_TIMING())
+        {
+            waitdur = lockclk();
+            rc = hthread_rwlock_wrlock( &ilk->rwlock );
+            waitdur = MAX( lockclk() - waitdur, 1 );
+        }
+        else
+            rc = hthread_rwlock_wrlock( &ilk->rwlock );
     }
-    PTTRACE2( "wrlock after", plk, (void*) waitdur, location, rc, &tv );
+    PTTRACE( "wrlock after", plk, PTT_WAITDUR( waitdur ), location, rc );
     if (rc)
         loglock( ilk, rc, "obtain_wrlock", location );
     if (!rc || EOWNERDEAD == rc)
-    {
-        hthread_mutex_lock( &ilk->locklock );
-        ilk->location = location;
-        ilk->tid = hthread_self();
-        memcpy( &ilk->time, &tv, sizeof( TIMEVAL ));
-        hthread_mutex_unlock( &ilk->locklock );
-    }
+        lock_obtained( ilk, location, waitdur );
     return rc;
 }
 
@@ -551,6 +718,8 @@ DLL_EXPORT int  hthread_try_obtain_rdlock( RWLOCK* plk, const char* location )
     PTTRACE( "tryrd after", plk, NULL, location, rc );
     if (rc && EBUSY != rc)
         loglock( ilk, rc, "try_obtain_rdlock", location );
+    else if (!rc && lockstats)
+        lock_rdobtained( ilk, location, 0 );
     return rc;
 }
 
@@ -561,22 +730,14 @@ DLL_EXPORT int  hthread_try_obtain_wrlock( RWLOCK* plk, const char* location )
 {
     int rc;
     ILOCK* ilk;
-    TIMEVAL tv;
     ilk = (ILOCK*) plk->ilk;
     PTTRACE( "trywr before", plk, NULL, location, PTT_MAGIC );
     rc = hthread_rwlock_trywrlock( &ilk->rwlock );
-    gettimeofday( &tv, NULL );
-    PTTRACE2( "trywr after", plk, NULL, location, rc, &tv );
+    PTTRACE( "trywr after", plk, NULL, location, rc );
     if (rc && EBUSY != rc)
         loglock( ilk, rc, "try_obtain_wrlock", location );
     if (!rc)
-    {
-        hthread_mutex_lock( &ilk->locklock );
-        ilk->location = location;
-        ilk->tid = hthread_self();
-        memcpy( &ilk->time, &tv, sizeof( TIMEVAL ));
-        hthread_mutex_unlock( &ilk->locklock );
-    }
+        lock_obtained( ilk, location, 0 );
     return rc;
 }
 
@@ -744,20 +905,19 @@ static void hthread_list_abandoned_locks( TID tid, const char* exit_loc )
         if (hthread_equal(ilk->tid,tid))
         {
             char tod[27];           /* "YYYY-MM-DD HH:MM:SS.uuuuuu"  */
-
-            FormatTIMEVAL( &ilk->time, tod, sizeof( tod ));
+            const char* hms = locktod( &ilk->time, tod, sizeof( tod ));
 
             if (exit_loc)
             {
                 // "Thread "TIDPAT" has abandoned at %s lock %s obtained on %s at %s"
                 WRMSG( HHC90016, "E", tid, TRIMLOC( exit_loc ),
-                    ilk->name, &tod[11], TRIMLOC( ilk->location ));
+                    ilk->name, hms, TRIMLOC( ilk->location ));
             }
             else
             {
                 // "Thread "TIDPAT" has abandoned lock %s obtained on %s at %s"
                 WRMSG( HHC90015, "E", tid,
-                    ilk->name, &tod[11], TRIMLOC( ilk->location ));
+                    ilk->name, hms, TRIMLOC( ilk->location ));
             }
         }
     }
@@ -776,6 +936,7 @@ static void* hthread_func( void* arg2 )
     free( arg2 );
     rc = pfn( arg );
     hthread_list_abandoned_locks( tid, NULL );
+    ptt_thread_exit();
     return rc;
 }
 
@@ -852,6 +1013,7 @@ DLL_EXPORT void hthread_exit_thread( void* rc, const char* location )
     TID tid;
     tid = hthread_self();
     hthread_list_abandoned_locks( tid, location );
+    ptt_thread_exit();
     hthread_exit( rc );
 }
 
@@ -995,6 +1157,42 @@ DLL_EXPORT int  hthread_get_thread_prio( TID tid, const char* location )
     return herc_prio;
 }
 
+/*-------------------------------------------------------------------*/
+/* Bind a thread to a set of host processors  (HTHREADS function)    */
+/* An empty set lets the thread run on any host processor again.     */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT int  hthread_set_thread_affinity( TID tid, const HOSTCPUSET* set, const char* location )
+{
+#if defined( OPTION_THREAD_AFFINITY )
+    cpu_set_t  cpuset;
+    int        i, n = 0, rc;
+
+    CPU_ZERO( &cpuset );
+    for (i=0; i < MAX_HOST_CPUS && i < CPU_SETSIZE; i++)
+        if (HOSTCPU_ISSET( set, i ))
+        {
+            CPU_SET( i, &cpuset );
+            n++;
+        }
+    if (!n)
+        for (i=0; i < CPU_SETSIZE; i++)
+            CPU_SET( i, &cpuset );
+    if (equal_threads(tid,0))
+        tid = thread_id();
+    rc = pthread_setaffinity_np( (hthread_t)tid, sizeof( cpuset ), &cpuset );
+    if (rc != 0)
+        // "'%s' failed at loc=%s: rc=%d: %s"
+        WRMSG( HHC90020, "W", "set_thread_affinity",
+            TRIMLOC( location ), rc, strerror( rc ));
+    return rc;
+#else
+    UNREFERENCED( tid );
+    UNREFERENCED( set );
+    UNREFERENCED( location );
+    return ENOTSUP;
+#endif
+}
+
 /*-------------------------------------------------------------------*/
 /* locks_cmd helper function: save offline copy of all locks in list */
 /*-------------------------------------------------------------------*/
@@ -1047,6 +1245,126 @@ static int sortby_loc( const ILOCK* p1, const ILOCK* p2 )
     return strcasecmp( p1->location, p2->location );
 }
 
+/*-------------------------------------------------------------------*/
+/* locks stats sort function: most total wait time first             */
+/*-------------------------------------------------------------------*/
+static int sortby_wait( const ILOCK* p1, const ILOCK* p2 )
+{
+    if (p1->stats.waittot != p2->stats.waittot)
+        return (p1->stats.waittot < p2->stats.waittot) ? 1 : -1;
+    if (p1->stats.acquired != p2->stats.acquired)
+        return (p1->stats.acquired < p2->stats.acquired) ? 1 : -1;
+    return strcasecmp( p1->name, p2->name );
+}
+
+/*-------------------------------------------------------------------*/
+/* locks stats helper function: reset all lock statistics            */
+/*                                                                   */
+/* Statistics are updated without the list lock, so an acquisition   */
+/* racing with the reset may survive it; that is harmless.           */
+/*-------------------------------------------------------------------*/
+static void hthreads_reset_lock_stats()
+{
+    ILOCK*       ilk;               /* Pointer to ILOCK structure    */
+    LIST_ENTRY*  ple;               /* Ptr to LIST_ENTRY structure   */
+
+    LockLocksList();
+    for (ple = locklist.Flink; ple != &locklist; ple = ple->Flink)
+    {
+        ilk = CONTAINING_RECORD( ple, ILOCK, locklink );
+        memset( &ilk->stats, 0, sizeof( ilk->stats ));
+    }
+    UnlockLocksList();
+}
+
+/*-------------------------------------------------------------------*/
+/* locks stats - display or control lock contention statistics      */
+/*-------------------------------------------------------------------*/
+static int locks_stats_cmd( int argc, char* argv[] )
+{
+    ILOCK*       ilk;               /* Pointer to ILOCK array        */
+    LOCKSTAT*    ls;                /* Pointer to lock statistics    */
+    U64          rate;              /* Lock clock ticks per usec     */
+    int count, i, j;
+
+    /*  Format: "locks STATS [ON|OFF|RESET]"  */
+
+    if (argc > 3)
+    {
+        // "Missing or invalid argument(s)"
+        WRMSG( HHC17000, "E" );
+        return -1;
+    }
+
+    if (argc == 3)
+    {
+        if (strcasecmp( argv[2], "ON" ) == 0)
+            lockstats = TRUE;
+        else if (strcasecmp( argv[2], "OFF" ) == 0)
+            lockstats = FALSE;
+        else if (strcasecmp( argv[2], "RESET" ) == 0)
+            hthreads_reset_lock_stats();
+        else
+        {
+            // "Missing or invalid argument(s)"
+            WRMSG( HHC17000, "E" );
+            return -1;
+        }
+
+        // "Lock statistics are %s%s"
+        WRMSG( HHC02363, "I", lockstats ? "enabled" : "disabled",
+            strcasecmp( argv[2], "RESET" ) == 0 ? " and have been reset" : "" );
+        return 0;
+    }
+
+    // "Lock statistics are %s%s"
+    WRMSG( HHC02363, "I", lockstats ? "enabled" : "disabled", "" );
+
+    /* Retrieve a copy of the locks list, most waited for first */
+
+    if (!(count = hthreads_copy_locks_list( &ilk )))
+        return 0;
+
+    qsort( ilk, count, sizeof( ILOCK ), (CMPFUNC*) sortby_wait );
+    rate = lockclk_ticks_per_usec();
+
+    for (i=0; i < count; i++)
+    {
+        ls = &ilk[i].stats;
+
+        if (!ls->acquired)
+            continue;
+
+        // "%-24s acquired %12"I64_FMT"u, contended %12"I64_FMT"u (%3d%%), wait %10"I64_FMT"u us, max %8"I64_FMT"u us"
+        WRMSG( HHC02364, "I", ilk[i].name, ls->acquired, ls->contended,
+            (int)((ls->contended * 100) / ls->acquired),
+            ls->waittot / rate, ls->waitmax / rate );
+
+        if (!ls->contended)
+            continue;
+
+        for (j=0; j < LOCKSTAT_HIST; j++)
+        {
+            if (ls->hist[j])
+            {
+                // "  wait >= %10"I64_FMT"u ns %12u"
+                WRMSG( HHC02365, "I",
+                    j ? (((U64) 1 << j) * 1000) / rate : 0, ls->hist[j] );
+            }
+        }
+
+        for (j=0; j < LOCKSTAT_SITES && ls->site[j].location; j++)
+        {
+            // "  site %-32s contended %12"I64_FMT"u, wait %10"I64_FMT"u us"
+            WRMSG( HHC02366, "I", TRIMLOC( ls->site[j].location ),
+                ls->site[j].count, ls->site[j].wait / rate );
+        }
+    }
+
+    free( ilk );
+    return 0;
+}
+
 /*-------------------------------------------------------------------*/
 /* locks_cmd - list internal locks                                   */
 /*-------------------------------------------------------------------*/
@@ -1063,6 +1381,10 @@ DLL_EXPORT int locks_cmd( int argc, char* argv[], char* cmdline )
 
     /*  Format: "locks [ALL|tid|HELD] [SORT NAME|OWNER|TIME|LOC]"  */
     /*  Note:    TID is alias for OWNER,  TOD is alias for TIME.   */
+    /*     or:  "locks STATS [ON|OFF|RESET]"                        */
+
+    if (argc > 1 && strcasecmp( argv[1], "STATS" ) == 0)
+        return locks_stats_cmd( argc, argv );
 
     if (argc <= 1)
         tid = 0;
@@ -1127,9 +1449,10 @@ DLL_EXPORT int locks_cmd( int argc, char* argv[], char* cmdline )
                     )
                     {
                         c=1;
-                        FormatTIMEVAL( &ilk[i].time, tod, sizeof( tod ));
                         // "Lock=%s, tid="TIDPAT", tod=%s, loc=%s"
-                        WRMSG( HHC90017, "I", ilk[i].name, ilk[i].tid, &tod[11], TRIMLOC( ilk[i].location ));
+                        WRMSG( HHC90017, "I", ilk[i].name, ilk[i].tid,
+                            locktod( &ilk[i].time, tod, sizeof( tod )),
+                            TRIMLOC( ilk[i].location ));
                     }
                 }
 
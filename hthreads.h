@@ -250,6 +250,27 @@ struct RWLOCK
 };
 typedef struct RWLOCK RWLOCK;
 
+/*-------------------------------------------------------------------*/
+/*                    Host processor affinity                        */
+/*-------------------------------------------------------------------*/
+#if defined( HAVE_PTHREAD_SETAFFINITY_NP ) && !defined( OPTION_FTHREADS )
+  #define OPTION_THREAD_AFFINITY        /* Threads can be bound      */
+#endif
+
+#define MAX_HOST_CPUS       256         /* Host processors supported */
+
+typedef struct HOSTCPUSET               /* Set of host processors    */
+{
+    U64     bits[ MAX_HOST_CPUS / 64 ]; /* Bit n = host processor n  */
+}
+HOSTCPUSET;
+
+#define HOSTCPU_ZERO( _s )      memset( (_s), 0, sizeof( HOSTCPUSET ))
+#define HOSTCPU_SET( _s, _n )   ((_s)->bits[ (_n) >> 6 ] |= (1ULL << ((_n) & 63)))
+#define HOSTCPU_ISSET( _s, _n ) (((_s)->bits[ (_n) >> 6 ] >> ((_n) & 63)) & 1)
+#define HOSTCPU_EMPTY( _s )     (!((_s)->bits[0] | (_s)->bits[1] \
+                                 | (_s)->bits[2] | (_s)->bits[3]))
+
 /*-------------------------------------------------------------------*/
 /*                  hthreads exported functions                      */
 /*-------------------------------------------------------------------*/
@@ -293,6 +314,7 @@ HT_DLL_IMPORT HANDLE hthread_win_thread_handle    ( TID tid );
 #endif
 HT_DLL_IMPORT int  hthread_set_thread_prio        ( TID tid, int prio, const char* location );
 HT_DLL_IMPORT int  hthread_get_thread_prio        ( TID tid, const char* location );
+HT_DLL_IMPORT int  hthread_set_thread_affinity    ( TID tid, const HOSTCPUSET* set, const char* location );
 
 /*-------------------------------------------------------------------*/
 /*               Hercules threading/locking macros                   */
@@ -335,6 +357,7 @@ HT_DLL_IMPORT int  hthread_get_thread_prio        ( TID tid, const char* locatio
 #endif
 #define set_thread_priority( tid, prio )        hthread_set_thread_prio( (tid), (prio), PTT_LOC )
 #define get_thread_priority( tid )              hthread_get_thread_prio( (tid), PTT_LOC )
+#define set_thread_affinity( tid, set )         hthread_set_thread_affinity( (tid), (set), PTT_LOC )
 
 /*-------------------------------------------------------------------*/
 /*                         PTT Tracing                               */
@@ -44,6 +44,11 @@ typedef  uint16_t   U16;        // unsigned 16-bits
 typedef  uint32_t   U32;        // unsigned 32-bits
 typedef  uint64_t   U64;        // unsigned 64-bits
 
+#if defined( __SIZEOF_INT128__ )
+typedef  unsigned __int128  U128_T; // unsigned 128-bits
+#define  HAVE_U128_T                // host supports 128-bit integers
+#endif
+
 #ifndef  _MSVC_                 // (MSVC typedef's it too)
 typedef  uint8_t    BYTE;       // unsigned byte       (1 byte)
 #endif
@@ -699,6 +699,7 @@ int     rc;
     sysblk.pgminttr = OS_NONE;
 
     sysblk.timerint = DEF_TOD_UPDATE_USECS;
+    sysblk.hpollmax = DEF_HALT_POLL_USECS;
 
     /* set default thread priorities */
     sysblk.hercprio = DEFAULT_HERCPRIO;
@@ -766,9 +767,15 @@ int     rc;
     sysblk.zpbits  = DEF_CMPSC_ZP_BITS;
 #endif
 
+#if defined(_FEATURE_VECTOR_FACILITY)
+    sysblk.vsectsz = VECTOR_SECTION_SIZE;
+    sysblk.vfsimd  = VF_AVX2;
+#endif
+
     /* Initialize locks, conditions, and attributes */
     initialize_lock (&sysblk.config);
     initialize_lock (&sysblk.todlock);
+    initialize_condition (&sysblk.timercond);
     initialize_lock (&sysblk.mainlock);
     sysblk.mainowner = LOCK_OWNER_NONE;
     initialize_lock (&sysblk.intlock);
@@ -781,6 +788,9 @@ int     rc;
     initialize_lock (&sysblk.crwlock);
     initialize_lock (&sysblk.ioqlock);
     initialize_condition (&sysblk.ioqcond);
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    initialize_lock (&sysblk.txflock);
+#endif
 
 #ifdef FEATURE_MESSAGE_SECURITY_ASSIST_EXTENSION_3
     /* Initialize the wrapping key registers lock */
@@ -818,9 +828,11 @@ int     rc;
     /* Initialize the logmsg pipe and associated logger thread.
        This causes all subsequent logmsg's to be redirected to
        the logger facility for handling by virtue of stdout/stderr
-       being redirected to the logger facility.
+       being redirected to the logger facility.  Test mode always
+       has a logger so that the automatic operator can be tested.
     */
     if (!sysblk.daemon_mode
+        || sysblk.scrtest
 #if defined( EXTERNALGUI )
         || extgui
 #endif
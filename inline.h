@@ -26,6 +26,10 @@ _DAT_C_STATIC void ARCH_DEP(purge_alb) (REGS *regs);
 #endif
 _DAT_C_STATIC int ARCH_DEP(translate_addr) (VADR vaddr, int arn,
         REGS *regs, int acctype);
+#if defined(_FEATURE_SIE)
+_DAT_C_STATIC void ARCH_DEP(new_guest_tlbid) (REGS *regs);
+_DAT_C_STATIC void ARCH_DEP(purge_guest_tlb) (REGS *regs, int all);
+#endif
 _DAT_C_STATIC void ARCH_DEP(purge_tlb_all) ();
 _DAT_C_STATIC void ARCH_DEP(purge_tlb) (REGS *regs);
 _DAT_C_STATIC void ARCH_DEP(purge_tlbe_all) (RADR pfra);
@@ -46,7 +50,7 @@ _LOGICAL_C_STATIC BYTE *s390_logical_to_main (U32 addr, int arn, REGS *regs,
         int acctype, BYTE akey);
 _DAT_C_STATIC int s390_translate_addr (U32 vaddr, int arn, REGS *regs,
         int acctype);
-static inline U64 s390_apply_prefixing( U64 raddr, U64 px );
+static inline RADR s390_apply_prefixing( RADR raddr, RADR px );
 #endif /*defined(_FEATURE_SIE)*/
 
 #if defined(_FEATURE_ZSIE)
@@ -80,6 +80,8 @@ DEVBLK *dev;                            /* -> device block           */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -128,6 +130,8 @@ DEVBLK *dev;                            /* -> device block           */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -175,6 +179,8 @@ PMCW    pmcw;                           /* Path management ctl word  */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -319,6 +325,8 @@ BYTE    chpid;
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -350,6 +358,8 @@ DEVBLK *dev;                            /* -> device block           */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -397,6 +407,8 @@ VADR    effective_addr2;                /* Effective address         */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -420,6 +432,8 @@ VADR    effective_addr2;                /* Effective address         */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -502,6 +516,8 @@ ORB     orb;                            /* Operation request block   */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -610,6 +626,8 @@ static const BYTE msbn[256] = {         /* Most signif. bit# (0 - 7) */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -663,6 +681,8 @@ U32     crw;                            /* Channel Report Word       */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PTIO(IO,"STCRW");
 
     PRIV_CHECK(regs);
@@ -703,6 +723,8 @@ SCHIB   schib;                          /* Subchannel information blk*/
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -768,6 +790,8 @@ RADR    pfx;                            /* Prefix                    */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -876,6 +900,8 @@ int     cc;                             /* Condition Code            */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -940,6 +966,8 @@ DEVBLK *dev;                            /* -> device block           */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
 #if defined(_FEATURE_IO_ASSIST)
@@ -999,6 +1027,8 @@ BYTE    ccwkey;                         /* Bits 0-3=key, 4=suspend   */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
 #if defined(FEATURE_ECPSVM)
     if((inst[1])!=0x02)
     {
@@ -1081,6 +1111,8 @@ DEVBLK *dev;                            /* -> device block for SIO   */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -1123,6 +1155,8 @@ DEVBLK *dev;                            /* -> device block for SIO   */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -1160,6 +1194,8 @@ U16     tch_ctl;
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     PTIO(IO,"TCH");
@@ -1199,6 +1235,8 @@ VADR    effective_addr2;                /* Effective address         */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -1226,6 +1264,8 @@ int     i;
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
@@ -1292,6 +1332,8 @@ int     i;
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
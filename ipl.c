@@ -256,6 +256,9 @@ int ARCH_DEP(system_reset)
                 #if defined(_FEATURE_VECTOR_FACILITY)
                     memset (regs->vf->vr, 0, sizeof(regs->vf->vr));
                 #endif /*defined(_FEATURE_VECTOR_FACILITY)*/
+                #if defined(_FEATURE_ZVECTOR_FACILITY)
+                    memset (regs->vr, 0, sizeof(regs->vr));
+                #endif /*defined(_FEATURE_ZVECTOR_FACILITY)*/
 
                 /* Clear the instruction counter and CPU time used */
                 cpu_reset_instcount_and_cputime(regs);
@@ -581,6 +584,14 @@ int i, rc = 0;                          /* Array subscript           */
     /* Clear monitor code */
     regs->MC_G = 0;
 
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+    /* Leave transactional-execution mode */
+    if (regs->txf_tnd)
+        txf_release(regs);
+    regs->txf_tnd = 0;
+    regs->txf_npages = 0;
+#endif /*defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
     /* Purge the lookaside buffers */
     ARCH_DEP(purge_tlb) (regs);
 
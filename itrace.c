@@ -0,0 +1,401 @@
+/* ITRACE.C     Binary instruction trace                             */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This module manages the binary instruction trace file and         */
+/* implements the itrace command.  The records themselves are        */
+/* written by ARCH_DEP(itrace_inst) in hscmisc.c, called by each CPU */
+/* thread from process_trace and from program_interrupt.             */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#define _ITRACE_C_
+#define _HENGINE_DLL_
+
+#include "hercules.h"
+#include "itrace.h"
+
+ITRACE      itrace;                     /* Binary instruction trace  */
+static LOCK itrace_lock;                /* Serializes itrace_cmd and
+                                           itrace_freeze             */
+static int  itrace_inited = 0;          /* 1 = Locks initialized     */
+
+/*-------------------------------------------------------------------*/
+/* Write the trace to its file.  The mapped file is only flushed     */
+/* asynchronously; without mmap the whole buffer is written.         */
+/*-------------------------------------------------------------------*/
+static void itrace_sync( void )
+{
+#if !defined( _MSVC_ )
+    if (msync( itrace.map, itrace.mapsize, MS_ASYNC ) != 0)
+        WRMSG( HHC02369, "E", itrace.filename, "msync()", strerror( errno ));
+#else
+    if (0
+        || lseek( itrace.fd, 0, SEEK_SET ) < 0
+        || write( itrace.fd, itrace.map, (u_int) itrace.mapsize ) != (int) itrace.mapsize
+    )
+        WRMSG( HHC02369, "E", itrace.filename, "write()", strerror( errno ));
+#endif
+}
+
+/*-------------------------------------------------------------------*/
+/* Stop recording into the rings.  Once this returns no CPU thread   */
+/* is writing a record, and the CPUs are leaving their tracing path. */
+/* Caller holds itrace_lock; cpuad is the CPU whose thread is the    */
+/* caller, or -1 if it is not a CPU thread.                          */
+/*-------------------------------------------------------------------*/
+static void itrace_quiesce( int cause, int cpuad )
+{
+    ITRACE_HDR*  hdr = (ITRACE_HDR*) itrace.map;
+    REGS*        regs = cpuad < 0 ? NULL : sysblk.regs[ cpuad ];
+    U32          i;
+
+    itrace.frozen = 1;
+
+    /* Wait for any record in progress */
+    for (i=0; i < itrace.numcpu; i++)
+    {
+        obtain_lock( &itrace.cpu[i].lock );
+        release_lock( &itrace.cpu[i].lock );
+    }
+
+    /* Nothing more will be recorded, so take the CPUs off the slow
+       path: the interrupt makes each one reset its tracing flag and
+       invalidate its instruction address accelerator (aie) */
+    OBTAIN_INTLOCK( regs );
+    sysblk.itracing = 0;
+    SET_IC_TRACE;
+    RELEASE_INTLOCK( regs );
+
+    STORE_FW( hdr->frozen, cause );
+    STORE_FW( hdr->frzcpu, cpuad < 0 ? 0xFFFFFFFF : (U32) cpuad );
+    itrace_sync();
+}
+
+/*-------------------------------------------------------------------*/
+/* Switch the CPU threads into or out of their tracing path          */
+/*-------------------------------------------------------------------*/
+static void itrace_set( int on )
+{
+    OBTAIN_INTLOCK( NULL );
+    sysblk.itracing = on;
+    SET_IC_TRACE;
+    RELEASE_INTLOCK( NULL );
+}
+
+/*-------------------------------------------------------------------*/
+/* Stop the trace and close its file.  Caller holds itrace_lock.     */
+/*-------------------------------------------------------------------*/
+static void itrace_close( void )
+{
+    U32  i;
+
+    if (!itrace.map)
+        return;
+
+    if (!itrace.frozen)
+        itrace_quiesce( 0, -1 );
+
+    for (i=0; i < itrace.numcpu; i++)
+    {
+        obtain_lock( &itrace.cpu[i].lock );
+        itrace.cpu[i].ring  = NULL;
+        itrace.cpu[i].count = NULL;
+        release_lock( &itrace.cpu[i].lock );
+    }
+
+#if !defined( _MSVC_ )
+    munmap( itrace.map, itrace.mapsize );
+#else
+    free( itrace.map );
+#endif
+    close( itrace.fd );
+
+    itrace.map = NULL;
+    itrace.fd  = -1;
+}
+
+/*-------------------------------------------------------------------*/
+/* Create the trace file and start recording into it                 */
+/*-------------------------------------------------------------------*/
+static int itrace_open( const char* filename, U32 nrecs )
+{
+    ITRACE_HDR*     hdr;
+    ITRACE_CPUHDR*  cpuhdr;
+    BYTE*           map;
+    size_t          mapsize;
+    U32             numcpu = (U32) sysblk.maxcpu;
+    U32             i;
+    int             fd;
+    char            pathname[MAX_PATH];
+
+    mapsize = ITRACE_FILESIZE( numcpu, nrecs );
+
+    hostpath( pathname, filename, sizeof( pathname ));
+    fd = HOPEN( pathname, O_RDWR | O_CREAT | O_TRUNC | O_BINARY,
+                S_IRUSR | S_IWUSR | S_IRGRP );
+    if (fd < 0)
+    {
+        WRMSG( HHC02369, "E", filename, "open()", strerror( errno ));
+        return -1;
+    }
+
+#if !defined( _MSVC_ )
+    if (ftruncate( fd, (off_t) mapsize ) != 0)
+    {
+        WRMSG( HHC02369, "E", filename, "ftruncate()", strerror( errno ));
+        close( fd );
+        return -1;
+    }
+    map = mmap( NULL, mapsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    if (map == MAP_FAILED)
+    {
+        WRMSG( HHC02369, "E", filename, "mmap()", strerror( errno ));
+        close( fd );
+        return -1;
+    }
+#else
+    if (!(map = calloc( 1, mapsize )))
+    {
+        WRMSG( HHC02369, "E", filename, "calloc()", strerror( errno ));
+        close( fd );
+        return -1;
+    }
+#endif
+
+    hdr = (ITRACE_HDR*) map;
+    memcpy( hdr->magic, ITRACE_MAGIC, sizeof( hdr->magic ));
+    STORE_FW( hdr->numcpu, numcpu );
+    STORE_FW( hdr->nrecs,  nrecs );
+    STORE_FW( hdr->reclen, (U32) sizeof( ITRACE_REC ));
+    STORE_DW( hdr->tod,    host_tod());
+
+    strlcpy( itrace.filename, filename, sizeof( itrace.filename ));
+    itrace.map     = map;
+    itrace.mapsize = mapsize;
+    itrace.fd      = fd;
+    itrace.numcpu  = numcpu;
+    itrace.nrecs   = nrecs;
+
+    cpuhdr = (ITRACE_CPUHDR*)(map + sizeof( ITRACE_HDR ));
+    for (i=0; i < numcpu; i++, cpuhdr++)
+    {
+        STORE_HW( cpuhdr->cpuad, (U16) i );
+        memcpy( cpuhdr->ptyp, PTYPSTR( i ), sizeof( cpuhdr->ptyp ));
+
+        obtain_lock( &itrace.cpu[i].lock );
+        itrace.cpu[i].ring  = (ITRACE_REC*)(map + ITRACE_RINGOFF( numcpu ))
+                            + (size_t) i * nrecs;
+        itrace.cpu[i].count = cpuhdr->count;
+        itrace.cpu[i].next  = 0;
+        release_lock( &itrace.cpu[i].lock );
+    }
+
+    itrace.frozen = 0;
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Freeze the trace.  Called by a CPU thread whose record matched    */
+/* the freeze trigger.                                               */
+/*-------------------------------------------------------------------*/
+void itrace_freeze( int cpuad, int cause )
+{
+    obtain_lock( &itrace_lock );
+
+    /* Another CPU may have frozen or closed the trace meanwhile */
+    if (!itrace.map || itrace.frozen)
+    {
+        release_lock( &itrace_lock );
+        return;
+    }
+
+    itrace_quiesce( cause, cpuad );
+    release_lock( &itrace_lock );
+
+    // "Processor %s%02X: binary instruction trace frozen by %s"
+    WRMSG( HHC02368, "I", PTYPSTR( cpuad ), cpuad,
+           cause == ITRACE_FRZ_PGM ? "program check"
+                                   : "instruction address" );
+}
+
+/*-------------------------------------------------------------------*/
+/* Parse a freeze trigger: none, pgm, pgm:code or ia:address         */
+/*-------------------------------------------------------------------*/
+static int itrace_trigger( const char* trigger, int* freeze, U16* frzpgm, U64* frzia )
+{
+    U64   value;
+    char  c;
+
+    if (strcasecmp( trigger, "none" ) == 0)
+    {
+        *freeze = 0;
+        return 0;
+    }
+    if (strcasecmp( trigger, "pgm" ) == 0)
+    {
+        *freeze = ITRACE_FRZ_PGM;
+        *frzpgm = 0;
+        return 0;
+    }
+    if (strncasecmp( trigger, "pgm:", 4 ) == 0)
+    {
+        if (sscanf( trigger + 4, "%"SCNx64"%c", &value, &c ) != 1
+            || !value || value > 0xFFFF)
+            return -1;
+        *freeze = ITRACE_FRZ_PGM;
+        *frzpgm = (U16) value;
+        return 0;
+    }
+    if (strncasecmp( trigger, "ia:", 3 ) == 0)
+    {
+        if (sscanf( trigger + 3, "%"SCNx64"%c", &value, &c ) != 1)
+            return -1;
+        *freeze = ITRACE_FRZ_IA;
+        *frzia  = value;
+        return 0;
+    }
+    return -1;
+}
+
+/*-------------------------------------------------------------------*/
+/* Display the trace status                                          */
+/*-------------------------------------------------------------------*/
+static void itrace_status( void )
+{
+    char  trigger[32];
+    char  buf[MAX_PATH + 128];
+
+    if (!itrace.map)
+    {
+        // "Binary instruction trace is %s%s"
+        WRMSG( HHC02367, "I", "off", "" );
+        return;
+    }
+
+    if (itrace.freeze == ITRACE_FRZ_PGM && itrace.frzpgm)
+        MSGBUF( trigger, "pgm:%4.4X", itrace.frzpgm );
+    else if (itrace.freeze == ITRACE_FRZ_PGM)
+        strlcpy( trigger, "pgm", sizeof( trigger ));
+    else if (itrace.freeze == ITRACE_FRZ_IA)
+        MSGBUF( trigger, "ia:%"PRIX64, itrace.frzia );
+    else
+        strlcpy( trigger, "none", sizeof( trigger ));
+
+    MSGBUF( buf, ", file %s, %u records per processor, freeze=%s",
+            itrace.filename, itrace.nrecs, trigger );
+
+    // "Binary instruction trace is %s%s"
+    WRMSG( HHC02367, "I", itrace.frozen ? "frozen" : "on", buf );
+}
+
+/*-------------------------------------------------------------------*/
+/* itrace command                                                    */
+/*                                                                   */
+/*   itrace                     display the trace status             */
+/*   itrace file=name [records=n] [freeze=trigger]                   */
+/*                              start tracing into a new file        */
+/*   itrace freeze=trigger      change the freeze trigger            */
+/*   itrace freeze              freeze the trace now                 */
+/*   itrace off                 stop tracing and close the file      */
+/*-------------------------------------------------------------------*/
+int itrace_cmd( int argc, char* argv[], char* cmdline )
+{
+    char*  filename = NULL;
+    U32    nrecs    = ITRACE_DEFRECS;
+    int    freeze   = itrace.freeze;
+    U16    frzpgm   = itrace.frzpgm;
+    U64    frzia    = itrace.frzia;
+    int    off      = 0;
+    int    now      = 0;
+    int    rc       = 0;
+    int    i;
+    U64    value;
+    char   c;
+
+    UNREFERENCED( cmdline );
+
+    if (!itrace_inited)
+    {
+        initialize_lock( &itrace_lock );
+        for (i=0; i < MAX_CPU_ENGINES; i++)
+            initialize_lock( &itrace.cpu[i].lock );
+        itrace.fd = -1;
+        itrace_inited = 1;
+    }
+
+    for (i=1; i < argc; i++)
+    {
+        if (strncasecmp( argv[i], "file=", 5 ) == 0 && argv[i][5])
+            filename = argv[i] + 5;
+        else if (strncasecmp( argv[i], "records=", 8 ) == 0)
+        {
+            if (sscanf( argv[i] + 8, "%"SCNu64"%c", &value, &c ) != 1
+                || value < ITRACE_MINRECS || value > ITRACE_MAXRECS)
+            {
+                WRMSG( HHC02205, "E", argv[i], "" );
+                return -1;
+            }
+            /* Round up to a power of two */
+            for (nrecs = ITRACE_MINRECS; nrecs < value; nrecs <<= 1);
+        }
+        else if (strncasecmp( argv[i], "freeze=", 7 ) == 0)
+        {
+            if (itrace_trigger( argv[i] + 7, &freeze, &frzpgm, &frzia ) != 0)
+            {
+                WRMSG( HHC02205, "E", argv[i], "" );
+                return -1;
+            }
+        }
+        else if (strcasecmp( argv[i], "freeze" ) == 0 && argc == 2)
+            now = 1;
+        else if (strcasecmp( argv[i], "off" ) == 0 && argc == 2)
+            off = 1;
+        else
+        {
+            WRMSG( HHC02205, "E", argv[i], "" );
+            return -1;
+        }
+    }
+
+    obtain_lock( &itrace_lock );
+
+    if (off)
+    {
+        itrace_set( 0 );
+        itrace_close();
+    }
+    else if (now)
+    {
+        if (itrace.map && !itrace.frozen)
+            itrace_quiesce( ITRACE_FRZ_CMD, -1 );
+    }
+    else if (filename)
+    {
+        /* Triggers are armed before the first record is written */
+        itrace.freeze = freeze;
+        itrace.frzpgm = frzpgm;
+        itrace.frzia  = frzia;
+
+        itrace_close();
+        rc = itrace_open( filename, nrecs );
+        itrace_set( rc == 0 );
+    }
+    else if (argc > 1)
+    {
+        itrace.freeze = freeze;
+        itrace.frzpgm = frzpgm;
+        itrace.frzia  = frzia;
+    }
+
+    release_lock( &itrace_lock );
+
+    if (rc == 0)
+        itrace_status();
+
+    return rc;
+}
@@ -0,0 +1,136 @@
+/* ITRACE.H     Binary instruction trace                             */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* The binary instruction trace records every instruction executed   */
+/* by every CPU into a fixed size ring per CPU, held in a memory     */
+/* mapped file.  Nothing is formatted while the guest runs; the      */
+/* tracedump utility decodes the file afterwards.  The rings can be  */
+/* frozen by a trigger (a program check, or an instruction address)  */
+/* so that the file holds the instructions leading up to it.         */
+/*-------------------------------------------------------------------*/
+
+#ifndef _ITRACE_H_
+#define _ITRACE_H_
+
+/*-------------------------------------------------------------------*/
+/* Trace file layout.  The file is an ITRACE_HDR, followed by one    */
+/* ITRACE_CPUHDR for each CPU, followed by the ring of each CPU in   */
+/* turn.  Each ring holds 'nrecs' ITRACE_REC records; the record     */
+/* for sequence number n is at index (n % nrecs).  'count' is only   */
+/* advanced after a record is complete, so record 'count' may be in  */
+/* the middle of being written over the oldest one: a reader takes   */
+/* at most the newest nrecs - 1 records.  All numeric fields are     */
+/* big-endian.                                                       */
+/*-------------------------------------------------------------------*/
+#define ITRACE_MAGIC        "HITRACE1"  /* Trace file identifier     */
+
+#define ITRACE_DEFRECS      65536       /* Default records per CPU   */
+#define ITRACE_MINRECS      1024        /* Minimum records per CPU   */
+#define ITRACE_MAXRECS      (16*1024*1024) /* Maximum records per CPU*/
+
+struct ITRACE_HDR
+{
+    BYTE    magic[8];                   /* ITRACE_MAGIC              */
+    BYTE    numcpu[4];                  /* Number of CPU rings       */
+    BYTE    nrecs[4];                   /* Records per ring (2**n)   */
+    BYTE    reclen[4];                  /* Length of each record     */
+    BYTE    frozen[4];                  /* ITRACE_FRZ_xxx that froze
+                                           the trace, or zero        */
+    BYTE    frzcpu[4];                  /* CPU that froze the trace  */
+    BYTE    resv1[4];                   /* (reserved)                */
+    BYTE    tod[8];                     /* Host TOD at trace start   */
+    BYTE    resv2[24];                  /* (reserved)                */
+};
+typedef struct ITRACE_HDR ITRACE_HDR;
+
+struct ITRACE_CPUHDR
+{
+    BYTE    count[8];                   /* Records written to ring   */
+    BYTE    cpuad[2];                   /* CPU address               */
+    char    ptyp[2];                    /* Processor type ("CP" etc) */
+    BYTE    resv[4];                    /* (reserved)                */
+};
+typedef struct ITRACE_CPUHDR ITRACE_CPUHDR;
+
+#define ITRACE_INST         1           /* Instruction executed      */
+#define ITRACE_PGM          2           /* Program interruption      */
+
+#define ITRACE_SIE          0x80        /* Flags: CPU in SIE mode    */
+#define ITRACE_REAL         0x40        /* Flags: DAT is off         */
+#define ITRACE_NOINST       0x20        /* Flags: instruction fetch
+                                           failed, inst is not valid */
+
+#define ITRACE_NOREG        0xFF        /* b1/b2: no storage operand */
+
+struct ITRACE_REC
+{
+    BYTE    type;                       /* ITRACE_INST, ITRACE_PGM   */
+    BYTE    arch;                       /* Architecture mode         */
+    BYTE    ilc;                        /* Instruction length        */
+    BYTE    flags;                      /* ITRACE_SIE etc            */
+    BYTE    pcode[2];                   /* Program interruption code */
+    BYTE    grmask[2];                  /* GPRs changed since the
+                                           previous record (bit 0
+                                           is GPR 0)                 */
+    BYTE    seq[8];                     /* Sequence number           */
+    BYTE    tod[8];                     /* Host TOD (host_tod)       */
+    BYTE    psw[16];                    /* Current PSW               */
+    BYTE    inst[6];                    /* Instruction               */
+    BYTE    b1;                         /* Operand 1 base register   */
+    BYTE    b2;                         /* Operand 2 base register   */
+    BYTE    addr1[8];                   /* Operand 1 address         */
+    BYTE    addr2[8];                   /* Operand 2 address         */
+    BYTE    gr[16][8];                  /* General registers         */
+};
+typedef struct ITRACE_REC ITRACE_REC;
+
+#define ITRACE_FRZ_CMD      1           /* Frozen by itrace command  */
+#define ITRACE_FRZ_PGM      2           /* Frozen by program check   */
+#define ITRACE_FRZ_IA       3           /* Frozen by instr address   */
+
+#define ITRACE_RINGOFF(_numcpu) \
+    (sizeof(ITRACE_HDR) + (_numcpu) * sizeof(ITRACE_CPUHDR))
+
+#define ITRACE_FILESIZE(_numcpu, _nrecs) \
+    (ITRACE_RINGOFF(_numcpu) + (size_t)(_numcpu) * (_nrecs) * sizeof(ITRACE_REC))
+
+/*-------------------------------------------------------------------*/
+/* Recording state, only used by the emulator itself                 */
+/*-------------------------------------------------------------------*/
+struct ITRACE_CPU
+{
+    LOCK        lock;                   /* Held while recording      */
+    ITRACE_REC* ring;                   /* -> Ring of this CPU       */
+    BYTE*       count;                  /* -> Count in trace file    */
+    U64         next;                   /* Next sequence number      */
+    U64         gr[16];                 /* GPRs of previous record   */
+};
+typedef struct ITRACE_CPU ITRACE_CPU;
+
+struct ITRACE
+{
+    BYTE*       map;                    /* -> Trace file contents    */
+    size_t      mapsize;                /* Size of the trace file    */
+    int         fd;                     /* Trace file descriptor     */
+    U32         numcpu;                 /* Number of CPU rings       */
+    U32         nrecs;                  /* Records per ring          */
+    int         freeze;                 /* ITRACE_FRZ_xxx trigger    */
+    U16         frzpgm;                 /* Program check code, or 0
+                                           for any program check     */
+    U64         frzia;                  /* Instruction address       */
+    volatile int frozen;                /* 1 = Recording has stopped */
+    char        filename[MAX_PATH];     /* Trace file name           */
+    ITRACE_CPU  cpu[MAX_CPU_ENGINES];   /* Per-CPU recording state   */
+};
+typedef struct ITRACE ITRACE;
+
+extern ITRACE itrace;
+
+void itrace_freeze( int cpuad, int cause );
+int  itrace_cmd( int argc, char* argv[], char* cmdline );
+
+#endif /* _ITRACE_H_ */
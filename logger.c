@@ -44,6 +44,63 @@ static FILE *logger_hrdcpy;             /* Hardcopy log or zero      */
 static int   logger_hrdcpyfd;           /* Hardcopt fd or -1         */
 static char  logger_filename[MAX_PATH];
 
+/*********************************************************************/
+/* Message ring buffer                                               */
+/*********************************************************************/
+/* Messages are passed from the threads that issue them to the       */
+/* logger thread through a lock-free multi-producer ring buffer.     */
+/* A producer reserves a slot by advancing logger_ringhead with a    */
+/* compare and swap, copies its message into the slot and then       */
+/* publishes the slot by storing the message length into the slot    */
+/* header.  The logger thread consumes published slots in order,     */
+/* clears them and advances logger_ringtail.  A producer never       */
+/* waits: when the ring is full its message is discarded and         */
+/* counted, and the logger thread reports how many messages were     */
+/* discarded once it has caught up.  Output written directly to      */
+/* stdout (e.g. by printf) is still captured through the syslog      */
+/* pipe.                                                             */
+/*********************************************************************/
+
+typedef struct LOGREC
+{
+    U32     len;                /* Message length, LOGREC_PAD, or    */
+                                /* zero while not yet published      */
+    U32     tod;                /* Time message was issued (seconds) */
+}
+LOGREC;
+
+#define LOGREC_PAD      0x80000000      /* Unused slot up to ring end */
+#define LOGREC_MAXLEN   16384           /* Longer messages are split  */
+#define LOGREC_SPAN(_len) \
+    ((U32)((sizeof( LOGREC ) + (_len) + 7) & ~7))
+
+static BYTE         *logger_ring;       /* Message ring buffer       */
+static volatile U32  logger_ringhead;   /* Next position to reserve  */
+static volatile U32  logger_ringtail;   /* Next position to consume  */
+static volatile U32  logger_dropped;    /* Messages discarded        */
+static          U32  logger_reported;   /* Discards reported so far  */
+static volatile U32  logger_waiting;    /* Logger thread is waiting  */
+static int           logger_wakefd[2];  /* Logger thread wakeup pipe */
+
+       int   logger_notifyfd[2];        /* New messages notification */
+static LOCK  logger_notify_lock;        /*   pipe, lock and flag     */
+static int   logger_notified;           /*   (see log_notify_reset)  */
+
+static int   logger_nextmsg;            /* Where next msg is copied  */
+static int   logger_needstamp = 1;      /* Next line needs timestamp */
+
+/* Hardcopy data not yet written, written with a single writev()     */
+#define LOG_IOV_MAX     64
+#if defined( HAVE_SYS_UIO_H )
+typedef struct iovec    LOGIOV;
+#else
+typedef struct { void* iov_base; size_t iov_len; } LOGIOV;
+#endif
+static LOGIOV  logger_iov[ LOG_IOV_MAX ];
+static int     logger_iovcnt;
+static char    logger_stamp[10];        /* "HH:MM:SS " timestamp     */
+static U32     logger_stamptod;         /* Time logger_stamp is for  */
+
 
 /*********************************************************************/
 /*              log_read  -  read system log                         */
@@ -297,10 +354,9 @@ static void logger_logfile_write( void* pBuff, size_t nBytes )
 }
 
 /* ZZ FIXME:
- * This should really be part of logmsg, as the timestamps have currently
- * the time when the logger reads the message from the log pipe.  There can be
- * quite a delay at times when there is a high system activity. Moving the timestamp
- * to logmsg() will fix this.
+ * Messages passed through the message ring are timestamped with the time
+ * they were issued, but data captured from the stdout pipe still gets the
+ * time when the logger reads it from the pipe.
  * The timestamp option should also NOT depend on anything like daemon mode.
  * log entries should always be timestamped, in a fixed format, such that
  * log readers may decide to skip the timestamp when displaying (ie panel.c).
@@ -329,143 +385,418 @@ DLL_EXPORT void logger_timestamped_logfile_write( void* pBuff, size_t nBytes )
     }
 }
 
-static void* logger_thread(void *arg)
+/*-------------------------------------------------------------------*/
+/* Atomically add to a ring counter; returns its previous value      */
+/*-------------------------------------------------------------------*/
+static INLINE U32 logger_atomic_add( volatile U32* p, U32 n )
 {
-int bytes_read;
+    U32 old = *p;
+    while (cmpxchg4( &old, old + n, (void*) p ));
+    return old;
+}
 
-    UNREFERENCED(arg);
+/*-------------------------------------------------------------------*/
+/* Fetch the header of the ring slot at 'pos'.  The compare and swap */
+/* orders the fetch after the producer's publication of the slot.    */
+/*-------------------------------------------------------------------*/
+static INLINE U32 logger_ring_peek( U32 pos )
+{
+    U32 len = 0;
+    cmpxchg4( &len, 0, logger_ring + (pos & (LOG_RINGSIZE - 1)) );
+    return len;
+}
 
-    /* Set device thread priority; ignore any errors */
-    set_thread_priority(0, sysblk.devprio);
+/*-------------------------------------------------------------------*/
+/* Copy one message into the ring, or count it if there is no room   */
+/*-------------------------------------------------------------------*/
+static void logger_ring_put( const char* msg, U32 len, U32 tod )
+{
+    LOGREC*  rec;
+    U32      head, tail, off, pad, span, zero;
 
-#if !defined( _MSVC_ )
-    logger_redirect();
-#endif
+    span = LOGREC_SPAN( len );
 
-    setvbuf (stdout, NULL, _IONBF, 0);
+    /* Reserve the slot, plus padding if it would wrap the ring */
+    do
+    {
+        tail = logger_ringtail;
+        head = logger_ringhead;
+        off  = head & (LOG_RINGSIZE - 1);
+        pad  = (off + span > LOG_RINGSIZE) ? (LOG_RINGSIZE - off) : 0;
 
-    obtain_lock(&logger_lock);
+        if (head + pad + span - tail > LOG_RINGSIZE)
+        {
+            logger_atomic_add( &logger_dropped, 1 );
+            return;
+        }
+    }
+    while (cmpxchg4( &head, head + pad + span, (void*) &logger_ringhead ));
 
-    logger_active = 1;
+    if (pad)
+    {
+        zero = 0;
+        cmpxchg4( &zero, LOGREC_PAD, logger_ring + off );
+        off = 0;
+    }
 
-    /* Signal initialization complete */
-    signal_condition(&logger_cond);
+    /* Fill in the slot, then publish it */
+    rec = (LOGREC*)(logger_ring + off);
+    rec->tod = tod;
+    memcpy( rec + 1, msg, len );
 
-    release_lock(&logger_lock);
+    zero = 0;
+    cmpxchg4( &zero, len, &rec->len );
+}
 
-    /* ZZ FIXME:  We must empty the read pipe before we terminate */
-    /* (Couldn't we just loop waiting for a 'select(,&readset,,,timeout)'
-        to return zero?? Or use the 'poll' function similarly?? - Fish) */
+/*-------------------------------------------------------------------*/
+/* Wake up the logger thread if it is waiting for messages           */
+/*-------------------------------------------------------------------*/
+static void logger_ring_wake()
+{
+    U32   one = 1;
+    BYTE  c   = 0;
 
-    while(logger_active)
+    if (logger_waiting && !cmpxchg4( &one, 0, (void*) &logger_waiting ))
+        VERIFY( write_pipe( logger_wakefd[ LOG_WRITE ], &c, 1 ) == 1 );
+}
+
+/*-------------------------------------------------------------------*/
+/* Queue a message for the logger thread without ever blocking.      */
+/* Returns -1 if the logger is not active, otherwise 0 (even if the  */
+/* message had to be discarded because the ring was full).           */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT int logger_ring_write( const char* msg, size_t len )
+{
+    U32  tod, n;
+
+    if (!logger_active || !logger_ring)
+        return -1;
+
+    tod = (U32) time( NULL );
+
+    for (; len; msg += n, len -= n)
     {
-        bytes_read = read_pipe(logger_syslogfd[LOG_READ],logger_buffer + logger_currmsg,
-          ((logger_bufsize - logger_currmsg) > LOG_DEFSIZE ? LOG_DEFSIZE : logger_bufsize - logger_currmsg));
+        n = (U32)(len > LOGREC_MAXLEN ? LOGREC_MAXLEN : len);
+        logger_ring_put( msg, n, tod );
+    }
 
-        if (bytes_read == 0)    /* Has pipe been closed? */
-            break;              /* Yes, then we are done */
+    logger_ring_wake();
+    return 0;
+}
 
-        if (bytes_read < 0)
-        {
-            int read_pipe_errno = HSO_errno;
+/*-------------------------------------------------------------------*/
+/* Write the pending hardcopy data using as few writes as possible   */
+/*-------------------------------------------------------------------*/
+static void logger_hrdcpy_flush()
+{
+    LOGIOV*  iov = logger_iov;
+    int      cnt = logger_iovcnt;
 
-            /* Ignore any/all errors during shutdown */
-            if (sysblk.shutdown)
-                continue;
+    logger_iovcnt = 0;
 
-            if (HSO_EINTR == read_pipe_errno)
-                continue;
+    if (!logger_hrdcpy)
+        return;
 
-            obtain_lock(&logger_lock);
-            if(logger_hrdcpy)
-            {
-                // "Logger: error in function %s: %s"
-                fprintf(logger_hrdcpy, MSG(HHC02102, "E", "read_pipe()",
-                                        strerror(read_pipe_errno)));
-            }
-            release_lock(&logger_lock);
+#if defined( HAVE_SYS_UIO_H )
+    while (cnt)
+    {
+        ssize_t n = writev( fileno( logger_hrdcpy ), iov, cnt );
 
-            bytes_read = 0;
+        if (n < 0)
+        {
+            if (EINTR == errno)
+                continue;
+            // "Logger: error in function %s: %s"
+            fprintf(logger_hrdcpy, MSG(HHC02102, "E", "writev()",
+                strerror(errno)));
+            break;
         }
 
-        /* If Hercules is not running in daemon mode and panel
-           initialization is not yet complete, write message
-           to stderr so the user can see it on the terminal */
-        if (!sysblk.daemon_mode)
-        {
-            if (!sysblk.panel_init)
-            {
-                char* pLeft2 = logger_buffer + logger_currmsg;
-                int   nLeft2 = bytes_read;
+        /* Skip whatever was written and retry the remainder */
+        for (; cnt && (size_t) n >= iov->iov_len; iov++, cnt--)
+            n -= iov->iov_len;
 
-                /* (ignore any errors; we did the best we could) */
-                if (nLeft2)
-                    fwrite( pLeft2, nLeft2, 1, stderr );
-            }
+        if (cnt)
+        {
+            iov->iov_base = (char*) iov->iov_base + n;
+            iov->iov_len -= n;
         }
+    }
+#else
+    for (; cnt; iov++, cnt--)
+        logger_logfile_write( iov->iov_base, iov->iov_len );
+#endif
+}
 
-        obtain_lock(&logger_lock);
+static void logger_hrdcpy_add( void* base, size_t len )
+{
+    if (logger_iovcnt >= LOG_IOV_MAX)
+        logger_hrdcpy_flush();
 
-        /* Write log data to hardcopy file */
-        if (logger_hrdcpy)
-        {
-            /* Need to prefix each line with a timestamp. */
+    logger_iov[ logger_iovcnt ].iov_base = base;
+    logger_iov[ logger_iovcnt ].iov_len  = len;
+    logger_iovcnt++;
+}
+
+/*-------------------------------------------------------------------*/
+/* Queue log data for the hardcopy file, prefixing each line with a  */
+/* timestamp of the time 'tod' the data was issued                   */
+/*-------------------------------------------------------------------*/
+static void logger_hrdcpy_write( char* data, int len, U32 tod )
+{
+    char*   pNL;
+    int     n;
+    time_t  tt;
 
-            static int needstamp = 1;
-            char*  pLeft  = logger_buffer + logger_currmsg;
-            int    nLeft  = bytes_read;
-            char*  pRight = NULL;
-            int    nRight = 0;
-            char*  pNL    = NULL;   /* (pointer to NEWLINE character) */
+    if (!logger_hrdcpy)
+        return;
 
-            if (needstamp)
+    while (len)
+    {
+        if (logger_needstamp)
+        {
+            if (!sysblk.logoptnotime && !sysblk.daemon_mode)
             {
-                if (!sysblk.logoptnotime)
-                    logger_logfile_timestamp();
-                needstamp = 0;
+                if (tod != logger_stamptod)
+                {
+                    /* (pending data may refer to the old timestamp) */
+                    logger_hrdcpy_flush();
+                    tt = (time_t) tod;
+                    strlcpy( logger_stamp, ctime( &tt ) + 11, sizeof( logger_stamp ));
+                    logger_stamptod = tod;
+                }
+                logger_hrdcpy_add( logger_stamp, strlen( logger_stamp ));
             }
+            logger_needstamp = 0;
+        }
 
-            while ( (pNL = memchr( pLeft, '\n', nLeft )) != NULL )
-            {
-                pRight  = pNL + 1;
-                nRight  = nLeft - (int)(pRight - pLeft);
-                nLeft  -= nRight;
+        if ((pNL = memchr( data, '\n', len )) != NULL)
+        {
+            n = (int)(pNL + 1 - data);
+            logger_needstamp = 1;
+        }
+        else
+            n = len;
 
-                if (nLeft)
-                    logger_logfile_write( pLeft, nLeft );
+        logger_hrdcpy_add( data, n );
+        data += n;
+        len  -= n;
+    }
+}
 
-                pLeft = pRight;
-                nLeft = nRight;
+/*-------------------------------------------------------------------*/
+/* Append log data to the message buffer and to the hardcopy file.   */
+/* Called by the logger thread with logger_lock held.                */
+/*-------------------------------------------------------------------*/
+static void logger_append( const char* data, int len, U32 tod )
+{
+    int n;
 
-                if (!nLeft)
-                {
-                    needstamp = 1;
-                    break;
-                }
+    /* If Hercules is not running in daemon mode and panel
+       initialization is not yet complete, write message
+       to stderr so the user can see it on the terminal */
+    if (!sysblk.daemon_mode && !sysblk.panel_init)
+        fwrite( data, len, 1, stderr );
 
-                if (!sysblk.logoptnotime)
-                    logger_logfile_timestamp();
-            }
+    while (len)
+    {
+        n = logger_bufsize - logger_nextmsg;
+        if (n > len)
+            n = len;
 
-            if (nLeft)
-                logger_logfile_write( pLeft, nLeft );
-        }
+        memcpy( logger_buffer + logger_nextmsg, data, n );
+        logger_hrdcpy_write( logger_buffer + logger_nextmsg, n, tod );
 
-        release_lock(&logger_lock);
+        data += n;
+        len  -= n;
 
-        /* Increment buffer index to next available position */
-        logger_currmsg += bytes_read;
-        if(logger_currmsg >= logger_bufsize)
+        if ((logger_nextmsg += n) >= logger_bufsize)
         {
-            logger_currmsg = 0;
+            /* Write out what refers to the buffer before reusing it */
+            logger_hrdcpy_flush();
+            logger_nextmsg = 0;
             logger_wrapped = 1;
         }
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Make the appended log data available.  Called with logger_lock.   */
+/*-------------------------------------------------------------------*/
+static void logger_publish()
+{
+    logger_hrdcpy_flush();
+
+    if (logger_currmsg != logger_nextmsg)
+    {
+        logger_currmsg = logger_nextmsg;
 
         /* Notify all interested parties new log data is available */
+        broadcast_condition( &logger_cond );
+        SEND_PIPE_SIGNAL( logger_notifyfd[ LOG_WRITE ], logger_notify_lock, logger_notified );
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Move published messages from the ring to the message buffer and   */
+/* give their slots back to the producers.  Called with logger_lock. */
+/* Returns the number of ring bytes consumed.                        */
+/*-------------------------------------------------------------------*/
+static U32 logger_ring_drain()
+{
+    LOGREC*  rec;
+    U32      start, tail, len, off, span, dropped;
+    char     buf[80];
+
+    start = tail = logger_ringtail;
+
+    /* (slots are given back after at most a quarter of the ring) */
+    while (tail - start < LOG_RINGSIZE / 4
+        && (len = logger_ring_peek( tail )) != 0)
+    {
+        off = tail & (LOG_RINGSIZE - 1);
+        rec = (LOGREC*)(logger_ring + off);
+
+        if (len & LOGREC_PAD)
+            span = LOG_RINGSIZE - off;
+        else
+        {
+            span = LOGREC_SPAN( len );
+            logger_append( (char*)(rec + 1), (int) len, rec->tod );
+        }
+
+        memset( rec, 0, span );
+        tail += span;
+    }
+
+    if (tail != start)
+    {
+        U32 old = start;
+        cmpxchg4( &old, tail, (void*) &logger_ringtail );
+    }
+
+    /* Report any messages discarded while the ring was full */
+    if ((dropped = logger_dropped) != logger_reported)
+    {
+        // "Logger: %u messages discarded, message ring buffer full"
+        MSGBUF( buf, MSG( HHC02107, "W", dropped - logger_reported ));
+        logger_append( buf, (int) strlen( buf ), (U32) time( NULL ));
+        logger_reported = dropped;
+    }
+
+    return tail - start;
+}
+
+/*-------------------------------------------------------------------*/
+/* Wait until a message is published or data is written to stdout,   */
+/* or just poll if 'block' is zero, and then take in any stdout      */
+/* data.  Returns -1 when the syslog pipe has been closed.           */
+/*-------------------------------------------------------------------*/
+static int logger_wait( int block )
+{
+    static char     pipebuf[ LOGREC_MAXLEN ];
+    fd_set          readset;
+    struct timeval  tv;
+    int             maxfd, rc;
+    U32             zero = 0;
+    char            c[16];
+
+    if (block)
+    {
+        /* Ask the producers for a wakeup, then look again in case
+           a message was published before they could see our request */
+        cmpxchg4( &zero, 1, (void*) &logger_waiting );
+        if (logger_ring_peek( logger_ringtail ))
+            block = 0;
+    }
+
+    FD_ZERO( &readset );
+    FD_SET( logger_syslogfd[ LOG_READ ], &readset );
+    FD_SET( logger_wakefd[ LOG_READ ], &readset );
+    maxfd = MAX( logger_syslogfd[ LOG_READ ], logger_wakefd[ LOG_READ ] );
+
+    tv.tv_sec  = block ? 1 : 0;
+    tv.tv_usec = 0;
+
+    rc = select( maxfd + 1, &readset, NULL, NULL, &tv );
+
+    logger_waiting = 0;
+
+    if (rc <= 0)
+        return 0;
+
+    if (FD_ISSET( logger_wakefd[ LOG_READ ], &readset ))
+        read_pipe( logger_wakefd[ LOG_READ ], c, sizeof( c ));
+
+    if (!FD_ISSET( logger_syslogfd[ LOG_READ ], &readset ))
+        return 0;
+
+    rc = read_pipe( logger_syslogfd[ LOG_READ ], pipebuf, sizeof( pipebuf ));
+
+    if (rc == 0)            /* Has pipe been closed? */
+        return -1;          /* Yes, then we are done */
+
+    obtain_lock( &logger_lock );
+
+    if (rc < 0)
+    {
+        int read_pipe_errno = HSO_errno;
+
+        /* Ignore any/all errors during shutdown */
+        if (!sysblk.shutdown && HSO_EINTR != read_pipe_errno && logger_hrdcpy)
+        {
+            // "Logger: error in function %s: %s"
+            fprintf(logger_hrdcpy, MSG(HHC02102, "E", "read_pipe()",
+                                    strerror(read_pipe_errno)));
+        }
+        rc = 0;
+    }
+    else
+    {
+        logger_append( pipebuf, rc, (U32) time( NULL ));
+        logger_publish();
+    }
+
+    release_lock( &logger_lock );
+
+    return rc;
+}
+
+static void* logger_thread(void *arg)
+{
+U32 consumed;
+
+    UNREFERENCED(arg);
+
+    /* Set device thread priority; ignore any errors */
+    set_thread_priority(0, sysblk.devprio);
+
+#if !defined( _MSVC_ )
+    logger_redirect();
+#endif
+
+    setvbuf (stdout, NULL, _IONBF, 0);
+
+    obtain_lock(&logger_lock);
+
+    logger_active = 1;
+
+    /* Signal initialization complete */
+    signal_condition(&logger_cond);
+
+    release_lock(&logger_lock);
+
+    while(logger_active)
+    {
         obtain_lock(&logger_lock);
-        broadcast_condition(&logger_cond);
+        if ((consumed = logger_ring_drain()))
+            logger_publish();
         release_lock(&logger_lock);
 
+        /* Only wait for more when the ring has been emptied */
+        if (logger_wait( !consumed ) < 0)
+            break;
+
     } /* end while(logger_active) */
 
     logger_active = 0;
@@ -474,6 +805,10 @@ int bytes_read;
     /* Logger is now terminating */
     obtain_lock(&logger_lock);
 
+    /* Empty the ring before we terminate */
+    while (logger_ring_drain());
+    logger_publish();
+
     /* Write final message to hardcopy file */
     if (logger_hrdcpy)
     {
@@ -502,6 +837,7 @@ DLL_EXPORT void logger_init(void)
 
     initialize_condition (&logger_cond);
     initialize_lock (&logger_lock);
+    initialize_lock (&logger_notify_lock);
     logger_init_flg = TRUE;
 
     obtain_lock(&logger_lock);
@@ -589,7 +925,18 @@ DLL_EXPORT void logger_init(void)
         exit(1);
     }
 
-    if(create_pipe(logger_syslogfd))
+    if(!(logger_ring = calloc(1, LOG_RINGSIZE)))
+    {
+        char buf[40];
+        MSGBUF(buf, "calloc(%d)", LOG_RINGSIZE);
+        // "Logger: error in function %s: %s"
+        fprintf(stderr, MSG(HHC02102, "E", buf, strerror(errno)));
+        exit(1);
+    }
+
+    if(create_pipe(logger_syslogfd)
+    || create_pipe(logger_wakefd)
+    || create_pipe(logger_notifyfd))
     {
         // "Logger: error in function %s: %s"
         fprintf(stderr, MSG(HHC02102, "E", "create_pipe()", strerror(errno)));
@@ -721,9 +1068,20 @@ DLL_EXPORT void log_wakeup(void *arg)
         obtain_lock(&logger_lock);
         broadcast_condition(&logger_cond);
         release_lock(&logger_lock);
+
+        logger_ring_wake();
     }
 }
 
+/* log_notify_reset - Acknowledge a new messages notification.       */
+/* The logger_notifyfd read end becomes readable whenever new log    */
+/* data has been made available; call this once it has been seen.   */
+DLL_EXPORT void log_notify_reset(void)
+{
+    if ( logger_init_flg )
+        RECV_PIPE_SIGNAL( logger_notifyfd[LOG_READ], logger_notify_lock, logger_notified );
+}
+
 /* is logger active */
 DLL_EXPORT int logger_isactive()
 {
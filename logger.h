@@ -28,6 +28,7 @@
 #define LOG_WRITE 1
 
 extern int logger_syslogfd[2];
+extern int logger_notifyfd[2];
 
 #define LOG_NOBLOCK 0
 #define LOG_BLOCK   1
@@ -45,6 +46,16 @@ extern int logger_syslogfd[2];
 #endif
 #endif
 
+/* Size of the message ring buffer; must be a power of two */
+#if !defined(LOG_RINGSIZE)
+ #define LOG_RINGSIZE 262144
+#else
+#if LOG_RINGSIZE < 65536
+#undef LOG_RINGSIZE
+#define LOG_RINGSIZE 65536
+#endif
+#endif
+
 /* Logging functions in logmsg.c */
 
 LOG_DLL_IMPORT void  logmsg(          char *fmt, ... ) ATTR_PRINTF(1,2);
@@ -65,6 +76,8 @@ LOGR_DLL_IMPORT int log_read( char** msg, int* msgidx, int block );
 LOGR_DLL_IMPORT int log_line(int linenumber);
 LOGR_DLL_IMPORT void log_sethrdcpy(char *filename);
 LOGR_DLL_IMPORT void log_wakeup(void *arg);
+LOGR_DLL_IMPORT void log_notify_reset(void);
+LOGR_DLL_IMPORT int  logger_ring_write( const char* msg, size_t len );
 LOGR_DLL_IMPORT char *log_dsphrdcpy();
 LOGR_DLL_IMPORT int logger_isactive();
 LOGR_DLL_IMPORT void  logger_timestamped_logfile_write( void* pBuff, size_t nBytes );
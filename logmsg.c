@@ -417,8 +417,6 @@ static void vfwritemsg( FILE* f, const char* filename, int line, const char* fun
   #ifdef NEED_LOGMSG_FFLUSH
     fflush( f );
   #endif
-
-    log_wakeup( NULL );
 }
 
 DLL_EXPORT void writemsg( const char* filename, int line, const char* func, const char* fmt, ... )
@@ -440,18 +438,16 @@ DLL_EXPORT void fwritemsg( FILE* f, const char* filename, int line, const char*
 /*-------------------------------------------------------------------*/
 static void _flog_write_pipe( FILE* f, char* msg )
 {
-    /* Send message through logger facility pipe to panel.c,
+    /* Send message through logger facility ring to panel.c,
        or display it directly to the terminal via fprintf
        if this is a utility message or we're shutting down
-       or we're otherwise unable to send it through the pipe.
+       or we're otherwise unable to send it through the ring.
     */
-    int rc = 0;
     int len = (int) strlen( msg );
     if (0
         || sysblk.shutdown
         || stdout != f
-        || !logger_syslogfd[ LOG_WRITE ]
-        || (rc = write_pipe( logger_syslogfd[ LOG_WRITE ], msg, len )) < 0
+        || logger_ring_write( msg, len ) < 0
     )
     {
         fprintf( f, "%s", msg );   /* (write msg to screen) */
@@ -478,20 +474,20 @@ static void _flog_write_pipe( FILE* f, char* msg )
 /*-------------------------------------------------------------------*/
 /* The "log_write" function is the function responsible for either   */
 /* sending a formatted message through the Hercules logger facilty   */
-/* pipe (handled by logger.c) to panel.c for display to the user,    */
+/* ring (handled by logger.c) to panel.c for display to the user,    */
 /* or for printing the message directly to the terminal screen (in   */
 /* the case of utilities).                                           */
 /*                                                                   */
 /* 'msg' is the formatted message to be displayed. 'panel' tells     */
 /* where the message should be sent: the value '1' (normal) sends    */
-/* the message through the logger facility pipe only (for display    */
+/* the message through the logger facility ring only (for display    */
 /* to the user via panel.c). Messages written using panel=1 can      */
 /* never be captured. (See log message capturing functions further   */
 /* above). using panel=2 allows a message to be displayed to the     */
-/* user AND be captured as well. (It's sent through the logger pipe  */
+/* user AND be captured as well. (It's sent through the logger ring  */
 /* to panel.c AND is captured too.) The value '0' is used when you   */
 /* ONLY want to silently capture a message WITHOUT displaying it to  */
-/* the user. Such messages are NEVER sent through the logger pipe    */
+/* the user. Such messages are NEVER sent through the logger ring    */
 /* and thus never reach panel.c                                      */
 /*                                                                   */
 /* SUMMARY: panel=0: capture only, 1=panel only, 2=panel and capture */
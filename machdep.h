@@ -373,6 +373,28 @@ __asm__ __volatile__ (
            "m" (*(U64 *)ptr));
 }
 
+#define rdtsc() rdtsc_i686()
+static __inline__ U64 rdtsc_i686(void) {
+ U64 tsc;
+ __asm__ __volatile__ (
+         "rdtsc"
+         : "=A"(tsc));
+ return tsc;
+}
+
+/* rdtsc_serial: rdtsc that is not executed ahead of earlier loads */
+#define rdtsc_serial() rdtsc_serial_i686()
+static __inline__ U64 rdtsc_serial_i686(void) {
+ U64 tsc;
+ __asm__ __volatile__ (
+         "lfence\n\t"
+         "rdtsc"
+         : "=A"(tsc)
+         :
+         : "memory");
+ return tsc;
+}
+
 #endif /* defined(_ext_ia32) */
 
 /*-------------------------------------------------------------------
@@ -428,6 +450,28 @@ static __inline__ BYTE cmpxchg8_amd64(U64 *old, U64 new, void *ptr) {
  return code;
 }
 
+#define rdtsc() rdtsc_amd64()
+static __inline__ U64 rdtsc_amd64(void) {
+ U32 lo, hi;
+ __asm__ __volatile__ (
+         "rdtsc"
+         : "=a"(lo), "=d"(hi));
+ return ((U64)hi << 32) | lo;
+}
+
+/* rdtsc_serial: rdtsc that is not executed ahead of earlier loads */
+#define rdtsc_serial() rdtsc_serial_amd64()
+static __inline__ U64 rdtsc_serial_amd64(void) {
+ U32 lo, hi;
+ __asm__ __volatile__ (
+         "lfence\n\t"
+         "rdtsc"
+         : "=a"(lo), "=d"(hi)
+         :
+         : "memory");
+ return ((U64)hi << 32) | lo;
+}
+
 #endif /* defined(_ext_amd64) */
 
 /*-------------------------------------------------------------------
@@ -560,6 +604,10 @@ U32  *ptr4, val4, old4, new4;
  #define ASSIST_CMPXCHG16
 #endif
 
+#if defined(rdtsc)
+ #define ASSIST_RDTSC
+#endif
+
 #if defined(fetch_dw) || defined(fetch_dw_noswap)
  #define ASSIST_FETCH_DW
 #endif
@@ -202,7 +202,8 @@ Examples:
        "          hao cmd <cmd> : define command for previously defined rule\n" \
        "          hao list <n>  : list all rules/commands or only at index <n>\n" \
        "          hao del <n>   : delete the rule at index <n>\n" \
-       "          hao clear     : delete all rules (stops automatic operator)"
+       "          hao clear     : delete all rules (stops automatic operator)\n" \
+       "          hao stats     : display match statistics of all rules"
 #define HHC00071 "The %s was not added because table is full; table size is %02d"
 #define HHC00072 "The command %s given, but the command %s was expected"
 #define HHC00073 "Empty %s specified"
@@ -222,8 +223,9 @@ Examples:
 #define HHC00087 "The defined Hercules Automatic Operator rule(s) are:"
 #define HHC00088 "Index %02d: target %s -> command %s"
 #define HHC00089 "The are no HAO rules defined"
+#define HHC00090 "Index %02d: matched %"I64_FMT"u, checked %"I64_FMT"u, skipped %"I64_FMT"u, regexec %"I64_FMT"u us, prefilter %s"
 
-// reserve 90-99 for hao.c
+// reserve 91-99 for hao.c
 
 #define HHC00100 "Thread id "TIDPAT", prio %2d, name %s started"
 #define HHC00101 "Thread id "TIDPAT", prio %2d, name %s ended"
@@ -1202,6 +1204,7 @@ Examples:
 #define HHC02104 "Logger: log switched to %s"
 #define HHC02105 "Logger: log to %s"
 #define HHC02106 "Logger: log switched off"
+#define HHC02107 "Logger: %u messages discarded, message ring buffer full"
 
 #define HHC02197 "Symbol name %s is reserved"
 //         02198 (moved to config.c)
@@ -1355,8 +1358,27 @@ Examples:
 #define HHC02344 "%s device %1d:%04X group has registered MAC address %s"
 #define HHC02345 "%s device %1d:%04X group has registered IP address %s"
 #define HHC02346 "%s device %1d:%04X group has no registered MAC or IP addresses"
-
-// range 02350 - 02369 available
+#define HHC02350 "SIE statistics for %d CPU(s): %"I64_FMT"u entries, storage definition reused %"I64_FMT"u, guest TLB resumed %"I64_FMT"u"
+#define HHC02351 "%-52s %12"I64_FMT"u exits, average %8"I64_FMT"u usec"
+#define HHC02352 "  usec%s"
+#define HHC02353 "No SIE statistics"
+
+#define HHC02354 "Program interruptions: %"I64_FMT"u, presented on the fast path %"I64_FMT"u"
+#define HHC02355 "  %4.4X %-44s %12"I64_FMT"u"
+#define HHC02356 "MVS assist counts for %d CPU(s):"
+#define HHC02357 "  E5%2.2X %-28s %12"I64_FMT"u performed %12"I64_FMT"u to software (%3d%%)"
+#define HHC02358 "Invariant TSC clock source is not available on this host"
+#define HHC02359 "Processor %s%02X: halt-poll window %4"I64_FMT"u us, %12"I64_FMT"u polls ended, %12"I64_FMT"u sleeps (%3d%%)"
+#define HHC02360 "Host processor affinity%s:"
+#define HHC02361 "  %-16s host processors %s"
+#define HHC02362 "Host processor affinity is not supported on this host"
+#define HHC02363 "Lock statistics are %s%s"
+#define HHC02364 "%-24s acquired %12"I64_FMT"u, contended %12"I64_FMT"u (%3d%%), wait %10"I64_FMT"u us, max %8"I64_FMT"u us"
+#define HHC02365 "  wait >= %10"I64_FMT"u ns %12u"
+#define HHC02366 "  site %-32s contended %12"I64_FMT"u, wait %10"I64_FMT"u us"
+#define HHC02367 "Binary instruction trace is %s%s"
+#define HHC02368 "Processor %s%02X: binary instruction trace frozen by %s"
+#define HHC02369 "Binary instruction trace file %s: error in function %s: %s"
 
 #define HHC02370 "%1d:%04X CU or LCU %s conflicts with existing CUNUM %04X SSID %04X CU/LCU %s"
 #define HHC02371 "%1d:%04X Adding device exceeds CU and/or LCU device limits"
@@ -1894,7 +1916,18 @@ Examples:
 #define HHC02915 "%s COMM: Connection received"
 //efine HHC02916 - HHC02949 (available)
 
-// range 02950 - 02999 available
+// range 02950 - 02959 prof.c
+#define HHC02950 "Profiler is %s%s"
+#define HHC02951 "Profile of %"I64_FMT"u samples, %"I64_FMT"u in wait state, %"I64_FMT"u lost (table full), %u entries"
+#define HHC02952 "%5.1f%% %12"I64_FMT"u %s %s %s"
+#define HHC02953 "%5.1f%% %12"I64_FMT"u %s-%s %s"
+#define HHC02954 "Profiler map file %s: %d symbols loaded"
+#define HHC02955 "Profiler map file %s line %d: invalid entry ignored"
+#define HHC02956 "Profiler file %s: %u folded stacks written"
+#define HHC02957 "Profiler file %s: error in function %s: %s"
+//efine HHC02958 - HHC02959 (available)
+
+// range 02960 - 02999 available
 // range 03000 - 03099 available
 // range 03100 - 03199 available
 // range 03200 - 03299 available
@@ -2114,6 +2147,8 @@ Examples:
 #define HHC90019 "No locks found for thread "TIDPAT"."
 #define HHC90020 "'%s' failed at loc=%s: rc=%d: %s"
 #define HHC90021 "%-18s %s "TIDPAT" %-18s "PTR_FMTx" "PTR_FMTx" %s"
+#define HHC90022 "Pttrace: %d entries written to %s"
+#define HHC90023 "Pttrace: error writing dump file %s: %s"
 
 
 /* from crypto/dyncrypt.c when compiled with debug on */
@@ -471,6 +471,32 @@ DISABLE_GCC_UNUSED_FUNCTION_WARNING
 #endif /*!defined(FEATURE_MISC_INSTRUCTION_EXTENSIONS_FACILITY)*/
 
 #if !defined(FEATURE_VECTOR_FACILITY)
+ UNDEF_INST(v_load)
+ UNDEF_INST(v_store)
+ UNDEF_INST(v_add)
+ UNDEF_INST(v_subtract)
+ UNDEF_INST(v_and)
+ UNDEF_INST(v_or)
+ UNDEF_INST(v_exclusive_or)
+ UNDEF_INST(v_compare)
+ UNDEF_INST(v_add_qst)
+ UNDEF_INST(v_subtract_qst)
+ UNDEF_INST(v_and_qst)
+ UNDEF_INST(v_or_qst)
+ UNDEF_INST(v_exclusive_or_qst)
+ UNDEF_INST(v_compare_qst)
+ UNDEF_INST(v_add_vv)
+ UNDEF_INST(v_subtract_vv)
+ UNDEF_INST(v_and_vv)
+ UNDEF_INST(v_or_vv)
+ UNDEF_INST(v_exclusive_or_vv)
+ UNDEF_INST(v_compare_vv)
+ UNDEF_INST(v_add_qv)
+ UNDEF_INST(v_subtract_qv)
+ UNDEF_INST(v_and_qv)
+ UNDEF_INST(v_or_qv)
+ UNDEF_INST(v_exclusive_or_qv)
+ UNDEF_INST(v_compare_qv)
  UNDEF_INST(v_test_vmr)
  UNDEF_INST(v_complement_vmr)
  UNDEF_INST(v_count_left_zeros_in_vmr)
@@ -1197,6 +1223,105 @@ DISABLE_GCC_UNUSED_FUNCTION_WARNING
  UNDEF_INST(perform_processor_assist)
 #endif
 
+#if !defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)        /*EC12*/
+ UNDEF_INST(transaction_begin)
+ UNDEF_INST(transaction_begin_constrained)
+ UNDEF_INST(transaction_end)
+ UNDEF_INST(transaction_abort)
+ UNDEF_INST(extract_transaction_nesting_depth)
+ UNDEF_INST(nontransactional_store)
+#endif /*!defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/  /*EC12*/
+
+#if !defined(FEATURE_ZVECTOR_FACILITY)                         /*z13*/
+ UNDEF_INST(vector_load_element_8)
+ UNDEF_INST(vector_load_element_16)
+ UNDEF_INST(vector_load_element_64)
+ UNDEF_INST(vector_load_element_32)
+ UNDEF_INST(vector_load_logical_element_and_zero)
+ UNDEF_INST(vector_load_and_replicate)
+ UNDEF_INST(vector_load)
+ UNDEF_INST(vector_load_to_block_boundary)
+ UNDEF_INST(vector_store_element_8)
+ UNDEF_INST(vector_store_element_16)
+ UNDEF_INST(vector_store_element_64)
+ UNDEF_INST(vector_store_element_32)
+ UNDEF_INST(vector_store)
+ UNDEF_INST(vector_load_gr_from_vr_element)
+ UNDEF_INST(vector_load_vr_element_from_gr)
+ UNDEF_INST(load_count_to_block_boundary)
+ UNDEF_INST(vector_element_shift_left)
+ UNDEF_INST(vector_element_rotate_left_logical)
+ UNDEF_INST(vector_load_multiple)
+ UNDEF_INST(vector_load_with_length)
+ UNDEF_INST(vector_element_shift_right_logical)
+ UNDEF_INST(vector_element_shift_right_arithmetic)
+ UNDEF_INST(vector_store_multiple)
+ UNDEF_INST(vector_store_with_length)
+ UNDEF_INST(vector_load_element_immediate_8)
+ UNDEF_INST(vector_load_element_immediate_16)
+ UNDEF_INST(vector_load_element_immediate_64)
+ UNDEF_INST(vector_load_element_immediate_32)
+ UNDEF_INST(vector_generate_byte_mask)
+ UNDEF_INST(vector_replicate_immediate)
+ UNDEF_INST(vector_generate_mask)
+ UNDEF_INST(vector_replicate)
+ UNDEF_INST(vector_population_count)
+ UNDEF_INST(vector_count_trailing_zeros)
+ UNDEF_INST(vector_count_leading_zeros)
+ UNDEF_INST(vector_load_vector)
+ UNDEF_INST(vector_isolate_string)
+ UNDEF_INST(vector_sign_extend_to_doubleword)
+ UNDEF_INST(vector_merge_low)
+ UNDEF_INST(vector_merge_high)
+ UNDEF_INST(vector_load_vr_from_grs_disjoint)
+ UNDEF_INST(vector_sum_across_word)
+ UNDEF_INST(vector_sum_across_doubleword)
+ UNDEF_INST(vector_sum_across_quadword)
+ UNDEF_INST(vector_and)
+ UNDEF_INST(vector_and_with_complement)
+ UNDEF_INST(vector_or)
+ UNDEF_INST(vector_nor)
+ UNDEF_INST(vector_exclusive_or)
+ UNDEF_INST(vector_element_shift_left_vector)
+ UNDEF_INST(vector_element_rotate_left_logical_vector)
+ UNDEF_INST(vector_shift_left)
+ UNDEF_INST(vector_shift_left_by_byte)
+ UNDEF_INST(vector_shift_left_double_by_byte)
+ UNDEF_INST(vector_element_shift_right_logical_vector)
+ UNDEF_INST(vector_element_shift_right_arithmetic_vector)
+ UNDEF_INST(vector_shift_right_logical)
+ UNDEF_INST(vector_shift_right_logical_by_byte)
+ UNDEF_INST(vector_shift_right_arithmetic)
+ UNDEF_INST(vector_shift_right_arithmetic_by_byte)
+ UNDEF_INST(vector_find_element_equal)
+ UNDEF_INST(vector_find_element_not_equal)
+ UNDEF_INST(vector_find_any_element_equal)
+ UNDEF_INST(vector_permute_doubleword_immediate)
+ UNDEF_INST(vector_string_range_compare)
+ UNDEF_INST(vector_permute)
+ UNDEF_INST(vector_select)
+ UNDEF_INST(vector_pack)
+ UNDEF_INST(vector_multiply_low)
+ UNDEF_INST(vector_unpack_logical_low)
+ UNDEF_INST(vector_unpack_logical_high)
+ UNDEF_INST(vector_unpack_low)
+ UNDEF_INST(vector_unpack_high)
+ UNDEF_INST(vector_test_under_mask)
+ UNDEF_INST(vector_load_complement)
+ UNDEF_INST(vector_load_positive)
+ UNDEF_INST(vector_average_logical)
+ UNDEF_INST(vector_average)
+ UNDEF_INST(vector_add)
+ UNDEF_INST(vector_subtract)
+ UNDEF_INST(vector_compare_equal)
+ UNDEF_INST(vector_compare_high_logical)
+ UNDEF_INST(vector_compare_high)
+ UNDEF_INST(vector_minimum_logical)
+ UNDEF_INST(vector_maximum_logical)
+ UNDEF_INST(vector_minimum)
+ UNDEF_INST(vector_maximum)
+#endif /*!defined(FEATURE_ZVECTOR_FACILITY)*/                  /*z13*/
+
 
 /* The following execute_xxxx routines can be optimized by the
    compiler to an indexed jump, leaving the stack frame untouched
@@ -1216,6 +1341,11 @@ DEF_INST(E3_0)
 }
 #endif /* #ifdef OPTION_OPTINST */
 
+DEF_INST(execute_opcode_e7________xx)
+{
+  regs->ARCH_DEP(runtime_opcode_e7________xx)[inst[5]](inst, regs);
+}
+
 DEF_INST(execute_opcode_eb________xx)
 {
   regs->ARCH_DEP(runtime_opcode_eb________xx)[inst[5]](inst, regs);
@@ -1276,6 +1406,7 @@ static zz_func opcode_cc_x[0x10][GEN_MAXARCH];                      /*810*/
 static zz_func opcode_e3xx[0x100][GEN_MAXARCH];
 static zz_func opcode_e5xx[0x100][GEN_MAXARCH];
 static zz_func opcode_e6xx[0x100][GEN_MAXARCH];
+static zz_func opcode_e7xx[0x100][GEN_MAXARCH];                      /*z13*/
 static zz_func opcode_ebxx[0x100][GEN_MAXARCH];
 static zz_func opcode_ecxx[0x100][GEN_MAXARCH];
 static zz_func opcode_edxx[0x100][GEN_MAXARCH];
@@ -1332,6 +1463,7 @@ DISASM_ROUTE(cc_x,[1] & 0x0F)                                   /*810*/
 DISASM_ROUTE(e3xx,[5])
 DISASM_ROUTE(e5xx,[1])
 DISASM_ROUTE(e6xx,[1])
+DISASM_ROUTE(e7xx,[5])                                          /*z13*/
 DISASM_ROUTE(ebxx,[5])
 DISASM_ROUTE(ecxx,[5])
 DISASM_ROUTE(edxx,[5])
@@ -1825,12 +1957,139 @@ int d2,b2;
     d2 = (inst[2] & 0x0F) << 8 | inst[3];
     DISASM_PRINT("%d(%d)",d2,b2)
 
+/* z/Architecture vector formats: RXB supplies each V field's 5th bit */
+#define DISASM_RXB(_n) (((inst[4] >> (3 - (_n))) & 1) << 4)
+
+DISASM_TYPE(VRR_A);
+int v1,v2,m3,m4,m5;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    m5 = inst[3] >> 4;
+    m4 = inst[3] & 0x0F;
+    m3 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d,%d",v1,v2,m3,m4,m5)
+
+DISASM_TYPE(VRR_B);
+int v1,v2,v3,m4,m5;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    v3 = (inst[2] >> 4) | DISASM_RXB(2);
+    m5 = inst[3] >> 4;
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d,%d",v1,v2,v3,m4,m5)
+
+DISASM_TYPE(VRR_C);
+int v1,v2,v3,m4,m5,m6;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    v3 = (inst[2] >> 4) | DISASM_RXB(2);
+    m6 = inst[3] >> 4;
+    m5 = inst[3] & 0x0F;
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d,%d,%d",v1,v2,v3,m4,m5,m6)
+
+DISASM_TYPE(VRR_D);
+int v1,v2,v3,v4,m5,m6;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    v3 = (inst[2] >> 4) | DISASM_RXB(2);
+    m5 = inst[2] & 0x0F;
+    m6 = inst[3] >> 4;
+    v4 = (inst[4] >> 4) | DISASM_RXB(3);
+    DISASM_PRINT("%d,%d,%d,%d,%d,%d",v1,v2,v3,v4,m5,m6)
+
+DISASM_TYPE(VRR_E);
+int v1,v2,v3,v4,m5,m6;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    v3 = (inst[2] >> 4) | DISASM_RXB(2);
+    m6 = inst[2] & 0x0F;
+    m5 = inst[3] & 0x0F;
+    v4 = (inst[4] >> 4) | DISASM_RXB(3);
+    DISASM_PRINT("%d,%d,%d,%d,%d,%d",v1,v2,v3,v4,m5,m6)
+
+DISASM_TYPE(VRR_F);
+int v1,r2,r3;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    r2 = inst[1] & 0x0F;
+    r3 = inst[2] >> 4;
+    DISASM_PRINT("%d,%d,%d",v1,r2,r3)
+
+DISASM_TYPE(VRI_A);
+int v1,i2,m3;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    i2 = (S16)((inst[2] << 8) | inst[3]);
+    m3 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d",v1,i2,m3)
+
+DISASM_TYPE(VRI_B);
+int v1,i2,i3,m4;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    i2 = inst[2];
+    i3 = inst[3];
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d",v1,i2,i3,m4)
+
+DISASM_TYPE(VRI_C);
+int v1,v3,i2,m4;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v3 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    i2 = (inst[2] << 8) | inst[3];
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d",v1,v3,i2,m4)
+
+DISASM_TYPE(VRI_D);
+int v1,v2,v3,i4,m5;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v2 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    v3 = (inst[2] >> 4) | DISASM_RXB(2);
+    i4 = inst[3];
+    m5 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d,%d,%d",v1,v2,v3,i4,m5)
+
+DISASM_TYPE(VRS_A);
+int v1,v3,b2,d2,m4;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    v3 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    b2 = inst[2] >> 4;
+    d2 = (inst[2] & 0x0F) << 8 | inst[3];
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d(%d),%d",v1,v3,d2,b2,m4)
+
+DISASM_TYPE(VRS_B);
+int v1,r3,b2,d2,m4;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    r3 = inst[1] & 0x0F;
+    b2 = inst[2] >> 4;
+    d2 = (inst[2] & 0x0F) << 8 | inst[3];
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d(%d),%d",v1,r3,d2,b2,m4)
+
+DISASM_TYPE(VRS_C);
+int r1,v3,b2,d2,m4;
+    r1 = inst[1] >> 4;
+    v3 = (inst[1] & 0x0F) | DISASM_RXB(1);
+    b2 = inst[2] >> 4;
+    d2 = (inst[2] & 0x0F) << 8 | inst[3];
+    m4 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d,%d(%d),%d",r1,v3,d2,b2,m4)
+
+DISASM_TYPE(VRX);
+int v1,x2,b2,d2,m3;
+    v1 = (inst[1] >> 4) | DISASM_RXB(0);
+    x2 = inst[1] & 0x0F;
+    b2 = inst[2] >> 4;
+    d2 = (inst[2] & 0x0F) << 8 | inst[3];
+    m3 = inst[4] >> 4;
+    DISASM_PRINT("%d,%d(%d,%d),%d",v1,d2,x2,b2,m3)
+
 
 /*----------------------------------------------------------------------------*/
 /* Two byte runtime opcode table + 4 6 byte opcode tables                     */
 /*----------------------------------------------------------------------------*/
 static zz_func runtime_opcode_xxxx[GEN_ARCHCOUNT][0x100 * 0x100];
 static zz_func runtime_opcode_e3________xx[GEN_ARCHCOUNT][0x100];
+static zz_func runtime_opcode_e7________xx[GEN_ARCHCOUNT][0x100];
 static zz_func runtime_opcode_eb________xx[GEN_ARCHCOUNT][0x100];
 static zz_func runtime_opcode_ec________xx[GEN_ARCHCOUNT][0x100];
 static zz_func runtime_opcode_ed________xx[GEN_ARCHCOUNT][0x100];
@@ -1924,21 +2183,31 @@ static zz_func replace_opcode_xx________xx(int arch, zz_func inst, int opcode1,
     {
       oldinst = runtime_opcode_e3________xx[arch][opcode2];
       runtime_opcode_e3________xx[arch][opcode2] = inst;
+      break;
+    }
+    case 0xe7:
+    {
+      oldinst = runtime_opcode_e7________xx[arch][opcode2];
+      runtime_opcode_e7________xx[arch][opcode2] = inst;
+      break;
     }
     case 0xeb:
     {
       oldinst = runtime_opcode_eb________xx[arch][opcode2];
       runtime_opcode_eb________xx[arch][opcode2] = inst;
+      break;
     }
     case 0xec:
     {
       oldinst = runtime_opcode_ec________xx[arch][opcode2];
       runtime_opcode_ec________xx[arch][opcode2] = inst;
+      break;
     }
     case 0xed:
     {
       oldinst = runtime_opcode_ed________xx[arch][opcode2];
       runtime_opcode_ed________xx[arch][opcode2] = inst;
+      break;
     }
     default:
     {
@@ -1990,6 +2259,7 @@ void *replace_opcode(int arch, zz_func inst, int opcode1, int opcode2)
       return(replace_opcode_xx_x(arch, inst, opcode1, opcode2));
     }
     case 0xe3:
+    case 0xe7:
     case 0xeb:
     case 0xec:
     case 0xed:
@@ -2035,6 +2305,7 @@ void init_opcode_tables(void)
         replace_opcode_xxxx(arch, v_opcode_e4xx[i][arch], 0xe4, i);
       replace_opcode_xxxx(arch, opcode_e5xx[i][arch], 0xe5, i);
       replace_opcode_xxxx(arch, opcode_e6xx[i][arch], 0xe6, i);
+      replace_opcode_xx________xx(arch, opcode_e7xx[i][arch], 0xe7, i);
       replace_opcode_xx________xx(arch, opcode_ebxx[i][arch], 0xeb, i);
       replace_opcode_xx________xx(arch, opcode_ecxx[i][arch], 0xec, i);
       replace_opcode_xx________xx(arch, opcode_edxx[i][arch], 0xed, i);
@@ -2114,16 +2385,19 @@ void init_opcode_pointers(REGS *regs)
     return;
   regs->s370_runtime_opcode_xxxx = runtime_opcode_xxxx[ARCH_370];
   regs->s370_runtime_opcode_e3________xx = runtime_opcode_e3________xx[ARCH_370];
+  regs->s370_runtime_opcode_e7________xx = runtime_opcode_e7________xx[ARCH_370];
   regs->s370_runtime_opcode_eb________xx = runtime_opcode_eb________xx[ARCH_370];
   regs->s370_runtime_opcode_ec________xx = runtime_opcode_ec________xx[ARCH_370];
   regs->s370_runtime_opcode_ed________xx = runtime_opcode_ed________xx[ARCH_370];
   regs->s390_runtime_opcode_xxxx = runtime_opcode_xxxx[ARCH_390];
   regs->s390_runtime_opcode_e3________xx = runtime_opcode_e3________xx[ARCH_390];
+  regs->s390_runtime_opcode_e7________xx = runtime_opcode_e7________xx[ARCH_390];
   regs->s390_runtime_opcode_eb________xx = runtime_opcode_eb________xx[ARCH_390];
   regs->s390_runtime_opcode_ec________xx = runtime_opcode_ec________xx[ARCH_390];
   regs->s390_runtime_opcode_ed________xx = runtime_opcode_ed________xx[ARCH_390];
   regs->z900_runtime_opcode_xxxx = runtime_opcode_xxxx[ARCH_900];
   regs->z900_runtime_opcode_e3________xx = runtime_opcode_e3________xx[ARCH_900];
+  regs->z900_runtime_opcode_e7________xx = runtime_opcode_e7________xx[ARCH_900];
   regs->z900_runtime_opcode_eb________xx = runtime_opcode_eb________xx[ARCH_900];
   regs->z900_runtime_opcode_ec________xx = runtime_opcode_ec________xx[ARCH_900];
   regs->z900_runtime_opcode_ed________xx = runtime_opcode_ed________xx[ARCH_900];
@@ -2391,7 +2665,7 @@ static zz_func opcode_table[0x100][GEN_MAXARCH] = {
  /*E4*/   GENx370x390x900 (execute_opcode_e4xx,e4xx,""),
  /*E5*/   GENx370x390x900 (execute_opcode_e5xx,e5xx,""),
  /*E6*/   GENx370x390x900 (execute_opcode_e6xx,e6xx,""),
- /*E7*/   GENx___x___x___ ,
+ /*E7*/   GENx___x___x900 (execute_opcode_e7________xx,e7xx,""),           /*z13*/
  /*E8*/   GENx370x390x900 (move_inverse,SS_L,"MVCIN"),
  /*E9*/   GENx37Xx390x900 (pack_ascii,SS_L2,"PKA"),
  /*EA*/   GENx37Xx390x900 (unpack_ascii,SS_L,"UNPKA"),
@@ -2952,7 +3226,7 @@ static zz_func opcode_b2xx[0x100][GEN_MAXARCH] = {
  /*B2E9*/ GENx___x___x___ ,
  /*B2EA*/ GENx___x___x___ ,
  /*B2EB*/ GENx___x___x___ ,
- /*B2EC*/ GENx___x___x___ ,
+ /*B2EC*/ GENx___x___x900 (extract_transaction_nesting_depth,RRE,"ETND"),     /*EC12*/
  /*B2ED*/ GENx___x___x900 (extract_coprocessor_group_address,RRE,"ECPGA"), /*  CMCF */
  /*B2EE*/ GENx___x___x___ ,
  /*B2EF*/ GENx___x___x___ ,
@@ -2964,11 +3238,11 @@ static zz_func opcode_b2xx[0x100][GEN_MAXARCH] = {
  /*B2F5*/ GENx___x___x___ ,
  /*B2F6*/ GENx___x___x___ ,                                     /* Sysplex   */
  /*B2F7*/ GENx___x___x___ ,
- /*B2F8*/ GENx___x___x___ ,
+ /*B2F8*/ GENx___x___x900 (transaction_end,S,"TEND"),                         /*EC12*/
  /*B2F9*/ GENx___x___x___ ,
  /*B2FA*/ GENx___x___x900 (next_instruction_access_intent,IE,"NIAI"),              /*912*/
  /*B2FB*/ GENx___x___x___ ,
- /*B2FC*/ GENx___x___x___ ,
+ /*B2FC*/ GENx___x___x900 (transaction_abort,S,"TABORT"),                     /*EC12*/
  /*B2FD*/ GENx___x___x___ ,
  /*B2FE*/ GENx___x___x___ ,
  /*B2FF*/ GENx___x390x900 (trap4,S,"TRAP4") };
@@ -3644,7 +3918,7 @@ static zz_func opcode_e3xx[0x100][GEN_MAXARCH] = {
  /*E322*/ GENx___x___x___ ,
  /*E323*/ GENx___x___x___ ,
  /*E324*/ GENx___x___x900 (store_long,RXY,"STG"),
- /*E325*/ GENx___x___x___ ,
+ /*E325*/ GENx___x___x900 (nontransactional_store,RXY,"NTSTG"),              /*EC12*/
  /*E326*/ GENx___x___x900 (convert_to_decimal_y,RXY,"CVDY"),
  /*E327*/ GENx___x___x___ ,
  /*E328*/ GENx___x___x___ ,
@@ -3964,8 +4238,8 @@ static zz_func opcode_e5xx[0x100][GEN_MAXARCH] = {
  /*E55D*/ GENx37Xx390x900 (compare_logical_immediate_fullword_storage,SIL,"CLFHSI"), /*208*/
  /*E55E*/ GENx___x___x___ ,
  /*E55F*/ GENx___x___x___ ,
- /*E560*/ GENx___x___x___ ,
- /*E561*/ GENx___x___x___ ,
+ /*E560*/ GENx___x___x900 (transaction_begin,SIL,"TBEGIN"),                    /*EC12*/
+ /*E561*/ GENx___x___x900 (transaction_begin_constrained,SIL,"TBEGINC"),       /*EC12*/
  /*E562*/ GENx___x___x___ ,
  /*E563*/ GENx___x___x___ ,
  /*E564*/ GENx___x___x___ ,
@@ -4385,6 +4659,265 @@ static zz_func opcode_e6xx[0x100][GEN_MAXARCH] = {
  /*E6FF*/ GENx___x___x___  };
 
 
+static zz_func opcode_e7xx[0x100][GEN_MAXARCH] = {
+ /*E700*/ GENx___x___x900 (vector_load_element_8,VRX,"VLEB"),                       /*z13*/
+ /*E701*/ GENx___x___x900 (vector_load_element_16,VRX,"VLEH"),                      /*z13*/
+ /*E702*/ GENx___x___x900 (vector_load_element_64,VRX,"VLEG"),                      /*z13*/
+ /*E703*/ GENx___x___x900 (vector_load_element_32,VRX,"VLEF"),                      /*z13*/
+ /*E704*/ GENx___x___x900 (vector_load_logical_element_and_zero,VRX,"VLLEZ"),       /*z13*/
+ /*E705*/ GENx___x___x900 (vector_load_and_replicate,VRX,"VLREP"),                  /*z13*/
+ /*E706*/ GENx___x___x900 (vector_load,VRX,"VL"),                                   /*z13*/
+ /*E707*/ GENx___x___x900 (vector_load_to_block_boundary,VRX,"VLBB"),               /*z13*/
+ /*E708*/ GENx___x___x900 (vector_store_element_8,VRX,"VSTEB"),                     /*z13*/
+ /*E709*/ GENx___x___x900 (vector_store_element_16,VRX,"VSTEH"),                    /*z13*/
+ /*E70A*/ GENx___x___x900 (vector_store_element_64,VRX,"VSTEG"),                    /*z13*/
+ /*E70B*/ GENx___x___x900 (vector_store_element_32,VRX,"VSTEF"),                    /*z13*/
+ /*E70C*/ GENx___x___x___ ,
+ /*E70D*/ GENx___x___x___ ,
+ /*E70E*/ GENx___x___x900 (vector_store,VRX,"VST"),                                 /*z13*/
+ /*E70F*/ GENx___x___x___ ,
+ /*E710*/ GENx___x___x___ ,
+ /*E711*/ GENx___x___x___ ,
+ /*E712*/ GENx___x___x___ ,
+ /*E713*/ GENx___x___x___ ,
+ /*E714*/ GENx___x___x___ ,
+ /*E715*/ GENx___x___x___ ,
+ /*E716*/ GENx___x___x___ ,
+ /*E717*/ GENx___x___x___ ,
+ /*E718*/ GENx___x___x___ ,
+ /*E719*/ GENx___x___x___ ,
+ /*E71A*/ GENx___x___x___ ,
+ /*E71B*/ GENx___x___x___ ,
+ /*E71C*/ GENx___x___x___ ,
+ /*E71D*/ GENx___x___x___ ,
+ /*E71E*/ GENx___x___x___ ,
+ /*E71F*/ GENx___x___x___ ,
+ /*E720*/ GENx___x___x___ ,
+ /*E721*/ GENx___x___x900 (vector_load_gr_from_vr_element,VRS_C,"VLGV"),            /*z13*/
+ /*E722*/ GENx___x___x900 (vector_load_vr_element_from_gr,VRS_B,"VLVG"),            /*z13*/
+ /*E723*/ GENx___x___x___ ,
+ /*E724*/ GENx___x___x___ ,
+ /*E725*/ GENx___x___x___ ,
+ /*E726*/ GENx___x___x___ ,
+ /*E727*/ GENx___x___x900 (load_count_to_block_boundary,VRX,"LCBB"),                /*z13*/
+ /*E728*/ GENx___x___x___ ,
+ /*E729*/ GENx___x___x___ ,
+ /*E72A*/ GENx___x___x___ ,
+ /*E72B*/ GENx___x___x___ ,
+ /*E72C*/ GENx___x___x___ ,
+ /*E72D*/ GENx___x___x___ ,
+ /*E72E*/ GENx___x___x___ ,
+ /*E72F*/ GENx___x___x___ ,
+ /*E730*/ GENx___x___x900 (vector_element_shift_left,VRS_A,"VESL"),                 /*z13*/
+ /*E731*/ GENx___x___x___ ,
+ /*E732*/ GENx___x___x___ ,
+ /*E733*/ GENx___x___x900 (vector_element_rotate_left_logical,VRS_A,"VERLL"),       /*z13*/
+ /*E734*/ GENx___x___x___ ,
+ /*E735*/ GENx___x___x___ ,
+ /*E736*/ GENx___x___x900 (vector_load_multiple,VRS_A,"VLM"),                       /*z13*/
+ /*E737*/ GENx___x___x900 (vector_load_with_length,VRS_B,"VLL"),                    /*z13*/
+ /*E738*/ GENx___x___x900 (vector_element_shift_right_logical,VRS_A,"VESRL"),       /*z13*/
+ /*E739*/ GENx___x___x___ ,
+ /*E73A*/ GENx___x___x900 (vector_element_shift_right_arithmetic,VRS_A,"VESRA"),    /*z13*/
+ /*E73B*/ GENx___x___x___ ,
+ /*E73C*/ GENx___x___x___ ,
+ /*E73D*/ GENx___x___x___ ,
+ /*E73E*/ GENx___x___x900 (vector_store_multiple,VRS_A,"VSTM"),                     /*z13*/
+ /*E73F*/ GENx___x___x900 (vector_store_with_length,VRS_B,"VSTL"),                  /*z13*/
+ /*E740*/ GENx___x___x900 (vector_load_element_immediate_8,VRI_A,"VLEIB"),          /*z13*/
+ /*E741*/ GENx___x___x900 (vector_load_element_immediate_16,VRI_A,"VLEIH"),         /*z13*/
+ /*E742*/ GENx___x___x900 (vector_load_element_immediate_64,VRI_A,"VLEIG"),         /*z13*/
+ /*E743*/ GENx___x___x900 (vector_load_element_immediate_32,VRI_A,"VLEIF"),         /*z13*/
+ /*E744*/ GENx___x___x900 (vector_generate_byte_mask,VRI_A,"VGBM"),                 /*z13*/
+ /*E745*/ GENx___x___x900 (vector_replicate_immediate,VRI_A,"VREPI"),               /*z13*/
+ /*E746*/ GENx___x___x900 (vector_generate_mask,VRI_B,"VGM"),                       /*z13*/
+ /*E747*/ GENx___x___x___ ,
+ /*E748*/ GENx___x___x___ ,
+ /*E749*/ GENx___x___x___ ,
+ /*E74A*/ GENx___x___x___ ,
+ /*E74B*/ GENx___x___x___ ,
+ /*E74C*/ GENx___x___x___ ,
+ /*E74D*/ GENx___x___x900 (vector_replicate,VRI_C,"VREP"),                          /*z13*/
+ /*E74E*/ GENx___x___x___ ,
+ /*E74F*/ GENx___x___x___ ,
+ /*E750*/ GENx___x___x900 (vector_population_count,VRR_A,"VPOPCT"),                 /*z13*/
+ /*E751*/ GENx___x___x___ ,
+ /*E752*/ GENx___x___x900 (vector_count_trailing_zeros,VRR_A,"VCTZ"),               /*z13*/
+ /*E753*/ GENx___x___x900 (vector_count_leading_zeros,VRR_A,"VCLZ"),                /*z13*/
+ /*E754*/ GENx___x___x___ ,
+ /*E755*/ GENx___x___x___ ,
+ /*E756*/ GENx___x___x900 (vector_load_vector,VRR_A,"VLR"),                         /*z13*/
+ /*E757*/ GENx___x___x___ ,
+ /*E758*/ GENx___x___x___ ,
+ /*E759*/ GENx___x___x___ ,
+ /*E75A*/ GENx___x___x___ ,
+ /*E75B*/ GENx___x___x___ ,
+ /*E75C*/ GENx___x___x900 (vector_isolate_string,VRR_A,"VISTR"),                    /*z13*/
+ /*E75D*/ GENx___x___x___ ,
+ /*E75E*/ GENx___x___x___ ,
+ /*E75F*/ GENx___x___x900 (vector_sign_extend_to_doubleword,VRR_A,"VSEG"),          /*z13*/
+ /*E760*/ GENx___x___x900 (vector_merge_low,VRR_C,"VMRL"),                          /*z13*/
+ /*E761*/ GENx___x___x900 (vector_merge_high,VRR_C,"VMRH"),                         /*z13*/
+ /*E762*/ GENx___x___x900 (vector_load_vr_from_grs_disjoint,VRR_F,"VLVGP"),         /*z13*/
+ /*E763*/ GENx___x___x___ ,
+ /*E764*/ GENx___x___x900 (vector_sum_across_word,VRR_C,"VSUM"),                    /*z13*/
+ /*E765*/ GENx___x___x900 (vector_sum_across_doubleword,VRR_C,"VSUMG"),             /*z13*/
+ /*E766*/ GENx___x___x___ ,
+ /*E767*/ GENx___x___x900 (vector_sum_across_quadword,VRR_C,"VSUMQ"),               /*z13*/
+ /*E768*/ GENx___x___x900 (vector_and,VRR_C,"VN"),                                  /*z13*/
+ /*E769*/ GENx___x___x900 (vector_and_with_complement,VRR_C,"VNC"),                 /*z13*/
+ /*E76A*/ GENx___x___x900 (vector_or,VRR_C,"VO"),                                   /*z13*/
+ /*E76B*/ GENx___x___x900 (vector_nor,VRR_C,"VNO"),                                 /*z13*/
+ /*E76C*/ GENx___x___x___ ,
+ /*E76D*/ GENx___x___x900 (vector_exclusive_or,VRR_C,"VX"),                         /*z13*/
+ /*E76E*/ GENx___x___x___ ,
+ /*E76F*/ GENx___x___x___ ,
+ /*E770*/ GENx___x___x900 (vector_element_shift_left_vector,VRR_C,"VESLV"),         /*z13*/
+ /*E771*/ GENx___x___x___ ,
+ /*E772*/ GENx___x___x___ ,
+ /*E773*/ GENx___x___x900 (vector_element_rotate_left_logical_vector,VRR_C,"VERLLV"), /*z13*/
+ /*E774*/ GENx___x___x900 (vector_shift_left,VRR_C,"VSL"),                          /*z13*/
+ /*E775*/ GENx___x___x900 (vector_shift_left_by_byte,VRR_C,"VSLB"),                 /*z13*/
+ /*E776*/ GENx___x___x___ ,
+ /*E777*/ GENx___x___x900 (vector_shift_left_double_by_byte,VRI_D,"VSLDB"),         /*z13*/
+ /*E778*/ GENx___x___x900 (vector_element_shift_right_logical_vector,VRR_C,"VESRLV"), /*z13*/
+ /*E779*/ GENx___x___x___ ,
+ /*E77A*/ GENx___x___x900 (vector_element_shift_right_arithmetic_vector,VRR_C,"VESRAV"), /*z13*/
+ /*E77B*/ GENx___x___x___ ,
+ /*E77C*/ GENx___x___x900 (vector_shift_right_logical,VRR_C,"VSRL"),                /*z13*/
+ /*E77D*/ GENx___x___x900 (vector_shift_right_logical_by_byte,VRR_C,"VSRLB"),       /*z13*/
+ /*E77E*/ GENx___x___x900 (vector_shift_right_arithmetic,VRR_C,"VSRA"),             /*z13*/
+ /*E77F*/ GENx___x___x900 (vector_shift_right_arithmetic_by_byte,VRR_C,"VSRAB"),    /*z13*/
+ /*E780*/ GENx___x___x900 (vector_find_element_equal,VRR_B,"VFEE"),                 /*z13*/
+ /*E781*/ GENx___x___x900 (vector_find_element_not_equal,VRR_B,"VFENE"),            /*z13*/
+ /*E782*/ GENx___x___x900 (vector_find_any_element_equal,VRR_B,"VFAE"),             /*z13*/
+ /*E783*/ GENx___x___x___ ,
+ /*E784*/ GENx___x___x900 (vector_permute_doubleword_immediate,VRR_C,"VPDI"),       /*z13*/
+ /*E785*/ GENx___x___x___ ,
+ /*E786*/ GENx___x___x___ ,
+ /*E787*/ GENx___x___x___ ,
+ /*E788*/ GENx___x___x___ ,
+ /*E789*/ GENx___x___x___ ,
+ /*E78A*/ GENx___x___x900 (vector_string_range_compare,VRR_D,"VSTRC"),              /*z13*/
+ /*E78B*/ GENx___x___x___ ,
+ /*E78C*/ GENx___x___x900 (vector_permute,VRR_E,"VPERM"),                           /*z13*/
+ /*E78D*/ GENx___x___x900 (vector_select,VRR_E,"VSEL"),                             /*z13*/
+ /*E78E*/ GENx___x___x___ ,
+ /*E78F*/ GENx___x___x___ ,
+ /*E790*/ GENx___x___x___ ,
+ /*E791*/ GENx___x___x___ ,
+ /*E792*/ GENx___x___x___ ,
+ /*E793*/ GENx___x___x___ ,
+ /*E794*/ GENx___x___x900 (vector_pack,VRR_C,"VPK"),                                /*z13*/
+ /*E795*/ GENx___x___x___ ,
+ /*E796*/ GENx___x___x___ ,
+ /*E797*/ GENx___x___x___ ,
+ /*E798*/ GENx___x___x___ ,
+ /*E799*/ GENx___x___x___ ,
+ /*E79A*/ GENx___x___x___ ,
+ /*E79B*/ GENx___x___x___ ,
+ /*E79C*/ GENx___x___x___ ,
+ /*E79D*/ GENx___x___x___ ,
+ /*E79E*/ GENx___x___x___ ,
+ /*E79F*/ GENx___x___x___ ,
+ /*E7A0*/ GENx___x___x___ ,
+ /*E7A1*/ GENx___x___x___ ,
+ /*E7A2*/ GENx___x___x900 (vector_multiply_low,VRR_C,"VML"),                        /*z13*/
+ /*E7A3*/ GENx___x___x___ ,
+ /*E7A4*/ GENx___x___x___ ,
+ /*E7A5*/ GENx___x___x___ ,
+ /*E7A6*/ GENx___x___x___ ,
+ /*E7A7*/ GENx___x___x___ ,
+ /*E7A8*/ GENx___x___x___ ,
+ /*E7A9*/ GENx___x___x___ ,
+ /*E7AA*/ GENx___x___x___ ,
+ /*E7AB*/ GENx___x___x___ ,
+ /*E7AC*/ GENx___x___x___ ,
+ /*E7AD*/ GENx___x___x___ ,
+ /*E7AE*/ GENx___x___x___ ,
+ /*E7AF*/ GENx___x___x___ ,
+ /*E7B0*/ GENx___x___x___ ,
+ /*E7B1*/ GENx___x___x___ ,
+ /*E7B2*/ GENx___x___x___ ,
+ /*E7B3*/ GENx___x___x___ ,
+ /*E7B4*/ GENx___x___x___ ,
+ /*E7B5*/ GENx___x___x___ ,
+ /*E7B6*/ GENx___x___x___ ,
+ /*E7B7*/ GENx___x___x___ ,
+ /*E7B8*/ GENx___x___x___ ,
+ /*E7B9*/ GENx___x___x___ ,
+ /*E7BA*/ GENx___x___x___ ,
+ /*E7BB*/ GENx___x___x___ ,
+ /*E7BC*/ GENx___x___x___ ,
+ /*E7BD*/ GENx___x___x___ ,
+ /*E7BE*/ GENx___x___x___ ,
+ /*E7BF*/ GENx___x___x___ ,
+ /*E7C0*/ GENx___x___x___ ,
+ /*E7C1*/ GENx___x___x___ ,
+ /*E7C2*/ GENx___x___x___ ,
+ /*E7C3*/ GENx___x___x___ ,
+ /*E7C4*/ GENx___x___x___ ,
+ /*E7C5*/ GENx___x___x___ ,
+ /*E7C6*/ GENx___x___x___ ,
+ /*E7C7*/ GENx___x___x___ ,
+ /*E7C8*/ GENx___x___x___ ,
+ /*E7C9*/ GENx___x___x___ ,
+ /*E7CA*/ GENx___x___x___ ,
+ /*E7CB*/ GENx___x___x___ ,
+ /*E7CC*/ GENx___x___x___ ,
+ /*E7CD*/ GENx___x___x___ ,
+ /*E7CE*/ GENx___x___x___ ,
+ /*E7CF*/ GENx___x___x___ ,
+ /*E7D0*/ GENx___x___x___ ,
+ /*E7D1*/ GENx___x___x___ ,
+ /*E7D2*/ GENx___x___x___ ,
+ /*E7D3*/ GENx___x___x___ ,
+ /*E7D4*/ GENx___x___x900 (vector_unpack_logical_low,VRR_A,"VUPLL"),                /*z13*/
+ /*E7D5*/ GENx___x___x900 (vector_unpack_logical_high,VRR_A,"VUPLH"),               /*z13*/
+ /*E7D6*/ GENx___x___x900 (vector_unpack_low,VRR_A,"VUPL"),                         /*z13*/
+ /*E7D7*/ GENx___x___x900 (vector_unpack_high,VRR_A,"VUPH"),                        /*z13*/
+ /*E7D8*/ GENx___x___x900 (vector_test_under_mask,VRR_A,"VTM"),                     /*z13*/
+ /*E7D9*/ GENx___x___x___ ,
+ /*E7DA*/ GENx___x___x___ ,
+ /*E7DB*/ GENx___x___x___ ,
+ /*E7DC*/ GENx___x___x___ ,
+ /*E7DD*/ GENx___x___x___ ,
+ /*E7DE*/ GENx___x___x900 (vector_load_complement,VRR_A,"VLC"),                     /*z13*/
+ /*E7DF*/ GENx___x___x900 (vector_load_positive,VRR_A,"VLP"),                       /*z13*/
+ /*E7E0*/ GENx___x___x___ ,
+ /*E7E1*/ GENx___x___x___ ,
+ /*E7E2*/ GENx___x___x___ ,
+ /*E7E3*/ GENx___x___x___ ,
+ /*E7E4*/ GENx___x___x___ ,
+ /*E7E5*/ GENx___x___x___ ,
+ /*E7E6*/ GENx___x___x___ ,
+ /*E7E7*/ GENx___x___x___ ,
+ /*E7E8*/ GENx___x___x___ ,
+ /*E7E9*/ GENx___x___x___ ,
+ /*E7EA*/ GENx___x___x___ ,
+ /*E7EB*/ GENx___x___x___ ,
+ /*E7EC*/ GENx___x___x___ ,
+ /*E7ED*/ GENx___x___x___ ,
+ /*E7EE*/ GENx___x___x___ ,
+ /*E7EF*/ GENx___x___x___ ,
+ /*E7F0*/ GENx___x___x900 (vector_average_logical,VRR_C,"VAVGL"),                   /*z13*/
+ /*E7F1*/ GENx___x___x___ ,
+ /*E7F2*/ GENx___x___x900 (vector_average,VRR_C,"VAVG"),                            /*z13*/
+ /*E7F3*/ GENx___x___x900 (vector_add,VRR_C,"VA"),                                  /*z13*/
+ /*E7F4*/ GENx___x___x___ ,
+ /*E7F5*/ GENx___x___x___ ,
+ /*E7F6*/ GENx___x___x___ ,
+ /*E7F7*/ GENx___x___x900 (vector_subtract,VRR_C,"VS"),                             /*z13*/
+ /*E7F8*/ GENx___x___x900 (vector_compare_equal,VRR_B,"VCEQ"),                      /*z13*/
+ /*E7F9*/ GENx___x___x900 (vector_compare_high_logical,VRR_B,"VCHL"),               /*z13*/
+ /*E7FA*/ GENx___x___x___ ,
+ /*E7FB*/ GENx___x___x900 (vector_compare_high,VRR_B,"VCH"),                        /*z13*/
+ /*E7FC*/ GENx___x___x900 (vector_minimum_logical,VRR_C,"VMNL"),                    /*z13*/
+ /*E7FD*/ GENx___x___x900 (vector_maximum_logical,VRR_C,"VMXL"),                    /*z13*/
+ /*E7FE*/ GENx___x___x900 (vector_minimum,VRR_C,"VMN"),                             /*z13*/
+ /*E7FF*/ GENx___x___x900 (vector_maximum,VRR_C,"VMX") };                           /*z13*/
+
+
 static zz_func opcode_ebxx[0x100][GEN_MAXARCH] = {
  /*EB00*/ GENx___x___x___ ,
  /*EB01*/ GENx___x___x___ ,
@@ -5172,11 +5705,11 @@ static zz_func v_opcode_a4xx[0x100][GEN_MAXARCH] = {
  /*A406*/ GENx___x___x___ , /* VMCE */
  /*A407*/ GENx___x___x___ , /* VACE */
  /*A408*/ GENx___x___x___ , /* VCE */
- /*A409*/ GENx___x___x___ , /* VL, VLE */
+ /*A409*/ GENx370x390x___ (v_load,VST,"VL"),
  /*A40A*/ GENx___x___x___ , /* VLM, VLME */
  /*A40B*/ GENx___x___x___ , /* VLY, VLYE */
  /*A40C*/ GENx___x___x___ ,
- /*A40D*/ GENx___x___x___ , /* VST, VSTE */
+ /*A40D*/ GENx370x390x___ (v_store,VST,"VST"),
  /*A40E*/ GENx___x___x___ , /* VSTM, VSTME */
  /*A40F*/ GENx___x___x___ , /* VSTK, VSTKE */
  /*A410*/ GENx___x___x___ , /* VAD */
@@ -5195,15 +5728,15 @@ static zz_func v_opcode_a4xx[0x100][GEN_MAXARCH] = {
  /*A41D*/ GENx___x___x___ , /* VSTD */
  /*A41E*/ GENx___x___x___ , /* VSTMD */
  /*A41F*/ GENx___x___x___ , /* VSTKD */
- /*A420*/ GENx___x___x___ , /* VA */
- /*A421*/ GENx___x___x___ , /* VS */
+ /*A420*/ GENx370x390x___ (v_add,VST,"VA"),
+ /*A421*/ GENx370x390x___ (v_subtract,VST,"VS"),
  /*A422*/ GENx___x___x___ , /* VM */
  /*A423*/ GENx___x___x___ ,
- /*A424*/ GENx___x___x___ , /* VN */
- /*A425*/ GENx___x___x___ , /* VO */
- /*A426*/ GENx___x___x___ , /* VX */
+ /*A424*/ GENx370x390x___ (v_and,VST,"VN"),
+ /*A425*/ GENx370x390x___ (v_or,VST,"VO"),
+ /*A426*/ GENx370x390x___ (v_exclusive_or,VST,"VX"),
  /*A427*/ GENx___x___x___ ,
- /*A428*/ GENx___x___x___ , /* VC */
+ /*A428*/ GENx370x390x___ (v_compare,VST,"VC"),
  /*A429*/ GENx___x___x___ , /* VLH */
  /*A42A*/ GENx___x___x___ , /* VLINT */
  /*A42B*/ GENx___x___x___ ,
@@ -5323,15 +5856,15 @@ static zz_func v_opcode_a4xx[0x100][GEN_MAXARCH] = {
  /*A49D*/ GENx___x___x___ ,
  /*A49E*/ GENx___x___x___ ,
  /*A49F*/ GENx___x___x___ ,
- /*A4A0*/ GENx___x___x___ , /* VAS */
- /*A4A1*/ GENx___x___x___ , /* VSS */
+ /*A4A0*/ GENx370x390x___ (v_add_qst,VST,"VAS"),
+ /*A4A1*/ GENx370x390x___ (v_subtract_qst,VST,"VSS"),
  /*A4A2*/ GENx___x___x___ , /* VMS */
  /*A4A3*/ GENx___x___x___ ,
- /*A4A4*/ GENx___x___x___ , /* VNS */
- /*A4A5*/ GENx___x___x___ , /* VOS */
- /*A4A6*/ GENx___x___x___ , /* VXS */
+ /*A4A4*/ GENx370x390x___ (v_and_qst,VST,"VNS"),
+ /*A4A5*/ GENx370x390x___ (v_or_qst,VST,"VOS"),
+ /*A4A6*/ GENx370x390x___ (v_exclusive_or_qst,VST,"VXS"),
  /*A4A7*/ GENx___x___x___ ,
- /*A4A8*/ GENx___x___x___ , /* VCS */
+ /*A4A8*/ GENx370x390x___ (v_compare_qst,VST,"VCS"),
  /*A4A9*/ GENx___x___x___ ,
  /*A4AA*/ GENx___x___x___ ,
  /*A4AB*/ GENx___x___x___ ,
@@ -5454,15 +5987,15 @@ static zz_func v_opcode_a5xx[0x100][GEN_MAXARCH] = {
  /*A51D*/ GENx___x___x___ ,
  /*A51E*/ GENx___x___x___ ,
  /*A51F*/ GENx___x___x___ ,
- /*A520*/ GENx___x___x___ , /* VAR */
- /*A521*/ GENx___x___x___ , /* VSR */
+ /*A520*/ GENx370x390x___ (v_add_vv,VR,"VAR"),
+ /*A521*/ GENx370x390x___ (v_subtract_vv,VR,"VSR"),
  /*A522*/ GENx___x___x___ , /* VMR */
  /*A523*/ GENx___x___x___ ,
- /*A524*/ GENx___x___x___ , /* VNR */
- /*A525*/ GENx___x___x___ , /* VOR */
- /*A526*/ GENx___x___x___ , /* VXR */
+ /*A524*/ GENx370x390x___ (v_and_vv,VR,"VNR"),
+ /*A525*/ GENx370x390x___ (v_or_vv,VR,"VOR"),
+ /*A526*/ GENx370x390x___ (v_exclusive_or_vv,VR,"VXR"),
  /*A527*/ GENx___x___x___ ,
- /*A528*/ GENx___x___x___ , /* VCR */
+ /*A528*/ GENx370x390x___ (v_compare_vv,VR,"VCR"),
  /*A529*/ GENx___x___x___ ,
  /*A52A*/ GENx___x___x___ ,
  /*A52B*/ GENx___x___x___ ,
@@ -5582,15 +6115,15 @@ static zz_func v_opcode_a5xx[0x100][GEN_MAXARCH] = {
  /*A59D*/ GENx___x___x___ ,
  /*A59E*/ GENx___x___x___ ,
  /*A59F*/ GENx___x___x___ ,
- /*A5A0*/ GENx___x___x___ , /* VAQ */
- /*A5A1*/ GENx___x___x___ , /* VSQ */
+ /*A5A0*/ GENx370x390x___ (v_add_qv,VR,"VAQ"),
+ /*A5A1*/ GENx370x390x___ (v_subtract_qv,VR,"VSQ"),
  /*A5A2*/ GENx___x___x___ , /* VMQ */
  /*A5A3*/ GENx___x___x___ ,
- /*A5A4*/ GENx___x___x___ , /* VNQ */
- /*A5A5*/ GENx___x___x___ , /* VOQ */
- /*A5A6*/ GENx___x___x___ , /* VXQ */
+ /*A5A4*/ GENx370x390x___ (v_and_qv,VR,"VNQ"),
+ /*A5A5*/ GENx370x390x___ (v_or_qv,VR,"VOQ"),
+ /*A5A6*/ GENx370x390x___ (v_exclusive_or_qv,VR,"VXQ"),
  /*A5A7*/ GENx___x___x___ ,
- /*A5A8*/ GENx___x___x___ , /* VCQ */
+ /*A5A8*/ GENx370x390x___ (v_compare_qv,VR,"VCQ"),
  /*A5A9*/ GENx___x___x___ , /* VLQ */
  /*A5AA*/ GENx___x___x___ , /* VLMQ */
  /*A5AB*/ GENx___x___x___ ,
@@ -318,6 +318,18 @@ do { \
   } \
 } while (0)
 
+/* Cached trace table page translation (trace.c) of a CPU and of
+   its SIE host or guest register context                            */
+
+#define INVALIDATE_TRACE_PAGE(_regs) \
+do { \
+  (_regs)->trace_valid = 0; \
+  if ((_regs)->hostregs) \
+    (_regs)->hostregs->trace_valid = 0; \
+  if ((_regs)->guestregs) \
+    (_regs)->guestregs->trace_valid = 0; \
+} while (0)
+
 #if 1
 #define _PSW_IA_MAIN(_regs, _addr) \
  ((BYTE *)((uintptr_t)(_regs)->aip | (uintptr_t)((_addr) & PAGEFRAME_BYTEMASK)))
@@ -628,6 +640,17 @@ do { \
  #define SIE_ACTIVE(_regs) (0)
 #endif
 
+/* Restricted instructions abort a transaction, or cause a
+   transaction-constraint exception in a constrained transaction */
+#undef TXF_INSTR_CHECK
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+ #define TXF_INSTR_CHECK(_regs) \
+    if (unlikely((_regs)->txf_tnd)) \
+        ARCH_DEP(txf_restricted_instruction) ((_regs))
+#else
+ #define TXF_INSTR_CHECK(_regs) do { } while (0)
+#endif
+
 #undef MULTIPLE_CONTROLLED_DATA_SPACE
 #if defined(_FEATURE_MULTIPLE_CONTROLLED_DATA_SPACE)
  #define MULTIPLE_CONTROLLED_DATA_SPACE(_regs) \
@@ -2869,13 +2892,25 @@ do { \
 #define VECTOR_IX(_regs) \
         (((_regs)->vf->vsr & VSR_VIX) >> 16)
 
+#define SET_VECTOR_IX(_ix, _regs) \
+    (_regs)->vf->vsr = ((_regs)->vf->vsr & ~VSR_VIX) | ((U64)(_ix) << 16)
+
+/* A result has been placed in vr; the change bit is only
+   recorded in the problem state */
+#define SET_VR_RESULT(_vr, _regs) \
+    do { \
+        SET_VR_INUSE((_vr), (_regs)); \
+        if (PROBSTATE(&(_regs)->psw)) \
+            SET_VR_CHANGED((_vr), (_regs)); \
+    } while (0)
+
 #endif /*!defined(_VFDEFS)*/
 
 /* VST and QST formats are the same */
 #undef VST
 #define VST(_inst, _regs, _vr3, _rt2, _vr1, _rs2) \
     { \
-        (_qr3) = (_inst)[2] >> 4; \
+        (_vr3) = (_inst)[2] >> 4; \
         (_rt2) = (_inst)[2] & 0x0F; \
         (_vr1) = (_inst)[3] >> 4; \
         (_rs2) = (_inst)[3] & 0x0F; \
@@ -2932,9 +2967,209 @@ do { \
 
 #endif /*defined(FEATURE_VECTOR_FACILITY)*/
 
+#if defined(FEATURE_ZVECTOR_FACILITY)
+
+/*-------------------------------------------------------------------*/
+/* z/Architecture vector facility instruction formats.  The vector   */
+/* register fields are four bits wide; the fifth (high-order) bit of */
+/* each comes from the RXB field in bits 36-39: bit 36 for the field */
+/* in bits 8-11, 37 for bits 12-15, 38 for bits 16-19 and 39 for the */
+/* field in bits 32-35.                                              */
+/*-------------------------------------------------------------------*/
+#define VR_RXB(_inst, _n) \
+        ((((_inst)[4] >> (3 - (_n))) & 1) << 4)
+
+/* Program check if the vector facility is not installed, or if it is
+   used while the AFP-register or vector-enablement control is zero */
+#if defined(_FEATURE_SIE)
+#define ZVECTOR_CHECK(_regs) \
+        FACILITY_CHECK(VECTOR, (_regs)); \
+        if( ((_regs)->CR(0) & (CR0_AFP|CR0_VX)) != (CR0_AFP|CR0_VX) \
+            || (SIE_MODE((_regs)) \
+             && ((_regs)->hostregs->CR(0) & (CR0_AFP|CR0_VX)) != (CR0_AFP|CR0_VX)) ) { \
+            (_regs)->dxc = DXC_VECTOR_INSTRUCTION; \
+            (_regs)->program_interrupt( (_regs), PGM_DATA_EXCEPTION); \
+        }
+#else /*!defined(_FEATURE_SIE)*/
+#define ZVECTOR_CHECK(_regs) \
+        FACILITY_CHECK(VECTOR, (_regs)); \
+        if( ((_regs)->CR(0) & (CR0_AFP|CR0_VX)) != (CR0_AFP|CR0_VX) ) { \
+            (_regs)->dxc = DXC_VECTOR_INSTRUCTION; \
+            (_regs)->program_interrupt( (_regs), PGM_DATA_EXCEPTION); \
+        }
+#endif /*!defined(_FEATURE_SIE)*/
+
+/* VRR-a vector register-and-register operation, three mask fields */
+#define VRR_A(_inst, _regs, _v1, _v2, _m3, _m4, _m5) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_m5) = (temp >> 4) & 0xf; \
+            (_m4) = temp & 0xf; \
+            (_m3) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRR-b vector register-and-register operation with M4 and M5 */
+#define VRR_B(_inst, _regs, _v1, _v2, _v3, _m4, _m5) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_v3) = ((temp >> 12) & 0xf) | VR_RXB((_inst), 2); \
+            (_m5) = (temp >> 4) & 0xf; \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRR-c vector register-and-register operation with M4 through M6 */
+#define VRR_C(_inst, _regs, _v1, _v2, _v3, _m4, _m5, _m6) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_v3) = ((temp >> 12) & 0xf) | VR_RXB((_inst), 2); \
+            (_m6) = (temp >> 4) & 0xf; \
+            (_m5) = temp & 0xf; \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRR-d vector register-and-register operation, four registers */
+#define VRR_D(_inst, _regs, _v1, _v2, _v3, _v4, _m5, _m6) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_v3) = ((temp >> 12) & 0xf) | VR_RXB((_inst), 2); \
+            (_m5) = (temp >> 8) & 0xf; \
+            (_m6) = (temp >> 4) & 0xf; \
+            (_v4) = ((_inst)[4] >> 4) | VR_RXB((_inst), 3); \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRR-e vector register-and-register operation, four registers */
+#define VRR_E(_inst, _regs, _v1, _v2, _v3, _v4, _m5, _m6) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_v3) = ((temp >> 12) & 0xf) | VR_RXB((_inst), 2); \
+            (_m6) = (temp >> 8) & 0xf; \
+            (_m5) = temp & 0xf; \
+            (_v4) = ((_inst)[4] >> 4) | VR_RXB((_inst), 3); \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRR-f vector register and two general registers */
+#define VRR_F(_inst, _regs, _v1, _r2, _r3) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_r2) = (temp >> 16) & 0xf; \
+            (_r3) = (temp >> 12) & 0xf; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRI-a vector register with 16-bit immediate */
+#define VRI_A(_inst, _regs, _v1, _i2, _m3) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_i2) = temp & 0xffff; \
+            (_m3) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRI-b vector register with two 8-bit immediates */
+#define VRI_B(_inst, _regs, _v1, _i2, _i3, _m4) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_i2) = (temp >> 8) & 0xff; \
+            (_i3) = temp & 0xff; \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRI-c two vector registers with 16-bit immediate */
+#define VRI_C(_inst, _regs, _v1, _v3, _i2, _m4) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v3) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_i2) = temp & 0xffff; \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRI-d three vector registers with 8-bit immediate */
+#define VRI_D(_inst, _regs, _v1, _v2, _v3, _i4, _m5) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v2) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_v3) = ((temp >> 12) & 0xf) | VR_RXB((_inst), 2); \
+            (_i4) = temp & 0xff; \
+            (_m5) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* Base-displacement address common to the VRS and VRX formats */
+#define VR_ADDR(_temp, _regs, _x2, _b2, _effective_addr2) \
+    { \
+            (_effective_addr2) = (_temp) & 0xfff; \
+            if((_x2)) \
+                (_effective_addr2) += (_regs)->GR((_x2)); \
+            if((_b2)) \
+                (_effective_addr2) += (_regs)->GR((_b2)); \
+            (_effective_addr2) &= ADDRESS_MAXWRAP((_regs)); \
+    }
+
+/* VRS-a two vector registers and storage */
+#define VRS_A(_inst, _regs, _v1, _v3, _b2, _effective_addr2, _m4) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_v3) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_b2) = (temp >> 12) & 0xf; \
+            VR_ADDR(temp, (_regs), 0, (_b2), (_effective_addr2)); \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRS-b vector register, general register and storage */
+#define VRS_B(_inst, _regs, _v1, _r3, _b2, _effective_addr2, _m4) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_r3) = (temp >> 16) & 0xf; \
+            (_b2) = (temp >> 12) & 0xf; \
+            VR_ADDR(temp, (_regs), 0, (_b2), (_effective_addr2)); \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRS-c general register, vector register and storage */
+#define VRS_C(_inst, _regs, _r1, _v3, _b2, _effective_addr2, _m4) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_r1) = (temp >> 20) & 0xf; \
+            (_v3) = ((temp >> 16) & 0xf) | VR_RXB((_inst), 1); \
+            (_b2) = (temp >> 12) & 0xf; \
+            VR_ADDR(temp, (_regs), 0, (_b2), (_effective_addr2)); \
+            (_m4) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+/* VRX vector register and indexed storage */
+#define VRX(_inst, _regs, _v1, _x2, _b2, _effective_addr2, _m3) \
+    {   U32 temp = fetch_fw(_inst); \
+            (_v1) = ((temp >> 20) & 0xf) | VR_RXB((_inst), 0); \
+            (_x2) = (temp >> 16) & 0xf; \
+            (_b2) = (temp >> 12) & 0xf; \
+            VR_ADDR(temp, (_regs), (_x2), (_b2), (_effective_addr2)); \
+            (_m3) = (_inst)[4] >> 4; \
+            INST_UPDATE_PSW((_regs), 6, 6); \
+    }
+
+#endif /*defined(FEATURE_ZVECTOR_FACILITY)*/
+
 #define PERFORM_SERIALIZATION(_regs) do { } while (0)
 #define PERFORM_CHKPT_SYNC(_regs) do { } while (0)
 
+/* Functions in module assist.c */
+void mvsassist_stats_disp (int reset);
+
+
 /* Functions in module channel.c */
 int  ARCH_DEP(startio) (REGS *regs, DEVBLK *dev, ORB *orb);
 void *s370_execute_ccw_chain (void *dev);
@@ -2991,6 +3226,7 @@ void *cpu_thread (void *cpu);
 DLL_EXPORT void copy_psw (REGS *regs, BYTE *addr);
 int display_psw (REGS *regs, char *buf, int buflen);
 char *str_psw (REGS *regs, char *buf);
+void pgmint_stats_disp (int reset);
 
 
 /* Functions in module vm.c */
@@ -3101,11 +3337,13 @@ void init_opcode_pointers(REGS *regs);
 /* Functions in module panel.c */
 void ARCH_DEP(display_inst) (REGS *regs, BYTE *inst);
 void display_inst (REGS *regs, BYTE *inst);
+void ARCH_DEP(itrace_inst) (REGS *regs, BYTE *inst, U16 pcode);
 
 
 /* Functions in module sie.c */
 void ARCH_DEP(sie_exit) (REGS *regs, int code);
 void ARCH_DEP(diagnose_002) (REGS *regs, int r1, int r3);
+void sie_stats_disp (int reset);
 
 
 /* Functions in module stack.c */
@@ -3121,6 +3359,22 @@ void ARCH_DEP(unstack_registers) (int gtype, VADR lsea, int r1,
 int  ARCH_DEP(program_return_unstack) (REGS *regs, RADR *lsedap, int *rc);
 
 
+/* Functions in module transact.c */
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+BYTE *ARCH_DEP(txf_maddr_l) (VADR addr, size_t len, int arn, REGS *regs,
+    int acctype, BYTE akey);
+BYTE *ARCH_DEP(txf_check_maddr_l) (VADR addr, size_t len, int arn,
+    REGS *regs, int acctype, BYTE akey);
+void ARCH_DEP(txf_abort) (REGS *regs, U64 tac);
+void ARCH_DEP(txf_restricted_instruction) (REGS *regs);
+int  ARCH_DEP(txf_program_interrupt) (REGS *regs, int pcode, int ilc);
+void ARCH_DEP(txf_interrupt) (REGS *regs);
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+#if defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+void txf_release (REGS *regs);
+#endif /*defined(_FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
+
 /* Functions in module trace.c */
 CREG  ARCH_DEP(trace_br) (int amode, VADR ia, REGS *regs);
 #if defined(_FEATURE_ZSIE)
@@ -4225,6 +4479,32 @@ DEF_INST(invalidate_expanded_storage_block_entry);
 
 /* Instructions in vector.c */
 #if defined(FEATURE_VECTOR_FACILITY)
+DEF_INST(v_load);
+DEF_INST(v_store);
+DEF_INST(v_add);
+DEF_INST(v_subtract);
+DEF_INST(v_and);
+DEF_INST(v_or);
+DEF_INST(v_exclusive_or);
+DEF_INST(v_compare);
+DEF_INST(v_add_qst);
+DEF_INST(v_subtract_qst);
+DEF_INST(v_and_qst);
+DEF_INST(v_or_qst);
+DEF_INST(v_exclusive_or_qst);
+DEF_INST(v_compare_qst);
+DEF_INST(v_add_vv);
+DEF_INST(v_subtract_vv);
+DEF_INST(v_and_vv);
+DEF_INST(v_or_vv);
+DEF_INST(v_exclusive_or_vv);
+DEF_INST(v_compare_vv);
+DEF_INST(v_add_qv);
+DEF_INST(v_subtract_qv);
+DEF_INST(v_and_qv);
+DEF_INST(v_or_qv);
+DEF_INST(v_exclusive_or_qv);
+DEF_INST(v_compare_qv);
 DEF_INST(v_test_vmr);
 DEF_INST(v_complement_vmr);
 DEF_INST(v_count_left_zeros_in_vmr);
@@ -4254,6 +4534,109 @@ DEF_INST(v_restore_vac);
 #endif /*defined(FEATURE_VECTOR_FACILITY)*/
 
 
+/* Instructions in zvector.c */
+#if defined(FEATURE_ZVECTOR_FACILITY)
+DEF_INST(vector_load_element_8);
+DEF_INST(vector_load_element_16);
+DEF_INST(vector_load_element_64);
+DEF_INST(vector_load_element_32);
+DEF_INST(vector_load_logical_element_and_zero);
+DEF_INST(vector_load_and_replicate);
+DEF_INST(vector_load);
+DEF_INST(vector_load_to_block_boundary);
+DEF_INST(vector_store_element_8);
+DEF_INST(vector_store_element_16);
+DEF_INST(vector_store_element_64);
+DEF_INST(vector_store_element_32);
+DEF_INST(vector_store);
+DEF_INST(vector_load_gr_from_vr_element);
+DEF_INST(vector_load_vr_element_from_gr);
+DEF_INST(load_count_to_block_boundary);
+DEF_INST(vector_element_shift_left);
+DEF_INST(vector_element_rotate_left_logical);
+DEF_INST(vector_load_multiple);
+DEF_INST(vector_load_with_length);
+DEF_INST(vector_element_shift_right_logical);
+DEF_INST(vector_element_shift_right_arithmetic);
+DEF_INST(vector_store_multiple);
+DEF_INST(vector_store_with_length);
+DEF_INST(vector_load_element_immediate_8);
+DEF_INST(vector_load_element_immediate_16);
+DEF_INST(vector_load_element_immediate_64);
+DEF_INST(vector_load_element_immediate_32);
+DEF_INST(vector_generate_byte_mask);
+DEF_INST(vector_replicate_immediate);
+DEF_INST(vector_generate_mask);
+DEF_INST(vector_replicate);
+DEF_INST(vector_population_count);
+DEF_INST(vector_count_trailing_zeros);
+DEF_INST(vector_count_leading_zeros);
+DEF_INST(vector_load_vector);
+DEF_INST(vector_isolate_string);
+DEF_INST(vector_sign_extend_to_doubleword);
+DEF_INST(vector_merge_low);
+DEF_INST(vector_merge_high);
+DEF_INST(vector_load_vr_from_grs_disjoint);
+DEF_INST(vector_sum_across_word);
+DEF_INST(vector_sum_across_doubleword);
+DEF_INST(vector_sum_across_quadword);
+DEF_INST(vector_and);
+DEF_INST(vector_and_with_complement);
+DEF_INST(vector_or);
+DEF_INST(vector_nor);
+DEF_INST(vector_exclusive_or);
+DEF_INST(vector_element_shift_left_vector);
+DEF_INST(vector_element_rotate_left_logical_vector);
+DEF_INST(vector_shift_left);
+DEF_INST(vector_shift_left_by_byte);
+DEF_INST(vector_shift_left_double_by_byte);
+DEF_INST(vector_element_shift_right_logical_vector);
+DEF_INST(vector_element_shift_right_arithmetic_vector);
+DEF_INST(vector_shift_right_logical);
+DEF_INST(vector_shift_right_logical_by_byte);
+DEF_INST(vector_shift_right_arithmetic);
+DEF_INST(vector_shift_right_arithmetic_by_byte);
+DEF_INST(vector_find_element_equal);
+DEF_INST(vector_find_element_not_equal);
+DEF_INST(vector_find_any_element_equal);
+DEF_INST(vector_permute_doubleword_immediate);
+DEF_INST(vector_string_range_compare);
+DEF_INST(vector_permute);
+DEF_INST(vector_select);
+DEF_INST(vector_pack);
+DEF_INST(vector_multiply_low);
+DEF_INST(vector_unpack_logical_low);
+DEF_INST(vector_unpack_logical_high);
+DEF_INST(vector_unpack_low);
+DEF_INST(vector_unpack_high);
+DEF_INST(vector_test_under_mask);
+DEF_INST(vector_load_complement);
+DEF_INST(vector_load_positive);
+DEF_INST(vector_average_logical);
+DEF_INST(vector_average);
+DEF_INST(vector_add);
+DEF_INST(vector_subtract);
+DEF_INST(vector_compare_equal);
+DEF_INST(vector_compare_high_logical);
+DEF_INST(vector_compare_high);
+DEF_INST(vector_minimum_logical);
+DEF_INST(vector_maximum_logical);
+DEF_INST(vector_minimum);
+DEF_INST(vector_maximum);
+#endif /*defined(FEATURE_ZVECTOR_FACILITY)*/
+
+
+/* Instructions in transact.c */
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+DEF_INST(transaction_begin);
+DEF_INST(transaction_begin_constrained);
+DEF_INST(transaction_end);
+DEF_INST(transaction_abort);
+DEF_INST(extract_transaction_nesting_depth);
+DEF_INST(nontransactional_store);
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
+
 /* Instructions in esame.c */
 #if defined(FEATURE_BINARY_FLOATING_POINT)
 DEF_INST(store_fpc);
@@ -4298,6 +4681,9 @@ DEF_INST(set_addressing_mode_24);
 DEF_INST(set_addressing_mode_31);
 DEF_INST(subtract_logical_borrow);
 DEF_INST(subtract_logical_borrow_register);
+DEF_INST(test_addressing_mode);
+DEF_INST(branch_relative_on_condition_long);
+DEF_INST(branch_relative_and_save_long);
 #endif /*defined(FEATURE_ESAME_N3_ESA390) || defined(FEATURE_ESAME)*/
 DEF_INST(divide_single_long);
 DEF_INST(divide_single_long_fullword);
@@ -4309,7 +4695,6 @@ DEF_INST(store_pair_to_quadword);
 DEF_INST(load_pair_from_quadword);
 DEF_INST(extract_stacked_registers_long);
 DEF_INST(extract_and_set_extended_authority);
-DEF_INST(test_addressing_mode);
 #if defined(FEATURE_ENHANCED_DAT_FACILITY)
 DEF_INST(perform_frame_management_function);                    /*208*/
 #endif /*defined(FEATURE_ENHANCED_DAT_FACILITY)*/
@@ -4352,8 +4737,6 @@ DEF_INST(store_multiple_high);
 DEF_INST(store_multiple_long);
 DEF_INST(load_using_real_address_long);
 DEF_INST(store_using_real_address_long);
-DEF_INST(set_addressing_mode_24);
-DEF_INST(set_addressing_mode_31);
 DEF_INST(set_addressing_mode_64);
 DEF_INST(load_program_status_word_extended);
 DEF_INST(store_long);
@@ -4407,8 +4790,6 @@ DEF_INST(branch_relative_on_index_low_or_equal_long);
 DEF_INST(compare_logical_characters_under_mask_high);
 DEF_INST(store_characters_under_mask_high);
 DEF_INST(insert_characters_under_mask_high);
-DEF_INST(branch_relative_on_condition_long);
-DEF_INST(branch_relative_and_save_long);
 DEF_INST(compare_long_fullword_register);
 DEF_INST(load_positive_long_fullword_register);
 DEF_INST(load_negative_long_fullword_register);
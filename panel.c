@@ -1841,12 +1841,12 @@ size_t  loopcount;                    /* Number of iterations done   */
         /* Set the file descriptors for select */
         FD_ZERO (&readset);
         FD_SET (keybfd, &readset);
-        FD_SET (logger_syslogfd[LOG_READ], &readset);
+        FD_SET (logger_notifyfd[LOG_READ], &readset);
         FD_SET (0, &readset);
-        if(keybfd > logger_syslogfd[LOG_READ])
+        if(keybfd > logger_notifyfd[LOG_READ])
           maxfd = keybfd;
         else
-          maxfd = logger_syslogfd[LOG_READ];
+          maxfd = logger_notifyfd[LOG_READ];
 
         /* Wait for a message to arrive, a key to be pressed,
            or the inactivity interval to expire */
@@ -1875,6 +1875,10 @@ size_t  loopcount;                    /* Number of iterations done   */
 
         ADJ_SCREEN_SIZE();
 
+        /* New messages are picked up further below */
+        if (FD_ISSET(logger_notifyfd[LOG_READ], &readset))
+            log_notify_reset();
+
         /* If keyboard input has arrived then process it */
         if (loopcount && FD_ISSET(keybfd, &readset))
         {
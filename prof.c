@@ -0,0 +1,796 @@
+/* PROF.C       Sampling guest profiler                              */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This module implements the prof command, the profiler thread and  */
+/* the table of samples.  The samples themselves are taken by each   */
+/* CPU thread in process_interrupt, which calls prof_sample with the */
+/* interrupt lock held; the table is serialized by that same lock.   */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#define _PROF_C_
+#define _HENGINE_DLL_
+
+#include "hercules.h"
+#include "prof.h"
+
+/*-------------------------------------------------------------------*/
+/* Sample table entry, one per distinct address and address space    */
+/*-------------------------------------------------------------------*/
+struct PROF_ENT
+{
+    U64     ia;                         /* Instruction address       */
+    U64     asce;                       /* Address space designation,
+                                           zero when DAT is off      */
+    U64     count;                      /* Samples at this address   */
+    U16     asn;                        /* Primary ASN               */
+    BYTE    key;                        /* PSW key                   */
+    BYTE    used;                       /* 1 = Slot is in use        */
+};
+typedef struct PROF_ENT PROF_ENT;
+
+/*-------------------------------------------------------------------*/
+/* Load map symbol                                                   */
+/*-------------------------------------------------------------------*/
+struct PROF_SYM
+{
+    U64     addr;                       /* Start address             */
+    U64     len;                        /* Length, or zero if the
+                                           symbol extends up to the
+                                           next one                  */
+    char*   name;                       /* Symbol name               */
+};
+typedef struct PROF_SYM PROF_SYM;
+
+/* Serialized by the interrupt lock */
+static PROF_ENT*  prof_tab   = NULL;    /* Sample hash table         */
+static U32        prof_slots = 0;       /* Slots in prof_tab (2**n)  */
+static U32        prof_used  = 0;       /* Slots in use              */
+static U64        prof_samples = 0;     /* Samples recorded          */
+static U64        prof_wait  = 0;       /* Samples in wait state     */
+static U64        prof_lost  = 0;       /* Samples not recorded
+                                           because the table is full */
+
+/* Serialized by prof_lock */
+static LOCK       prof_lock;            /* Serializes prof_cmd       */
+static int        prof_inited = 0;      /* 1 = prof_lock initialized */
+static TID        prof_tid;             /* Profiler thread           */
+static U32        prof_rate  = 0;       /* Samples per second        */
+static PROF_SYM*  prof_syms  = NULL;    /* Load map, sorted by addr  */
+static int        prof_nsyms = 0;       /* Symbols in prof_syms      */
+static char       prof_mapname[MAX_PATH]; /* Load map file name      */
+
+static volatile int prof_active = 0;    /* 1 = Profiler is sampling  */
+
+/*-------------------------------------------------------------------*/
+/* Hash an address and address space into a table index             */
+/*-------------------------------------------------------------------*/
+static INLINE U32 prof_hash( U64 ia, U64 asce, U16 asn, BYTE key )
+{
+    U64  h;
+
+    h  = ia ^ (asce * 0x9E3779B97F4A7C15ULL) ^ ((U64) asn << 48) ^ ((U64) key << 40);
+    h *= 0x9E3779B97F4A7C15ULL;
+    return (U32)(h >> 32);
+}
+
+/*-------------------------------------------------------------------*/
+/* Record one sample.  Called by a CPU thread holding the interrupt  */
+/* lock, after the profiler thread asked it for a sample.            */
+/*-------------------------------------------------------------------*/
+void prof_sample( U64 ia, U64 asce, U16 asn, BYTE key )
+{
+    PROF_ENT*  ent;
+    U32        mask, i;
+
+    if (!prof_tab || !prof_active)
+        return;
+
+    mask = prof_slots - 1;
+    for (i = prof_hash( ia, asce, asn, key ) & mask; ; i = (i + 1) & mask)
+    {
+        ent = &prof_tab[i];
+
+        if (!ent->used)
+        {
+            /* Keep a quarter of the table free so probes stay short */
+            if (prof_used >= prof_slots - prof_slots / 4)
+            {
+                prof_lost++;
+                return;
+            }
+            ent->used  = 1;
+            ent->ia    = ia;
+            ent->asce  = asce;
+            ent->asn   = asn;
+            ent->key   = key;
+            ent->count = 0;
+            prof_used++;
+            break;
+        }
+
+        if (ent->ia == ia && ent->asce == asce
+         && ent->asn == asn && ent->key == key)
+            break;
+    }
+
+    ent->count++;
+    prof_samples++;
+}
+
+/*-------------------------------------------------------------------*/
+/* Profiler thread: ask each started processor for a sample.  The    */
+/* PSW address is only current in the CPU thread itself, so the      */
+/* sample is taken there, at its next interrupt check.  A processor  */
+/* in wait state is not running guest code and is only counted.      */
+/*-------------------------------------------------------------------*/
+static void* prof_thread( void* arg )
+{
+    REGS*  regs;
+    int    i;
+
+    UNREFERENCED( arg );
+
+    while (prof_active)
+    {
+        usleep( 1000000 / prof_rate );
+
+        OBTAIN_INTLOCK( NULL );
+
+        for (i=0; prof_active && i < sysblk.maxcpu; i++)
+        {
+            if (!IS_CPU_ONLINE( i ))
+                continue;
+
+            regs = sysblk.regs[i];
+            if (regs->cpustate != CPUSTATE_STARTED)
+                continue;
+
+            if (WAITSTATE( &regs->psw ))
+                prof_wait++;
+            else
+            {
+                regs->profsample = 1;
+                ON_IC_INTERRUPT( regs );
+            }
+        }
+
+        RELEASE_INTLOCK( NULL );
+    }
+
+    return NULL;
+}
+
+/*-------------------------------------------------------------------*/
+/* Start sampling into a new, empty table.  Caller holds prof_lock.  */
+/*-------------------------------------------------------------------*/
+static int prof_start( U32 rate, U32 slots )
+{
+    PROF_ENT*  tab;
+    PROF_ENT*  old;
+    int        rc;
+
+    if (!(tab = calloc( slots, sizeof( PROF_ENT ))))
+    {
+        // "Error in function %s: %s"
+        WRMSG( HHC00075, "E", "calloc()", strerror( errno ));
+        return -1;
+    }
+
+    OBTAIN_INTLOCK( NULL );
+    old          = prof_tab;
+    prof_tab     = tab;
+    prof_slots   = slots;
+    prof_used    = 0;
+    prof_samples = 0;
+    prof_wait    = 0;
+    prof_lost    = 0;
+    prof_active  = 1;
+    RELEASE_INTLOCK( NULL );
+
+    free( old );
+
+    prof_rate = rate;
+    rc = create_thread( &prof_tid, JOINABLE, prof_thread, NULL, "prof_thread" );
+    if (rc)
+    {
+        // "Error in function create_thread(): %s"
+        WRMSG( HHC00102, "E", strerror( rc ));
+        prof_active = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Stop sampling, keeping the table for reports.  Caller holds       */
+/* prof_lock.                                                        */
+/*-------------------------------------------------------------------*/
+static void prof_stop( void )
+{
+    if (!prof_active)
+        return;
+
+    OBTAIN_INTLOCK( NULL );
+    prof_active = 0;
+    RELEASE_INTLOCK( NULL );
+
+    join_thread( prof_tid, NULL );
+}
+
+/*-------------------------------------------------------------------*/
+/* Copy the entries in use out of the table, so that the reports do  */
+/* not hold the interrupt lock while sorting and formatting.         */
+/*-------------------------------------------------------------------*/
+static PROF_ENT* prof_snapshot( U32* nent, U64* samples, U64* wait, U64* lost )
+{
+    PROF_ENT*  ents;
+    U32        i, n;
+
+    OBTAIN_INTLOCK( NULL );
+
+    *samples = prof_samples;
+    *wait    = prof_wait;
+    *lost    = prof_lost;
+
+    if (!(ents = malloc( (prof_used ? prof_used : 1) * sizeof( PROF_ENT ))))
+    {
+        RELEASE_INTLOCK( NULL );
+        *nent = 0;
+        return NULL;
+    }
+
+    for (n=0, i=0; i < prof_slots; i++)
+        if (prof_tab[i].used)
+            ents[n++] = prof_tab[i];
+
+    RELEASE_INTLOCK( NULL );
+
+    *nent = n;
+    return ents;
+}
+
+static int sortby_count( const PROF_ENT* p1, const PROF_ENT* p2 )
+{
+    if (p1->count != p2->count)
+        return (p1->count > p2->count) ? -1 : 1;
+    return (p1->ia < p2->ia) ? -1 : (p1->ia > p2->ia) ? 1 : 0;
+}
+
+static int sortby_addr( const PROF_ENT* p1, const PROF_ENT* p2 )
+{
+    return (p1->ia < p2->ia) ? -1 : (p1->ia > p2->ia) ? 1 : 0;
+}
+
+static int sortby_symaddr( const PROF_SYM* p1, const PROF_SYM* p2 )
+{
+    return (p1->addr < p2->addr) ? -1 : (p1->addr > p2->addr) ? 1 : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Find the load map symbol containing an address                    */
+/*-------------------------------------------------------------------*/
+static const PROF_SYM* prof_lookup( U64 addr )
+{
+    const PROF_SYM*  sym = NULL;
+    int              lo = 0, hi = prof_nsyms - 1, mid;
+
+    while (lo <= hi)
+    {
+        mid = (lo + hi) / 2;
+        if (prof_syms[mid].addr <= addr)
+        {
+            sym = &prof_syms[mid];
+            lo  = mid + 1;
+        }
+        else
+            hi  = mid - 1;
+    }
+
+    if (sym && sym->len && addr - sym->addr >= sym->len)
+        return NULL;
+    return sym;
+}
+
+/*-------------------------------------------------------------------*/
+/* Format an address as "symbol+offset", or "" without a symbol      */
+/*-------------------------------------------------------------------*/
+static char* prof_symbol( U64 addr, char* buf, size_t bufsz )
+{
+    const PROF_SYM*  sym = prof_lookup( addr );
+
+    if (!sym)
+        buf[0] = '\0';
+    else if (addr == sym->addr)
+        strlcpy( buf, sym->name, bufsz );
+    else
+        snprintf( buf, bufsz, "%s+%"PRIX64, sym->name, addr - sym->addr );
+    return buf;
+}
+
+/*-------------------------------------------------------------------*/
+/* Format an address with the width of the current architecture      */
+/*-------------------------------------------------------------------*/
+static char* prof_addr( U64 addr, char* buf, size_t bufsz )
+{
+    if (sysblk.arch_mode == ARCH_900)
+        snprintf( buf, bufsz, "%16.16"PRIX64, addr );
+    else
+        snprintf( buf, bufsz, "%8.8"PRIX64, addr );
+    return buf;
+}
+
+/*-------------------------------------------------------------------*/
+/* Display the totals which precede each report                      */
+/*-------------------------------------------------------------------*/
+static void prof_totals( U32 nent, U64 samples, U64 wait, U64 lost )
+{
+    // "Profile of %"I64_FMT"u samples, %"I64_FMT"u in wait state, %"I64_FMT"u lost (table full), %u entries"
+    WRMSG( HHC02951, "I", samples, wait, lost, nent );
+}
+
+/*-------------------------------------------------------------------*/
+/* Report the addresses with the most samples                        */
+/*-------------------------------------------------------------------*/
+static void prof_top( U32 top )
+{
+    PROF_ENT*  ents;
+    U32        nent, i;
+    U64        samples, wait, lost;
+    char       addr[32];
+    char       space[32];
+    char       sym[128];
+
+    if (!(ents = prof_snapshot( &nent, &samples, &wait, &lost )))
+        return;
+
+    prof_totals( nent, samples, wait, lost );
+
+    qsort( ents, nent, sizeof( PROF_ENT ), (CMPFUNC*) sortby_count );
+
+    for (i=0; i < nent && i < top; i++)
+    {
+        if (ents[i].asce)
+            MSGBUF( space, "ASN %4.4X key %X", ents[i].asn, ents[i].key );
+        else
+            MSGBUF( space, "real     key %X", ents[i].key );
+
+        // "%5.1f%% %12"I64_FMT"u %s %s %s"
+        WRMSG( HHC02952, "I", (100.0 * ents[i].count) / samples,
+               ents[i].count, prof_addr( ents[i].ia, addr, sizeof( addr )),
+               space, prof_symbol( ents[i].ia, sym, sizeof( sym )));
+    }
+
+    free( ents );
+}
+
+/*-------------------------------------------------------------------*/
+/* Report the address ranges of 'gran' bytes with the most samples,  */
+/* summed over all address spaces                                    */
+/*-------------------------------------------------------------------*/
+static void prof_ranges( U64 gran, U32 top )
+{
+    PROF_ENT*  ents;
+    U32        nent, i, n;
+    U64        samples, wait, lost;
+    char       from[32], to[32];
+    char       sym[128];
+
+    if (!(ents = prof_snapshot( &nent, &samples, &wait, &lost )))
+        return;
+
+    /* Merge the entries falling in the same range */
+    for (i=0; i < nent; i++)
+        ents[i].ia -= ents[i].ia % gran;
+
+    qsort( ents, nent, sizeof( PROF_ENT ), (CMPFUNC*) sortby_addr );
+
+    for (n=0, i=0; i < nent; i++)
+    {
+        if (n && ents[n-1].ia == ents[i].ia)
+            ents[n-1].count += ents[i].count;
+        else
+            ents[n++] = ents[i];
+    }
+
+    prof_totals( n, samples, wait, lost );
+
+    qsort( ents, n, sizeof( PROF_ENT ), (CMPFUNC*) sortby_count );
+
+    for (i=0; i < n && i < top; i++)
+    {
+        // "%5.1f%% %12"I64_FMT"u %s-%s %s"
+        WRMSG( HHC02953, "I", (100.0 * ents[i].count) / samples,
+               ents[i].count, prof_addr( ents[i].ia, from, sizeof( from )),
+               prof_addr( ents[i].ia + gran - 1, to, sizeof( to )),
+               prof_symbol( ents[i].ia, sym, sizeof( sym )));
+    }
+
+    free( ents );
+}
+
+/*-------------------------------------------------------------------*/
+/* Write the samples in folded stack format, one line per address:   */
+/*                                                                   */
+/*   ASN_0021;symbol;symbol+offset count                             */
+/*                                                                   */
+/* The guest call stack is not known, so each stack is the address   */
+/* space, the load map symbol (or the 4K page) and the address.      */
+/* The output can be fed directly to flamegraph.pl.                  */
+/*-------------------------------------------------------------------*/
+static int prof_fold( const char* filename )
+{
+    PROF_ENT*        ents;
+    const PROF_SYM*  sym;
+    FILE*            f;
+    U32              nent, i;
+    U64              samples, wait, lost;
+    char             pathname[MAX_PATH];
+    char             space[16];
+    char             frame[128];
+    char             label[128];
+
+    if (!(ents = prof_snapshot( &nent, &samples, &wait, &lost )))
+        return -1;
+
+    hostpath( pathname, filename, sizeof( pathname ));
+    if (!(f = fopen( pathname, "w" )))
+    {
+        // "Profiler file %s: error in function %s: %s"
+        WRMSG( HHC02957, "E", filename, "fopen()", strerror( errno ));
+        free( ents );
+        return -1;
+    }
+
+    qsort( ents, nent, sizeof( PROF_ENT ), (CMPFUNC*) sortby_addr );
+
+    for (i=0; i < nent; i++)
+    {
+        if (ents[i].asce)
+            MSGBUF( space, "ASN_%4.4X", ents[i].asn );
+        else
+            strlcpy( space, "real", sizeof( space ));
+
+        if ((sym = prof_lookup( ents[i].ia )))
+        {
+            strlcpy( frame, sym->name, sizeof( frame ));
+            prof_symbol( ents[i].ia, label, sizeof( label ));
+        }
+        else
+        {
+            MSGBUF( frame, "%"PRIX64, ents[i].ia & ~(U64) 0xFFF );
+            MSGBUF( label, "%"PRIX64, ents[i].ia );
+        }
+
+        fprintf( f, "%s;%s;%s %"PRIu64"\n", space, frame, label, ents[i].count );
+    }
+
+    if (fclose( f ) != 0)
+    {
+        // "Profiler file %s: error in function %s: %s"
+        WRMSG( HHC02957, "E", filename, "fclose()", strerror( errno ));
+        free( ents );
+        return -1;
+    }
+
+    // "Profiler file %s: %u folded stacks written"
+    WRMSG( HHC02956, "I", filename, nent );
+    free( ents );
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Discard the load map.  Caller holds prof_lock.                    */
+/*-------------------------------------------------------------------*/
+static void prof_freemap( void )
+{
+    int  i;
+
+    for (i=0; i < prof_nsyms; i++)
+        free( prof_syms[i].name );
+    free( prof_syms );
+
+    prof_syms  = NULL;
+    prof_nsyms = 0;
+    prof_mapname[0] = '\0';
+}
+
+/*-------------------------------------------------------------------*/
+/* Load a map of symbols, one per line:                              */
+/*                                                                   */
+/*   address [length] name                                           */
+/*                                                                   */
+/* where address and length are hexadecimal.  Blank lines and lines  */
+/* starting with '#' or '*' are ignored.  Caller holds prof_lock.    */
+/*-------------------------------------------------------------------*/
+static int prof_loadmap( const char* filename )
+{
+    PROF_SYM*  syms = NULL;
+    PROF_SYM*  p;
+    FILE*      f;
+    int        nsyms = 0, maxsyms = 0;
+    int        lineno = 0;
+    int        ntok;
+    char*      tok[4];
+    char*      strtok_str = NULL;
+    char       c;
+    char       pathname[MAX_PATH];
+    char       line[512];
+
+    hostpath( pathname, filename, sizeof( pathname ));
+    if (!(f = fopen( pathname, "r" )))
+    {
+        // "Profiler file %s: error in function %s: %s"
+        WRMSG( HHC02957, "E", filename, "fopen()", strerror( errno ));
+        return -1;
+    }
+
+    while (fgets( line, sizeof( line ), f ))
+    {
+        lineno++;
+
+        for (ntok=0; ntok < 4; ntok++)
+            if (!(tok[ntok] = strtok_r( ntok ? NULL : line, " \t\r\n", &strtok_str )))
+                break;
+
+        if (!ntok || tok[0][0] == '#' || tok[0][0] == '*')
+            continue;
+
+        if (ntok < 2 || ntok > 3)
+        {
+            // "Profiler map file %s line %d: invalid entry ignored"
+            WRMSG( HHC02955, "W", filename, lineno );
+            continue;
+        }
+
+        if (nsyms == maxsyms)
+        {
+            maxsyms = maxsyms ? maxsyms * 2 : 256;
+            if (!(p = realloc( syms, maxsyms * sizeof( PROF_SYM ))))
+            {
+                // "Profiler file %s: error in function %s: %s"
+                WRMSG( HHC02957, "E", filename, "realloc()", strerror( errno ));
+                break;
+            }
+            syms = p;
+        }
+
+        p = &syms[nsyms];
+        p->len = 0;
+        if (0
+            || sscanf( tok[0], "%"SCNx64"%c", &p->addr, &c ) != 1
+            || (ntok == 3 && sscanf( tok[1], "%"SCNx64"%c", &p->len, &c ) != 1)
+        )
+        {
+            // "Profiler map file %s line %d: invalid entry ignored"
+            WRMSG( HHC02955, "W", filename, lineno );
+            continue;
+        }
+
+        p->name = strdup( tok[ntok-1] );
+        nsyms++;
+    }
+
+    fclose( f );
+
+    if (nsyms)
+        qsort( syms, nsyms, sizeof( PROF_SYM ), (CMPFUNC*) sortby_symaddr );
+
+    prof_freemap();
+    prof_syms  = syms;
+    prof_nsyms = nsyms;
+    strlcpy( prof_mapname, filename, sizeof( prof_mapname ));
+
+    // "Profiler map file %s: %d symbols loaded"
+    WRMSG( HHC02954, "I", filename, nsyms );
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Display the profiler status                                       */
+/*-------------------------------------------------------------------*/
+static void prof_status( void )
+{
+    char  buf[MAX_PATH + 128];
+    U64   samples;
+    U32   used, slots;
+
+    OBTAIN_INTLOCK( NULL );
+    samples = prof_samples;
+    used    = prof_used;
+    slots   = prof_slots;
+    RELEASE_INTLOCK( NULL );
+
+    MSGBUF( buf, ", %u samples per second, %"PRIu64" samples, %u of %u slots used%s%s",
+            prof_rate, samples, used, slots,
+            prof_nsyms ? ", map " : "", prof_nsyms ? prof_mapname : "" );
+
+    // "Profiler is %s%s"
+    WRMSG( HHC02950, "I", prof_active ? "on" : "off", prof_tab ? buf : "" );
+}
+
+/*-------------------------------------------------------------------*/
+/* Parse a positive decimal or hexadecimal number                    */
+/*-------------------------------------------------------------------*/
+static int prof_number( const char* str, int hex, U64 min, U64 max, U64* value )
+{
+    char  c;
+
+    if (sscanf( str, hex ? "%"SCNx64"%c" : "%"SCNu64"%c", value, &c ) != 1
+        || *value < min || *value > max)
+    {
+        WRMSG( HHC02205, "E", str, "" );
+        return -1;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* prof command                                                      */
+/*                                                                   */
+/*   prof                       display the profiler status          */
+/*   prof start [rate=n] [slots=n]                                   */
+/*                              start a new profile                  */
+/*   prof stop                  stop sampling                        */
+/*   prof top [n]               report the n hottest addresses       */
+/*   prof ranges [size [n]]     report the n hottest address ranges  */
+/*   prof map file | none       load or discard a load map           */
+/*   prof fold file             write the profile as folded stacks   */
+/*-------------------------------------------------------------------*/
+int prof_cmd( int argc, char* argv[], char* cmdline )
+{
+    U64    value;
+    U64    gran  = PROF_DEFGRAN;
+    U32    top   = PROF_DEFTOP;
+    U32    rate  = PROF_DEFRATE;
+    U32    slots = PROF_DEFSLOTS;
+    int    rc    = 0;
+    int    i;
+
+    UNREFERENCED( cmdline );
+
+    if (!prof_inited)
+    {
+        initialize_lock( &prof_lock );
+        prof_inited = 1;
+    }
+
+    if (argc < 2)
+    {
+        obtain_lock( &prof_lock );
+        prof_status();
+        release_lock( &prof_lock );
+        return 0;
+    }
+
+    if (strcasecmp( argv[1], "start" ) == 0)
+    {
+        for (i=2; i < argc; i++)
+        {
+            if (strncasecmp( argv[i], "rate=", 5 ) == 0)
+            {
+                if (prof_number( argv[i] + 5, 0, 1, PROF_MAXRATE, &value ) != 0)
+                    return -1;
+                rate = (U32) value;
+            }
+            else if (strncasecmp( argv[i], "slots=", 6 ) == 0)
+            {
+                if (prof_number( argv[i] + 6, 0, PROF_MINSLOTS, PROF_MAXSLOTS, &value ) != 0)
+                    return -1;
+                /* Round up to a power of two */
+                for (slots = PROF_MINSLOTS; slots < value; slots <<= 1);
+            }
+            else
+            {
+                WRMSG( HHC02205, "E", argv[i], "" );
+                return -1;
+            }
+        }
+
+        obtain_lock( &prof_lock );
+        prof_stop();
+        rc = prof_start( rate, slots );
+        if (rc == 0)
+            prof_status();
+        release_lock( &prof_lock );
+        return rc;
+    }
+
+    if (strcasecmp( argv[1], "stop" ) == 0 && argc == 2)
+    {
+        obtain_lock( &prof_lock );
+        prof_stop();
+        prof_status();
+        release_lock( &prof_lock );
+        return 0;
+    }
+
+    if (strcasecmp( argv[1], "map" ) == 0 && argc == 3)
+    {
+        obtain_lock( &prof_lock );
+        if (strcasecmp( argv[2], "none" ) == 0)
+        {
+            prof_freemap();
+            prof_status();
+        }
+        else
+            rc = prof_loadmap( argv[2] );
+        release_lock( &prof_lock );
+        return rc;
+    }
+
+    if (0
+        || strcasecmp( argv[1], "top" ) == 0
+        || strcasecmp( argv[1], "ranges" ) == 0
+        || strcasecmp( argv[1], "fold" ) == 0
+    )
+    {
+        if (!prof_tab)
+        {
+            // "Profiler is %s%s"
+            WRMSG( HHC02950, "E", "off", ", no samples to report" );
+            return -1;
+        }
+
+        if (strcasecmp( argv[1], "fold" ) == 0)
+        {
+            if (argc != 3)
+            {
+                WRMSG( HHC02299, "E", argv[0] );
+                return -1;
+            }
+            obtain_lock( &prof_lock );
+            rc = prof_fold( argv[2] );
+            release_lock( &prof_lock );
+            return rc;
+        }
+
+        if (strcasecmp( argv[1], "top" ) == 0)
+        {
+            if (argc > 3)
+            {
+                WRMSG( HHC02299, "E", argv[0] );
+                return -1;
+            }
+            if (argc == 3)
+            {
+                if (prof_number( argv[2], 0, 1, 0xFFFFFFFF, &value ) != 0)
+                    return -1;
+                top = (U32) value;
+            }
+            obtain_lock( &prof_lock );
+            prof_top( top );
+            release_lock( &prof_lock );
+            return 0;
+        }
+
+        if (argc > 4)
+        {
+            WRMSG( HHC02299, "E", argv[0] );
+            return -1;
+        }
+        if (argc >= 3)
+        {
+            if (prof_number( argv[2], 1, 2, 0x100000000ULL, &gran ) != 0)
+                return -1;
+        }
+        if (argc == 4)
+        {
+            if (prof_number( argv[3], 0, 1, 0xFFFFFFFF, &value ) != 0)
+                return -1;
+            top = (U32) value;
+        }
+        obtain_lock( &prof_lock );
+        prof_ranges( gran, top );
+        release_lock( &prof_lock );
+        return 0;
+    }
+
+    WRMSG( HHC02205, "E", argv[1], "" );
+    return -1;
+}
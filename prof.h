@@ -0,0 +1,30 @@
+/* PROF.H       Sampling guest profiler                              */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* The profiler thread wakes up at a fixed rate and asks each        */
+/* started processor for a sample.  The processor takes it at its    */
+/* next interrupt check, recording the instruction address, address  */
+/* space and key of the PSW into a hash table of sample counts.  The */
+/* prof command reports the table, optionally symbolized from a load */
+/* map, and exports it in folded stack format for flame graphs.      */
+/*-------------------------------------------------------------------*/
+
+#ifndef _PROF_H_
+#define _PROF_H_
+
+#define PROF_DEFRATE        1000        /* Default samples per second*/
+#define PROF_MAXRATE        10000       /* Maximum samples per second*/
+#define PROF_DEFSLOTS       65536       /* Default hash table slots  */
+#define PROF_MINSLOTS       1024        /* Minimum hash table slots  */
+#define PROF_MAXSLOTS       (16*1024*1024) /* Maximum hash table slots*/
+#define PROF_DEFTOP         20          /* Default report lines      */
+#define PROF_DEFGRAN        4096        /* Default range granularity */
+
+void prof_sample( U64 ia, U64 asce, U16 asn, BYTE key );
+int  prof_cmd( int argc, char* argv[], char* cmdline );
+
+#endif /* _PROF_H_ */
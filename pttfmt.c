@@ -0,0 +1,191 @@
+/* PTTFMT.C     Merge and format PTT binary dump files               */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This program reads one or more PTT binary dump files written by   */
+/* the "ptt dump=filename" command, merges their entries into time   */
+/* sequence and writes them to the standard output in the same       */
+/* format as the ptt command displays the trace table.               */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#include "hercules.h"
+
+#define UTILITY_NAME    "pttfmt"
+
+/*-------------------------------------------------------------------*/
+/* Formatted trace entry                                             */
+/*-------------------------------------------------------------------*/
+struct PTTFMT_ENT
+{
+    U64         usec;                   /* Time of day, 0 if notod   */
+    U64         tid;                    /* Thread id                 */
+    U64         trclass;                /* Trace class               */
+    U64         data1;                  /* Data 1                    */
+    U64         data2;                  /* Data 2                    */
+    int         rc;                     /* Return code               */
+    int         file;                   /* Input file number         */
+    U64         seq;                    /* Sequence within file      */
+    char*       msg;                    /* Trace message             */
+    char*       loc;                    /* File name:line number     */
+};
+typedef struct PTTFMT_ENT PTTFMT_ENT;
+
+static PTTFMT_ENT*  ent   = NULL;       /* Entries of all files      */
+static U64          nent  = 0;          /* Number of entries         */
+static U64          maxent = 0;         /* Entries allocated         */
+
+/*-------------------------------------------------------------------*/
+/* Sort entries by time, then by file and sequence within the file   */
+/*-------------------------------------------------------------------*/
+static int sortby_time( const PTTFMT_ENT* p1, const PTTFMT_ENT* p2 )
+{
+    if (p1->usec != p2->usec)
+        return (p1->usec < p2->usec) ? -1 : 1;
+    if (p1->file != p2->file)
+        return (p1->file < p2->file) ? -1 : 1;
+    return (p1->seq < p2->seq) ? -1 : (p1->seq > p2->seq) ? 1 : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Read all entries of one dump file.  Returns 0 if successful.      */
+/*-------------------------------------------------------------------*/
+static int read_dump( const char* filename, int file )
+{
+    PTT_DUMPHDR  hdr;                   /* Dump file header          */
+    PTT_DUMPREC  rec;                   /* Dump file record          */
+    PTTFMT_ENT*  p;                     /* -> Formatted entry        */
+    U64          tick0, usec0;          /* Clock calibration pair 0  */
+    U64          tick1, usec1;          /* Clock calibration pair 1  */
+    U64          count, tick, i;
+    FILE*        f;
+    char         pathname[MAX_PATH];    /* file path in host format  */
+
+    hostpath( pathname, filename, sizeof( pathname ));
+    if (!(f = fopen( pathname, "rb" )))
+    {
+        fprintf( stderr, UTILITY_NAME ": Error opening %s: %s\n",
+                 filename, strerror( errno ));
+        return -1;
+    }
+
+    if (0
+        || fread( &hdr, sizeof( hdr ), 1, f ) != 1
+        || memcmp( hdr.magic, PTT_DUMP_MAGIC, sizeof( hdr.magic )) != 0
+    )
+    {
+        fprintf( stderr, UTILITY_NAME ": %s is not a PTT dump file\n",
+                 filename );
+        fclose( f );
+        return -1;
+    }
+
+    tick0 = fetch_dw( hdr.tick0 );
+    usec0 = fetch_dw( hdr.usec0 );
+    tick1 = fetch_dw( hdr.tick1 );
+    usec1 = fetch_dw( hdr.usec1 );
+    count = fetch_dw( hdr.count );
+
+    for (i=0; i < count; i++)
+    {
+        if (nent >= maxent)
+        {
+            maxent = maxent ? (maxent * 2) : 4096;
+            if (!(ent = realloc( ent, (size_t)( maxent * sizeof( PTTFMT_ENT )))))
+            {
+                fprintf( stderr, UTILITY_NAME ": Out of memory\n" );
+                exit( 3 );
+            }
+        }
+        p = &ent[ nent ];
+
+        if (fread( &rec, sizeof( rec ), 1, f ) != 1
+         || !(p->msg = malloc( rec.msglen + 1 ))
+         || !(p->loc = malloc( rec.loclen + 1 ))
+         || fread( p->msg, 1, rec.msglen, f ) != rec.msglen
+         || fread( p->loc, 1, rec.loclen, f ) != rec.loclen)
+        {
+            fprintf( stderr, UTILITY_NAME ": %s is truncated after %"
+                     PRIu64 " of %" PRIu64 " entries\n", filename, i, count );
+            fclose( f );
+            return -1;
+        }
+        p->msg[ rec.msglen ] = 0;
+        p->loc[ rec.loclen ] = 0;
+
+        tick       = fetch_dw( rec.tick );
+        p->usec    = tick ? ptt_tick2usec( tick, tick0, usec0, tick1, usec1 ) : 0;
+        p->tid     = fetch_dw( rec.tid );
+        p->trclass = fetch_dw( rec.trclass );
+        p->data1   = fetch_dw( rec.data1 );
+        p->data2   = fetch_dw( rec.data2 );
+        p->rc      = (int) fetch_fw( rec.rc );
+        p->file    = file;
+        p->seq     = i;
+        nent++;
+    }
+
+    fclose( f );
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* PTTFMT main entry point                                           */
+/*-------------------------------------------------------------------*/
+int main( int argc, char* argv[] )
+{
+    PTTFMT_ENT*  p;                     /* -> Formatted entry        */
+    TIMEVAL      tv;                    /* Entry time of day         */
+    char         tod[27];               /* "YYYY-MM-DD HH:MM:SS.uuuuuu" */
+    char         retcode[32];           /* Formatted return code     */
+    U64          i;
+    int          file;
+
+    INITIALIZE_UTILITY( UTILITY_NAME,
+        "PTT dump file merge and format program", NULL );
+
+    /* The arguments are the names of the dump files to be merged */
+    if (argc < 2)
+    {
+        fprintf( stderr, "Usage: " UTILITY_NAME " dumpfile [dumpfile ...]\n" );
+        exit( 1 );
+    }
+
+    for (file=1; file < argc; file++)
+        if (read_dump( argv[ file ], file ) != 0)
+            exit( 2 );
+
+    if (nent)
+        qsort( ent, (size_t) nent, sizeof( PTTFMT_ENT ), (CMPFUNC*) sortby_time );
+
+    for (i=0; i < nent; i++)
+    {
+        p = &ent[i];
+
+        if (p->usec)
+        {
+            tv.tv_sec  = (long)(p->usec / 1000000);
+            tv.tv_usec = (long)(p->usec % 1000000);
+            FormatTIMEVAL( &tv, tod, sizeof( tod ));
+        }
+        else
+            strlcpy( tod, "---------- --:--:--.------", sizeof( tod ));
+
+        /* Format the return code the same way the ptt command does */
+        if (p->rc == PTT_MAGIC && (p->trclass & PTT_CL_THR))
+            retcode[0] = '\0';
+        else if ((p->trclass & ~PTT_CL_THR))
+            MSGBUF( retcode, "%8.8"PRIx32, (U32) p->rc );
+        else
+            MSGBUF( retcode, "%d", p->rc );
+
+        printf( "%-18s %s %16.16"PRIx64" %-18s %16.16"PRIx64" %16.16"PRIx64" %s\n",
+            p->loc, tod, p->tid, p->msg, p->data1, p->data2, retcode );
+    }
+
+    return 0;
+}
@@ -21,17 +21,58 @@
 /*-------------------------------------------------------------------*/
 struct PTT_TRACE
 {
+    U64             tick;               /* Trace clock, 0 if notod   */
+    U64             seq;                /* Sequence within thread    */
     TID             tid;                /* Thread id                 */
     U64             trclass;            /* Trace class (see header)  */
     const char*     msg;                /* Trace message             */
     const void*     data1;              /* Data 1                    */
     const void*     data2;              /* Data 2                    */
     const char*     loc;                /* File name:line number     */
-    struct timeval  tv;                 /* Time of day               */
     int             rc;                 /* Return code               */
 };
 typedef struct PTT_TRACE PTT_TRACE;
 
+/*-------------------------------------------------------------------*/
+/* Per-thread Trace Table                                            */
+/*                                                                   */
+/* Each thread traces into its own table, obtained the first time it */
+/* traces anything, so recording an entry needs no lock at all.  The */
+/* tables are chained together for printing and dumping, and when a  */
+/* thread ends its table is left on the chain for the next new       */
+/* thread to reuse.  Tables are only ever freed when the table size  */
+/* is changed; 'pttgen' is then bumped so each thread notices that   */
+/* the table it remembers is gone.                                   */
+/*                                                                   */
+/* Whether a call site is a timer or logger one (which are only      */
+/* traced when their own class is also active) is decided the first  */
+/* time the site traces anything and remembered in a small cache,    */
+/* rather than by comparing file names on every event.               */
+/*-------------------------------------------------------------------*/
+#define PTT_LOCMAP      64              /* Call site cache entries   */
+
+struct PTT_TBUF
+{
+    struct PTT_TBUF* next;              /* Next table in chain       */
+    TID             tid;                /* Owning thread or 0 = free */
+    int             n;                  /* Number of table entries   */
+    int             x;                  /* Index of next entry       */
+    U64             seq;                /* Sequence of next entry    */
+    const char*     locmap[PTT_LOCMAP]; /* Call sites seen so far    */
+    U64             loccl[PTT_LOCMAP];  /* Extra class they require  */
+    PTT_TRACE*      ent;                /* Table entries             */
+};
+typedef struct PTT_TBUF PTT_TBUF;
+
+/*-------------------------------------------------------------------*/
+/* Thread local storage for each thread's own trace table            */
+/*-------------------------------------------------------------------*/
+#if defined( _MSVC_ )
+  #define PTT_TLS               __declspec( thread )
+#else
+  #define PTT_TLS               __thread
+#endif
+
 /*-------------------------------------------------------------------*/
 /* Trace classes table                                               */
 /*-------------------------------------------------------------------*/
@@ -50,11 +91,15 @@ typedef struct PTTCL PTTCL;
 HLOCK      pttlock;                     /* Pthreads trace lock       */
 DLL_EXPORT U64 pttclass  = 0;           /* Pthreads trace class      */
 DLL_EXPORT int pttthread = 0;           /* pthreads is active        */
-int        pttracen      = 0;           /* Number of table entries   */
-int        pttracex      = 0;           /* Index of current entry    */
-PTT_TRACE *pttrace       = NULL;        /* Pointer to current entry  */
+int        pttracen      = 0;           /* Entries per thread table  */
+PTT_TBUF  *pttbufs       = NULL;        /* Chain of thread tables    */
+int        pttgen        = 0;           /* Thread tables generation  */
+static PTT_TLS PTT_TBUF *ptttbuf;       /* This thread's table       */
+static PTT_TLS int       ptttgen;       /* ...and its generation     */
+U64        ptttick0      = 0;           /* Trace clock at init       */
+U64        pttusec0      = 0;           /* Time of day at init       */
 int        pttnolock     = 0;           /* 1=no table locking        */
-int        pttnotod      = 0;           /* 1=don't call gettimeofday */
+int        pttnotod      = 0;           /* 1=don't timestamp entries */
 int        pttnowrap     = 0;           /* 1=don't wrap              */
 int        pttto         = 0;           /* timeout in seconds        */
 COND       ptttocond;                   /* timeout thread condition  */
@@ -95,8 +140,18 @@ PTTCL      pttcltab[] =                 /* trace class names table   */
 /*-------------------------------------------------------------------*/
 #define PTT_TRACE_SIZE          sizeof(PTT_TRACE)
 
+#if defined( ASSIST_RDTSC )
+  #define PTT_CLOCK()           rdtsc()
+#else
+  #define PTT_CLOCK()           ptt_usec()
+#endif
+
+/* The PTT lock only serializes allocating and freeing the thread    */
+/* tables.  Recording an entry never takes it, so 'nolock' is only   */
+/* accepted for compatibility.                                       */
+
 #define OBTAIN_PTTLOCK                                               \
-  do if (!pttnolock) {                                               \
+  do {                                                               \
     int rc = hthread_mutex_lock( &pttlock );                         \
     if (rc)                                                          \
       BREAK_INTO_DEBUGGER();                                         \
@@ -104,13 +159,37 @@ PTTCL      pttcltab[] =                 /* trace class names table   */
   while (0)
 
 #define RELEASE_PTTLOCK                                              \
-  do if (!pttnolock) {                                               \
+  do {                                                               \
     int rc = hthread_mutex_unlock( &pttlock );                       \
     if (rc)                                                          \
       BREAK_INTO_DEBUGGER();                                         \
   }                                                                  \
   while (0)
 
+/*-------------------------------------------------------------------*/
+/* Time of day in microseconds, used to calibrate the trace clock    */
+/*-------------------------------------------------------------------*/
+static U64 ptt_usec()
+{
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return ((U64) tv.tv_sec * 1000000) + tv.tv_usec;
+}
+
+/*-------------------------------------------------------------------*/
+/* Convert a trace clock value to time of day in microseconds, given */
+/* two trace clock/time of day pairs taken some time apart.          */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT U64 ptt_tick2usec( U64 tick, U64 tick0, U64 usec0,
+                                        U64 tick1, U64 usec1 )
+{
+    if (tick1 <= tick0)
+        return usec0;
+    return usec0 + (S64)((double)(S64)(tick - tick0)
+                       * (double)(usec1 - usec0)
+                       / (double)(tick1 - tick0));
+}
+
 /*-------------------------------------------------------------------*/
 /* Trace classes table lookup and helper functions                   */
 /*-------------------------------------------------------------------*/
@@ -169,6 +248,28 @@ static char* pttcl_all( U64 trcl, char** ppStr )
     return *ppStr;
 }
 
+/*-------------------------------------------------------------------*/
+/* Free all trace tables.  Called with the PTT lock held and tracing */
+/* stopped (pttracen == 0).                                          */
+/*-------------------------------------------------------------------*/
+static void ptt_free_tbufs()
+{
+    PTT_TBUF* tb;
+
+    /* Make every thread forget its table, then give the threads
+       that may still be filling in an entry time to finish it */
+    pttgen++;
+    RELEASE_PTTLOCK;
+    usleep(1000);
+    OBTAIN_PTTLOCK;
+
+    while ((tb = pttbufs) != NULL)
+    {
+        pttbufs = tb->next;
+        free( tb );
+    }
+}
+
 /*-------------------------------------------------------------------*/
 /* Show the currently defined trace parameters                       */
 /*-------------------------------------------------------------------*/
@@ -246,6 +347,7 @@ DLL_EXPORT int ptt_cmd( int argc, char* argv[], char* cmdline )
     char c;
     PTTCL* pPTTCL;
     int no;
+    const char* dumpfile = NULL;
 
     UNREFERENCED( cmdline );
 
@@ -313,12 +415,17 @@ DLL_EXPORT int ptt_cmd( int argc, char* argv[], char* cmdline )
                 pttto = to;
                 continue;
             }
+            else if (strncasecmp("dump=", argv[0], 5) == 0 && strlen(argv[0]) > 5)
+            {
+                dumpfile = &argv[0][5];
+                continue;
+            }
             else if (argc == 1 && sscanf(argv[0], "%d%c", &n, &c) == 1 && n >= 0)
             {
                 OBTAIN_PTTLOCK;
                 if (pttracen == 0)
                 {
-                    if (pttrace != NULL)
+                    if (pttbufs != NULL)
                     {
                         RELEASE_PTTLOCK;
                         // "Pttrace: trace is busy"
@@ -326,14 +433,10 @@ DLL_EXPORT int ptt_cmd( int argc, char* argv[], char* cmdline )
                         return -1;
                     }
                 }
-                else if (pttrace)
+                else if (pttbufs)
                 {
                     pttracen = 0;
-                    RELEASE_PTTLOCK;
-                    usleep(1000);
-                    OBTAIN_PTTLOCK;
-                    free (pttrace);
-                    pttrace = NULL;
+                    ptt_free_tbufs();
                 }
                 ptt_trace_init (n, 0);
                 RELEASE_PTTLOCK;
@@ -368,6 +471,22 @@ DLL_EXPORT int ptt_cmd( int argc, char* argv[], char* cmdline )
             hthread_mutex_unlock (&ptttolock);
         }
 
+        /* write the binary dump file if dump= specified */
+        if (dumpfile && !rc)
+        {
+            char pathname[MAX_PATH];
+            hostpath( pathname, dumpfile, sizeof( pathname ));
+            if ((n = ptt_pthread_dump( pathname )) < 0)
+            {
+                // "Pttrace: error writing dump file %s: %s"
+                WRMSG(HHC90023, "E", pathname, strerror(errno));
+                rc = -1;
+            }
+            else
+                // "Pttrace: %d entries written to %s"
+                WRMSG(HHC90022, "I", n, pathname);
+        }
+
         if (showparms)
             ptt_showparms();
     }
@@ -391,13 +510,7 @@ DLL_EXPORT int ptt_cmd( int argc, char* argv[], char* cmdline )
 /*-------------------------------------------------------------------*/
 DLL_EXPORT void ptt_trace_init( int n, int init )
 {
-    if (n > 0)
-        pttrace = calloc( n, PTT_TRACE_SIZE );
-    else
-        pttrace = NULL;
-
-    pttracen = pttrace ? n : 0;
-    pttracex = 0;
+    pttracen = (n > 0) ? n : 0;
 
     if (init)       /* First time? */
     {
@@ -420,59 +533,206 @@ DLL_EXPORT void ptt_trace_init( int n, int init )
         pttnowrap = 0;
         pttto     = 0;
         ptttotid  = 0;
+
+        /* Remember where the trace clock started so it can later be
+           converted to time of day */
+        pttusec0  = ptt_usec();
+        ptttick0  = PTT_CLOCK();
     }
 }
 
 /*-------------------------------------------------------------------*/
-/* Primary PTT tracing function to fill in a PTT_TRACE table entry.  */
+/* Obtain a trace table for the current thread.  A table left behind */
+/* by a thread which has ended is reused if there is one.            */
 /*-------------------------------------------------------------------*/
-DLL_EXPORT void ptt_pthread_trace (U64 trclass, const char *msg,
-                                   const void *data1, const void *data2,
-                                   const char *loc, int rc, TIMEVAL* pTV)
+static PTT_TBUF* ptt_get_tbuf()
 {
-int i, n;
-
-    if (pttrace == NULL || pttracen == 0 || !(pttclass & trclass)) return;
-    /*
-     * Messages from timer.c, clock.c and/or logger.c are not usually
-     * that interesting and take up table space.  Check the flags to
-     * see if we want to trace them.
-     */
-    loc = TRIMLOC( loc );
-    if (!(pttclass & PTT_CL_TMR) && !strncasecmp( loc, "timer.c:",  8)) return;
-    if (!(pttclass & PTT_CL_TMR) && !strncasecmp( loc, "clock.c:",  8)) return;
-    if (!(pttclass & PTT_CL_LOG) && !strncasecmp( loc, "logger.c:", 9)) return;
-
-    /* Check for 'nowrap' */
-    if (pttnowrap && pttracex + 1 >= pttracen) return;
-
-    /* Consume another trace table entry */
+    PTT_TBUF* tb;
+    int n;
+
     OBTAIN_PTTLOCK;
-    if (pttrace == NULL || (n = pttracen) == 0)
+
+    if ((n = pttracen) == 0)
     {
         RELEASE_PTTLOCK;
-        return;
+        return NULL;
     }
-    i = pttracex++;
-    if (pttracex >= n)
-        pttracex = 0;
+
+    for (tb = pttbufs; tb; tb = tb->next)
+        if (!tb->tid)
+            break;
+
+    if (!tb)
+    {
+        if (!(tb = calloc( 1, sizeof( PTT_TBUF ) + n * PTT_TRACE_SIZE )))
+        {
+            RELEASE_PTTLOCK;
+            return NULL;
+        }
+        tb->n    = n;
+        tb->ent  = (PTT_TRACE*)(tb + 1);
+        tb->next = pttbufs;
+        pttbufs  = tb;
+    }
+
+    tb->tid  = thread_id();
+    ptttbuf  = tb;
+    ptttgen  = pttgen;
+
     RELEASE_PTTLOCK;
+    return tb;
+}
 
-    /* Fill in the trace table entry */
-    if (pttnotod == 0)
+/*-------------------------------------------------------------------*/
+/* Release the current thread's trace table as the thread ends       */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT void ptt_thread_exit()
+{
+    if (ptttbuf && ptttgen == pttgen)
+        ptttbuf->tid = 0;
+    ptttbuf = NULL;
+}
+
+/*-------------------------------------------------------------------*/
+/* Return the extra trace class a call site requires, if any         */
+/*-------------------------------------------------------------------*/
+static U64 ptt_loc_class( PTT_TBUF* tb, const char* loc )
+{
+    int i = (int)(((uintptr_t) loc >> 3) % PTT_LOCMAP);
+
+    if (tb->locmap[i] != loc)
     {
-        if (pTV)
-            memcpy( &pttrace[i].tv, pTV, sizeof( TIMEVAL ));
+        /*
+         * Messages from timer.c, clock.c and/or logger.c are not usually
+         * that interesting and take up table space.  They are only traced
+         * when their own trace class is active too.
+         */
+        const char* file = TRIMLOC( loc );
+
+        if (0
+            || !strncasecmp( file, "timer.c:",  8 )
+            || !strncasecmp( file, "clock.c:",  8 )
+        )
+            tb->loccl[i] = PTT_CL_TMR;
+        else if (!strncasecmp( file, "logger.c:", 9 ))
+            tb->loccl[i] = PTT_CL_LOG;
         else
-            gettimeofday( &pttrace[i].tv, NULL );
+            tb->loccl[i] = 0;
+
+        tb->locmap[i] = loc;
     }
-    pttrace[i].tid     = thread_id();
-    pttrace[i].trclass = trclass;
-    pttrace[i].msg     = msg;
-    pttrace[i].data1   = data1;
-    pttrace[i].data2   = data2;
-    pttrace[i].loc     = loc;
-    pttrace[i].rc      = rc;
+    return tb->loccl[i];
+}
+
+/*-------------------------------------------------------------------*/
+/* Primary PTT tracing function to fill in a PTT_TRACE table entry.  */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT void ptt_pthread_trace (U64 trclass, const char *msg,
+                                   const void *data1, const void *data2,
+                                   const char *loc, int rc)
+{
+PTT_TBUF*  tb;
+PTT_TRACE* p;
+U64        loccl;
+int        i;
+
+    if (pttracen == 0 || !(pttclass & trclass)) return;
+
+    /* Locate our own trace table */
+    if (!(tb = ptttbuf) || ptttgen != pttgen)
+        if (!(tb = ptt_get_tbuf()))
+            return;
+
+    /* Check whether this call site needs another class as well */
+    if ((loccl = ptt_loc_class( tb, loc )) && !(pttclass & loccl))
+        return;
+
+    /* Consume another trace table entry, checking for 'nowrap' */
+    if ((i = tb->x) >= tb->n)
+    {
+        if (pttnowrap) return;
+        i = 0;
+    }
+    tb->x = i + 1;
+
+    /* Fill in the trace table entry */
+    p = &tb->ent[i];
+    p->tick    = pttnotod ? 0 : PTT_CLOCK();
+    p->seq     = tb->seq++;
+    p->tid     = tb->tid;
+    p->trclass = trclass;
+    p->msg     = msg;
+    p->data1   = data1;
+    p->data2   = data2;
+    p->loc     = loc;
+    p->rc      = rc;
+}
+
+/*-------------------------------------------------------------------*/
+/* Sort function to merge the entries of all threads by time.  qsort */
+/* is not stable, so entries with the same tick (all of them with    */
+/* 'notod') are kept in the order each thread recorded them.         */
+/*-------------------------------------------------------------------*/
+static int ptt_sortby_tick( const PTT_TRACE* p1, const PTT_TRACE* p2 )
+{
+    if (p1->tick != p2->tick)
+        return (p1->tick < p2->tick) ? -1 : 1;
+    if (p1->seq != p2->seq)
+        return (p1->seq < p2->seq) ? -1 : 1;
+    return 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Take a copy of the entries of all thread tables, clear the tables */
+/* and sort the copy into time sequence.  Tracing is only stopped    */
+/* while the copy is taken.  Returns the number of entries copied;   */
+/* the caller must free the returned *pa array when it is non-zero.  */
+/*-------------------------------------------------------------------*/
+static int ptt_collect( PTT_TRACE** pa )
+{
+    PTT_TBUF*   tb;
+    PTT_TRACE*  a;
+    int i, n, count = 0;
+
+    /* Temporarily disable tracing by indicating an empty table */
+    OBTAIN_PTTLOCK;
+    n = pttracen;       /* save number of trace table entries   */
+    pttracen = 0;       /* indicate empty table to stop tracing */
+    RELEASE_PTTLOCK;
+
+    for (tb = pttbufs; tb; tb = tb->next)
+        for (i=0; i < tb->n; i++)
+            if (tb->ent[i].tid)
+                count++;
+
+    if (count && (*pa = a = malloc( count * PTT_TRACE_SIZE )) != NULL)
+    {
+        count = 0;
+        for (tb = pttbufs; tb; tb = tb->next)
+            for (i=0; i < tb->n; i++)
+                if (tb->ent[i].tid)
+                    a[count++] = tb->ent[i];
+    }
+    else
+        count = 0;
+
+    /* Clear all the table entries we just copied and enable
+       tracing again starting at entry number 0 of every table.
+       NOTE: there is no need to obtain the lock since: a) the
+       tables are never touched unless pttracen is non-zero, b)
+       because pttracen is an int, setting it to non-zero again
+       should be atomic.
+    */
+    for (tb = pttbufs; tb; tb = tb->next)
+    {
+        memset( tb->ent, 0, PTT_TRACE_SIZE * tb->n );
+        tb->x = 0;
+    }
+    pttracen = n;
+
+    if (count)
+        qsort( a, count, PTT_TRACE_SIZE, (CMPFUNC*) ptt_sortby_tick );
+    return count;
 }
 
 /*-------------------------------------------------------------------*/
@@ -481,68 +741,130 @@ int i, n;
 /*-------------------------------------------------------------------*/
 DLL_EXPORT int ptt_pthread_print ()
 {
-int   i, n, count = 0;
+PTT_TRACE*  a;
+PTT_TRACE*  p;
+TIMEVAL     tv;
+U64         tick1, usec1, usec;
+int   i, count;
 char  retcode[32]; // (retcode is 'int'; if x64, 19 digits or more!)
 char  tod[27];     // "YYYY-MM-DD HH:MM:SS.uuuuuu"
 
-    if (pttrace && pttracen)
+    if (!pttbufs || !pttracen)
+        return 0;
+
+    usec1 = ptt_usec();
+    tick1 = PTT_CLOCK();
+
+    /* Print the trace entries of all threads in time sequence */
+    count = ptt_collect( &a );
+    for (i=0; i < count; i++)
     {
-        /* Temporarily disable tracing by indicating an empty table */
-        OBTAIN_PTTLOCK;
-        n = pttracen;       /* save number of trace table entries   */
-        pttracen = 0;       /* indicate empty table to stop tracing */
-        RELEASE_PTTLOCK;
+        p = &a[i];
 
-        /* Print the trace table */
-        i = pttracex;
-        do
+        if (p->tick)
         {
-            if (pttrace[i].tid)
-            {
-                FormatTIMEVAL( &pttrace[i].tv, tod, sizeof( tod ));
-
-                /* If this is the thread class, an 'rc' of PTT_MAGIC
-                   indicates its value is uninteresting to us, so we
-                   don't show it by formatting it as an empty string.
-                */
-                if (pttrace[i].rc == PTT_MAGIC && (pttrace[i].trclass & PTT_CL_THR))
-                    retcode[0] = '\0';
-                else
-                {
-                    /* If not thread class, format return code as just
-                       another 32-bit hex value. Otherwise if it is the
-                       thread class, format it as a +/- decimal value.
-                    */
-                    if((pttrace[i].trclass & ~PTT_CL_THR))
-                        MSGBUF(retcode, "%8.8"PRIx32, pttrace[i].rc);
-                    else
-                        MSGBUF(retcode, "%d", pttrace[i].rc);
-                }
-                WRMSG( HHC90021, "I"
-                    , pttrace[i].loc                    // File name (string; 18 chars)
-                    , &tod[11]                          // Time of day (HH:MM:SS.usecs)
-                    , pttrace[i].tid                    // Thread id
-                    , pttrace[i].msg                    // Trace message (string; 18 chars)
-                    , (uintptr_t)pttrace[i].data1       // Data value 1
-                    , (uintptr_t)pttrace[i].data2       // Data value 2
-                    , retcode                           // Return code (or empty string)
-                );
-                count++;
-            }
-            if (++i >= n) i = 0;
-        } while (i != pttracex);
-
-        /* Clear all the table entries we just printed and
-           enable tracing again starting at entry number 0.
-           NOTE: there is no need to obtain the lock since:
-           a) pttracex is never accessed unless pttracen is
-           non-zero, b) because pttracen is an int, setting
-           it to non-zero again should be atomic.
+            usec = ptt_tick2usec( p->tick, ptttick0, pttusec0, tick1, usec1 );
+            tv.tv_sec  = (long)(usec / 1000000);
+            tv.tv_usec = (long)(usec % 1000000);
+            FormatTIMEVAL( &tv, tod, sizeof( tod ));
+        }
+        else
+            strlcpy( tod, "           --:--:--.------", sizeof( tod ));
+
+        /* If this is the thread class, an 'rc' of PTT_MAGIC
+           indicates its value is uninteresting to us, so we
+           don't show it by formatting it as an empty string.
         */
-        memset( pttrace, 0, PTT_TRACE_SIZE * n );
-        pttracex = 0;
-        pttracen = n;
+        if (p->rc == PTT_MAGIC && (p->trclass & PTT_CL_THR))
+            retcode[0] = '\0';
+        else
+        {
+            /* If not thread class, format return code as just
+               another 32-bit hex value. Otherwise if it is the
+               thread class, format it as a +/- decimal value.
+            */
+            if((p->trclass & ~PTT_CL_THR))
+                MSGBUF(retcode, "%8.8"PRIx32, p->rc);
+            else
+                MSGBUF(retcode, "%d", p->rc);
+        }
+        WRMSG( HHC90021, "I"
+            , TRIMLOC( p->loc )                 // File name (string; 18 chars)
+            , &tod[11]                          // Time of day (HH:MM:SS.usecs)
+            , p->tid                            // Thread id
+            , p->msg                            // Trace message (string; 18 chars)
+            , (uintptr_t)p->data1               // Data value 1
+            , (uintptr_t)p->data2               // Data value 2
+            , retcode                           // Return code (or empty string)
+        );
     }
+    if (count)
+        free( a );
 
     return count;
 }
+
+/*-------------------------------------------------------------------*/
+/* Function to write all PTT_TRACE table entries to a binary dump    */
+/* file for later formatting with the pttfmt utility.  Return code   */
+/* is the #of table entries written or -1 if the file can't be.     */
+/*-------------------------------------------------------------------*/
+DLL_EXPORT int ptt_pthread_dump( const char* filename )
+{
+PTT_TRACE*   a;
+PTT_TRACE*   p;
+PTT_DUMPHDR  hdr;
+PTT_DUMPREC  rec;
+FILE*        f;
+size_t       msglen, loclen;
+const char*  loc;
+int   i, count, rc = 0;
+
+    if (!(f = fopen( filename, "wb" )))
+        return -1;
+
+    memset( &hdr, 0, sizeof( hdr ));
+    memcpy( hdr.magic, PTT_DUMP_MAGIC, sizeof( hdr.magic ));
+    store_dw( hdr.tick0, ptttick0 );
+    store_dw( hdr.usec0, pttusec0 );
+    store_dw( hdr.usec1, ptt_usec() );
+    store_dw( hdr.tick1, PTT_CLOCK() );
+
+    count = (pttbufs && pttracen) ? ptt_collect( &a ) : 0;
+    store_dw( hdr.count, count );
+
+    if (fwrite( &hdr, sizeof( hdr ), 1, f ) != 1)
+        rc = -1;
+
+    for (i=0; i < count && !rc; i++)
+    {
+        p = &a[i];
+        loc = TRIMLOC( p->loc );
+        msglen = MIN( strlen( p->msg ), 255 );
+        loclen = MIN( strlen( loc ), 255 );
+
+        memset( &rec, 0, sizeof( rec ));
+        store_dw( rec.tick,    p->tick );
+        store_dw( rec.tid,     (U64)(uintptr_t) p->tid );
+        store_dw( rec.trclass, p->trclass );
+        store_dw( rec.data1,   (U64)(uintptr_t) p->data1 );
+        store_dw( rec.data2,   (U64)(uintptr_t) p->data2 );
+        store_fw( rec.rc,      (U32) p->rc );
+        rec.msglen = (BYTE) msglen;
+        rec.loclen = (BYTE) loclen;
+
+        if (0
+            || fwrite( &rec, sizeof( rec ), 1, f ) != 1
+            || fwrite( p->msg, 1, msglen, f ) != msglen
+            || fwrite( loc,    1, loclen, f ) != loclen
+        )
+            rc = -1;
+    }
+    if (count)
+        free( a );
+
+    if (fclose( f ) != 0)
+        rc = -1;
+
+    return rc ? rc : count;
+}
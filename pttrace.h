@@ -93,16 +93,27 @@
 //efine PTT_CL_ZZZ   0x4000000000000000 /* User class 47             */
 //efine PTT_CL_ZZZ   0x8000000000000000 /* User class 48             */
 
+/*-------------------------------------------------------------------*/
+/*                  Compiled-in PTT Trace Classes                    */
+/*                                                                   */
+/* Call sites whose trace class is not in this mask are compiled out */
+/* completely.  Builds may define it to keep only the classes they   */
+/* want, e.g. -DPTT_CL_COMPILED=0x4 to keep only thread records.     */
+/*-------------------------------------------------------------------*/
+#ifndef PTT_CL_COMPILED
+#define PTT_CL_COMPILED  0xFFFFFFFFFFFFFFFFULL /* All classes        */
+#endif
+
 /*-------------------------------------------------------------------*/
 /*                  Primary PTT Tracing macro                        */
 /*-------------------------------------------------------------------*/
 #define PTT( _class, _msg, _data1, _data2, _rc )                     \
 do {                                                                 \
-  if (pttclass & (_class))                                           \
+  if ((PTT_CL_COMPILED & (_class)) && (pttclass & (_class)))         \
     ptt_pthread_trace( (_class), (_msg),(void*)(uintptr_t)(_data1),  \
                                          (void*)(uintptr_t)(_data2), \
                                          PTT_LOC,                    \
-                                         (int)(_rc),NULL);           \
+                                         (int)(_rc));                \
 } while(0)
 
 /*-------------------------------------------------------------------*/
@@ -128,13 +139,53 @@ do {                                                                 \
 #define TIMEVAL                 struct timeval
 #endif
 
+/*-------------------------------------------------------------------*/
+/*                 PTT Binary Dump File Format                       */
+/*                                                                   */
+/* Written by "ptt dump=filename" and read by the pttfmt utility.    */
+/* The file is a PTT_DUMPHDR followed by 'count' PTT_DUMPREC records */
+/* in time sequence, each followed by its message and location text. */
+/* All numeric fields are big-endian.  The two clock/time of day     */
+/* pairs in the header convert the trace clock (the host's TSC where */
+/* it has one, otherwise microseconds) to time of day.               */
+/*-------------------------------------------------------------------*/
+#define PTT_DUMP_MAGIC      "HPTTDMP1"  /* Dump file identifier      */
+
+struct PTT_DUMPHDR
+{
+    BYTE    magic[8];                   /* PTT_DUMP_MAGIC            */
+    BYTE    tick0[8];                   /* Trace clock at PTT init   */
+    BYTE    usec0[8];                   /* Time of day (usecs) then  */
+    BYTE    tick1[8];                   /* Trace clock at dump time  */
+    BYTE    usec1[8];                   /* Time of day (usecs) then  */
+    BYTE    count[8];                   /* Number of records         */
+};
+typedef struct PTT_DUMPHDR PTT_DUMPHDR;
+
+struct PTT_DUMPREC
+{
+    BYTE    tick[8];                    /* Trace clock, 0 if notod   */
+    BYTE    tid[8];                     /* Thread id                 */
+    BYTE    trclass[8];                 /* Trace class               */
+    BYTE    data1[8];                   /* Data 1                    */
+    BYTE    data2[8];                   /* Data 2                    */
+    BYTE    rc[4];                      /* Return code               */
+    BYTE    msglen;                     /* Length of message text    */
+    BYTE    loclen;                     /* Length of location text   */
+    BYTE    resv[2];                    /* (reserved)                */
+};
+typedef struct PTT_DUMPREC PTT_DUMPREC;
+
 /*-------------------------------------------------------------------*/
 /*               Exported Functions and Variables                    */
 /*-------------------------------------------------------------------*/
 PTT_DLL_IMPORT void ptt_trace_init    ( int n, int init );
 PTT_DLL_IMPORT int  ptt_cmd           ( int argc, char* argv[], char* cmdline );
-PTT_DLL_IMPORT void ptt_pthread_trace ( U64, const char*, const void*, const void*, const char*, int, TIMEVAL* );
+PTT_DLL_IMPORT void ptt_pthread_trace ( U64, const char*, const void*, const void*, const char*, int );
 PTT_DLL_IMPORT int  ptt_pthread_print ();/* rc = #of entries printed */
+PTT_DLL_IMPORT int  ptt_pthread_dump  ( const char* filename );
+PTT_DLL_IMPORT void ptt_thread_exit   ();
+PTT_DLL_IMPORT U64  ptt_tick2usec     ( U64 tick, U64 tick0, U64 usec0, U64 tick1, U64 usec1 );
 PTT_DLL_IMPORT U64  pttclass;
 PTT_DLL_IMPORT int  pttthread;
 
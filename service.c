@@ -1304,7 +1304,7 @@ BYTE            *xstmap;                /* Xstore bitmap, zero means
 
 #ifdef FEATURE_VECTOR_FACILITY
         /* Set the Vector section size in the SCCB */
-        STORE_HW(sccbscp->vectssiz, VECTOR_SECTION_SIZE);
+        STORE_HW(sccbscp->vectssiz, VSECT_SIZE);
         /* Set the Vector partial sum number in the SCCB */
         STORE_HW(sccbscp->vectpsum, VECTOR_PARTIAL_SUM_NUMBER);
 #endif /*FEATURE_VECTOR_FACILITY*/
@@ -64,18 +64,18 @@ static int (* run_sie[GEN_MAXARCH]) (REGS *regs) =
 
 #define SIE_I_HOST(_hostregs) IC_INTERRUPT_CPU(_hostregs)
 
-#if defined(SIE_DEBUG_PERFMON)
-#define SIE_PERF_MAXNEG 0x1F
-static int sie_perfmon[0x41 + SIE_PERF_MAXNEG];
-#define SIE_PERFMON(_code) \
-    do { \
-        sie_perfmon[(_code) + SIE_PERF_MAXNEG] ++; \
-    } while(0)
-#define SIE_PERF_PGMINT \
-    (code <= 0 ? code : (((code-1) & 0x3F)+1))
-void *sie_perfmon_disp()
-{
-static char *dbg_name[] = {
+/*-------------------------------------------------------------------*/
+/* Names of SIE exit codes                                           */
+/*                                                                   */
+/* Indexed by SIE_CODE_INDEX, which maps the negative longjmp codes  */
+/* and the program interruption codes of interceptions (less any     */
+/* PER event) onto one table.  Index SIE_CODE_MAXNEG is SIE entry.   */
+/*-------------------------------------------------------------------*/
+#define SIE_CODE_MAXNEG 0x1F
+#define SIE_CODE_NUM    (0x41 + SIE_CODE_MAXNEG)
+#define SIE_CODE_INDEX(_code) \
+    (((_code) <= 0 ? (_code) : ((((_code)-1) & 0x3F)+1)) + SIE_CODE_MAXNEG)
+static const char *sie_code_name[] = {
         /* -31 */       "SIE re-dispatch state descriptor",
         /* -30 */       "SIE exit",
         /* -29 */       "SIE run",
@@ -173,12 +173,23 @@ static char *dbg_name[] = {
         /* 3F */        NULL,
         /* 40 */        "SIE intercept Monitor event" };
 
+#if defined(SIE_DEBUG_PERFMON)
+#define SIE_PERF_MAXNEG SIE_CODE_MAXNEG
+static int sie_perfmon[0x41 + SIE_PERF_MAXNEG];
+#define SIE_PERFMON(_code) \
+    do { \
+        sie_perfmon[(_code) + SIE_PERF_MAXNEG] ++; \
+    } while(0)
+#define SIE_PERF_PGMINT \
+    (code <= 0 ? code : (((code-1) & 0x3F)+1))
+void *sie_perfmon_disp()
+{
     if(sie_perfmon[SIE_PERF_ENTER+SIE_PERF_MAXNEG])
     {
         int i;
         for(i = 0; i < 0x61; i++)
             if(sie_perfmon[i])
-                WRMSG( HHC02285, "I" ,sie_perfmon[i], dbg_name[i] );
+                WRMSG( HHC02285, "I" ,sie_perfmon[i], sie_code_name[i] );
         WRMSG( HHC02286, "I",
             (sie_perfmon[SIE_PERF_EXEC+SIE_PERF_MAXNEG] +
              sie_perfmon[SIE_PERF_EXEC_U+SIE_PERF_MAXNEG]*7) /
@@ -191,6 +202,144 @@ static char *dbg_name[] = {
 #define SIE_PERFMON(_code)
 #endif
 
+/*-------------------------------------------------------------------*/
+/* SIE exit statistics                                               */
+/*                                                                   */
+/* Each host CPU counts its SIE exits by exit code and histograms    */
+/* the time from each exit to its next SIE entry, which is the time  */
+/* taken to handle the exit.  Latency bucket n counts round trips    */
+/* of less than 2**n microseconds; the last bucket counts the rest.  */
+/* Only the owning CPU updates its statistics, without locking; the  */
+/* siestats command reads and resets them while the CPUs run.        */
+/*-------------------------------------------------------------------*/
+#define SIE_STAT_BUCKETS 16
+
+typedef struct SIESTATS {
+    U64     entries;                    /* SIE entries               */
+    U64     sdreuse;                    /* Storage definition reused */
+    U64     tlbresume;                  /* Guest TLB context resumed */
+    U64     count[SIE_CODE_NUM];        /* Exits by exit code        */
+    U64     tod[SIE_CODE_NUM];          /* Total exit-to-entry time  */
+    U64     hist[SIE_CODE_NUM][SIE_STAT_BUCKETS]; /* Latency buckets */
+    TOD     exittod;                    /* Time of the last exit     */
+    int     exitix;                     /* Its code index, or -1     */
+} SIESTATS;
+
+static SIESTATS *sie_stats[MAX_CPU_ENGINES];
+
+/* Return the statistics of a host CPU, NULL if unavailable */
+static SIESTATS *sie_stats_get(REGS *regs)
+{
+    if (unlikely(sie_stats[regs->cpuad] == NULL))
+    {
+        sie_stats[regs->cpuad] = calloc(1, sizeof(SIESTATS));
+        if (sie_stats[regs->cpuad])
+            sie_stats[regs->cpuad]->exitix = -1;
+    }
+    return sie_stats[regs->cpuad];
+}
+
+/* Record a SIE entry, completing the round trip of the last exit */
+static void sie_stats_entry(SIESTATS *st)
+{
+TOD     now;
+U64     usecs;
+int     n;
+
+    st->entries++;
+    if (st->exitix < 0)
+        return;
+
+    now = host_tod();
+    now = now > st->exittod ? now - st->exittod : 0;
+    st->tod[st->exitix] += now;
+
+    for (usecs = now >> 4, n = 0; usecs && n < SIE_STAT_BUCKETS - 1; n++)
+        usecs >>= 1;
+    st->hist[st->exitix][n]++;
+
+    st->exitix = -1;
+}
+
+/* Record a SIE exit */
+static void sie_stats_exit(SIESTATS *st, int code)
+{
+    st->exitix = SIE_CODE_INDEX(code);
+    st->count[st->exitix]++;
+    st->exittod = host_tod();
+}
+
+/*-------------------------------------------------------------------*/
+/* Display or reset the SIE exit statistics (siestats command)       */
+/*-------------------------------------------------------------------*/
+void sie_stats_disp(int reset)
+{
+SIESTATS total;
+SIESTATS *st;
+int     cpus = 0;
+int     cpu, i, n;
+char    buf[512];
+size_t  len;
+
+    if (reset)
+    {
+        for (cpu = 0; cpu < MAX_CPU_ENGINES; cpu++)
+            if ((st = sie_stats[cpu]))
+            {
+                memset(st, 0, sizeof(SIESTATS));
+                st->exitix = -1;
+            }
+        return;
+    }
+
+    memset(&total, 0, sizeof(total));
+    for (cpu = 0; cpu < MAX_CPU_ENGINES; cpu++)
+    {
+        if ((st = sie_stats[cpu]) == NULL)
+            continue;
+        cpus++;
+        total.entries   += st->entries;
+        total.sdreuse   += st->sdreuse;
+        total.tlbresume += st->tlbresume;
+        for (i = 0; i < SIE_CODE_NUM; i++)
+        {
+            total.count[i] += st->count[i];
+            total.tod[i]   += st->tod[i];
+            for (n = 0; n < SIE_STAT_BUCKETS; n++)
+                total.hist[i][n] += st->hist[i][n];
+        }
+    }
+
+    if (!total.entries)
+    {
+        WRMSG( HHC02353, "I" );
+        return;
+    }
+
+    WRMSG( HHC02350, "I", cpus, total.entries, total.sdreuse,
+           total.tlbresume );
+
+    for (i = 0; i < SIE_CODE_NUM; i++)
+    {
+        if (!total.count[i])
+            continue;
+
+        WRMSG( HHC02351, "I", sie_code_name[i] ? sie_code_name[i] : "?",
+               total.count[i], (total.tod[i] >> 4) / total.count[i] );
+
+        for (n = 0, len = 0; n < SIE_STAT_BUCKETS; n++)
+            if (total.hist[i][n] && len < sizeof(buf))
+                len += snprintf(buf + len, sizeof(buf) - len,
+                                n < SIE_STAT_BUCKETS - 1 ? " <%u:%"I64_FMT"u"
+                                                         : " >=%u:%"I64_FMT"u",
+                                n < SIE_STAT_BUCKETS - 1 ? 1U << n
+                                                         : 1U << (n - 1),
+                                total.hist[i][n]);
+        if (len)
+            WRMSG( HHC02352, "I", buf );
+    }
+}
+
 #endif /*!defined(_SIE_C)*/
 
 #undef SIE_I_WAIT
@@ -218,141 +367,154 @@ static char *dbg_name[] = {
 #if defined(FEATURE_INTERPRETIVE_EXECUTION)
 
 /*-------------------------------------------------------------------*/
-/* B214 SIE   - Start Interpretive Execution                     [S] */
+/* Select the guest TLB context for SIE entry                        */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    Host register context, with GUESTREGS loaded from    */
+/*              the state descriptor                                 */
+/*      sdaddr  Absolute address of the state descriptor             */
+/*      lhcpu   Last host CPU address from the state descriptor      */
+/* Output:                                                           */
+/*      resumed 1=The retained context was resumed                   */
+/* Returns:                                                          */
+/*      The guest TLB context now in use                             */
+/*                                                                   */
+/*      Rather than purging the guest TLB on every SIE entry, each   */
+/*      host CPU retains up to SIE_TLBCTX_MAX guest TLB contexts,    */
+/*      one per state descriptor.  A context is resumed, making the  */
+/*      guest TLB entries made under its tlbID valid again, when     */
+/*      this CPU was the last to dispatch the state descriptor and   */
+/*      the host address space, guest storage origin and limit,     */
+/*      prefix, CR0 and architecture mode are unchanged.  Otherwise  */
+/*      the context is (re)started under a new tlbID.  Host purges   */
+/*      discard all retained contexts; a host IPTE removes only the  */
+/*      guest entries backed by the invalidated page (see dat.h).    */
+/*                                                                   */
+/*      Because those same events are the ones that can change the   */
+/*      host translation of the guest prefix area, a context also    */
+/*      retains the host absolute address of the guest prefix area,  */
+/*      together with the host page frame it was translated from.    */
 /*-------------------------------------------------------------------*/
-DEF_INST(start_interpretive_execution)
+static SIETLBCTX *ARCH_DEP(sie_tlb_context) (REGS *regs, RADR sdaddr,
+                                             U16 lhcpu, int *resumed)
 {
-int     b2;                             /* Values of R fields        */
-RADR    effective_addr2;                /* address of state desc.    */
-int     n;                              /* Loop counter              */
-U16     lhcpu;                          /* Last Host CPU address     */
-volatile int icode;                     /* Interception code         */
-U64     dreg;
-
-    S(inst, regs, b2, effective_addr2);
-
-    SIE_INTERCEPT(regs);
-
-    PRIV_CHECK(regs);
-
-    PTT_SIE("SIE", regs->GR_L(14), regs->GR_L(15), (U32)(effective_addr2 & 0xffffffff));
-
-    SIE_PERFMON(SIE_PERF_ENTER);
+SIETLBCTX *ctx;                         /* Context for sdaddr        */
+SIETLBCTX *slot;                        /* Free or oldest context    */
+int     i;                              /* Context index             */
 
-#if !defined(FEATURE_ESAME) && !defined(FEATURE_MULTIPLE_CONTROLLED_DATA_SPACE)
-    if(!regs->psw.amode || !PRIMARY_SPACE_MODE(&(regs->psw)))
-        ARCH_DEP(program_interrupt) (regs, PGM_SPECIAL_OPERATION_EXCEPTION);
-#endif
+    ctx = NULL;
+    slot = &GUESTREGS->sie_tlbctx[0];
+    for (i = 0; i < SIE_TLBCTX_MAX; i++)
+    {
+        if (GUESTREGS->sie_tlbctx[i].tlbID
+         && GUESTREGS->sie_tlbctx[i].sdaddr == sdaddr)
+        {
+            ctx = &GUESTREGS->sie_tlbctx[i];
+            break;
+        }
+        /* Free contexts have tlbID 0, and tlbIDs increase with age */
+        if (GUESTREGS->sie_tlbctx[i].tlbID < slot->tlbID)
+            slot = &GUESTREGS->sie_tlbctx[i];
+    }
 
-    if((effective_addr2 & (sizeof(SIEBK)-1)) != 0
-#if defined(FEATURE_ESAME)
-      || (effective_addr2 & 0xFFFFFFFFFFFFF000ULL) == 0
-      || (effective_addr2 & 0xFFFFFFFFFFFFF000ULL) == regs->PX)
-#else /*!defined(FEATURE_ESAME)*/
-      || (effective_addr2 & 0x7FFFF000) == 0
-      || (effective_addr2 & 0x7FFFF000) == regs->PX)
-#endif /*!defined(FEATURE_ESAME)*/
-        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+    if (ctx
+     && lhcpu == regs->cpuad
+     && ctx->hostasd   == regs->CR(1)
+     && ctx->cr0       == GUESTREGS->CR(0)
+     && ctx->mainstor  == GUESTREGS->mainstor
+     && ctx->mso       == GUESTREGS->sie_mso
+     && ctx->mainlim   == GUESTREGS->mainlim
+     && ctx->px        == GUESTREGS->PX
+     && ctx->arch_mode == GUESTREGS->arch_mode
+     && ctx->pref      == GUESTREGS->sie_pref)
+    {
+        INVALIDATE_AIA(GUESTREGS);
+        GUESTREGS->tlbID = ctx->tlbID;
+        *resumed = 1;
+        return ctx;
+    }
 
-    /* Perform serialization and checkpoint synchronization */
-    PERFORM_SERIALIZATION (regs);
-    PERFORM_CHKPT_SYNC (regs);
+    if (ctx == NULL)
+        ctx = slot;
 
-#if defined(SIE_DEBUG)
-    logmsg(_("SIE: state descriptor " F_RADR "\n"),effective_addr2);
-    ARCH_DEP(display_inst) (regs, regs->instinvalid ? NULL : regs->ip);
-#endif /*defined(SIE_DEBUG)*/
+    /* Free the context so that a tlbID wrap cannot resurrect it */
+    ctx->tlbID = 0;
+    ARCH_DEP(new_guest_tlbid) (GUESTREGS);
 
-    if(effective_addr2 > regs->mainlim - (sizeof(SIEBK)-1))
-    ARCH_DEP(program_interrupt) (regs, PGM_ADDRESSING_EXCEPTION);
+    ctx->sdaddr    = sdaddr;
+    ctx->hostasd   = regs->CR(1);
+    ctx->cr0       = GUESTREGS->CR(0);
+    ctx->mainstor  = GUESTREGS->mainstor;
+    ctx->mso       = GUESTREGS->sie_mso;
+    ctx->mainlim   = GUESTREGS->mainlim;
+    ctx->px        = GUESTREGS->PX;
+    ctx->arch_mode = GUESTREGS->arch_mode;
+    ctx->pref      = GUESTREGS->sie_pref;
+    ctx->pxvalid   = 0;
+    ctx->tlbID     = GUESTREGS->tlbID;
 
-    /*
-     * As long as regs->sie_active is off, no serialization is
-     * required for GUESTREGS.  sie_active should always be off here.
-     * Any other thread looking at sie_active holds the intlock.
-     */
-    if (regs->sie_active)
-    {
-        OBTAIN_INTLOCK(regs);
-        regs->sie_active = 0;
-        RELEASE_INTLOCK(regs);
-    }
+    *resumed = 0;
+    return ctx;
 
-     /* Initialize guestregs if first time */
-     if (GUESTREGS == NULL)
-    {
-        GUESTREGS = calloc_aligned(sizeof(REGS), 4096);
-        if (GUESTREGS == NULL)
-        {
-            WRMSG( HHC00813, "E", PTYPSTR(regs->cpuad), regs->cpuad, "calloc()", strerror(errno) );
-#if !defined(NO_SIGABEND_HANDLER)
-            signal_thread(sysblk.cputid[regs->cpuad], SIGUSR1);
-#endif
-            return;
-        }
-        cpu_init (regs->cpuad, GUESTREGS, regs);
-     }
+} /* end function sie_tlb_context */
 
-    /* Direct pointer to state descriptor block */
-    GUESTREGS->siebk = (void*)(regs->mainstor + effective_addr2);
 
+/*-------------------------------------------------------------------*/
+/* Copy the storage definition fields of the state descriptor        */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    Host register context                                */
+/*      sdaddr  Absolute address of the state descriptor             */
+/* Output:                                                           */
+/*      sdc     Fields from which sie_decode_storage derives the     */
+/*              guest storage definition                             */
+/*                                                                   */
+/*      The copy is marked valid unless the decode also depends on   */
+/*      data outside the state descriptor (region relocate zones).   */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(sie_sd_snapshot) (REGS *regs, RADR sdaddr,
+                                       SIESDCACHE *sdc)
+{
+    memset(sdc, 0, sizeof(SIESDCACHE));
+    sdc->sdaddr   = sdaddr;
+    sdc->hostlim  = regs->mainlim;
+    sdc->hostarch = regs->arch_mode;
+    sdc->m        = STATEBK->m;
+    sdc->mx       = STATEBK->mx;
+    sdc->zone     = STATEBK->zone;
+    memcpy(sdc->xso,    STATEBK->xso,    sizeof(STATEBK->xso));
+    memcpy(sdc->xsl,    STATEBK->xsl,    sizeof(STATEBK->xsl));
+    memcpy(sdc->prefix, STATEBK->prefix, sizeof(STATEBK->prefix));
+    memcpy(sdc->mso,    STATEBK->mso,    sizeof(STATEBK->mso));
+    memcpy(sdc->mse,    STATEBK->mse,    sizeof(STATEBK->mse));
+    memcpy(sdc->scao,   STATEBK->scao,   sizeof(STATEBK->scao));
 #if defined(FEATURE_ESAME)
-    if (STATEBK->mx & SIE_MX_ESAME)
-    {
-        GUESTREGS->arch_mode = ARCH_900;
-        GUESTREGS->program_interrupt = &z900_program_interrupt;
-        GUESTREGS->trace_br = (func)&z900_trace_br;
-        icode = z900_load_psw(GUESTREGS, STATEBK->psw);
-    }
+    memcpy(sdc->scaoh,  STATEBK->scaoh,  sizeof(STATEBK->scaoh));
 #else /*!defined(FEATURE_ESAME)*/
-    if (STATEBK->m & SIE_M_370)
-    {
-#if defined(_370)
-        GUESTREGS->arch_mode = ARCH_370;
-        GUESTREGS->program_interrupt = &s370_program_interrupt;
-        icode = s370_load_psw(GUESTREGS, STATEBK->psw);
-#else
-        /* Validity intercept when 370 mode not installed */
-        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
-          SIE_VI_WHY_370NI, GUESTREGS);
-        STATEBK->c = SIE_C_VALIDITY;
-        return;
-#endif
-    }
-#endif /*!defined(FEATURE_ESAME)*/
-    else
-#if !defined(FEATURE_ESAME)
-    if (STATEBK->m & SIE_M_XA)
+    memcpy(sdc->rcpo,   STATEBK->rcpo,   sizeof(STATEBK->rcpo));
 #endif /*!defined(FEATURE_ESAME)*/
-    {
-        GUESTREGS->arch_mode = ARCH_390;
-        GUESTREGS->program_interrupt = &s390_program_interrupt;
-        GUESTREGS->trace_br = (func)&s390_trace_br;
-        icode = s390_load_psw(GUESTREGS, STATEBK->psw);
-    }
-#if !defined(FEATURE_ESAME)
-    else
-    {
-        /* Validity intercept for invalid mode */
-        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
-                   SIE_VI_WHY_MODE, GUESTREGS);
-        STATEBK->c = SIE_C_VALIDITY;
+
+#if defined(FEATURE_REGION_RELOCATE)
+    if(STATEBK->mx & SIE_MX_RRF)
         return;
-    }
-#endif /*!defined(FEATURE_ESAME)*/
+#endif /*defined(FEATURE_REGION_RELOCATE)*/
+    sdc->valid    = 1;
 
-    /* Prefered guest indication */
-    GUESTREGS->sie_pref = (STATEBK->m & SIE_M_VR) ? 1 : 0;
+} /* end function sie_sd_snapshot */
 
-    /* Load prefix from state descriptor */
-    FETCH_FW(GUESTREGS->PX, STATEBK->prefix);
-    GUESTREGS->PX &=
-#if !defined(FEATURE_ESAME)
-                     PX_MASK;
-#else /*defined(FEATURE_ESAME)*/
-                     (GUESTREGS->arch_mode == ARCH_900) ? PX_MASK : 0x7FFFF000;
-#endif /*defined(FEATURE_ESAME)*/
 
+/*-------------------------------------------------------------------*/
+/* Decode the guest storage definition from the state descriptor     */
+/*                                                                   */
+/* Input:                                                            */
+/*      regs    Host register context, with the guest prefix and     */
+/*              preferred-storage mode loaded into GUESTREGS         */
+/* Returns:                                                          */
+/*      0       Storage definition loaded into GUESTREGS             */
+/*      1       Validity interception set in the state descriptor    */
+/*-------------------------------------------------------------------*/
+static int ARCH_DEP(sie_decode_storage) (REGS *regs)
+{
 #if defined(FEATURE_REGION_RELOCATE)
     if(STATEBK->mx & SIE_MX_RRF)
     {
@@ -364,7 +526,7 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
               SIE_VI_WHY_AZNNI, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
-            return;
+            return 1;
         }
 
         mso = (sysblk.zpb[STATEBK->zone].mso & 0xFFFFF) << 20;
@@ -378,7 +540,7 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
               SIE_VI_WHY_MSDEF, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
-            return;
+            return 1;
         }
 
         /* Ensure addressing exceptions on incorrect zone defs */
@@ -413,7 +575,7 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
                        SIE_VI_WHY_AZNNZ, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
-            return;
+            return 1;
         }
 
 #if defined(FEATURE_ESAME)
@@ -430,7 +592,7 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
                        SIE_VI_WHY_MSDEF, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
-            return;
+            return 1;
         }
 
         /* Calculate main storage size */
@@ -465,7 +627,7 @@ U64     dreg;
         SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
                    SIE_VI_WHY_PFOUT, GUESTREGS);
         STATEBK->c = SIE_C_VALIDITY;
-        return;
+        return 1;
     }
 
     /* System Control Area Origin */
@@ -484,7 +646,7 @@ U64     dreg;
         SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
                    SIE_VI_WHY_SCADR, GUESTREGS);
         STATEBK->c = SIE_C_VALIDITY;
-        return;
+        return 1;
     }
 
     /* Validate MSO */
@@ -496,7 +658,7 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
               SIE_VI_WHY_MSONZ, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
-            return;
+            return 1;
         }
 
         /* MCDS guest must have zero MSO */
@@ -505,8 +667,188 @@ U64     dreg;
             SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
                        SIE_VI_WHY_MSODS, GUESTREGS);
             STATEBK->c = SIE_C_VALIDITY;
+            return 1;
+        }
+    }
+
+#if !defined(FEATURE_ESAME)
+    /* Reference and Change Preservation Origin */
+    FETCH_FW(GUESTREGS->sie_rcpo, STATEBK->rcpo);
+    if (!GUESTREGS->sie_rcpo && !GUESTREGS->sie_pref)
+    {
+        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
+                   SIE_VI_WHY_RCZER, GUESTREGS);
+        STATEBK->c = SIE_C_VALIDITY;
+        return 1;
+    }
+#endif /*!defined(FEATURE_ESAME)*/
+
+    return 0;
+
+} /* end function sie_decode_storage */
+
+
+/*-------------------------------------------------------------------*/
+/* B214 SIE   - Start Interpretive Execution                     [S] */
+/*-------------------------------------------------------------------*/
+DEF_INST(start_interpretive_execution)
+{
+int     b2;                             /* Values of R fields        */
+RADR    effective_addr2;                /* address of state desc.    */
+int     n;                              /* Loop counter              */
+U16     lhcpu;                          /* Last Host CPU address     */
+volatile int icode;                     /* Interception code         */
+U64     dreg;
+SIESDCACHE sdc;                         /* Storage definition fields */
+SIETLBCTX *tlbctx;                      /* Guest TLB context         */
+SIESTATS *stats;                        /* SIE statistics            */
+int     resumed;                        /* 1=Guest TLB was resumed   */
+
+    S(inst, regs, b2, effective_addr2);
+
+    TXF_INSTR_CHECK(regs);
+
+    SIE_INTERCEPT(regs);
+
+    PRIV_CHECK(regs);
+
+    PTT_SIE("SIE", regs->GR_L(14), regs->GR_L(15), (U32)(effective_addr2 & 0xffffffff));
+
+    SIE_PERFMON(SIE_PERF_ENTER);
+
+#if !defined(FEATURE_ESAME) && !defined(FEATURE_MULTIPLE_CONTROLLED_DATA_SPACE)
+    if(!regs->psw.amode || !PRIMARY_SPACE_MODE(&(regs->psw)))
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIAL_OPERATION_EXCEPTION);
+#endif
+
+    if((effective_addr2 & (sizeof(SIEBK)-1)) != 0
+#if defined(FEATURE_ESAME)
+      || (effective_addr2 & 0xFFFFFFFFFFFFF000ULL) == 0
+      || (effective_addr2 & 0xFFFFFFFFFFFFF000ULL) == regs->PX)
+#else /*!defined(FEATURE_ESAME)*/
+      || (effective_addr2 & 0x7FFFF000) == 0
+      || (effective_addr2 & 0x7FFFF000) == regs->PX)
+#endif /*!defined(FEATURE_ESAME)*/
+        ARCH_DEP(program_interrupt) (regs, PGM_SPECIFICATION_EXCEPTION);
+
+    /* Perform serialization and checkpoint synchronization */
+    PERFORM_SERIALIZATION (regs);
+    PERFORM_CHKPT_SYNC (regs);
+
+    /* Complete the round trip of the previous SIE exit */
+    if ((stats = sie_stats_get(regs)))
+        sie_stats_entry(stats);
+
+#if defined(SIE_DEBUG)
+    logmsg(_("SIE: state descriptor " F_RADR "\n"),effective_addr2);
+    ARCH_DEP(display_inst) (regs, regs->instinvalid ? NULL : regs->ip);
+#endif /*defined(SIE_DEBUG)*/
+
+    if(effective_addr2 > regs->mainlim - (sizeof(SIEBK)-1))
+    ARCH_DEP(program_interrupt) (regs, PGM_ADDRESSING_EXCEPTION);
+
+    /*
+     * As long as regs->sie_active is off, no serialization is
+     * required for GUESTREGS.  sie_active should always be off here.
+     * Any other thread looking at sie_active holds the intlock.
+     */
+    if (regs->sie_active)
+    {
+        OBTAIN_INTLOCK(regs);
+        regs->sie_active = 0;
+        RELEASE_INTLOCK(regs);
+    }
+
+     /* Initialize guestregs if first time */
+     if (GUESTREGS == NULL)
+    {
+        GUESTREGS = calloc_aligned(sizeof(REGS), 4096);
+        if (GUESTREGS == NULL)
+        {
+            WRMSG( HHC00813, "E", PTYPSTR(regs->cpuad), regs->cpuad, "calloc()", strerror(errno) );
+#if !defined(NO_SIGABEND_HANDLER)
+            signal_thread(sysblk.cputid[regs->cpuad], SIGUSR1);
+#endif
             return;
         }
+        cpu_init (regs->cpuad, GUESTREGS, regs);
+     }
+
+    /* Direct pointer to state descriptor block */
+    GUESTREGS->siebk = (void*)(regs->mainstor + effective_addr2);
+
+#if defined(FEATURE_ESAME)
+    if (STATEBK->mx & SIE_MX_ESAME)
+    {
+        GUESTREGS->arch_mode = ARCH_900;
+        GUESTREGS->program_interrupt = &z900_program_interrupt;
+        GUESTREGS->trace_br = (func)&z900_trace_br;
+        icode = z900_load_psw(GUESTREGS, STATEBK->psw);
+    }
+#else /*!defined(FEATURE_ESAME)*/
+    if (STATEBK->m & SIE_M_370)
+    {
+#if defined(_370)
+        GUESTREGS->arch_mode = ARCH_370;
+        GUESTREGS->program_interrupt = &s370_program_interrupt;
+        icode = s370_load_psw(GUESTREGS, STATEBK->psw);
+#else
+        /* Validity intercept when 370 mode not installed */
+        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
+          SIE_VI_WHY_370NI, GUESTREGS);
+        STATEBK->c = SIE_C_VALIDITY;
+        return;
+#endif
+    }
+#endif /*!defined(FEATURE_ESAME)*/
+    else
+#if !defined(FEATURE_ESAME)
+    if (STATEBK->m & SIE_M_XA)
+#endif /*!defined(FEATURE_ESAME)*/
+    {
+        GUESTREGS->arch_mode = ARCH_390;
+        GUESTREGS->program_interrupt = &s390_program_interrupt;
+        GUESTREGS->trace_br = (func)&s390_trace_br;
+        icode = s390_load_psw(GUESTREGS, STATEBK->psw);
+    }
+#if !defined(FEATURE_ESAME)
+    else
+    {
+        /* Validity intercept for invalid mode */
+        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
+                   SIE_VI_WHY_MODE, GUESTREGS);
+        STATEBK->c = SIE_C_VALIDITY;
+        return;
+    }
+#endif /*!defined(FEATURE_ESAME)*/
+
+    /* Prefered guest indication */
+    GUESTREGS->sie_pref = (STATEBK->m & SIE_M_VR) ? 1 : 0;
+
+    /* Load prefix from state descriptor */
+    FETCH_FW(GUESTREGS->PX, STATEBK->prefix);
+    GUESTREGS->PX &=
+#if !defined(FEATURE_ESAME)
+                     PX_MASK;
+#else /*defined(FEATURE_ESAME)*/
+                     (GUESTREGS->arch_mode == ARCH_900) ? PX_MASK : 0x7FFFF000;
+#endif /*defined(FEATURE_ESAME)*/
+
+    /* Decode the guest storage definition, unless it is unchanged
+       since this state descriptor was last dispatched on this CPU */
+    ARCH_DEP(sie_sd_snapshot) (regs, effective_addr2, &sdc);
+    if (sdc.valid
+     && memcmp(&sdc, &GUESTREGS->sie_sdcache, sizeof(SIESDCACHE)) == 0)
+    {
+        if (stats)
+            stats->sdreuse++;
+    }
+    else
+    {
+        GUESTREGS->sie_sdcache.valid = 0;
+        if (ARCH_DEP(sie_decode_storage) (regs))
+            return;
+        memcpy(&GUESTREGS->sie_sdcache, &sdc, sizeof(SIESDCACHE));
     }
 
 #if defined(FEATURE_VIRTUAL_ARCHITECTURE_LEVEL)
@@ -543,18 +885,6 @@ U64     dreg;
     }
 #endif /*defined(FEATURE_VIRTUAL_ARCHITECTURE_LEVEL)*/
 
-#if !defined(FEATURE_ESAME)
-    /* Reference and Change Preservation Origin */
-    FETCH_FW(GUESTREGS->sie_rcpo, STATEBK->rcpo);
-    if (!GUESTREGS->sie_rcpo && !GUESTREGS->sie_pref)
-    {
-        SIE_SET_VI(SIE_VI_WHO_CPU, SIE_VI_WHEN_SIENT,
-                   SIE_VI_WHY_RCZER, GUESTREGS);
-        STATEBK->c = SIE_C_VALIDITY;
-        return;
-    }
-#endif /*!defined(FEATURE_ESAME)*/
-
     /* Load the CPU timer */
     FETCH_DW(dreg, STATEBK->cputimer);
     set_cpu_timer(GUESTREGS, dreg);
@@ -577,6 +907,9 @@ U64     dreg;
 #if defined(FEATURE_BINARY_FLOATING_POINT)
     GUESTREGS->fpc =  regs->fpc;
 #endif /*defined(FEATURE_BINARY_FLOATING_POINT)*/
+#if defined(FEATURE_ZVECTOR_FACILITY)
+    memcpy(GUESTREGS->vr, regs->vr, sizeof(regs->vr));
+#endif /*defined(FEATURE_ZVECTOR_FACILITY)*/
 
     /* Load GR14 */
     FETCH_W(GUESTREGS->GR(14), STATEBK->gr14);
@@ -590,9 +923,14 @@ U64     dreg;
 
     FETCH_HW(lhcpu, STATEBK->lhcpu);
     /*
-     * If this is not the last host cpu that dispatched this state
-     * descriptor then clear the guest TLB entries
+     * Resume the guest TLB entries of this state descriptor if this
+     * is the last host cpu that dispatched it, else start afresh
      */
+    tlbctx = ARCH_DEP(sie_tlb_context) (regs, effective_addr2, lhcpu,
+                                        &resumed);
+    if (resumed && stats)
+        stats->tlbresume++;
+
     if (regs->cpuad != lhcpu
      || SIE_STATE(GUESTREGS) != effective_addr2)
     {
@@ -605,10 +943,9 @@ U64     dreg;
         STORE_HW(STATEBK->lhcpu, regs->cpuad);
 
     }
-    /* Purge guest TLB entries */
-    /* @ISW20160730 : FIXME - Force TLB/ALB purge of guest context since there seem to be
-       some areas in hercules where the guest TLB/ALB is not properly maintained */
-    ARCH_DEP(purge_tlb) (GUESTREGS);
+
+    /* The ART lookaside buffer depends on the guest control
+       registers just loaded from the state descriptor */
     ARCH_DEP(purge_alb) (GUESTREGS);
 
     /* Initialize interrupt mask and state */
@@ -621,6 +958,11 @@ U64     dreg;
     SET_AEA_COMMON(GUESTREGS);
     INVALIDATE_AIA(GUESTREGS);
 
+    /* Resumed guest TLB entries may allow stores without the PER
+       storage-alteration check that is now in effect */
+    if (EN_IC_PER_SA(GUESTREGS))
+        ARCH_DEP(invalidate_tlb) (GUESTREGS, ~(ACC_WRITE|ACC_CHECK));
+
     GUESTREGS->tracing = regs->tracing;
 
     /*
@@ -644,6 +986,14 @@ U64     dreg;
             GUESTREGS->psa = (PSA_3XX*)(GUESTREGS->mainstor + GUESTREGS->PX);
             GUESTREGS->sie_px = GUESTREGS->PX;
         }
+        else if (tlbctx->pxvalid && tlbctx->tlbID == GUESTREGS->tlbID)
+        {
+            /* Reuse the prefix area translation of the resumed guest
+               TLB context; host purges discard the context and a
+               host IPTE of the page backing it invalidates hostpx */
+            GUESTREGS->sie_px = tlbctx->hostpx;
+            GUESTREGS->psa = (PSA_3XX*)(GUESTREGS->mainstor + GUESTREGS->sie_px);
+        }
         else
         {
             if (ARCH_DEP(translate_addr) (GUESTREGS->sie_mso + GUESTREGS->PX,
@@ -672,11 +1022,22 @@ U64     dreg;
                 return;
             }
             GUESTREGS->psa = (PSA_3XX*)(GUESTREGS->mainstor + GUESTREGS->sie_px);
+
+            if (tlbctx->tlbID == GUESTREGS->tlbID)
+            {
+                tlbctx->hostpx = GUESTREGS->sie_px;
+                tlbctx->hostpfra = regs->dat.rpfra;
+                tlbctx->pxvalid = 1;
+            }
         }
 
         /* Intialize guest timers */
         OBTAIN_INTLOCK(regs);
 
+        /* Have the timer thread wake for the guest's timers; this
+           also brings the TOD clock up to date for the tests below */
+        timer_reschedule(GUESTREGS);
+
         /* CPU timer */
         if(CPU_TIMER(GUESTREGS) < 0)
             ON_IC_PTIMER(GUESTREGS);
@@ -781,6 +1142,9 @@ int     n;
     SIE_PERFMON(SIE_PERF_EXIT);
     SIE_PERFMON(SIE_PERF_PGMINT);
 
+    if (sie_stats[regs->cpuad])
+        sie_stats_exit(sie_stats[regs->cpuad], code);
+
     /* Indicate we have left SIE mode */
     OBTAIN_INTLOCK(regs);
     regs->sie_active = 0;
@@ -897,6 +1261,9 @@ int     n;
 #if defined(FEATURE_BINARY_FLOATING_POINT)
     regs->fpc =  GUESTREGS->fpc;
 #endif /*defined(FEATURE_BINARY_FLOATING_POINT)*/
+#if defined(FEATURE_ZVECTOR_FACILITY)
+    memcpy(regs->vr, GUESTREGS->vr, sizeof(regs->vr));
+#endif /*defined(FEATURE_ZVECTOR_FACILITY)*/
     INVALIDATE_AIA(regs);
     SET_AEA_MODE(regs);
 
@@ -1304,6 +1671,8 @@ int     zone;                           /* Zone number               */
 
     S(inst, regs, b2, effective_addr2);
 
+    TXF_INSTR_CHECK(regs);
+
     PRIV_CHECK(regs);
 
     SIE_INTERCEPT(regs);
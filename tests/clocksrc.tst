@@ -0,0 +1,50 @@
+* TSC clock source tests
+*
+* The program reads the TOD clock with STCK for three seconds, long
+* enough for the timer thread to resynchronise the TSC clock source
+* at least twice.  Each value must be higher than the one before it
+* and no more than a quarter of a second later; a conversion that
+* wrapped after a resync would jump the clock centuries ahead.  The
+* result byte is 01 on success or FF on failure, when DELTA holds
+* the offending step.  If the host has no invariant TSC the clocksrc
+* command fails and the program runs on the system clock instead.
+
+*Testcase clocksrc tsc resync
+sysclear
+archmode z
+clocksrc tsc
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=B2050500     # STCK START
+r 204=E33005000004 # LG R3,START
+r 20A=B9040043     # LGR R4,R3          Previous value
+r 20E=B2050508     # LOOP STCK NOW
+r 212=E32005080004 # LG R2,NOW
+r 218=B9210024     # CLGR R2,R4
+r 21C=47D00260     # BNH FAIL           Must have advanced
+r 220=B9040052     # LGR R5,R2
+r 224=B9090054     # SGR R5,R4
+r 228=E35005100021 # CLG R5,BOUND
+r 22E=47200260     # BH FAIL            Must not have jumped
+r 232=B9040042     # LGR R4,R2
+r 236=B9040052     # LGR R5,R2
+r 23A=B9090053     # SGR R5,R3
+r 23E=E35005180021 # CLG R5,DURATION
+r 244=4740020E     # BL LOOP
+r 248=92010520     # MVI RESULT,X'01'
+r 24C=B2B20280     # LPSWE WAITPSW
+r 260=E35005280024 # FAIL STG R5,DELTA
+r 266=92FF0520     # MVI RESULT,X'FF'
+r 26A=B2B20280     # LPSWE WAITPSW
+r 280=00020001800000000000000000000000 # WAITPSW
+r 510=000000003D090000 # BOUND     0.25 seconds
+r 518=00000002DC6C0000 # DURATION  3 seconds
+ostailor null
+runtest 5
+clocksrc system
+*Compare
+r 520.4
+*Want "TOD advanced within bound" 01000000
+r 528.8
+*Want "No offending step" 00000000 00000000
+*Done
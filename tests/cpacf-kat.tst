@@ -0,0 +1,338 @@
+* CPACF known-answer tests
+*
+* KM-AES against the FIPS-197 appendix C example vectors, KIMD-SHA-1
+* and KIMD-SHA-256 against the FIPS 180 "abc" and two-block examples
+* (the message is padded here since KIMD does no padding), and
+* KIMD-GHASH against test cases 2 and 3 of the GCM specification.
+* On a host with AES-NI, PCLMULQDQ and the SHA extensions these run
+* the accelerated code in dyncrypt.
+
+*Testcase KM-AES-128 encrypt and decrypt
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000012     # LA R0,18          KM-AES-128 encrypt
+r 204=41100500     # LA R1,PB          Parameter block (key)
+r 208=41200700     # LA R2,FO          First operand
+r 20C=41400600     # LA R4,SO          Second operand, two blocks
+r 210=41500020     # LA R5,32          Second operand length
+r 214=B92E0024     # KM R2,R4          Cipher message
+r 218=B2220090     # IPM R9
+r 21C=50900400     # ST R9,CCS
+r 220=41000092     # LA R0,X'92'       KM-AES-128 decrypt
+r 224=41200720     # LA R2,FO+32       First operand
+r 228=41400700     # LA R4,FO          Ciphertext from above
+r 22C=41500020     # LA R5,32          Second operand length
+r 230=B92E0024     # KM R2,R4          Cipher message
+r 234=B2220090     # IPM R9
+r 238=50900404     # ST R9,CCS+4
+r 23C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=000102030405060708090A0B0C0D0E0F # PB, key
+r 600=00112233445566778899AABBCCDDEEFF # SO, plaintext
+r 610=00112233445566778899AABBCCDDEEFF # SO, plaintext
+ostailor null
+runtest .1
+*Compare
+r 700.10
+*Want "Ciphertext" 69C4E0D8 6A7B0430 D8CDB780 70B4C55A
+r 710.10
+*Want "Ciphertext" 69C4E0D8 6A7B0430 D8CDB780 70B4C55A
+r 720.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 730.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 400.8
+*Want "Condition codes 0 0" 00000000 00000000
+gpr
+*Gpr 5 0
+*Done
+
+*Testcase KM-AES-192 encrypt and decrypt
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000013     # LA R0,19          KM-AES-192 encrypt
+r 204=41100500     # LA R1,PB          Parameter block (key)
+r 208=41200700     # LA R2,FO          First operand
+r 20C=41400600     # LA R4,SO          Second operand, two blocks
+r 210=41500020     # LA R5,32          Second operand length
+r 214=B92E0024     # KM R2,R4          Cipher message
+r 218=B2220090     # IPM R9
+r 21C=50900400     # ST R9,CCS
+r 220=41000093     # LA R0,X'93'       KM-AES-192 decrypt
+r 224=41200720     # LA R2,FO+32       First operand
+r 228=41400700     # LA R4,FO          Ciphertext from above
+r 22C=41500020     # LA R5,32          Second operand length
+r 230=B92E0024     # KM R2,R4          Cipher message
+r 234=B2220090     # IPM R9
+r 238=50900404     # ST R9,CCS+4
+r 23C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=000102030405060708090A0B0C0D0E0F # PB, key
+r 510=1011121314151617                 # PB, key
+r 600=00112233445566778899AABBCCDDEEFF # SO, plaintext
+r 610=00112233445566778899AABBCCDDEEFF # SO, plaintext
+ostailor null
+runtest .1
+*Compare
+r 700.10
+*Want "Ciphertext" DDA97CA4 864CDFE0 6EAF70A0 EC0D7191
+r 710.10
+*Want "Ciphertext" DDA97CA4 864CDFE0 6EAF70A0 EC0D7191
+r 720.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 730.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 400.8
+*Want "Condition codes 0 0" 00000000 00000000
+gpr
+*Gpr 5 0
+*Done
+
+*Testcase KM-AES-256 encrypt and decrypt
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000014     # LA R0,20          KM-AES-256 encrypt
+r 204=41100500     # LA R1,PB          Parameter block (key)
+r 208=41200700     # LA R2,FO          First operand
+r 20C=41400600     # LA R4,SO          Second operand, two blocks
+r 210=41500020     # LA R5,32          Second operand length
+r 214=B92E0024     # KM R2,R4          Cipher message
+r 218=B2220090     # IPM R9
+r 21C=50900400     # ST R9,CCS
+r 220=41000094     # LA R0,X'94'       KM-AES-256 decrypt
+r 224=41200720     # LA R2,FO+32       First operand
+r 228=41400700     # LA R4,FO          Ciphertext from above
+r 22C=41500020     # LA R5,32          Second operand length
+r 230=B92E0024     # KM R2,R4          Cipher message
+r 234=B2220090     # IPM R9
+r 238=50900404     # ST R9,CCS+4
+r 23C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=000102030405060708090A0B0C0D0E0F # PB, key
+r 510=101112131415161718191A1B1C1D1E1F # PB, key
+r 600=00112233445566778899AABBCCDDEEFF # SO, plaintext
+r 610=00112233445566778899AABBCCDDEEFF # SO, plaintext
+ostailor null
+runtest .1
+*Compare
+r 700.10
+*Want "Ciphertext" 8EA2B7CA 516745BF EAFC4990 4B496089
+r 710.10
+*Want "Ciphertext" 8EA2B7CA 516745BF EAFC4990 4B496089
+r 720.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 730.10
+*Want "Decrypted plaintext" 00112233 44556677 8899AABB CCDDEEFF
+r 400.8
+*Want "Condition codes 0 0" 00000000 00000000
+gpr
+*Gpr 5 0
+*Done
+
+*Testcase KIMD-SHA-1 abc
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000001     # LA R0,1           Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300040     # LA R3,64          Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=67452301EFCDAB8998BADCFE10325476 # PB
+r 510=C3D2E1F0                         # PB
+r 600=61626380000000000000000000000000 # SO
+r 610=00000000000000000000000000000000 # SO
+r 620=00000000000000000000000000000000 # SO
+r 630=00000000000000000000000000000018 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" A9993E36 4706816A BA3E2571 7850C26C
+r 510.4
+*Want "Digest" 9CD0D89D
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
+*Testcase KIMD-SHA-1 two-block message
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000001     # LA R0,1           Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300080     # LA R3,128         Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=67452301EFCDAB8998BADCFE10325476 # PB
+r 510=C3D2E1F0                         # PB
+r 600=61626364626364656364656664656667 # SO
+r 610=65666768666768696768696A68696A6B # SO
+r 620=696A6B6C6A6B6C6D6B6C6D6E6C6D6E6F # SO
+r 630=6D6E6F706E6F70718000000000000000 # SO
+r 640=00000000000000000000000000000000 # SO
+r 650=00000000000000000000000000000000 # SO
+r 660=00000000000000000000000000000000 # SO
+r 670=000000000000000000000000000001C0 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" 84983E44 1C3BD26E BAAE4AA1 F95129E5
+r 510.4
+*Want "Digest" E54670F1
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
+*Testcase KIMD-SHA-256 abc
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000002     # LA R0,2           Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300040     # LA R3,64          Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=6A09E667BB67AE853C6EF372A54FF53A # PB
+r 510=510E527F9B05688C1F83D9AB5BE0CD19 # PB
+r 600=61626380000000000000000000000000 # SO
+r 610=00000000000000000000000000000000 # SO
+r 620=00000000000000000000000000000000 # SO
+r 630=00000000000000000000000000000018 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" BA7816BF 8F01CFEA 414140DE 5DAE2223
+r 510.10
+*Want "Digest" B00361A3 96177A9C B410FF61 F20015AD
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
+*Testcase KIMD-SHA-256 two-block message
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000002     # LA R0,2           Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300080     # LA R3,128         Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=6A09E667BB67AE853C6EF372A54FF53A # PB
+r 510=510E527F9B05688C1F83D9AB5BE0CD19 # PB
+r 600=61626364626364656364656664656667 # SO
+r 610=65666768666768696768696A68696A6B # SO
+r 620=696A6B6C6A6B6C6D6B6C6D6E6C6D6E6F # SO
+r 630=6D6E6F706E6F70718000000000000000 # SO
+r 640=00000000000000000000000000000000 # SO
+r 650=00000000000000000000000000000000 # SO
+r 660=00000000000000000000000000000000 # SO
+r 670=000000000000000000000000000001C0 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" 248D6A61 D20638B8 E5C02693 0C3E6039
+r 510.10
+*Want "Digest" A33CE459 64FF2167 F6ECEDD4 19DB06C1
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
+*Testcase KIMD-GHASH GCM test case 2
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000041     # LA R0,65          Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300020     # LA R3,32          Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=00000000000000000000000000000000 # PB
+r 510=66E94BD4EF8A2C3B884CFA59CA342B2E # PB
+r 600=0388DACE60B6A392F328C2B971B2FE78 # SO
+r 610=00000000000000000000000000000080 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" F38CBB1A D69223DC C3457AE5 B6B0F885
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
+*Testcase KIMD-GHASH GCM test case 3
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=41000041     # LA R0,65          Function code
+r 204=41100500     # LA R1,PB          Parameter block
+r 208=41200600     # LA R2,SO          Second operand
+r 20C=41300050     # LA R3,80          Second operand length
+r 210=B93E0002     # KIMD R0,R2        Compute intermediate message digest
+r 214=B2220090     # IPM R9
+r 218=50900400     # ST R9,CCS
+r 21C=B2B20300     # LPSWE WAITPSW     Load disabled wait PSW
+r 300=00020001800000000000000000000000 # WAITPSW
+r 500=00000000000000000000000000000000 # PB
+r 510=B83B533708BF535D0AA6E52980D53B78 # PB
+r 600=42831EC2217774244B7221B784D0D49C # SO
+r 610=E3AA212F2C02A4E035C17E2329ACA12E # SO
+r 620=21D514B25466931C7D8F6A5AAC84AA05 # SO
+r 630=1BA30B396A0AAC973D58E091473F5985 # SO
+r 640=00000000000000000000000000000200 # SO
+ostailor null
+runtest .1
+*Compare
+r 500.10
+*Want "Digest" 7F1B32B8 1B820D02 614F8895 AC1D4EAC
+r 400.4
+*Want "Condition code 0" 00000000
+gpr
+*Gpr 3 0
+*Done
+
@@ -0,0 +1,45 @@
+* Hercules Automatic Operator tests
+*
+* Each rule's command stores its own byte at 600, so the storage
+* display shows which rules fired.  The even numbered rules are given
+* a message that matches them; the odd numbered rules only a message
+* that does not.  Rule 0 and 1 targets are plain literals, 2 and 3 use
+* an alternation (so have no prefilter string), 4 and 5 a bracket
+* expression, and 6 and 7 a group, leaving no literal at all.  The
+* message for rule 5 contains its prefilter string but does not match
+* the target, so regexec has the last word.
+
+*Testcase hao prefilter
+sysclear
+archmode z
+hao clear
+hao tgt ALPHAJOB-ENDED
+hao cmd r 600=01
+hao tgt ALPHAJOB-FAILED
+hao cmd r 601=02
+hao tgt BRAVO7|CHARLIE7
+hao cmd r 602=03
+hao tgt BRAVO8|CHARLIE8
+hao cmd r 603=04
+hao tgt DELTA[0-9]+ECHO
+hao cmd r 604=05
+hao tgt FOXTROT[0-9]+GOLF
+hao cmd r 605=06
+hao tgt (HOTEL|INDIA)[0-9]+
+hao cmd r 606=07
+hao tgt (JULIET|KILO)[0-9]+
+hao cmd r 607=08
+msgnoh * ALPHAJOB-ENDED
+msgnoh * ALPHAJOB-FAILE
+msgnoh * CHARLIE7 READY
+msgnoh * BRAVO CHARLIE 8
+msgnoh * DELTA42ECHO
+msgnoh * FOXTROTXGOLF
+msgnoh * INDIA9
+msgnoh * KILOX
+pause 1
+hao clear
+*Compare
+r 600.8
+*Want "Rules fired" 01000300 05000700
+*Done nowait
@@ -0,0 +1,315 @@
+* Hexadecimal floating point extended multiply, divide and square root
+*
+* Each case loads the operands into FPR pairs 0-2 and 4-6, runs the
+* instruction and stores the result pair.  The expected results were
+* computed from the operation definitions with exact arithmetic: the
+* product and quotient are truncated, the square root is rounded, and
+* with the exponent-underflow mask zero an underflow gives a true zero.
+
+*Testcase MXR multiply extended
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68000800     # LD 0,OPA0
+r 204=68200808     # LD 2,OPA0+8
+r 208=68400810     # LD 4,OPB0
+r 20C=68600818     # LD 6,OPB0+8
+r 210=2604         # MXR 0,4
+r 212=60000600     # STD 0,RES0
+r 216=60200608     # STD 2,RES0+8
+r 21A=68000820     # LD 0,OPA1
+r 21E=68200828     # LD 2,OPA1+8
+r 222=68400830     # LD 4,OPB1
+r 226=68600838     # LD 6,OPB1+8
+r 22A=2604         # MXR 0,4
+r 22C=60000610     # STD 0,RES1
+r 230=60200618     # STD 2,RES1+8
+r 234=68000840     # LD 0,OPA2
+r 238=68200848     # LD 2,OPA2+8
+r 23C=68400850     # LD 4,OPB2
+r 240=68600858     # LD 6,OPB2+8
+r 244=2604         # MXR 0,4
+r 246=60000620     # STD 0,RES2
+r 24A=60200628     # STD 2,RES2+8
+r 24E=68000860     # LD 0,OPA3
+r 252=68200868     # LD 2,OPA3+8
+r 256=68400870     # LD 4,OPB3
+r 25A=68600878     # LD 6,OPB3+8
+r 25E=2604         # MXR 0,4
+r 260=60000630     # STD 0,RES3
+r 264=60200638     # STD 2,RES3+8
+r 268=68000880     # LD 0,OPA4
+r 26C=68200888     # LD 2,OPA4+8
+r 270=68400890     # LD 4,OPB4
+r 274=68600898     # LD 6,OPB4+8
+r 278=2604         # MXR 0,4
+r 27A=60000640     # STD 0,RES4
+r 27E=60200648     # STD 2,RES4+8
+r 282=680008A0     # LD 0,OPA5
+r 286=682008A8     # LD 2,OPA5+8
+r 28A=684008B0     # LD 4,OPB5
+r 28E=686008B8     # LD 6,OPB5+8
+r 292=2604         # MXR 0,4
+r 294=60000650     # STD 0,RES5
+r 298=60200658     # STD 2,RES5+8
+r 29C=680008C0     # LD 0,OPA6
+r 2A0=682008C8     # LD 2,OPA6+8
+r 2A4=684008D0     # LD 4,OPB6
+r 2A8=686008D8     # LD 6,OPB6+8
+r 2AC=2604         # MXR 0,4
+r 2AE=60000660     # STD 0,RES6
+r 2B2=60200668     # STD 2,RES6+8
+r 2B6=680008E0     # LD 0,OPA7
+r 2BA=682008E8     # LD 2,OPA7+8
+r 2BE=684008F0     # LD 4,OPB7
+r 2C2=686008F8     # LD 6,OPB7+8
+r 2C6=2604         # MXR 0,4
+r 2C8=60000670     # STD 0,RES7
+r 2CC=60200678     # STD 2,RES7+8
+r 2D0=B2B205F0     # LPSWE WAITPSW
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 800=41180000000000003300000000000000 # OPA0 41 18
+r 810=41280000000000003300000000000000 # OPB0 41 28
+r 820=41FFFFFFFFFFFFFF33FFFFFFFFFFFFFF # OPA1 41 FFFFFFFFFFFFFFFFFFFFFFFFFFFF
+r 830=41FFFFFFFFFFFFFF33FFFFFFFFFFFFFF # OPB1 41 FFFFFFFFFFFFFFFFFFFFFFFFFFFF
+r 840=41123456789ABCDE33F0123456789ABC # OPA2 41 123456789ABCDEF0123456789ABC
+r 850=401FEDCBA987654332210FEDCBA98765 # OPB2 40 1FEDCBA9876543210FEDCBA98765
+r 860=43000123456789AB35CDEF0123456789 # OPA3 43 000123456789ABCDEF0123456789
+r 870=420000000FFFFFFF34FFFFFFFFFFFFFF # OPB3 42 0000000FFFFFFFFFFFFFFFFFFFFF
+r 880=C133333333333333B333333333333333 # OPA4 C1 3333333333333333333333333333
+r 890=41555555555555553355555555555555 # OPB4 41 5555555555555555555555555555
+r 8A0=C1000000000000000000000000000000 # OPA5 C1 0
+r 8B0=41100000000000003300000000000000 # OPB5 41 1
+r 8C0=08100000000000007A00000000000000 # OPA6 08 1
+r 8D0=08100000000000007A00000000000000 # OPB6 08 1
+r 8E0=41100000000000003300000000000000 # OPA7 41 1
+r 8F0=08200000000000007A00000000000000 # OPB7 08 2
+ostailor null
+runtest .1
+*Compare
+r 600.10
+*Want "1.5 * 2.5" 413C0000 00000000 33000000 00000000
+r 610.10
+*Want "Largest fractions, product truncated" 42FFFFFF FFFFFFFF 34FFFFFF FFFFFFFE
+r 620.10
+*Want "Product fraction normalized left one digit" 402453F6 83723A53 321259E1 1F8C9FCE
+r 630.10
+*Want "Unnormalized operands prenormalized" 3B123456 789ABCDE 2DF01234 55554A98
+r 640.10
+*Want "Negative times positive" C2111111 11111111 B4111111 11111110
+r 650.10
+*Want "Zero fraction gives true zero" 00000000 00000000 00000000 00000000
+r 660.10
+*Want "Exponent underflow gives true zero" 00000000 00000000 00000000 00000000
+r 670.10
+*Want "Low-order characteristic wraps" 08200000 00000000 7A000000 00000000
+*Done
+
+*Testcase DXR divide extended
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68000800     # LD 0,OPA0
+r 204=68200808     # LD 2,OPA0+8
+r 208=68400810     # LD 4,OPB0
+r 20C=68600818     # LD 6,OPB0+8
+r 210=B22D0004     # DXR 0,4
+r 214=60000600     # STD 0,RES0
+r 218=60200608     # STD 2,RES0+8
+r 21C=68000820     # LD 0,OPA1
+r 220=68200828     # LD 2,OPA1+8
+r 224=68400830     # LD 4,OPB1
+r 228=68600838     # LD 6,OPB1+8
+r 22C=B22D0004     # DXR 0,4
+r 230=60000610     # STD 0,RES1
+r 234=60200618     # STD 2,RES1+8
+r 238=68000840     # LD 0,OPA2
+r 23C=68200848     # LD 2,OPA2+8
+r 240=68400850     # LD 4,OPB2
+r 244=68600858     # LD 6,OPB2+8
+r 248=B22D0004     # DXR 0,4
+r 24C=60000620     # STD 0,RES2
+r 250=60200628     # STD 2,RES2+8
+r 254=68000860     # LD 0,OPA3
+r 258=68200868     # LD 2,OPA3+8
+r 25C=68400870     # LD 4,OPB3
+r 260=68600878     # LD 6,OPB3+8
+r 264=B22D0004     # DXR 0,4
+r 268=60000630     # STD 0,RES3
+r 26C=60200638     # STD 2,RES3+8
+r 270=68000880     # LD 0,OPA4
+r 274=68200888     # LD 2,OPA4+8
+r 278=68400890     # LD 4,OPB4
+r 27C=68600898     # LD 6,OPB4+8
+r 280=B22D0004     # DXR 0,4
+r 284=60000640     # STD 0,RES4
+r 288=60200648     # STD 2,RES4+8
+r 28C=680008A0     # LD 0,OPA5
+r 290=682008A8     # LD 2,OPA5+8
+r 294=684008B0     # LD 4,OPB5
+r 298=686008B8     # LD 6,OPB5+8
+r 29C=B22D0004     # DXR 0,4
+r 2A0=60000650     # STD 0,RES5
+r 2A4=60200658     # STD 2,RES5+8
+r 2A8=B2B205F0     # LPSWE WAITPSW
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 800=41100000000000003300000000000000 # OPA0 41 1
+r 810=41300000000000003300000000000000 # OPB0 41 3
+r 820=41F00000000000003300000000000000 # OPA1 41 F
+r 830=41100000000000003300000000000000 # OPB1 41 1
+r 840=41123456789ABCDE33F0123456789ABC # OPA2 41 123456789ABCDEF0123456789ABC
+r 850=C1FEDCBA98765432B310FEDCBA987654 # OPB2 C1 FEDCBA9876543210FEDCBA987654
+r 860=41700000000000003300000000000000 # OPA3 41 7
+r 870=44000300000000003600000000000000 # OPB3 44 0003
+r 880=41000000000000000000000000000000 # OPA4 41 0
+r 890=41300000000000003300000000000000 # OPB4 41 3
+r 8A0=01100000000000007300000000000000 # OPA5 01 1
+r 8B0=7F800000000000007100000000000000 # OPB5 7F 8
+ostailor null
+runtest .1
+*Compare
+r 600.10
+*Want "1 / 3" 40555555 55555555 32555555 55555555
+r 610.10
+*Want "Dividend fraction not less than divisor" 41F00000 00000000 33000000 00000000
+r 620.10
+*Want "Full width quotient truncated" C0124924 92492492 B237EC68 7D6343EA
+r 630.10
+*Want "Unnormalized divisor prenormalized" 41255555 55555555 33555555 55555555
+r 640.10
+*Want "Zero dividend gives true zero" 00000000 00000000 00000000 00000000
+r 650.10
+*Want "Exponent underflow gives true zero" 00000000 00000000 00000000 00000000
+*Done
+
+*Testcase SQXR square root extended
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68400810     # LD 4,OPB0
+r 204=68600818     # LD 6,OPB0+8
+r 208=B3360004     # SQXR 0,4
+r 20C=60000600     # STD 0,RES0
+r 210=60200608     # STD 2,RES0+8
+r 214=68400830     # LD 4,OPB1
+r 218=68600838     # LD 6,OPB1+8
+r 21C=B3360004     # SQXR 0,4
+r 220=60000610     # STD 0,RES1
+r 224=60200618     # STD 2,RES1+8
+r 228=68400850     # LD 4,OPB2
+r 22C=68600858     # LD 6,OPB2+8
+r 230=B3360004     # SQXR 0,4
+r 234=60000620     # STD 0,RES2
+r 238=60200628     # STD 2,RES2+8
+r 23C=68400870     # LD 4,OPB3
+r 240=68600878     # LD 6,OPB3+8
+r 244=B3360004     # SQXR 0,4
+r 248=60000630     # STD 0,RES3
+r 24C=60200638     # STD 2,RES3+8
+r 250=68400890     # LD 4,OPB4
+r 254=68600898     # LD 6,OPB4+8
+r 258=B3360004     # SQXR 0,4
+r 25C=60000640     # STD 0,RES4
+r 260=60200648     # STD 2,RES4+8
+r 264=684008B0     # LD 4,OPB5
+r 268=686008B8     # LD 6,OPB5+8
+r 26C=B3360004     # SQXR 0,4
+r 270=60000650     # STD 0,RES5
+r 274=60200658     # STD 2,RES5+8
+r 278=684008D0     # LD 4,OPB6
+r 27C=686008D8     # LD 6,OPB6+8
+r 280=B3360004     # SQXR 0,4
+r 284=60000660     # STD 0,RES6
+r 288=60200668     # STD 2,RES6+8
+r 28C=684008F0     # LD 4,OPB7
+r 290=686008F8     # LD 6,OPB7+8
+r 294=B3360004     # SQXR 0,4
+r 298=60000670     # STD 0,RES7
+r 29C=60200678     # STD 2,RES7+8
+r 2A0=B2B205F0     # LPSWE WAITPSW
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 810=42100000000000003400000000000000 # OPB0 42 1
+r 830=41200000000000003300000000000000 # OPB1 41 2
+r 850=41100000000000003300000000000000 # OPB2 41 1
+r 870=40400000000000003200000000000000 # OPB3 40 4
+r 890=44000200000000003600000000000000 # OPB4 44 0002
+r 8B0=41300000000000003300000000000000 # OPB5 41 3
+r 8D0=41FFFFFFFFFFFFFF33FFFFFFFFFFFFFF # OPB6 41 FFFFFFFFFFFFFFFFFFFFFFFFFFFF
+r 8F0=C1000000000000000000000000000000 # OPB7 C1 0
+ostailor null
+runtest .1
+*Compare
+r 600.10
+*Want "Square root of 16" 41400000 00000000 33000000 00000000
+r 610.10
+*Want "Square root of 2" 4116A09E 667F3BCC 33908B2F B1366EA9
+r 620.10
+*Want "Odd characteristic, square root of 1" 41100000 00000000 33000000 00000000
+r 630.10
+*Want "Square root of 1/4" 40800000 00000000 32000000 00000000
+r 640.10
+*Want "Unnormalized operand, square root of 2" 4116A09E 667F3BCC 33908B2F B1366EA9
+r 650.10
+*Want "Square root of 3, rounded" 411BB67A E8584CAA 3373B257 42D7078C
+r 660.10
+*Want "Largest fraction rounds up" 41400000 00000000 33000000 00000000
+r 670.10
+*Want "Negative zero gives true zero" 00000000 00000000 00000000 00000000
+*Done
+
+*Testcase MXR exponent overflow
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68000800     # LD 0,OPA
+r 204=68200808     # LD 2,OPA+8
+r 208=68400810     # LD 4,OPB
+r 20C=68600818     # LD 6,OPB+8
+r 210=2604         # MXR 0,4
+r 212=B2B205F0     # LPSWE WAITPSW      Not reached
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 800=7F100000000000007100000000000000 # OPA
+r 810=7F100000000000007100000000000000 # OPB
+ostailor null
+*Program C
+runtest .1
+*Done
+
+*Testcase DXR divide by zero
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68000800     # LD 0,OPA
+r 204=68200808     # LD 2,OPA+8
+r 208=68400810     # LD 4,OPB
+r 20C=68600818     # LD 6,OPB+8
+r 210=B22D0004     # DXR 0,4
+r 214=B2B205F0     # LPSWE WAITPSW      Not reached
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 800=41100000000000003300000000000000 # OPA
+r 810=41000000000000000000000000000000 # OPB, zero fraction
+ostailor null
+*Program F
+runtest .1
+*Done
+
+*Testcase SQXR negative operand
+sysclear
+archmode z
+r 1A0=00000001800000000000000000000200 # z/Arch restart PSW
+r 1D0=0002000180000000FFFFFFFFDEADDEAD # z/Arch pgm new PSW
+r 200=68400810     # LD 4,OPB
+r 204=68600818     # LD 6,OPB+8
+r 208=B3360004     # SQXR 0,4
+r 20C=B2B205F0     # LPSWE WAITPSW      Not reached
+r 5F0=00020001800000000000000000000000 # WAITPSW
+r 810=C1400000000000003300000000000000 # OPB, -4
+ostailor null
+*Program 1D
+runtest .1
+*Done
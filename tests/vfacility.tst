@@ -0,0 +1,169 @@
+* ESA/390 Vector Facility tests
+*
+* Generates 128 pseudo-random fullword pairs A and B, one B in four
+* equal to its A, and runs VL, VAR, VSR, VXR, VCR, a VAR under the
+* vector mask and VST over the first 123 elements.  The program then
+* recomputes every element with scalar instructions and stores 1 in
+* RESULT when they all match, or FF at the first mismatch.  It runs
+* once for each vfsimd level, so that the portable element loops and
+* the SSE2 and AVX2 kernels are all checked, and again with a 16
+* element section.  VSTVP must report the section size in EXPECT.
+*
+* The Vector Facility is only built by HQA scenario 23.  In other
+* builds the first vector instruction is an operation exception, which
+* is not traced, the program stores 1 in RESULT and 2 in DETAIL, and
+* the vfsimd and vfsectsize commands are rejected.  DETAIL is 1 when
+* the vector instructions were checked.
+
+*Testcase VL VAR VSR VXR VCR VST VSTVM VSTVP
+sysclear
+archmode esa/390
+r 000=0008000080000200 # ESA/390 restart PSW
+r 068=0008000080000480 # ESA/390 pgm new PSW
+r 200=B700051C         # LCTL R0,R0,CR0VAL  Enable vector operations
+r 204=58C00510         # L R12,DATA  Data area base
+r 208=58200514         # L R2,ZSTART  Clear the result areas
+r 20C=58300518         # L R3,ZLEN
+r 210=1B55             # SR R5,R5
+r 212=0E24             # MVCL R2,R4
+r 214=58200520         # L R2,SEED  Generate the operands
+r 218=1B77             # SR R7,R7
+r 21A=41800003         # LA R8,3
+r 21E=41A00080         # LA R10,128
+r 222=45E00344         # GEN BAL R14,RAND
+r 226=5027C000         # ST R2,A(R7,R12)
+r 22A=45E00344         # BAL R14,RAND
+r 22E=1842             # LR R4,R2
+r 230=1448             # NR R4,R8  One in four B elements
+r 232=4770023A         # BNZ STB  equals the A element
+r 236=5827C000         # L R2,A(R7,R12)
+r 23A=5027C200         # STB ST R2,B(R7,R12)
+r 23E=41770004         # LA R7,4(R7)
+r 242=46A00222         # BCT R10,GEN
+r 246=A6C80504         # VSTVP VPARM  Section size
+r 24A=D50305040500     # CLC VPARM,EXPECT
+r 250=4770033C         # BNE FAIL
+r 254=A6C4007B         # VLVCA 123  VCT is 123 or the section size
+r 258=A64400A0         # VXVC R10
+r 25C=A6C60000         # VSVMM 0
+r 260=4110C000         # LA R1,A
+r 264=4120C200         # LA R2,B
+r 268=A4090001         # VL V0,R1
+r 26C=A4090022         # VL V2,R2
+r 270=A5200042         # VAR V4,V0,V2
+r 274=A5210062         # VSR V6,V0,V2
+r 278=A5260082         # VXR V8,V0,V2
+r 27C=A5280012         # VCR 1,V0,V2  VMR bit set when A > B
+r 280=4110C000         # LA R1,A
+r 284=A40900A1         # VL V10,R1
+r 288=A6C60001         # VSVMM 1
+r 28C=A52000A2         # VAR V10,V0,V2  Add under the VMR
+r 290=A6C60000         # VSVMM 0
+r 294=4130C400         # LA R3,VSUM
+r 298=A40D0043         # VST V4,R3
+r 29C=4130C600         # LA R3,VDIF
+r 2A0=A40D0063         # VST V6,R3
+r 2A4=4130C800         # LA R3,VXOR
+r 2A8=A40D0083         # VST V8,R3
+r 2AC=4130CA00         # LA R3,VMSK
+r 2B0=A40D00A3         # VST V10,R3
+r 2B4=4130CC00         # LA R3,VVMR
+r 2B8=A6820003         # VSTVM R3
+r 2BC=1B77             # SR R7,R7  Check against scalar results
+r 2BE=41900007         # LA R9,7
+r 2C2=5827C000         # LOOP L R2,A(R7,R12)
+r 2C6=5837C200         # L R3,B(R7,R12)
+r 2CA=1842             # LR R4,R2
+r 2CC=1E43             # ALR R4,R3
+r 2CE=5947C400         # C R4,VSUM(R7,R12)
+r 2D2=4770033C         # BNE FAIL
+r 2D6=1842             # LR R4,R2
+r 2D8=1F43             # SLR R4,R3
+r 2DA=5947C600         # C R4,VDIF(R7,R12)
+r 2DE=4770033C         # BNE FAIL
+r 2E2=1842             # LR R4,R2
+r 2E4=1743             # XR R4,R3
+r 2E6=5947C800         # C R4,VXOR(R7,R12)
+r 2EA=4770033C         # BNE FAIL
+r 2EE=1867             # LR R6,R7
+r 2F0=88600005         # SRL R6,5  VMR byte
+r 2F4=1B55             # SR R5,R5
+r 2F6=4356CC00         # IC R5,VVMR(R6,R12)
+r 2FA=1887             # LR R8,R7
+r 2FC=88800002         # SRL R8,2
+r 300=1489             # NR R8,R9
+r 302=89508018         # SLL R5,24(R8)  Element's bit to bit 0
+r 306=1842             # LR R4,R2  Unselected: A
+r 308=1923             # CR R2,R3
+r 30A=47C0031A         # BNH UNSEL
+r 30E=1E43             # ALR R4,R3  Selected: A + B
+r 310=1255             # LTR R5,R5
+r 312=47B0033C         # BNM FAIL
+r 316=47F00320         # B CHKMSK
+r 31A=1255             # UNSEL LTR R5,R5
+r 31C=4740033C         # BM FAIL
+r 320=5947CA00         # CHKMSK C R4,VMSK(R7,R12)
+r 324=4770033C         # BNE FAIL
+r 328=41770004         # LA R7,4(R7)
+r 32C=46A002C2         # BCT R10,LOOP
+r 330=9201050F         # MVI DETAIL+3,1  Vector instructions checked
+r 334=9201050B         # MVI RESULT+3,1
+r 338=82000528         # LPSW WAITPSW
+r 33C=92FF050B         # FAIL MVI RESULT+3,X'FF'
+r 340=82000528         # LPSW WAITPSW
+r 344=1832             # RAND LR R3,R2  xorshift32
+r 346=8930000D         # SLL R3,13
+r 34A=1723             # XR R2,R3
+r 34C=1832             # LR R3,R2
+r 34E=88300011         # SRL R3,17
+r 352=1723             # XR R2,R3
+r 354=1832             # LR R3,R2
+r 356=89300005         # SLL R3,5
+r 35A=1723             # XR R2,R3
+r 35C=07FE             # BR R14
+r 480=D501008E0524     # SKIP CLC PGMCODE,OPEXC  Facility not installed?
+r 486=47700496         # BNE DEAD
+r 48A=9202050F         # MVI DETAIL+3,2  Skipped
+r 48E=9201050B         # MVI RESULT+3,1
+r 492=82000528         # LPSW WAITPSW
+r 496=82000530         # DEAD LPSW DEADPSW
+r 500=00800001         # EXPECT  Section size 128, partial sums 1
+r 504=00000000         # VPARM
+r 508=00000000         # RESULT
+r 50C=00000000         # DETAIL
+r 510=00001000         # DATA
+r 514=00001400         # ZSTART
+r 518=00000840         # ZLEN
+r 51C=00020000         # CR0VAL
+r 520=2545F491         # SEED
+r 524=0001             # OPEXC
+r 528=000A000000000000 # WAITPSW
+r 530=000A00000000DEAD # DEADPSW
+ostailor null
+pgmtrace -1
+vfsimd scalar
+runtest .1
+*Compare
+r 508.4
+*Want "Portable element loops" 00000001
+r 508=00000000
+vfsimd sse2
+runtest .1
+*Compare
+r 508.4
+*Want "SSE2 kernels" 00000001
+r 508=00000000
+vfsimd auto
+runtest .1
+*Compare
+r 508.4
+*Want "AVX2 kernels when the host has AVX2" 00000001
+r 508=00000000
+r 500=00100001
+vfsectsize 16
+runtest .1
+*Compare
+r 508.4
+*Want "16 element section" 00000001
+vfsectsize 128
+*Done
@@ -19,6 +19,85 @@
 #include "feat370.h"
 
 
+/* Longest the timer thread sleeps, so that the MIPS and SIOS rates
+   are still recalculated about once a second on an idle system      */
+#define TIMER_MAX_WAIT  ETOD_SEC
+
+
+/*-------------------------------------------------------------------*/
+/* Time until the next clock comparator or CPU timer event           */
+/*                                                                   */
+/* Returns the interval, in hercules internal clock format, until    */
+/* the clock comparator or CPU timer of this CPU next becomes        */
+/* pending, or TIMER_MAX_WAIT if that is further away.  A condition  */
+/* that is already pending stays pending until the program sets the  */
+/* clock comparator or CPU timer again, so it is not an event.       */
+/* While the CPU or SIE guest uses the S/370 interval timer the      */
+/* interval is at most the interval timer polling period.            */
+/*-------------------------------------------------------------------*/
+static INLINE U64 timer_next_event(REGS *regs)
+{
+U64     next = TIMER_MAX_WAIT;          /* Interval to next event    */
+U64     tod = TOD_CLOCK(regs);          /* Current TOD clock         */
+S64     timer = CPU_TIMER(regs);        /* Current CPU timer         */
+#if defined(_FEATURE_INTERVAL_TIMER)
+int     itimer;                         /* 1=Interval timer in use   */
+#endif /*defined(_FEATURE_INTERVAL_TIMER)*/
+
+    if (tod <= regs->clkc && regs->clkc - tod < next)
+        next = regs->clkc - tod;
+
+    if (timer >= 0 && (U64)tod2etod(timer) < next)
+        next = tod2etod(timer);
+
+#if defined(_FEATURE_INTERVAL_TIMER)
+#if defined(_FEATURE_SIE)
+    if (SIE_MODE(regs))
+        itimer = SIE_STATB(regs, M, 370) && SIE_STATNB(regs, M, ITMOF);
+    else
+#endif /*defined(_FEATURE_SIE)*/
+        itimer = (regs->arch_mode == ARCH_370);
+
+    /* The interval timer can be changed by any store into
+       location 80, so it is polled every timer interval  */
+    if (itimer && ((U64)sysblk.timerint << 4) < next)
+        next = (U64)sysblk.timerint << 4;
+#endif /*defined(_FEATURE_INTERVAL_TIMER)*/
+
+    return next;
+}
+
+
+/*-------------------------------------------------------------------*/
+/* Reschedule the timer thread                                       */
+/*                                                                   */
+/* Called after the clock comparator or CPU timer of a CPU has been  */
+/* set, or the CPU has been restarted, with the intlock held.  If    */
+/* the new value becomes pending before the timer thread's next      */
+/* wakeup then the thread is woken early.  A NULL regs pointer wakes */
+/* the thread immediately, as when the TOD clock itself was set.     */
+/*-------------------------------------------------------------------*/
+void timer_reschedule(REGS *regs)
+{
+U64     next;                           /* Host time of the event    */
+
+    if (regs)
+    {
+        /* Bring the TOD clock up to date before measuring */
+        tod_clock(regs);
+        next = host_tod() + timer_next_event(regs);
+    }
+    else
+        next = 0;
+
+    if (next < sysblk.timernext)
+    {
+        sysblk.timernext = next;
+        signal_condition(&sysblk.timercond);
+    }
+}
+
+
 /*-------------------------------------------------------------------*/
 /* Check for timer event                                             */
 /*                                                                   */
@@ -35,11 +114,16 @@ void update_cpu_timer(void)
 int             cpu;                    /* CPU counter               */
 REGS           *regs;                   /* -> CPU register context   */
 CPU_BITMAP      intmask = 0;            /* Interrupt CPU mask        */
+U64             next = TIMER_MAX_WAIT;  /* Interval to next event    */
+U64             event;                  /* Interval to CPU's event   */
 
 #if defined(OPTION_MIPS_COUNTING)
     /* If no CPUs are available, just return (device server mode) */
     if (!sysblk.hicpu)
+    {
+      sysblk.timernext = host_tod() + TIMER_MAX_WAIT;
       return;
+    }
 #endif /*defined(OPTION_MIPS_COUNTING)*/
 
     /* Access the diffent register contexts with the intlock held */
@@ -145,12 +229,24 @@ CPU_BITMAP      intmask = 0;            /* Interrupt CPU mask        */
 
 #endif /*defined(_FEATURE_INTERVAL_TIMER)*/
 
+        /* Find the earliest clock comparator or CPU timer event */
+        if ((event = timer_next_event(regs)) < next)
+            next = event;
+#if defined(_FEATURE_SIE)
+        if (regs->sie_active
+         && (event = timer_next_event(regs->guestregs)) < next)
+            next = event;
+#endif /*defined(_FEATURE_SIE)*/
+
     } /* end for(cpu) */
 
     /* If a timer interrupt condition was detected for any CPU
        then wake up those CPUs if they are waiting */
     WAKEUP_CPUS_MASK (intmask);
 
+    /* The timer thread sleeps until the next event is due */
+    sysblk.timernext = host_tod() + next;
+
     RELEASE_INTLOCK(NULL);
 
 } /* end function check_timer_event */
@@ -158,14 +254,20 @@ CPU_BITMAP      intmask = 0;            /* Interrupt CPU mask        */
 /*-------------------------------------------------------------------*/
 /* TOD clock and timer thread                                        */
 /*                                                                   */
-/* This function runs as a separate thread.  It wakes up every       */
-/* 1 microsecond, updates the TOD clock, and decrements the          */
-/* CPU timer for each CPU.  If any CPU timer goes negative, or       */
-/* if the TOD clock exceeds the clock comparator for any CPU,        */
-/* it signals any waiting CPUs to wake up and process interrupts.    */
+/* This function runs as a separate thread.  It updates the TOD      */
+/* clock and checks the CPU timer and clock comparator of each CPU.  */
+/* If any CPU timer goes negative, or if the TOD clock exceeds the   */
+/* clock comparator for any CPU, it signals any waiting CPUs to wake */
+/* up and process interrupts.  It then sleeps until the earliest     */
+/* clock comparator or CPU timer event is due, or until it is woken  */
+/* by timer_reschedule because a timer was set to an earlier value.  */
+/* It wakes at least once a second to recalculate the MIPS and SIOS  */
+/* rates, and every timerint microseconds while a S/370 interval     */
+/* timer is in use.                                                  */
 /*-------------------------------------------------------------------*/
 void *timer_update_thread (void *argp)
 {
+U64     now;                            /* Current time of day       */
 #ifdef OPTION_MIPS_COUNTING
 int     i;                              /* Loop index                */
 REGS   *regs;                           /* -> REGS                   */
@@ -175,7 +277,6 @@ U64     total_mips;                     /* Total MIPS rate           */
 U64     total_sios;                     /* Total SIO rate            */
 
 /* Clock times use the top 64-bits of the ETOD clock                 */
-U64     now;                            /* Current time of day       */
 U64     then;                           /* Previous time of day      */
 U64     diff;                           /* Interval                  */
 U64     halfdiff;                       /* One-half interval         */
@@ -189,8 +290,10 @@ const U64   period = ETOD_SEC;          /* MIPS calculation period   */
 
     UNREFERENCED(argp);
 
-    /* Set timer thread priority */
+    /* Set timer thread priority and affinity */
     set_thread_priority(0, sysblk.todprio);
+    if (!HOSTCPU_EMPTY(&sysblk.todaff))
+        set_thread_affinity(0, &sysblk.todaff);
 
     /* Display thread started message on control panel */
     WRMSG (HHC00100, "I", thread_id(), get_thread_priority(0), "Timer");
@@ -286,8 +389,21 @@ const U64   period = ETOD_SEC;          /* MIPS calculation period   */
 
 #endif /*OPTION_MIPS_COUNTING*/
 
-        /* Sleep for another timer update interval... */
-        usleep ( sysblk.timerint );
+        /* Keep the TSC clock source in step with the host clock */
+        if (tsc_clock)
+            tsc_resync();
+
+        /* Sleep until the next timer event is due */
+        OBTAIN_INTLOCK(NULL);
+        now = host_tod();
+        if (sysblk.timernext > now && !sysblk.shutdown)
+        {
+            sysblk.intowner = LOCK_OWNER_NONE;
+            timed_wait_condition_relative_usecs (&sysblk.timercond,
+                &sysblk.intlock, (U32)((sysblk.timernext - now) >> 4), NULL);
+            sysblk.intowner = LOCK_OWNER_OTHER;
+        }
+        RELEASE_INTLOCK(NULL);
 
     } /* end while */
 
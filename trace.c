@@ -368,13 +368,46 @@ DBLWRD  reg[16];
 /*      Absolute address of new trace entry                          */
 /*                                                                   */
 /*      This function does not return if a program check occurs.     */
+/*                                                                   */
+/*      The translation of the current trace table page is cached    */
+/*      in the CPU register context.  The cached page is used while  */
+/*      CR12 stays within it and neither the prefix nor the tlbID    */
+/*      has changed.  Selective purges such as IPTE leave the tlbID  */
+/*      alone, so purge_tlb and purge_tlbe also clear trace_valid in */
+/*      the CPU, SIE host and guest register contexts.               */
+/*      The low-address protected pages are never cached.            */
 /*-------------------------------------------------------------------*/
 static inline RADR ARCH_DEP(get_trace_entry) (RADR *abs_guest, int size, REGS *regs)
 {
 RADR    n;                              /* Addr of trace table entry */
+RADR    page;                           /* Trace table page          */
 
     /* Obtain the trace entry address from control register 12 */
     n = regs->CR(12) & CR12_TRACEEA;
+    page = n & PAGEFRAME_PAGEMASK;
+
+    /* Use the cached translation of the current trace table page */
+    if (likely(regs->trace_valid)
+     && page == regs->trace_page
+     && regs->trace_px == regs->PX
+     && regs->trace_tlbID == regs->tlbID)
+    {
+        /* Program check if storing would overflow a 4K page boundary */
+        if ( ((n + size) & PAGEFRAME_PAGEMASK) != page )
+            ARCH_DEP(program_interrupt) (regs, PGM_TRACE_TABLE_EXCEPTION);
+
+#if defined(_FEATURE_SIE)
+        *abs_guest = regs->trace_absg | (n & PAGEFRAME_BYTEMASK);
+
+        /* Set the host reference and change bits as translation
+           of the guest trace entry address would have done */
+        if (SIE_MODE(regs) && !regs->sie_pref)
+            STORAGE_KEY(regs->trace_abs, regs->hostregs)
+                |= (STORKEY_REF | STORKEY_CHANGE);
+#endif /*defined(_FEATURE_SIE)*/
+
+        return regs->trace_abs | (n & PAGEFRAME_BYTEMASK);
+    }
 
     /* Apply low-address protection to trace entry address */
     if (ARCH_DEP(is_low_address_protected) (n, regs))
@@ -402,8 +435,17 @@ RADR    n;                              /* Addr of trace table entry */
 
     SIE_TRANSLATE(&n, ACCTYPE_WRITE, regs);
 
+    regs->trace_absg = *abs_guest & PAGEFRAME_PAGEMASK;
 #endif /*defined(_FEATURE_SIE)*/
 
+    /* Cache the trace table page, unless low-address protection
+       could apply to it, as that also depends on CR0 and the ASCE */
+    regs->trace_valid = (page != 0 && page != 0x1000);
+    regs->trace_page  = page;
+    regs->trace_abs   = n & PAGEFRAME_PAGEMASK;
+    regs->trace_px    = regs->PX;
+    regs->trace_tlbID = regs->tlbID;
+
     return n;
 
 } /* end function ARCH_DEP(get_trace_entry) */
@@ -0,0 +1,276 @@
+/* TRACEDUMP.C  Format a binary instruction trace file               */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This program reads a binary instruction trace file written by the */
+/* "itrace file=filename" command, merges the rings of all CPUs into */
+/* time sequence and writes one line per instruction or program      */
+/* interruption to the standard output.  Each instruction is followed */
+/* by the general registers it changed, as found in the next record  */
+/* of the same CPU.                                                  */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#include "hercules.h"
+#include "itrace.h"
+
+#define UTILITY_NAME    "tracedump"
+
+/*-------------------------------------------------------------------*/
+/* Trace record and the CPU which recorded it                        */
+/*-------------------------------------------------------------------*/
+struct TRACEDUMP_ENT
+{
+    U64          tod;                   /* Host TOD of the record    */
+    U64          seq;                   /* Sequence within the CPU   */
+    int          cpu;                   /* CPU ring number           */
+    ITRACE_REC*  rec;                   /* -> Trace record           */
+    ITRACE_REC*  next;                  /* -> Next record of the CPU */
+};
+typedef struct TRACEDUMP_ENT TRACEDUMP_ENT;
+
+/*-------------------------------------------------------------------*/
+/* Sort records by time, then by CPU and sequence within the CPU     */
+/*-------------------------------------------------------------------*/
+static int sortby_time( const TRACEDUMP_ENT* p1, const TRACEDUMP_ENT* p2 )
+{
+    if (p1->tod != p2->tod)
+        return (p1->tod < p2->tod) ? -1 : 1;
+    if (p1->cpu != p2->cpu)
+        return (p1->cpu < p2->cpu) ? -1 : 1;
+    return (p1->seq < p2->seq) ? -1 : (p1->seq > p2->seq) ? 1 : 0;
+}
+
+/*-------------------------------------------------------------------*/
+/* Format a host TOD value as time of day                            */
+/*-------------------------------------------------------------------*/
+static char* format_tod( U64 tod, char* buf, int bufsz )
+{
+    TIMEVAL  tv;
+    U64      usec;
+
+    usec = (tod - ETOD_1970) / ETOD_USEC;
+    tv.tv_sec  = (long)(usec / 1000000);
+    tv.tv_usec = (long)(usec % 1000000);
+    return FormatTIMEVAL( &tv, buf, bufsz );
+}
+
+/*-------------------------------------------------------------------*/
+/* Format one trace record, followed by either all the registers as  */
+/* they were before the instruction, or those it changed             */
+/*-------------------------------------------------------------------*/
+static void print_rec( const char* ptyp, int cpuad, ITRACE_REC* rec,
+                       ITRACE_REC* next, int allregs )
+{
+    char  tod[27];                      /* "YYYY-MM-DD HH:MM:SS.uuuuuu" */
+    char  psw[40];                      /* Formatted PSW             */
+    char  inst[16];                     /* Formatted instruction     */
+    char  op[64];                       /* Formatted operands        */
+    int   esame = (rec->arch == ARCH_900);
+    int   pswlen = esame ? 16 : 8;
+    ITRACE_REC* regs = allregs ? rec : next;
+    U16   grmask = allregs ? 0xFFFF : next ? fetch_hw( next->grmask ) : 0;
+    int   n, i, r;
+
+    format_tod( fetch_dw( rec->tod ), tod, sizeof( tod ));
+
+    for (n=0, i=0; i < pswlen; i++)
+        n += snprintf( psw + n, sizeof( psw ) - n, "%s%2.2X",
+                       (i && !(i % 8)) ? " " : "", rec->psw[i] );
+
+    for (n=0, i=0; i < rec->ilc && i < (int) sizeof( rec->inst ); i++)
+        n += snprintf( inst + n, sizeof( inst ) - n, "%2.2X", rec->inst[i] );
+    if (rec->flags & ITRACE_NOINST)
+        strlcpy( inst, "--------", sizeof( inst ));
+
+    op[0] = '\0';
+    for (n=0, i=0; i < 2; i++)
+    {
+        BYTE  b    = i ? rec->b2 : rec->b1;
+        U64   addr = fetch_dw( i ? rec->addr2 : rec->addr1 );
+
+        if (b != ITRACE_NOREG)
+            n += snprintf( op + n, sizeof( op ) - n, " op%d=%"PRIX64,
+                           i + 1, addr );
+    }
+
+    if (rec->type == ITRACE_PGM)
+        printf( "%.2s%02X %s %s%sPSW=%s INST=%-12s PGM %4.4X\n",
+                ptyp, cpuad, tod,
+                (rec->flags & ITRACE_SIE)  ? "SIE: " : "",
+                (rec->flags & ITRACE_REAL) ? "R " : "",
+                psw, inst, fetch_hw( rec->pcode ));
+    else
+        printf( "%.2s%02X %s %s%sPSW=%s INST=%-12s%s\n",
+                ptyp, cpuad, tod,
+                (rec->flags & ITRACE_SIE)  ? "SIE: " : "",
+                (rec->flags & ITRACE_REAL) ? "R " : "",
+                psw, inst, op );
+
+    /* Display the registers, four to a line */
+    for (n=0, r=0; r < 16; r++)
+    {
+        if (!(grmask & (0x8000 >> r)))
+            continue;
+        if (!(n % 4))
+            printf( "%s      ", n ? "\n" : "" );
+        if (esame)
+            printf( " R%1.1X=%16.16"PRIX64, r, fetch_dw( regs->gr[r] ));
+        else
+            printf( " R%1.1X=%8.8"PRIX32, r, (U32) fetch_dw( regs->gr[r] ));
+        n++;
+    }
+    if (n)
+        printf( "\n" );
+}
+
+/*-------------------------------------------------------------------*/
+/* TRACEDUMP main entry point                                        */
+/*-------------------------------------------------------------------*/
+int main( int argc, char* argv[] )
+{
+    ITRACE_HDR*     hdr;                /* -> File header            */
+    ITRACE_CPUHDR*  cpuhdr;             /* -> CPU header             */
+    TRACEDUMP_ENT*  ent;                /* -> Records of all CPUs    */
+    BYTE*           buf;                /* File contents             */
+    FILE*           f;
+    char*           filename = NULL;
+    char            pathname[MAX_PATH]; /* file path in host format  */
+    char            tod[27];            /* "YYYY-MM-DD HH:MM:SS.uuuuuu" */
+    long            size;
+    U32             numcpu, nrecs, frozen, frzcpu;
+    U64             count, seq, nent, i;
+    int             allregs = 0;
+    int             onecpu = -1;
+    int             cpu, k;
+
+    INITIALIZE_UTILITY( UTILITY_NAME,
+        "Binary instruction trace format program", NULL );
+
+    for (k=1; k < argc; k++)
+    {
+        if (strcmp( argv[k], "-a" ) == 0)
+            allregs = 1;
+        else if (strcmp( argv[k], "-c" ) == 0 && k + 1 < argc)
+            onecpu = (int) strtol( argv[++k], NULL, 16 );
+        else if (argv[k][0] != '-' && !filename)
+            filename = argv[k];
+        else
+        {
+            filename = NULL;
+            break;
+        }
+    }
+
+    if (!filename)
+    {
+        fprintf( stderr, "Usage: " UTILITY_NAME " [-a] [-c cpu] tracefile\n"
+                         "  -a      display all registers before each instruction,\n"
+                         "          instead of only those it changed\n"
+                         "  -c cpu  only display the records of this (hex) CPU\n" );
+        exit( 1 );
+    }
+
+    hostpath( pathname, filename, sizeof( pathname ));
+    if (!(f = fopen( pathname, "rb" )))
+    {
+        fprintf( stderr, UTILITY_NAME ": Error opening %s: %s\n",
+                 filename, strerror( errno ));
+        exit( 2 );
+    }
+
+    if (0
+        || fseek( f, 0, SEEK_END ) != 0
+        || (size = ftell( f )) < (long) sizeof( ITRACE_HDR )
+        || fseek( f, 0, SEEK_SET ) != 0
+        || !(buf = malloc( (size_t) size ))
+        || fread( buf, 1, (size_t) size, f ) != (size_t) size
+    )
+    {
+        fprintf( stderr, UTILITY_NAME ": Error reading %s: %s\n",
+                 filename, strerror( errno ));
+        exit( 2 );
+    }
+    fclose( f );
+
+    hdr    = (ITRACE_HDR*) buf;
+    numcpu = fetch_fw( hdr->numcpu );
+    nrecs  = fetch_fw( hdr->nrecs );
+
+    if (0
+        || memcmp( hdr->magic, ITRACE_MAGIC, sizeof( hdr->magic )) != 0
+        || fetch_fw( hdr->reclen ) != sizeof( ITRACE_REC )
+        || numcpu > MAX_CPU_ENGINES
+        || !nrecs || (nrecs & (nrecs - 1))
+        || (size_t) size < ITRACE_FILESIZE( numcpu, nrecs )
+    )
+    {
+        fprintf( stderr, UTILITY_NAME ": %s is not an instruction trace file\n",
+                 filename );
+        exit( 2 );
+    }
+
+    if (!(ent = malloc( (size_t) numcpu * nrecs * sizeof( TRACEDUMP_ENT ))))
+    {
+        fprintf( stderr, UTILITY_NAME ": Out of memory\n" );
+        exit( 3 );
+    }
+
+    /* Collect the records still held in each ring */
+    cpuhdr = (ITRACE_CPUHDR*)(buf + sizeof( ITRACE_HDR ));
+    for (nent=0, cpu=0; cpu < (int) numcpu; cpu++)
+    {
+        ITRACE_REC* ring = (ITRACE_REC*)(buf + ITRACE_RINGOFF( numcpu ))
+                         + (size_t) cpu * nrecs;
+
+        if (onecpu >= 0 && onecpu != fetch_hw( cpuhdr[cpu].cpuad ))
+            continue;
+
+        /* Once the ring has wrapped its oldest slot is the one the
+           CPU overwrites next, and may be partly overwritten already */
+        count = fetch_dw( cpuhdr[cpu].count );
+        seq   = count >= nrecs ? count - nrecs + 1 : 0;
+
+        for (; seq < count; seq++)
+        {
+            ITRACE_REC* rec = &ring[ seq & (nrecs - 1) ];
+
+            ent[nent].tod = fetch_dw( rec->tod );
+            ent[nent].seq = seq;
+            ent[nent].cpu = cpu;
+            ent[nent].rec = rec;
+            ent[nent].next = (seq + 1 < count)
+                           ? &ring[ (seq + 1) & (nrecs - 1) ] : NULL;
+            nent++;
+        }
+    }
+
+    if (nent)
+        qsort( ent, (size_t) nent, sizeof( TRACEDUMP_ENT ), (CMPFUNC*) sortby_time );
+
+    printf( "Trace started %s, %u processors, %u records per processor\n",
+            format_tod( fetch_dw( hdr->tod ), tod, sizeof( tod )),
+            numcpu, nrecs );
+
+    for (i=0; i < nent; i++)
+    {
+        cpu = ent[i].cpu;
+        print_rec( cpuhdr[cpu].ptyp, fetch_hw( cpuhdr[cpu].cpuad ),
+                   ent[i].rec, ent[i].next, allregs );
+    }
+
+    frozen = fetch_fw( hdr->frozen );
+    frzcpu = fetch_fw( hdr->frzcpu );
+    if (frozen == ITRACE_FRZ_CMD)
+        printf( "Trace frozen by command\n" );
+    else if (frozen)
+        printf( "Trace frozen by %s on processor %.2s%02X\n",
+                frozen == ITRACE_FRZ_PGM ? "program check" : "instruction address",
+                frzcpu < numcpu ? cpuhdr[frzcpu].ptyp : "??", frzcpu );
+
+    return 0;
+}
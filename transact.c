@@ -0,0 +1,830 @@
+/* TRANSACT.C   Transactional-Execution Facility                     */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This module implements the transactional-execution facility       */
+/* (facility bit 73) and the constrained transactional-execution     */
+/* facility (facility bit 50) described in the z/Architecture        */
+/* Principles of Operation manual.                                   */
+/*                                                                   */
+/* While a transaction is active every operand access is redirected  */
+/* by MADDRL (see feature.h) to a per-CPU page buffer.  The first    */
+/* access to a page takes a copy of it, and stores made by the       */
+/* transaction only update a second, private, copy.                  */
+/*                                                                   */
+/* The pages fetched and stored by each transaction are recorded in  */
+/* a table of ownership marks shared by all CPUs, indexed by a hash  */
+/* of the absolute page address.  While any CPU is in a transaction  */
+/* MADDRL checks the marks on every operand access made by the other */
+/* CPUs: a fetch from a page in another transaction's store set, or  */
+/* a store into a page in another transaction's fetch or store set,  */
+/* aborts that transaction with a fetch or store conflict the next   */
+/* time it accesses storage or when it ends.  Pages whose addresses  */
+/* hash to the same mark may cause unnecessary aborts, which the     */
+/* architecture permits.  When the outermost transaction ends it     */
+/* marks itself as committing and copies its changed doublewords to  */
+/* main storage; a CPU accessing one of its pages meanwhile waits    */
+/* for the copy to finish, so no CPU sees a partly committed         */
+/* transaction and the other CPUs are never stopped.  Stores by the  */
+/* channel subsystem, and by a CPU which checked the marks before    */
+/* the transaction first accessed the page, are not detected.        */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#define _TRANSACT_C_
+#define _HENGINE_DLL_
+
+#include "hercules.h"
+#include "opcode.h"
+#include "inline.h"
+
+#if defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)
+
+#if !defined(_TRANSACT_C_ONCE_)
+#define _TRANSACT_C_ONCE_
+
+#define TXF_MAXPAGES    32              /* Pages per transaction     */
+#define TXF_PAGESIZE    4096            /* Size of a buffered page   */
+#define TXF_MARKS       4096            /* Entries in the mark table */
+
+/* Values of txf_state other than the abort codes set by txf_claim */
+#define TXF_IDLE        0               /* Not in a transaction      */
+#define TXF_ACTIVE      1               /* Transaction in progress   */
+#define TXF_COMMITTING  3               /* Transaction ending        */
+
+/* Page buffer used while a transaction is active */
+typedef struct TXFPAGE {
+        RADR    abspage;                /* Absolute page address     */
+        BYTE   *main;                   /* Mainstor page address     */
+        int     stored;                 /* 1=Page has been stored in */
+        DW      save[TXF_PAGESIZE/8];   /* Page when first accessed  */
+        DW      alt[TXF_PAGESIZE/8];    /* Page as updated           */
+    } TXFPAGE;
+
+/* Ownership marks of the pages hashing to one entry of the table */
+typedef struct TXFMARK {
+        CPU_BITMAP fetch;               /* CPUs which fetched a page */
+        CPU_BITMAP store;               /* CPUs which stored a page  */
+    } TXFMARK;
+
+#define TXF_MARK(_abspage) \
+        (sysblk.txf_marks + (((_abspage) >> 12) & (TXF_MARKS-1)))
+
+/*-------------------------------------------------------------------*/
+/* Abort the transactions of the other CPUs which own the page       */
+/* before the calling CPU fetches from it or stores into it.  If an  */
+/* owning transaction is committing, wait until it has finished.     */
+/*-------------------------------------------------------------------*/
+static void txf_claim (REGS *regs, RADR abspage, int store)
+{
+TXFMARK   *mark;                        /* -> Page mark              */
+CPU_BITMAP mask;                        /* CPUs owning the page      */
+REGS      *tregs;                       /* -> Owning CPU's hostregs  */
+U32        old;                         /* Previous state            */
+int        cpu;                         /* CPU address               */
+int        busy;                        /* 1=Owner is committing     */
+
+    mark = TXF_MARK(abspage);
+    do
+    {
+        mask = store ? mark->fetch | mark->store : mark->store;
+        mask &= ~regs->hostregs->cpubit;
+
+        for (busy = 0, cpu = 0; mask; cpu++, mask >>= 1)
+        {
+            if (!(mask & 1) || !(tregs = sysblk.regs[cpu]))
+                continue;
+            old = TXF_ACTIVE;
+            if (cmpxchg4(&old, (mark->store & tregs->cpubit)
+                               ? TAC_STORE_CNF : TAC_FETCH_CNF,
+                         &tregs->txf_state)
+             && old == TXF_COMMITTING)
+                busy = 1;
+        }
+        if (busy)
+            sched_yield();
+    } while (busy);
+
+} /* end function txf_claim */
+
+/*-------------------------------------------------------------------*/
+/* Check an operand access made outside a transaction while another  */
+/* CPU is in a transaction                                           */
+/*-------------------------------------------------------------------*/
+static BYTE *txf_check (REGS *regs, BYTE *main, int acctype)
+{
+RADR     abspage;                       /* Absolute page address     */
+TXFMARK *mark;                          /* -> Page mark              */
+CPU_BITMAP mask;                        /* CPUs owning the page      */
+
+    abspage = (main - sysblk.mainstor) & PAGEFRAME_PAGEMASK;
+    mark = TXF_MARK(abspage);
+    mask = (acctype & (ACC_WRITE|ACC_CHECK))
+         ? mark->fetch | mark->store : mark->store;
+    if (unlikely(mask & ~regs->hostregs->cpubit))
+        txf_claim(regs, abspage,
+                  (acctype & (ACC_WRITE|ACC_CHECK)) ? 1 : 0);
+    return main;
+
+} /* end function txf_check */
+
+/*-------------------------------------------------------------------*/
+/* Mark a page buffered by the transaction as fetched or stored      */
+/*-------------------------------------------------------------------*/
+static void txf_mark (REGS *regs, RADR abspage, int store)
+{
+TXFMARK *mark;                          /* -> Page mark              */
+
+    obtain_lock(&sysblk.txflock);
+    mark = TXF_MARK(abspage);
+    if (store)
+        mark->store |= regs->hostregs->cpubit;
+    else
+        mark->fetch |= regs->hostregs->cpubit;
+    release_lock(&sysblk.txflock);
+
+    txf_claim(regs, abspage, store);
+
+} /* end function txf_mark */
+
+/*-------------------------------------------------------------------*/
+/* Enter transactional-execution mode at the outermost TBEGIN        */
+/*-------------------------------------------------------------------*/
+static int txf_enter (REGS *regs)
+{
+    obtain_lock(&sysblk.txflock);
+    if (!sysblk.txf_marks)
+    {
+        sysblk.txf_marks = calloc(TXF_MARKS, sizeof(TXFMARK));
+        if (!sysblk.txf_marks)
+        {
+            release_lock(&sysblk.txflock);
+            return -1;
+        }
+    }
+    sysblk.txf_cpus++;
+    regs->hostregs->txf_state = TXF_ACTIVE;
+    release_lock(&sysblk.txflock);
+    return 0;
+
+} /* end function txf_enter */
+
+/*-------------------------------------------------------------------*/
+/* Leave transactional-execution mode, discarding the page buffers   */
+/* and removing the CPU's marks.  Also called by CPU reset.          */
+/*-------------------------------------------------------------------*/
+void txf_release (REGS *regs)
+{
+TXFPAGE *pg;                            /* -> Page buffer            */
+TXFMARK *mark;                          /* -> Page mark              */
+int      i;                             /* Page buffer index         */
+
+    if (regs->hostregs->txf_state != TXF_IDLE)
+    {
+        obtain_lock(&sysblk.txflock);
+        for (i = 0, pg = regs->txf_pages; i < regs->txf_npages; i++, pg++)
+        {
+            mark = TXF_MARK(pg->abspage);
+            mark->fetch &= ~regs->hostregs->cpubit;
+            mark->store &= ~regs->hostregs->cpubit;
+        }
+        sysblk.txf_cpus--;
+        regs->hostregs->txf_state = TXF_IDLE;
+        release_lock(&sysblk.txflock);
+    }
+
+    regs->txf_npages = 0;
+    regs->txf_lastpage = 0;
+
+} /* end function txf_release */
+
+/*-------------------------------------------------------------------*/
+/* Return the lowest program-interruption filtering control which    */
+/* filters the given interruption code, or 3 if it is never filtered */
+/*-------------------------------------------------------------------*/
+static int txf_filter_level (int code)
+{
+    switch (code)
+    {
+    /* Transaction execution class 3 */
+    case PGM_DATA_EXCEPTION:
+    case PGM_FIXED_POINT_OVERFLOW_EXCEPTION:
+    case PGM_FIXED_POINT_DIVIDE_EXCEPTION:
+    case PGM_DECIMAL_OVERFLOW_EXCEPTION:
+    case PGM_DECIMAL_DIVIDE_EXCEPTION:
+    case PGM_EXPONENT_OVERFLOW_EXCEPTION:
+    case PGM_EXPONENT_UNDERFLOW_EXCEPTION:
+    case PGM_SIGNIFICANCE_EXCEPTION:
+    case PGM_FLOATING_POINT_DIVIDE_EXCEPTION:
+    case PGM_SQUARE_ROOT_EXCEPTION:
+        return 1;
+
+    /* Transaction execution class 2 */
+    case PGM_PROTECTION_EXCEPTION:
+    case PGM_ADDRESSING_EXCEPTION:
+    case PGM_SEGMENT_TRANSLATION_EXCEPTION:
+    case PGM_PAGE_TRANSLATION_EXCEPTION:
+    case PGM_TRANSLATION_SPECIFICATION_EXCEPTION:
+    case PGM_ALET_SPECIFICATION_EXCEPTION:
+    case PGM_ALEN_TRANSLATION_EXCEPTION:
+    case PGM_ALE_SEQUENCE_EXCEPTION:
+    case PGM_ASTE_VALIDITY_EXCEPTION:
+    case PGM_ASTE_SEQUENCE_EXCEPTION:
+    case PGM_EXTENDED_AUTHORITY_EXCEPTION:
+    case PGM_ASCE_TYPE_EXCEPTION:
+    case PGM_REGION_FIRST_TRANSLATION_EXCEPTION:
+    case PGM_REGION_SECOND_TRANSLATION_EXCEPTION:
+    case PGM_REGION_THIRD_TRANSLATION_EXCEPTION:
+        return 2;
+
+    /* Transaction execution class 1 */
+    default:
+        return 3;
+    }
+
+} /* end function txf_filter_level */
+
+#endif /*!defined(_TRANSACT_C_ONCE_)*/
+
+
+/*-------------------------------------------------------------------*/
+/* Translate an operand address made within a transaction.  Returns  */
+/* the address of the operand in the CPU's copy of the page, which   */
+/* is taken the first time the transaction accesses the page.        */
+/*-------------------------------------------------------------------*/
+BYTE *ARCH_DEP(txf_maddr_l) (VADR addr, size_t len, int arn, REGS *regs,
+                             int acctype, BYTE akey)
+{
+BYTE    *main;                          /* Mainstor address          */
+RADR     abs;                           /* Absolute address          */
+RADR     abspage;                       /* Absolute page address     */
+TXFPAGE *pg;                            /* -> Page buffer            */
+int      store;                         /* 1=Store access            */
+int      i;                             /* Page buffer index         */
+
+    /* Abort if another CPU has accessed a page of the transaction */
+    if (regs->hostregs->txf_state != TXF_ACTIVE)
+        ARCH_DEP(txf_abort) (regs, regs->hostregs->txf_state);
+
+    main = ARCH_DEP(logical_to_main_l) (addr, arn, regs, acctype,
+                                        akey, len);
+    abs = main - sysblk.mainstor;
+    abspage = abs & PAGEFRAME_PAGEMASK;
+    store = (acctype & (ACC_WRITE|ACC_CHECK)) ? 1 : 0;
+
+    pg = regs->txf_pages + regs->txf_lastpage;
+    if (regs->txf_lastpage >= regs->txf_npages || pg->abspage != abspage)
+    {
+        for (i = 0, pg = regs->txf_pages; i < regs->txf_npages; i++, pg++)
+            if (pg->abspage == abspage)
+                break;
+
+        if (i == regs->txf_npages)
+        {
+            if (i >= TXF_MAXPAGES)
+                ARCH_DEP(txf_abort) (regs, store ? TAC_STORE_OVF
+                                                 : TAC_FETCH_OVF);
+
+            /* First access to this page: mark it, then take a copy */
+            pg->abspage = abspage;
+            pg->main = main - (abs & PAGEFRAME_BYTEMASK);
+            pg->stored = store;
+            regs->txf_npages++;
+            txf_mark(regs, abspage, store);
+            memcpy(pg->save, pg->main, TXF_PAGESIZE);
+            memcpy(pg->alt, pg->save, TXF_PAGESIZE);
+        }
+        regs->txf_lastpage = i;
+    }
+
+    /* First store into a page previously only fetched */
+    if (store && !pg->stored)
+    {
+        pg->stored = 1;
+        txf_mark(regs, abspage, 1);
+    }
+
+    return (BYTE *)pg->alt + (abs & PAGEFRAME_BYTEMASK);
+
+} /* end function txf_maddr_l */
+
+
+/*-------------------------------------------------------------------*/
+/* Check an operand access made outside a transaction against the    */
+/* pages owned by the transactions of other CPUs                     */
+/*-------------------------------------------------------------------*/
+BYTE *ARCH_DEP(txf_check_maddr_l) (VADR addr, size_t len, int arn,
+                                   REGS *regs, int acctype, BYTE akey)
+{
+    return txf_check(regs, _MADDRL(addr, len, arn, regs, acctype, akey),
+                     acctype);
+
+} /* end function txf_check_maddr_l */
+
+
+/*-------------------------------------------------------------------*/
+/* Commit the stores of the outermost transaction to main storage.   */
+/* Returns zero, or the abort code set by another CPU which accessed */
+/* a page of the transaction.  Once the state is committing, other   */
+/* CPUs wait in txf_claim before accessing the transaction's pages,  */
+/* so the changed doublewords can be copied without stopping them.   */
+/*-------------------------------------------------------------------*/
+static int ARCH_DEP(txf_commit) (REGS *regs)
+{
+TXFPAGE *pg;                            /* -> Page buffer            */
+U64     *main;                          /* -> Page in main storage   */
+U32      old;                           /* Previous state            */
+int      i, j;                          /* Indexes                   */
+
+    old = TXF_ACTIVE;
+    if (cmpxchg4(&old, TXF_COMMITTING, &regs->hostregs->txf_state))
+        return old;
+
+    /* Copy the changed doublewords to main storage */
+    for (i = 0, pg = regs->txf_pages; i < regs->txf_npages; i++, pg++)
+    {
+        if (!pg->stored)
+            continue;
+        main = (U64 *)pg->main;
+        for (j = 0; j < TXF_PAGESIZE/8; j++)
+            if (pg->alt[j].D != pg->save[j].D)
+                main[j] = pg->alt[j].D;
+    }
+
+    txf_release(regs);
+    return 0;
+
+} /* end function txf_commit */
+
+
+/*-------------------------------------------------------------------*/
+/* Abort the transaction.  The stores made by the transaction are    */
+/* discarded, the general registers named by the GRSM are restored,  */
+/* the TBEGIN TDB is stored if one was specified, and the PSW is set */
+/* to the abort address and condition code.  On entry the caller has */
+/* set any program-interruption fields of the TDB and cleared the    */
+/* rest; on return the TDB is complete.                              */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(txf_abort_transaction) (REGS *regs, U64 tac,
+                                             VADR atia, TDB *tdb)
+{
+int     i;                              /* Register index            */
+int     cc;                             /* Abort condition code      */
+
+    /* Build the transaction diagnostic block */
+    tdb->format = TDB_FORMAT1;
+    if (regs->txf_contran)
+        tdb->flags |= TDB_CTI;
+    STORE_HW(tdb->tnd, regs->txf_tnd);
+    STORE_DW(tdb->tac, tac);
+    STORE_DW(tdb->atia, atia);
+    STORE_DW(tdb->bea, regs->bear);
+    for (i = 0; i < 16; i++)
+        STORE_DW(tdb->gpr[i], regs->GR_G(i));
+
+    /* Leave transactional-execution mode, discarding the stores */
+    regs->txf_tnd = 0;
+    txf_release(regs);
+
+    /* Restore the general register pairs named by the GRSM */
+    for (i = 0; i < 8; i++)
+    {
+        if (regs->txf_grsm & (0x80 >> i))
+        {
+            regs->GR_G(i*2)   = regs->txf_savedgr[i*2].D;
+            regs->GR_G(i*2+1) = regs->txf_savedgr[i*2+1].D;
+        }
+    }
+
+    /* Condition code 3 indicates the condition is likely to recur */
+    if (tac >= TAC_TABORT)
+        cc = (tac & 1) ? 3 : 2;
+    else
+        switch (tac)
+        {
+        case TAC_FETCH_OVF:
+        case TAC_STORE_OVF:
+        case TAC_INSTR:
+        case TAC_FPGM:
+        case TAC_NESTING:
+            cc = 3;
+            break;
+        default:
+            cc = 2;
+        }
+
+    /* A constrained transaction is reexecuted from the TBEGINC */
+    INVALIDATE_AIA(regs);
+    UPD_PSW_IA(regs, regs->txf_contran ? regs->txf_tbeginia
+                                       : regs->txf_tbeginia + 6);
+    regs->psw.cc = cc;
+    regs->txf_contran = 0;
+
+    if (regs->txf_tdbvalid)
+        ARCH_DEP(vstorec) (tdb, sizeof(TDB)-1, regs->txf_tdba,
+                           regs->txf_tdbarn, regs);
+
+} /* end function txf_abort_transaction */
+
+
+/*-------------------------------------------------------------------*/
+/* Abort the transaction during execution of an instruction and      */
+/* continue at the abort address                                     */
+/*-------------------------------------------------------------------*/
+void ARCH_DEP(txf_abort) (REGS *regs, U64 tac)
+{
+TDB     tdb;                            /* Transaction diagnostics   */
+VADR    atia;                           /* Aborted instruction addr  */
+
+    /* Release any locks */
+    if (sysblk.intowner == regs->cpuad)
+        RELEASE_INTLOCK(regs);
+    if (sysblk.mainowner == regs->cpuad)
+        RELEASE_MAINLOCK(regs);
+
+    INVALIDATE_AIA(regs);
+    atia = (regs->psw.IA - REAL_ILC(regs)) & ADDRESS_MAXWRAP(regs);
+    regs->execflag = 0;
+
+    memset(&tdb, 0, sizeof(TDB));
+    ARCH_DEP(txf_abort_transaction) (regs, tac, atia, &tdb);
+
+    longjmp(regs->progjmp, SIE_NO_INTERCEPT);
+
+} /* end function txf_abort */
+
+
+/*-------------------------------------------------------------------*/
+/* Restricted instruction executed in a transaction                  */
+/*-------------------------------------------------------------------*/
+void ARCH_DEP(txf_restricted_instruction) (REGS *regs)
+{
+    if (regs->txf_contran)
+        regs->program_interrupt (regs, PGM_TRANSACTION_CONSTRAINT_EXCEPTION);
+
+    ARCH_DEP(txf_abort) (regs, TAC_INSTR);
+
+} /* end function txf_restricted_instruction */
+
+
+/*-------------------------------------------------------------------*/
+/* Called by program_interrupt for an exception recognized while a   */
+/* transaction is active.  A filtered exception aborts the           */
+/* transaction without an interruption and does not return.          */
+/* Otherwise the transaction is aborted, the program-interruption    */
+/* TDB is stored in the prefix area, and the interruption code to be */
+/* presented is returned.                                            */
+/*-------------------------------------------------------------------*/
+int ARCH_DEP(txf_program_interrupt) (REGS *regs, int pcode, int ilc)
+{
+TDB     tdb;                            /* Transaction diagnostics   */
+int     code;                           /* Interruption code         */
+int     pifc;                           /* Effective filter control  */
+RADR    px;                             /* Absolute address of TDB   */
+
+    code = pcode & ~PGM_PER_EVENT;
+
+    memset(&tdb, 0, sizeof(TDB));
+    tdb.eaid = regs->excarid;
+    if (code == PGM_DATA_EXCEPTION)
+        tdb.dxc = regs->dxc;
+    STORE_FW(tdb.piid, (ilc << 16) | (pcode & 0xFFFF));
+    STORE_DW(tdb.teid, regs->TEA);
+
+    /* Constrained transactions are never filtered, and the override
+       in CR0 disables filtering for all transactions */
+    pifc = (regs->txf_contran || (regs->CR(0) & CR0_PIFO))
+         ? 0 : regs->txf_pifc;
+
+    if (pifc >= txf_filter_level(code))
+    {
+        ARCH_DEP(txf_abort_transaction) (regs, TAC_FPGM, regs->psw.IA,
+                                         &tdb);
+        longjmp(regs->progjmp, SIE_NO_INTERCEPT);
+    }
+
+    ARCH_DEP(txf_abort_transaction) (regs, TAC_UPGM, regs->psw.IA, &tdb);
+
+    /* Store the program-interruption TDB */
+    px = regs->PX + PSA_PITDB;
+    memcpy(regs->mainstor + px, &tdb, sizeof(TDB));
+    STORAGE_KEY(px, regs) |= (STORKEY_REF | STORKEY_CHANGE);
+
+    return pcode | PGM_TXF_EVENT;
+
+} /* end function txf_program_interrupt */
+
+
+/*-------------------------------------------------------------------*/
+/* Called by process_interrupt while a transaction is active: abort  */
+/* the transaction if an interruption is about to be taken or the    */
+/* CPU is stopping.  The abort PSW becomes the interruption old PSW. */
+/*-------------------------------------------------------------------*/
+void ARCH_DEP(txf_interrupt) (REGS *regs)
+{
+TDB     tdb;                            /* Transaction diagnostics   */
+int     tac;                            /* Transaction abort code    */
+
+    if (regs->cpustate != CPUSTATE_STARTED)
+        tac = TAC_MISC;
+    else if (OPEN_IC_MCKPENDING(regs))
+        tac = TAC_MCK;
+    else if (OPEN_IC_EXTPENDING(regs))
+        tac = TAC_EXT;
+    else if (OPEN_IC_IOPENDING(regs))
+        tac = TAC_IO;
+    else if (IS_IC_RESTART(regs))
+        tac = TAC_MISC;
+    else
+        return;
+
+    INVALIDATE_AIA(regs);
+    memset(&tdb, 0, sizeof(TDB));
+    ARCH_DEP(txf_abort_transaction) (regs, tac, regs->psw.IA, &tdb);
+
+} /* end function txf_interrupt */
+
+
+/*-------------------------------------------------------------------*/
+/* Common processing for TBEGIN and TBEGINC                          */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(txf_begin) (REGS *regs, int contran, int grsm)
+{
+int     i;                              /* Register index            */
+
+    if (regs->txf_tnd >= MAX_TXF_TND)
+        ARCH_DEP(txf_abort) (regs, TAC_NESTING);
+
+    if (regs->txf_tnd == 0)
+    {
+        /* Outermost transaction */
+        regs->txf_contran = contran;
+        regs->txf_tbeginia = PSW_IA(regs, -6);
+        regs->txf_grsm = 0;
+    }
+
+    /* Save the register pairs not already saved by an outer TBEGIN */
+    for (i = 0; i < 8; i++)
+    {
+        if ((grsm & (0x80 >> i)) && !(regs->txf_grsm & (0x80 >> i)))
+        {
+            regs->txf_savedgr[i*2]   = regs->gr[i*2];
+            regs->txf_savedgr[i*2+1] = regs->gr[i*2+1];
+        }
+    }
+    regs->txf_grsm |= grsm;
+
+    regs->txf_tnd++;
+    regs->psw.cc = 0;
+
+    /* The page buffers are allocated when first needed */
+    if (!regs->txf_pages)
+    {
+        regs->txf_pages = calloc(TXF_MAXPAGES, sizeof(TXFPAGE));
+        if (!regs->txf_pages)
+            ARCH_DEP(txf_abort) (regs, TAC_MISC);
+    }
+
+    /* Let the other CPUs check their accesses against the marks */
+    if (regs->txf_tnd == 1 && txf_enter(regs) != 0)
+        ARCH_DEP(txf_abort) (regs, TAC_MISC);
+
+} /* end function txf_begin */
+
+
+/* Program check if the transactional-execution control is zero */
+#define TXF_CONTROL_CHECK(_regs) \
+        if (!((_regs)->CR(0) & CR0_TXC)) \
+            (_regs)->program_interrupt((_regs), PGM_SPECIAL_OPERATION_EXCEPTION)
+
+/* Program check if the instruction is the target of an execute */
+#define TXF_EXECUTE_CHECK(_regs) \
+        if ((_regs)->execflag) \
+            (_regs)->program_interrupt((_regs), PGM_EXECUTE_EXCEPTION)
+
+
+/*-------------------------------------------------------------------*/
+/* B2EC ETND  - Extract Transaction Nesting Depth              [RRE] */
+/*-------------------------------------------------------------------*/
+DEF_INST(extract_transaction_nesting_depth)
+{
+int     r1, r2;                         /* Values of R fields        */
+
+    RRE(inst, regs, r1, r2);
+
+    FACILITY_CHECK(TRANSACT_EXEC, regs);
+    TXF_CONTROL_CHECK(regs);
+
+    regs->GR_L(r1) = regs->txf_tnd;
+
+} /* end DEF_INST(extract_transaction_nesting_depth) */
+
+
+/*-------------------------------------------------------------------*/
+/* B2F8 TEND  - Transaction End                                  [S] */
+/*-------------------------------------------------------------------*/
+DEF_INST(transaction_end)
+{
+int     b2;                             /* Base of effective addr    */
+VADR    effective_addr2;                /* Effective address         */
+int     tac;                            /* Transaction abort code    */
+
+    S(inst, regs, b2, effective_addr2);
+
+    FACILITY_CHECK(TRANSACT_EXEC, regs);
+    TXF_EXECUTE_CHECK(regs);
+    TXF_CONTROL_CHECK(regs);
+
+    if (regs->txf_tnd == 0)
+    {
+        regs->psw.cc = 2;
+        return;
+    }
+
+    if (regs->txf_tnd == 1)
+    {
+        tac = ARCH_DEP(txf_commit) (regs);
+        if (tac)
+            ARCH_DEP(txf_abort) (regs, tac);
+        regs->txf_contran = 0;
+    }
+
+    regs->txf_tnd--;
+    regs->psw.cc = 0;
+
+} /* end DEF_INST(transaction_end) */
+
+
+/*-------------------------------------------------------------------*/
+/* B2FC TABORT - Transaction Abort                               [S] */
+/*-------------------------------------------------------------------*/
+DEF_INST(transaction_abort)
+{
+int     b2;                             /* Base of effective addr    */
+VADR    effective_addr2;                /* Effective address         */
+
+    S(inst, regs, b2, effective_addr2);
+
+    FACILITY_CHECK(TRANSACT_EXEC, regs);
+
+    if (regs->txf_tnd == 0)
+        regs->program_interrupt(regs, PGM_SPECIAL_OPERATION_EXCEPTION);
+
+    if (regs->txf_contran)
+        regs->program_interrupt(regs, PGM_TRANSACTION_CONSTRAINT_EXCEPTION);
+
+    if (effective_addr2 < TAC_TABORT)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    ARCH_DEP(txf_abort) (regs, effective_addr2);
+
+} /* end DEF_INST(transaction_abort) */
+
+
+/*-------------------------------------------------------------------*/
+/* E325 NTSTG - Nontransactional Store                         [RXY] */
+/*-------------------------------------------------------------------*/
+DEF_INST(nontransactional_store)
+{
+int     r1;                             /* Value of R field          */
+int     b2;                             /* Base of effective addr    */
+VADR    effective_addr2;                /* Effective address         */
+BYTE   *main;                           /* Mainstor address          */
+RADR    abs;                            /* Absolute address          */
+TXFPAGE *pg;                            /* -> Page buffer            */
+int     i;                              /* Page buffer index         */
+
+    RXY(inst, regs, r1, b2, effective_addr2);
+
+    FACILITY_CHECK(TRANSACT_EXEC, regs);
+    DW_CHECK(effective_addr2, regs);
+
+    if (regs->txf_tnd == 0)
+    {
+        ARCH_DEP(vstore8) (regs->GR_G(r1), effective_addr2, b2, regs);
+        return;
+    }
+
+    /* Store directly into main storage so that the store is kept if
+       the transaction aborts, and into the copies of the page held
+       by the transaction so that it neither conflicts with nor is
+       overwritten by the transaction's own stores */
+    main = txf_check(regs, ARCH_DEP(logical_to_main_l) (effective_addr2,
+                            b2, regs, ACCTYPE_WRITE, regs->psw.pkey, 8),
+                     ACCTYPE_WRITE);
+    STORE_DW(main, regs->GR_G(r1));
+
+    abs = main - sysblk.mainstor;
+    for (i = 0, pg = regs->txf_pages; i < regs->txf_npages; i++, pg++)
+    {
+        if (pg->abspage == (abs & PAGEFRAME_PAGEMASK))
+        {
+            STORE_DW((BYTE *)pg->save + (abs & PAGEFRAME_BYTEMASK),
+                     regs->GR_G(r1));
+            STORE_DW((BYTE *)pg->alt + (abs & PAGEFRAME_BYTEMASK),
+                     regs->GR_G(r1));
+            break;
+        }
+    }
+
+} /* end DEF_INST(nontransactional_store) */
+
+
+/*-------------------------------------------------------------------*/
+/* E560 TBEGIN - Transaction Begin                             [SIL] */
+/*-------------------------------------------------------------------*/
+DEF_INST(transaction_begin)
+{
+int     b1;                             /* Base of effective addr    */
+VADR    effective_addr1;                /* Effective address         */
+int     i2;                             /* 16-bit immediate value    */
+int     pifc;                           /* Filter control from I2    */
+
+    SIL(inst, regs, i2, b1, effective_addr1);
+
+    FACILITY_CHECK(TRANSACT_EXEC, regs);
+    TXF_EXECUTE_CHECK(regs);
+    TXF_CONTROL_CHECK(regs);
+
+    /* TBEGIN in a constrained transaction */
+    if (regs->txf_tnd && regs->txf_contran)
+        regs->program_interrupt(regs, PGM_TRANSACTION_CONSTRAINT_EXCEPTION);
+
+    pifc = i2 & 0x0003;
+    if (pifc == 3 || (b1 != 0 && (effective_addr1 & 0x07)))
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    if (regs->txf_tnd == 0)
+    {
+        /* The TDB must be accessible when the transaction begins */
+        regs->txf_tdbvalid = (b1 != 0);
+        if (b1 != 0)
+        {
+            ARCH_DEP(validate_operand) (effective_addr1, b1,
+                            sizeof(TDB)-1, ACCTYPE_WRITE_SKP, regs);
+            regs->txf_tdba = effective_addr1;
+            regs->txf_tdbarn = b1;
+        }
+        regs->txf_pifc = pifc;
+    }
+    else if (pifc > regs->txf_pifc)
+        regs->txf_pifc = pifc;
+
+    ARCH_DEP(txf_begin) (regs, 0, i2 >> 8);
+
+} /* end DEF_INST(transaction_begin) */
+
+
+/*-------------------------------------------------------------------*/
+/* E561 TBEGINC - Transaction Begin Constrained                [SIL] */
+/*-------------------------------------------------------------------*/
+DEF_INST(transaction_begin_constrained)
+{
+int     b1;                             /* Base of effective addr    */
+VADR    effective_addr1;                /* Effective address         */
+int     i2;                             /* 16-bit immediate value    */
+
+    SIL(inst, regs, i2, b1, effective_addr1);
+
+    FACILITY_CHECK(CONSTRAINED_TRANSACT, regs);
+    TXF_EXECUTE_CHECK(regs);
+    TXF_CONTROL_CHECK(regs);
+
+    if (regs->txf_tnd && regs->txf_contran)
+        regs->program_interrupt(regs, PGM_TRANSACTION_CONSTRAINT_EXCEPTION);
+
+    /* Within a nonconstrained transaction TBEGINC just nests */
+    if (regs->txf_tnd == 0)
+    {
+        regs->txf_tdbvalid = 0;
+        regs->txf_pifc = 0;
+        ARCH_DEP(txf_begin) (regs, 1, i2 >> 8);
+    }
+    else
+        ARCH_DEP(txf_begin) (regs, 0, i2 >> 8);
+
+} /* end DEF_INST(transaction_begin_constrained) */
+
+#endif /*defined(FEATURE_TRANSACTIONAL_EXECUTION_FACILITY)*/
+
+#if !defined(_GEN_ARCH)
+
+#if defined(_ARCHMODE2)
+ #define  _GEN_ARCH _ARCHMODE2
+ #include "transact.c"
+#endif
+
+#if defined(_ARCHMODE3)
+ #undef   _GEN_ARCH
+ #define  _GEN_ARCH _ARCHMODE3
+ #include "transact.c"
+#endif
+
+#endif /*!defined(_GEN_ARCH)*/
+
+
+/* end of transact.c */
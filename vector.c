@@ -34,6 +34,885 @@
    I do not know if the book or VM is wrong.                     *JJ */
 #define VSA_ALIGN       4
 
+#if !defined(_VECTOR_C_ONCE_)
+#define _VECTOR_C_ONCE_
+
+/*-------------------------------------------------------------------*/
+/* Element kernels for the fullword binary and logical instructions  */
+/*                                                                   */
+/* Vector registers are held as arrays of host-order fullwords, so   */
+/* whole runs of elements are processed with SSE2 (4 lanes) or AVX2  */
+/* (8 lanes) on x86 hosts.  Results are computed for complete groups */
+/* of 8 elements, one VMR byte, and then committed for the elements  */
+/* in range and, in mask mode, selected by the VMR.  AVX2 is used    */
+/* when CPUID reports it.  The vfsimd command may select a lower     */
+/* level, which is how tests/vfacility.tst checks the scalar and     */
+/* SIMD paths against each other.                                    */
+/*-------------------------------------------------------------------*/
+
+#if (defined(__SSE2__) || defined(_M_X64)) && !defined(WORDS_BIGENDIAN)
+ #define VECTOR_SSE2                    /* Use host SSE2 instructions */
+ #include <emmintrin.h>
+ #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define VECTOR_AVX2                   /* AVX2 when the host has it  */
+  #include <immintrin.h>
+ #endif
+#endif
+
+#define VF_ADD          0               /* Element operations        */
+#define VF_SUB          1
+#define VF_AND          2
+#define VF_OR           3
+#define VF_XOR          4
+#define VF_CMP          5
+#define VF_LOAD         6
+#define VF_STORE        7
+
+#define VF_EQ           4               /* Compare mask: equal       */
+#define VF_LO           2               /*   operand 1 low           */
+#define VF_HI           1               /*   operand 1 high          */
+
+#define VF_GROUP        8               /* Elements per VMR byte     */
+#define VF_CHUNK        64              /* Elements per storage access
+                                           (256 bytes)               */
+
+/* Number of VMR bytes holding n active bits */
+#define VMR_BYTES(_n)   (((_n) + 7) >> 3)
+
+/* Bit reversal of a byte: VMR bit order to lane order and back */
+#define VF_R2(n)        n,       n + 2*64,  n + 1*64,  n + 3*64
+#define VF_R4(n)        VF_R2(n), VF_R2(n + 2*16), VF_R2(n + 1*16), VF_R2(n + 3*16)
+#define VF_R6(n)        VF_R4(n), VF_R4(n + 2*4),  VF_R4(n + 1*4),  VF_R4(n + 3*4)
+static const BYTE vf_bitrev[256] = { VF_R6(0), VF_R6(2), VF_R6(1), VF_R6(3) };
+
+static int vf_host = -1;                /* Highest host kernel level */
+
+/* Kernel level to use: the host level limited by vfsimd */
+static int vf_simd_level(void)
+{
+int     level = VF_SCALAR;
+
+    if (unlikely(vf_host < 0))
+    {
+#if defined(VECTOR_SSE2)
+        level = VF_SSE2;
+#endif
+#if defined(VECTOR_AVX2)
+        if (__builtin_cpu_supports("avx2"))
+            level = VF_AVX2;
+#endif
+        vf_host = level;
+    }
+
+    return MIN(vf_host, sysblk.vfsimd);
+}
+
+/* Lane number of the lowest bit set in a nonzero lane mask */
+static INLINE int vf_first(int lanes)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(lanes);
+#else
+int     i;
+
+    for (i = 0; !(lanes & (1 << i)); i++);
+    return i;
+#endif
+}
+
+/* Number of one bits in the first n bits of the VMR */
+static INLINE U32 vmr_count_ones(const BYTE *vmr, U32 n)
+{
+U32     i, c = 0;
+BYTE    b;
+
+    for (i = 0; i < VMR_BYTES(n); i++)
+    {
+        b = vmr[i];
+        if ((i + 1) * 8 > n)
+            b &= 0xFF00 >> (n & 7);
+#if defined(__GNUC__)
+        c += __builtin_popcount(b);
+#else
+        for (; b; b &= b - 1)
+            c++;
+#endif
+    }
+    return c;
+}
+
+/* Set the VMR bits for elements n and above to zero */
+static INLINE void vmr_trim(BYTE *vmr, U32 n)
+{
+U32     i = n >> 3;
+
+    if (i < MAX_VECTOR_SECTION_SIZE/8)
+    {
+        vmr[i] &= 0x7F00 >> (n & 7);
+        memset(vmr + i + 1, 0, MAX_VECTOR_SECTION_SIZE/8 - i - 1);
+    }
+}
+
+/* AND, OR or exclusive OR a mask into the VMR a doubleword at a time */
+static INLINE void vmr_logic(int op, BYTE *vmr, const BYTE *mask)
+{
+U64     x, y;
+int     i;
+
+    for (i = 0; i < MAX_VECTOR_SECTION_SIZE/8; i += 8)
+    {
+        memcpy(&x, vmr + i, 8);
+        memcpy(&y, mask + i, 8);
+        x = op == VF_AND ? x & y : op == VF_OR ? x | y : x ^ y;
+        memcpy(vmr + i, &x, 8);
+    }
+}
+
+/* Complement the VMR */
+static INLINE void vmr_complement(BYTE *vmr)
+{
+U64     x;
+int     i;
+
+    for (i = 0; i < MAX_VECTOR_SECTION_SIZE/8; i += 8)
+    {
+        memcpy(&x, vmr + i, 8);
+        x = ~x;
+        memcpy(vmr + i, &x, 8);
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/* Compute r = a op b for ng groups of elements.  For add and        */
+/* subtract the lanes which overflowed are returned in ovf, one byte */
+/* per group in lane order (bit 0 is the first element).             */
+/*-------------------------------------------------------------------*/
+static void vf_op_scalar(int op, U32 *r, const U32 *a, const U32 *b,
+                         BYTE *ovf, int ng)
+{
+int     i, j;
+U32     x;
+
+    for (j = 0; j < ng; j++, r += VF_GROUP, a += VF_GROUP, b += VF_GROUP)
+    {
+        ovf[j] = 0;
+        for (i = 0; i < VF_GROUP; i++)
+        {
+            switch (op) {
+            case VF_ADD:
+                x = r[i] = a[i] + b[i];
+                ovf[j] |= (((a[i] ^ x) & (b[i] ^ x)) >> 31) << i;
+                break;
+            case VF_SUB:
+                x = r[i] = a[i] - b[i];
+                ovf[j] |= (((a[i] ^ b[i]) & (a[i] ^ x)) >> 31) << i;
+                break;
+            case VF_AND: r[i] = a[i] & b[i]; break;
+            case VF_OR:  r[i] = a[i] | b[i]; break;
+            default:     r[i] = a[i] ^ b[i]; break;
+            }
+        }
+    }
+}
+
+/* Compare a with b; return the lanes meeting mask m in bits */
+static void vf_cmp_scalar(int m, const U32 *a, const U32 *b,
+                          BYTE *bits, int ng)
+{
+int     i, j;
+
+    for (j = 0; j < ng; j++, a += VF_GROUP, b += VF_GROUP)
+    {
+        bits[j] = 0;
+        for (i = 0; i < VF_GROUP; i++)
+            if (m & ((S32)a[i] == (S32)b[i] ? VF_EQ :
+                     (S32)a[i] <  (S32)b[i] ? VF_LO : VF_HI))
+                bits[j] |= 1 << i;
+    }
+}
+
+/* Convert n fullwords between storage and host byte order */
+static void vf_swap_scalar(U32 *d, const U32 *s, int n)
+{
+int     i;
+
+    for (i = 0; i < n; i++)
+        d[i] = CSWAP32(s[i]);
+}
+
+#if defined(VECTOR_SSE2)
+static void vf_op_sse2(int op, U32 *r, const U32 *a, const U32 *b,
+                       BYTE *ovf, int ng)
+{
+int     i;
+__m128i x, y, z, o;
+
+    for (i = 0; i < ng * VF_GROUP; i += 4)
+    {
+        x = _mm_loadu_si128((const __m128i *)(a + i));
+        y = _mm_loadu_si128((const __m128i *)(b + i));
+        switch (op) {
+        case VF_ADD:
+            z = _mm_add_epi32(x, y);
+            o = _mm_and_si128(_mm_xor_si128(x, z), _mm_xor_si128(y, z));
+            break;
+        case VF_SUB:
+            z = _mm_sub_epi32(x, y);
+            o = _mm_and_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, z));
+            break;
+        case VF_AND: z = _mm_and_si128(x, y); o = _mm_setzero_si128(); break;
+        case VF_OR:  z = _mm_or_si128(x, y);  o = _mm_setzero_si128(); break;
+        default:     z = _mm_xor_si128(x, y); o = _mm_setzero_si128(); break;
+        }
+        _mm_storeu_si128((__m128i *)(r + i), z);
+        if (i & 4)
+            ovf[i >> 3] |= _mm_movemask_ps(_mm_castsi128_ps(o)) << 4;
+        else
+            ovf[i >> 3] = _mm_movemask_ps(_mm_castsi128_ps(o));
+    }
+}
+
+static void vf_cmp_sse2(int m, const U32 *a, const U32 *b,
+                        BYTE *bits, int ng)
+{
+int     i;
+__m128i x, y, z;
+
+    for (i = 0; i < ng * VF_GROUP; i += 4)
+    {
+        x = _mm_loadu_si128((const __m128i *)(a + i));
+        y = _mm_loadu_si128((const __m128i *)(b + i));
+        z = _mm_setzero_si128();
+        if (m & VF_EQ) z = _mm_or_si128(z, _mm_cmpeq_epi32(x, y));
+        if (m & VF_LO) z = _mm_or_si128(z, _mm_cmplt_epi32(x, y));
+        if (m & VF_HI) z = _mm_or_si128(z, _mm_cmpgt_epi32(x, y));
+        if (i & 4)
+            bits[i >> 3] |= _mm_movemask_ps(_mm_castsi128_ps(z)) << 4;
+        else
+            bits[i >> 3] = _mm_movemask_ps(_mm_castsi128_ps(z));
+    }
+}
+
+static void vf_swap_sse2(U32 *d, const U32 *s, int n)
+{
+int     i;
+__m128i x;
+
+    for (i = 0; i + 4 <= n; i += 4)
+    {
+        x = _mm_loadu_si128((const __m128i *)(s + i));
+        x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xB1), 0xB1);
+        x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        _mm_storeu_si128((__m128i *)(d + i), x);
+    }
+    vf_swap_scalar(d + i, s + i, n - i);
+}
+#endif /*defined(VECTOR_SSE2)*/
+
+#if defined(VECTOR_AVX2)
+__attribute__((target("avx2")))
+static void vf_op_avx2(int op, U32 *r, const U32 *a, const U32 *b,
+                       BYTE *ovf, int ng)
+{
+int     i;
+__m256i x, y, z, o;
+
+    for (i = 0; i < ng; i++)
+    {
+        x = _mm256_loadu_si256((const __m256i *)(a + i * VF_GROUP));
+        y = _mm256_loadu_si256((const __m256i *)(b + i * VF_GROUP));
+        switch (op) {
+        case VF_ADD:
+            z = _mm256_add_epi32(x, y);
+            o = _mm256_and_si256(_mm256_xor_si256(x, z),
+                                 _mm256_xor_si256(y, z));
+            break;
+        case VF_SUB:
+            z = _mm256_sub_epi32(x, y);
+            o = _mm256_and_si256(_mm256_xor_si256(x, y),
+                                 _mm256_xor_si256(x, z));
+            break;
+        case VF_AND: z = _mm256_and_si256(x, y); o = _mm256_setzero_si256(); break;
+        case VF_OR:  z = _mm256_or_si256(x, y);  o = _mm256_setzero_si256(); break;
+        default:     z = _mm256_xor_si256(x, y); o = _mm256_setzero_si256(); break;
+        }
+        _mm256_storeu_si256((__m256i *)(r + i * VF_GROUP), z);
+        ovf[i] = _mm256_movemask_ps(_mm256_castsi256_ps(o));
+    }
+}
+
+__attribute__((target("avx2")))
+static void vf_cmp_avx2(int m, const U32 *a, const U32 *b,
+                        BYTE *bits, int ng)
+{
+int     i;
+__m256i x, y, z;
+
+    for (i = 0; i < ng; i++)
+    {
+        x = _mm256_loadu_si256((const __m256i *)(a + i * VF_GROUP));
+        y = _mm256_loadu_si256((const __m256i *)(b + i * VF_GROUP));
+        z = _mm256_setzero_si256();
+        if (m & VF_EQ) z = _mm256_or_si256(z, _mm256_cmpeq_epi32(x, y));
+        if (m & VF_LO) z = _mm256_or_si256(z, _mm256_cmpgt_epi32(y, x));
+        if (m & VF_HI) z = _mm256_or_si256(z, _mm256_cmpgt_epi32(x, y));
+        bits[i] = _mm256_movemask_ps(_mm256_castsi256_ps(z));
+    }
+}
+
+__attribute__((target("avx2")))
+static void vf_swap_avx2(U32 *d, const U32 *s, int n)
+{
+int     i;
+const __m256i bs = _mm256_setr_epi8( 3, 2, 1, 0,  7, 6, 5, 4,
+                                    11,10, 9, 8, 15,14,13,12,
+                                     3, 2, 1, 0,  7, 6, 5, 4,
+                                    11,10, 9, 8, 15,14,13,12);
+
+    for (i = 0; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(d + i), _mm256_shuffle_epi8(
+            _mm256_loadu_si256((const __m256i *)(s + i)), bs));
+    vf_swap_scalar(d + i, s + i, n - i);
+}
+#endif /*defined(VECTOR_AVX2)*/
+
+static INLINE void vf_op(int level, int op, U32 *r, const U32 *a,
+                         const U32 *b, BYTE *ovf, int ng)
+{
+#if defined(VECTOR_AVX2)
+    if (level == VF_AVX2)
+        vf_op_avx2(op, r, a, b, ovf, ng);
+    else
+#endif
+#if defined(VECTOR_SSE2)
+    if (level == VF_SSE2)
+        vf_op_sse2(op, r, a, b, ovf, ng);
+    else
+#endif
+        vf_op_scalar(op, r, a, b, ovf, ng);
+}
+
+static INLINE void vf_cmp(int level, int m, const U32 *a, const U32 *b,
+                          BYTE *bits, int ng)
+{
+#if defined(VECTOR_AVX2)
+    if (level == VF_AVX2)
+        vf_cmp_avx2(m, a, b, bits, ng);
+    else
+#endif
+#if defined(VECTOR_SSE2)
+    if (level == VF_SSE2)
+        vf_cmp_sse2(m, a, b, bits, ng);
+    else
+#endif
+        vf_cmp_scalar(m, a, b, bits, ng);
+}
+
+static INLINE void vf_swap(int level, U32 *d, const U32 *s, int n)
+{
+#if defined(VECTOR_AVX2)
+    if (level == VF_AVX2)
+        vf_swap_avx2(d, s, n);
+    else
+#endif
+#if defined(VECTOR_SSE2)
+    if (level == VF_SSE2)
+        vf_swap_sse2(d, s, n);
+    else
+#endif
+        vf_swap_scalar(d, s, n);
+}
+
+/*-------------------------------------------------------------------*/
+/* Apply an element operation to elements ix to end-1.  Operand 1 is */
+/* vector register vr1, operands 3 and 2 are v3 and v2, which are    */
+/* indexed by element number.  Returns the number of the element     */
+/* after the last one processed, which is less than end if an        */
+/* unmasked fixed-point overflow stopped the operation.              */
+/*-------------------------------------------------------------------*/
+static U32 vf_apply(int op, int m, int vr1, const U32 *v3, const U32 *v2,
+                    U32 ix, U32 end, REGS *regs)
+{
+U32     r[MAX_VECTOR_SECTION_SIZE];     /* Result elements           */
+BYTE    bits[MAX_VECTOR_SECTION_SIZE/8]; /* Overflow/compare lanes   */
+U32    *d = regs->vf->vr[vr1];          /* Operand 1 elements        */
+U32     g, g0 = ix / VF_GROUP, g1 = (end + VF_GROUP - 1) / VF_GROUP;
+int     level = vf_simd_level();
+int     lanes, i;
+
+    if (op == VF_LOAD)
+    {
+        memcpy(d + ix, v2 + ix, (end - ix) * sizeof(U32));
+        return end;
+    }
+
+    if (op == VF_CMP)
+    {
+        vf_cmp(level, m, v3 + g0 * VF_GROUP, v2 + g0 * VF_GROUP,
+               bits + g0, g1 - g0);
+        for (g = g0; g < g1; g++)
+        {
+            lanes = 0xFF;
+            if (g * VF_GROUP < ix)
+                lanes &= 0xFF << (ix - g * VF_GROUP);
+            if (end - g * VF_GROUP < VF_GROUP)
+                lanes &= 0xFF >> (VF_GROUP - (end - g * VF_GROUP));
+            lanes = vf_bitrev[lanes];
+            regs->vf->vmr[g] = (regs->vf->vmr[g] & ~lanes)
+                             | (vf_bitrev[bits[g]] & lanes);
+        }
+        return end;
+    }
+
+    vf_op(level, op, r + g0 * VF_GROUP, v3 + g0 * VF_GROUP,
+          v2 + g0 * VF_GROUP, bits + g0, g1 - g0);
+
+    /* Fast path: every element in range is stored */
+    if (!MASK_MODE(regs) && !FOMASK(&regs->psw))
+    {
+        memcpy(d + ix, r + ix, (end - ix) * sizeof(U32));
+        return end;
+    }
+
+    for (g = g0; g < g1; g++)
+    {
+        lanes = 0xFF;
+        if (g * VF_GROUP < ix)
+            lanes &= 0xFF << (ix - g * VF_GROUP);
+        if (end - g * VF_GROUP < VF_GROUP)
+            lanes &= 0xFF >> (VF_GROUP - (end - g * VF_GROUP));
+        if (MASK_MODE(regs))
+            lanes &= vf_bitrev[regs->vf->vmr[g]];
+
+        /* Stop after the first selected element that overflowed */
+        if (FOMASK(&regs->psw) && (bits[g] & lanes))
+        {
+            i = vf_first(bits[g] & lanes);
+            lanes &= (2 << i) - 1;
+            end = g * VF_GROUP + i + 1;
+            g1 = g + 1;
+        }
+
+        for (i = 0; i < VF_GROUP; i++)
+            if (lanes & (1 << i))
+                d[g * VF_GROUP + i] = r[g * VF_GROUP + i];
+    }
+    return end;
+}
+
+#endif /*!defined(_VECTOR_C_ONCE_)*/
+
+/*-------------------------------------------------------------------*/
+/* Fetch fullword elements ix to end-1 of a storage operand, which   */
+/* starts at addr with the given element stride, into buf            */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(vf_fetch)(U32 *buf, U32 ix, U32 end, VADR addr,
+                               S32 stride, int arn, REGS *regs)
+{
+U32     i;
+
+    if (stride == 1)
+    {
+        ARCH_DEP(vfetchc)(buf + ix, (end - ix) * 4 - 1, addr, arn, regs);
+        vf_swap(vf_simd_level(), buf + ix, buf + ix, end - ix);
+    }
+    else
+        for (i = ix; i < end; i++)
+        {
+            buf[i] = ARCH_DEP(vfetch4)(addr, arn, regs);
+            addr = (addr + 4 * stride) & ADDRESS_MAXWRAP(regs);
+        }
+}
+
+
+/*-------------------------------------------------------------------*/
+/* Store elements ix to end-1 of v into a storage operand            */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(vf_store)(const U32 *v, U32 ix, U32 end, VADR addr,
+                               S32 stride, int arn, REGS *regs)
+{
+U32     buf[VF_CHUNK];
+U32     i;
+
+    if (stride == 1)
+    {
+        vf_swap(vf_simd_level(), buf, v + ix, end - ix);
+        ARCH_DEP(vstorec)(buf, (end - ix) * 4 - 1, addr, arn, regs);
+    }
+    else
+        for (i = ix; i < end; i++)
+        {
+            ARCH_DEP(vstore4)(v[i], addr, arn, regs);
+            addr = (addr + 4 * stride) & ADDRESS_MAXWRAP(regs);
+        }
+}
+
+
+/*-------------------------------------------------------------------*/
+/* Common processing for the fullword binary and logical operations. */
+/* v3 holds operand 3: a vector register, or the scalar operand in   */
+/* every element.  Operand 2 is vector register vr2 or, when vr2 is  */
+/* negative, the storage operand addressed by general register rs2   */
+/* with the stride in general register rt2.  Elements are processed  */
+/* from the VIX up to the VCT; storage operands are accessed 256     */
+/* bytes at a time, and the VIX and rs2 are updated after each       */
+/* access so that the instruction can be resumed after an exception. */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(vf_fullword)(int op, int m, int vr1, const U32 *v3,
+                                  int vr2, int rs2, int rt2, REGS *regs)
+{
+U32     buf[MAX_VECTOR_SECTION_SIZE];   /* Storage operand elements  */
+const U32 *v2 = buf;                    /* Operand 2 elements        */
+U32     vct = VECTOR_COUNT(regs);       /* Vector count              */
+U32     ix, end, next;                  /* Element numbers           */
+VADR    addr = 0;                       /* Operand 2 address         */
+S32     stride = 1;                     /* Operand 2 stride          */
+
+    if (vr2 >= 0)
+        v2 = regs->vf->vr[vr2];
+    else
+    {
+        memset(buf, 0, sizeof(buf));
+        addr = regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs);
+        FW_CHECK(addr, regs);
+        if (rt2 != 0)
+            stride = (S32)regs->GR_L(rt2);
+    }
+
+    for (ix = VECTOR_IX(regs); ix < vct; ix = next)
+    {
+        end = vct;
+
+        if (vr2 < 0)
+        {
+            if (end - ix > VF_CHUNK)
+                end = ix + VF_CHUNK;
+            if (op == VF_STORE)
+                ARCH_DEP(vf_store)(regs->vf->vr[vr1], ix, end,
+                                   addr, stride, rs2, regs);
+            else
+                ARCH_DEP(vf_fetch)(buf, ix, end, addr, stride, rs2, regs);
+        }
+
+        next = op == VF_STORE ? end
+             : vf_apply(op, m, vr1, v3, v2, ix, end, regs);
+
+        if (vr2 < 0)
+        {
+            addr = (addr + (next - ix) * 4 * stride) & ADDRESS_MAXWRAP(regs);
+            regs->GR_L(rs2) = addr;
+        }
+
+        SET_VECTOR_IX(next, regs);
+
+        /* Fixed-point overflow interrupts the instruction with the
+           VIX designating the next element to be processed */
+        if (next < end)
+        {
+            UPD_PSW_IA(regs, PSW_IA(regs, -4));
+            regs->program_interrupt(regs, PGM_FIXED_POINT_OVERFLOW_EXCEPTION);
+        }
+    }
+
+    /* The VIX is zero on completion */
+    SET_VECTOR_IX(0, regs);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* VST and QST format instructions.  For QST the third operand is    */
+/* general register QR3; the compare instructions have a mask in     */
+/* place of VR1 and set the VMR instead.                             */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(vf_storage_form)(BYTE inst[], REGS *regs,
+                                      int op, int scalar)
+{
+int     r3, rt2, vr1, rs2;              /* Instruction fields        */
+U32     s[MAX_VECTOR_SECTION_SIZE];     /* Scalar operand            */
+U32     i;
+
+    VST(inst, regs, r3, rt2, vr1, rs2);
+
+    VOP_CHECK(regs);
+
+    if (scalar)
+        for (i = 0; i < VSECT_SIZE; i++)
+            s[i] = regs->GR_L(r3);
+
+    if (op != VF_CMP && op != VF_STORE)
+        SET_VR_RESULT(vr1, regs);
+
+    ARCH_DEP(vf_fullword)(op, vr1, vr1, scalar ? s : regs->vf->vr[r3],
+                          -1, rs2, rt2, regs);
+
+    if (op == VF_CMP)
+        vmr_trim(regs->vf->vmr, VECTOR_COUNT(regs));
+}
+
+
+/*-------------------------------------------------------------------*/
+/* VV and QV format instructions                                     */
+/*-------------------------------------------------------------------*/
+static void ARCH_DEP(vf_register_form)(BYTE inst[], REGS *regs,
+                                       int op, int scalar)
+{
+int     r3, vr1, vr2;                   /* Instruction fields        */
+U32     s[MAX_VECTOR_SECTION_SIZE];     /* Scalar operand            */
+U32     i;
+
+    VR(inst, regs, r3, vr1, vr2);
+
+    VOP_CHECK(regs);
+
+    if (scalar)
+        for (i = 0; i < VSECT_SIZE; i++)
+            s[i] = regs->GR_L(r3);
+
+    if (op != VF_CMP)
+        SET_VR_RESULT(vr1, regs);
+
+    ARCH_DEP(vf_fullword)(op, vr1, vr1, scalar ? s : regs->vf->vr[r3],
+                          vr2, 0, 0, regs);
+
+    if (op == VF_CMP)
+        vmr_trim(regs->vf->vmr, VECTOR_COUNT(regs));
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A409 VL    - Load                                           [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_load)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_LOAD, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A40D VST   - Store                                          [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_store)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_STORE, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A420 VA    - Add                                            [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_add)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_ADD, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A421 VS    - Subtract                                       [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_subtract)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_SUB, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A424 VN    - AND                                            [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_and)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_AND, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A425 VO    - OR                                             [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_or)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_OR, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A426 VX    - Exclusive OR                                   [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_exclusive_or)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_XOR, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A428 VC    - Compare                                        [VST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_compare)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_CMP, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A0 VAS   - Add                                            [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_add_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_ADD, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A1 VSS   - Subtract                                       [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_subtract_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_SUB, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A4 VNS   - AND                                            [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_and_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_AND, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A5 VOS   - OR                                             [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_or_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_OR, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A6 VXS   - Exclusive OR                                   [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_exclusive_or_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_XOR, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A4A8 VCS   - Compare                                        [QST] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_compare_qst)
+{
+    ARCH_DEP(vf_storage_form)(inst, regs, VF_CMP, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A520 VAR   - Add                                             [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_add_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_ADD, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A521 VSR   - Subtract                                        [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_subtract_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_SUB, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A524 VNR   - AND                                             [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_and_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_AND, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A525 VOR   - OR                                              [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_or_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_OR, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A526 VXR   - Exclusive OR                                    [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_exclusive_or_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_XOR, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A528 VCR   - Compare                                         [VV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_compare_vv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_CMP, 0);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A0 VAQ   - Add                                             [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_add_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_ADD, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A1 VSQ   - Subtract                                        [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_subtract_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_SUB, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A4 VNQ   - AND                                             [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_and_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_AND, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A5 VOQ   - OR                                              [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_or_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_OR, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A6 VXQ   - Exclusive OR                                    [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_exclusive_or_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_XOR, 1);
+}
+
+
+/*-------------------------------------------------------------------*/
+/* A5A8 VCQ   - Compare                                         [QV] */
+/*-------------------------------------------------------------------*/
+DEF_INST(v_compare_qv)
+{
+    ARCH_DEP(vf_register_form)(inst, regs, VF_CMP, 1);
+}
+
+
 /*-------------------------------------------------------------------*/
 /* A640 VTVM  - Test VMR                                       [RRE] */
 /*-------------------------------------------------------------------*/
@@ -49,24 +928,10 @@ U32     n, n1;
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* cc0 when the vector count is zero */
-    if( n == 0)
-    {
-        regs->psw.cc = 0;
-        return;
-    }
-
-    /* Preset condition code according to first bit */
-    regs->psw.cc = VMR_SET(0, regs) ? 3 : 0;
-
-    /* Check VMR bit to be equal to the first,
-       exit with cc1 if an unequal bit found */
-    for(n1 = 1; n1 < n; n1++)
-        if((regs->psw.cc == 0) != (VMR_SET(n1, regs) == 0))
-        {
-            regs->psw.cc = 1;
-            return;
-        }
+    /* cc0 when all active bits are zero (or the vector count is
+       zero), cc3 when all are one, cc1 when they are mixed */
+    n1 = vmr_count_ones(regs->vf->vmr, n);
+    regs->psw.cc = n1 == 0 ? 0 : n1 == n ? 3 : 1;
 
 }
 
@@ -77,7 +942,7 @@ U32     n, n1;
 DEF_INST(v_complement_vmr)
 {
 int     unused1, unused2;
-U32     n, n1, n2;
+U32     n;
 
     RRE(inst, regs, unused1, unused2);
 
@@ -86,17 +951,11 @@ U32     n, n1, n2;
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* Bytes - 1 */
-    n1 = n >> 3;
-
     /* Complement VMR */
-    for(n2 = 0; n2 <= n1; n2++)
-        regs->vf->vmr[n2] ^= 0xFF;
+    vmr_complement(regs->vf->vmr);
 
     /* zeroize remainder */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -163,31 +1022,10 @@ U32     n, n1;
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* cc0 when the vector count is zero */
-    if( n == 0)
-    {
-        regs->psw.cc = 0;
-        return;
-    }
-
-    /* Preset condition code according to first bit */
-    regs->psw.cc = VMR_SET(0, regs) ? 3 : 0;
-
-    /* Check VMR bit to be equal to the first,
-       Count all ones, set cc1 if a bit is unequal */
-    regs->GR_L(gr1) = 0;
-    for(n1 = 0; n1 < n; n1++)
-    {
-        if(VMR_SET(n1, regs))
-        {
-            regs->GR_L(gr1)++;
-            if(!VMR_SET(0, regs))
-                regs->psw.cc = 1;
-        }
-        else
-            if(VMR_SET(0, regs))
-                regs->psw.cc = 1;
-    }
+    /* Count all ones; cc0 if all zero, cc3 if all one, else cc1 */
+    n1 = vmr_count_ones(regs->vf->vmr, n);
+    regs->GR_L(gr1) = n1;
+    regs->psw.cc = n1 == 0 ? 0 : n1 == n ? 3 : 1;
 
 }
 
@@ -243,11 +1081,11 @@ U64     d;
     n = regs->GR_L(gr1) & ADDRESS_MAXWRAP(regs);
 
     /* n1 contains the starting element number */
-    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VECTOR_SECTION_SIZE)
+    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VSECT_SIZE)
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* Starting address must be eight times the section size aligned */
-    if((n - (8 * n1)) & ((VECTOR_SECTION_SIZE * VSA_ALIGN) - 1) )
+    if((n - (8 * n1)) & ((VSECT_SIZE * VSA_ALIGN) - 1) )
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* n2 contains VR pair, which must be an even reg */
@@ -260,7 +1098,7 @@ U64     d;
         if( PROBSTATE(&regs->psw) )
             SET_VR_CHANGED(n2, regs);
 
-        for(; n1 < VECTOR_SECTION_SIZE; n1++)
+        for(; n1 < VSECT_SIZE; n1++)
         {
             /* Fetch vr pair from central storage */
             d = ARCH_DEP(vfetch8)(n, gr1, regs);
@@ -285,7 +1123,7 @@ U64     d;
     }
     else
     {
-        regs->GR_L(gr1) += 8 * (VECTOR_SECTION_SIZE - n1);
+        regs->GR_L(gr1) += 8 * (VSECT_SIZE - n1);
         /* indicate v2 pair not restored */
         regs->psw.cc = 0;
     }
@@ -322,11 +1160,11 @@ U64     d;
     n = regs->GR_L(gr1) & ADDRESS_MAXWRAP(regs);
 
     /* n1 contains the starting element number */
-    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VECTOR_SECTION_SIZE)
+    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VSECT_SIZE)
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* Starting address must be eight times the section size aligned */
-    if((n - (8 * n1)) & ((VECTOR_SECTION_SIZE * VSA_ALIGN) - 1) )
+    if((n - (8 * n1)) & ((VSECT_SIZE * VSA_ALIGN) - 1) )
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* n2 contains VR pair, which must be an even reg */
@@ -335,7 +1173,7 @@ U64     d;
 
     if( VR_CHANGED(n2, regs) )
     {
-        for(; n1 < VECTOR_SECTION_SIZE; n1++)
+        for(; n1 < VSECT_SIZE; n1++)
         {
             /* Store vr pair in savearea */
             d = ((U64)regs->vf->vr[n2][n1] << 32)
@@ -362,7 +1200,7 @@ U64     d;
     }
     else
     {
-        regs->GR_L(gr1) += 8 * (VECTOR_SECTION_SIZE - n1);
+        regs->GR_L(gr1) += 8 * (VSECT_SIZE - n1);
         /* vr pair not saved */
         regs->psw.cc = 0;
     }
@@ -397,11 +1235,11 @@ U64     d;
     n = regs->GR_L(gr1) & ADDRESS_MAXWRAP(regs);
 
     /* n1 contains the starting element number */
-    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VECTOR_SECTION_SIZE)
+    if((n1 = regs->GR_L(gr1 + 1) >> 16) >= VSECT_SIZE)
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* Starting address must be eight times the section size aligned */
-    if((n - (8 * n1)) & ((VECTOR_SECTION_SIZE * VSA_ALIGN) - 1) )
+    if((n - (8 * n1)) & ((VSECT_SIZE * VSA_ALIGN) - 1) )
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* n2 contains VR pair, which must be an even reg */
@@ -410,7 +1248,7 @@ U64     d;
 
     if( VR_INUSE(n2, regs) )
     {
-        for(; n1 < VECTOR_SECTION_SIZE; n1++)
+        for(; n1 < VSECT_SIZE; n1++)
         {
             /* Store vr pair in savearea */
             d = ((U64)regs->vf->vr[n2][n1] << 32)
@@ -434,7 +1272,7 @@ U64     d;
     }
     else
     {
-        regs->GR_L(gr1) += 8 * (VECTOR_SECTION_SIZE - n1);
+        regs->GR_L(gr1) += 8 * (VSECT_SIZE - n1);
         /* Indicate vr pair not restored */
         regs->psw.cc = 0;
     }
@@ -456,7 +1294,7 @@ U64     d;
 DEF_INST(v_load_vmr)
 {
 int     rs2;
-U32     n, n1;
+U32     n;
 
     VS(inst, regs, rs2);
 
@@ -464,15 +1302,13 @@ U32     n, n1;
 
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
-    n1 = n >> 3;
 
-    ARCH_DEP(vfetchc)(regs->vf->vmr, n1,
-        regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
+    if (n)
+        ARCH_DEP(vfetchc)(regs->vf->vmr, VMR_BYTES(n) - 1,
+            regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
     /* Set the inactive bits to zero */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -483,7 +1319,7 @@ U32     n, n1;
 DEF_INST(v_load_vmr_complement)
 {
 int     rs2;
-U32     n, n1, n2;
+U32     n;
 
     VS(inst, regs, rs2);
 
@@ -492,20 +1328,15 @@ U32     n, n1, n2;
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* Number of bytes - 1 */
-    n1 = n >> 3;
-
-    ARCH_DEP(vfetchc)(regs->vf->vmr, n1,
-        regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
+    if (n)
+        ARCH_DEP(vfetchc)(regs->vf->vmr, VMR_BYTES(n) - 1,
+            regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
     /* Complement all bits loaded */
-    for(n2 = 0; n2 <= n1; n2++)
-        regs->vf->vmr[n2] ^= 0xFF;
+    vmr_complement(regs->vf->vmr);
 
     /* Set the inactive bits to zero */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -525,7 +1356,8 @@ U32     n;
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    ARCH_DEP(vstorec)(regs->vf->vmr, n >> 3,
+    if (n)
+        ARCH_DEP(vstorec)(regs->vf->vmr, VMR_BYTES(n) - 1,
             regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
 }
@@ -537,8 +1369,8 @@ U32     n;
 DEF_INST(v_and_to_vmr)
 {
 int     rs2;
-U32     n, n1, n2;
-BYTE    workvmr[VECTOR_SECTION_SIZE/8];
+U32     n;
+BYTE    workvmr[MAX_VECTOR_SECTION_SIZE/8] = {0};
 
     VS(inst, regs, rs2);
 
@@ -547,20 +1379,15 @@ BYTE    workvmr[VECTOR_SECTION_SIZE/8];
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* Number of bytes - 1 */
-    n1 = n >> 3;
-
-    ARCH_DEP(vfetchc)(workvmr, n1,
-        regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
+    if (n)
+        ARCH_DEP(vfetchc)(workvmr, VMR_BYTES(n) - 1,
+            regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
     /* And VMR with workvmr */
-    for(n2 = 0; n2 <= n1; n2++)
-        regs->vf->vmr[n2] &= workvmr[n2];
+    vmr_logic(VF_AND, regs->vf->vmr, workvmr);
 
     /* zeroize remainder */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -571,8 +1398,8 @@ BYTE    workvmr[VECTOR_SECTION_SIZE/8];
 DEF_INST(v_or_to_vmr)
 {
 int     rs2;
-U32     n, n1, n2;
-BYTE    workvmr[VECTOR_SECTION_SIZE/8];
+U32     n;
+BYTE    workvmr[MAX_VECTOR_SECTION_SIZE/8] = {0};
 
     VS(inst, regs, rs2);
 
@@ -581,20 +1408,15 @@ BYTE    workvmr[VECTOR_SECTION_SIZE/8];
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* Number of bytes - 1 */
-    n1 = n >> 3;
-
-    ARCH_DEP(vfetchc)(workvmr, n1,
-        regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
+    if (n)
+        ARCH_DEP(vfetchc)(workvmr, VMR_BYTES(n) - 1,
+            regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
     /* OR VMR with workvmr */
-    for(n2 = 0; n2 <= n1; n2++)
-        regs->vf->vmr[n2] |= workvmr[n2];
+    vmr_logic(VF_OR, regs->vf->vmr, workvmr);
 
     /* zeroize remainder */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -605,8 +1427,8 @@ BYTE    workvmr[VECTOR_SECTION_SIZE/8];
 DEF_INST(v_exclusive_or_to_vmr)
 {
 int     rs2;
-U32     n, n1, n2;
-BYTE    workvmr[VECTOR_SECTION_SIZE/8];
+U32     n;
+BYTE    workvmr[MAX_VECTOR_SECTION_SIZE/8] = {0};
 
     VS(inst, regs, rs2);
 
@@ -615,20 +1437,15 @@ BYTE    workvmr[VECTOR_SECTION_SIZE/8];
     /* Extract vector count (number of active bits in vmr) */
     n = VECTOR_COUNT(regs);
 
-    /* Number of bytes - 1 */
-    n1 = n >> 3;
-
-    ARCH_DEP(vfetchc)(workvmr, n1,
-        regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
+    if (n)
+        ARCH_DEP(vfetchc)(workvmr, VMR_BYTES(n) - 1,
+            regs->GR_L(rs2) & ADDRESS_MAXWRAP(regs), rs2, regs);
 
-    /* OR VMR with workvmr */
-    for(n2 = 0; n2 <= n1; n2++)
-        regs->vf->vmr[n2] ^= workvmr[n2];
+    /* Exclusive OR VMR with workvmr */
+    vmr_logic(VF_XOR, regs->vf->vmr, workvmr);
 
     /* zeroize remainder */
-    regs->vf->vmr[n1] &= 0x7F00 >> (n & 7);
-    for(n1++; n1 < sizeof(regs->vf->vmr); n1++)
-        regs->vf->vmr[n1] = 0;
+    vmr_trim(regs->vf->vmr, n);
 
 }
 
@@ -664,7 +1481,7 @@ VADR    effective_addr2;                /* Effective address         */
 
     VOP_CHECK(regs);
 
-    ARCH_DEP(vstorec)(regs->vf->vmr, sizeof(regs->vf->vmr) - 1,
+    ARCH_DEP(vstorec)(regs->vf->vmr, VSECT_SIZE/8 - 1,
         effective_addr2, b2, regs);
 
 }
@@ -693,8 +1510,8 @@ U64     d;
        vector count not greater then section size and
        vector interruption index not greater then section size */
     if((d & VSR_RESV)
-        || ((d & VSR_VCT) >> 32) > VECTOR_SECTION_SIZE
-        || ((d & VSR_VIX) >> 16) >= VECTOR_SECTION_SIZE)
+        || ((d & VSR_VCT) >> 32) > VSECT_SIZE
+        || ((d & VSR_VIX) >> 16) >= VSECT_SIZE)
         ARCH_DEP(program_interrupt)(regs, PGM_SPECIFICATION_EXCEPTION);
 
     /* In problem state the change bit are set corresponding
@@ -710,7 +1527,7 @@ U64     d;
     {
         if( VR_INUSE(n1, regs)
             && !((d & VSR_VIU) & (VSR_VCH0 >> (n1 >> 1))) )
-            for(n2 = 0; n2 < VECTOR_SECTION_SIZE; n2++)
+            for(n2 = 0; n2 < VSECT_SIZE; n2++)
             {
                 regs->vf->vr[n1][n2] = 0;
                 regs->vf->vr[n1+1][n2] = 0;
@@ -735,7 +1552,7 @@ VADR    effective_addr2;                /* Effective address         */
 
     VOP_CHECK(regs);
 
-    ARCH_DEP(vfetchc)(regs->vf->vmr, sizeof(regs->vf->vmr) - 1,
+    ARCH_DEP(vfetchc)(regs->vf->vmr, VSECT_SIZE/8 - 1,
         effective_addr2, b2, regs);
 
 }
@@ -756,11 +1573,11 @@ U32     n;
 
     regs->psw.cc = ((S32)effective_addr2 == 0) ? 0 :
                    ((S32)effective_addr2 < 0) ? 1 :
-                   ((S32)effective_addr2 > VECTOR_SECTION_SIZE) ? 2 : 3;
+                   ((S32)effective_addr2 > VSECT_SIZE) ? 2 : 3;
 
     n = (S32)effective_addr2 < 0 ? 0 :
-        (S32)effective_addr2 > VECTOR_SECTION_SIZE ?
-                 VECTOR_SECTION_SIZE : (S32)effective_addr2;
+        (S32)effective_addr2 > VSECT_SIZE ?
+                 VSECT_SIZE : (S32)effective_addr2;
 
     regs->vf->vsr &= ~VSR_VCT;
     regs->vf->vsr |= (U64)n << 32;
@@ -791,7 +1608,7 @@ U32     n, n1, n2;
     for(n1 = 0, n2 = 0x80; n1 <= 14; n1 += 2, n2 >>= 1)
         if(effective_addr2 & n2)
         {
-            for(n = 0; n < VECTOR_SECTION_SIZE; n++)
+            for(n = 0; n < VSECT_SIZE; n++)
             {
                 regs->vf->vr[n1][n] = 0;
                 regs->vf->vr[n1+1][n] = 0;
@@ -840,8 +1657,8 @@ U32     n;
                    ((S32)effective_addr2 < VECTOR_COUNT(regs)) ? 2 : 3;
 
     n = (S32)effective_addr2 < 0 ? 0 :
-        (S32)effective_addr2 > VECTOR_SECTION_SIZE ?
-                 VECTOR_SECTION_SIZE : (S32)effective_addr2;
+        (S32)effective_addr2 > VSECT_SIZE ?
+                 VSECT_SIZE : (S32)effective_addr2;
 
     regs->vf->vsr &= ~VSR_VIX;
     regs->vf->vsr |= (U64)n << 16;
@@ -864,7 +1681,7 @@ VADR    effective_addr2;                /* Effective address         */
     FW_CHECK(effective_addr2, regs);
 
     /* Store the section size and partial sum number */
-    ARCH_DEP(vstore4)(VECTOR_SECTION_SIZE << 16 | VECTOR_PARTIAL_SUM_NUMBER,
+    ARCH_DEP(vstore4)(VSECT_SIZE << 16 | VECTOR_PARTIAL_SUM_NUMBER,
                                   effective_addr2, b2, regs);
 
 }
@@ -0,0 +1,2237 @@
+/* ZVECTOR.C    z/Architecture Vector Facility instructions          */
+/*                                                                   */
+/*   Released under "The Q Public License Version 1"                 */
+/*   (http://www.hercules-390.org/herclic.html) as modifications to  */
+/*   Hercules.                                                       */
+
+/*-------------------------------------------------------------------*/
+/* This module implements the integer, string, load/store and        */
+/* permute instructions of the z/Architecture Vector Facility        */
+/* (facility bit 129) described in the z/Architecture Principles of  */
+/* Operation manual.  The vector floating point instructions are not */
+/* implemented.                                                      */
+/*                                                                   */
+/* Each vector register is held as a 128-bit VREG in host byte order */
+/* so that whole registers can be moved and operated on with host    */
+/* SSE2 instructions; see the VR_B/VR_H/VR_F/VR_D macros in esa390.h */
+/* for the mapping of guest element numbers.  Bits 0-63 of VR0-VR15  */
+/* overlay floating point registers 0-15 and are kept in regs->fpr.  */
+/*-------------------------------------------------------------------*/
+
+#include "hstdinc.h"
+
+#define _ZVECTOR_C_
+#define _HENGINE_DLL_
+
+#include "hercules.h"
+#include "opcode.h"
+#include "inline.h"
+
+#if defined(FEATURE_ZVECTOR_FACILITY)
+
+#if !defined(_ZVECTOR_C_ONCE_)
+#define _ZVECTOR_C_ONCE_
+
+#if (defined(__SSE2__) || defined(_M_X64)) && !defined(WORDS_BIGENDIAN)
+ #define ZVECTOR_SSE2                   /* Use host SSE2 instructions */
+ #include <emmintrin.h>
+ #define VR_LOAD(_v)      _mm_loadu_si128((const __m128i *)&(_v))
+ #define VR_STORE(_v,_x)  _mm_storeu_si128((__m128i *)&(_v), (_x))
+#endif
+
+/* Element size control (0=byte 1=halfword 2=word 3=doubleword) */
+#define VE_COUNT(_es)   (16 >> (_es))   /* Elements in a register    */
+#define VE_BITS(_es)    (8 << (_es))    /* Bits in an element        */
+
+/* Byte mask bits for element _e; bit 15 is byte 0 of the register */
+#define VE_MASK(_es,_e) \
+        (((1U << (1 << (_es))) - 1) << (16 - (((_e) + 1) << (_es))))
+
+/* Program check if the element size control is out of range */
+#define VE_SIZE_CHECK(_es, _min, _max, _regs) \
+        if ((_es) < (_min) || (_es) > (_max)) \
+            (_regs)->program_interrupt((_regs), PGM_SPECIFICATION_EXCEPTION)
+
+/* Flags in the M5 or M6 field of the string instructions */
+#define VS_IN           0x8             /* Invert result             */
+#define VS_RT           0x4             /* Result type               */
+#define VS_ZS           0x2             /* Zero search               */
+#define VS_CS           0x1             /* Condition code set        */
+
+/* Element shift operations */
+#define VE_SLL          0               /* Shift left                */
+#define VE_SRL          1               /* Shift right logical       */
+#define VE_SRA          2               /* Shift right arithmetic    */
+#define VE_RLL          3               /* Rotate left logical       */
+
+static INLINE U64 ve_mask(int es)
+{
+    return es >= 3 ? (U64)-1 : ((U64)1 << VE_BITS(es)) - 1;
+}
+
+static INLINE S64 ve_sext(U64 x, int es)
+{
+int     n = 64 - VE_BITS(es);
+
+    return (S64)(x << n) >> n;
+}
+
+static INLINE U64 ve_get(const VREG *v, int es, int e)
+{
+    switch (es) {
+    case 0:  return VR_B(*v, e);
+    case 1:  return VR_H(*v, e);
+    case 2:  return VR_F(*v, e);
+    default: return VR_D(*v, e);
+    }
+}
+
+static INLINE void ve_put(VREG *v, int es, int e, U64 x)
+{
+    switch (es) {
+    case 0:  VR_B(*v, e) = (BYTE)x; break;
+    case 1:  VR_H(*v, e) = (U16)x;  break;
+    case 2:  VR_F(*v, e) = (U32)x;  break;
+    default: VR_D(*v, e) = x;       break;
+    }
+}
+
+static INLINE U64 ve_shift(U64 x, int es, int n, int op)
+{
+    switch (op) {
+    case VE_SLL: return (x << n) & ve_mask(es);
+    case VE_SRL: return x >> n;
+    case VE_SRA: return (U64)(ve_sext(x, es) >> n) & ve_mask(es);
+    default:     return n ? ((x << n) | (x >> (VE_BITS(es) - n)))
+                            & ve_mask(es) : x;
+    }
+}
+
+static INLINE int ve_clz(U64 x, int es)
+{
+int     n;
+
+    for (n = 0; n < VE_BITS(es); n++)
+        if (x & ((U64)1 << (VE_BITS(es) - 1 - n)))
+            break;
+    return n;
+}
+
+static INLINE int ve_ctz(U64 x, int es)
+{
+int     n;
+
+    for (n = 0; n < VE_BITS(es); n++)
+        if (x & ((U64)1 << n))
+            break;
+    return n;
+}
+
+/* Byte index of the leftmost byte selected by mask m, or 16 */
+static INLINE int vr_first(U32 m)
+{
+#if defined(__GNUC__)
+    return m ? __builtin_clz(m) - 16 : 16;
+#else
+int     i;
+
+    for (i = 0; i < 16; i++)
+        if (m & (0x8000 >> i))
+            break;
+    return i;
+#endif
+}
+
+/* Set each byte of v to ones or zeros from the 16-bit byte mask */
+static INLINE void vr_expand(VREG *v, U32 m)
+{
+int     i;
+
+    for (i = 0; i < 16; i++)
+        VR_B(*v, i) = (m & (0x8000 >> i)) ? 0xFF : 0x00;
+}
+
+static INLINE void vr_splat(VREG *v, int es, U64 x)
+{
+int     e;
+
+#if defined(ZVECTOR_SSE2)
+    switch (es) {
+    case 0: VR_STORE(*v, _mm_set1_epi8((char)x));   return;
+    case 1: VR_STORE(*v, _mm_set1_epi16((short)x)); return;
+    case 2: VR_STORE(*v, _mm_set1_epi32((int)x));   return;
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+        ve_put(v, es, e, x);
+}
+
+/* Byte mask of the elements of a that are equal to those of b */
+static U32 vr_eqmask(const VREG *a, const VREG *b, int es)
+{
+U32     m = 0;
+int     e;
+
+#if defined(ZVECTOR_SSE2)
+    __m128i x = VR_LOAD(*a), y = VR_LOAD(*b);
+
+    switch (es) {
+    case 0: return _mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+    case 1: return _mm_movemask_epi8(_mm_cmpeq_epi16(x, y));
+    case 2: return _mm_movemask_epi8(_mm_cmpeq_epi32(x, y));
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+        if (ve_get(a, es, e) == ve_get(b, es, e))
+            m |= VE_MASK(es, e);
+    return m;
+}
+
+/* Byte mask of the elements of a that are greater than those of b */
+static U32 vr_gtmask(const VREG *a, const VREG *b, int es, int sign)
+{
+U32     m = 0;
+int     e;
+U64     x, y;
+
+#if defined(ZVECTOR_SSE2)
+    __m128i xa = VR_LOAD(*a), xb = VR_LOAD(*b), bias;
+
+    switch (es) {
+    case 0:
+        bias = _mm_set1_epi8((char)0x80);
+        if (!sign) xa = _mm_xor_si128(xa, bias), xb = _mm_xor_si128(xb, bias);
+        return _mm_movemask_epi8(_mm_cmpgt_epi8(xa, xb));
+    case 1:
+        bias = _mm_set1_epi16((short)0x8000);
+        if (!sign) xa = _mm_xor_si128(xa, bias), xb = _mm_xor_si128(xb, bias);
+        return _mm_movemask_epi8(_mm_cmpgt_epi16(xa, xb));
+    case 2:
+        bias = _mm_set1_epi32((int)0x80000000);
+        if (!sign) xa = _mm_xor_si128(xa, bias), xb = _mm_xor_si128(xb, bias);
+        return _mm_movemask_epi8(_mm_cmpgt_epi32(xa, xb));
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+    {
+        x = ve_get(a, es, e);
+        y = ve_get(b, es, e);
+        if (sign ? ve_sext(x, es) > ve_sext(y, es) : x > y)
+            m |= VE_MASK(es, e);
+    }
+    return m;
+}
+
+/* Condition code for a compare result mask */
+static INLINE int vr_mask_cc(U32 m)
+{
+    return m == 0xFFFF ? 0 : m ? 1 : 3;
+}
+
+static INLINE void vr_and(VREG *r, const VREG *a, const VREG *b)
+{
+    r->D[0] = a->D[0] & b->D[0];
+    r->D[1] = a->D[1] & b->D[1];
+}
+
+static void vr_add(VREG *r, const VREG *a, const VREG *b, int es)
+{
+int     e;
+
+#if defined(ZVECTOR_SSE2)
+    __m128i x = VR_LOAD(*a), y = VR_LOAD(*b);
+
+    switch (es) {
+    case 0: VR_STORE(*r, _mm_add_epi8(x, y));  return;
+    case 1: VR_STORE(*r, _mm_add_epi16(x, y)); return;
+    case 2: VR_STORE(*r, _mm_add_epi32(x, y)); return;
+    case 3: VR_STORE(*r, _mm_add_epi64(x, y)); return;
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+        ve_put(r, es, e, ve_get(a, es, e) + ve_get(b, es, e));
+}
+
+static void vr_sub(VREG *r, const VREG *a, const VREG *b, int es)
+{
+int     e;
+
+#if defined(ZVECTOR_SSE2)
+    __m128i x = VR_LOAD(*a), y = VR_LOAD(*b);
+
+    switch (es) {
+    case 0: VR_STORE(*r, _mm_sub_epi8(x, y));  return;
+    case 1: VR_STORE(*r, _mm_sub_epi16(x, y)); return;
+    case 2: VR_STORE(*r, _mm_sub_epi32(x, y)); return;
+    case 3: VR_STORE(*r, _mm_sub_epi64(x, y)); return;
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+        ve_put(r, es, e, ve_get(a, es, e) - ve_get(b, es, e));
+}
+
+/* Elementwise maximum (max=1) or minimum (max=0) */
+static void vr_minmax(VREG *r, const VREG *a, const VREG *b,
+                      int es, int sign, int max)
+{
+VREG    k;
+
+    vr_expand(&k, vr_gtmask(a, b, es, sign));
+    if (!max)
+    {
+        const VREG *t = a; a = b; b = t;
+    }
+    r->D[0] = (a->D[0] & k.D[0]) | (b->D[0] & ~k.D[0]);
+    r->D[1] = (a->D[1] & k.D[1]) | (b->D[1] & ~k.D[1]);
+}
+
+/* Elementwise average rounded up */
+static void vr_average(VREG *r, const VREG *a, const VREG *b,
+                       int es, int sign)
+{
+int     e;
+U64     x, y;
+
+#if defined(ZVECTOR_SSE2)
+    if (!sign && es == 0)
+    {
+        VR_STORE(*r, _mm_avg_epu8(VR_LOAD(*a), VR_LOAD(*b)));
+        return;
+    }
+    if (!sign && es == 1)
+    {
+        VR_STORE(*r, _mm_avg_epu16(VR_LOAD(*a), VR_LOAD(*b)));
+        return;
+    }
+#endif
+    for (e = 0; e < VE_COUNT(es); e++)
+    {
+        x = ve_get(a, es, e);
+        y = ve_get(b, es, e);
+        if (es == 3)
+            ve_put(r, es, e, sign
+                ? (U64)((S64)x >> 1) + (U64)((S64)y >> 1) + ((x | y) & 1)
+                : (x >> 1) + (y >> 1) + ((x | y) & 1));
+        else
+            ve_put(r, es, e, sign
+                ? (U64)((ve_sext(x, es) + ve_sext(y, es) + 1) >> 1)
+                : (x + y + 1) >> 1);
+    }
+}
+
+/* Byte mask of the elements of a within the range pair of VSTRC */
+static U32 vr_range_mask(const VREG *a, U64 y, U64 ctl, int es)
+{
+VREG    s;
+U32     eq, gt, m = 0;
+
+    ctl >>= VE_BITS(es) - 3;
+    if (!(ctl & 7))
+        return 0;
+    vr_splat(&s, es, y);
+    eq = vr_eqmask(a, &s, es);
+    gt = vr_gtmask(a, &s, es, 0);
+    if (ctl & 4) m |= eq;
+    if (ctl & 2) m |= ~(eq | gt) & 0xFFFF;
+    if (ctl & 1) m |= gt;
+    return m;
+}
+
+/* Build the VFAE/VSTRC result from the match and zero masks */
+static int vr_string_result(VREG *r, U32 m, U32 zm, int flags)
+{
+int     mi, zi, cc;
+
+    if (flags & VS_IN)
+        m = ~m & 0xFFFF;
+    mi = vr_first(m);
+    zi = vr_first(zm);
+    cc = zi < mi ? 0 : m == 0 ? 3 : m == 0xFFFF ? 2 : 1;
+
+    if (flags & VS_RT)
+    {
+        /* Elements from the zero element onwards are not matched */
+        m &= ~((1U << (16 - zi)) - 1) & 0xFFFF;
+        vr_expand(r, m);
+    }
+    else
+    {
+        r->D[0] = r->D[1] = 0;
+        VR_B(*r, 7) = mi < zi ? mi : zi;
+    }
+    return cc;
+}
+
+#endif /*!defined(_ZVECTOR_C_ONCE_)*/
+
+/*-------------------------------------------------------------------*/
+/* Vector register access; bits 0-63 of VR0-VR15 are the FPRs        */
+/*-------------------------------------------------------------------*/
+static INLINE void ARCH_DEP(vr_read) (VREG *v, int r, REGS *regs)
+{
+    *v = regs->vr[r];
+    if (r < 16)
+        VR_D(*v, 0) = ((U64)regs->fpr[FPR2I(r)] << 32)
+                    | regs->fpr[FPR2I(r)+1];
+}
+
+static INLINE void ARCH_DEP(vr_write) (const VREG *v, int r, REGS *regs)
+{
+    regs->vr[r] = *v;
+    if (r < 16)
+    {
+        regs->fpr[FPR2I(r)]   = (U32)(VR_D(*v, 0) >> 32);
+        regs->fpr[FPR2I(r)+1] = (U32)VR_D(*v, 0);
+    }
+}
+
+static INLINE U64 ARCH_DEP(ve_fetch) (int es, VADR addr, int arn,
+                                      REGS *regs)
+{
+    switch (es) {
+    case 0:  return ARCH_DEP(vfetchb) (addr, arn, regs);
+    case 1:  return ARCH_DEP(vfetch2) (addr, arn, regs);
+    case 2:  return ARCH_DEP(vfetch4) (addr, arn, regs);
+    default: return ARCH_DEP(vfetch8) (addr, arn, regs);
+    }
+}
+
+static INLINE void ARCH_DEP(ve_store) (U64 x, int es, VADR addr, int arn,
+                                       REGS *regs)
+{
+    switch (es) {
+    case 0:  ARCH_DEP(vstoreb) ((BYTE)x, addr, arn, regs); break;
+    case 1:  ARCH_DEP(vstore2) ((U16)x, addr, arn, regs);  break;
+    case 2:  ARCH_DEP(vstore4) ((U32)x, addr, arn, regs);  break;
+    default: ARCH_DEP(vstore8) (x, addr, arn, regs);       break;
+    }
+}
+
+/* Common routine for VLEB, VLEH, VLEF and VLEG */
+static void ARCH_DEP(vector_load_element) (int v1, int m3, int es,
+                                 VADR effective_addr2, int b2, REGS *regs)
+{
+VREG    v;                              /* Vector register contents  */
+U64     x;                              /* Element value             */
+
+    if (m3 >= VE_COUNT(es))
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    x = ARCH_DEP(ve_fetch) (es, effective_addr2, b2, regs);
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    ve_put(&v, es, m3, x);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+}
+
+/* Common routine for VSTEB, VSTEH, VSTEF and VSTEG */
+static void ARCH_DEP(vector_store_element) (int v1, int m3, int es,
+                                 VADR effective_addr2, int b2, REGS *regs)
+{
+VREG    v;                              /* Vector register contents  */
+
+    if (m3 >= VE_COUNT(es))
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    ARCH_DEP(ve_store) (ve_get(&v, es, m3), es, effective_addr2, b2, regs);
+}
+
+/* Common routine for VLEIB, VLEIH, VLEIF and VLEIG */
+static void ARCH_DEP(vector_load_element_immediate) (int v1, int i2,
+                                 int m3, int es, REGS *regs)
+{
+VREG    v;                              /* Vector register contents  */
+
+    if (m3 >= VE_COUNT(es))
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    ve_put(&v, es, m3, (U64)(S64)(S16)i2);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+}
+
+/* Common routine for VESL, VESRL, VESRA and VERLL */
+static void ARCH_DEP(vector_element_shift) (BYTE inst[], REGS *regs,
+                                            int op)
+{
+int     v1, v3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Shift amount              */
+VREG    a;                              /* Operand                   */
+int     e, n;
+
+    VRS_A(inst, regs, v1, v3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    n = effective_addr2 & (VE_BITS(m4) - 1);
+    ARCH_DEP(vr_read) (&a, v3, regs);
+    for (e = 0; e < VE_COUNT(m4); e++)
+        ve_put(&a, m4, e, ve_shift(ve_get(&a, m4, e), m4, n, op));
+    ARCH_DEP(vr_write) (&a, v1, regs);
+}
+
+/* Common routine for VESLV, VESRLV, VESRAV and VERLLV */
+static void ARCH_DEP(vector_element_shift_vector) (BYTE inst[],
+                                                   REGS *regs, int op)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+int     e;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    for (e = 0; e < VE_COUNT(m4); e++)
+        ve_put(&a, m4, e, ve_shift(ve_get(&a, m4, e), m4,
+                        (int)(ve_get(&b, m4, e) & (VE_BITS(m4) - 1)), op));
+    ARCH_DEP(vr_write) (&a, v1, regs);
+}
+
+/* Common routine for VSL, VSRL and VSRA: bit shift by byte counts */
+static void ARCH_DEP(vector_shift_bits) (BYTE inst[], REGS *regs, int op)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     i, n;
+BYTE    fill;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+
+    for (i = 0; i < 16; i++)
+    {
+        n = VR_B(b, i) & 7;
+        if (op == VE_SLL)
+        {
+            fill = i < 15 ? VR_B(a, i+1) : 0;
+            VR_B(r, i) = (BYTE)((VR_B(a, i) << n) | (fill >> (8 - n)));
+        }
+        else
+        {
+            fill = i > 0 ? VR_B(a, i-1)
+                 : (op == VE_SRA && (VR_B(a, 0) & 0x80)) ? 0xFF : 0x00;
+            VR_B(r, i) = (BYTE)((VR_B(a, i) >> n) | (fill << (8 - n)));
+        }
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+}
+
+/* Common routine for VSLB, VSRLB and VSRAB: shift by whole bytes */
+static void ARCH_DEP(vector_shift_bytes) (BYTE inst[], REGS *regs, int op)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     i, n;
+BYTE    fill;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = (VR_B(b, 7) >> 3) & 0xF;
+    fill = (op == VE_SRA && (VR_B(a, 0) & 0x80)) ? 0xFF : 0x00;
+
+    for (i = 0; i < 16; i++)
+    {
+        if (op == VE_SLL)
+            VR_B(r, i) = i + n < 16 ? VR_B(a, i + n) : 0x00;
+        else
+            VR_B(r, i) = i - n >= 0 ? VR_B(a, i - n) : fill;
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+}
+
+/* Common routine for VUPH, VUPL, VUPLH and VUPLL */
+static void ARCH_DEP(vector_unpack) (BYTE inst[], REGS *regs,
+                                     int low, int sign)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    a, r;                           /* Operand and result        */
+int     e, n;
+U64     x;
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    n = VE_COUNT(m3 + 1);
+    for (e = 0; e < n; e++)
+    {
+        x = ve_get(&a, m3, low ? n + e : e);
+        ve_put(&r, m3 + 1, e, sign ? (U64)ve_sext(x, m3) : x);
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+}
+
+/* Common routine for VMRH and VMRL */
+static void ARCH_DEP(vector_merge) (BYTE inst[], REGS *regs, int low)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     e, n;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = VE_COUNT(m4) / 2;
+    for (e = 0; e < n; e++)
+    {
+        ve_put(&r, m4, 2*e,   ve_get(&a, m4, low ? n + e : e));
+        ve_put(&r, m4, 2*e+1, ve_get(&b, m4, low ? n + e : e));
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+}
+
+/* Common routine for VCEQ, VCH and VCHL */
+static void ARCH_DEP(vector_compare) (BYTE inst[], REGS *regs, int op)
+{
+int     v1, v2, v3, m4, m5;             /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+U32     m;                              /* Result byte mask          */
+
+    VRR_B(inst, regs, v1, v2, v3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    m = op < 0 ? vr_eqmask(&a, &b, m4) : vr_gtmask(&a, &b, m4, op);
+    vr_expand(&a, m);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+    if (m5 & VS_CS)
+        regs->psw.cc = vr_mask_cc(m);
+}
+
+/* Common routine for VMN, VMNL, VMX and VMXL */
+static void ARCH_DEP(vector_minmax) (BYTE inst[], REGS *regs,
+                                     int sign, int max)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    vr_minmax(&a, &a, &b, m4, sign, max);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+}
+
+/* Common routine for VLC, VLP, VCLZ, VCTZ: unary element operation */
+static void ARCH_DEP(vector_unary) (BYTE inst[], REGS *regs, int op)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    a;                              /* Operand                   */
+int     e;
+U64     x;
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    for (e = 0; e < VE_COUNT(m3); e++)
+    {
+        x = ve_get(&a, m3, e);
+        switch (op) {
+        case 0:  x = 0 - x; break;
+        case 1:  x = ve_sext(x, m3) < 0 ? 0 - x : x; break;
+        case 2:  x = ve_clz(x, m3); break;
+        default: x = ve_ctz(x, m3); break;
+        }
+        ve_put(&a, m3, e, x);
+    }
+    ARCH_DEP(vr_write) (&a, v1, regs);
+}
+
+/*-------------------------------------------------------------------*/
+/* E700 VLEB  - Vector Load Element (8)                        [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_8)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element) (v1, m3, 0, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_load_element_8) */
+
+
+/*-------------------------------------------------------------------*/
+/* E701 VLEH  - Vector Load Element (16)                       [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_16)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element) (v1, m3, 1, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_load_element_16) */
+
+
+/*-------------------------------------------------------------------*/
+/* E702 VLEG  - Vector Load Element (64)                       [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_64)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element) (v1, m3, 3, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_load_element_64) */
+
+
+/*-------------------------------------------------------------------*/
+/* E703 VLEF  - Vector Load Element (32)                       [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_32)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element) (v1, m3, 2, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_load_element_32) */
+
+
+/*-------------------------------------------------------------------*/
+/* E704 VLLEZ - Vector Load Logical Element and Zero           [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_logical_element_and_zero)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+VREG    v;                              /* Result                    */
+U64     x;                              /* Element value             */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 3, regs);
+
+    x = ARCH_DEP(ve_fetch) (m3, effective_addr2, b2, regs);
+
+    /* Place the element in the rightmost element of doubleword 0 */
+    v.D[0] = v.D[1] = 0;
+    ve_put(&v, m3, (8 >> m3) - 1, x);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_logical_element_and_zero) */
+
+
+/*-------------------------------------------------------------------*/
+/* E705 VLREP - Vector Load and Replicate                      [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_and_replicate)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+VREG    v;                              /* Result                    */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 3, regs);
+
+    vr_splat(&v, m3, ARCH_DEP(ve_fetch) (m3, effective_addr2, b2, regs));
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_and_replicate) */
+
+
+/*-------------------------------------------------------------------*/
+/* E706 VL    - Vector Load                                    [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[16];                        /* Operand bytes             */
+VREG    v;                              /* Result                    */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vfetchc) (buf, 16-1, effective_addr2, b2, regs);
+    VR_D(v, 0) = fetch_dw(buf);
+    VR_D(v, 1) = fetch_dw(buf + 8);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load) */
+
+
+/*-------------------------------------------------------------------*/
+/* E707 VLBB  - Vector Load to Block Boundary                  [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_to_block_boundary)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[16];                        /* Operand bytes             */
+VREG    v;                              /* Result                    */
+int     bound, n, i;
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    if (m3 > 6)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    /* Load up to but not past the next 64 << M3 byte boundary;
+       the remaining bytes of the register are left unchanged */
+    bound = 64 << m3;
+    n = bound - (int)(effective_addr2 & (bound - 1));
+    if (n > 16)
+        n = 16;
+
+    ARCH_DEP(vfetchc) (buf, n-1, effective_addr2, b2, regs);
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    for (i = 0; i < n; i++)
+        VR_B(v, i) = buf[i];
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_to_block_boundary) */
+
+
+/*-------------------------------------------------------------------*/
+/* E708 VSTEB - Vector Store Element (8)                       [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_element_8)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_store_element) (v1, m3, 0, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_element_8) */
+
+
+/*-------------------------------------------------------------------*/
+/* E709 VSTEH - Vector Store Element (16)                      [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_element_16)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_store_element) (v1, m3, 1, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_element_16) */
+
+
+/*-------------------------------------------------------------------*/
+/* E70A VSTEG - Vector Store Element (64)                      [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_element_64)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_store_element) (v1, m3, 3, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_element_64) */
+
+
+/*-------------------------------------------------------------------*/
+/* E70B VSTEF - Vector Store Element (32)                      [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_element_32)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_store_element) (v1, m3, 2, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_element_32) */
+
+
+/*-------------------------------------------------------------------*/
+/* E70E VST   - Vector Store                                   [VRX] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store)
+{
+int     v1, x2, b2, m3;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[16];                        /* Operand bytes             */
+VREG    v;                              /* Operand                   */
+
+    VRX(inst, regs, v1, x2, b2, effective_addr2, m3);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    store_dw(buf, VR_D(v, 0));
+    store_dw(buf + 8, VR_D(v, 1));
+    ARCH_DEP(vstorec) (buf, 16-1, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store) */
+
+
+/*-------------------------------------------------------------------*/
+/* E721 VLGV  - Vector Load GR from VR Element                 [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_gr_from_vr_element)
+{
+int     r1, v3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Element index             */
+VREG    v;                              /* Operand                   */
+
+    VRS_C(inst, regs, r1, v3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&v, v3, regs);
+    regs->GR_G(r1) = ve_get(&v, m4,
+                            (int)(effective_addr2 & (VE_COUNT(m4) - 1)));
+
+} /* end DEF_INST(vector_load_gr_from_vr_element) */
+
+
+/*-------------------------------------------------------------------*/
+/* E722 VLVG  - Vector Load VR Element from GR                 [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_vr_element_from_gr)
+{
+int     v1, r3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Element index             */
+VREG    v;                              /* Result                    */
+
+    VRS_B(inst, regs, v1, r3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    ve_put(&v, m4, (int)(effective_addr2 & (VE_COUNT(m4) - 1)),
+           regs->GR_G(r3));
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_vr_element_from_gr) */
+
+
+/*-------------------------------------------------------------------*/
+/* E727 LCBB  - Load Count to Block Boundary                   [RXE] */
+/*-------------------------------------------------------------------*/
+DEF_INST(load_count_to_block_boundary)
+{
+int     r1, b2, m3;                     /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+int     bound, n;
+
+    RXE(inst, regs, r1, b2, effective_addr2);
+    m3 = inst[4] >> 4;
+    FACILITY_CHECK(VECTOR, regs);
+    if (m3 > 6)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    bound = 64 << m3;
+    n = bound - (int)(effective_addr2 & (bound - 1));
+    if (n > 16)
+        n = 16;
+
+    regs->GR_L(r1) = n;
+    regs->psw.cc = n == 16 ? 0 : 3;
+
+} /* end DEF_INST(load_count_to_block_boundary) */
+
+
+/*-------------------------------------------------------------------*/
+/* E730 VESL  - Vector Element Shift Left                      [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_left)
+{
+    ARCH_DEP(vector_element_shift) (inst, regs, VE_SLL);
+
+} /* end DEF_INST(vector_element_shift_left) */
+
+
+/*-------------------------------------------------------------------*/
+/* E733 VERLL - Vector Element Rotate Left Logical             [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_rotate_left_logical)
+{
+    ARCH_DEP(vector_element_shift) (inst, regs, VE_RLL);
+
+} /* end DEF_INST(vector_element_rotate_left_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E736 VLM   - Vector Load Multiple                           [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_multiple)
+{
+int     v1, v3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[256];                       /* Operand bytes             */
+VREG    v;                              /* Register contents         */
+int     i, n;
+
+    VRS_A(inst, regs, v1, v3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+
+    n = v3 - v1 + 1;
+    if (n < 1 || n > 16)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    /* Fetch the whole operand before changing any register */
+    ARCH_DEP(vfetchc) (buf, n*16 - 1, effective_addr2, b2, regs);
+    for (i = 0; i < n; i++)
+    {
+        VR_D(v, 0) = fetch_dw(buf + i*16);
+        VR_D(v, 1) = fetch_dw(buf + i*16 + 8);
+        ARCH_DEP(vr_write) (&v, v1 + i, regs);
+    }
+
+} /* end DEF_INST(vector_load_multiple) */
+
+
+/*-------------------------------------------------------------------*/
+/* E737 VLL   - Vector Load with Length                        [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_with_length)
+{
+int     v1, r3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[16];                        /* Operand bytes             */
+VREG    v;                              /* Result                    */
+U32     n;                              /* Highest byte index        */
+
+    VRS_B(inst, regs, v1, r3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+
+    n = regs->GR_L(r3) > 15 ? 15 : regs->GR_L(r3);
+    memset(buf, 0, sizeof(buf));
+    ARCH_DEP(vfetchc) (buf, n, effective_addr2, b2, regs);
+    VR_D(v, 0) = fetch_dw(buf);
+    VR_D(v, 1) = fetch_dw(buf + 8);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_with_length) */
+
+
+/*-------------------------------------------------------------------*/
+/* E738 VESRL - Vector Element Shift Right Logical             [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_right_logical)
+{
+    ARCH_DEP(vector_element_shift) (inst, regs, VE_SRL);
+
+} /* end DEF_INST(vector_element_shift_right_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E73A VESRA - Vector Element Shift Right Arithmetic          [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_right_arithmetic)
+{
+    ARCH_DEP(vector_element_shift) (inst, regs, VE_SRA);
+
+} /* end DEF_INST(vector_element_shift_right_arithmetic) */
+
+
+/*-------------------------------------------------------------------*/
+/* E73E VSTM  - Vector Store Multiple                          [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_multiple)
+{
+int     v1, v3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[256];                       /* Operand bytes             */
+VREG    v;                              /* Register contents         */
+int     i, n;
+
+    VRS_A(inst, regs, v1, v3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+
+    n = v3 - v1 + 1;
+    if (n < 1 || n > 16)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    for (i = 0; i < n; i++)
+    {
+        ARCH_DEP(vr_read) (&v, v1 + i, regs);
+        store_dw(buf + i*16, VR_D(v, 0));
+        store_dw(buf + i*16 + 8, VR_D(v, 1));
+    }
+    ARCH_DEP(vstorec) (buf, n*16 - 1, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_multiple) */
+
+
+/*-------------------------------------------------------------------*/
+/* E73F VSTL  - Vector Store with Length                       [VRS] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_store_with_length)
+{
+int     v1, r3, b2, m4;                 /* Instruction fields        */
+VADR    effective_addr2;                /* Effective address         */
+BYTE    buf[16];                        /* Operand bytes             */
+VREG    v;                              /* Operand                   */
+U32     n;                              /* Highest byte index        */
+
+    VRS_B(inst, regs, v1, r3, b2, effective_addr2, m4);
+    ZVECTOR_CHECK(regs);
+
+    n = regs->GR_L(r3) > 15 ? 15 : regs->GR_L(r3);
+    ARCH_DEP(vr_read) (&v, v1, regs);
+    store_dw(buf, VR_D(v, 0));
+    store_dw(buf + 8, VR_D(v, 1));
+    ARCH_DEP(vstorec) (buf, n, effective_addr2, b2, regs);
+
+} /* end DEF_INST(vector_store_with_length) */
+
+
+/*-------------------------------------------------------------------*/
+/* E740 VLEIB - Vector Load Element Immediate (8)              [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_immediate_8)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element_immediate) (v1, i2, m3, 0, regs);
+
+} /* end DEF_INST(vector_load_element_immediate_8) */
+
+
+/*-------------------------------------------------------------------*/
+/* E741 VLEIH - Vector Load Element Immediate (16)             [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_immediate_16)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element_immediate) (v1, i2, m3, 1, regs);
+
+} /* end DEF_INST(vector_load_element_immediate_16) */
+
+
+/*-------------------------------------------------------------------*/
+/* E742 VLEIG - Vector Load Element Immediate (64)             [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_immediate_64)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element_immediate) (v1, i2, m3, 3, regs);
+
+} /* end DEF_INST(vector_load_element_immediate_64) */
+
+
+/*-------------------------------------------------------------------*/
+/* E743 VLEIF - Vector Load Element Immediate (32)             [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_element_immediate_32)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+    ARCH_DEP(vector_load_element_immediate) (v1, i2, m3, 2, regs);
+
+} /* end DEF_INST(vector_load_element_immediate_32) */
+
+
+/*-------------------------------------------------------------------*/
+/* E744 VGBM  - Vector Generate Byte Mask                      [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_generate_byte_mask)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+VREG    v;                              /* Result                    */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+
+    vr_expand(&v, i2);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_generate_byte_mask) */
+
+
+/*-------------------------------------------------------------------*/
+/* E745 VREPI - Vector Replicate Immediate                     [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_replicate_immediate)
+{
+int     v1, i2, m3;                     /* Instruction fields        */
+VREG    v;                              /* Result                    */
+
+    VRI_A(inst, regs, v1, i2, m3);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 3, regs);
+
+    vr_splat(&v, m3, (U64)(S64)(S16)i2);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_replicate_immediate) */
+
+
+/*-------------------------------------------------------------------*/
+/* E746 VGM   - Vector Generate Mask                           [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_generate_mask)
+{
+int     v1, i2, i3, m4;                 /* Instruction fields        */
+VREG    v;                              /* Result                    */
+int     bits, b;
+U64     x = 0;
+
+    VRI_B(inst, regs, v1, i2, i3, m4);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    /* Bits I2 through I3 are ones, wrapping if I2 is greater */
+    bits = VE_BITS(m4);
+    i2 &= bits - 1;
+    i3 &= bits - 1;
+    for (b = 0; b < bits; b++)
+        if (i2 <= i3 ? (b >= i2 && b <= i3) : (b >= i2 || b <= i3))
+            x |= (U64)1 << (bits - 1 - b);
+
+    vr_splat(&v, m4, x);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_generate_mask) */
+
+
+/*-------------------------------------------------------------------*/
+/* E74D VREP  - Vector Replicate                               [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_replicate)
+{
+int     v1, v3, i2, m4;                 /* Instruction fields        */
+VREG    v;                              /* Operand and result        */
+
+    VRI_C(inst, regs, v1, v3, i2, m4);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+    if (i2 >= VE_COUNT(m4))
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    ARCH_DEP(vr_read) (&v, v3, regs);
+    vr_splat(&v, m4, ve_get(&v, m4, i2));
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_replicate) */
+
+
+/*-------------------------------------------------------------------*/
+/* E750 VPOPCT - Vector Population Count                       [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_population_count)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    v;                              /* Operand and result        */
+int     i, n;
+BYTE    b;
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    if (m3 != 0)
+        regs->program_interrupt(regs, PGM_SPECIFICATION_EXCEPTION);
+
+    ARCH_DEP(vr_read) (&v, v2, regs);
+    for (i = 0; i < 16; i++)
+    {
+        for (n = 0, b = VR_B(v, i); b; b &= b - 1)
+            n++;
+        VR_B(v, i) = n;
+    }
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_population_count) */
+
+
+/*-------------------------------------------------------------------*/
+/* E752 VCTZ  - Vector Count Trailing Zeros                    [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_count_trailing_zeros)
+{
+    ARCH_DEP(vector_unary) (inst, regs, 3);
+
+} /* end DEF_INST(vector_count_trailing_zeros) */
+
+
+/*-------------------------------------------------------------------*/
+/* E753 VCLZ  - Vector Count Leading Zeros                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_count_leading_zeros)
+{
+    ARCH_DEP(vector_unary) (inst, regs, 2);
+
+} /* end DEF_INST(vector_count_leading_zeros) */
+
+
+/*-------------------------------------------------------------------*/
+/* E756 VLR   - Vector Load Vector                             [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_vector)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    v;                              /* Operand                   */
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&v, v2, regs);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_vector) */
+
+
+/*-------------------------------------------------------------------*/
+/* E75C VISTR - Vector Isolate String                          [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_isolate_string)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    a, k;                           /* Operand and keep mask     */
+int     zi;                             /* Index of zero element     */
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    k.D[0] = k.D[1] = 0;
+    zi = vr_first(vr_eqmask(&a, &k, m3));
+
+    /* Keep the elements to the left of the first zero element */
+    vr_expand(&k, ~((1U << (16 - zi)) - 1) & 0xFFFF);
+    vr_and(&a, &a, &k);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+    if (m5 & VS_CS)
+        regs->psw.cc = zi < 16 ? 0 : 3;
+
+} /* end DEF_INST(vector_isolate_string) */
+
+
+/*-------------------------------------------------------------------*/
+/* E75F VSEG  - Vector Sign Extend to Doubleword               [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_sign_extend_to_doubleword)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    v;                              /* Operand and result        */
+S64     x0, x1;
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m3, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&v, v2, regs);
+    x0 = ve_sext(ve_get(&v, m3, (8 >> m3) - 1), m3);
+    x1 = ve_sext(ve_get(&v, m3, (16 >> m3) - 1), m3);
+    VR_D(v, 0) = (U64)x0;
+    VR_D(v, 1) = (U64)x1;
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_sign_extend_to_doubleword) */
+
+
+/*-------------------------------------------------------------------*/
+/* E760 VMRL  - Vector Merge Low                               [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_merge_low)
+{
+    ARCH_DEP(vector_merge) (inst, regs, 1);
+
+} /* end DEF_INST(vector_merge_low) */
+
+
+/*-------------------------------------------------------------------*/
+/* E761 VMRH  - Vector Merge High                              [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_merge_high)
+{
+    ARCH_DEP(vector_merge) (inst, regs, 0);
+
+} /* end DEF_INST(vector_merge_high) */
+
+
+/*-------------------------------------------------------------------*/
+/* E762 VLVGP - Vector Load VR from GRs Disjoint               [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_vr_from_grs_disjoint)
+{
+int     v1, r2, r3;                     /* Instruction fields        */
+VREG    v;                              /* Result                    */
+
+    VRR_F(inst, regs, v1, r2, r3);
+    ZVECTOR_CHECK(regs);
+
+    VR_D(v, 0) = regs->GR_G(r2);
+    VR_D(v, 1) = regs->GR_G(r3);
+    ARCH_DEP(vr_write) (&v, v1, regs);
+
+} /* end DEF_INST(vector_load_vr_from_grs_disjoint) */
+
+
+/*-------------------------------------------------------------------*/
+/* E764 VSUM  - Vector Sum Across Word                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_sum_across_word)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     w, k, n;
+U32     sum;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 1, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = 4 >> m4;
+    for (w = 0; w < 4; w++)
+    {
+        sum = (U32)ve_get(&b, m4, (w + 1) * n - 1);
+        for (k = 0; k < n; k++)
+            sum += (U32)ve_get(&a, m4, w * n + k);
+        VR_F(r, w) = sum;
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_sum_across_word) */
+
+
+/*-------------------------------------------------------------------*/
+/* E765 VSUMG - Vector Sum Across Doubleword                   [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_sum_across_doubleword)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     d, k, n;
+U64     sum;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 1, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = 8 >> m4;
+    for (d = 0; d < 2; d++)
+    {
+        sum = ve_get(&b, m4, (d + 1) * n - 1);
+        for (k = 0; k < n; k++)
+            sum += ve_get(&a, m4, d * n + k);
+        VR_D(r, d) = sum;
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_sum_across_doubleword) */
+
+
+/*-------------------------------------------------------------------*/
+/* E767 VSUMQ - Vector Sum Across Quadword                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_sum_across_quadword)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands and result       */
+int     e;
+U64     hi, lo, x;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 2, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    hi = 0;
+    lo = ve_get(&b, m4, VE_COUNT(m4) - 1);
+    for (e = 0; e < VE_COUNT(m4); e++)
+    {
+        x = ve_get(&a, m4, e);
+        lo += x;
+        if (lo < x)
+            hi++;
+    }
+    VR_D(a, 0) = hi;
+    VR_D(a, 1) = lo;
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_sum_across_quadword) */
+
+
+/*-------------------------------------------------------------------*/
+/* E768 VN    - Vector AND                                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_and)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    a.D[0] &= b.D[0];
+    a.D[1] &= b.D[1];
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_and) */
+
+
+/*-------------------------------------------------------------------*/
+/* E769 VNC   - Vector AND with Complement                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_and_with_complement)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    a.D[0] &= ~b.D[0];
+    a.D[1] &= ~b.D[1];
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_and_with_complement) */
+
+
+/*-------------------------------------------------------------------*/
+/* E76A VO    - Vector OR                                      [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_or)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    a.D[0] |= b.D[0];
+    a.D[1] |= b.D[1];
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_or) */
+
+
+/*-------------------------------------------------------------------*/
+/* E76B VNO   - Vector NOR                                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_nor)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    a.D[0] = ~(a.D[0] | b.D[0]);
+    a.D[1] = ~(a.D[1] | b.D[1]);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_nor) */
+
+
+/*-------------------------------------------------------------------*/
+/* E76D VX    - Vector Exclusive OR                            [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_exclusive_or)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    a.D[0] ^= b.D[0];
+    a.D[1] ^= b.D[1];
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_exclusive_or) */
+
+
+/*-------------------------------------------------------------------*/
+/* E770 VESLV - Vector Element Shift Left Vector               [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_left_vector)
+{
+    ARCH_DEP(vector_element_shift_vector) (inst, regs, VE_SLL);
+
+} /* end DEF_INST(vector_element_shift_left_vector) */
+
+
+/*-------------------------------------------------------------------*/
+/* E773 VERLLV - Vector Element Rotate Left Logical Vector     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_rotate_left_logical_vector)
+{
+    ARCH_DEP(vector_element_shift_vector) (inst, regs, VE_RLL);
+
+} /* end DEF_INST(vector_element_rotate_left_logical_vector) */
+
+
+/*-------------------------------------------------------------------*/
+/* E774 VSL   - Vector Shift Left                              [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_left)
+{
+    ARCH_DEP(vector_shift_bits) (inst, regs, VE_SLL);
+
+} /* end DEF_INST(vector_shift_left) */
+
+
+/*-------------------------------------------------------------------*/
+/* E775 VSLB  - Vector Shift Left by Byte                      [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_left_by_byte)
+{
+    ARCH_DEP(vector_shift_bytes) (inst, regs, VE_SLL);
+
+} /* end DEF_INST(vector_shift_left_by_byte) */
+
+
+/*-------------------------------------------------------------------*/
+/* E777 VSLDB - Vector Shift Left Double by Byte               [VRI] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_left_double_by_byte)
+{
+int     v1, v2, v3, i4, m5;             /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     i, n;
+
+    VRI_D(inst, regs, v1, v2, v3, i4, m5);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = i4 & 0xF;
+    for (i = 0; i < 16; i++)
+        VR_B(r, i) = i + n < 16 ? VR_B(a, i + n) : VR_B(b, i + n - 16);
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_shift_left_double_by_byte) */
+
+
+/*-------------------------------------------------------------------*/
+/* E778 VESRLV - Vector Element Shift Right Logical Vector     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_right_logical_vector)
+{
+    ARCH_DEP(vector_element_shift_vector) (inst, regs, VE_SRL);
+
+} /* end DEF_INST(vector_element_shift_right_logical_vector) */
+
+
+/*-------------------------------------------------------------------*/
+/* E77A VESRAV - Vector Element Shift Right Arithmetic Vector  [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_element_shift_right_arithmetic_vector)
+{
+    ARCH_DEP(vector_element_shift_vector) (inst, regs, VE_SRA);
+
+} /* end DEF_INST(vector_element_shift_right_arithmetic_vector) */
+
+
+/*-------------------------------------------------------------------*/
+/* E77C VSRL  - Vector Shift Right Logical                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_right_logical)
+{
+    ARCH_DEP(vector_shift_bits) (inst, regs, VE_SRL);
+
+} /* end DEF_INST(vector_shift_right_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E77D VSRLB - Vector Shift Right Logical by Byte             [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_right_logical_by_byte)
+{
+    ARCH_DEP(vector_shift_bytes) (inst, regs, VE_SRL);
+
+} /* end DEF_INST(vector_shift_right_logical_by_byte) */
+
+
+/*-------------------------------------------------------------------*/
+/* E77E VSRA  - Vector Shift Right Arithmetic                  [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_right_arithmetic)
+{
+    ARCH_DEP(vector_shift_bits) (inst, regs, VE_SRA);
+
+} /* end DEF_INST(vector_shift_right_arithmetic) */
+
+
+/*-------------------------------------------------------------------*/
+/* E77F VSRAB - Vector Shift Right Arithmetic by Byte          [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_shift_right_arithmetic_by_byte)
+{
+    ARCH_DEP(vector_shift_bytes) (inst, regs, VE_SRA);
+
+} /* end DEF_INST(vector_shift_right_arithmetic_by_byte) */
+
+
+/*-------------------------------------------------------------------*/
+/* E780 VFEE  - Vector Find Element Equal                      [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_find_element_equal)
+{
+int     v1, v2, v3, m4, m5;             /* Instruction fields        */
+VREG    a, b, z;                        /* Operands                  */
+int     ei, zi;                         /* Match and zero indexes    */
+
+    VRR_B(inst, regs, v1, v2, v3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    z.D[0] = z.D[1] = 0;
+    ei = vr_first(vr_eqmask(&a, &b, m4));
+    zi = (m5 & VS_ZS) ? vr_first(vr_eqmask(&a, &z, m4)) : 16;
+
+    VR_B(z, 7) = ei < zi ? ei : zi;
+    ARCH_DEP(vr_write) (&z, v1, regs);
+
+    if (m5 & VS_CS)
+        regs->psw.cc = (ei < 16 && ei <= zi) ? 1 : zi < 16 ? 0 : 3;
+
+} /* end DEF_INST(vector_find_element_equal) */
+
+
+/*-------------------------------------------------------------------*/
+/* E781 VFENE - Vector Find Element Not Equal                  [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_find_element_not_equal)
+{
+int     v1, v2, v3, m4, m5;             /* Instruction fields        */
+VREG    a, b, z;                        /* Operands                  */
+int     ni, zi;                         /* Mismatch and zero indexes */
+
+    VRR_B(inst, regs, v1, v2, v3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    z.D[0] = z.D[1] = 0;
+    ni = vr_first(~vr_eqmask(&a, &b, m4) & 0xFFFF);
+    zi = (m5 & VS_ZS) ? vr_first(vr_eqmask(&a, &z, m4)) : 16;
+
+    VR_B(z, 7) = ni < zi ? ni : zi;
+    ARCH_DEP(vr_write) (&z, v1, regs);
+
+    if (m5 & VS_CS)
+    {
+        if (ni < 16 && ni <= zi)
+            regs->psw.cc = ve_get(&a, m4, ni >> m4)
+                         < ve_get(&b, m4, ni >> m4) ? 1 : 2;
+        else
+            regs->psw.cc = zi < 16 ? 0 : 3;
+    }
+
+} /* end DEF_INST(vector_find_element_not_equal) */
+
+
+/*-------------------------------------------------------------------*/
+/* E782 VFAE  - Vector Find Any Element Equal                  [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_find_any_element_equal)
+{
+int     v1, v2, v3, m4, m5;             /* Instruction fields        */
+VREG    a, b, s;                        /* Operands                  */
+U32     m = 0, zm = 0;                  /* Match and zero masks      */
+int     e, cc;
+
+    VRR_B(inst, regs, v1, v2, v3, m4, m5);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+
+    /* Compare every element of V2 with each element of V3 */
+    for (e = 0; e < VE_COUNT(m4); e++)
+    {
+        vr_splat(&s, m4, ve_get(&b, m4, e));
+        m |= vr_eqmask(&a, &s, m4);
+    }
+    if (m5 & VS_ZS)
+    {
+        s.D[0] = s.D[1] = 0;
+        zm = vr_eqmask(&a, &s, m4);
+    }
+
+    cc = vr_string_result(&a, m, zm, m5);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+    if (m5 & VS_CS)
+        regs->psw.cc = cc;
+
+} /* end DEF_INST(vector_find_any_element_equal) */
+
+
+/*-------------------------------------------------------------------*/
+/* E784 VPDI  - Vector Permute Doubleword Immediate            [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_permute_doubleword_immediate)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    VR_D(r, 0) = VR_D(a, (m4 & 4) ? 1 : 0);
+    VR_D(r, 1) = VR_D(b, (m4 & 1) ? 1 : 0);
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_permute_doubleword_immediate) */
+
+
+/*-------------------------------------------------------------------*/
+/* E78A VSTRC - Vector String Range Compare                    [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_string_range_compare)
+{
+int     v1, v2, v3, v4, m5, m6;         /* Instruction fields        */
+VREG    a, b, c;                        /* Operands                  */
+U32     m = 0, zm = 0;                  /* Match and zero masks      */
+int     k, cc;
+
+    VRR_D(inst, regs, v1, v2, v3, v4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m5, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    ARCH_DEP(vr_read) (&c, v4, regs);
+
+    /* Each even/odd pair of V3 elements is a range whose comparisons
+       are selected by the high-order bits of the V4 elements */
+    for (k = 0; k < VE_COUNT(m5); k += 2)
+        m |= vr_range_mask(&a, ve_get(&b, m5, k), ve_get(&c, m5, k), m5)
+           & vr_range_mask(&a, ve_get(&b, m5, k+1), ve_get(&c, m5, k+1), m5);
+    if (m6 & VS_ZS)
+    {
+        b.D[0] = b.D[1] = 0;
+        zm = vr_eqmask(&a, &b, m5);
+    }
+
+    cc = vr_string_result(&a, m, zm, m6);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+    if (m6 & VS_CS)
+        regs->psw.cc = cc == 2 ? 1 : cc;
+
+} /* end DEF_INST(vector_string_range_compare) */
+
+
+/*-------------------------------------------------------------------*/
+/* E78C VPERM - Vector Permute                                 [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_permute)
+{
+int     v1, v2, v3, v4, m5, m6;         /* Instruction fields        */
+VREG    a, b, c, r;                     /* Operands and result       */
+int     i, n;
+
+    VRR_E(inst, regs, v1, v2, v3, v4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    ARCH_DEP(vr_read) (&c, v4, regs);
+    for (i = 0; i < 16; i++)
+    {
+        n = VR_B(c, i) & 0x1F;
+        VR_B(r, i) = n < 16 ? VR_B(a, n) : VR_B(b, n - 16);
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_permute) */
+
+
+/*-------------------------------------------------------------------*/
+/* E78D VSEL  - Vector Select                                  [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_select)
+{
+int     v1, v2, v3, v4, m5, m6;         /* Instruction fields        */
+VREG    a, b, c;                        /* Operands                  */
+
+    VRR_E(inst, regs, v1, v2, v3, v4, m5, m6);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    ARCH_DEP(vr_read) (&c, v4, regs);
+    a.D[0] = (a.D[0] & c.D[0]) | (b.D[0] & ~c.D[0]);
+    a.D[1] = (a.D[1] & c.D[1]) | (b.D[1] & ~c.D[1]);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_select) */
+
+
+/*-------------------------------------------------------------------*/
+/* E794 VPK   - Vector Pack                                    [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_pack)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b, r;                        /* Operands and result       */
+int     e, n;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 1, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    n = VE_COUNT(m4);
+    for (e = 0; e < n; e++)
+    {
+        ve_put(&r, m4 - 1, e,     ve_get(&a, m4, e));
+        ve_put(&r, m4 - 1, n + e, ve_get(&b, m4, e));
+    }
+    ARCH_DEP(vr_write) (&r, v1, regs);
+
+} /* end DEF_INST(vector_pack) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7A2 VML   - Vector Multiply Low                            [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_multiply_low)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+int     e;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 2, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+#if defined(ZVECTOR_SSE2)
+    if (m4 == 1)
+        VR_STORE(a, _mm_mullo_epi16(VR_LOAD(a), VR_LOAD(b)));
+    else
+#endif
+    for (e = 0; e < VE_COUNT(m4); e++)
+        ve_put(&a, m4, e, ve_get(&a, m4, e) * ve_get(&b, m4, e));
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_multiply_low) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7D4 VUPLL - Vector Unpack Logical Low                      [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_unpack_logical_low)
+{
+    ARCH_DEP(vector_unpack) (inst, regs, 1, 0);
+
+} /* end DEF_INST(vector_unpack_logical_low) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7D5 VUPLH - Vector Unpack Logical High                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_unpack_logical_high)
+{
+    ARCH_DEP(vector_unpack) (inst, regs, 0, 0);
+
+} /* end DEF_INST(vector_unpack_logical_high) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7D6 VUPL  - Vector Unpack Low                              [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_unpack_low)
+{
+    ARCH_DEP(vector_unpack) (inst, regs, 1, 1);
+
+} /* end DEF_INST(vector_unpack_low) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7D7 VUPH  - Vector Unpack High                             [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_unpack_high)
+{
+    ARCH_DEP(vector_unpack) (inst, regs, 0, 1);
+
+} /* end DEF_INST(vector_unpack_high) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7D8 VTM   - Vector Test under Mask                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_test_under_mask)
+{
+int     v1, v2, m3, m4, m5;             /* Instruction fields        */
+VREG    a, m;                           /* Operand and mask          */
+
+    VRR_A(inst, regs, v1, v2, m3, m4, m5);
+    ZVECTOR_CHECK(regs);
+
+    ARCH_DEP(vr_read) (&a, v1, regs);
+    ARCH_DEP(vr_read) (&m, v2, regs);
+    vr_and(&a, &a, &m);
+
+    regs->psw.cc = (a.D[0] | a.D[1]) == 0 ? 0
+                 : (a.D[0] == m.D[0] && a.D[1] == m.D[1]) ? 3 : 1;
+
+} /* end DEF_INST(vector_test_under_mask) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7DE VLC   - Vector Load Complement                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_complement)
+{
+    ARCH_DEP(vector_unary) (inst, regs, 0);
+
+} /* end DEF_INST(vector_load_complement) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7DF VLP   - Vector Load Positive                           [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_load_positive)
+{
+    ARCH_DEP(vector_unary) (inst, regs, 1);
+
+} /* end DEF_INST(vector_load_positive) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F0 VAVGL - Vector Average Logical                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_average_logical)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    vr_average(&a, &a, &b, m4, 0);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_average_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F2 VAVG  - Vector Average                                 [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_average)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 3, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    vr_average(&a, &a, &b, m4, 1);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_average) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F3 VA    - Vector Add                                     [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_add)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+U64     lo;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 4, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    if (m4 == 4)
+    {
+        lo = VR_D(a, 1) + VR_D(b, 1);
+        VR_D(a, 0) += VR_D(b, 0) + (lo < VR_D(b, 1));
+        VR_D(a, 1) = lo;
+    }
+    else
+        vr_add(&a, &a, &b, m4);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_add) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F7 VS    - Vector Subtract                                [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_subtract)
+{
+int     v1, v2, v3, m4, m5, m6;         /* Instruction fields        */
+VREG    a, b;                           /* Operands                  */
+U64     lo;
+
+    VRR_C(inst, regs, v1, v2, v3, m4, m5, m6);
+    ZVECTOR_CHECK(regs);
+    VE_SIZE_CHECK(m4, 0, 4, regs);
+
+    ARCH_DEP(vr_read) (&a, v2, regs);
+    ARCH_DEP(vr_read) (&b, v3, regs);
+    if (m4 == 4)
+    {
+        lo = VR_D(a, 1) - VR_D(b, 1);
+        VR_D(a, 0) -= VR_D(b, 0) + (VR_D(a, 1) < VR_D(b, 1));
+        VR_D(a, 1) = lo;
+    }
+    else
+        vr_sub(&a, &a, &b, m4);
+    ARCH_DEP(vr_write) (&a, v1, regs);
+
+} /* end DEF_INST(vector_subtract) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F8 VCEQ  - Vector Compare Equal                           [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_compare_equal)
+{
+    ARCH_DEP(vector_compare) (inst, regs, -1);
+
+} /* end DEF_INST(vector_compare_equal) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7F9 VCHL  - Vector Compare High Logical                    [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_compare_high_logical)
+{
+    ARCH_DEP(vector_compare) (inst, regs, 0);
+
+} /* end DEF_INST(vector_compare_high_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7FB VCH   - Vector Compare High                            [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_compare_high)
+{
+    ARCH_DEP(vector_compare) (inst, regs, 1);
+
+} /* end DEF_INST(vector_compare_high) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7FC VMNL  - Vector Minimum Logical                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_minimum_logical)
+{
+    ARCH_DEP(vector_minmax) (inst, regs, 0, 0);
+
+} /* end DEF_INST(vector_minimum_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7FD VMXL  - Vector Maximum Logical                         [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_maximum_logical)
+{
+    ARCH_DEP(vector_minmax) (inst, regs, 0, 1);
+
+} /* end DEF_INST(vector_maximum_logical) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7FE VMN   - Vector Minimum                                 [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_minimum)
+{
+    ARCH_DEP(vector_minmax) (inst, regs, 1, 0);
+
+} /* end DEF_INST(vector_minimum) */
+
+
+/*-------------------------------------------------------------------*/
+/* E7FF VMX   - Vector Maximum                                 [VRR] */
+/*-------------------------------------------------------------------*/
+DEF_INST(vector_maximum)
+{
+    ARCH_DEP(vector_minmax) (inst, regs, 1, 1);
+
+} /* end DEF_INST(vector_maximum) */
+
+#endif /*defined(FEATURE_ZVECTOR_FACILITY)*/
+
+#if !defined(_GEN_ARCH)
+
+#if defined(_ARCHMODE2)
+ #define  _GEN_ARCH _ARCHMODE2
+ #include "zvector.c"
+#endif
+
+#if defined(_ARCHMODE3)
+ #undef   _GEN_ARCH
+ #define  _GEN_ARCH _ARCHMODE3
+ #include "zvector.c"
+#endif
+
+#endif /*!defined(_GEN_ARCH)*/
+
+
+/* end of zvector.c */